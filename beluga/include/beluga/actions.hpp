@@ -16,9 +16,13 @@
 #define BELUGA_ACTIONS_HPP
 
 #include <beluga/actions/assign.hpp>
+#include <beluga/actions/cluster.hpp>
+#include <beluga/actions/discard_below.hpp>
 #include <beluga/actions/normalize.hpp>
 #include <beluga/actions/propagate.hpp>
 #include <beluga/actions/reweight.hpp>
+#include <beluga/actions/reweight_deferred.hpp>
+#include <beluga/actions/reweight_normalized.hpp>
 
 /**
  * \file
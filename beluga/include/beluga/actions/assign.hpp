@@ -15,6 +15,9 @@
 #ifndef BELUGA_ACTIONS_ASSIGN_HPP
 #define BELUGA_ACTIONS_ASSIGN_HPP
 
+#include <type_traits>
+#include <utility>
+
 #include <range/v3/action/action.hpp>
 #include <range/v3/functional/bind_back.hpp>
 #include <range/v3/range/conversion.hpp>
@@ -45,9 +48,33 @@ inline constexpr bool is_range_closure_v = is_range_closure<T>::value;
 
 namespace detail {
 
+/// \cond
+
+template <class T, class = void>
+struct is_capacity_retaining : std::false_type {};
+
+template <class T>
+struct is_capacity_retaining<
+    T,
+    std::void_t<
+        decltype(std::declval<const T&>().capacity()),
+        decltype(std::declval<T&>().assign(std::declval<T&>().begin(), std::declval<T&>().end()))>> : std::true_type {
+};
+
+template <class T>
+inline constexpr bool is_capacity_retaining_v = is_capacity_retaining<T>::value;
+
+/// \endcond
+
 /// Implementation detail for an assign range adaptor object.
 struct assign_fn {
   /// Overload that implements the assign algorithm.
+  /**
+   * When the input range supports it, assignment retains the capacity of the input range
+   * at its high-water mark, so repeated assignments of ranges of fluctuating size (e.g.
+   * KLD-limited resampling outputs) do not shrink and later regrow the backing storage.
+   * Callers that do want to release memory can call `shrink_to_fit()` on the range.
+   */
   template <
       class Range,
       class Fn,
@@ -58,7 +85,17 @@ struct assign_fn {
     if constexpr (!std::is_same_v<Range, std::decay_t<decltype(view)>>) {
       // If the result of invoking the closure is not the range itself,
       // then we need to convert the view and assign it to the input range.
-      range = std::move(view) | ranges::to<Range>;
+      // The conversion goes through a temporary container because the view
+      // may lazily read from the range being assigned.
+      auto materialized = std::move(view) | ranges::to<Range>;
+      if constexpr (is_capacity_retaining_v<Range>) {
+        if (materialized.capacity() < range.capacity()) {
+          // Keep the larger storage already owned by the input range.
+          range.assign(materialized.begin(), materialized.end());
+          return range;
+        }
+      }
+      range = std::move(materialized);
     }
     return range;
   }
@@ -0,0 +1,223 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ACTIONS_CLUSTER_HPP
+#define BELUGA_ACTIONS_CLUSTER_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <limits>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <beluga/algorithm/spatial_hash.hpp>
+#include <beluga/primitives.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/utility/thread_pool.hpp>
+#include <beluga/views/particles.hpp>
+
+#include <range/v3/action/action.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/view/common.hpp>
+
+/**
+ * \file
+ * \brief Implementation of the cluster range adaptor object.
+ */
+
+namespace beluga::actions {
+
+namespace detail {
+
+/// Integer cell coordinates of an SE2 state at the clustering resolution.
+struct se2_cell {  // NOLINT(readability-identifier-naming)
+  std::int64_t x;      ///< Floored X translation index.
+  std::int64_t y;      ///< Floored Y translation index.
+  std::int64_t theta;  ///< Floored rotation angle index.
+
+  /// Memberwise equality, so cells can key an `std::unordered_map`.
+  constexpr bool operator==(const se2_cell& other) const noexcept {
+    return x == other.x && y == other.y && theta == other.theta;
+  }
+};
+
+/// Hasher for `se2_cell` instances, reusing the per-axis fibonacci cell hash.
+struct se2_cell_hash {  // NOLINT(readability-identifier-naming)
+  /// Returns the hash of the given cell.
+  constexpr std::size_t operator()(const se2_cell& cell) const noexcept {
+    constexpr auto kBits = std::numeric_limits<std::size_t>::digits / 3;
+    return beluga::detail::fibo_hash<kBits, 0>(static_cast<std::size_t>(cell.x)) ^
+           beluga::detail::fibo_hash<kBits, 1>(static_cast<std::size_t>(cell.y)) ^
+           beluga::detail::fibo_hash<kBits, 2>(static_cast<std::size_t>(cell.theta));
+  }
+};
+
+/// Implementation detail for a cluster range adaptor object.
+struct cluster_base_fn {
+  /// Overload that implements the clustering algorithm.
+  /**
+   * \tparam ExecutionPolicy An [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t).
+   * \tparam Range An [input range](https://en.cppreference.com/w/cpp/ranges/input_range) of particles.
+   * \param policy The execution policy to use.
+   * \param range An existing range of particles to apply this action to.
+   * \param resolution The x, y and theta clustering resolutions, as the
+   * `spatial_hash<Sophus::SE2d>` constructor takes them.
+   *
+   * Particles are bucketed into integer grid cells at the given resolutions, occupied
+   * cells that touch (including diagonals) are merged with a union-find pass, and the
+   * resulting connected-component id is written into the `beluga::Cluster` column of
+   * each particle. Unlike raw spatial hashes, ids are dense (0 to the number of
+   * clusters minus one) and particles of a mode that spans several cells share one id,
+   * so `beluga::cluster_estimate()` and downstream grouping consumers can use the
+   * column without a grouping pass of their own.
+   *
+   * The per-particle passes (cell computation and id write-back) run under the given
+   * execution policy; the union-find merge only visits occupied cells, which are few
+   * compared to particles.
+   */
+  template <
+      class ExecutionPolicy,
+      class Range,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  auto operator()(ExecutionPolicy&& policy, Range& range, std::array<double, 3> resolution) const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    auto states = range | beluga::views::states | ranges::views::common;
+    auto clusters = range | beluga::views::clusters | ranges::views::common;
+
+    const auto size = static_cast<std::size_t>(ranges::size(range));
+    if (size == 0) {
+      return range;
+    }
+
+    const double inverse_x = 1. / resolution[0];
+    const double inverse_y = 1. / resolution[1];
+    const double inverse_theta = 1. / resolution[2];
+
+    auto cells = std::vector<se2_cell>(size);
+    beluga::execution::transform(
+        policy, std::begin(states), std::end(states), cells.begin(),
+        [inverse_x, inverse_y, inverse_theta](const auto& state) {
+          const auto& position = state.translation();
+          return se2_cell{
+              static_cast<std::int64_t>(std::floor(static_cast<double>(position.x()) * inverse_x)),
+              static_cast<std::int64_t>(std::floor(static_cast<double>(position.y()) * inverse_y)),
+              static_cast<std::int64_t>(std::floor(static_cast<double>(state.so2().log()) * inverse_theta))};
+        });
+
+    // Assign each occupied cell a slot in first-occurrence order, so resulting ids
+    // are deterministic for a given particle order.
+    auto slots = std::unordered_map<se2_cell, std::size_t, se2_cell_hash>{};
+    slots.reserve(size);
+    auto parent = std::vector<std::size_t>{};
+    for (const auto& cell : cells) {
+      const auto [it, inserted] = slots.try_emplace(cell, parent.size());
+      if (inserted) {
+        parent.push_back(it->second);
+      }
+    }
+
+    const auto find = [&parent](std::size_t slot) {
+      while (parent[slot] != slot) {
+        parent[slot] = parent[parent[slot]];  // halve the path on the way up
+        slot = parent[slot];
+      }
+      return slot;
+    };
+
+    // Merge occupied cells that touch. Only forward neighbor offsets are probed, so
+    // each adjacent pair is visited once.
+    constexpr std::array<std::array<std::int64_t, 3>, 13> kForwardNeighborOffsets = {
+        {{0, 0, 1},  {0, 1, -1},  {0, 1, 0},  {0, 1, 1},  {1, -1, -1}, {1, -1, 0}, {1, -1, 1},
+         {1, 0, -1}, {1, 0, 0},   {1, 0, 1},  {1, 1, -1}, {1, 1, 0},   {1, 1, 1}}};
+    for (const auto& [cell, slot] : slots) {
+      for (const auto& offset : kForwardNeighborOffsets) {
+        const auto it = slots.find(se2_cell{cell.x + offset[0], cell.y + offset[1], cell.theta + offset[2]});
+        if (it != slots.end()) {
+          parent[find(slot)] = find(it->second);
+        }
+      }
+    }
+
+    // Compact union-find roots into dense cluster ids.
+    constexpr auto kUnassigned = std::numeric_limits<std::size_t>::max();
+    auto ids = std::vector<std::size_t>(parent.size(), kUnassigned);
+    std::size_t count = 0;
+    for (std::size_t slot = 0; slot < parent.size(); ++slot) {
+      const std::size_t root = find(slot);
+      if (ids[root] == kUnassigned) {
+        ids[root] = count++;
+      }
+      ids[slot] = ids[root];
+    }
+
+    beluga::execution::transform(
+        policy, cells.begin(), cells.end(), std::begin(clusters),
+        [&slots, &ids](const se2_cell& cell) { return beluga::Cluster{ids[slots.find(cell)->second]}; });
+    return range;
+  }
+
+  /// Overload that re-orders arguments from a view closure.
+  template <
+      class Range,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  auto operator()(Range&& range, std::array<double, 3> resolution, ExecutionPolicy policy) const -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), resolution);
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  template <class ExecutionPolicy, std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  auto operator()(ExecutionPolicy policy, std::array<double, 3> resolution) const {
+    return ranges::make_action_closure(ranges::bind_back(cluster_base_fn{}, resolution, std::move(policy)));
+  }
+};
+
+/// Implementation detail for a cluster range adaptor object with a default execution policy.
+struct cluster_fn : public cluster_base_fn {
+  using cluster_base_fn::operator();
+
+  /// Overload that defines a default execution policy.
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  auto operator()(Range&& range, std::array<double, 3> resolution) const -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), resolution);
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  constexpr auto operator()(std::array<double, 3> resolution) const {
+    return ranges::make_action_closure(ranges::bind_back(cluster_fn{}, resolution));
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// can assign dense cluster ids to the particles in a range.
+/**
+ * This action groups particles into connected components of adjacent spatial hash
+ * buckets and stores the component id of each particle in its `beluga::Cluster`
+ * column, feeding cluster-aware consumers like `beluga::cluster_estimate()` without
+ * each of them grouping the full particle set again.
+ */
+inline constexpr detail::cluster_fn cluster;
+
+}  // namespace beluga::actions
+
+#endif
@@ -0,0 +1,106 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ACTIONS_DISCARD_BELOW_HPP
+#define BELUGA_ACTIONS_DISCARD_BELOW_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <utility>
+
+#include <range/v3/action/action.hpp>
+#include <range/v3/view/common.hpp>
+
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+/**
+ * \file
+ * \brief Implementation of the discard_below range adaptor object.
+ */
+
+namespace beluga::actions {
+
+namespace detail {
+
+/// Implementation detail for a discard_below range adaptor object.
+struct discard_below_fn {
+  /// Overload that implements the compaction algorithm.
+  /**
+   * Particles with a weight strictly below the given epsilon are partitioned out
+   * in place: surviving particles are shifted to the front preserving their
+   * relative order, the container is shrunk to the survivor count and the
+   * surviving weights are renormalized so their sum is restored to one. The pass
+   * is inherently sequential, so no execution policy overloads are provided.
+   *
+   * If no particle survives the threshold the range is left untouched, since
+   * emptying the filter would be worse than resampling from a degenerate set.
+   *
+   * \tparam Range An [input range](https://en.cppreference.com/w/cpp/ranges/input_range)
+   *  of particles, resizable in place (e.g. `beluga::TupleVector`).
+   * \param range An existing range of particles to apply this action to.
+   * \param epsilon Weight below which a particle is discarded.
+   */
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range& range, double epsilon) const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    auto particles = range | ranges::views::common;
+
+    auto out = std::begin(particles);
+    const auto last = std::end(particles);
+    double weight_sum = 0.0;
+    for (auto it = std::begin(particles); it != last; ++it) {
+      if (beluga::weight(*it) < epsilon) {
+        continue;
+      }
+      if (out != it) {
+        *out = *it;
+      }
+      weight_sum += beluga::weight(*out);
+      ++out;
+    }
+
+    const auto count = static_cast<std::size_t>(std::distance(std::begin(particles), out));
+    if (count == 0UL) {
+      return range;  // Degenerate set, keep it for the resampler to recover from.
+    }
+
+    range.resize(count);
+    for (auto&& weight : range | beluga::views::weights) {
+      weight = weight / weight_sum;
+    }
+    return range;
+  }
+
+  /// Overload that returns an action closure to compose with other actions.
+  constexpr auto operator()(double epsilon) const {
+    return ranges::make_action_closure(ranges::bind_back(discard_below_fn{}, epsilon));
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// can discard the particles of a range whose weight is below a given epsilon.
+/**
+ * The `discard_below` range adaptor compacts a particle range in place, dropping
+ * effectively dead particles and renormalizing the survivors, so downstream stages
+ * (the resampling distribution setup and the KLD loop in particular) only traverse
+ * particles that can actually be drawn.
+ */
+inline constexpr ranges::actions::action_closure<detail::discard_below_fn> discard_below;
+
+}  // namespace beluga::actions
+
+#endif
@@ -17,11 +17,17 @@
 
 #include <algorithm>
 #include <execution>
+#include <functional>
 
 #include <range/v3/action/action.hpp>
-#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/range/primitives.hpp>
 #include <range/v3/view/common.hpp>
 
+#include <beluga/algorithm/compensated_sum.hpp>
+#include <beluga/algorithm/se2_estimate_statistics.hpp>
+#include <beluga/algorithm/weight_statistics.hpp>
+#include <beluga/utility/thread_pool.hpp>
+#include <beluga/utility/tracepoint.hpp>
 #include <beluga/type_traits/particle_traits.hpp>
 #include <beluga/views/particles.hpp>
 
@@ -47,9 +53,12 @@ struct normalize_base_fn {
   template <
       class ExecutionPolicy,
       class Range,
-      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
       std::enable_if_t<ranges::range<Range>, int> = 0>
   constexpr auto operator()(ExecutionPolicy&& policy, Range& range, double factor) const -> Range& {
+    if constexpr (ranges::sized_range<Range>) {
+      BELUGA_TRACEPOINT1(action_normalize, ranges::size(range));
+    }
     if (std::abs(factor - 1.0) < std::numeric_limits<double>::epsilon()) {
       return range;  // No change.
     }
@@ -62,7 +71,7 @@ struct normalize_base_fn {
       }
     }();
 
-    std::transform(
+    beluga::execution::transform(
         policy,               //
         std::begin(weights),  //
         std::end(weights),    //
@@ -73,12 +82,14 @@ struct normalize_base_fn {
 
   /// Overload that uses a default normalization factor.
   /**
-   * The default normalization factor is the total sum of weights.
+   * The default normalization factor is the total sum of weights, accumulated with
+   * Neumaier compensation so reduced-precision weight columns (see `beluga::WeightF`)
+   * normalize as accurately as full-precision ones.
    */
   template <
       class ExecutionPolicy,
       class Range,
-      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
       std::enable_if_t<ranges::range<Range>, int> = 0>
   constexpr auto operator()(ExecutionPolicy&& policy, Range& range) const -> Range& {
     auto weights = [&range]() {
@@ -89,16 +100,114 @@ struct normalize_base_fn {
       }
     }();
 
-    const double total_weight = ranges::accumulate(weights, 0.0);
+    const double total_weight = beluga::compensated_sum(weights);
     return (*this)(std::forward<ExecutionPolicy>(policy), range, total_weight);
   }
 
+  /// Overload that records weight statistics in the same pass used to normalize.
+  /**
+   * The statistics are taken over the weights before normalization, in the traversal
+   * that computes the normalization factor. Later stages of the same filter update
+   * (effective sample size, recovery probability estimation) can consume them instead
+   * of traversing the weights again, and the degeneracy telemetry they carry (weight
+   * entropy, extrema, coarse histogram; see `beluga::WeightStatistics`) comes at no
+   * extra particle-set scans.
+   *
+   * \param policy The execution policy to use.
+   * \param range An existing range to apply this action to.
+   * \param statistics Reference to the statistics instance to fill in.
+   */
+  template <
+      class ExecutionPolicy,
+      class Range,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy&& policy, Range& range, std::reference_wrapper<WeightStatistics> statistics)
+      const -> Range& {
+    statistics.get() = beluga::weight_statistics(range);
+    return (*this)(std::forward<ExecutionPolicy>(policy), range, statistics.get().sum);
+  }
+
+  /// Overload that accumulates pose estimation statistics in the same pass used to normalize.
+  /**
+   * In addition to dividing every weight by the given factor, the normalization sweep
+   * accumulates the sufficient statistics `beluga::estimate()` needs over the particle
+   * states and their normalized weights, so the caller can later obtain the pose
+   * estimate without another traversal of the particle set.
+   *
+   * \param policy The execution policy to use.
+   * \param range An existing particle range with `Sophus::SE2d` states to apply this action to.
+   * \param factor The normalization factor.
+   * \param estimate_statistics Reference to the estimation statistics instance to fill in.
+   */
+  template <
+      class ExecutionPolicy,
+      class Range,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(
+      ExecutionPolicy&& policy,
+      Range& range,
+      double factor,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics) const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    if constexpr (ranges::sized_range<Range>) {
+      BELUGA_TRACEPOINT1(action_normalize, ranges::size(range));
+    }
+    auto particles = range | ranges::views::common;
+
+    const auto combine = [](SE2EstimateStatistics<double> first, const SE2EstimateStatistics<double>& second) {
+      first.merge(second);
+      return first;
+    };
+
+    // No unity factor shortcut here: the statistics must be accumulated regardless.
+    estimate_statistics.get() = beluga::execution::transform_reduce(
+        policy,                  //
+        std::begin(particles),   //
+        std::end(particles),     //
+        SE2EstimateStatistics<double>{}, combine, [factor](auto&& particle) {
+          auto& weight = beluga::weight(particle);
+          weight = weight / factor;
+          auto partial = SE2EstimateStatistics<double>{};
+          partial.add(beluga::state(particle), weight);
+          return partial;
+        });
+    return range;
+  }
+
+  /// Overload that uses a default normalization factor and accumulates pose estimation statistics.
+  /**
+   * The statistics are taken over the weights before normalization, in the traversal that
+   * computes the normalization factor. Since the estimate is invariant under weight scaling,
+   * they describe the normalized particle set all the same.
+   */
+  template <
+      class ExecutionPolicy,
+      class Range,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(
+      ExecutionPolicy&& policy,
+      Range& range,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics) const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    auto particles = range | ranges::views::common;
+
+    auto statistics = SE2EstimateStatistics<double>{};
+    for (auto&& particle : particles) {
+      statistics.add(beluga::state(particle), beluga::weight(particle));
+    }
+    estimate_statistics.get() = statistics;
+    return (*this)(std::forward<ExecutionPolicy>(policy), range, statistics.weight_sum);
+  }
+
   /// Overload that re-orders arguments from an action closure.
   template <
       class Range,
       class ExecutionPolicy,
       std::enable_if_t<ranges::range<Range>, int> = 0,
-      std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
   constexpr auto operator()(Range&& range, double factor, ExecutionPolicy policy) const -> Range& {
     return (*this)(std::move(policy), std::forward<Range>(range), factor);
   }
@@ -108,22 +217,59 @@ struct normalize_base_fn {
       class Range,
       class ExecutionPolicy,
       std::enable_if_t<ranges::range<Range>, int> = 0,
-      std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
   constexpr auto operator()(Range&& range, ExecutionPolicy policy) const -> Range& {
     return (*this)(std::move(policy), std::forward<Range>(range));
   }
 
+  /// Overload that re-orders arguments from an action closure.
+  template <
+      class Range,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(Range&& range, std::reference_wrapper<WeightStatistics> statistics, ExecutionPolicy policy)
+      const -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), statistics);
+  }
+
+  /// Overload that re-orders arguments from an action closure.
+  template <
+      class Range,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(
+      Range&& range,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics,
+      ExecutionPolicy policy) const -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), estimate_statistics);
+  }
+
   /// Overload that returns an action closure to compose with other actions.
-  template <class ExecutionPolicy, std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  template <class ExecutionPolicy, std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
   constexpr auto operator()(ExecutionPolicy policy, double factor) const {
     return ranges::make_action_closure(ranges::bind_back(normalize_base_fn{}, factor, std::move(policy)));
   }
 
   /// Overload that returns an action closure to compose with other actions.
-  template <class ExecutionPolicy, std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  template <class ExecutionPolicy, std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
   constexpr auto operator()(ExecutionPolicy policy) const {
     return ranges::make_action_closure(ranges::bind_back(normalize_base_fn{}, std::move(policy)));
   }
+
+  /// Overload that returns an action closure to compose with other actions.
+  template <class ExecutionPolicy, std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy policy, std::reference_wrapper<WeightStatistics> statistics) const {
+    return ranges::make_action_closure(ranges::bind_back(normalize_base_fn{}, statistics, std::move(policy)));
+  }
+
+  /// Overload that returns an action closure to compose with other actions.
+  template <class ExecutionPolicy, std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy policy, std::reference_wrapper<SE2EstimateStatistics<double>> statistics)
+      const {
+    return ranges::make_action_closure(ranges::bind_back(normalize_base_fn{}, statistics, std::move(policy)));
+  }
 };
 
 /// Implementation detail for a normalize range adaptor object with a default execution policy.
@@ -142,10 +288,33 @@ struct normalize_fn : public normalize_base_fn {
     return (*this)(std::execution::seq, std::forward<Range>(range));
   }
 
+  /// Overload that defines a default execution policy.
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, std::reference_wrapper<WeightStatistics> statistics) const -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), statistics);
+  }
+
+  /// Overload that defines a default execution policy.
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, std::reference_wrapper<SE2EstimateStatistics<double>> statistics) const
+      -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), statistics);
+  }
+
   /// Overload that returns an action closure to compose with other actions.
   constexpr auto operator()(double factor) const {
     return ranges::make_action_closure(ranges::bind_back(normalize_fn{}, factor));
   }
+
+  /// Overload that returns an action closure to compose with other actions.
+  constexpr auto operator()(std::reference_wrapper<WeightStatistics> statistics) const {
+    return ranges::make_action_closure(ranges::bind_back(normalize_fn{}, statistics));
+  }
+
+  /// Overload that returns an action closure to compose with other actions.
+  constexpr auto operator()(std::reference_wrapper<SE2EstimateStatistics<double>> statistics) const {
+    return ranges::make_action_closure(ranges::bind_back(normalize_fn{}, statistics));
+  }
 };
 
 }  // namespace detail
@@ -16,15 +16,22 @@
 #define BELUGA_ACTIONS_PROPAGATE_HPP
 
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <execution>
 #include <type_traits>
 
+#include <beluga/random/random_engines.hpp>
 #include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/utility/thread_pool.hpp>
+#include <beluga/utility/tracepoint.hpp>
 #include <beluga/views/particles.hpp>
 
 #include <range/v3/action/action.hpp>
+#include <range/v3/range/primitives.hpp>
 #include <range/v3/utility/random.hpp>
 #include <range/v3/view/common.hpp>
+#include <range/v3/view/iota.hpp>
 
 /**
  * \file
@@ -35,6 +42,39 @@ namespace beluga::actions {
 
 namespace detail {
 
+/// Builds a per-element engine from a per-call base seed and an element index.
+/**
+ * Parallel execution forbids (or at least penalizes) mutating state shared
+ * between element invocations, which rules out the thread-local engine used by
+ * the sequenced path. Each element gets its own counter-based Philox stream
+ * keyed by (base seed, element index), so element invocations are free of
+ * shared state and locks, and the sampled noise is bitwise-identical no matter
+ * how elements are partitioned across threads.
+ */
+inline beluga::Philox4x32 make_strided_engine(std::uint64_t base_seed, std::size_t index) noexcept {
+  return beluga::Philox4x32{base_seed, static_cast<std::uint64_t>(index)};
+}
+
+/// Detects ranges whose state column can be propagated in one batch call.
+/**
+ * Satisfied when the range exposes its first member column as a contiguous span
+ * (see `beluga::TupleContainer::span()`) and the sampling function accepts that
+ * span together with a generator, as the sampling functions returned by
+ * `beluga::DifferentialDriveModel` do. Batch-capable models then draw their noise
+ * variates in vectorized blocks instead of sampling one particle at a time.
+ */
+template <class Range, class Fn, class Generator, class = void>
+struct is_batch_propagatable : std::false_type {};
+
+/// Specialization for ranges and sampling functions supporting the batch form.
+template <class Range, class Fn, class Generator>
+struct is_batch_propagatable<
+    Range,
+    Fn,
+    Generator,
+    std::void_t<decltype(std::declval<Fn&>()(std::declval<Range&>().template span<0>(), std::declval<Generator&>()))>>
+    : std::true_type {};
+
 /// Implementation detail for a propagate range adaptor object.
 struct propagate_base_fn {
   /// Overload that implements the propagate algorithm.
@@ -52,29 +92,129 @@ struct propagate_base_fn {
       class ExecutionPolicy,
       class Range,
       class StateSamplingFunction,
-      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
       std::enable_if_t<ranges::range<Range>, int> = 0>
   constexpr auto operator()(ExecutionPolicy&& policy, Range& range, StateSamplingFunction fn) const -> Range& {
     static_assert(beluga::is_particle_range_v<Range>);
+    if constexpr (ranges::sized_range<Range>) {
+      BELUGA_TRACEPOINT1(action_propagate, ranges::size(range));
+    }
     auto states = range | beluga::views::states | ranges::views::common;
 
-    auto unary_fn = [&]() {
-      using States = decltype(states);
-      using State = ranges::range_value_t<States>;
-      using Generator = decltype(ranges::detail::get_random_engine());
-      if constexpr (std::is_invocable_v<StateSamplingFunction, State, Generator>) {
-        return [fn = std::move(fn)](const State& state) { return fn(state, ranges::detail::get_random_engine()); };
-      } else {
-        return std::move(fn);
-      }
-    }();
-
-    std::transform(
-        policy,              // rvalue policies are not supported in some STL implementations
-        std::begin(states),  //
-        std::end(states),    //
-        std::begin(states),  //
-        std::move(unary_fn));
+    using States = decltype(states);
+    using State = ranges::range_value_t<States>;
+    using Generator = decltype(beluga::get_default_random_engine());
+    constexpr bool needs_generator = std::is_invocable_v<StateSamplingFunction, State, Generator>;
+    constexpr bool is_sequenced = std::is_same_v<std::decay_t<ExecutionPolicy>, std::execution::sequenced_policy>;
+
+    if constexpr (is_sequenced && detail::is_batch_propagatable<Range, StateSamplingFunction, Generator>::value) {
+      // Batch-capable sampling functions propagate the whole contiguous state
+      // column in one call, generating their noise variates in blocks and running
+      // the pose composition over the decomposed state scalars.
+      static_assert(std::is_same_v<ranges::range_value_t<decltype(range.template span<0>())>, State>);
+      fn(range.template span<0>(), beluga::get_default_random_engine());
+      return range;
+    } else if constexpr (needs_generator && !is_sequenced) {
+      // Parallel element invocations each sample from their own counter-based
+      // stream keyed by (base seed, particle index), so no engine state is
+      // shared between elements and the sampled noise does not depend on how
+      // particles are partitioned across threads.
+      const auto base_seed = static_cast<std::uint64_t>(beluga::get_default_random_engine()());
+      auto indices = ranges::views::iota(std::size_t{0}, static_cast<std::size_t>(ranges::size(states)));
+      const auto states_first = std::begin(states);
+      beluga::execution::for_each(
+          policy,               //
+          std::begin(indices),  //
+          std::end(indices),    //
+          [fn = std::move(fn), base_seed, states_first](std::size_t index) {
+            auto engine = make_strided_engine(base_seed, index);
+            auto&& state = *(states_first + static_cast<std::ptrdiff_t>(index));
+            state = fn(state, engine);
+          });
+      return range;
+    } else {
+      auto unary_fn = [&]() {
+        if constexpr (needs_generator) {
+          return [fn = std::move(fn)](const State& state) { return fn(state, beluga::get_default_random_engine()); };
+        } else {
+          return std::move(fn);
+        }
+      }();
+
+      beluga::execution::transform(
+          policy,              // rvalue policies are not supported in some STL implementations
+          std::begin(states),  //
+          std::end(states),    //
+          std::begin(states),  //
+          std::move(unary_fn));
+      return range;
+    }
+  }
+
+  /// Overload that also refreshes a precomputed spatial hash column.
+  /**
+   * For particle types carrying a cluster attribute (see `beluga::cluster`), the
+   * hasher is applied to each new state in the same pass that samples it, keeping
+   * the hash column coherent with the states. Downstream consumers such as KLD
+   * bucketing or cluster estimation can then read the precomputed hashes instead
+   * of re-deriving them from the states.
+   *
+   * \param policy The execution policy to use.
+   * \param range An existing range of particles with a cluster attribute to apply this action to.
+   * \param fn A state sampling function instance.
+   * \param hasher A callable that can compute the spatial hash for a given state.
+   */
+  template <
+      class ExecutionPolicy,
+      class Range,
+      class StateSamplingFunction,
+      class Hasher,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy&& policy, Range& range, StateSamplingFunction fn, Hasher hasher) const
+      -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    static_assert(beluga::has_cluster_v<ranges::range_reference_t<Range>>);
+    if constexpr (ranges::sized_range<Range>) {
+      BELUGA_TRACEPOINT1(action_propagate, ranges::size(range));
+    }
+    auto particles = range | ranges::views::common;
+
+    using Particle = ranges::range_value_t<Range>;
+    using State = beluga::state_t<Particle>;
+    using Generator = decltype(beluga::get_default_random_engine());
+    constexpr bool needs_generator = std::is_invocable_v<StateSamplingFunction, State, Generator>;
+    constexpr bool is_sequenced = std::is_same_v<std::decay_t<ExecutionPolicy>, std::execution::sequenced_policy>;
+
+    if constexpr (needs_generator && !is_sequenced) {
+      // Same strided engine scheme as the state-only overload; see above.
+      const auto base_seed = static_cast<std::uint64_t>(beluga::get_default_random_engine()());
+      auto indices = ranges::views::iota(std::size_t{0}, static_cast<std::size_t>(ranges::size(particles)));
+      const auto particles_first = std::begin(particles);
+      beluga::execution::for_each(
+          policy,               //
+          std::begin(indices),  //
+          std::end(indices),    //
+          [fn = std::move(fn), hasher = std::move(hasher), base_seed, particles_first](std::size_t index) {
+            auto engine = make_strided_engine(base_seed, index);
+            auto&& particle = *(particles_first + static_cast<std::ptrdiff_t>(index));
+            beluga::state(particle) = fn(beluga::state(particle), engine);
+            beluga::cluster(particle) = hasher(beluga::state(particle));
+          });
+    } else {
+      beluga::execution::for_each(
+          policy,                 //
+          std::begin(particles),  //
+          std::end(particles),    //
+          [&fn, &hasher](auto&& particle) {
+            if constexpr (needs_generator) {
+              beluga::state(particle) = fn(beluga::state(particle), beluga::get_default_random_engine());
+            } else {
+              beluga::state(particle) = fn(beluga::state(particle));
+            }
+            beluga::cluster(particle) = hasher(beluga::state(particle));
+          });
+    }
     return range;
   }
 
@@ -84,19 +224,45 @@ struct propagate_base_fn {
       class StateSamplingFunction,
       class ExecutionPolicy,
       std::enable_if_t<ranges::range<Range>, int> = 0,
-      std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
   constexpr auto operator()(Range&& range, StateSamplingFunction fn, ExecutionPolicy policy) const -> Range& {
     return (*this)(std::move(policy), std::forward<Range>(range), std::move(fn));
   }
 
+  /// Overload that re-orders arguments from a view closure.
+  template <
+      class Range,
+      class StateSamplingFunction,
+      class Hasher,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<!beluga::is_execution_policy_v<Hasher>, int> = 0,
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(Range&& range, StateSamplingFunction fn, Hasher hasher, ExecutionPolicy policy) const
+      -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), std::move(fn), std::move(hasher));
+  }
+
   /// Overload that returns a view closure to compose with other views.
   template <
       class ExecutionPolicy,        //
       class StateSamplingFunction,  //
-      std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
   constexpr auto operator()(ExecutionPolicy policy, StateSamplingFunction fn) const {
     return ranges::make_action_closure(ranges::bind_back(propagate_base_fn{}, std::move(fn), std::move(policy)));
   }
+
+  /// Overload that returns a view closure to compose with other views.
+  template <
+      class ExecutionPolicy,        //
+      class StateSamplingFunction,  //
+      class Hasher,                 //
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0,
+      std::enable_if_t<!ranges::range<StateSamplingFunction>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy policy, StateSamplingFunction fn, Hasher hasher) const {
+    return ranges::make_action_closure(
+        ranges::bind_back(propagate_base_fn{}, std::move(fn), std::move(hasher), std::move(policy)));
+  }
 };
 
 /// Implementation detail for a propagate range adaptor object with a default execution policy.
@@ -112,11 +278,32 @@ struct propagate_fn : public propagate_base_fn {
     return (*this)(std::execution::seq, std::forward<Range>(range), std::move(fn));
   }
 
+  /// Overload that defines a default execution policy.
+  template <
+      class Range,                  //
+      class StateSamplingFunction,  //
+      class Hasher,                 //
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<!beluga::is_execution_policy_v<Hasher>, int> = 0>
+  constexpr auto operator()(Range&& range, StateSamplingFunction fn, Hasher hasher) const -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), std::move(fn), std::move(hasher));
+  }
+
   /// Overload that returns a view closure to compose with other views.
   template <class StateSamplingFunction>
   constexpr auto operator()(StateSamplingFunction fn) const {
     return ranges::make_action_closure(ranges::bind_back(propagate_fn{}, std::move(fn)));
   }
+
+  /// Overload that returns a view closure to compose with other views.
+  template <
+      class StateSamplingFunction,  //
+      class Hasher,                 //
+      std::enable_if_t<!ranges::range<StateSamplingFunction>, int> = 0,
+      std::enable_if_t<!beluga::is_execution_policy_v<StateSamplingFunction>, int> = 0>
+  constexpr auto operator()(StateSamplingFunction fn, Hasher hasher) const {
+    return ranges::make_action_closure(ranges::bind_back(propagate_fn{}, std::move(fn), std::move(hasher)));
+  }
 };
 
 }  // namespace detail
@@ -126,7 +313,8 @@ struct propagate_fn : public propagate_base_fn {
 /**
  * This action updates particle states based on their current value and a state transition
  * (or sampling) function. Every other particle attribute (such as importance sampling weights)
- * is left unchanged.
+ * is left unchanged, except when a spatial hasher is also given, in which case the particle
+ * cluster attribute is refreshed from the new state in the same pass.
  */
 inline constexpr detail::propagate_fn propagate;
 
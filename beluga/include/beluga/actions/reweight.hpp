@@ -16,14 +16,22 @@
 #define BELUGA_ACTIONS_REWEIGHT_HPP
 
 #include <algorithm>
+#include <cstddef>
 #include <execution>
+#include <thread>
+#include <type_traits>
+#include <utility>
 
 #include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/utility/thread_pool.hpp>
+#include <beluga/utility/tracepoint.hpp>
 #include <beluga/views/particles.hpp>
 
 #include <range/v3/action/action.hpp>
 #include <range/v3/algorithm/max_element.hpp>
+#include <range/v3/range/primitives.hpp>
 #include <range/v3/view/common.hpp>
+#include <range/v3/view/iota.hpp>
 
 /**
  * \file
@@ -34,6 +42,54 @@ namespace beluga::actions {
 
 namespace detail {
 
+/// Detects particle containers that expose contiguous per-column spans, like beluga::TupleVector.
+template <class Range, class = void>
+struct has_column_spans : std::false_type {};
+
+/// Specialization for containers providing `span<0>()` (states) and `span<1>()` (weights).
+template <class Range>
+struct has_column_spans<
+    Range,
+    std::void_t<
+        decltype(std::declval<const Range&>().template span<0>()),
+        decltype(std::declval<Range&>().template span<1>())>> : std::true_type {};
+
+/// Detects state weighting functions that provide a batch form over spans of states and weights.
+/**
+ * The batch form receives a span of states and a span of weights of the same size, and
+ * multiplies the importance weight of each state into the corresponding weight. It is
+ * only usable when the particle range also exposes contiguous column storage.
+ */
+template <class Model, class Range, class = void>
+struct is_batch_weighting_model : std::false_type {};
+
+/// Specialization for span-capable ranges whose model accepts the matching span pair.
+template <class Model, class Range>
+struct is_batch_weighting_model<
+    Model,
+    Range,
+    std::enable_if_t<
+        has_column_spans<Range>::value &&
+        std::is_invocable_v<
+            const Model&,
+            decltype(std::declval<const Range&>().template span<0>()),
+            decltype(std::declval<Range&>().template span<1>())>>> : std::true_type {};
+
+/// Convenience template variable for `is_batch_weighting_model`.
+template <class Model, class Range>
+inline constexpr bool is_batch_weighting_model_v = is_batch_weighting_model<Model, Range>::value;
+
+/// Returns the number of slices used to fan a batch weighting call out across an execution policy.
+template <class ExecutionPolicy>
+std::size_t batch_chunk_count(std::size_t size) {
+  if constexpr (std::is_same_v<std::decay_t<ExecutionPolicy>, std::execution::sequenced_policy>) {
+    return 1;
+  } else {
+    const std::size_t max_chunks = std::max<std::size_t>(std::thread::hardware_concurrency(), 1) * 4;
+    return std::clamp<std::size_t>(size / 512, 1, max_chunks);
+  }
+}
+
 /// Implementation detail for a reweight range adaptor object.
 struct reweight_base_fn {
   /// Overload that implements the reweight algorithm.
@@ -47,25 +103,52 @@ struct reweight_base_fn {
    *
    * For each particle, we multiply the current weight by the new importance weight to accumulate information from
    * sensor updates.
+   *
+   * If the model provides a batch form over spans of states and weights and the range
+   * exposes contiguous column storage, the batch form is used instead of calling the
+   * model once per particle, so the model can vectorize across particles.
    */
   template <
       class ExecutionPolicy,
       class Range,
       class Model,
-      std::enable_if_t<std::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
       std::enable_if_t<ranges::range<Range>, int> = 0>
   constexpr auto operator()(ExecutionPolicy&& policy, Range& range, Model model) const -> Range& {
     static_assert(beluga::is_particle_range_v<Range>);
-    auto states = range | beluga::views::states | ranges::views::common;
-    auto weights = range | beluga::views::weights | ranges::views::common;
-    std::transform(
-        policy,               //
-        std::begin(states),   //
-        std::end(states),     //
-        std::begin(weights),  //
-        std::begin(weights),  //
-        [model = std::move(model)](const auto& s, auto w) { return w * model(s); });
-    return range;
+    if constexpr (ranges::sized_range<Range>) {
+      BELUGA_TRACEPOINT1(action_reweight, ranges::size(range));
+    }
+    if constexpr (is_batch_weighting_model_v<Model, std::decay_t<Range>>) {
+      const auto states = std::as_const(range).template span<0>();
+      auto weights = range.template span<1>();
+      const auto size = static_cast<std::size_t>(states.size());
+      if (size == 0) {
+        return range;
+      }
+      // The batch form updates the weights in place. Slicing the spans keeps parallel
+      // policies busy while each slice runs the vectorized kernel sequentially.
+      const std::size_t chunks = batch_chunk_count<ExecutionPolicy>(size);
+      auto indices = ranges::views::iota(std::size_t{0}, chunks) | ranges::views::common;
+      beluga::execution::for_each(
+          policy, std::begin(indices), std::end(indices), [&model, states, weights, size, chunks](std::size_t chunk) {
+            const auto first = static_cast<std::ptrdiff_t>(chunk * size / chunks);
+            const auto count = static_cast<std::ptrdiff_t>((chunk + 1) * size / chunks) - first;
+            std::as_const(model)(states.subspan(first, count), weights.subspan(first, count));
+          });
+      return range;
+    } else {
+      auto states = range | beluga::views::states | ranges::views::common;
+      auto weights = range | beluga::views::weights | ranges::views::common;
+      beluga::execution::transform(
+          policy,               //
+          std::begin(states),   //
+          std::end(states),     //
+          std::begin(weights),  //
+          std::begin(weights),  //
+          [model = std::move(model)](const auto& s, auto w) { return w * model(s); });
+      return range;
+    }
   }
 
   /// Overload that re-orders arguments from a view closure.
@@ -74,13 +157,13 @@ struct reweight_base_fn {
       class Model,
       class ExecutionPolicy,
       std::enable_if_t<ranges::range<Range>, int> = 0,
-      std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
   constexpr auto operator()(Range&& range, Model model, ExecutionPolicy policy) const -> Range& {
     return (*this)(std::move(policy), std::forward<Range>(range), std::move(model));
   }
 
   /// Overload that returns a view closure to compose with other views.
-  template <class ExecutionPolicy, class Model, std::enable_if_t<std::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  template <class ExecutionPolicy, class Model, std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
   constexpr auto operator()(ExecutionPolicy policy, Model model) const {
     return ranges::make_action_closure(ranges::bind_back(reweight_base_fn{}, std::move(model), std::move(policy)));
   }
@@ -0,0 +1,234 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ACTIONS_REWEIGHT_DEFERRED_HPP
+#define BELUGA_ACTIONS_REWEIGHT_DEFERRED_HPP
+
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <utility>
+
+#include <range/v3/action/action.hpp>
+#include <range/v3/view/common.hpp>
+#include <range/v3/view/iota.hpp>
+
+#include <beluga/actions/reweight.hpp>
+#include <beluga/algorithm/se2_estimate_statistics.hpp>
+#include <beluga/algorithm/weight_statistics.hpp>
+#include <beluga/utility/thread_pool.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+/**
+ * \file
+ * \brief Implementation of the reweight_deferred range adaptor object.
+ */
+
+namespace beluga::actions {
+
+namespace detail {
+
+/// Joint reduction state of the deferred-normalization reweight sweep.
+struct deferred_reweight_reduction {
+  /// Statistics over the scale-corrected weights.
+  WeightStatistics weights;
+  /// Pose estimation statistics over the states and scale-corrected weights.
+  SE2EstimateStatistics<double> estimate;
+
+  /// Merges statistics accumulated by another instance.
+  void merge(const deferred_reweight_reduction& other) {
+    weights.merge(other.weights);
+    estimate.merge(other.estimate);
+  }
+};
+
+/// Implementation detail for a reweight_deferred range adaptor object.
+struct reweight_deferred_base_fn {
+  /// Overload that implements the deferred-normalization reweight algorithm.
+  /**
+   * \tparam ExecutionPolicy An [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t).
+   * \tparam Range An [input range](https://en.cppreference.com/w/cpp/ranges/input_range) of particles.
+   * \tparam Model A callable that can compute the importance weight given a particle state.
+   * \param policy The execution policy to use.
+   * \param range An existing range of particles with `Sophus::SE2d` states to apply this action to.
+   * \param model A callable instance to compute the weights given the particle states.
+   * \param scale Factor by which the weights entering the sweep exceed their normalized values.
+   * \param statistics Reference to the weight statistics instance to fill in.
+   * \param estimate_statistics Reference to the estimation statistics instance to fill in.
+   *
+   * Multiplies the importance weights in like `beluga::actions::reweight`, but leaves
+   * the written weights unnormalized: instead of a follow-up write pass dividing by
+   * the total, both statistics are accumulated in the same sweep over the weights
+   * divided by the given entering scale, so they match what an eagerly normalizing
+   * pipeline (see `beluga::actions::reweight_normalized`) would have recorded. The
+   * caller tracks the pending normalization by multiplying its running scale by the
+   * recorded weight sum, and divides by it only where normalized weights are
+   * semantically required.
+   */
+  template <
+      class ExecutionPolicy,
+      class Range,
+      class Model,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(
+      ExecutionPolicy&& policy,
+      Range& range,
+      Model model,
+      double scale,
+      std::reference_wrapper<WeightStatistics> statistics,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics) const -> Range& {
+    static_assert(beluga::is_particle_range_v<Range>);
+    const double inverse_scale = 1.0 / scale;
+
+    const auto combine = [](deferred_reweight_reduction first, const deferred_reweight_reduction& second) {
+      first.merge(second);
+      return first;
+    };
+
+    auto reduction = deferred_reweight_reduction{};
+    if constexpr (is_batch_weighting_model_v<Model, std::decay_t<Range>>) {
+      // Batch-capable models are called once per slice over contiguous column spans,
+      // and the statistics of each slice are taken right after its weights are written.
+      const auto states = std::as_const(range).template span<0>();
+      auto weights = range.template span<1>();
+      const auto size = static_cast<std::size_t>(states.size());
+      if (size > 0) {
+        const std::size_t chunks = batch_chunk_count<ExecutionPolicy>(size);
+        auto indices = ranges::views::iota(std::size_t{0}, chunks) | ranges::views::common;
+        reduction = beluga::execution::transform_reduce(
+            policy, std::begin(indices), std::end(indices), deferred_reweight_reduction{}, combine,
+            [&model, states, weights, size, chunks, inverse_scale](std::size_t chunk) {
+              const auto first = static_cast<std::ptrdiff_t>(chunk * size / chunks);
+              const auto count = static_cast<std::ptrdiff_t>((chunk + 1) * size / chunks) - first;
+              const auto state_slice = states.subspan(first, count);
+              auto weight_slice = weights.subspan(first, count);
+              std::as_const(model)(state_slice, weight_slice);
+              deferred_reweight_reduction partial;
+              for (std::ptrdiff_t index = 0; index < count; ++index) {
+                const double value = static_cast<double>(weight_slice[index]) * inverse_scale;
+                partial.weights.add(value);
+                partial.estimate.add(state_slice[index], value);
+              }
+              return partial;
+            });
+      }
+    } else {
+      auto particles = range | ranges::views::common;
+
+      // Each particle is read and written exactly once by the invocation that visits it,
+      // so the write does not race with any other invocation under a parallel policy.
+      const auto reweigh = [model = std::move(model), inverse_scale](auto&& particle) {
+        auto& weight = beluga::weight(particle);
+        weight = weight * model(beluga::state(particle));
+        deferred_reweight_reduction partial;
+        const double value = static_cast<double>(weight) * inverse_scale;
+        partial.weights.add(value);
+        partial.estimate.add(beluga::state(particle), value);
+        return partial;
+      };
+
+      reduction = beluga::execution::transform_reduce(
+          policy,                         //
+          std::begin(particles),          //
+          std::end(particles),            //
+          deferred_reweight_reduction{},  //
+          combine,                        //
+          reweigh);
+    }
+    statistics.get() = reduction.weights;
+    estimate_statistics.get() = reduction.estimate;
+    return range;
+  }
+
+  /// Overload that re-orders arguments from an action closure.
+  template <
+      class Range,
+      class Model,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(
+      Range&& range,
+      Model model,
+      double scale,
+      std::reference_wrapper<WeightStatistics> statistics,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics,
+      ExecutionPolicy policy) const -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), std::move(model), scale, statistics,
+                   estimate_statistics);
+  }
+
+  /// Overload that returns an action closure to compose with other actions.
+  template <class ExecutionPolicy, class Model, std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(
+      ExecutionPolicy policy,
+      Model model,
+      double scale,
+      std::reference_wrapper<WeightStatistics> statistics,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics) const {
+    return ranges::make_action_closure(ranges::bind_back(
+        reweight_deferred_base_fn{}, std::move(model), scale, statistics, estimate_statistics, std::move(policy)));
+  }
+};
+
+/// Implementation detail for a reweight_deferred range adaptor object with a default execution policy.
+struct reweight_deferred_fn : public reweight_deferred_base_fn {
+  using reweight_deferred_base_fn::operator();
+
+  /// Overload that defines a default execution policy.
+  template <class Range, class Model, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(
+      Range&& range,
+      Model model,
+      double scale,
+      std::reference_wrapper<WeightStatistics> statistics,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics) const -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), std::move(model), scale, statistics,
+                   estimate_statistics);
+  }
+
+  /// Overload that returns an action closure to compose with other actions.
+  template <class Model, std::enable_if_t<!ranges::range<Model>, int> = 0>
+  constexpr auto operator()(
+      Model model,
+      double scale,
+      std::reference_wrapper<WeightStatistics> statistics,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics) const {
+    return ranges::make_action_closure(
+        ranges::bind_back(reweight_deferred_fn{}, std::move(model), scale, statistics, estimate_statistics));
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// can update the weights in a particle range deferring their normalization.
+/**
+ * The lazily normalizing counterpart of `beluga::actions::reweight_normalized`: the
+ * importance weights are multiplied in and both the weight and the pose estimation
+ * statistics are accumulated in that same sweep, over the weights divided by the given
+ * entering scale, but no normalized weights are written back. This removes the full
+ * write pass over the weight column that eager normalization pays on every update,
+ * which is pure overhead for consumers that are invariant under weight scaling:
+ * resampling through `beluga::views::sample` draws from a `std::discrete_distribution`,
+ * which normalizes internally, and the effective sample size and the pose estimate
+ * derive from the recorded statistics, which are scale invariant where it matters.
+ */
+inline constexpr detail::reweight_deferred_fn reweight_deferred;
+
+}  // namespace beluga::actions
+
+#endif
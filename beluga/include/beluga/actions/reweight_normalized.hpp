@@ -0,0 +1,316 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ACTIONS_REWEIGHT_NORMALIZED_HPP
+#define BELUGA_ACTIONS_REWEIGHT_NORMALIZED_HPP
+
+#include <cstddef>
+#include <execution>
+#include <functional>
+#include <numeric>
+#include <utility>
+
+#include <range/v3/action/action.hpp>
+#include <range/v3/view/common.hpp>
+#include <range/v3/view/iota.hpp>
+
+#include <beluga/actions/normalize.hpp>
+#include <beluga/actions/reweight.hpp>
+#include <beluga/algorithm/se2_estimate_statistics.hpp>
+#include <beluga/algorithm/weight_statistics.hpp>
+#include <beluga/utility/thread_pool.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+/**
+ * \file
+ * \brief Implementation of the reweight_normalized range adaptor object.
+ */
+
+namespace beluga::actions {
+
+namespace detail {
+
+/// Applies the model and accumulates weight statistics in the sweep that writes the weights.
+/**
+ * Shared implementation of the reweight half of the fused algorithm. Does not
+ * normalize; the caller divides by the accumulated sum afterwards.
+ */
+template <class ExecutionPolicy, class Range, class Model>
+constexpr void
+reweight_accumulating_statistics(ExecutionPolicy&& policy, Range& range, Model model, WeightStatistics& statistics) {
+  static_assert(beluga::is_particle_range_v<Range>);
+
+  const auto combine = [](WeightStatistics first, const WeightStatistics& second) {
+    first.merge(second);
+    return first;
+  };
+
+  if constexpr (is_batch_weighting_model_v<Model, std::decay_t<Range>>) {
+    // Batch-capable models are called once per slice over contiguous column spans,
+    // and the statistics of each slice are taken right after its weights are written.
+    const auto states = std::as_const(range).template span<0>();
+    auto weights = range.template span<1>();
+    const auto size = static_cast<std::size_t>(states.size());
+    statistics = WeightStatistics{};
+    if (size > 0) {
+      const std::size_t chunks = batch_chunk_count<ExecutionPolicy>(size);
+      auto indices = ranges::views::iota(std::size_t{0}, chunks) | ranges::views::common;
+      statistics = beluga::execution::transform_reduce(
+          policy, std::begin(indices), std::end(indices), WeightStatistics{}, combine,
+          [&model, states, weights, size, chunks](std::size_t chunk) {
+            const auto first = static_cast<std::ptrdiff_t>(chunk * size / chunks);
+            const auto count = static_cast<std::ptrdiff_t>((chunk + 1) * size / chunks) - first;
+            auto weight_slice = weights.subspan(first, count);
+            std::as_const(model)(states.subspan(first, count), weight_slice);
+            WeightStatistics partial;
+            for (const double value : weight_slice) {
+              partial.add(value);
+            }
+            return partial;
+          });
+    }
+  } else {
+    auto particles = range | ranges::views::common;
+
+    // Each particle is read and written exactly once by the invocation that visits it,
+    // so the write does not race with any other invocation under a parallel policy.
+    const auto reweigh = [model = std::move(model)](auto&& particle) {
+      auto& weight = beluga::weight(particle);
+      weight = weight * model(beluga::state(particle));
+      WeightStatistics partial;
+      partial.add(weight);
+      return partial;
+    };
+
+    statistics = beluga::execution::transform_reduce(
+        policy,                  //
+        std::begin(particles),   //
+        std::end(particles),     //
+        WeightStatistics{},      //
+        combine,                 //
+        reweigh);
+  }
+}
+
+/// Implementation detail for a reweight_normalized range adaptor object.
+struct reweight_normalized_base_fn {
+  /// Overload that implements the fused reweight and normalize algorithm.
+  /**
+   * \tparam ExecutionPolicy An [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t).
+   * \tparam Range An [input range](https://en.cppreference.com/w/cpp/ranges/input_range) of particles.
+   * \tparam Model A callable that can compute the importance weight given a particle state.
+   * \param policy The execution policy to use.
+   * \param range An existing range of particles to apply this action to.
+   * \param model A callable instance to compute the weights given the particle states.
+   * \param statistics Reference to the statistics instance to fill in.
+   *
+   * Equivalent to `beluga::actions::reweight` followed by `beluga::actions::normalize`,
+   * but the weight sum (and the other weight statistics) is accumulated as a reduction
+   * in the same sweep that writes the updated weights, so the weight column is traversed
+   * twice per update instead of three times. The recorded statistics are taken over the
+   * weights before normalization, like the statistics overload of normalize.
+   */
+  template <
+      class ExecutionPolicy,
+      class Range,
+      class Model,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(
+      ExecutionPolicy&& policy,
+      Range& range,
+      Model model,
+      std::reference_wrapper<WeightStatistics> statistics) const -> Range& {
+    reweight_accumulating_statistics(policy, range, std::move(model), statistics.get());
+    return normalize_base_fn{}(std::forward<ExecutionPolicy>(policy), range, statistics.get().sum);
+  }
+
+  /// Overload that additionally accumulates pose estimation statistics.
+  /**
+   * Same as the overload above, except that the normalization sweep also accumulates
+   * the sufficient statistics for `beluga::estimate()` over the particle states and
+   * their normalized weights, removing one more full traversal of the particle set
+   * from the filter update.
+   *
+   * \param policy The execution policy to use.
+   * \param range An existing range of particles with `Sophus::SE2d` states to apply this action to.
+   * \param model A callable instance to compute the weights given the particle states.
+   * \param statistics Reference to the weight statistics instance to fill in.
+   * \param estimate_statistics Reference to the estimation statistics instance to fill in.
+   */
+  template <
+      class ExecutionPolicy,
+      class Range,
+      class Model,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(
+      ExecutionPolicy&& policy,
+      Range& range,
+      Model model,
+      std::reference_wrapper<WeightStatistics> statistics,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics) const -> Range& {
+    reweight_accumulating_statistics(policy, range, std::move(model), statistics.get());
+    return normalize_base_fn{}(
+        std::forward<ExecutionPolicy>(policy), range, statistics.get().sum, estimate_statistics);
+  }
+
+  /// Overload that discards the weight statistics.
+  template <
+      class ExecutionPolicy,
+      class Range,
+      class Model,
+      std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+      std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy&& policy, Range& range, Model model) const -> Range& {
+    WeightStatistics statistics;
+    return (*this)(std::forward<ExecutionPolicy>(policy), range, std::move(model), std::ref(statistics));
+  }
+
+  /// Overload that re-orders arguments from an action closure.
+  template <
+      class Range,
+      class Model,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(
+      Range&& range,
+      Model model,
+      std::reference_wrapper<WeightStatistics> statistics,
+      ExecutionPolicy policy) const -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), std::move(model), statistics);
+  }
+
+  /// Overload that re-orders arguments from an action closure.
+  template <
+      class Range,
+      class Model,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(
+      Range&& range,
+      Model model,
+      std::reference_wrapper<WeightStatistics> statistics,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics,
+      ExecutionPolicy policy) const -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), std::move(model), statistics, estimate_statistics);
+  }
+
+  /// Overload that re-orders arguments from an action closure.
+  template <
+      class Range,
+      class Model,
+      class ExecutionPolicy,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(Range&& range, Model model, ExecutionPolicy policy) const -> Range& {
+    return (*this)(std::move(policy), std::forward<Range>(range), std::move(model));
+  }
+
+  /// Overload that returns an action closure to compose with other actions.
+  template <class ExecutionPolicy, class Model, std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy policy, Model model, std::reference_wrapper<WeightStatistics> statistics)
+      const {
+    return ranges::make_action_closure(
+        ranges::bind_back(reweight_normalized_base_fn{}, std::move(model), statistics, std::move(policy)));
+  }
+
+  /// Overload that returns an action closure to compose with other actions.
+  template <class ExecutionPolicy, class Model, std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(
+      ExecutionPolicy policy,
+      Model model,
+      std::reference_wrapper<WeightStatistics> statistics,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics) const {
+    return ranges::make_action_closure(ranges::bind_back(
+        reweight_normalized_base_fn{}, std::move(model), statistics, estimate_statistics, std::move(policy)));
+  }
+
+  /// Overload that returns an action closure to compose with other actions.
+  template <class ExecutionPolicy, class Model, std::enable_if_t<beluga::is_execution_policy_v<ExecutionPolicy>, int> = 0>
+  constexpr auto operator()(ExecutionPolicy policy, Model model) const {
+    return ranges::make_action_closure(
+        ranges::bind_back(reweight_normalized_base_fn{}, std::move(model), std::move(policy)));
+  }
+};
+
+/// Implementation detail for a reweight_normalized range adaptor object with a default execution policy.
+struct reweight_normalized_fn : public reweight_normalized_base_fn {
+  using reweight_normalized_base_fn::operator();
+
+  /// Overload that defines a default execution policy.
+  template <class Range, class Model, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, Model model, std::reference_wrapper<WeightStatistics> statistics) const
+      -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), std::move(model), statistics);
+  }
+
+  /// Overload that defines a default execution policy.
+  template <class Range, class Model, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(
+      Range&& range,
+      Model model,
+      std::reference_wrapper<WeightStatistics> statistics,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics) const -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), std::move(model), statistics, estimate_statistics);
+  }
+
+  /// Overload that defines a default execution policy.
+  template <class Range, class Model, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, Model model) const -> Range& {
+    return (*this)(std::execution::seq, std::forward<Range>(range), std::move(model));
+  }
+
+  /// Overload that returns an action closure to compose with other actions.
+  template <class Model, std::enable_if_t<!ranges::range<Model>, int> = 0>
+  constexpr auto operator()(Model model, std::reference_wrapper<WeightStatistics> statistics) const {
+    return ranges::make_action_closure(ranges::bind_back(reweight_normalized_fn{}, std::move(model), statistics));
+  }
+
+  /// Overload that returns an action closure to compose with other actions.
+  template <class Model, std::enable_if_t<!ranges::range<Model>, int> = 0>
+  constexpr auto operator()(
+      Model model,
+      std::reference_wrapper<WeightStatistics> statistics,
+      std::reference_wrapper<SE2EstimateStatistics<double>> estimate_statistics) const {
+    return ranges::make_action_closure(
+        ranges::bind_back(reweight_normalized_fn{}, std::move(model), statistics, estimate_statistics));
+  }
+
+  /// Overload that returns an action closure to compose with other actions.
+  template <class Model, std::enable_if_t<!ranges::range<Model>, int> = 0>
+  constexpr auto operator()(Model model) const {
+    return ranges::make_action_closure(ranges::bind_back(reweight_normalized_fn{}, std::move(model)));
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// can update and normalize the weights in a particle range using a sensor model.
+/**
+ * Fused equivalent of `beluga::actions::reweight` followed by `beluga::actions::normalize`:
+ * the importance weights are multiplied in, the weight statistics are accumulated as a
+ * reduction in the same sweep, and the weights are then divided by the total. This halves
+ * the number of read passes over the weight column compared to running both actions
+ * separately.
+ */
+inline constexpr detail::reweight_normalized_fn reweight_normalized;
+
+}  // namespace beluga::actions
+
+#endif
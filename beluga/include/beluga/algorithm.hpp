@@ -20,12 +20,20 @@
  * \brief Includes all beluga algorithms.
  */
 
+#include <beluga/algorithm/branch_and_bound_matcher.hpp>
+#include <beluga/algorithm/compensated_sum.hpp>
 #include <beluga/algorithm/distance_map.hpp>
 #include <beluga/algorithm/effective_sample_size.hpp>
 #include <beluga/algorithm/estimation.hpp>
 #include <beluga/algorithm/exponential_filter.hpp>
+#include <beluga/algorithm/index_resample.hpp>
+#include <beluga/algorithm/latency_budget_controller.hpp>
+#include <beluga/algorithm/parallel_resample.hpp>
 #include <beluga/algorithm/raycasting.hpp>
+#include <beluga/algorithm/se2_estimate_statistics.hpp>
 #include <beluga/algorithm/spatial_hash.hpp>
 #include <beluga/algorithm/thrun_recovery_probability_estimator.hpp>
+#include <beluga/algorithm/voxel_downsample.hpp>
+#include <beluga/algorithm/weight_statistics.hpp>
 
 #endif
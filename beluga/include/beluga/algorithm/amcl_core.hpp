@@ -15,17 +15,31 @@
 #ifndef BELUGA_ALGORITHM_AMCL_CORE_HPP
 #define BELUGA_ALGORITHM_AMCL_CORE_HPP
 
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
 #include <execution>
+#include <functional>
+#include <future>
+#include <istream>
+#include <memory>
+#include <memory_resource>
 #include <optional>
+#include <ostream>
+#include <stdexcept>
 #include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <beluga/beluga.hpp>
+#include <beluga/utility/scoped_profiler.hpp>
+#include <beluga/utility/tracepoint.hpp>
 
 #include <range/v3/range/concepts.hpp>
 #include <range/v3/view/any_view.hpp>
 #include <range/v3/view/take_exactly.hpp>
+#include <range/v3/view/transform.hpp>
 
 namespace beluga {
 
@@ -51,8 +65,186 @@ struct AmclParams {
   double kld_epsilon = 0.05;
   /// Used as part of the kld sampling mechanism.
   double kld_z = 3.0;
+  /// Number of accumulated measurements per resample, 1 disables batching.
+  /**
+   * When greater than one, `Amcl::update()` accumulates that many (control action,
+   * measurement) pairs, running only the propagation and reweighting stages per pair
+   * and the resampling and estimation stages once per full batch. Useful for sensors
+   * delivering several scan segments per revolution, where per-segment resampling
+   * adds variance and O(n) overhead without adding information.
+   */
+  std::size_t measurement_batch_size = 1UL;
+  /// Weight below which particles are compacted out before resampling, zero disables it.
+  /**
+   * When set, resampling cycles first partition out particles whose normalized
+   * weight fell below this epsilon (see `beluga::actions::discard_below`),
+   * renormalizing the survivors, so the resampling distribution setup and the KLD
+   * loop only traverse particles that can actually be drawn. After aggressive
+   * motion in cluttered maps large fractions of the set carry negligible weight;
+   * keep the epsilon well under `1 / max_particles` so only effectively dead
+   * particles are dropped.
+   */
+  double compaction_weight_epsilon = 0.0;
+  /// Translation noise floor in meters for the zero-motion fast path, zero disables it.
+  /**
+   * When set together with `propagate_min_a`, updates whose conditioned state
+   * sampling function reports being indistinguishable from the identity transform
+   * (see e.g. `beluga::detail::DifferentialDriveStateSampler::is_near_identity()`)
+   * skip the propagation pass entirely and only reweight. Useful for robots that
+   * stand still for long stretches with measurements still arriving.
+   */
+  double propagate_min_d = 0.0;
+  /// Rotation noise floor in radians for the zero-motion fast path, zero disables it.
+  double propagate_min_a = 0.0;
+  /// Target per-update latency for the adaptive particle budget, zero disables adaptation.
+  /**
+   * When set, a `beluga::LatencyBudgetController` adjusts the effective particle
+   * ceiling used during resampling between `min_particles` and `max_particles` to
+   * hit this target, based on the measured stage timings. Requires the per-stage
+   * instrumentation (i.e. `BELUGA_DISABLE_AMCL_INSTRUMENTATION` not defined).
+   */
+  std::chrono::nanoseconds target_update_latency{0};
+  /// Average weight below which an update counts as degraded, zero disables staged recovery.
+  /**
+   * When set, a staged pose recovery mechanism watches the average measurement
+   * likelihood reported by the weight statistics. After `recovery_trigger_window`
+   * consecutive degraded updates the particle set is re-seeded in place from a
+   * Gaussian around the last healthy estimate with its covariance inflated by
+   * `recovery_covariance_inflation`, recovering from small kidnaps in a few updates
+   * at tracking-level particle counts. Only if the likelihood stays degraded for
+   * `recovery_escalation_window` further updates does recovery escalate to sampling
+   * the random state generator (typically map-wide free space), i.e. full global
+   * relocalization. See `Amcl::recovery_stage()`.
+   */
+  double recovery_likelihood_threshold = 0.0;
+  /// Consecutive degraded updates before the local re-seed fires.
+  std::size_t recovery_trigger_window = 5UL;
+  /// Factor inflating the covariance of the last healthy estimate for the local re-seed.
+  double recovery_covariance_inflation = 4.0;
+  /// Degraded updates after a local re-seed before escalating to global sampling.
+  std::size_t recovery_escalation_window = 10UL;
+};
+
+/// Stage of the staged pose recovery mechanism of `beluga::Amcl`.
+/**
+ * See `AmclParams::recovery_likelihood_threshold`. A healthy update returns the
+ * filter to the tracking stage from either recovery stage.
+ */
+enum class AmclRecoveryStage : std::uint8_t {
+  kTracking,        ///< Measurement likelihood is healthy; no recovery in progress.
+  kLocalRecovery,   ///< Re-seeded around the last healthy estimate, awaiting convergence.
+  kGlobalRecovery,  ///< Escalated to free-space-wide sampling.
+};
+
+/// Per-stage instrumentation of the last `Amcl::update()` cycle.
+/**
+ * Durations are taken with `std::chrono::steady_clock` around each pipeline stage, so
+ * regressions can be attributed to propagation, reweighting, resampling or estimation
+ * instead of a single end-to-end timer. Define `BELUGA_DISABLE_AMCL_INSTRUMENTATION`
+ * to compile the timing calls out; particle counts are still recorded.
+ */
+struct AmclUpdateStats {
+  /// Time spent propagating states through the motion model.
+  std::chrono::nanoseconds propagate_duration{0};
+  /// Time spent reweighting with the sensor model and normalizing.
+  std::chrono::nanoseconds reweight_duration{0};
+  /// Time spent resampling, zero when the cycle did not resample.
+  std::chrono::nanoseconds resample_duration{0};
+  /// Time spent re-accumulating the estimation statistics after resampling.
+  std::chrono::nanoseconds estimate_duration{0};
+  /// Number of particles entering the update.
+  std::size_t particle_count{0};
+  /// Number of particles after the update (differs from `particle_count` when resampling).
+  std::size_t resampled_count{0};
+  /// Whether the cycle resampled the particle set.
+  bool resampled{false};
+};
+
+namespace detail {
+
+#ifndef BELUGA_DISABLE_AMCL_INSTRUMENTATION
+/// Lap timer used to bracket the stages of an `Amcl::update()` cycle.
+struct AmclStageTimer {
+  /// Timestamp of the previous lap.
+  std::chrono::steady_clock::time_point mark = std::chrono::steady_clock::now();
+
+  /// Returns the time elapsed since the previous lap and restarts the timer.
+  std::chrono::nanoseconds lap() {
+    const auto now = std::chrono::steady_clock::now();
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(now - mark);
+    mark = now;
+    return elapsed;
+  }
+};
+#else
+/// No-op stand-in used when the instrumentation is compiled out.
+struct AmclStageTimer {
+  /// Returns a zero duration.
+  constexpr std::chrono::nanoseconds lap() const { return std::chrono::nanoseconds{0}; }
+};
+#endif
+
+/// On-disk header of a binary particle filter snapshot. All fields are little-endian.
+struct AmclSnapshotHeader {
+  /// File format magic number.
+  std::uint8_t magic[8];  // NOLINT(modernize-avoid-c-arrays)
+  /// File format version.
+  std::uint32_t version;
+  /// Number of particle columns following the header.
+  std::uint32_t column_count;
+  /// Number of particles in each column.
+  std::uint64_t particle_count;
+  /// Size of the serialized `beluga::AmclParams`, in bytes.
+  std::uint64_t params_size;
+  /// Size of the serialized recovery probability estimator, in bytes.
+  std::uint64_t estimator_size;
+};
+
+static_assert(sizeof(AmclSnapshotHeader) == 40);
+static_assert(std::is_trivially_copyable_v<AmclSnapshotHeader>);
+
+/// Expected magic number of a binary particle filter snapshot.
+inline constexpr std::uint8_t kAmclSnapshotMagic[8] = {'B', 'L', 'G', 'A', 'M', 'C', 'L', '\0'};
+
+/// Supported binary particle filter snapshot format version.
+inline constexpr std::uint32_t kAmclSnapshotVersion = 1;
+
+/// Detects state sampling functions that can report being a no-op.
+/**
+ * Satisfied by samplers exposing an `is_near_identity(double, double)` query, like
+ * the ones returned by the odometry motion models. Samplers without the query (e.g.
+ * the one of `beluga::StationaryModel`, whose diversity noise is constant by design)
+ * always run the propagation pass.
+ */
+template <class Fn, class = void>
+struct is_identity_queryable : std::false_type {};
+
+/// Specialization for samplers providing the near-identity query.
+template <class Fn>
+struct is_identity_queryable<
+    Fn,
+    std::void_t<decltype(std::declval<const Fn&>().is_near_identity(double{}, double{}))>> : std::true_type {};
+
+/// Derives the generator type a particle-conditioned random state generator returns.
+/**
+ * Non-conditioned generators (those invocable without arguments) have no derived
+ * generator; an empty placeholder keeps the cache member trivially small for them.
+ */
+template <class Generator, class Particles, bool = std::is_invocable_v<Generator>>
+struct derived_random_state_generator {
+  /// Generator type returned when invoked with the particle container.
+  using type = std::invoke_result_t<const Generator&, const Particles&>;
 };
 
+/// Specialization for generators that do not condition on the particle set.
+template <class Generator, class Particles>
+struct derived_random_state_generator<Generator, Particles, true> {
+  /// Empty placeholder; the generator itself is used directly.
+  struct type {};
+};
+
+}  // namespace detail
+
 /// Implementation of the Adaptive Monte Carlo Localization (AMCL) algorithm.
 /**
  * \tparam MotionModel Class representing a motion model. Must satisfy \ref MotionModelPage.
@@ -65,10 +257,30 @@ struct AmclParams {
  *   representing a random state.
  * - t can be called with `const beluga::TupleVector<ParticleType>&> returning a callable
  *   that can be called without arguments and return an instance of 'SensorModel::state_type'.
+ * Particle-conditioned generators are invoked lazily, at the first random draw of a
+ * resample, and the derived callable is cached across resampling cycles; it is rebuilt
+ * after `update_map()`, `initialize()` and `restore()`.
  * \tparam WeightT Type to represent a weight of a particle.
  * \tparam ParticleType Full particle type, containing state, weight and possibly
  * other information .
  * \tparam ExecutionPolicy Execution policy for particles processing.
+ * \tparam ParticleContainer Container used to store the particle set. Defaults to
+ * `beluga::TupleVector`; a fixed-capacity alternative such as `beluga::FixedTupleArray`
+ * can be used to keep the filter heap-free after initialization.
+ * \tparam UpdatePolicy Policy type gating updates, called with the latest control action.
+ * Defaults to a type-erased `beluga::any_policy`, which lets the policy be chosen at
+ * runtime at the cost of a `std::function` indirection per check; pass concrete policy
+ * instances (e.g. the result of `beluga::policies::on_motion`, possibly composed with
+ * the boolean policy operators) through the policy-taking constructor to deduce the
+ * concrete types instead and let the checks inline.
+ * \tparam ResamplePolicy Policy type gating resampling, called with the particle
+ * container. Defaults to a type-erased `beluga::any_policy`; see `UpdatePolicy`.
+ *
+ * All stochastic stages (initialization sampling, resampling, recovery
+ * interspersion, and motion noise) draw from `beluga::get_default_random_engine()`
+ * unless an engine is passed explicitly; define `BELUGA_DEFAULT_RANDOM_ENGINE`
+ * to change the engine behind every one of those draws (see
+ * beluga/random/random_engines.hpp).
  */
 template <
     class MotionModel,
@@ -76,11 +288,16 @@ template <
     class RandomStateGenerator,
     typename WeightT = beluga::Weight,
     class ParticleType = std::tuple<typename SensorModel::state_type, WeightT>,
-    class ExecutionPolicy = std::execution::sequenced_policy>
+    class ExecutionPolicy = std::execution::sequenced_policy,
+    class ParticleContainer = beluga::TupleVector<ParticleType>,
+    class UpdatePolicy = beluga::any_policy<typename SensorModel::state_type>,
+    class ResamplePolicy = beluga::any_policy<const ParticleContainer&>>
 class Amcl {
   static_assert(
       std::is_same_v<ExecutionPolicy, std::execution::parallel_policy> or
-      std::is_same_v<ExecutionPolicy, std::execution::sequenced_policy>);
+      std::is_same_v<ExecutionPolicy, std::execution::sequenced_policy> or
+      std::is_same_v<ExecutionPolicy, std::execution::parallel_unsequenced_policy> or
+      std::is_same_v<ExecutionPolicy, beluga::execution::pool_policy>);
 
   using particle_type = ParticleType;
   using measurement_type = typename SensorModel::measurement_type;
@@ -88,8 +305,7 @@ class Amcl {
   using map_type = typename SensorModel::map_type;
   using spatial_hasher_type = spatial_hash<state_type>;
   using random_state_generator_type = RandomStateGenerator;
-  using estimation_type =
-      std::invoke_result_t<decltype(beluga::estimate<std::vector<state_type>>), std::vector<state_type>>;
+  using estimation_type = beluga::LazyEstimate<typename state_type::Scalar>;
 
  public:
   /// Construct a AMCL instance.
@@ -118,36 +334,224 @@ class Amcl {
         update_policy_{beluga::policies::on_motion(params_.update_min_d, params_.update_min_a)},
         resample_policy_{beluga::policies::every_n(params_.resample_interval)},
         random_state_generator_(std::move(random_state_generator)) {
-    if (params_.selective_resampling) {
-      resample_policy_ = resample_policy_ && beluga::policies::on_effective_size_drop;
+    // Selective resampling is evaluated in update() from the cached weight statistics
+    // rather than composed into the policy, so it does not traverse the weights again.
+    if (params_.target_update_latency > std::chrono::nanoseconds::zero()) {
+      latency_controller_.emplace(params_.target_update_latency, params_.min_particles, params_.max_particles);
+    }
+  }
+
+  /// Construct an AMCL instance with explicitly provided gating policies.
+  /**
+   * Overload for statically composed policies: passing the concrete types returned by
+   * `beluga::policies::on_motion`, `beluga::policies::every_n`, etc. (possibly composed
+   * with the boolean policy operators) deduces `UpdatePolicy` and `ResamplePolicy` to
+   * those types, so the per-update checks are direct calls instead of going through the
+   * `std::function` indirection of the type-erased defaults.
+   *
+   * \param motion_model Motion model instance.
+   * \param sensor_model Sensor model Instance.
+   * \param random_state_generator A callable able to produce random states, optionally based on the current particles
+   * state.
+   * \param spatial_hasher A spatial hasher instance capable of computing a hash out of a particle state.
+   * \param update_policy Policy gating updates, evaluated with the latest control action.
+   * \param resample_policy Policy gating resampling, evaluated with the particle container.
+   * \param params Parameters for AMCL implementation.
+   * \param execution_policy Policy to use when processing particles.
+   */
+  template <
+      bool Enable = std::is_invocable_r_v<bool, UpdatePolicy&, const typename SensorModel::state_type&>,
+      std::enable_if_t<Enable, int> = 0>
+  Amcl(
+      MotionModel motion_model,
+      SensorModel sensor_model,
+      RandomStateGenerator random_state_generator,
+      spatial_hasher_type spatial_hasher,
+      UpdatePolicy update_policy,
+      ResamplePolicy resample_policy,
+      const AmclParams& params = AmclParams{},
+      ExecutionPolicy execution_policy = std::execution::seq)
+      : params_{params},
+        motion_model_{std::move(motion_model)},
+        sensor_model_{std::move(sensor_model)},
+        execution_policy_{std::move(execution_policy)},
+        spatial_hasher_{std::move(spatial_hasher)},
+        random_probability_estimator_{params_.alpha_slow, params_.alpha_fast},
+        update_policy_{std::move(update_policy)},
+        resample_policy_{std::move(resample_policy)},
+        random_state_generator_(std::move(random_state_generator)) {
+    if (params_.target_update_latency > std::chrono::nanoseconds::zero()) {
+      latency_controller_.emplace(params_.target_update_latency, params_.min_particles, params_.max_particles);
     }
   }
 
   /// Returns a reference to the current set of particles.
+  /**
+   * The weights are not necessarily normalized; see `weight_normalization()`.
+   */
   [[nodiscard]] const auto& particles() const { return particles_; }
 
+  /// Returns the factor by which the stored particle weights exceed their normalized values.
+  /**
+   * Weight normalization is deferred: the reweight stage tracks the factor an eagerly
+   * normalizing pipeline would have divided out instead of writing normalized weights
+   * back, since every in-filter consumer is invariant under weight scaling (resampling
+   * draws from a `std::discrete_distribution`, which normalizes internally, and the
+   * effective sample size, the recovery probability and the pose estimate all derive
+   * from statistics recorded with the pending factor divided out). With
+   * `AmclParams::resample_interval` greater than one this removes a full write pass
+   * over the weight column from most updates. Equals one right after initialization
+   * and after every resample, where the stored weights match the eager pipeline's.
+   */
+  [[nodiscard]] double weight_normalization() const { return weight_scale_; }
+
+  /// Divides the stored particle weights by the pending normalization factor.
+  /**
+   * Materializes what `weight_normalization()` tracks, for external consumers that
+   * require literally normalized weights; the filter itself never does. No-op when
+   * the weights are already normalized.
+   */
+  void normalize_weights() {
+    particles_ |= beluga::actions::normalize(execution_policy_, weight_scale_);
+    weight_scale_ = 1.0;
+  }
+
+  /// Read-only particle snapshot handle returned by `retired_particles()`.
+  struct ParticleSnapshot {
+    /// Retired particle buffer, i.e. the set the last resample replaced.
+    const ParticleContainer& particles;
+    /// Update epoch the buffer was retired at; see `Amcl::update_epoch()`.
+    std::uint64_t epoch;
+  };
+
+  /// Returns a zero-copy read-only snapshot over the retired particle buffer.
+  /**
+   * Resampling double-buffers the particle set: the new set is materialized into the
+   * scratch buffer and the buffers are swapped, so the retired buffer keeps the full
+   * pre-resample set untouched until the next resample overwrites it. Unlike
+   * `particles()`, whose referent is rewritten in place by every update, the snapshot
+   * gives in-process consumers (costmap seeding, introspection) zero-copy access with
+   * a clear validity contract: the view is valid until the next buffer swap, and a
+   * consumer holding one detects staleness by comparing its `epoch` against
+   * `update_epoch()`. Empty until the first resample, and not to be accessed while an
+   * asynchronous update is in flight (see `update_async()`).
+   */
+  [[nodiscard]] ParticleSnapshot retired_particles() const { return {scratch_particles_, snapshot_epoch_}; }
+
+  /// Returns the epoch of the last buffer swap, i.e. of the snapshot currently exposed.
+  /**
+   * Incremented every time a resample retires a particle buffer; a
+   * `ParticleSnapshot` whose epoch no longer matches has been overwritten.
+   */
+  [[nodiscard]] std::uint64_t update_epoch() const { return snapshot_epoch_; }
+
+  /// Returns a snapshot of the storage telemetry counters of the particle container.
+  /**
+   * See `beluga::TupleContainer::storage_stats()` for details. Useful to detect filters
+   * whose resampling stage is reallocating storage on every cycle.
+   */
+  [[nodiscard]] auto particle_storage_stats() const { return particles_.storage_stats(); }
+
+  /// Returns the weight statistics recorded during the last update that ran.
+  /**
+   * Taken over the weights written by the sensor model with the previously pending
+   * normalization factor divided out (see `weight_normalization()`), so the average
+   * is a proxy for the measurement likelihood under this filter's particle set
+   * (see `beluga::AmclEnsemble`, which scores competing filters with it). The
+   * degeneracy telemetry they carry (weight entropy, extrema, coarse histogram) is
+   * scale invariant, so it describes the normalized weights all the same.
+   */
+  [[nodiscard]] const beluga::WeightStatistics& last_weight_statistics() const { return weight_statistics_; }
+
+  /// Returns the KLD bucket occupancy telemetry of the last resample that ran.
+  /**
+   * See `beluga::KldBucketStatistics`. Useful to audit the spatial hash resolutions
+   * this filter was constructed with (see `beluga::suggest_spatial_hash_resolution()`).
+   * Untouched by updates that did not resample.
+   */
+  [[nodiscard]] const beluga::KldBucketStatistics& last_kld_statistics() const { return kld_statistics_; }
+
+  /// Returns per-stage instrumentation of the last update cycle that ran.
+  /**
+   * See `beluga::AmclUpdateStats`. Durations are all zero when
+   * `BELUGA_DISABLE_AMCL_INSTRUMENTATION` is defined, and untouched by updates
+   * that were skipped by the update policy.
+   */
+  [[nodiscard]] const AmclUpdateStats& last_update_stats() const { return last_update_stats_; }
+
+  /// Returns the profiler aggregating stage timings across every update that ran.
+  /**
+   * Unlike `last_update_stats()`, which covers a single cycle, the profiler folds
+   * the stage durations of every cycle into named histograms, so long-running
+   * telemetry can read count/mean/p95/max per stage at any time (see
+   * `beluga::Profiler::snapshot()`). Inert when `BELUGA_DISABLE_PROFILING`
+   * is defined.
+   */
+  [[nodiscard]] const Profiler& profiler() const { return profiler_; }
+
+  /// Returns the effective particle ceiling the next resample will use.
+  /**
+   * Equals `AmclParams::max_particles` unless the latency budget controller has
+   * tightened it (see `AmclParams::target_update_latency`).
+   */
+  [[nodiscard]] std::size_t effective_max_particles() const {
+    return latency_controller_ ? latency_controller_->ceiling() : params_.max_particles;
+  }
+
+  /// Returns the current stage of the staged pose recovery mechanism.
+  /**
+   * Always `AmclRecoveryStage::kTracking` when staged recovery is disabled
+   * (see `AmclParams::recovery_likelihood_threshold`).
+   */
+  [[nodiscard]] AmclRecoveryStage recovery_stage() const { return recovery_stage_; }
+
   /// Initialize particles using a custom distribution.
   template <class Distribution>
   void initialize(Distribution distribution) {
-    particles_ = beluga::views::sample(std::move(distribution)) |                    //
-                 ranges::views::transform(beluga::make_from_state<particle_type>) |  //
-                 ranges::views::take_exactly(params_.max_particles) |                //
-                 ranges::to<beluga::TupleVector>;
+    particles_.assign_range(
+        beluga::views::sample(std::move(distribution)) |                    //
+        ranges::views::transform(beluga::make_from_state<particle_type>) |  //
+        ranges::views::take_exactly(params_.max_particles));
+    pending_batch_.clear();
+    weight_scale_ = 1.0;
+    derived_random_state_generator_.reset();
+    reset_recovery();
     force_update_ = true;
   }
 
   /// Initialize particles with a given pose and covariance.
   /**
+   * All states are drawn through the batch sampling path of
+   * `beluga::MultivariateNormalDistribution`, which applies the covariance
+   * transform as a single matrix-matrix product instead of one draw per particle.
+   *
    * \tparam CovarianceT type representing a covariance, compliant with state_type.
    * \throw std::runtime_error If the provided covariance is invalid.
    */
   template <class CovarianceT>
   void initialize(state_type pose, CovarianceT covariance) {
-    initialize(beluga::MultivariateNormalDistribution{pose, covariance});
+    auto distribution = beluga::MultivariateNormalDistribution{std::move(pose), std::move(covariance)};
+    particles_.assign_range(
+        distribution.samples(beluga::get_default_random_engine(), params_.max_particles) |
+        ranges::views::transform(beluga::make_from_state<particle_type>));
+    pending_batch_.clear();
+    weight_scale_ = 1.0;
+    derived_random_state_generator_.reset();
+    reset_recovery();
+    force_update_ = true;
   }
 
   /// Update the map used for localization.
-  void update_map(map_type map) { sensor_model_.update_map(std::move(map)); }
+  /**
+   * The map is moved through to the sensor model, so when `map_type` is a
+   * ref-counted handle (e.g. `beluga::SharedOccupancyGrid`) the swap is a
+   * pointer exchange and no grid data is copied while the filter waits.
+   */
+  void update_map(map_type map) {
+    sensor_model_.update_map(std::move(map));
+    // Free space may have moved; the derived random state generator is rebuilt on demand.
+    derived_random_state_generator_.reset();
+  }
 
   /// Update particles based on motion and sensor information.
   /**
@@ -159,8 +563,12 @@ class Amcl {
    *
    * \param control_action Control action.
    * \param measurement Measurement data.
-   * \return An optional pair containing the estimated pose and covariance after the update,
-   *         or std::nullopt if no update was performed.
+   * \return An optional lazy estimate handle after the update, or std::nullopt if no update
+   *         was performed. The mean pose is computed eagerly, while the covariance is only
+   *         materialized from the retained sufficient statistics when first accessed.
+   *         With `AmclParams::measurement_batch_size` greater than one, accepted pairs are
+   *         accumulated and std::nullopt is returned until the batch fills, at which point
+   *         the whole batch is processed as in `update_batch()`.
    */
   auto update(state_type control_action, measurement_type measurement) -> std::optional<estimation_type> {
     if (particles_.empty()) {
@@ -171,48 +579,572 @@ class Amcl {
       return std::nullopt;
     }
 
-    particles_ |= beluga::actions::propagate(
-                      execution_policy_, motion_model_(control_action_window_ << std::move(control_action))) |  //
-                  beluga::actions::reweight(execution_policy_, sensor_model_(std::move(measurement))) |         //
-                  beluga::actions::normalize(execution_policy_);
+    if (params_.measurement_batch_size > 1UL) {
+      // Batched mode: accumulate the pair (it already passed the update policy) and
+      // only run the pipeline once the batch is full.
+      pending_batch_.emplace_back(std::move(control_action), std::move(measurement));
+      if (pending_batch_.size() < params_.measurement_batch_size) {
+        return std::nullopt;
+      }
+      auto batch = std::move(pending_batch_);
+      pending_batch_.clear();
+      return run_batch(std::move(batch));
+    }
 
-    const double random_state_probability = random_probability_estimator_(particles_);
+    last_update_stats_ = AmclUpdateStats{};
+    last_update_stats_.particle_count = particles_.size();
+    auto stage_timer = detail::AmclStageTimer{};
 
-    if (resample_policy_(particles_)) {
-      auto random_state = ranges::compose(beluga::make_from_state<particle_type>, get_random_state_generator());
+    propagate_and_reweight(std::move(control_action), std::move(measurement), stage_timer);
+    return finish_update(stage_timer);
+  }
 
-      if (random_state_probability > 0.0) {
-        random_probability_estimator_.reset();
-      }
+  /// Integrates one odometry reading without touching the particle set.
+  /**
+   * Control actions are absolute odometry estimates and the motion models derive
+   * the motion increment from consecutive readings, so accumulating high-rate
+   * odometry between measurements amounts to keeping the most recent reading: an
+   * O(1) store that intermediate readings collapse into. Use together with the
+   * measurement-only `update()` overload when odometry arrives at a much higher
+   * rate than measurements, to avoid running the update gating per reading.
+   *
+   * \param control_action Latest odometry estimate.
+   */
+  void integrate_odometry(state_type control_action) { pending_control_ = std::move(control_action); }
 
-      particles_ |= beluga::views::sample |
-                    beluga::views::random_intersperse(std::move(random_state), random_state_probability) |
-                    beluga::views::take_while_kld(
-                        spatial_hasher_,        //
-                        params_.min_particles,  //
-                        params_.max_particles,  //
-                        params_.kld_epsilon,    //
-                        params_.kld_z) |
-                    beluga::actions::assign;
+  /// Update particles against the most recently integrated odometry reading.
+  /**
+   * Equivalent to `update()` with the control action last passed to
+   * `integrate_odometry()`, which is retained: further measurement-only updates
+   * without new readings in between see no motion increment.
+   *
+   * \param measurement Measurement data.
+   * \return An optional lazy estimate handle, as returned by `update()`, or
+   *         std::nullopt if no odometry reading was ever integrated.
+   */
+  auto update(measurement_type measurement) -> std::optional<estimation_type> {
+    if (!pending_control_.has_value()) {
+      return std::nullopt;
     }
+    return update(*pending_control_, std::move(measurement));
+  }
 
-    force_update_ = false;
-    return beluga::estimate(beluga::views::states(particles_), beluga::views::weights(particles_));
+  /// Update particles with a batch of accumulated control/measurement pairs.
+  /**
+   * Runs the propagation and reweighting stages once per pair in order, and the
+   * resampling and estimation stages only once for the whole batch. Sequential
+   * reweights multiply, so the final weights carry the evidence of every
+   * measurement while the O(n) resample/estimate tail is paid a single time and
+   * resampling-induced variance is not compounded per segment.
+   *
+   * The update policy is evaluated against the most recent control action of the
+   * batch, mirroring how `update()` gates on its single control action.
+   *
+   * \param batch Accumulated (control action, measurement) pairs, oldest first.
+   * \return An optional lazy estimate handle, as returned by `update()`.
+   */
+  auto update_batch(std::vector<std::pair<state_type, measurement_type>> batch) -> std::optional<estimation_type> {
+    if (particles_.empty() || batch.empty()) {
+      return std::nullopt;
+    }
+
+    if (!update_policy_(batch.back().first) && !force_update_) {
+      return std::nullopt;
+    }
+
+    return run_batch(std::move(batch));
+  }
+
+  /// Update particles asynchronously, overlapping stages of consecutive cycles.
+  /**
+   * Runs the same update as `update()` on a dedicated worker thread and returns a
+   * future for its result. Consecutive calls are serialized in submission order, so
+   * the caller can enqueue cycle N+1 as soon as its measurement arrives while the
+   * resample and estimation tail of cycle N is still running on the worker, and
+   * finish the covariance of a previously returned estimate (see
+   * `beluga::LazyEstimate`, which holds its own copy of the statistics) while the
+   * next propagation runs.
+   *
+   * The particle set must not be accessed (e.g. through `particles()`) and no
+   * synchronous `update()` calls must be made while an asynchronous update is in
+   * flight. `update_async()` itself is meant to be called from a single thread.
+   *
+   * \param control_action Control action.
+   * \param measurement Measurement data.
+   * \return A future holding an optional lazy estimate handle, as returned by `update()`.
+   */
+  auto update_async(state_type control_action, measurement_type measurement)
+      -> std::future<std::optional<estimation_type>> {
+    if (!update_worker_) {
+      // A single worker serializes the submitted cycles in order.
+      update_worker_ = std::make_unique<beluga::ThreadPool>(1);
+    }
+    return update_worker_->submit(
+        [this, control_action = std::move(control_action), measurement = std::move(measurement)]() mutable {
+          return update(std::move(control_action), std::move(measurement));
+        });
+  }
+
+  /// Update particles asynchronously, signaling completion through an executor.
+  /**
+   * Continuation-style counterpart of the future-returning overload for executor-based
+   * runtimes: instead of parking a thread on `std::future::get()`, the caller provides
+   * an executor callable and a completion handler. The update runs on the same
+   * dedicated worker as the other overload (with the same serialization and
+   * single-caller contract), and when it finishes the completion handler is posted to
+   * the executor together with the update result, so the continuation interleaves with
+   * other scheduled work.
+   *
+   * \param control_action Control action.
+   * \param measurement Measurement data.
+   * \param executor Callable accepting a nullary work item to schedule, e.g. a wrapper
+   *   around an event loop post operation. Invoked from the update worker thread.
+   * \param completion Callable invoked through the executor with the update result,
+   *   as returned by `update()`.
+   */
+  template <class Executor, class Completion>
+  void update_async(state_type control_action, measurement_type measurement, Executor executor, Completion completion) {
+    static_assert(std::is_invocable_v<Completion&, std::optional<estimation_type>>);
+    if (!update_worker_) {
+      // A single worker serializes the submitted cycles in order.
+      update_worker_ = std::make_unique<beluga::ThreadPool>(1);
+    }
+    update_worker_->execute([this, control_action = std::move(control_action), measurement = std::move(measurement),
+                             executor = std::move(executor), completion = std::move(completion)]() mutable {
+      auto result = update(std::move(control_action), std::move(measurement));
+      executor([result = std::move(result), completion = std::move(completion)]() mutable {
+        completion(std::move(result));
+      });
+    });
   }
 
   /// Force a manual update of the particles on the next iteration of the filter.
   void force_update() { force_update_ = true; }
 
+  /// Adjusts the KLD particle count bounds for subsequent resamples.
+  /**
+   * The bounds only parameterize the resampling stage (the
+   * `beluga::views::take_while_kld` loop), so they can be changed at runtime
+   * without reinitializing the filter or touching particle state; the new
+   * bounds take effect on the next resample. When a latency budget controller
+   * is engaged (see `AmclParams::target_update_latency`) it is rebuilt around
+   * the new bounds, restarting its adaptation.
+   *
+   * \param min_particles Minimum allowed number of particles.
+   * \param max_particles Maximum allowed number of particles.
+   */
+  void set_particle_bounds(std::size_t min_particles, std::size_t max_particles) {
+    params_.min_particles = min_particles;
+    params_.max_particles = max_particles;
+    if (latency_controller_) {
+      latency_controller_.emplace(params_.target_update_latency, params_.min_particles, params_.max_particles);
+    }
+  }
+
+  /// Routes per-update scratch allocations through a caller-provided memory resource.
+  /**
+   * Transient per-cycle storage (currently the KLD chi-square bound table and the
+   * bucket set built for each resample, see `beluga::kld_condition()`) is then carved
+   * out of a monotonic arena on top of `upstream` and released in bulk after every
+   * cycle, so those allocations never reach the general-purpose allocator on the
+   * update hot path. The particle buffers themselves are unaffected: they are double
+   * buffered and reach a steady state with no allocations of their own.
+   *
+   * \param upstream Resource backing the arena. It must outlive this instance.
+   */
+  void use_scratch_memory_resource(std::pmr::memory_resource& upstream) {
+    scratch_arena_ = std::make_unique<std::pmr::monotonic_buffer_resource>(&upstream);
+  }
+
+  /// Writes a binary snapshot of the particle filter state to a stream.
+  /**
+   * The layout is a small header followed by the per-column element sizes, the filter
+   * parameters, the recovery probability estimator state and the particle columns as
+   * flat arrays in particle tuple order. Every payload is a single bulk `write()` of
+   * trivially copyable data, so checkpointing stays in the milliseconds even at
+   * hundreds of thousands of particles, and the column arrays can be copied or
+   * memory-mapped straight back into container storage. The weights are written as
+   * stored; call `normalize_weights()` beforehand if snapshot consumers other than
+   * `restore()` expect unit-sum weights.
+   *
+   * \param stream Output stream, must be opened in binary mode.
+   * \throws std::invalid_argument If the stream cannot be written.
+   */
+  void save(std::ostream& stream) const {
+    static_assert(std::is_trivially_copyable_v<AmclParams>);
+    static_assert(std::is_trivially_copyable_v<beluga::ThrunRecoveryProbabilityEstimator>);
+    constexpr std::size_t kColumnCount = std::tuple_size_v<particle_type>;
+
+    detail::AmclSnapshotHeader header{};
+    std::copy(std::begin(detail::kAmclSnapshotMagic), std::end(detail::kAmclSnapshotMagic), std::begin(header.magic));
+    header.version = detail::kAmclSnapshotVersion;
+    header.column_count = static_cast<std::uint32_t>(kColumnCount);
+    header.particle_count = particles_.size();
+    header.params_size = sizeof(AmclParams);
+    header.estimator_size = sizeof(beluga::ThrunRecoveryProbabilityEstimator);
+    stream.write(reinterpret_cast<const char*>(&header), sizeof(header));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    const auto column_sizes = column_element_sizes();
+    stream.write(
+        reinterpret_cast<const char*>(column_sizes.data()),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        static_cast<std::streamsize>(sizeof(column_sizes)));
+    stream.write(reinterpret_cast<const char*>(&params_), sizeof(params_));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    stream.write(
+        reinterpret_cast<const char*>(&random_probability_estimator_),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        sizeof(random_probability_estimator_));
+
+    save_columns(stream, std::make_index_sequence<kColumnCount>());
+    if (!stream) {
+      throw std::invalid_argument{"Couldn't write the particle filter snapshot"};
+    }
+  }
+
+  /// Restores the particle filter state from a binary snapshot.
+  /**
+   * Reverses `save()`: each particle column is read with one bulk `read()` directly
+   * into the container storage and the recovery probability estimator state is
+   * restored, so a robot can warm-restart from its last checkpoint instead of redoing
+   * global localization. The stored parameters are kept in the snapshot for tooling
+   * and layout validation; the restoring filter keeps its constructed configuration,
+   * which must match the one of the filter that wrote the snapshot. The next
+   * `update()` runs unconditionally, as after `initialize()`.
+   *
+   * \param stream Input stream positioned at a snapshot written by `save()`.
+   * \throws std::invalid_argument If the stream does not hold a compatible snapshot.
+   *   The particle set is left unspecified if the snapshot turns out to be truncated.
+   */
+  void restore(std::istream& stream) {
+    constexpr std::size_t kColumnCount = std::tuple_size_v<particle_type>;
+
+    detail::AmclSnapshotHeader header{};
+    stream.read(reinterpret_cast<char*>(&header), sizeof(header));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    const bool valid = bool(stream) &&
+                       std::equal(std::begin(header.magic), std::end(header.magic), detail::kAmclSnapshotMagic) &&
+                       header.version == detail::kAmclSnapshotVersion && header.column_count == kColumnCount &&
+                       header.params_size == sizeof(AmclParams) &&
+                       header.estimator_size == sizeof(beluga::ThrunRecoveryProbabilityEstimator);
+    if (!valid) {
+      throw std::invalid_argument{"Invalid particle filter snapshot"};
+    }
+
+    auto column_sizes = decltype(column_element_sizes()){};
+    stream.read(
+        reinterpret_cast<char*>(column_sizes.data()),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        static_cast<std::streamsize>(sizeof(column_sizes)));
+    if (!stream || column_sizes != column_element_sizes()) {
+      throw std::invalid_argument{"Incompatible particle filter snapshot layout"};
+    }
+
+    auto params = AmclParams{};  // Stored configuration, not adopted; see above.
+    stream.read(reinterpret_cast<char*>(&params), sizeof(params));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    auto estimator = random_probability_estimator_;
+    stream.read(reinterpret_cast<char*>(&estimator), sizeof(estimator));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+
+    particles_.resize(static_cast<std::size_t>(header.particle_count));
+    load_columns(stream, std::make_index_sequence<kColumnCount>());
+    if (!stream) {
+      throw std::invalid_argument{"Truncated particle filter snapshot"};
+    }
+
+    random_probability_estimator_ = estimator;
+    pending_batch_.clear();
+    weight_scale_ = 1.0;  // The restored weights are taken at face value.
+    derived_random_state_generator_.reset();
+    reset_recovery();
+    force_update_ = true;
+  }
+
  private:
   /// Gets a callable that will produce a random state.
-  [[nodiscard]] decltype(auto) get_random_state_generator() const {
+  /**
+   * For particle-conditioned generators, the derived generator is built on first use
+   * and cached across resampling cycles, since its construction can be expensive
+   * (e.g. re-deriving the free space of the map for a uniform distribution). The
+   * cache is invalidated explicitly when the map changes and when the particle
+   * distribution shifts wholesale (initialization and snapshot restores).
+   */
+  [[nodiscard]] decltype(auto) get_random_state_generator() {
     if constexpr (std::is_invocable_v<random_state_generator_type>) {
       return random_state_generator_;
     } else {
-      return random_state_generator_(particles_);
+      if (!derived_random_state_generator_) {
+        derived_random_state_generator_ = random_state_generator_(particles_);
+      }
+      return (*derived_random_state_generator_);
+    }
+  }
+
+  /// Returns the on-disk element size of each particle column, in tuple order.
+  [[nodiscard]] static constexpr auto column_element_sizes() {
+    return column_element_sizes_impl(std::make_index_sequence<std::tuple_size_v<particle_type>>());
+  }
+
+  /// \copydoc column_element_sizes()
+  template <std::size_t... Is>
+  [[nodiscard]] static constexpr auto column_element_sizes_impl(std::index_sequence<Is...>) {
+    static_assert((std::is_trivially_copyable_v<std::tuple_element_t<Is, particle_type>> && ...));
+    return std::array<std::uint64_t, sizeof...(Is)>{sizeof(std::tuple_element_t<Is, particle_type>)...};
+  }
+
+  /// Writes the particle columns to a stream as flat arrays, one bulk write per column.
+  template <std::size_t... Is>
+  void save_columns(std::ostream& stream, std::index_sequence<Is...>) const {
+    const auto count = static_cast<std::streamsize>(particles_.size());
+    (stream.write(
+         reinterpret_cast<const char*>(particles_.template data<Is>()),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+         count * static_cast<std::streamsize>(sizeof(std::tuple_element_t<Is, particle_type>))),
+     ...);
+  }
+
+  /// Reads the particle columns from a stream, one bulk read per column.
+  template <std::size_t... Is>
+  void load_columns(std::istream& stream, std::index_sequence<Is...>) {
+    const auto count = static_cast<std::streamsize>(particles_.size());
+    (stream.read(
+         reinterpret_cast<char*>(particles_.template data<Is>()),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+         count * static_cast<std::streamsize>(sizeof(std::tuple_element_t<Is, particle_type>))),
+     ...);
+  }
+
+  /// Runs the propagation and reweighting stages for one control/measurement pair.
+  /**
+   * The fused reweight accumulates the weight and pose estimation statistics in the
+   * same sweep that writes the updated weights; the recovery probability estimator
+   * and the selective resampling check in `finish_update()` consume them instead of
+   * traversing the weights again, and updates that do not resample return the
+   * estimate without another pass over the particle set. Normalization is deferred:
+   * no sweep divides the weights by their sum, the pending factor is tracked in
+   * `weight_scale_` instead (see `weight_normalization()`).
+   */
+  void propagate_and_reweight(
+      state_type control_action,
+      measurement_type measurement,
+      detail::AmclStageTimer& stage_timer) {
+    BELUGA_TRACEPOINT1(propagate_begin, particles_.size());
+    auto state_sampling_function = motion_model_(control_action_window_ << std::move(control_action));
+
+    bool skip_propagation = false;
+    if constexpr (detail::is_identity_queryable<decltype(state_sampling_function)>::value) {
+      // Zero-motion fast path: when the conditioned sampler is indistinguishable from
+      // the identity transform, skip the propagation pass entirely. States (and thus
+      // the precomputed spatial hashes) are left untouched.
+      skip_propagation = (params_.propagate_min_d > 0.0 || params_.propagate_min_a > 0.0) &&
+                         state_sampling_function.is_near_identity(params_.propagate_min_d, params_.propagate_min_a);
+    }
+
+    if (!skip_propagation) {
+      if constexpr (beluga::has_cluster_v<particle_type>) {
+        // Particle types carrying a cluster attribute get their spatial hash column
+        // refreshed in the same pass that samples the new states, so KLD bucketing
+        // during resampling reads precomputed hashes instead of re-deriving them.
+        particles_ |=
+            beluga::actions::propagate(execution_policy_, std::move(state_sampling_function), spatial_hasher_);
+      } else {
+        particles_ |= beluga::actions::propagate(execution_policy_, std::move(state_sampling_function));
+      }
+    }
+    const auto propagate_duration = stage_timer.lap();
+    last_update_stats_.propagate_duration += propagate_duration;
+    profiler_.record("propagate", propagate_duration);
+    BELUGA_TRACEPOINT1(reweight_begin, particles_.size());
+
+    // Conditioning the sensor model on the measurement covers per-measurement
+    // precomputation (e.g. NDT cell construction), worth telling apart from the
+    // per-particle weighting it feeds.
+    auto weighting_function = [this, &measurement] {
+      const auto measurement_scope = profiler_.measure("sensor_model");
+      return sensor_model_(std::move(measurement));
+    }();
+
+    particles_ |= beluga::actions::reweight_deferred(
+        execution_policy_, std::move(weighting_function), weight_scale_, std::ref(weight_statistics_),
+        std::ref(estimate_statistics_));
+    // The recorded sum is the factor an eager pipeline would have divided out here;
+    // folding it into the running scale defers that write pass over the weight column.
+    weight_scale_ *= weight_statistics_.sum;
+    const auto reweight_duration = stage_timer.lap();
+    last_update_stats_.reweight_duration += reweight_duration;
+    profiler_.record("reweight", reweight_duration);
+    BELUGA_TRACEPOINT1(reweight_end, particles_.size());
+  }
+
+  /// Runs propagation and reweighting for every pair of a batch and the tail once.
+  auto run_batch(std::vector<std::pair<state_type, measurement_type>> batch) -> std::optional<estimation_type> {
+    last_update_stats_ = AmclUpdateStats{};
+    last_update_stats_.particle_count = particles_.size();
+    auto stage_timer = detail::AmclStageTimer{};
+
+    for (auto& [control_action, measurement] : batch) {
+      propagate_and_reweight(std::move(control_action), std::move(measurement), stage_timer);
+    }
+    return finish_update(stage_timer);
+  }
+
+  /// Runs the resampling and estimation tail of an update and returns the estimate.
+  auto finish_update(detail::AmclStageTimer& stage_timer) -> std::optional<estimation_type> {
+    const double random_state_probability = random_probability_estimator_(weight_statistics_);
+
+    const bool should_resample =
+        resample_policy_(particles_) &&
+        (!params_.selective_resampling || beluga::policies::on_effective_size_drop(weight_statistics_));
+
+    if (should_resample) {
+      BELUGA_TRACEPOINT1(resample_begin, particles_.size());
+      const auto make_random_particle = [this](state_type state) {
+        auto particle = beluga::make_from_state<particle_type>(std::move(state));
+        if constexpr (beluga::has_cluster_v<particle_type>) {
+          // Keep the precomputed hash column coherent for randomly inserted particles.
+          beluga::cluster(particle) = spatial_hasher_(beluga::state(particle));
+        }
+        return particle;
+      };
+      // Deriving the generator from the particle set is deferred to the first actual
+      // draw, so cycles that intersperse no random particles never pay for it.
+      auto random_state = [this, make_random_particle]() {
+        return make_random_particle(get_random_state_generator()());
+      };
+
+      if (random_state_probability > 0.0) {
+        random_probability_estimator_.reset();
+      }
+
+      if (params_.compaction_weight_epsilon > 0.0) {
+        // Shrink the resampler's input by compacting out effectively dead particles;
+        // the renormalized survivors carry all but a negligible epsilon of the mass.
+        // The epsilon refers to normalized weights, so the pending scale multiplies in.
+        particles_ |= beluga::actions::discard_below(params_.compaction_weight_epsilon * weight_scale_);
+      }
+
+      // Materialize the resampled set into the scratch buffer and swap it with the
+      // current one. Both buffers retain their capacity across updates, so once they
+      // have grown to the maximum particle count no further allocation takes place.
+      // The effective ceiling may be tightened below the configured maximum by the
+      // latency budget controller when a target update latency is set.
+      const std::size_t max_particles =
+          latency_controller_ ? latency_controller_->ceiling() : params_.max_particles;
+
+      scratch_particles_.assign_range(
+          particles_ | beluga::views::sample |
+          beluga::views::random_intersperse(std::move(random_state), random_state_probability) |
+          beluga::views::take_while_kld(
+              spatial_hasher_,        //
+              params_.min_particles,  //
+              max_particles,          //
+              params_.kld_epsilon,    //
+              params_.kld_z,          //
+              scratch_arena_.get(),   //
+              &kld_statistics_));
+      std::swap(particles_, scratch_particles_);
+      ++snapshot_epoch_;
+      weight_scale_ = 1.0;  // The resampled particles carry unit weights.
+      last_update_stats_.resample_duration = stage_timer.lap();
+      profiler_.record("resample", last_update_stats_.resample_duration);
+      BELUGA_TRACEPOINT1(resample_end, particles_.size());
     }
+    last_update_stats_.resampled = should_resample;
+    last_update_stats_.resampled_count = particles_.size();
+
+    force_update_ = false;
+    if (should_resample) {
+      // Resampling replaced the particle set, invalidating the statistics taken
+      // during normalization, so they are re-accumulated with a dedicated pass.
+      estimate_statistics_ = beluga::se2_estimate_statistics(
+          beluga::views::states(particles_), beluga::views::weights(particles_));
+      last_update_stats_.estimate_duration = stage_timer.lap();
+      profiler_.record("estimate", last_update_stats_.estimate_duration);
+      BELUGA_TRACEPOINT1(estimate_end, particles_.size());
+    }
+    if (latency_controller_) {
+      // Feed the measured cycle latency back so the next resample sizes its ceiling
+      // to the current load.
+      const auto measured_latency =
+          last_update_stats_.propagate_duration + last_update_stats_.reweight_duration +
+          last_update_stats_.resample_duration + last_update_stats_.estimate_duration;
+      (*latency_controller_)(measured_latency, last_update_stats_.particle_count);
+    }
+
+    if (params_.recovery_likelihood_threshold > 0.0) {
+      track_recovery();
+    }
+
+    if (scratch_arena_) {
+      // The per-cycle temporaries are dead once the resample completes, so the arena
+      // memory is recycled in bulk for the next cycle.
+      scratch_arena_->release();
+    }
+
+    profiler_.record(
+        "update", last_update_stats_.propagate_duration + last_update_stats_.reweight_duration +
+                      last_update_stats_.resample_duration + last_update_stats_.estimate_duration);
+    BELUGA_TRACEPOINT1(update_end, particles_.size());
+
+    // The handle computes the mean eagerly; the covariance is only finished from
+    // the statistics if the caller actually reads it.
+    return estimation_type{estimate_statistics_};
+  }
+
+  /// Watches the measurement likelihood and runs the staged pose recovery.
+  /**
+   * Healthy updates retain their estimation statistics as the recovery anchor.
+   * Degradation is declared after `AmclParams::recovery_trigger_window` consecutive
+   * updates whose average weight falls below the threshold; the first stage re-seeds
+   * the particle set in place around the anchor with an inflated covariance, and only
+   * if the likelihood stays low for `AmclParams::recovery_escalation_window` further
+   * updates does the second stage escalate to sampling the random state generator
+   * over the whole map. The degraded estimate of the triggering update is still
+   * returned; the re-seeded set takes over on the next update, which the
+   * initialization forces unconditionally.
+   */
+  void track_recovery() {
+    if (weight_statistics_.average() >= params_.recovery_likelihood_threshold) {
+      degraded_update_count_ = 0;
+      recovery_stage_ = AmclRecoveryStage::kTracking;
+      last_good_estimate_statistics_ = estimate_statistics_;
+      return;
+    }
+    ++degraded_update_count_;
+    if (recovery_stage_ == AmclRecoveryStage::kTracking) {
+      if (degraded_update_count_ < params_.recovery_trigger_window || !last_good_estimate_statistics_) {
+        return;
+      }
+      auto [pose, covariance] = beluga::estimate(*last_good_estimate_statistics_);
+      covariance *= params_.recovery_covariance_inflation;
+      // Keep the inflated covariance symmetric positive definite under floating
+      // point noise so the distribution construction cannot reject it.
+      covariance = ((covariance + covariance.transpose()) / 2.0).eval();
+      covariance.diagonal().array() += 1e-6;
+      initialize(std::move(pose), std::move(covariance));
+      recovery_stage_ = AmclRecoveryStage::kLocalRecovery;
+      degraded_update_count_ = 0;
+    } else if (recovery_stage_ == AmclRecoveryStage::kLocalRecovery) {
+      if (degraded_update_count_ < params_.recovery_escalation_window) {
+        return;
+      }
+      // Free-space-wide sampling through the random state generator, wrapped as a
+      // distribution for the initialization machinery.
+      auto generator = get_random_state_generator();
+      initialize([generator = std::move(generator)](auto& engine) mutable {
+        static_cast<void>(engine);
+        return generator();
+      });
+      recovery_stage_ = AmclRecoveryStage::kGlobalRecovery;
+      degraded_update_count_ = 0;
+    }
+  }
+
+  /// Returns the staged recovery state machine to tracking, dropping the anchor.
+  void reset_recovery() {
+    recovery_stage_ = AmclRecoveryStage::kTracking;
+    degraded_update_count_ = 0;
+    last_good_estimate_statistics_.reset();
   }
-  beluga::TupleVector<particle_type> particles_;
+  ParticleContainer particles_;
+  /// Double buffer for resampling; swapped with `particles_` so steady-state
+  /// resampling reuses previously allocated storage instead of reallocating.
+  /// Between resamples it holds the retired set; see `retired_particles()`.
+  ParticleContainer scratch_particles_;
+  /// Number of buffer swaps so far, tagging the retired snapshot.
+  std::uint64_t snapshot_epoch_{0};
 
   AmclParams params_;
 
@@ -221,17 +1153,147 @@ class Amcl {
   ExecutionPolicy execution_policy_;
 
   spatial_hasher_type spatial_hasher_;
+  /// Weight statistics of the current update, filled in by the deferred reweight action.
+  beluga::WeightStatistics weight_statistics_;
+  /// Factor by which the stored weights exceed their normalized values; see `weight_normalization()`.
+  double weight_scale_{1.0};
+  /// Bucket occupancy telemetry of the last resample, filled in by the KLD condition.
+  beluga::KldBucketStatistics kld_statistics_;
+  /// Pose estimation statistics of the current update, filled in by the deferred reweight action.
+  beluga::SE2EstimateStatistics<double> estimate_statistics_;
   beluga::ThrunRecoveryProbabilityEstimator random_probability_estimator_;
-  beluga::any_policy<state_type> update_policy_;
-  beluga::any_policy<decltype(particles_)> resample_policy_;
+  /// Per-stage instrumentation of the last update cycle.
+  AmclUpdateStats last_update_stats_;
+  Profiler profiler_;
+  /// Adaptive particle budget controller, engaged when a target update latency is set.
+  std::optional<beluga::LatencyBudgetController> latency_controller_;
+  UpdatePolicy update_policy_;
+  ResamplePolicy resample_policy_;
 
   random_state_generator_type random_state_generator_;
+  /// Cached generator derived from the particle set; see `get_random_state_generator()`.
+  std::optional<typename detail::derived_random_state_generator<random_state_generator_type, ParticleContainer>::type>
+      derived_random_state_generator_;
+
+  /// Estimation statistics of the last healthy update, anchoring local recovery.
+  std::optional<beluga::SE2EstimateStatistics<double>> last_good_estimate_statistics_;
+  /// Current stage of the staged pose recovery mechanism.
+  AmclRecoveryStage recovery_stage_{AmclRecoveryStage::kTracking};
+  /// Consecutive degraded updates seen in the current stage.
+  std::size_t degraded_update_count_{0};
 
   beluga::RollingWindow<state_type, 2> control_action_window_;
 
+  /// Accumulated control/measurement pairs when measurement batching is enabled.
+  std::vector<std::pair<state_type, measurement_type>> pending_batch_;
+
+  /// Latest odometry reading passed to `integrate_odometry()`.
+  std::optional<state_type> pending_control_;
+
+  /// Lazily created single-worker pool behind `update_async()`.
+  std::unique_ptr<beluga::ThreadPool> update_worker_;
+
+  /// Arena for per-update scratch storage, engaged by `use_scratch_memory_resource()`.
+  std::unique_ptr<std::pmr::monotonic_buffer_resource> scratch_arena_;
+
   bool force_update_{true};
 };
 
+/// Compile-time bounded AMCL variant for embedded deployments.
+/**
+ * Binds the particle capacity at compile time so the whole update path stays off the
+ * heap and the per-update checks inline: both particle buffers are
+ * `beluga::FixedTupleArray` instances with storage embedded in the filter object, and
+ * the gating policies default to the concrete types behind
+ * `beluga::policies::on_motion` and `beluga::policies::every_n` instead of the
+ * type-erased `beluga::any_policy`, turning every policy check into a direct call.
+ * `AmclParams::max_particles` (and with it the ceiling of the KLD sampling loop) is
+ * clamped to `MaxParticles` on construction, so the runtime limits can never outgrow
+ * the compile-time storage bound.
+ *
+ * The remaining per-resample scratch allocations (the KLD bucket set, see
+ * `beluga::kld_condition()`) can be kept off the general-purpose allocator by routing
+ * them through `use_scratch_memory_resource()` over a statically allocated upstream
+ * buffer.
+ *
+ * \tparam MaxParticles Compile-time particle capacity. Sized for the worst case
+ * (global localization); the KLD loop keeps the working set smaller when converged.
+ * \tparam MotionModel Class representing a motion model. Must satisfy \ref MotionModelPage.
+ * \tparam SensorModel Class representing a sensor model. Must satisfy \ref SensorModelPage.
+ * \tparam RandomStateGenerator A callable able to produce random states; see `beluga::Amcl`.
+ * \tparam WeightT Type to represent a weight of a particle.
+ * \tparam ParticleType Full particle type, containing state, weight and possibly
+ * other information.
+ * \tparam ExecutionPolicy Execution policy for particles processing.
+ * \tparam UpdatePolicy Concrete policy type gating updates.
+ * \tparam ResamplePolicy Concrete policy type gating resampling.
+ */
+template <
+    std::size_t MaxParticles,
+    class MotionModel,
+    class SensorModel,
+    class RandomStateGenerator,
+    typename WeightT = beluga::Weight,
+    class ParticleType = std::tuple<typename SensorModel::state_type, WeightT>,
+    class ExecutionPolicy = std::execution::sequenced_policy,
+    class UpdatePolicy = decltype(beluga::policies::on_motion(0.0, 0.0)),
+    class ResamplePolicy = decltype(beluga::policies::every_n(0UL))>
+class BoundedAmcl : public Amcl<
+                        MotionModel,
+                        SensorModel,
+                        RandomStateGenerator,
+                        WeightT,
+                        ParticleType,
+                        ExecutionPolicy,
+                        beluga::FixedTupleArray<ParticleType, MaxParticles>,
+                        UpdatePolicy,
+                        ResamplePolicy> {
+  static_assert(MaxParticles > 0);
+
+  using base_type = Amcl<
+      MotionModel,
+      SensorModel,
+      RandomStateGenerator,
+      WeightT,
+      ParticleType,
+      ExecutionPolicy,
+      beluga::FixedTupleArray<ParticleType, MaxParticles>,
+      UpdatePolicy,
+      ResamplePolicy>;
+
+ public:
+  /// Compile-time particle capacity of the filter.
+  static constexpr std::size_t kMaxParticles = MaxParticles;
+
+  /// Construct a bounded AMCL instance.
+  /**
+   * Arguments are as in `beluga::Amcl`, with the particle limits of `params` clamped
+   * to the compile-time capacity.
+   */
+  BoundedAmcl(
+      MotionModel motion_model,
+      SensorModel sensor_model,
+      RandomStateGenerator random_state_generator,
+      spatial_hash<typename SensorModel::state_type> spatial_hasher,
+      const AmclParams& params = AmclParams{},
+      ExecutionPolicy execution_policy = std::execution::seq)
+      : base_type{
+            std::move(motion_model),
+            std::move(sensor_model),
+            std::move(random_state_generator),
+            std::move(spatial_hasher),
+            bounded(params),
+            std::move(execution_policy)} {}
+
+ private:
+  /// Clamps the runtime particle limits to the compile-time capacity.
+  static AmclParams bounded(AmclParams params) {
+    params.max_particles = std::min(params.max_particles, MaxParticles);
+    params.min_particles = std::min(params.min_particles, params.max_particles);
+    return params;
+  }
+};
+
 }  // namespace beluga
 
 #endif  // BELUGA_ALGORITHM_AMCL_CORE_HPP
@@ -0,0 +1,180 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ALGORITHM_AMCL_ENSEMBLE_HPP
+#define BELUGA_ALGORITHM_AMCL_ENSEMBLE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <future>
+#include <numeric>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <beluga/algorithm/exponential_filter.hpp>
+#include <beluga/utility/thread_pool.hpp>
+
+/**
+ * \file
+ * \brief Implementation of an ensemble of independent AMCL filters for global localization.
+ */
+
+namespace beluga {
+
+/// Ensemble of independent particle filters competing to solve global localization.
+/**
+ * One very large filter has poor cache behavior and converges slowly during global
+ * localization. This ensemble instead runs K small independent filters (same models,
+ * different seeds or initializations) concurrently, one per worker thread, which
+ * scales with cores far better than intra-filter parallelism. After every update each
+ * filter is scored by a smoothed average of its unnormalized particle weights — a
+ * proxy for the measurement likelihood under its hypothesis — and at a configurable
+ * interval the lower-scoring half is culled, until a single survivor continues as the
+ * main filter.
+ *
+ * \tparam Filter A particle filter type with the `beluga::Amcl` update interface.
+ *   It must expose `last_weight_statistics()` for scoring and be move constructible.
+ */
+template <class Filter>
+class AmclEnsemble {
+ public:
+  /// Constructs an ensemble from already initialized filters.
+  /**
+   * \param filters Member filters, typically constructed with different seeds or
+   *   initial distributions. Must not be empty.
+   * \param cull_interval Number of updates between culling rounds.
+   * \param alpha Smoothing factor for the per-filter score.
+   */
+  explicit AmclEnsemble(std::vector<Filter> filters, std::size_t cull_interval = 10, double alpha = 0.1)
+      : filters_{std::move(filters)},
+        score_filters_(filters_.size(), ExponentialFilter{alpha}),
+        scores_(filters_.size(), 0.0),
+        cull_interval_{cull_interval},
+        pool_{std::min<std::size_t>(filters_.size(), std::max<unsigned>(1, std::thread::hardware_concurrency()))} {
+    assert(!filters_.empty());
+    assert(cull_interval > 0);
+  }
+
+  /// Returns the number of filters still competing.
+  [[nodiscard]] std::size_t size() const noexcept { return filters_.size(); }
+
+  /// Returns true once a single survivor remains.
+  [[nodiscard]] bool converged() const noexcept { return filters_.size() == 1; }
+
+  /// Returns the currently best-scoring filter.
+  [[nodiscard]] const Filter& best() const { return filters_[best_index()]; }
+
+  /// \overload
+  [[nodiscard]] Filter& best() { return filters_[best_index()]; }
+
+  /// Forces every member filter to update on the next iteration.
+  void force_update() {
+    for (auto& filter : filters_) {
+      filter.force_update();
+    }
+  }
+
+  /// Updates every member filter concurrently and returns the best filter's result.
+  /**
+   * The control action and measurement are copied into each member filter, and the
+   * updates run on separate workers. Scores are refreshed from the weight statistics
+   * of filters that actually updated, and a culling round drops the lower-scoring
+   * half every `cull_interval` updates until one filter survives.
+   *
+   * \param control_action Control action, copied into each filter.
+   * \param measurement Measurement data, copied into each filter.
+   * \return The update result of the best-scoring filter.
+   */
+  template <class ControlT, class MeasurementT>
+  auto update(const ControlT& control_action, const MeasurementT& measurement) {
+    using result_type = decltype(std::declval<Filter&>().update(control_action, measurement));
+    auto results = std::vector<result_type>(filters_.size());
+
+    auto futures = std::vector<std::future<void>>{};
+    futures.reserve(filters_.size());
+    for (std::size_t index = 0; index < filters_.size(); ++index) {
+      futures.push_back(pool_.submit([this, index, &results, &control_action, &measurement] {
+        results[index] = filters_[index].update(ControlT{control_action}, MeasurementT{measurement});
+      }));
+    }
+    for (auto& future : futures) {
+      future.wait();
+    }
+
+    bool any_updated = false;
+    for (std::size_t index = 0; index < filters_.size(); ++index) {
+      if (results[index].has_value()) {
+        scores_[index] = score_filters_[index](filters_[index].last_weight_statistics().average());
+        any_updated = true;
+      }
+    }
+
+    const std::size_t best = best_index();
+    auto result = std::move(results[best]);
+
+    if (any_updated && !converged() && ++updates_since_cull_ >= cull_interval_) {
+      cull();
+      updates_since_cull_ = 0;
+    }
+
+    return result;
+  }
+
+ private:
+  /// Returns the index of the best-scoring filter.
+  [[nodiscard]] std::size_t best_index() const {
+    const auto it = std::max_element(scores_.begin(), scores_.end());
+    return static_cast<std::size_t>(std::distance(scores_.begin(), it));
+  }
+
+  /// Drops the lower-scoring half of the surviving filters.
+  void cull() {
+    const std::size_t keep = (filters_.size() + 1) / 2;
+    auto order = std::vector<std::size_t>(filters_.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::sort(order.begin(), order.end(), [this](std::size_t lhs, std::size_t rhs) {
+      return scores_[lhs] > scores_[rhs];
+    });
+    order.resize(keep);
+    std::sort(order.begin(), order.end());
+
+    auto survivors = std::vector<Filter>{};
+    auto survivor_score_filters = std::vector<ExponentialFilter>{};
+    auto survivor_scores = std::vector<double>{};
+    survivors.reserve(keep);
+    survivor_score_filters.reserve(keep);
+    survivor_scores.reserve(keep);
+    for (const std::size_t index : order) {
+      survivors.push_back(std::move(filters_[index]));
+      survivor_score_filters.push_back(score_filters_[index]);
+      survivor_scores.push_back(scores_[index]);
+    }
+    filters_ = std::move(survivors);
+    score_filters_ = std::move(survivor_score_filters);
+    scores_ = std::move(survivor_scores);
+  }
+
+  std::vector<Filter> filters_;                    ///< Surviving member filters.
+  std::vector<ExponentialFilter> score_filters_;   ///< Per-filter score smoothers.
+  std::vector<double> scores_;                     ///< Smoothed per-filter scores.
+  std::size_t cull_interval_;                      ///< Updates between culling rounds.
+  std::size_t updates_since_cull_{0};              ///< Updates since the last culling round.
+  ThreadPool pool_;                                ///< Workers running the member filters.
+};
+
+}  // namespace beluga
+
+#endif
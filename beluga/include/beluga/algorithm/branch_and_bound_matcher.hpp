@@ -0,0 +1,308 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ALGORITHM_BRANCH_AND_BOUND_MATCHER_HPP
+#define BELUGA_ALGORITHM_BRANCH_AND_BOUND_MATCHER_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/span.hpp>
+#include <range/v3/view/transform.hpp>
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include <Eigen/Core>
+
+/**
+ * \file
+ * \brief Implementation of a branch-and-bound scan matcher for global relocalization.
+ */
+
+namespace beluga {
+
+/// Parameters used to construct a BranchAndBoundScanMatcher instance.
+struct BranchAndBoundSearchParam {
+  /// Half-extent of the rotational search window, in radians.
+  /**
+   * The default covers the full circle, as appropriate for global relocalization.
+   */
+  double angular_search_window = Sophus::Constants<double>::pi();
+  /// Number of coarse-to-fine halvings of the translational search.
+  /**
+   * The search starts at macro-cells of `2^depth` grid cells on a side. Each
+   * extra level doubles the coarse stride (quartering the number of root
+   * nodes) and adds one byte-per-cell score grid to the precomputed state.
+   */
+  std::size_t depth = 6UL;
+  /// Maximum number of pose candidates to return.
+  std::size_t max_candidates = 5UL;
+  /// Minimum fraction of scan points that must land on occupied cells for a candidate.
+  double min_score = 0.5;
+  /// Minimum translational separation between returned candidates, in meters.
+  double min_candidate_separation = 0.5;
+};
+
+/// Pose candidate produced by a branch-and-bound scan match.
+struct ScanMatchCandidate {
+  /// Candidate pose in the map frame, discretized to the grid resolution.
+  Sophus::SE2d pose;
+  /// Fraction of scan points landing on occupied cells at this pose, in [0, 1].
+  double score;
+};
+
+/// Branch-and-bound scan matcher over a multi-resolution occupancy pyramid.
+/**
+ * Exhaustively searches the full map for poses from which the given scan best
+ * matches the occupancy grid, in the spirit of the real-time correlative scan
+ * matching used by Cartographer \cite hess2016cartographer . Candidate scores
+ * count the fraction of scan endpoints landing on occupied cells; coarse
+ * search nodes are scored against sliding-window-maximum grids, so a node's
+ * score is an upper bound on every pose it covers and whole regions are
+ * discarded without evaluating them. The result is deterministic, unlike a
+ * sampling-based global search, and narrows the pose hypothesis space to a
+ * handful of candidates a particle filter can refine.
+ *
+ * Note that the aligned macro-cells of `beluga::OccupancyPyramid` do not
+ * provide admissible bounds for translated lookups, so the matcher precomputes
+ * its own sliding-window levels, one byte-per-cell grid per depth level.
+ *
+ * \tparam OccupancyGrid Type representing an occupancy grid.
+ *  It must satisfy \ref OccupancyGrid2Page.
+ */
+template <class OccupancyGrid>
+class BranchAndBoundScanMatcher {
+ public:
+  /// Constructs a matcher over the given grid, precomputing the score pyramid.
+  /**
+   * \param grid Occupancy grid representing the static map.
+   * \param params Parameters to configure the search.
+   *  See beluga::BranchAndBoundSearchParam for details.
+   */
+  explicit BranchAndBoundScanMatcher(OccupancyGrid grid, const BranchAndBoundSearchParam& params = {})
+      : grid_{std::move(grid)},
+        params_{params},
+        width_{static_cast<int>(grid_.width())},
+        height_{static_cast<int>(grid_.height())} {
+    auto base = grid_.obstacle_data() |
+                ranges::views::transform([](bool occupied) { return static_cast<std::uint8_t>(occupied); }) |
+                ranges::to<std::vector>;
+    levels_.push_back(std::move(base));
+    // Level l holds, at each cell, the maximum of the base occupancy over the
+    // window of 2^l cells extending towards positive x and y. Each level
+    // follows from the previous one by taking the maximum of two copies
+    // shifted by half the window, so construction is linear per level.
+    for (std::size_t level = 1; level <= params_.depth; ++level) {
+      const int shift = 1 << (level - 1);
+      const auto& previous = levels_.back();
+      auto next = previous;
+      for (int yi = 0; yi < height_; ++yi) {
+        for (int xi = 0; xi < width_; ++xi) {
+          const int x_shifted = std::min(xi + shift, width_ - 1);
+          const int y_shifted = std::min(yi + shift, height_ - 1);
+          next[index(xi, yi)] = std::max(
+              std::max(previous[index(xi, yi)], previous[index(x_shifted, yi)]),
+              std::max(previous[index(xi, y_shifted)], previous[index(x_shifted, y_shifted)]));
+        }
+      }
+      levels_.push_back(std::move(next));
+    }
+  }
+
+  /// Searches the full map for the poses that best explain a scan.
+  /**
+   * \param points 2D lidar hit points in the reference frame of the searched pose
+   *  (see e.g. LikelihoodFieldModel::operator()() for the expected frame).
+   * \return Up to `max_candidates` pose candidates with score at least
+   *  `min_score`, sorted by decreasing score and separated by at least
+   *  `min_candidate_separation`. Empty if no pose clears the score threshold.
+   */
+  [[nodiscard]] std::vector<ScanMatchCandidate> match(ranges::span<const std::pair<double, double>> points) const {
+    auto candidates = std::vector<ScanMatchCandidate>{};
+    const auto point_count = static_cast<std::size_t>(points.size());
+    if (point_count == 0 || width_ == 0 || height_ == 0) {
+      return candidates;
+    }
+
+    const double resolution = grid_.resolution();
+    double max_range = 0.;
+    for (const auto& [px, py] : points) {
+      max_range = std::max(max_range, std::hypot(px, py));
+    }
+    if (max_range <= 0.) {
+      return candidates;
+    }
+    // Angular step such that the farthest point moves at most one cell between
+    // consecutive angles, as in Cartographer's real-time correlative matcher.
+    const double angular_step =
+        std::acos(std::clamp(1. - resolution * resolution / (2. * max_range * max_range), -1., 1.));
+    const auto angular_steps = static_cast<std::ptrdiff_t>(std::ceil(params_.angular_search_window / angular_step));
+
+    auto cells = std::vector<Eigen::Vector2i>{};
+    cells.reserve(point_count);
+    for (std::ptrdiff_t step = -angular_steps; step <= angular_steps; ++step) {
+      const double theta = static_cast<double>(step) * angular_step;
+      const auto rotation = Sophus::SO2d{theta};
+      cells.clear();
+      for (const auto& [px, py] : points) {
+        const Eigen::Vector2d point = rotation * Eigen::Vector2d{px, py};
+        cells.emplace_back(
+            static_cast<int>(std::floor(point.x() / resolution)), static_cast<int>(std::floor(point.y() / resolution)));
+      }
+      match_translations(theta, cells, point_count, candidates);
+    }
+    return candidates;
+  }
+
+ private:
+  /// Search node covering translations in `[tx, tx + 2^level) x [ty, ty + 2^level)`.
+  struct Node {
+    int tx;
+    int ty;
+    std::size_t level;
+    std::size_t hits;
+  };
+
+  [[nodiscard]] std::size_t index(int xi, int yi) const {
+    return static_cast<std::size_t>(yi) * static_cast<std::size_t>(width_) + static_cast<std::size_t>(xi);
+  }
+
+  /// Counts the scan points landing on occupied cells of the given level at a translation.
+  [[nodiscard]] std::size_t hits(std::size_t level, const std::vector<Eigen::Vector2i>& cells, int tx, int ty) const {
+    const auto& data = levels_[level];
+    std::size_t count = 0;
+    for (const auto& cell : cells) {
+      const int xi = cell.x() + tx;
+      const int yi = cell.y() + ty;
+      if (xi >= 0 && xi < width_ && yi >= 0 && yi < height_) {
+        count += data[index(xi, yi)];
+      }
+    }
+    return count;
+  }
+
+  /// Runs the translational branch-and-bound search for one fixed rotation.
+  void match_translations(
+      double theta,
+      const std::vector<Eigen::Vector2i>& cells,
+      std::size_t point_count,
+      std::vector<ScanMatchCandidate>& candidates) const {
+    const auto prune_threshold = [&]() {
+      const auto floor_hits =
+          static_cast<std::size_t>(std::ceil(params_.min_score * static_cast<double>(point_count)));
+      return candidates.size() < params_.max_candidates
+                 ? floor_hits
+                 : std::max(
+                       floor_hits,
+                       static_cast<std::size_t>(candidates.back().score * static_cast<double>(point_count)) + 1);
+    };
+
+    const std::size_t root_level = levels_.size() - 1;
+    const int root_stride = 1 << root_level;
+    auto stack = std::vector<Node>{};
+    for (int ty = 0; ty < height_; ty += root_stride) {
+      for (int tx = 0; tx < width_; tx += root_stride) {
+        const auto bound = hits(root_level, cells, tx, ty);
+        if (bound >= prune_threshold()) {
+          stack.push_back(Node{tx, ty, root_level, bound});
+        }
+      }
+    }
+    // Depth-first with best children expanded last (and thus popped first), so
+    // a good leaf is found early and tightens the bound for the whole search.
+    std::sort(stack.begin(), stack.end(), [](const Node& lhs, const Node& rhs) { return lhs.hits < rhs.hits; });
+
+    while (!stack.empty()) {
+      const auto node = stack.back();
+      stack.pop_back();
+      if (node.hits < prune_threshold()) {
+        continue;
+      }
+      if (node.level == 0) {
+        // Only poses over known free space are admissible robot positions.
+        if (!grid_.contains(node.tx, node.ty) || !grid_.free_at(grid_.index_at(node.tx, node.ty))) {
+          continue;
+        }
+        const auto translation = Eigen::Vector2d{
+            (static_cast<double>(node.tx) + 0.5) * grid_.resolution(),
+            (static_cast<double>(node.ty) + 0.5) * grid_.resolution()};
+        insert_candidate(
+            candidates,
+            ScanMatchCandidate{
+                grid_.origin() * Sophus::SE2d{Sophus::SO2d{theta}, translation},
+                static_cast<double>(node.hits) / static_cast<double>(point_count)});
+        continue;
+      }
+      const int child_stride = 1 << (node.level - 1);
+      Node children[4];  // NOLINT(modernize-avoid-c-arrays)
+      std::size_t child_count = 0;
+      for (const auto& [dx, dy] :
+           {std::pair{0, 0}, std::pair{child_stride, 0}, std::pair{0, child_stride},
+            std::pair{child_stride, child_stride}}) {
+        const int tx = node.tx + dx;
+        const int ty = node.ty + dy;
+        if (tx >= width_ || ty >= height_) {
+          continue;
+        }
+        const auto bound = hits(node.level - 1, cells, tx, ty);
+        if (bound >= prune_threshold()) {
+          children[child_count++] = Node{tx, ty, node.level - 1, bound};
+        }
+      }
+      std::sort(children, children + child_count, [](const Node& lhs, const Node& rhs) { return lhs.hits < rhs.hits; });
+      for (std::size_t child = 0; child < child_count; ++child) {
+        stack.push_back(children[child]);
+      }
+    }
+  }
+
+  /// Inserts a candidate keeping the list sorted, bounded and spatially diverse.
+  void insert_candidate(std::vector<ScanMatchCandidate>& candidates, ScanMatchCandidate candidate) const {
+    for (auto& existing : candidates) {
+      const double separation = (existing.pose.translation() - candidate.pose.translation()).norm();
+      if (separation < params_.min_candidate_separation) {
+        // Keep the best representative of the neighborhood.
+        if (candidate.score > existing.score) {
+          existing = std::move(candidate);
+          std::sort(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+            return lhs.score > rhs.score;
+          });
+        }
+        return;
+      }
+    }
+    candidates.push_back(std::move(candidate));
+    std::sort(
+        candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) { return lhs.score > rhs.score; });
+    if (candidates.size() > params_.max_candidates) {
+      candidates.pop_back();
+    }
+  }
+
+  OccupancyGrid grid_;
+  BranchAndBoundSearchParam params_;
+  int width_;
+  int height_;
+  /// Sliding-window-maximum occupancy levels; level `l` uses a window of `2^l` cells.
+  std::vector<std::vector<std::uint8_t>> levels_;
+};
+
+}  // namespace beluga
+
+#endif
@@ -0,0 +1,85 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ALGORITHM_COMPENSATED_SUM_HPP
+#define BELUGA_ALGORITHM_COMPENSATED_SUM_HPP
+
+#include <cmath>
+
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+
+/**
+ * \file
+ * \brief Implementation of compensated floating point summation.
+ */
+
+namespace beluga {
+
+/// Neumaier-compensated floating point accumulator.
+/**
+ * Carries the rounding error of every addition in a separate compensation term, so
+ * the accumulated error stays independent of the number of addends instead of
+ * growing with it (Neumaier's improved Kahan summation, \cite neumaier1974summation).
+ * Weight accumulations use it so reduced-precision weight representations (see
+ * `beluga::WeightF`) lose precision only in per-particle storage, never in the
+ * normalization factor or the effective sample size derived from the column.
+ *
+ * \tparam T Floating point type of the accumulator.
+ */
+template <class T = double>
+class CompensatedSum {
+ public:
+  /// Adds a value to the accumulator, tracking the rounding error of the addition.
+  CompensatedSum& operator+=(T value) noexcept {
+    const T naive = sum_ + value;
+    if (std::abs(sum_) >= std::abs(value)) {
+      compensation_ += (sum_ - naive) + value;
+    } else {
+      compensation_ += (value - naive) + sum_;
+    }
+    sum_ = naive;
+    return *this;
+  }
+
+  /// Returns the compensated sum of all values added so far.
+  [[nodiscard]] T value() const noexcept { return sum_ + compensation_; }
+
+ private:
+  T sum_{};
+  T compensation_{};
+};
+
+/// Accumulates a range of values into a `double` with Neumaier compensation.
+/**
+ * Drop-in replacement for `ranges::accumulate(range, 0.0)` where the addends may be
+ * many, small and stored in reduced precision, as weight columns are.
+ *
+ * \tparam Range An [input range](https://en.cppreference.com/w/cpp/ranges/input_range)
+ *  of values convertible to `double`.
+ * \param range The range of values to accumulate.
+ */
+template <class Range>
+[[nodiscard]] double compensated_sum(Range&& range) {
+  static_assert(ranges::input_range<Range>);
+  auto sum = CompensatedSum<double>{};
+  for (auto&& value : range) {
+    sum += static_cast<double>(value);
+  }
+  return sum.value();
+}
+
+}  // namespace beluga
+
+#endif
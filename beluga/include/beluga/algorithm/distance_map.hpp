@@ -15,12 +15,21 @@
 #ifndef BELUGA_ALGORITHM_DISTANCE_MAP_HPP
 #define BELUGA_ALGORITHM_DISTANCE_MAP_HPP
 
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <limits>
 #include <queue>
 #include <vector>
 
+#include <beluga/sensor/data/obstacle_bitmap.hpp>
+#include <beluga/utility/thread_pool.hpp>
+
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/primitives.hpp>
+#include <range/v3/view/common.hpp>
 #include <range/v3/view/enumerate.hpp>
+#include <range/v3/view/iota.hpp>
 
 /**
  * \file
@@ -92,6 +101,359 @@ auto nearest_obstacle_distance_map(
   return distance_map;
 }
 
+/// Maintains a nearest-obstacle distance map under incremental obstacle updates.
+/**
+ * Holds the same result as beluga::nearest_obstacle_distance_map plus the index of
+ * the nearest obstacle per cell, and keeps both consistent as single obstacles are
+ * inserted or removed: updates propagate only through the wavefront of cells whose
+ * nearest obstacle actually changes (after Lau, Sprunk and Burgard, "Efficient
+ * grid-based spatial representations for robot navigation in dynamic environments",
+ * Robotics and Autonomous Systems, 2013). Flipping a few cells on a large map thus
+ * costs proportionally to the affected region instead of a full O(n) rebuild.
+ *
+ * Unlike the batch function, cells that cannot reach any obstacle hold
+ * `unreachable()` rather than a default-constructed distance.
+ *
+ * \tparam DistanceFunction A callable type, its prototype must be
+ *  (std::size_t, std::size_t) -> DistanceType. DistanceType must be an scalar type.
+ * \tparam NeighborsFunction A callable type, its prototype must be
+ *  (std::size_t) -> NeighborsT, where NeighborsT is a range with value type std::size_t.
+ */
+template <class DistanceFunction, class NeighborsFunction>
+class IncrementalDistanceMap {
+ public:
+  /// Scalar distance type, as returned by the distance function.
+  using distance_type = std::invoke_result_t<DistanceFunction, std::size_t, std::size_t>;
+
+  /// Nearest obstacle index held by cells that cannot reach any obstacle.
+  static constexpr std::size_t kNoObstacle = std::numeric_limits<std::size_t>::max();
+
+  /// Constructs the map from an initial obstacle configuration.
+  /**
+   * \param obstacle_map A range of `bool` values, where true marks an obstacle.
+   * \param distance_function Given the indexes of two cells i and j, returns the
+   *  distance between them.
+   * \param neighbors_function Given the index of one cell, returns the indexes of
+   *  its neighbor cells.
+   */
+  template <class Range>
+  IncrementalDistanceMap(Range&& obstacle_map, DistanceFunction distance_function, NeighborsFunction neighbors_function)
+      : distance_function_(std::move(distance_function)), neighbors_function_(std::move(neighbors_function)) {
+    const std::size_t size = ranges::size(obstacle_map);
+    distances_.assign(size, unreachable());
+    nearest_.assign(size, kNoObstacle);
+    is_obstacle_.assign(size, false);
+    auto queue = queue_type{};
+    for (auto [index, is_obstacle] : ranges::views::enumerate(obstacle_map)) {
+      if (is_obstacle) {
+        is_obstacle_[index] = true;
+        distances_[index] = distance_type{};
+        nearest_[index] = index;
+        queue.push(Entry{index, index, distance_type{}});
+      }
+    }
+    propagate(queue);
+  }
+
+  /// Gets the distance of each cell to its nearest obstacle.
+  [[nodiscard]] const std::vector<distance_type>& distances() const { return distances_; }
+
+  /// Gets the index of the nearest obstacle to a cell, or `kNoObstacle` if none is reachable.
+  [[nodiscard]] std::size_t nearest_obstacle(std::size_t index) const { return nearest_[index]; }
+
+  /// Distance held by cells that cannot reach any obstacle.
+  [[nodiscard]] static constexpr distance_type unreachable() { return std::numeric_limits<distance_type>::max(); }
+
+  /// Inserts an obstacle, lowering distances within the affected wavefront.
+  /**
+   * \param index Cell index of the new obstacle. No-op if already an obstacle.
+   */
+  void insert_obstacle(std::size_t index) {
+    assert(index < distances_.size());
+    if (is_obstacle_[index]) {
+      return;
+    }
+    is_obstacle_[index] = true;
+    distances_[index] = distance_type{};
+    nearest_[index] = index;
+    auto queue = queue_type{};
+    queue.push(Entry{index, index, distance_type{}});
+    propagate(queue);
+  }
+
+  /// Removes an obstacle, re-settling the cells it was nearest to.
+  /**
+   * The region of cells whose nearest obstacle was the removed one is cleared and
+   * then re-covered from the surrounding cells that kept a valid nearest obstacle.
+   *
+   * \param index Cell index of the removed obstacle. No-op if not an obstacle.
+   */
+  void remove_obstacle(std::size_t index) {
+    assert(index < distances_.size());
+    if (!is_obstacle_[index]) {
+      return;
+    }
+    is_obstacle_[index] = false;
+    auto queue = queue_type{};
+    auto frontier = std::vector<std::size_t>{index};
+    distances_[index] = unreachable();
+    nearest_[index] = kNoObstacle;
+    while (!frontier.empty()) {
+      const std::size_t cleared = frontier.back();
+      frontier.pop_back();
+      for (const std::size_t neighbor : neighbors_function_(cleared)) {
+        if (nearest_[neighbor] == index) {
+          distances_[neighbor] = unreachable();
+          nearest_[neighbor] = kNoObstacle;
+          frontier.push_back(neighbor);
+        } else if (nearest_[neighbor] != kNoObstacle) {
+          // Boundary cell still covered by another obstacle; re-settle from it.
+          queue.push(Entry{neighbor, nearest_[neighbor], distances_[neighbor]});
+        }
+      }
+    }
+    propagate(queue);
+  }
+
+ private:
+  struct Entry {
+    std::size_t index;
+    std::size_t nearest_obstacle_index;
+    distance_type distance;
+  };
+
+  struct CompareByDistance {
+    bool operator()(const Entry& first, const Entry& second) const { return first.distance > second.distance; }
+  };
+
+  using queue_type = std::priority_queue<Entry, std::vector<Entry>, CompareByDistance>;
+
+  /// Propagates queued lower distances until the wavefront settles.
+  void propagate(queue_type& queue) {
+    while (!queue.empty()) {
+      const auto parent = queue.top();
+      queue.pop();
+      if (parent.distance > distances_[parent.index] || nearest_[parent.index] != parent.nearest_obstacle_index) {
+        continue;  // stale entry, a closer obstacle got there first
+      }
+      for (const std::size_t neighbor : neighbors_function_(parent.index)) {
+        const auto candidate = distance_function_(parent.nearest_obstacle_index, neighbor);
+        if (candidate < distances_[neighbor]) {
+          distances_[neighbor] = candidate;
+          nearest_[neighbor] = parent.nearest_obstacle_index;
+          queue.push(Entry{neighbor, parent.nearest_obstacle_index, candidate});
+        }
+      }
+    }
+  }
+
+  std::vector<distance_type> distances_;
+  std::vector<std::size_t> nearest_;
+  std::vector<bool> is_obstacle_;
+  DistanceFunction distance_function_;
+  NeighborsFunction neighbors_function_;
+};
+
+/// Deduction guide to construct from an obstacle range and callables.
+template <class Range, class DistanceFunction, class NeighborsFunction>
+IncrementalDistanceMap(Range&&, DistanceFunction, NeighborsFunction)
+    -> IncrementalDistanceMap<DistanceFunction, NeighborsFunction>;
+
+namespace detail {
+
+/// Squared cell distance assigned to cells that cannot reach any obstacle.
+/**
+ * A large finite value instead of infinity, so the envelope intersections of the
+ * distance transform below stay finite and well ordered.
+ */
+inline constexpr double kUnreachableSquaredDistance = 1e20;
+
+/// Computes the exact 1D squared distance transform of a sampled function.
+/**
+ * Lower envelope algorithm by Felzenszwalb and Huttenlocher
+ * ("Distance Transforms of Sampled Functions", Theory of Computing, 2012).
+ * Runs in O(n) time.
+ *
+ * \param input Sampled function values. Must not alias `output`.
+ * \param count Number of samples to transform.
+ * \param output Resulting squared distances. Must hold at least `count` elements.
+ * \param parabolas Scratch buffer for envelope parabola indices, at least `count` elements.
+ * \param boundaries Scratch buffer for envelope intersections, at least `count + 1` elements.
+ */
+inline void squared_distance_transform_1d(
+    const std::vector<double>& input,
+    std::size_t count,
+    std::vector<double>& output,
+    std::vector<std::size_t>& parabolas,
+    std::vector<double>& boundaries) {
+  constexpr double kInfinity = std::numeric_limits<double>::infinity();
+  const auto intersection = [&input](std::size_t p, std::size_t q) {
+    const auto fp = input[p] + static_cast<double>(p) * static_cast<double>(p);
+    const auto fq = input[q] + static_cast<double>(q) * static_cast<double>(q);
+    return (fq - fp) / (2.0 * (static_cast<double>(q) - static_cast<double>(p)));
+  };
+
+  std::size_t rightmost = 0;
+  parabolas[0] = 0;
+  boundaries[0] = -kInfinity;
+  boundaries[1] = kInfinity;
+  for (std::size_t q = 1; q < count; ++q) {
+    auto s = intersection(parabolas[rightmost], q);
+    while (s <= boundaries[rightmost]) {
+      --rightmost;
+      s = intersection(parabolas[rightmost], q);
+    }
+    ++rightmost;
+    parabolas[rightmost] = q;
+    boundaries[rightmost] = s;
+    boundaries[rightmost + 1] = kInfinity;
+  }
+
+  std::size_t k = 0;
+  for (std::size_t q = 0; q < count; ++q) {
+    while (boundaries[k + 1] < static_cast<double>(q)) {
+      ++k;
+    }
+    const auto offset = static_cast<double>(q) - static_cast<double>(parabolas[k]);
+    output[q] = offset * offset + input[parabolas[k]];
+  }
+}
+
+/// Runs the column and row passes of the 2D Euclidean distance transform in place.
+/**
+ * \param policy The execution policy to use.
+ * \param distances Squared cell distances seeded with 0 at obstacles and
+ *  `kUnreachableSquaredDistance` elsewhere; holds the result on return.
+ * \param width Width of the map, in cells. Must evenly divide the map size.
+ * \param resolution Size of a map cell, in meters.
+ */
+template <class ExecutionPolicy>
+void euclidean_distance_transform_passes(
+    ExecutionPolicy&& policy,
+    std::vector<double>& distances,
+    std::size_t width,
+    double resolution) {
+  const std::size_t height = distances.size() / width;
+
+  // Column pass: 1D transforms along the y-axis over gathered strided columns.
+  auto columns = ranges::views::iota(std::size_t{0}, width) | ranges::views::common;
+  beluga::execution::for_each(
+      policy, std::begin(columns), std::end(columns), [&distances, width, height](std::size_t column) {
+        auto input = std::vector<double>(height);
+        auto output = std::vector<double>(height);
+        auto parabolas = std::vector<std::size_t>(height);
+        auto boundaries = std::vector<double>(height + 1);
+        for (std::size_t yi = 0; yi < height; ++yi) {
+          input[yi] = distances[yi * width + column];
+        }
+        detail::squared_distance_transform_1d(input, height, output, parabolas, boundaries);
+        for (std::size_t yi = 0; yi < height; ++yi) {
+          distances[yi * width + column] = output[yi];
+        }
+      });
+
+  // Row pass: 1D transforms along the x-axis over contiguous rows, converting
+  // the result from squared cells to squared meters on the way out.
+  const double squared_resolution = resolution * resolution;
+  auto rows = ranges::views::iota(std::size_t{0}, height) | ranges::views::common;
+  beluga::execution::for_each(
+      policy, std::begin(rows), std::end(rows), [&distances, width, squared_resolution](std::size_t row) {
+        auto input = std::vector<double>(width);
+        auto output = std::vector<double>(width);
+        auto parabolas = std::vector<std::size_t>(width);
+        auto boundaries = std::vector<double>(width + 1);
+        for (std::size_t xi = 0; xi < width; ++xi) {
+          input[xi] = distances[row * width + xi];
+        }
+        detail::squared_distance_transform_1d(input, width, output, parabolas, boundaries);
+        for (std::size_t xi = 0; xi < width; ++xi) {
+          distances[row * width + xi] = output[xi] * squared_resolution;
+        }
+      });
+}
+
+}  // namespace detail
+
+/// Returns a map of squared Euclidean distances to the nearest obstacle in a 2D linear grid.
+/**
+ * Exact two-pass Euclidean distance transform: a 1D transform along each column
+ * followed by a 1D transform along each row, after Felzenszwalb and Huttenlocher
+ * ("Distance Transforms of Sampled Functions", Theory of Computing, 2012).
+ * The algorithm uses O(N) time where `N = ranges::size(obstacle_map)`, and the
+ * row and column passes fan out across the given execution policy.
+ *
+ * \tparam ExecutionPolicy An [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t).
+ * \tparam Range A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range)
+ *  of `bool` values in row-major order, where true marks an obstacle.
+ * \param policy The execution policy to use.
+ * \param obstacle_map A map that represents obstacles in an environment.
+ * \param width Width of the map, in cells. Must evenly divide the map size.
+ * \param resolution Size of a map cell, in meters.
+ * \return A map where each cell value is the squared distance to the nearest obstacle,
+ *  in squared meters. Cells with no obstacle anywhere in the map are assigned a very
+ *  large value; callers are expected to clamp distances to their range of interest.
+ */
+template <
+    class ExecutionPolicy,
+    class Range,
+    std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+    std::enable_if_t<ranges::range<Range>, int> = 0>
+auto euclidean_distance_transform(
+    ExecutionPolicy&& policy,
+    Range&& obstacle_map,
+    std::size_t width,
+    double resolution = 1.) {
+  const std::size_t size = ranges::size(obstacle_map);
+  auto distances = std::vector<double>(size);
+  if (size == 0) {
+    return distances;
+  }
+  assert(width > 0);
+  assert(size % width == 0);
+  const std::size_t height = size / width;
+
+  for (auto [index, is_obstacle] : ranges::views::enumerate(obstacle_map)) {
+    distances[index] = is_obstacle ? 0.0 : detail::kUnreachableSquaredDistance;
+  }
+
+  detail::euclidean_distance_transform_passes(policy, distances, width, resolution);
+  return distances;
+}
+
+/// Overload with a default execution policy.
+template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+auto euclidean_distance_transform(Range&& obstacle_map, std::size_t width, double resolution = 1.) {
+  return euclidean_distance_transform(std::execution::seq, std::forward<Range>(obstacle_map), width, resolution);
+}
+
+/// Overload over a bit-packed obstacle bitmap.
+/**
+ * Equivalent to the range overload over the unpacked occupancy values, but the
+ * seeding pass iterates at word granularity: empty words cover 64 obstacle-free
+ * cells per load, so on large, mostly free maps the obstacle scan touches an
+ * eighth of the memory of a byte-per-cell pass.
+ *
+ * \param policy The execution policy to use.
+ * \param obstacle_map Bit-packed obstacle bitmap (see
+ *  `BaseOccupancyGrid2::packed_obstacle_data()`).
+ * \param resolution Size of a map cell, in meters.
+ */
+template <class ExecutionPolicy, std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0>
+auto euclidean_distance_transform(ExecutionPolicy&& policy, const ObstacleBitmap2& obstacle_map, double resolution = 1.) {
+  auto distances = std::vector<double>(obstacle_map.size(), detail::kUnreachableSquaredDistance);
+  if (distances.empty()) {
+    return distances;
+  }
+  obstacle_map.for_each_set([&distances](std::size_t index) { distances[index] = 0.0; });
+  detail::euclidean_distance_transform_passes(policy, distances, obstacle_map.width(), resolution);
+  return distances;
+}
+
+/// Overload over a bit-packed obstacle bitmap with a default execution policy.
+inline auto euclidean_distance_transform(const ObstacleBitmap2& obstacle_map, double resolution = 1.) {
+  return euclidean_distance_transform(std::execution::seq, obstacle_map, resolution);
+}
+
 }  // namespace beluga
 
 #endif
@@ -15,11 +15,17 @@
 #ifndef BELUGA_ALGORITHM_EFFECTIVE_SAMPLE_SIZE_HPP
 #define BELUGA_ALGORITHM_EFFECTIVE_SAMPLE_SIZE_HPP
 
+#include <cstddef>
+#include <execution>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include <beluga/algorithm/compensated_sum.hpp>
+#include <beluga/algorithm/weight_statistics.hpp>
 #include <beluga/type_traits/particle_traits.hpp>
 #include <beluga/views/particles.hpp>
 
-#include <range/v3/numeric/accumulate.hpp>
-
 /**
  * \file
  * \brief Implementation of an algorithm to calculate the effective sample size (ESS).
@@ -39,23 +45,27 @@ namespace beluga {
  * The algorithm is based on \cite grisetti2007selectiveresampling, according to the description given in
  * \cite tiacheng2015resamplingmethods.
  *
+ * Both accumulations use Neumaier compensation, so the result keeps full accuracy
+ * over reduced-precision weight columns (see `beluga::WeightF`).
+ *
  * \tparam Range A [forward range](https://en.cppreference.com/w/cpp/ranges/forward_range).
  * \param range The range of weights.
  */
 template <class Range, std::enable_if_t<!is_particle_range_v<Range>, int> = 0>
 auto effective_sample_size(Range&& range) {
-  const auto total_weight = ranges::accumulate(range, 0.0);
+  const auto total_weight = beluga::compensated_sum(range);
 
   if (total_weight == 0.0) {
     return 0.0;
   }
 
-  auto normalize_and_square = [total_weight](auto weight) {
-    const auto normalized_weight = weight / total_weight;
-    return normalized_weight * normalized_weight;
-  };
+  auto squared_sum = CompensatedSum<double>{};
+  for (auto&& weight : range) {
+    const auto normalized_weight = static_cast<double>(weight) / total_weight;
+    squared_sum += normalized_weight * normalized_weight;
+  }
 
-  return 1.0 / ranges::accumulate(range, 0.0, std::plus<>{}, std::move(normalize_and_square));
+  return 1.0 / squared_sum.value();
 }
 
 /// Overload for particle ranges.
@@ -64,6 +74,76 @@ auto effective_sample_size(Range&& range) {
   return effective_sample_size(range | beluga::views::weights);
 }
 
+/// Overload for precomputed weight statistics.
+/**
+ * Avoids traversing the weights again when a `beluga::WeightStatistics` instance
+ * was already computed during the same filter update. The result is independent of
+ * whether the statistics were taken before or after weight normalization.
+ */
+constexpr double effective_sample_size(const WeightStatistics& statistics) {
+  if (statistics.squared_sum == 0.0) {
+    return 0.0;
+  }
+  return statistics.sum * statistics.sum / statistics.squared_sum;
+}
+
+/// Overload taking an execution policy.
+/**
+ * Computes the weight statistics in a single `transform_reduce` pass under the
+ * given policy (see `beluga::weight_statistics()`, which vectorizes over contiguous
+ * weight storage) and derives the ESS from them; since the result is scale
+ * invariant no separate normalization pass is needed.
+ *
+ * \param policy The execution policy to use.
+ * \param range The range of weights, or a range of particles.
+ */
+template <
+    class ExecutionPolicy,
+    class Range,
+    std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0>
+double effective_sample_size(ExecutionPolicy&& policy, Range&& range) {
+  return effective_sample_size(weight_statistics(std::forward<ExecutionPolicy>(policy), std::forward<Range>(range)));
+}
+
+/// Memoizes effective sample size queries keyed to a weight modification epoch.
+/**
+ * Several consumers query the ESS of the same particle set within one filter update
+ * (resampling policy check, diagnostics, selective resampling). Keying the cached
+ * value to an epoch the owner of the weight column bumps whenever a stage rewrites
+ * the weights (reweight, normalize, resample) collapses those queries into at most
+ * one pass per epoch.
+ */
+class EffectiveSampleSizeCache {
+ public:
+  /// Returns the ESS of the given range, reusing the cached value within one epoch.
+  /**
+   * \param policy The execution policy to use on a cache miss.
+   * \param range The range of weights, or a range of particles.
+   * \param epoch Modification epoch of the weight column backing the range.
+   */
+  template <class ExecutionPolicy, class Range>
+  double operator()(ExecutionPolicy&& policy, Range&& range, std::size_t epoch) {
+    if (!value_.has_value() || epoch != epoch_) {
+      value_ = effective_sample_size(std::forward<ExecutionPolicy>(policy), std::forward<Range>(range));
+      epoch_ = epoch;
+    }
+    return *value_;
+  }
+
+  /// Overload that uses a sequenced execution policy on cache misses.
+  template <class Range>
+  double operator()(Range&& range, std::size_t epoch) {
+    return (*this)(std::execution::seq, std::forward<Range>(range), epoch);
+  }
+
+  /// Drops the cached value, forcing the next query to recompute.
+  void invalidate() { value_.reset(); }
+
+ private:
+  std::size_t epoch_ = 0;
+  std::optional<double> value_;
+};
+
 }  // namespace beluga
 
 #endif
@@ -20,12 +20,25 @@
 #include <range/v3/range/access.hpp>
 #include <range/v3/range/primitives.hpp>
 #include <range/v3/view/common.hpp>
+#include <range/v3/view/iota.hpp>
 #include <range/v3/view/repeat_n.hpp>
 #include <range/v3/view/transform.hpp>
 #include <sophus/se2.hpp>
 #include <sophus/types.hpp>
 
+#include <beluga/algorithm/se2_estimate_statistics.hpp>
+#include <beluga/algorithm/spatial_hash.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <execution>
 #include <numeric>
+#include <optional>
+#include <thread>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
 
 /**
  * \file
@@ -35,6 +48,71 @@
 
 namespace beluga {
 
+namespace detail {
+
+/// Computes the weighted mean pose from accumulated partial sums.
+template <class Scalar>
+Sophus::SE2<Scalar> mean_from_sums(const SE2EstimateStatistics<Scalar>& sums) {
+  // Compute the average of all the coefficients of the SE2 group elements and construct a new SE2 element. Notice
+  // that after averaging the complex representation of the orientation the resulting complex is not on the unit
+  // circle and needs to be renormalized.
+  const Sophus::Vector4<Scalar> mean_pose_vector = sums.weighted_pose_sum / sums.weight_sum;
+  Sophus::SE2<Scalar> estimated_pose = Eigen::Map<const Sophus::SE2<Scalar>>{mean_pose_vector.data()};
+  if (estimated_pose.so2().unit_complex().norm() < std::numeric_limits<double>::epsilon()) {
+    // Handle the case where both averages are too close to zero. Return zero yaw.
+    estimated_pose.so2() = Sophus::SO2<Scalar>{0.0};
+  } else {
+    estimated_pose.so2().normalize();
+  }
+  return estimated_pose;
+}
+
+/// Computes the weighted pose covariance from accumulated partial sums.
+template <class Scalar>
+Sophus::Matrix3<Scalar> covariance_from_sums(const SE2EstimateStatistics<Scalar>& sums) {
+  const Sophus::Vector4<Scalar> mean_pose_vector = sums.weighted_pose_sum / sums.weight_sum;
+  const Eigen::Map<const Sophus::SE2<Scalar>> mean_pose{mean_pose_vector.data()};
+
+  Sophus::Matrix3<Scalar> covariance_matrix = Sophus::Matrix3<Scalar>::Zero();
+
+  // Compute the covariance of the translation part from the accumulated outer
+  // products, E[vv^T] - mm^T, with the usual weighted sample averaging factor.
+  // See https://en.wikipedia.org/wiki/Sample_mean_and_covariance#Weighted_samples
+  const auto& mean_translation = mean_pose.translation();
+  const Scalar squared_normalized_weight_sum = sums.squared_weight_sum / (sums.weight_sum * sums.weight_sum);
+  const Sophus::Vector3<Scalar> coefficients =
+      (sums.weighted_outer_sum / sums.weight_sum -
+       Sophus::Vector3<Scalar>{
+           mean_translation.x() * mean_translation.x(),
+           mean_translation.x() * mean_translation.y(),
+           mean_translation.y() * mean_translation.y(),
+       }) /
+      (1.0 - squared_normalized_weight_sum);
+  covariance_matrix.template topLeftCorner<2, 2>() << coefficients(0), coefficients(1), coefficients(1),
+      coefficients(2);
+
+  // Compute the orientation variance from the norm of the averaged (non-unit) complex.
+  const Scalar complex_mean_norm = mean_pose.so2().unit_complex().norm();
+  if (complex_mean_norm < std::numeric_limits<double>::epsilon()) {
+    // Handle the case where both averages are too close to zero.
+    // Return infinite variance.
+    covariance_matrix.coeffRef(2, 2) = std::numeric_limits<double>::infinity();
+  } else {
+    // See circular standard deviation in
+    // https://en.wikipedia.org/wiki/Directional_statistics#Dispersion.
+    covariance_matrix.coeffRef(2, 2) = -2.0 * std::log(complex_mean_norm);
+  }
+  return covariance_matrix;
+}
+
+/// Computes the weighted pose mean and covariance from accumulated partial sums.
+template <class Scalar>
+std::pair<Sophus::SE2<Scalar>, Sophus::Matrix3<Scalar>> estimate_from_sums(const SE2EstimateStatistics<Scalar>& sums) {
+  return std::pair{mean_from_sums(sums), covariance_from_sums(sums)};
+}
+
+}  // namespace detail
+
 /// Calculates the covariance of a range given its mean and the weights of each element.
 /**
  * \tparam Range A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range) type whose
@@ -102,13 +180,81 @@ Sophus::Matrix2<Scalar> calculate_covariance(Range&& range, const Sophus::Vector
       mean);
 }
 
+/// Accumulates the sufficient statistics for an SE(2) pose estimate.
+/**
+ * All reductions the estimate needs are accumulated in a single pass over the
+ * particle set, and the pass is chunked across cores for large random access
+ * ranges. The result can be finished into a mean and covariance with
+ * `beluga::estimate()` or wrapped in a `beluga::LazyEstimate`.
+ *
+ * \tparam Poses A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range) type whose
+ *  value type is `Sophus::SE2<Scalar>`.
+ * \tparam Weights A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range) type whose
+ *  value type is `Scalar`.
+ * \tparam Pose The pose value type of the given range.
+ * \tparam Scalar A scalar type, e.g. double or float.
+ * \param poses Poses of the particles.
+ * \param weights Weights of the particles.
+ * \return The accumulated sufficient statistics.
+ */
+template <
+    class Poses,
+    class Weights,
+    class Pose = ranges::range_value_t<Poses>,
+    class Scalar = typename Pose::Scalar,
+    typename = std::enable_if_t<std::is_same_v<Pose, typename Sophus::SE2<Scalar>>>>
+SE2EstimateStatistics<Scalar> se2_estimate_statistics(Poses&& poses, Weights&& weights) {
+  auto poses_view = poses | ranges::views::common;
+  auto weights_view = weights | ranges::views::common;
+  const auto size = static_cast<std::size_t>(ranges::size(poses));
+
+  // Accumulate every reduction the estimate needs (weight sums, weighted pose
+  // coefficients, and weighted translation outer products) in a single pass,
+  // chunked across cores for large particle sets. Chunks only below this size
+  // would be dominated by scheduling overhead.
+  constexpr std::size_t kMinParticlesPerChunk = 16'384;
+  SE2EstimateStatistics<Scalar> sums;
+  [[maybe_unused]] const std::size_t num_chunks = std::clamp<std::size_t>(
+      size / kMinParticlesPerChunk, 1, std::max(1U, std::thread::hardware_concurrency()));
+  if constexpr (
+      ranges::random_access_range<decltype(poses_view)> && ranges::random_access_range<decltype(weights_view)>) {
+    auto partials = std::vector<SE2EstimateStatistics<Scalar>>(num_chunks);
+    auto chunks = ranges::views::iota(std::size_t{0}, num_chunks) | ranges::views::common;
+    const auto poses_first = std::begin(poses_view);
+    const auto weights_first = std::begin(weights_view);
+    std::for_each(std::execution::par, std::begin(chunks), std::end(chunks), [&](std::size_t chunk) {
+      const std::size_t first = chunk * size / num_chunks;
+      const std::size_t last = (chunk + 1) * size / num_chunks;
+      auto& partial = partials[chunk];
+      for (std::size_t i = first; i < last; ++i) {
+        partial.add(
+            *(poses_first + static_cast<std::ptrdiff_t>(i)),
+            static_cast<Scalar>(*(weights_first + static_cast<std::ptrdiff_t>(i))));
+      }
+    });
+    for (const auto& partial : partials) {
+      sums.merge(partial);
+    }
+  } else {
+    auto pose_it = std::begin(poses_view);
+    auto weight_it = std::begin(weights_view);
+    for (; pose_it != std::end(poses_view); ++pose_it, ++weight_it) {
+      sums.add(*pose_it, static_cast<Scalar>(*weight_it));
+    }
+  }
+
+  return sums;
+}
+
 /// Returns a pair consisting of the estimated mean pose and its covariance.
 /**
  * Given a range of poses, computes the estimated pose by averaging the translation
  * and rotation parts.
  * Computes the covariance matrix of the translation parts and the circular variance
  * of the rotation angles to create a 3x3 covariance matrix.
- * It does not take into account the particle weights.
+ *
+ * All reductions are accumulated in a single pass over the particle set, and
+ * the pass is chunked across cores for large random access ranges.
  *
  * \tparam Poses A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range) type whose
  *  value type is `Sophus::SE2<Scalar>`.
@@ -116,8 +262,8 @@ Sophus::Matrix2<Scalar> calculate_covariance(Range&& range, const Sophus::Vector
  *  value type is `Scalar`.
  * \tparam Pose The pose value type of the given range.
  * \tparam Scalar A scalar type, e.g. double or float.
- * \param poses Poses of equally weighted 2D poses.
- * \param weights Poses of equally weighted 2D poses.
+ * \param poses Poses of the particles.
+ * \param weights Weights of the particles.
  * \return The estimated pose and its 3x3 covariance matrix.
  */
 template <
@@ -127,48 +273,202 @@ template <
     class Scalar = typename Pose::Scalar,
     typename = std::enable_if_t<std::is_same_v<Pose, typename Sophus::SE2<Scalar>>>>
 std::pair<Sophus::SE2<Scalar>, Sophus::Matrix3<Scalar>> estimate(Poses&& poses, Weights&& weights) {
-  auto translation_view = poses | ranges::views::transform([](const auto& pose) { return pose.translation(); });
-  auto weights_view = weights | ranges::views::common;
-  const auto weights_sum = std::accumulate(weights_view.begin(), weights_view.end(), 0.0);
-  auto normalized_weights_view =
-      weights_view | ranges::views::transform([weights_sum](const auto& weight) { return weight / weights_sum; });
+  return detail::estimate_from_sums(
+      beluga::se2_estimate_statistics(std::forward<Poses>(poses), std::forward<Weights>(weights)));
+}
 
-  // map sophus pose 2D pose into a 4D Eigen vector. Mapping exploits that Sophus stores the 2D transform
-  // as two elements for the linear translation, and two more for the orientation (in complex number form)
-  const auto pose_to_weighted_eigen_vector = [](const auto& pose, const auto& weight) {
-    return Eigen::Map<const Sophus::Vector4<Scalar>>{pose.data()} * weight;
-  };
+/// Returns a pair consisting of the estimated mean pose and its covariance.
+/**
+ * Overload that works on previously accumulated sufficient statistics instead
+ * of traversing the particle set. Actions that already traverse the particles,
+ * such as `beluga::actions::normalize`, can fill in the statistics on the fly,
+ * making the estimate itself O(1). The result is identical to calling
+ * `beluga::estimate()` on the ranges the statistics were accumulated from.
+ *
+ * \tparam Scalar A scalar type, e.g. double or float.
+ * \param statistics Sufficient statistics accumulated over a weighted particle set.
+ * \return The estimated pose and its 3x3 covariance matrix.
+ */
+template <class Scalar>
+std::pair<Sophus::SE2<Scalar>, Sophus::Matrix3<Scalar>> estimate(const SE2EstimateStatistics<Scalar>& statistics) {
+  return detail::estimate_from_sums(statistics);
+}
 
-  // Compute the average of all the coefficients of the SE2 group elements and construct a new SE2 element. Notice
-  // that after averaging the complex representation of the orientation the resulting complex is not on the unit circle.
-  // This is expected and the value will be renormalized after having used the non-normal result to estimate the
-  // orientation autocovariance.
-  const Sophus::Vector4<Scalar> mean_pose_vector = std::transform_reduce(
-      poses.begin(), poses.end(), normalized_weights_view.begin(), Sophus::Vector4<Scalar>::Zero().eval(), std::plus{},
-      pose_to_weighted_eigen_vector);
-
-  // Calculate the weighted pose estimation
-  Sophus::SE2<Scalar> estimated_pose = Eigen::Map<const Sophus::SE2<Scalar>>{mean_pose_vector.data()};
+/// Pose estimate handle that materializes the covariance on demand.
+/**
+ * Wraps the sufficient statistics of a weighted particle set. The mean pose is
+ * computed eagerly on construction; the 3x3 covariance is finished from the
+ * retained statistics on first access and then cached. Consumers that read the
+ * mean every cycle but the covariance only sporadically (e.g. for diagnostics)
+ * skip the covariance math entirely on the common path.
+ *
+ * The handle models the pair `beluga::estimate()` returns: it supports
+ * structured bindings and converts implicitly to `std::pair`, at the cost of
+ * materializing the covariance.
+ */
+template <class Scalar>
+class LazyEstimate {
+ public:
+  /// Mean pose type.
+  using pose_type = Sophus::SE2<Scalar>;
+  /// Covariance matrix type.
+  using covariance_type = Sophus::Matrix3<Scalar>;
 
-  Sophus::Matrix3<Scalar> covariance_matrix = Sophus::Matrix3<Scalar>::Zero();
+  /// Constructs a default instance, with no useful estimate.
+  LazyEstimate() = default;
 
-  // Compute the covariance of the translation part.
-  covariance_matrix.template topLeftCorner<2, 2>() =
-      calculate_covariance(translation_view, normalized_weights_view, estimated_pose.translation());
+  /// Constructs a handle from previously accumulated sufficient statistics.
+  explicit LazyEstimate(SE2EstimateStatistics<Scalar> statistics)
+      : statistics_{std::move(statistics)}, pose_{detail::mean_from_sums(statistics_)} {}
 
-  // Compute the orientation variance and re-normalize the rotation component.
-  if (estimated_pose.so2().unit_complex().norm() < std::numeric_limits<double>::epsilon()) {
-    // Handle the case where both averages are too close to zero.
-    // Return zero yaw and infinite variance.
-    covariance_matrix.coeffRef(2, 2) = std::numeric_limits<double>::infinity();
-    estimated_pose.so2() = Sophus::SO2<Scalar>{0.0};
-  } else {
-    // See circular standard deviation in
-    // https://en.wikipedia.org/wiki/Directional_statistics#Dispersion.
-    covariance_matrix.coeffRef(2, 2) = -2.0 * std::log(estimated_pose.so2().unit_complex().norm());
-    estimated_pose.so2().normalize();
+  /// Returns the estimated mean pose.
+  [[nodiscard]] const pose_type& pose() const { return pose_; }
+
+  /// Returns the covariance, finishing it from the statistics on first access.
+  [[nodiscard]] const covariance_type& covariance() const {
+    if (!covariance_.has_value()) {
+      covariance_ = detail::covariance_from_sums(statistics_);
+    }
+    return *covariance_;
+  }
+
+  /// Conversion to the pair `beluga::estimate()` returns, materializing the covariance.
+  operator std::pair<pose_type, covariance_type>() const { return std::pair{pose(), covariance()}; }  // NOLINT
+
+  /// Tuple protocol accessor for structured binding support.
+  template <std::size_t I>
+  [[nodiscard]] decltype(auto) get() const {
+    static_assert(I < 2);
+    if constexpr (I == 0) {
+      return pose();
+    } else {
+      return covariance();
+    }
+  }
+
+ private:
+  SE2EstimateStatistics<Scalar> statistics_;
+  pose_type pose_;
+  mutable std::optional<covariance_type> covariance_;
+};
+
+/// Result of a cluster-aware pose estimate.
+/**
+ * See `beluga::cluster_estimate()`.
+ */
+template <class Scalar>
+struct ClusterEstimate {
+  /// Weighted mean pose of the dominant cluster.
+  Sophus::SE2<Scalar> pose;
+  /// Covariance of the dominant cluster, in the same layout `beluga::estimate()` returns.
+  Sophus::Matrix3<Scalar> covariance;
+  /// Fraction of the total particle weight held by the dominant cluster.
+  Scalar weight_fraction;
+  /// Number of distinct clusters found in the particle set.
+  std::size_t num_modes;
+};
+
+/// Returns the pose estimate of the dominant particle cluster.
+/**
+ * Averaging over the whole particle set blends distinct hypotheses into a
+ * meaningless midpoint during multi-hypothesis phases. This estimator instead
+ * groups particles into clusters with a spatial hash, accumulates per-cluster
+ * weight, mean and covariance partial sums in a single O(n) traversal, and
+ * reports the estimate of the cluster holding the most weight along with the
+ * number of modes, matching the cluster-based estimation behavior of classic
+ * AMCL implementations.
+ *
+ * \tparam Poses A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range) type whose
+ *  value type is `Sophus::SE2<Scalar>`.
+ * \tparam Weights A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range) type whose
+ *  value type is `Scalar`.
+ * \tparam Pose The pose value type of the given range.
+ * \tparam Scalar A scalar type, e.g. double or float.
+ * \tparam Hasher A callable mapping poses to cluster ids, e.g. `beluga::spatial_hash<Sophus::SE2d>`.
+ * \param poses Poses of the particles.
+ * \param weights Weights of the particles.
+ * \param hasher Spatial hasher defining the clustering resolution.
+ * \return The dominant cluster estimate and the number of modes.
+ */
+template <
+    class Poses,
+    class Weights,
+    class Pose = ranges::range_value_t<Poses>,
+    class Scalar = typename Pose::Scalar,
+    class Hasher = beluga::spatial_hash<Sophus::SE2<Scalar>>,
+    typename = std::enable_if_t<std::is_same_v<Pose, typename Sophus::SE2<Scalar>>>,
+    typename = std::enable_if_t<!ranges::range<Hasher>>>
+ClusterEstimate<Scalar> cluster_estimate(Poses&& poses, Weights&& weights, Hasher hasher = Hasher{}) {
+  auto poses_view = poses | ranges::views::common;
+  auto weights_view = weights | ranges::views::common;
+
+  auto clusters = std::unordered_map<std::size_t, SE2EstimateStatistics<Scalar>>{};
+  Scalar total_weight{0};
+  auto pose_it = std::begin(poses_view);
+  auto weight_it = std::begin(weights_view);
+  for (; pose_it != std::end(poses_view); ++pose_it, ++weight_it) {
+    const auto& pose = *pose_it;
+    const auto weight = static_cast<Scalar>(*weight_it);
+    clusters[hasher(pose)].add(pose, weight);
+    total_weight += weight;
+  }
+
+  const auto dominant = std::max_element(clusters.begin(), clusters.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.second.weight_sum < rhs.second.weight_sum;
+  });
+  const auto [pose, covariance] = detail::estimate_from_sums(dominant->second);
+  return ClusterEstimate<Scalar>{pose, covariance, dominant->second.weight_sum / total_weight, clusters.size()};
+}
+
+/// Returns the pose estimate of the dominant particle cluster from precomputed hashes.
+/**
+ * Overload that reads the spatial hashes from a range (e.g. a cluster column kept
+ * coherent by the hasher overload of `beluga::actions::propagate`) instead of
+ * re-deriving them from the poses.
+ *
+ * \tparam Poses A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range) type whose
+ *  value type is `Sophus::SE2<Scalar>`.
+ * \tparam Weights A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range) type whose
+ *  value type is `Scalar`.
+ * \tparam Clusters A [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range) type whose
+ *  value type is convertible to `std::size_t`.
+ * \tparam Pose The pose value type of the given range.
+ * \tparam Scalar A scalar type, e.g. double or float.
+ * \param poses Poses of the particles.
+ * \param weights Weights of the particles.
+ * \param clusters Precomputed spatial hashes of the particles.
+ * \return The dominant cluster estimate and the number of modes.
+ */
+template <
+    class Poses,
+    class Weights,
+    class Clusters,
+    class Pose = ranges::range_value_t<Poses>,
+    class Scalar = typename Pose::Scalar,
+    typename = std::enable_if_t<std::is_same_v<Pose, typename Sophus::SE2<Scalar>>>,
+    typename = std::enable_if_t<ranges::range<Clusters>>>
+ClusterEstimate<Scalar> cluster_estimate(Poses&& poses, Weights&& weights, Clusters&& clusters) {
+  auto poses_view = poses | ranges::views::common;
+  auto weights_view = weights | ranges::views::common;
+  auto clusters_view = clusters | ranges::views::common;
+
+  auto sums = std::unordered_map<std::size_t, SE2EstimateStatistics<Scalar>>{};
+  Scalar total_weight{0};
+  auto pose_it = std::begin(poses_view);
+  auto weight_it = std::begin(weights_view);
+  auto cluster_it = std::begin(clusters_view);
+  for (; pose_it != std::end(poses_view); ++pose_it, ++weight_it, ++cluster_it) {
+    const auto& pose = *pose_it;
+    const auto weight = static_cast<Scalar>(*weight_it);
+    sums[static_cast<std::size_t>(*cluster_it)].add(pose, weight);
+    total_weight += weight;
   }
-  return std::pair{estimated_pose, covariance_matrix};
+
+  const auto dominant = std::max_element(sums.begin(), sums.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.second.weight_sum < rhs.second.weight_sum;
+  });
+  const auto [pose, covariance] = detail::estimate_from_sums(dominant->second);
+  return ClusterEstimate<Scalar>{pose, covariance, dominant->second.weight_sum / total_weight, sums.size()};
 }
 
 /// Computes mean and standard deviation of a range of weighted scalars.
@@ -242,4 +542,26 @@ std::pair<Sophus::SE2<Scalar>, Sophus::Matrix3<Scalar>> estimate(Poses&& poses)
 
 }  // namespace beluga
 
+namespace std {
+
+/// Tuple protocol specialization for `beluga::LazyEstimate` structured bindings.
+template <class Scalar>
+struct tuple_size<beluga::LazyEstimate<Scalar>> : integral_constant<size_t, 2> {};
+
+/// Tuple protocol specialization for `beluga::LazyEstimate` structured bindings.
+template <class Scalar>
+struct tuple_element<0, beluga::LazyEstimate<Scalar>> {
+  /// The mean pose type. Const, since the handle only exposes const access.
+  using type = const typename beluga::LazyEstimate<Scalar>::pose_type;
+};
+
+/// Tuple protocol specialization for `beluga::LazyEstimate` structured bindings.
+template <class Scalar>
+struct tuple_element<1, beluga::LazyEstimate<Scalar>> {
+  /// The covariance matrix type. Const, since the handle only exposes const access.
+  using type = const typename beluga::LazyEstimate<Scalar>::covariance_type;
+};
+
+}  // namespace std
+
 #endif
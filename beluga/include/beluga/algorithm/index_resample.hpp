@@ -0,0 +1,223 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ALGORITHM_INDEX_RESAMPLE_HPP
+#define BELUGA_ALGORITHM_INDEX_RESAMPLE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+
+#include <beluga/random/random_engines.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+/**
+ * \file
+ * \brief Implementation of index-based resampling with column-wise permutation application.
+ *
+ * The view-based resampling flows route whole particle tuples through a view chain, one
+ * element at a time. The routines here split the stage in two: the resampler emits a
+ * compact source-index buffer (four bytes per output particle), and a permutation kernel
+ * then applies it to every member column of a tuple container with contiguous gather
+ * loops — one column at a time, so the working set of each loop is one column plus the
+ * index buffer, and the loop body is a plain indexed gather that vectorizes. The cheap
+ * index computation is thereby separated from the data movement, and the movement itself
+ * runs at memory bandwidth.
+ */
+
+namespace beluga {
+
+/// Compact source-index buffer produced by the index-based resamplers.
+/**
+ * One entry per output particle, holding the index of the source particle it is copied
+ * from. 32 bits cover any realistic particle count at half the footprint of a size type.
+ */
+using ResampleIndices = std::vector<std::uint32_t>;
+
+namespace detail {
+
+/// Gathers every member column of `input` into `output` following `indices`.
+template <class Input, class Output, std::size_t... Is>
+void gather_columns(const Input& input, Output& output, const ResampleIndices& indices, std::index_sequence<Is...>) {
+  const auto gather_one = [&indices](auto source, auto destination) {
+    const std::size_t count = indices.size();
+    for (std::size_t j = 0; j < count; ++j) {
+      destination[static_cast<std::ptrdiff_t>(j)] = source[static_cast<std::ptrdiff_t>(indices[j])];
+    }
+  };
+  (gather_one(input.template span<Is>(), output.template span<Is>()), ...);
+}
+
+}  // namespace detail
+
+/// Computes the source indices of a systematic (low-variance) resample.
+/**
+ * Equivalent to `beluga::views::systematic_sample` in distribution: a single uniform
+ * draw positions `count` evenly spaced pointers over the cumulative weight distribution.
+ * The weights are swept exactly twice (once for the total, once emitting indices) and no
+ * cumulative buffer is materialized. The emitted indices are ascending, so a subsequent
+ * gather walks the source columns sequentially.
+ *
+ * \param weights Weight range to resample over. The weights need not be normalized.
+ * \param count Number of samples to produce.
+ * \param[out] indices Output index buffer; cleared first, capacity is reused.
+ * \param engine The random number generator object, used for a single draw.
+ */
+template <class Range, class URNG = beluga::default_random_engine>
+void systematic_resample_indices(
+    const Range& weights,
+    std::size_t count,
+    ResampleIndices& indices,
+    URNG& engine = beluga::get_default_random_engine()) {
+  static_assert(ranges::input_range<Range>);
+  assert(count > 0);
+  indices.clear();
+  indices.reserve(count);
+
+  double total_weight = 0.0;
+  for (const double weight : weights) {
+    total_weight += weight;
+  }
+  assert(total_weight > 0.0);
+
+  const double step = total_weight / static_cast<double>(count);
+  const double offset = std::uniform_real_distribution<double>{0.0, 1.0}(engine) * step;
+
+  double cumulative = 0.0;
+  std::uint32_t index = 0;
+  for (const double weight : weights) {
+    cumulative += weight;
+    while (indices.size() < count && offset + static_cast<double>(indices.size()) * step < cumulative) {
+      indices.push_back(index);
+    }
+    ++index;
+  }
+  while (indices.size() < count) {  // Guard against floating point accumulation shortfall.
+    indices.push_back(index - 1);
+  }
+}
+
+/// Computes the source indices of a multinomial resample.
+/**
+ * Distributionally equivalent to `beluga::views::sample` over a weighted range: the
+ * multiset of emitted indices is multinomial in the normalized weights. `count` uniform
+ * positions are drawn up front and sorted, so the weights are swept once and the emitted
+ * indices come out ascending — the order of resampled particles is immaterial, and an
+ * ascending buffer keeps the subsequent gather sequential over the source columns.
+ *
+ * \param weights Weight range to resample over. The weights need not be normalized.
+ * \param count Number of samples to produce.
+ * \param[out] indices Output index buffer; cleared first, capacity is reused.
+ * \param engine The random number generator object, used for `count` draws.
+ */
+template <class Range, class URNG = beluga::default_random_engine>
+void multinomial_resample_indices(
+    const Range& weights,
+    std::size_t count,
+    ResampleIndices& indices,
+    URNG& engine = beluga::get_default_random_engine()) {
+  static_assert(ranges::input_range<Range>);
+  assert(count > 0);
+  indices.clear();
+  indices.reserve(count);
+
+  double total_weight = 0.0;
+  for (const double weight : weights) {
+    total_weight += weight;
+  }
+  assert(total_weight > 0.0);
+
+  auto positions = std::vector<double>(count);
+  auto distribution = std::uniform_real_distribution<double>{0.0, total_weight};
+  std::generate(positions.begin(), positions.end(), [&distribution, &engine] { return distribution(engine); });
+  std::sort(positions.begin(), positions.end());
+
+  double cumulative = 0.0;
+  std::uint32_t index = 0;
+  auto position = positions.begin();
+  for (const double weight : weights) {
+    cumulative += weight;
+    while (position != positions.end() && *position < cumulative) {
+      indices.push_back(index);
+      ++position;
+    }
+    ++index;
+  }
+  while (indices.size() < count) {  // Guard against floating point accumulation shortfall.
+    indices.push_back(index - 1);
+  }
+}
+
+/// Applies an index buffer to every member column of a tuple container.
+/**
+ * The permutation runs column by column with contiguous gather loops over the spans
+ * exposed by `beluga::TupleContainer::span()`, which is the bandwidth-optimal way to
+ * move structure-of-arrays storage. All columns are gathered verbatim, weights
+ * included; resampling semantics (unit output weights) are handled by
+ * `beluga::index_resample()`.
+ *
+ * \param input Tuple container to gather from. It must not overlap `output`.
+ * \param output Tuple container the gathered columns are written to; resized to fit.
+ * \param indices Source-index buffer; every entry must index into `input`.
+ */
+template <class Input, class Output>
+void apply_resample_indices(const Input& input, Output& output, const ResampleIndices& indices) {
+  assert(!indices.empty());
+  assert(*std::max_element(indices.begin(), indices.end()) < input.size());
+  output.resize(indices.size());
+  constexpr std::size_t kColumns = std::tuple_size_v<typename Input::value_type>;
+  detail::gather_columns(input, output, indices, std::make_index_sequence<kColumns>());
+}
+
+/// Resamples a particle container into another through an index buffer.
+/**
+ * Convenience composition of `beluga::systematic_resample_indices()` and
+ * `beluga::apply_resample_indices()`: the index buffer is computed over the particle
+ * weights, every column is gathered, and the output weights are then reset to 1 like
+ * every resampling flow in this library does, since after resampling the probability
+ * mass is carried by particle multiplicity.
+ *
+ * \param input Particle tuple container to resample from. It must not overlap `output`.
+ * \param output Particle tuple container the resampled columns are written to.
+ * \param count Number of samples to produce.
+ * \param engine The random number generator object, used for a single draw.
+ */
+template <class Input, class Output, class URNG = beluga::default_random_engine>
+void index_resample(
+    const Input& input,
+    Output& output,
+    std::size_t count,
+    URNG& engine = beluga::get_default_random_engine()) {
+  static_assert(beluga::is_particle_range_v<Input>);
+  auto indices = ResampleIndices{};
+  systematic_resample_indices(beluga::views::weights(input), count, indices, engine);
+  apply_resample_indices(input, output, indices);
+  for (auto&& weight : beluga::views::weights(output)) {
+    weight = 1.0;
+  }
+}
+
+}  // namespace beluga
+
+#endif
@@ -0,0 +1,106 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ALGORITHM_LATENCY_BUDGET_CONTROLLER_HPP
+#define BELUGA_ALGORITHM_LATENCY_BUDGET_CONTROLLER_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <chrono>
+#include <cstddef>
+
+#include <beluga/algorithm/exponential_filter.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a latency-targeting adaptive particle budget controller.
+ */
+
+namespace beluga {
+
+/// Feedback controller that adapts the particle ceiling to a per-update latency target.
+/**
+ * The controller tracks the measured per-particle cost of filter updates with an
+ * exponential filter and derives the largest particle ceiling expected to fit the
+ * latency target. When the platform is loaded and updates slow down, the ceiling
+ * tightens; when cores free up, it relaxes back towards the configured maximum.
+ * The ceiling is always kept within the configured bounds, so accuracy never drops
+ * below the floor sized for correctness and never exceeds the worst-case budget.
+ */
+class LatencyBudgetController {
+ public:
+  /// Constructs a latency budget controller.
+  /**
+   * \param target_latency Per-update latency target.
+   * \param min_ceiling Lower bound for the particle ceiling.
+   * \param max_ceiling Upper bound for the particle ceiling, also the initial value.
+   * \param alpha Smoothing factor for the per-particle cost estimate.
+   */
+  LatencyBudgetController(
+      std::chrono::nanoseconds target_latency,
+      std::size_t min_ceiling,
+      std::size_t max_ceiling,
+      double alpha = 0.3) noexcept
+      : target_latency_{target_latency},
+        min_ceiling_{min_ceiling},
+        max_ceiling_{max_ceiling},
+        ceiling_{max_ceiling},
+        cost_filter_{alpha} {
+    assert(target_latency > std::chrono::nanoseconds::zero());
+    assert(0 < min_ceiling);
+    assert(min_ceiling <= max_ceiling);
+  }
+
+  /// Returns the current particle ceiling.
+  [[nodiscard]] std::size_t ceiling() const noexcept { return ceiling_; }
+
+  /// Feeds back the measured latency of an update and returns the adjusted ceiling.
+  /**
+   * \param measured_latency Measured duration of the last filter update.
+   * \param particle_count Number of particles that update processed.
+   * \return The particle ceiling to use for the next update.
+   */
+  std::size_t operator()(std::chrono::nanoseconds measured_latency, std::size_t particle_count) {
+    if (particle_count == 0) {
+      return ceiling_;
+    }
+
+    const double cost_per_particle =
+        cost_filter_(static_cast<double>(measured_latency.count()) / static_cast<double>(particle_count));
+    if (cost_per_particle <= 0.0) {
+      return ceiling_;
+    }
+
+    const double affordable = static_cast<double>(target_latency_.count()) / cost_per_particle;
+    ceiling_ = std::clamp(static_cast<std::size_t>(affordable), min_ceiling_, max_ceiling_);
+    return ceiling_;
+  }
+
+  /// Resets the cost estimate and restores the ceiling to the configured maximum.
+  void reset() noexcept {
+    cost_filter_.reset();
+    ceiling_ = max_ceiling_;
+  }
+
+ private:
+  std::chrono::nanoseconds target_latency_;          ///< Per-update latency target.
+  std::size_t min_ceiling_;                          ///< Lower bound for the particle ceiling.
+  std::size_t max_ceiling_;                          ///< Upper bound for the particle ceiling.
+  std::size_t ceiling_;                              ///< Current particle ceiling.
+  ExponentialFilter cost_filter_;                    ///< Smoothed per-particle cost estimate.
+};
+
+}  // namespace beluga
+
+#endif
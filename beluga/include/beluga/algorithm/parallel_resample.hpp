@@ -0,0 +1,138 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ALGORITHM_PARALLEL_RESAMPLE_HPP
+#define BELUGA_ALGORITHM_PARALLEL_RESAMPLE_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <execution>
+#include <numeric>
+#include <random>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/traits.hpp>
+#include <range/v3/utility/random.hpp>
+
+#include <beluga/random/random_engines.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/utility/thread_pool.hpp>
+#include <beluga/views/particles.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a parallel systematic resampling algorithm.
+ */
+
+namespace beluga {
+
+/// Resamples `count` elements from `input` into `output`, optionally in parallel.
+/**
+ * This implements systematic resampling split across threads: a prefix sum over the
+ * input weights is built first, the [0, W) interval is partitioned into equally sized
+ * sample slices, and each slice locates its starting position with a binary search and
+ * then emits its outputs independently with a sequential sweep. Since every output
+ * index is written by exactly one slice, slices can run concurrently without
+ * synchronization, and the result is identical to a sequential systematic resampling
+ * pass with the same random offset.
+ *
+ * If the input is a particle range, the weights are taken from the particles and the
+ * output particles all get a weight equal to 1, consistent with `beluga::views::sample`.
+ * Otherwise a uniform distribution is assumed.
+ *
+ * \tparam ExecutionPolicy An [execution policy](https://en.cppreference.com/w/cpp/algorithm/execution_policy_tag_t).
+ * \tparam Range A [random access](https://en.cppreference.com/w/cpp/ranges/random_access_range) and
+ *  [sized](https://en.cppreference.com/w/cpp/ranges/sized_range) range.
+ * \tparam Output A random access range with `resize()` support, e.g. `beluga::TupleVector`.
+ * \tparam URNG A random number generator that satisfies the
+ *  [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator)
+ *  requirements.
+ * \param policy The execution policy to use.
+ * \param input The range to resample from. It must not overlap `output`.
+ * \param output The range resampled elements are written to.
+ * \param count Number of samples to produce.
+ * \param engine The random number generator object, used for a single draw.
+ */
+template <class ExecutionPolicy, class Range, class Output, class URNG = beluga::default_random_engine>
+void parallel_resample(
+    ExecutionPolicy&& policy,
+    const Range& input,
+    Output& output,
+    std::size_t count,
+    URNG& engine = beluga::get_default_random_engine()) {
+  static_assert(beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>);
+  static_assert(ranges::sized_range<Range>);
+  static_assert(ranges::random_access_range<Range>);
+  assert(ranges::size(input) > 0);
+  assert(count > 0);
+
+  const auto size = static_cast<std::size_t>(ranges::size(input));
+
+  // Build the cumulative weight distribution in a single pass.
+  std::vector<double> cumulative(size);
+  if constexpr (beluga::is_particle_range_v<Range>) {
+    ranges::copy(beluga::views::weights(input), cumulative.begin());
+  } else {
+    std::fill(cumulative.begin(), cumulative.end(), 1.0);
+  }
+  std::inclusive_scan(cumulative.begin(), cumulative.end(), cumulative.begin());
+
+  const double total_weight = cumulative.back();
+  assert(total_weight > 0.0);
+  const double step = total_weight / static_cast<double>(count);
+  const double offset = std::uniform_real_distribution<double>{0.0, 1.0}(engine) * step;
+
+  output.resize(count);
+
+  // Partition the output into one slice per thread; each slice is emitted independently.
+  const std::size_t num_slices = std::min<std::size_t>(count, std::max(1U, std::thread::hardware_concurrency()));
+  std::vector<std::size_t> slices(num_slices);
+  std::iota(slices.begin(), slices.end(), std::size_t{0});
+
+  const auto in_first = ranges::begin(input);
+  const auto out_first = ranges::begin(output);
+
+  beluga::execution::for_each(policy, slices.begin(), slices.end(), [&](std::size_t slice) {
+    const std::size_t first_sample = slice * count / num_slices;
+    const std::size_t last_sample = (slice + 1) * count / num_slices;
+    const double first_position = offset + static_cast<double>(first_sample) * step;
+    // Locate the slice start with a binary search, then sweep sequentially.
+    auto index = static_cast<std::size_t>(
+        std::upper_bound(cumulative.begin(), cumulative.end(), first_position) - cumulative.begin());
+    index = std::min(index, size - 1);
+    for (std::size_t j = first_sample; j < last_sample; ++j) {
+      const double position = offset + static_cast<double>(j) * step;
+      while (cumulative[index] <= position && index + 1 < size) {
+        ++index;
+      }
+      auto&& element = *(in_first + static_cast<ranges::range_difference_t<Range>>(index));
+      auto out = out_first + static_cast<ranges::range_difference_t<Output>>(j);
+      if constexpr (beluga::is_particle_range_v<Range>) {
+        *out = beluga::make_from_state<ranges::range_value_t<Output>>(beluga::state(element));
+      } else {
+        *out = element;
+      }
+    }
+  });
+}
+
+}  // namespace beluga
+
+#endif
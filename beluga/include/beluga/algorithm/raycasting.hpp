@@ -18,8 +18,11 @@
 #include <algorithm>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include <beluga/algorithm/raycasting/bresenham.hpp>
+#include <beluga/algorithm/raycasting/cache.hpp>
+#include <beluga/algorithm/raycasting/lookup_table.hpp>
 
 #include <range/v3/view/all.hpp>
 #include <range/v3/view/take_while.hpp>
@@ -91,22 +94,97 @@ class Ray2d {
   /**
    * Distances are measured from cell centroid to cell centroid.
    *
+   * Rays are pre-clipped against the grid: a traced path stays within the
+   * axis-aligned bounding box of its end cells, so when both lie in the grid
+   * every traversed cell is provably valid and the inner loop runs with
+   * unchecked accessors and no per-cell bounds branches. Only rays actually
+   * leaving the grid fall back to per-cell containment checks.
+   *
    * \param bearing Direction for ray casting.
    * \return Distance in meters to first non free cell hit by the ray, if any.
    */
   [[nodiscard]] std::optional<double> cast(const Sophus::SO2d& bearing) const {
-    for (const auto& cell : trace(bearing)) {
-      if (!grid_.free_at(cell)) {
-        const auto source_position = grid_.coordinates_at(source_cell_);
-        const auto cell_position = grid_.coordinates_at(cell);
-        const auto distance = (cell_position - source_position).norm();
-        return std::make_optional(std::min(distance, max_range_));
+    // Don't do the multiplication in SE2, it's slower
+    const auto& r1 = source_pose_in_local_frame_.so2();
+    const auto& t1 = source_pose_in_local_frame_.translation();
+    const auto far_end_position = r1 * (bearing.unit_complex() * max_range_) + t1;
+    const auto far_end_cell = grid_.cell_near(far_end_position);
+    if (grid_.contains(source_cell_) && grid_.contains(far_end_cell)) {
+      for (const auto& cell : algorithm_(source_cell_, far_end_cell)) {
+        if (!grid_.free_at_unchecked(cell)) {
+          return std::make_optional(distance_to(cell));
+        }
+      }
+      return std::nullopt;
+    }
+    for (const auto& cell : algorithm_(source_cell_, far_end_cell)) {
+      if (!grid_.contains(cell)) {
+        break;
+      }
+      if (!grid_.free_at_unchecked(cell)) {
+        return std::make_optional(distance_to(cell));
       }
     }
     return std::nullopt;
   }
 
+  /// Casts a fan of rays sharing the source of this ray.
+  /**
+   * Equivalent to calling `cast()` once per bearing, but the state shared by
+   * the whole fan (the source cell, its centroid and the source rotation) is
+   * resolved once instead of per ray, which matters when casting the 180+
+   * beams of a full scan from the same pose.
+   *
+   * \tparam Bearings A range of `Sophus::SO2d` directions.
+   * \param bearings Directions for ray casting.
+   * \param results Caller-provided buffer where one result per bearing is
+   *   written, with the same semantics as the `cast()` return value. It is
+   *   cleared and refilled, retaining its capacity across calls.
+   */
+  template <class Bearings>
+  void cast_fan(const Bearings& bearings, std::vector<std::optional<double>>& results) const {
+    results.clear();
+    const auto source_position = grid_.coordinates_at(source_cell_);
+    const auto source_in_grid = grid_.contains(source_cell_);
+    const auto& rotation = source_pose_in_local_frame_.so2();
+    const auto& translation = source_pose_in_local_frame_.translation();
+    for (const auto& bearing : bearings) {
+      const auto far_end_position = rotation * (bearing.unit_complex() * max_range_) + translation;
+      const auto far_end_cell = grid_.cell_near(far_end_position);
+      auto result = std::optional<double>{};
+      if (source_in_grid && grid_.contains(far_end_cell)) {
+        // Pre-clipped ray, see cast(): every traversed cell is provably valid.
+        for (const auto& cell : algorithm_(source_cell_, far_end_cell)) {
+          if (!grid_.free_at_unchecked(cell)) {
+            const auto distance = (grid_.coordinates_at(cell) - source_position).norm();
+            result = std::min(distance, max_range_);
+            break;
+          }
+        }
+      } else {
+        for (const auto& cell : algorithm_(source_cell_, far_end_cell)) {
+          if (!grid_.contains(cell)) {
+            break;
+          }
+          if (!grid_.free_at_unchecked(cell)) {
+            const auto distance = (grid_.coordinates_at(cell) - source_position).norm();
+            result = std::min(distance, max_range_);
+            break;
+          }
+        }
+      }
+      results.push_back(result);
+    }
+  }
+
  private:
+  /// Returns the centroid-to-centroid distance from the source cell, clamped to the maximum range.
+  [[nodiscard]] double distance_to(const Eigen::Vector2i& cell) const {
+    const auto source_position = grid_.coordinates_at(source_cell_);
+    const auto cell_position = grid_.coordinates_at(cell);
+    return std::min((cell_position - source_position).norm(), max_range_);
+  }
+
   const OccupancyGrid& grid_;
   const Algorithm algorithm_;
   const Sophus::SE2d source_pose_in_local_frame_;
@@ -40,15 +40,20 @@ class Bresenham2i {
                     ///  See http://eugen.dedu.free.fr/projects/bresenham.
   };
 
+  /// Sentinel for lines whose variant is selected at runtime rather than at compile time.
+  static constexpr int kDynamicVariant = -1;
+
   /// Bresenham's 2D line drawing as a range.
   /**
    * \tparam Vector2 2D vector type. Must be default constructible,
    *   copy constructible, and implement `Vector2d::x()` and `Vector2::y()`
    *   methods returning both lvalues (for mutation) and rvalues.
    * \tparam Integer Integer scalar type.
+   * \tparam StaticVariant Algorithm variant fixed at compile time, or
+   *   `kDynamicVariant` to check the variant stored in the line on each step.
    */
-  template <class Vector2, typename Integer = typename Vector2::Scalar>
-  class Line : public ranges::view_interface<Line<Vector2, Integer>> {
+  template <class Vector2, typename Integer = typename Vector2::Scalar, int StaticVariant = kDynamicVariant>
+  class Line : public ranges::view_interface<Line<Vector2, Integer, StaticVariant>> {
    public:
     /// Bresenham's 2D line drawing iterator, one cell at a time.
     class iterator {  // NOLINT(readability-identifier-naming)
@@ -130,7 +135,7 @@ class Bresenham2i {
           if (error_ > dxspan_) {
             y_ += ystep_;
             error_ -= dxspan_;
-            if (modified_) {
+            if (modified()) {
               ++checks_;
               ++checks_;
             }
@@ -182,6 +187,15 @@ class Bresenham2i {
       bool operator!=(const sentinel& other) const { return !(*this == other); }
 
      private:
+      /// Resolves the variant check at compile time when the line variant is static.
+      [[nodiscard]] constexpr bool modified() const {
+        if constexpr (StaticVariant == kDynamicVariant) {
+          return modified_;
+        } else {
+          return StaticVariant == static_cast<int>(Bresenham2i::kModified);
+        }
+      }
+
       void step_to(Integer x, Integer y) {
         if (reversed_) {
           using std::swap;
@@ -263,6 +277,35 @@ class Bresenham2i {
   Variant variant_{};
 };
 
+/// Bresenham's 2D line drawing algorithm with its variant fixed at compile time.
+/**
+ * Functionally equivalent to a `Bresenham2i` instance constructed with the same
+ * variant, but the per-cell variant check in the line iterator is resolved at
+ * compile time, keeping the inner stepping loop of `Ray2d::cast()` branch-minimal.
+ * The runtime-selected `Bresenham2i` remains available for cases where the
+ * variant is only known at runtime.
+ *
+ * \tparam V Bresenham's algorithm variant to be used.
+ */
+template <Bresenham2i::Variant V>
+class StaticBresenham2i {
+ public:
+  /// Computes 2D line from `p0` to `p1`.
+  /**
+   * See Bresenham2i::operator()() for further reference on arguments.
+   */
+  template <class Vector2i = Eigen::Vector2i>
+  auto operator()(Vector2i p0, Vector2i p1) const {
+    return Bresenham2i::Line<Vector2i, typename Vector2i::Scalar, static_cast<int>(V)>{std::move(p0), std::move(p1), V};
+  }
+};
+
+/// Standard Bresenham's algorithm with no runtime variant checks.
+using StandardBresenham2i = StaticBresenham2i<Bresenham2i::kStandard>;
+
+/// Modified (supercover) Bresenham's algorithm with no runtime variant checks.
+using ModifiedBresenham2i = StaticBresenham2i<Bresenham2i::kModified>;
+
 }  // namespace beluga
 
 #endif
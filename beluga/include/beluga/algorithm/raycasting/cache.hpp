@@ -0,0 +1,145 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ALGORITHM_RAYCASTING_CACHE_HPP
+#define BELUGA_ALGORITHM_RAYCASTING_CACHE_HPP
+
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <sophus/common.hpp>
+#include <sophus/so2.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a bounded memoization cache for ray-cast results.
+ */
+
+namespace beluga {
+
+/// Bounded memoization cache for ray-cast results, keyed by source cell and heading bucket.
+/**
+ * In steady-state tracking most particles occupy nearly identical poses, so a
+ * sensor model re-casts identical ray fans for each of them. Since `Ray2d::cast()`
+ * distances are measured from cell centroid to cell centroid, its result is fully
+ * determined by the source cell and the ray heading, and co-located particles can
+ * share one traversal per (cell, heading bucket) pair instead of casting separately.
+ *
+ * The cache is a fixed-size open-addressed table of single-word atomic entries,
+ * each packing a 32-bit key with the cast range as a 32-bit float, so lookups and
+ * insertions are lock-free and safe to share across the threads of a parallel
+ * reweight pass; a racing insertion at worst repeats one cast. Memory is bounded
+ * by the capacity chosen at construction regardless of map size, unlike a
+ * precomputed table over the full grid.
+ */
+class RaycastCache {
+ public:
+  /// Constructs a cache with the given angular quantization and capacity.
+  /**
+   * \param angular_bins Number of quantized ray headings over a full turn.
+   * \param capacity Number of table entries, rounded up to a power of two.
+   *  Eight bytes of storage per entry.
+   */
+  RaycastCache(std::size_t angular_bins, std::size_t capacity)
+      : bin_width_{2. * Sophus::Constants<double>::pi() / static_cast<double>(angular_bins)},
+        angular_bins_{angular_bins} {
+    assert(angular_bins > 0);
+    assert(capacity > 0);
+    std::size_t size = 1;
+    while (size < capacity) {
+      size *= 2;
+    }
+    entries_ = std::vector<std::atomic<std::uint64_t>>(size);
+    for (auto& entry : entries_) {
+      entry.store(kEmpty, std::memory_order_relaxed);
+    }
+  }
+
+  /// Returns the memoized cast result for a cell and heading, computing it on a miss.
+  /**
+   * \tparam Fn A callable computing the range for a cache miss, e.g. wrapping
+   *  `Ray2d::cast()` for the current particle.
+   * \param cell_index Grid index of the source cell of the ray.
+   * \param bearing Direction for ray casting, in the grid frame.
+   * \param fallback Callable producing the range when the pair is not cached.
+   * \return The cached or freshly computed range, in meters.
+   */
+  template <class Fn>
+  [[nodiscard]] double cast(std::size_t cell_index, const Sophus::SO2d& bearing, Fn&& fallback) {
+    const double angle = std::atan2(bearing.unit_complex().y(), bearing.unit_complex().x());
+    const auto count = static_cast<std::ptrdiff_t>(angular_bins_);
+    auto bucket = static_cast<std::ptrdiff_t>(std::llround(angle / bin_width_)) % count;
+    if (bucket < 0) {
+      bucket += count;
+    }
+
+    const std::uint64_t key = cell_index * angular_bins_ + static_cast<std::size_t>(bucket);
+    if (key >= kEmptyKey) {  // does not fit the packed key field, bypass the cache
+      return fallback();
+    }
+
+    const std::size_t mask = entries_.size() - 1;
+    std::size_t slot = (kFib * key) >> 32;
+    for (std::size_t probe = 0; probe < kMaxProbes; ++probe, ++slot) {
+      auto& entry = entries_[slot & mask];
+      std::uint64_t packed = entry.load(std::memory_order_relaxed);
+      if ((packed >> 32) == key) {
+        return static_cast<double>(unpack_value(packed));
+      }
+      if (packed == kEmpty) {
+        const double value = fallback();
+        packed = (key << 32) | static_cast<std::uint64_t>(pack_value(static_cast<float>(value)));
+        std::uint64_t expected = kEmpty;
+        entry.compare_exchange_strong(expected, packed, std::memory_order_relaxed);
+        return value;
+      }
+    }
+    return fallback();  // probed slots hold other keys, skip memoization
+  }
+
+ private:
+  static constexpr std::uint64_t kEmptyKey = 0xFFFFFFFFULL;
+  static constexpr std::uint64_t kEmpty = ~std::uint64_t{0};
+  static constexpr std::uint64_t kFib = 11400714819323198485ULL;  // golden ratio for 64 bits
+  static constexpr std::size_t kMaxProbes = 8;
+
+  /// Reinterprets a range value as its storable bit pattern.
+  static std::uint32_t pack_value(float value) {
+    std::uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bits;
+  }
+
+  /// Reinterprets a stored bit pattern back into a range value.
+  static float unpack_value(std::uint64_t packed) {
+    const auto bits = static_cast<std::uint32_t>(packed & 0xFFFFFFFFULL);
+    float value;
+    std::memcpy(&value, &bits, sizeof(value));
+    return value;
+  }
+
+  double bin_width_;
+  std::size_t angular_bins_;
+  std::vector<std::atomic<std::uint64_t>> entries_;
+};
+
+}  // namespace beluga
+
+#endif
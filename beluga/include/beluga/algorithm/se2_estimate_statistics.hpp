@@ -0,0 +1,75 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ALGORITHM_SE2_ESTIMATE_STATISTICS_HPP
+#define BELUGA_ALGORITHM_SE2_ESTIMATE_STATISTICS_HPP
+
+#include <sophus/se2.hpp>
+#include <sophus/types.hpp>
+
+/**
+ * \file
+ * \brief Implementation of sufficient statistics for weighted SE(2) pose estimation.
+ */
+
+namespace beluga {
+
+/// Sufficient statistics for a weighted SE(2) pose estimate.
+/**
+ * Accumulates everything `beluga::estimate()` needs in one pass: the weight and
+ * squared weight sums, the weighted sum of pose coefficients (in
+ * `Sophus::SE2::data()` order), and the weighted sum of translation outer
+ * products (xx, xy, yy).
+ * Instances accumulated independently merge by plain addition, so the reduction
+ * parallelizes without synchronization, and actions that already traverse the
+ * particle set (e.g. `beluga::actions::normalize`) can fill one in the same
+ * pass. All derived quantities are invariant under weight scaling, so it does
+ * not matter whether the statistics were taken before or after normalization.
+ */
+template <class Scalar>
+struct SE2EstimateStatistics {
+  /// Sum of weights.
+  Scalar weight_sum{0};
+  /// Sum of squared weights, for the weighted covariance averaging factor.
+  Scalar squared_weight_sum{0};
+  /// Weighted sum of pose coefficients, in `Sophus::SE2::data()` order.
+  Sophus::Vector4<Scalar> weighted_pose_sum{Sophus::Vector4<Scalar>::Zero()};
+  /// Weighted sum of (xx, xy, yy) translation outer product coefficients.
+  Sophus::Vector3<Scalar> weighted_outer_sum{Sophus::Vector3<Scalar>::Zero()};
+
+  /// Accumulates one weighted pose.
+  void add(const Sophus::SE2<Scalar>& pose, Scalar weight) {
+    weight_sum += weight;
+    squared_weight_sum += weight * weight;
+    weighted_pose_sum += Eigen::Map<const Sophus::Vector4<Scalar>>{pose.data()} * weight;
+    const auto& translation = pose.translation();
+    weighted_outer_sum += Sophus::Vector3<Scalar>{
+        weight * translation.x() * translation.x(),
+        weight * translation.x() * translation.y(),
+        weight * translation.y() * translation.y(),
+    };
+  }
+
+  /// Merges independently accumulated statistics into this instance.
+  void merge(const SE2EstimateStatistics& other) {
+    weight_sum += other.weight_sum;
+    squared_weight_sum += other.squared_weight_sum;
+    weighted_pose_sum += other.weighted_pose_sum;
+    weighted_outer_sum += other.weighted_outer_sum;
+  }
+};
+
+}  // namespace beluga
+
+#endif
@@ -15,15 +15,22 @@
 #ifndef BELUGA_ALGORITHM_SPATIAL_HASH_HPP
 #define BELUGA_ALGORITHM_SPATIAL_HASH_HPP
 
+#include <algorithm>
+#include <array>
 #include <bitset>
 #include <cmath>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
+#include <ratio>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
+#include <range/v3/view/span.hpp>
+
 #include <sophus/se2.hpp>
+#include <sophus/se3.hpp>
 
 /**
  * \file
@@ -34,15 +41,15 @@ namespace beluga {
 
 namespace detail {
 
-/// Returns the hashed and rotated floor of a value.
+/// Returns the hashed and rotated value of an already floored cell index.
 /**
  * \tparam N Number of bits to be used from the integer result, the least significant will be used.
  * \tparam I Result will be shifted by I*N.
- * \param value Input value to be hashed.
+ * \param unsigned_value Cell index to be hashed.
  * \return The calculated result.
  */
 template <std::size_t N, std::size_t I>
-constexpr std::size_t floor_and_fibo_hash(double value) {
+constexpr std::size_t fibo_hash(std::size_t unsigned_value) {
   constexpr auto kFib = []() {
     if constexpr (std::is_same_v<std::size_t, std::uint64_t>) {
       return 11400714819323198485LLU;  // golden ratio for 64 bits
@@ -55,13 +62,6 @@ constexpr std::size_t floor_and_fibo_hash(double value) {
     }
   }();
 
-  using signed_type = std::make_signed_t<std::size_t>;
-  using unsigned_type = std::make_unsigned_t<std::size_t>;
-
-  // floor the value and convert to integer
-  const auto signed_value = static_cast<signed_type>(std::floor(value));
-  // work with unsigned from now on
-  const auto unsigned_value = static_cast<unsigned_type>(signed_value);
   // spread number information through all the bits using the fibonacci hash
   const auto div_hashed_value = kFib * unsigned_value;
   // rotate bits to avoid aliasing between different values of I
@@ -74,6 +74,45 @@ constexpr std::size_t floor_and_fibo_hash(double value) {
   }
 }
 
+/// Returns the hashed and rotated floor of a value.
+/**
+ * \tparam N Number of bits to be used from the integer result, the least significant will be used.
+ * \tparam I Result will be shifted by I*N.
+ * \param value Input value to be hashed.
+ * \return The calculated result.
+ */
+template <std::size_t N, std::size_t I>
+constexpr std::size_t floor_and_fibo_hash(double value) {
+  using signed_type = std::make_signed_t<std::size_t>;
+  using unsigned_type = std::make_unsigned_t<std::size_t>;
+
+  // floor the value and convert to integer
+  const auto signed_value = static_cast<signed_type>(std::floor(value));
+  // work with unsigned from now on
+  return fibo_hash<N, I>(static_cast<unsigned_type>(signed_value));
+}
+
+/// Hashes one SE2 cell given precomputed reciprocal resolutions.
+/**
+ * Shared by the runtime- and compile-time-resolution SE2 hashers, so both variants
+ * bucket states identically for equal resolutions.
+ *
+ * \param x X coordinate of the translation, in meters.
+ * \param y Y coordinate of the translation, in meters.
+ * \param theta Rotation angle, in radians.
+ * \param inverse_x Reciprocal of the clustering resolution for the X axis.
+ * \param inverse_y Reciprocal of the clustering resolution for the Y axis.
+ * \param inverse_theta Reciprocal of the clustering resolution for the Theta axis.
+ * \return The calculated hash.
+ */
+constexpr std::size_t
+hash_se2_cell(double x, double y, double theta, double inverse_x, double inverse_y, double inverse_theta) {
+  constexpr auto kBits = std::numeric_limits<std::size_t>::digits / 3;
+  return floor_and_fibo_hash<kBits, 0>(x * inverse_x) ^  //
+         floor_and_fibo_hash<kBits, 1>(y * inverse_y) ^  //
+         floor_and_fibo_hash<kBits, 2>(theta * inverse_theta);
+}
+
 /// Hashes a tuple or array of scalar types, using a resolution for each element and using the same
 /// amount of bits for them.
 /**
@@ -154,10 +193,11 @@ class spatial_hash<Tuple<Types...>, std::enable_if_t<(std::is_arithmetic_v<Types
 };
 
 /**
- * Specialization for Sophus::SE2d. Will calculate the spatial hash based on the translation and rotation.
+ * Specialization for Sophus::SE2 states of any scalar type. Will calculate the spatial hash
+ * based on the translation and rotation.
  */
-template <>
-class spatial_hash<Sophus::SE2d, void> {
+template <class Scalar>
+class spatial_hash<Sophus::SE2<Scalar>, void> {
  public:
   /// Constructs a spatial hasher given per-coordinate resolutions.
   /**
@@ -169,7 +209,9 @@ class spatial_hash<Sophus::SE2d, void> {
       double x_clustering_resolution,
       double y_clustering_resolution,
       double theta_clustering_resolution)
-      : underlying_hasher_{{x_clustering_resolution, y_clustering_resolution, theta_clustering_resolution}} {};
+      // Reciprocals are precomputed once so the hot path multiplies instead of divides.
+      : inverse_resolution_{
+            1. / x_clustering_resolution, 1. / y_clustering_resolution, 1. / theta_clustering_resolution} {};
 
   /// Constructs a spatial hasher given per-group resolutions.
   /**
@@ -182,20 +224,216 @@ class spatial_hash<Sophus::SE2d, void> {
   /// Default constructor
   spatial_hash() = default;
 
-  /// Calculates the tuple hash, using the given resolution for x, y and rotation given at construction time.
+  /// Calculates the state hash, using the resolutions for x, y and rotation given at construction time.
+  /**
+   * \param state The state to be hashed.
+   * \return The calculated hash.
+   */
+  std::size_t operator()(const Sophus::SE2<Scalar>& state) const {
+    const auto& position = state.translation();
+    return detail::hash_se2_cell(
+        static_cast<double>(position.x()), static_cast<double>(position.y()),
+        static_cast<double>(state.so2().log()),  //
+        inverse_resolution_[0], inverse_resolution_[1], inverse_resolution_[2]);
+  }
+
+  /// Calculates the hashes of a batch of states given as decomposed scalar columns.
+  /**
+   * The caller provides one contiguous column per pose component (see
+   * `beluga::SE2ColumnVector`), so the multiply-floor-convert math runs over plain
+   * scalar arrays in one tight loop the compiler can vectorize, instead of gathering
+   * interleaved pose data one state at a time.
+   *
+   * \param x X translation column, in meters.
+   * \param y Y translation column, in meters.
+   * \param cos_theta Cosine column of the rotation.
+   * \param sin_theta Sine column of the rotation.
+   * \param hashes Output column, one hash per state.
+   */
+  void operator()(
+      ranges::span<const double> x,
+      ranges::span<const double> y,
+      ranges::span<const double> cos_theta,
+      ranges::span<const double> sin_theta,
+      ranges::span<std::size_t> hashes) const {
+    const double inverse_x = inverse_resolution_[0];
+    const double inverse_y = inverse_resolution_[1];
+    const double inverse_theta = inverse_resolution_[2];
+    for (std::ptrdiff_t index = 0; index < x.size(); ++index) {
+      const double theta = std::atan2(sin_theta[index], cos_theta[index]);
+      hashes[index] = detail::hash_se2_cell(x[index], y[index], theta, inverse_x, inverse_y, inverse_theta);
+    }
+  }
+
+ private:
+  std::array<double, 3> inverse_resolution_{1., 1., 1.};
+};
+
+/**
+ * Specialization for Sophus::SE3 states of any scalar type. Will calculate the spatial
+ * hash based on the translation and a coarse axis-angle parameterization of the
+ * rotation, enabling KLD-adaptive sizing (see `beluga::views::take_while_kld`) for 3D
+ * filters.
+ *
+ * The six components (three translational, three rotational) are each hashed into a
+ * sixth of the 64 hash bits, following the same binning scheme as the SE2
+ * specialization. The rotation is bucketed through `Sophus::SO3::log()`, whose
+ * discontinuity at rotations of magnitude pi only splits buckets at the antipode, an
+ * acceptable coarsening for cluster counting.
+ */
+template <class Scalar>
+class spatial_hash<Sophus::SE3<Scalar>, void> {
+ public:
+  /// Constructs a spatial hasher given per-group resolutions.
+  /**
+   * \param linear_clustering_resolution Clustering resolution for translational coordinates, in meters.
+   * \param angular_clustering_resolution Clustering resolution for rotational coordinates, in radians.
+   */
+  explicit spatial_hash(double linear_clustering_resolution, double angular_clustering_resolution)
+      // Reciprocals are precomputed once so the hot path multiplies instead of divides.
+      : inverse_linear_resolution_{1. / linear_clustering_resolution},
+        inverse_angular_resolution_{1. / angular_clustering_resolution} {};
+
+  /// Default constructor
+  spatial_hash() = default;
+
+  /// Calculates the state hash, using the resolutions given at construction time.
   /**
    * \param state The state to be hashed.
    * \return The calculated hash.
    */
-  std::size_t operator()(const Sophus::SE2d& state) const {
+  std::size_t operator()(const Sophus::SE3<Scalar>& state) const {
+    constexpr auto kBits = std::numeric_limits<std::size_t>::digits / 6;
     const auto& position = state.translation();
-    return underlying_hasher_(std::make_tuple(position.x(), position.y(), state.so2().log()));
+    const auto rotation = state.so3().log();
+    return detail::floor_and_fibo_hash<kBits, 0>(static_cast<double>(position.x()) * inverse_linear_resolution_) ^
+           detail::floor_and_fibo_hash<kBits, 1>(static_cast<double>(position.y()) * inverse_linear_resolution_) ^
+           detail::floor_and_fibo_hash<kBits, 2>(static_cast<double>(position.z()) * inverse_linear_resolution_) ^
+           detail::floor_and_fibo_hash<kBits, 3>(static_cast<double>(rotation.x()) * inverse_angular_resolution_) ^
+           detail::floor_and_fibo_hash<kBits, 4>(static_cast<double>(rotation.y()) * inverse_angular_resolution_) ^
+           detail::floor_and_fibo_hash<kBits, 5>(static_cast<double>(rotation.z()) * inverse_angular_resolution_);
   }
 
  private:
-  spatial_hash<std::tuple<double, double, double>> underlying_hasher_{{1., 1., 1.}};
+  double inverse_linear_resolution_{1.};
+  double inverse_angular_resolution_{1.};
 };
 
+/// Spatial hasher for SE2 states with clustering resolutions fixed at compile time.
+/**
+ * Resolutions are expressed as `std::ratio` types, so their reciprocals fold into
+ * compile-time constants and the per-state cost reduces to constant multiplies.
+ * For equal resolutions it buckets states exactly like `spatial_hash<Sophus::SE2d>`.
+ *
+ * \tparam LinearResolution Clustering resolution for translational coordinates, in meters.
+ * \tparam AngularResolution Clustering resolution for rotational coordinates, in radians.
+ */
+template <class LinearResolution = std::ratio<1>, class AngularResolution = LinearResolution>
+class static_spatial_hash {
+ public:
+  /// Calculates the state hash with the compile-time resolutions.
+  /**
+   * \param state The state to be hashed.
+   * \return The calculated hash.
+   */
+  template <class Scalar>
+  std::size_t operator()(const Sophus::SE2<Scalar>& state) const {
+    const auto& position = state.translation();
+    return detail::hash_se2_cell(
+        static_cast<double>(position.x()), static_cast<double>(position.y()),
+        static_cast<double>(state.so2().log()),  //
+        kInverseLinear, kInverseLinear, kInverseAngular);
+  }
+
+  /// Calculates the hashes of a batch of states given as decomposed scalar columns.
+  /**
+   * \copydetails spatial_hash<Sophus::SE2<Scalar>, void>::operator()(ranges::span<const double>,
+   * ranges::span<const double>, ranges::span<const double>, ranges::span<const double>, ranges::span<std::size_t>) const
+   */
+  void operator()(
+      ranges::span<const double> x,
+      ranges::span<const double> y,
+      ranges::span<const double> cos_theta,
+      ranges::span<const double> sin_theta,
+      ranges::span<std::size_t> hashes) const {
+    for (std::ptrdiff_t index = 0; index < x.size(); ++index) {
+      const double theta = std::atan2(sin_theta[index], cos_theta[index]);
+      hashes[index] = detail::hash_se2_cell(x[index], y[index], theta, kInverseLinear, kInverseLinear, kInverseAngular);
+    }
+  }
+
+ private:
+  static constexpr double kInverseLinear =
+      static_cast<double>(LinearResolution::den) / static_cast<double>(LinearResolution::num);
+  static constexpr double kInverseAngular =
+      static_cast<double>(AngularResolution::den) / static_cast<double>(AngularResolution::num);
+};
+
+/// Suggests SE2 clustering resolutions from the spread of a particle set.
+/**
+ * Advisory helper for tuning the resolutions passed to `spatial_hash<Sophus::SE2d>`:
+ * it sizes each axis so that the one-sigma spread of the given states spans
+ * `cells_per_sigma` cells. At that scale the bucket count responds to genuine changes
+ * in distribution complexity, which is what the KLD bound needs: much coarser and the
+ * whole set collapses into a few buckets, much finer and nearly every sample opens a
+ * new bucket (see `beluga::KldBucketStatistics` for how to observe either failure
+ * mode on a live filter).
+ *
+ * The suggestion describes the spread at the time of the call; it is meant to be
+ * checked against the configured resolutions offline or logged, not fed back into a
+ * running filter, since re-clustering invalidates bucket count comparisons across
+ * updates.
+ *
+ * \tparam Range A range of `Sophus::SE2d` states.
+ * \param states The states to measure.
+ * \param cells_per_sigma Number of cells the one-sigma spread should span per axis.
+ * \return Array of x, y and theta clustering resolutions, suitable for the
+ * `spatial_hash<Sophus::SE2d>` constructor. Resolutions are floored at one millimeter
+ * and one milliradian so collapsed sets do not produce degenerate suggestions, and
+ * default to one meter and one radian when there are fewer than two states.
+ */
+template <class Range>
+std::array<double, 3> suggest_spatial_hash_resolution(Range&& states, double cells_per_sigma = 2.0) {
+  constexpr double kMinLinearResolution = 1e-3;   // meters
+  constexpr double kMinAngularResolution = 1e-3;  // radians
+
+  std::size_t count = 0;
+  double sum_x = 0.0;
+  double sum_y = 0.0;
+  double squared_sum_x = 0.0;
+  double squared_sum_y = 0.0;
+  double sum_cos = 0.0;
+  double sum_sin = 0.0;
+  for (const auto& state : states) {
+    const auto& position = state.translation();
+    sum_x += position.x();
+    sum_y += position.y();
+    squared_sum_x += position.x() * position.x();
+    squared_sum_y += position.y() * position.y();
+    sum_cos += state.so2().unit_complex().x();
+    sum_sin += state.so2().unit_complex().y();
+    ++count;
+  }
+
+  if (count < 2) {
+    return {1., 1., 1.};
+  }
+
+  const auto size = static_cast<double>(count);
+  const double sigma_x = std::sqrt(std::max(0.0, squared_sum_x / size - (sum_x / size) * (sum_x / size)));
+  const double sigma_y = std::sqrt(std::max(0.0, squared_sum_y / size - (sum_y / size) * (sum_y / size)));
+
+  // Circular standard deviation of the heading, from the mean resultant length.
+  const double resultant = std::min(1.0, std::hypot(sum_cos / size, sum_sin / size));
+  const double sigma_theta = resultant > 0.0 ? std::sqrt(-2.0 * std::log(resultant)) : Sophus::Constants<double>::pi();
+
+  return {
+      std::max(sigma_x / cells_per_sigma, kMinLinearResolution),
+      std::max(sigma_y / cells_per_sigma, kMinLinearResolution),
+      std::max(sigma_theta / cells_per_sigma, kMinAngularResolution),
+  };
+}
+
 }  // namespace beluga
 
 #endif
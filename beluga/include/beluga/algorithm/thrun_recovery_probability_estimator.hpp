@@ -16,6 +16,7 @@
 #define BELUGA_ALGORITHM_THRUN_RECOVERY_PROBABILITY_ESTIMATOR_HPP
 
 #include <beluga/algorithm/exponential_filter.hpp>
+#include <beluga/algorithm/weight_statistics.hpp>
 #include <beluga/type_traits/particle_traits.hpp>
 #include <beluga/views/particles.hpp>
 
@@ -75,7 +76,29 @@ class ThrunRecoveryProbabilityEstimator {
     }
 
     const double total_weight = ranges::accumulate(beluga::views::weights(range), 0.0);
-    const double average_weight = total_weight / static_cast<double>(size);
+    return update(total_weight / static_cast<double>(size));
+  }
+
+  /// Update the estimation based on precomputed weight statistics.
+  /**
+   * Avoids traversing the weights again when a `beluga::WeightStatistics` instance
+   * was already computed during the same filter update.
+   *
+   * \param statistics Weight statistics of the particle set, taken before normalization.
+   * \return The estimated random state probability to be used by the particle filter.
+   */
+  constexpr double operator()(const WeightStatistics& statistics) {
+    if (statistics.count == 0) {
+      reset();
+      return 0.0;
+    }
+
+    return update(statistics.average());
+  }
+
+ private:
+  /// Feed the average weight to both filters and derive the recovery probability.
+  constexpr double update(double average_weight) {
     const double fast_average = fast_filter_(average_weight);
     const double slow_average = slow_filter_(average_weight);
 
@@ -86,7 +109,6 @@ class ThrunRecoveryProbabilityEstimator {
     return std::clamp(1.0 - fast_average / slow_average, 0.0, 1.0);
   }
 
- private:
   ExponentialFilter slow_filter_;  ///< Exponential filter for the long-term average.
   ExponentialFilter fast_filter_;  ///< Exponential filter for the short-term average.
 };
@@ -0,0 +1,115 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ALGORITHM_VOXEL_DOWNSAMPLE_HPP
+#define BELUGA_ALGORITHM_VOXEL_DOWNSAMPLE_HPP
+
+#include <cstddef>
+#include <functional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+/**
+ * \file
+ * \brief Implementation of voxel-centroid downsampling for point cloud measurements.
+ */
+
+namespace beluga {
+
+namespace detail {
+
+/// Hash function for N dimensional Eigen::Vectors of int.
+/// The code is from `hash_combine` function of the Boost library. See
+/// http://www.boost.org/doc/libs/1_55_0/doc/html/hash/reference.html#boost.hash_combine .
+template <int N>
+struct CellHasher {
+  /// Hashes an integer N dimensional integer vector.
+  size_t operator()(const Eigen::Matrix<int, N, 1> vector) const {
+    size_t seed = 0;
+    for (auto i = 0L; i < vector.size(); ++i) {
+      auto elem = *(vector.data() + i);
+      seed ^= std::hash<int>()(elem) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    }
+    return seed;
+  }
+};
+
+}  // namespace detail
+
+/// Reduces a point cloud to one centroid per occupied voxel, with multiplicity.
+/**
+ * Points are binned into axis-aligned voxels of the given resolution (same
+ * binning convention as the NDT measurement cell construction, see
+ * `beluga::detail::to_cells()`) and each occupied voxel is replaced by the
+ * centroid of its member points together with their count. Run once per cloud
+ * before conditioning a point-wise sensor model, this cuts the per-particle
+ * evaluation cost proportionally to the cloud redundancy at that resolution,
+ * and the multiplicity lets consumers weight each representative by the number
+ * of returns it stands for.
+ *
+ * \param points Point cloud, as a sized random access range of fixed size Eigen vectors.
+ * \param resolution Voxel edge length, typically matched to the grid resolution
+ *  of the consuming sensor model (e.g. `beluga::SparseValueGrid::resolution()`).
+ * \return One (centroid, point count) pair per occupied voxel, in unspecified order.
+ */
+template <int NDim, typename Scalar = double, class Range>
+[[nodiscard]] std::vector<std::pair<Eigen::Matrix<Scalar, NDim, 1>, std::size_t>> voxel_downsample_with_multiplicity(
+    const Range& points,
+    double resolution) {
+  struct Accumulator {
+    std::size_t count = 0;
+    Eigen::Matrix<Scalar, NDim, 1> sum = Eigen::Matrix<Scalar, NDim, 1>::Zero();
+  };
+  auto accumulators =
+      std::unordered_map<Eigen::Matrix<int, NDim, 1>, Accumulator, detail::CellHasher<NDim>>{points.size()};
+  for (std::size_t index = 0; index < points.size(); ++index) {
+    const Eigen::Matrix<Scalar, NDim, 1> point = points[index].template cast<Scalar>();
+    auto& accumulator = accumulators[(point / resolution).template cast<int>()];
+    ++accumulator.count;
+    accumulator.sum += point;
+  }
+  std::vector<std::pair<Eigen::Matrix<Scalar, NDim, 1>, std::size_t>> ret;
+  ret.reserve(accumulators.size());
+  for (const auto& [cell, accumulator] : accumulators) {
+    ret.emplace_back(accumulator.sum / static_cast<Scalar>(accumulator.count), accumulator.count);
+  }
+  return ret;
+}
+
+/// Reduces a point cloud to one centroid per occupied voxel.
+/**
+ * As `voxel_downsample_with_multiplicity()`, dropping the per-voxel counts for
+ * consumers that treat every representative point alike.
+ *
+ * \param points Point cloud, as a sized random access range of fixed size Eigen vectors.
+ * \param resolution Voxel edge length.
+ * \return One centroid per occupied voxel, in unspecified order.
+ */
+template <int NDim, typename Scalar = double, class Range>
+[[nodiscard]] std::vector<Eigen::Matrix<Scalar, NDim, 1>> voxel_downsample(const Range& points, double resolution) {
+  std::vector<Eigen::Matrix<Scalar, NDim, 1>> ret;
+  auto centroids = voxel_downsample_with_multiplicity<NDim, Scalar>(points, resolution);
+  ret.reserve(centroids.size());
+  for (auto& [centroid, count] : centroids) {
+    ret.push_back(std::move(centroid));
+  }
+  return ret;
+}
+
+}  // namespace beluga
+
+#endif
@@ -0,0 +1,240 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ALGORITHM_WEIGHT_STATISTICS_HPP
+#define BELUGA_ALGORITHM_WEIGHT_STATISTICS_HPP
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/utility/thread_pool.hpp>
+#include <beluga/views/particles.hpp>
+
+#include <range/v3/view/common.hpp>
+
+/**
+ * \file
+ * \brief Implementation of aggregate weight statistics for particle ranges.
+ */
+
+namespace beluga {
+
+/// Aggregate statistics over the weights of a particle set.
+/**
+ * Several stages of a particle filter update need reductions over the same weight
+ * column: normalization needs the sum, the effective sample size needs the sum of
+ * squares, and recovery probability estimation needs the average. Computing them
+ * together in a single pass and sharing the result avoids repeated traversals of
+ * the particle set within one filter update.
+ *
+ * Both reductions are scale invariant where it matters: the effective sample size
+ * derived from these statistics is the same whether they were taken before or after
+ * weight normalization.
+ *
+ * The same pass also accumulates degeneracy telemetry: weight extrema, the term
+ * needed to derive the weight entropy, and a coarse histogram of weights by binary
+ * order of magnitude below the peak. All of it is invariant under weight scaling,
+ * and none of it requires a separate traversal of the particle set.
+ */
+struct WeightStatistics {
+  /// Number of coarse histogram buckets; see `histogram`.
+  static constexpr std::size_t kHistogramBucketCount = 8;
+  /// Sentinel value of `top_exponent` before any positive weight was seen.
+  static constexpr int kNoExponent = std::numeric_limits<int>::min();
+
+  /// Sum of all weights.
+  double sum = 0.0;
+  /// Sum of the squared weights.
+  double squared_sum = 0.0;
+  /// Number of weights.
+  std::size_t count = 0;
+  /// Largest weight seen.
+  double max = 0.0;
+  /// Smallest weight seen, or infinity for an empty set.
+  double min = std::numeric_limits<double>::infinity();
+  /// Sum of `w * log2(w)` over the positive weights, to derive the entropy.
+  double weighted_log_sum = 0.0;
+  /// Coarse histogram of weights by binary order of magnitude below the peak.
+  /**
+   * `histogram[i]` counts the weights whose binary exponent is `i` octaves below
+   * that of the largest weight seen; the last bucket is a catch-all for weights
+   * even further below, including zero weights. A healthy particle set keeps its
+   * counts near the front; mass pooling in the catch-all bucket means most
+   * particles carry a vanishing fraction of the peak weight, i.e. degeneracy.
+   */
+  std::array<std::size_t, kHistogramBucketCount> histogram = {};
+  /// Binary exponent of the largest positive weight seen, anchoring `histogram`.
+  int top_exponent = kNoExponent;
+
+  /// Folds a single weight into the statistics.
+  void add(double value) {
+    sum += value;
+    squared_sum += value * value;
+    ++count;
+    min = std::min(min, value);
+    if (value > 0.0) {
+      max = std::max(max, value);
+      weighted_log_sum += value * std::log2(value);
+      const int exponent = std::ilogb(value);
+      if (top_exponent == kNoExponent) {
+        top_exponent = exponent;
+      } else if (exponent > top_exponent) {
+        shift_towards_tail(histogram, static_cast<std::size_t>(exponent - top_exponent));
+        top_exponent = exponent;
+      }
+      const auto offset = std::min(static_cast<std::size_t>(top_exponent - exponent), kHistogramBucketCount - 1);
+      ++histogram[offset];
+    } else {
+      ++histogram[kHistogramBucketCount - 1];
+    }
+  }
+
+  /// Merges the statistics accumulated by another instance, as if taken over the union of both sets.
+  void merge(const WeightStatistics& other) {
+    sum += other.sum;
+    squared_sum += other.squared_sum;
+    count += other.count;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+    weighted_log_sum += other.weighted_log_sum;
+    auto other_histogram = other.histogram;
+    if (other.top_exponent != kNoExponent) {
+      // Re-anchor both histograms at the binary exponent of the joint peak.
+      if (top_exponent == kNoExponent) {
+        top_exponent = other.top_exponent;
+      } else if (other.top_exponent > top_exponent) {
+        shift_towards_tail(histogram, static_cast<std::size_t>(other.top_exponent - top_exponent));
+        top_exponent = other.top_exponent;
+      } else if (other.top_exponent < top_exponent) {
+        shift_towards_tail(other_histogram, static_cast<std::size_t>(top_exponent - other.top_exponent));
+      }
+    }
+    for (std::size_t index = 0; index < kHistogramBucketCount; ++index) {
+      histogram[index] += other_histogram[index];
+    }
+  }
+
+  /// Returns the average weight, or zero for an empty set.
+  [[nodiscard]] constexpr double average() const noexcept {
+    return count > 0 ? sum / static_cast<double>(count) : 0.0;
+  }
+
+  /// Returns the Shannon entropy of the normalized weights, in bits.
+  /**
+   * Invariant under weight scaling, so it is the same whether the statistics were
+   * taken before or after normalization. Ranges from zero (all of the mass on a
+   * single particle) to `log2(count)` (uniform weights); a drop towards zero is
+   * the earliest global signal of weight degeneracy.
+   */
+  [[nodiscard]] double entropy() const noexcept { return sum > 0.0 ? std::log2(sum) - weighted_log_sum / sum : 0.0; }
+
+  /// Returns the ratio between the largest and the smallest weights.
+  /**
+   * Infinity when some weight was zero, and zero for an empty set.
+   */
+  [[nodiscard]] double max_min_ratio() const noexcept {
+    if (count == 0) {
+      return 0.0;
+    }
+    return min > 0.0 ? max / min : std::numeric_limits<double>::infinity();
+  }
+
+ private:
+  /// Moves histogram counts `delta` buckets away from the peak, saturating into the catch-all bucket.
+  static void shift_towards_tail(std::array<std::size_t, kHistogramBucketCount>& buckets, std::size_t delta) {
+    if (delta == 0) {
+      return;
+    }
+    auto shifted = std::array<std::size_t, kHistogramBucketCount>{};
+    for (std::size_t index = 0; index < kHistogramBucketCount; ++index) {
+      shifted[std::min(index + delta, kHistogramBucketCount - 1)] += buckets[index];
+    }
+    buckets = shifted;
+  }
+};
+
+/// Computes weight statistics from a range of weights in a single pass.
+/**
+ * \tparam Range A [forward range](https://en.cppreference.com/w/cpp/ranges/forward_range).
+ * \param range The range of weights.
+ */
+template <class Range, std::enable_if_t<!is_particle_range_v<Range>, int> = 0>
+WeightStatistics weight_statistics(Range&& range) {
+  WeightStatistics statistics;
+  for (auto&& weight : range) {
+    statistics.add(static_cast<double>(weight));
+  }
+  return statistics;
+}
+
+/// Overload for particle ranges.
+template <class Range, std::enable_if_t<is_particle_range_v<Range>, int> = 0>
+WeightStatistics weight_statistics(Range&& range) {
+  return weight_statistics(range | beluga::views::weights);
+}
+
+/// Overload taking an execution policy.
+/**
+ * Runs the reduction as a single `transform_reduce` under the given policy. Over
+ * contiguous weight storage (see `beluga::views::weights` on `beluga::TupleVector`)
+ * the sequenced and unsequenced policies reduce over raw pointers, which vectorizes;
+ * the parallel policies partition the pass across the worker pool.
+ *
+ * \param policy The execution policy to use.
+ * \param range The range of weights.
+ */
+template <
+    class ExecutionPolicy,
+    class Range,
+    std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+    std::enable_if_t<!is_particle_range_v<Range>, int> = 0>
+WeightStatistics weight_statistics(ExecutionPolicy&& policy, Range&& range) {
+  auto weights = range | ranges::views::common;
+
+  const auto combine = [](WeightStatistics first, const WeightStatistics& second) {
+    first.merge(second);
+    return first;
+  };
+
+  return beluga::execution::transform_reduce(
+      std::forward<ExecutionPolicy>(policy),  //
+      std::begin(weights),                    //
+      std::end(weights),                      //
+      WeightStatistics{}, combine, [](const auto weight) {
+        WeightStatistics partial;
+        partial.add(static_cast<double>(weight));
+        return partial;
+      });
+}
+
+/// Overload taking an execution policy, for particle ranges.
+template <
+    class ExecutionPolicy,
+    class Range,
+    std::enable_if_t<beluga::is_execution_policy_v<std::decay_t<ExecutionPolicy>>, int> = 0,
+    std::enable_if_t<is_particle_range_v<Range>, int> = 0>
+WeightStatistics weight_statistics(ExecutionPolicy&& policy, Range&& range) {
+  return weight_statistics(std::forward<ExecutionPolicy>(policy), range | beluga::views::weights);
+}
+
+}  // namespace beluga
+
+#endif
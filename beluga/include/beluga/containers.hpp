@@ -16,6 +16,10 @@
 #define BELUGA_CONTAINERS_HPP
 
 #include <beluga/containers/circular_array.hpp>
+#include <beluga/containers/fixed_tuple_array.hpp>
+#include <beluga/containers/flat_grid_map.hpp>
+#include <beluga/containers/flat_hash_set.hpp>
+#include <beluga/containers/se2_column_vector.hpp>
 #include <beluga/containers/tuple_vector.hpp>
 
 /**
@@ -0,0 +1,178 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_CONTAINERS_FIXED_TUPLE_ARRAY_HPP
+#define BELUGA_CONTAINERS_FIXED_TUPLE_ARRAY_HPP
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+#include <beluga/containers/tuple_vector.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a fixed-capacity tuple of containers.
+ */
+
+namespace beluga {
+
+/// A fixed-capacity array with a dynamic element count.
+/**
+ * Like `beluga::CircularArray`, storage is embedded in the object itself (no heap use),
+ * with a compile-time maximum size and a run-time element count. Unlike a circular array,
+ * elements are laid out contiguously from the start of the storage, so it can serve as an
+ * internal container of `beluga::TupleContainer` and be iterated with plain pointers.
+ *
+ * All `N` elements are default constructed eagerly; `size()` only tracks how many of them
+ * are currently in use.
+ *
+ * \tparam T Element type of the array.
+ * \tparam N Maximum (and only) capacity of the array.
+ */
+template <class T, std::size_t N>
+class FixedCapacityVector {
+ public:
+  /// Value type of the container.
+  using value_type = T;
+
+  /// Size type of the container.
+  using size_type = std::size_t;
+
+  /// Difference type of the container.
+  using difference_type = std::ptrdiff_t;
+
+  /// Iterator type of the container.
+  using iterator = T*;
+
+  /// Const iterator type of the container.
+  using const_iterator = const T*;
+
+  /// Default constructor, all elements are default constructed and the count is zero.
+  constexpr FixedCapacityVector() = default;
+
+  /// Constructs a container with `count` elements in use.
+  /**
+   * \param count Initial size of the container, must not exceed `N`.
+   */
+  explicit constexpr FixedCapacityVector(size_type count) : size_{count} { assert(count <= N); }
+
+  /// Returns true if the container is empty.
+  [[nodiscard]] constexpr bool empty() const noexcept { return size_ == 0; }
+
+  /// Returns the size of the container.
+  [[nodiscard]] constexpr size_type size() const noexcept { return size_; }
+
+  /// Returns the capacity of the container, always `N`.
+  [[nodiscard]] constexpr size_type capacity() const noexcept { return N; }
+
+  /// Returns the maximum size of the container, always `N`.
+  [[nodiscard]] static constexpr size_type max_size() noexcept { return N; }
+
+  /// Clears the container. No element is destroyed, the count is simply reset.
+  constexpr void clear() noexcept { size_ = 0; }
+
+  /// No-op, storage is embedded and always sized for `N` elements.
+  /**
+   * \param new_cap Requested capacity, must not exceed `N`.
+   */
+  constexpr void reserve([[maybe_unused]] size_type new_cap) noexcept { assert(new_cap <= N); }
+
+  /// No-op, storage is embedded and cannot be released.
+  constexpr void shrink_to_fit() noexcept {}
+
+  /// Resizes the container by adjusting the element count.
+  /**
+   * \param count New size of the container, must not exceed `N`.
+   */
+  constexpr void resize(size_type count) {
+    assert(count <= N);
+    size_ = count;
+  }
+
+  /// Adds an element at the end of the container.
+  /**
+   * \param value The element to be appended, the count must be less than `N`.
+   */
+  constexpr void push_back(const value_type& value) {
+    assert(size_ < N);
+    data_[size_++] = value;
+  }
+
+  /// \overload
+  constexpr void push_back(value_type&& value) {
+    assert(size_ < N);
+    data_[size_++] = std::move(value);
+  }
+
+  /// Returns a reference to the element at the given position.
+  [[nodiscard]] constexpr T& operator[](size_type index) { return data_[index]; }
+
+  /// \overload
+  [[nodiscard]] constexpr const T& operator[](size_type index) const { return data_[index]; }
+
+  /// Returns a pointer to the underlying storage.
+  [[nodiscard]] constexpr T* data() noexcept { return data_.data(); }
+
+  /// \overload
+  [[nodiscard]] constexpr const T* data() const noexcept { return data_.data(); }
+
+  /// Returns an iterator to the first element of the container.
+  [[nodiscard]] constexpr iterator begin() noexcept { return data_.data(); }
+
+  /// Returns an iterator past the last element of the container.
+  [[nodiscard]] constexpr iterator end() noexcept { return data_.data() + size_; }
+
+  /// \overload
+  [[nodiscard]] constexpr const_iterator begin() const noexcept { return data_.data(); }
+
+  /// \overload
+  [[nodiscard]] constexpr const_iterator end() const noexcept { return data_.data() + size_; }
+
+ private:
+  std::array<T, N> data_{};
+  size_type size_{0};
+};
+
+namespace detail {
+
+/// Binds a compile-time capacity so the fixed-capacity vector can be used as an internal
+/// container of `beluga::TupleContainer`.
+template <std::size_t N>
+struct fixed_capacity_vector {
+  /// Fixed-capacity vector alias with the bound capacity.
+  template <class T>
+  using type = FixedCapacityVector<T, N>;
+};
+
+}  // namespace detail
+
+/// Shorthand for a tuple of fixed-capacity arrays with a shared dynamic element count.
+/**
+ * A heap-free sibling of `beluga::TupleVector` with a compile-time maximum size and a
+ * run-time count, for deployments that cannot tolerate heap use after startup.
+ *
+ * \tparam T Element (tuple) type of the container.
+ * \tparam N Maximum capacity of the container.
+ */
+template <class T, std::size_t N>
+class FixedTupleArray : public TupleContainer<detail::fixed_capacity_vector<N>::template type, T> {
+  /// Inherited constructors.
+  using TupleContainer<detail::fixed_capacity_vector<N>::template type, T>::TupleContainer;
+};
+
+}  // namespace beluga
+
+#endif
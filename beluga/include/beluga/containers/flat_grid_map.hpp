@@ -0,0 +1,218 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_CONTAINERS_FLAT_GRID_MAP_HPP
+#define BELUGA_CONTAINERS_FLAT_GRID_MAP_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <beluga/utility/aligned_allocator.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a flat open-addressing map from grid cells to values.
+ */
+
+namespace beluga {
+
+/// A flat open-addressing map from integer grid cells to values.
+/**
+ * This is a drop-in backend for `beluga::SparseValueGrid` that replaces node-based
+ * associative containers in hot lookup paths, such as NDT cell queries performed
+ * once per measurement point per particle. Entries are stored contiguously in a
+ * single over-aligned array, and lookups resolve through a separate power-of-two
+ * index table with linear probing, so a `find()` touches at most two cache lines
+ * in the common case instead of chasing node pointers.
+ *
+ * It implements the subset of the standard associative container API that
+ * `SparseValueGrid` and the NDT map loaders rely on: `at()`, `find()`, `size()`,
+ * iteration over entries, and `operator[]` for incremental builds. A bulk-build
+ * constructor from an entry vector is also provided for map loading. Unlike
+ * `std::unordered_map`, insertion may invalidate references and iterators into
+ * the entry storage; lookups never do.
+ *
+ * \tparam Key Cell index type, an integer `Eigen::Matrix<int, N, 1>` vector.
+ * \tparam T Mapped value type.
+ */
+template <class Key, class T>
+class FlatGridMap {
+ public:
+  /// Key type of the map entries.
+  using key_type = Key;
+  /// Mapped type of the map entries.
+  using mapped_type = T;
+  /// Type of the map entries.
+  using value_type = std::pair<Key, T>;
+  /// Size type of the map.
+  using size_type = std::size_t;
+  /// Contiguous entry storage type.
+  using storage_type = std::vector<value_type, AlignedAllocator<value_type>>;
+  /// Constant iterator over the map entries.
+  using const_iterator = typename storage_type::const_iterator;
+
+  /// Constructs an empty map.
+  FlatGridMap() = default;
+
+  /// Constructs a map from an initializer list of entries.
+  FlatGridMap(std::initializer_list<value_type> init) {
+    reserve(init.size());
+    for (const auto& entry : init) {
+      (*this)[entry.first] = entry.second;
+    }
+  }
+
+  /// Bulk-builds a map from an entry vector.
+  /**
+   * The index table is sized once for the full entry count, so building does not
+   * rehash. Duplicate keys keep the last value, matching repeated insertion.
+   *
+   * \param entries Entries to build the map from.
+   */
+  explicit FlatGridMap(storage_type entries) {
+    reserve(entries.size());
+    for (auto& entry : entries) {
+      (*this)[entry.first] = std::move(entry.second);
+    }
+  }
+
+  /// Returns the number of entries in the map.
+  [[nodiscard]] size_type size() const noexcept { return entries_.size(); }
+
+  /// Returns true if the map contains no entries.
+  [[nodiscard]] bool empty() const noexcept { return entries_.empty(); }
+
+  /// Returns an iterator to the first entry.
+  [[nodiscard]] const_iterator begin() const noexcept { return entries_.begin(); }
+
+  /// Returns a past-the-end iterator over the entries.
+  [[nodiscard]] const_iterator end() const noexcept { return entries_.end(); }
+
+  /// Gets direct access to the contiguous entry storage.
+  [[nodiscard]] const storage_type& entries() const noexcept { return entries_; }
+
+  /// Grows the map so it can hold at least the given number of entries without rehashing.
+  void reserve(size_type capacity) {
+    entries_.reserve(capacity);
+    size_type table_size = kMinTableSize;
+    while (table_size < capacity * 2) {
+      table_size *= 2;
+    }
+    if (table_size > table_.size()) {
+      rehash(table_size);
+    }
+  }
+
+  /// Returns the value mapped to a key.
+  /**
+   * \param key Key of the entry to look up.
+   * \throws std::out_of_range if the key is not present.
+   */
+  [[nodiscard]] const T& at(const Key& key) const {
+    const size_type entry = lookup(key);
+    if (entry == kEmpty) {
+      throw std::out_of_range{"FlatGridMap: key not found"};
+    }
+    return entries_[entry].second;
+  }
+
+  /// Finds the entry mapped to a key.
+  /**
+   * \param key Key of the entry to look up.
+   * \return An iterator to the matching entry, or `end()` if the key is not present.
+   */
+  [[nodiscard]] const_iterator find(const Key& key) const noexcept {
+    const size_type entry = lookup(key);
+    return entry != kEmpty ? entries_.begin() + static_cast<std::ptrdiff_t>(entry) : entries_.end();
+  }
+
+  /// Returns a reference to the value mapped to a key, inserting a default-constructed value if absent.
+  T& operator[](const Key& key) {
+    if (table_.empty()) {
+      rehash(kMinTableSize);
+    }
+    size_type index = slot_index(key);
+    while (table_[index] != kEmpty) {
+      if (entries_[table_[index]].first == key) {
+        return entries_[table_[index]].second;
+      }
+      index = (index + 1) & (table_.size() - 1);
+    }
+    table_[index] = entries_.size();
+    entries_.emplace_back(key, T{});
+    if (entries_.size() * 2 > table_.size()) {
+      rehash(table_.size() * 2);
+    }
+    return entries_.back().second;
+  }
+
+ private:
+  static constexpr size_type kMinTableSize = 16;
+  static constexpr size_type kEmpty = std::numeric_limits<size_type>::max();
+
+  [[nodiscard]] static size_type hash(const Key& key) noexcept {
+    // Fibonacci hashing over the cell coordinates, to spread clustered cells across the table.
+    std::uint64_t seed = 0;
+    for (Eigen::Index i = 0; i < key.size(); ++i) {
+      seed = (seed ^ static_cast<std::uint64_t>(static_cast<std::uint32_t>(key[i]))) * 0x9E3779B97F4A7C15ULL;
+    }
+    return static_cast<size_type>(seed >> 32U);
+  }
+
+  [[nodiscard]] size_type slot_index(const Key& key) const noexcept {
+    assert(!table_.empty());
+    return hash(key) & (table_.size() - 1);
+  }
+
+  [[nodiscard]] size_type lookup(const Key& key) const noexcept {
+    if (table_.empty()) {
+      return kEmpty;
+    }
+    size_type index = slot_index(key);
+    while (table_[index] != kEmpty) {
+      if (entries_[table_[index]].first == key) {
+        return table_[index];
+      }
+      index = (index + 1) & (table_.size() - 1);
+    }
+    return kEmpty;
+  }
+
+  void rehash(size_type table_size) {
+    assert((table_size & (table_size - 1)) == 0);
+    table_.assign(table_size, kEmpty);
+    for (size_type entry = 0; entry < entries_.size(); ++entry) {
+      size_type index = slot_index(entries_[entry].first);
+      while (table_[index] != kEmpty) {
+        index = (index + 1) & (table_.size() - 1);
+      }
+      table_[index] = entry;
+    }
+  }
+
+  storage_type entries_;
+  std::vector<size_type> table_;
+};
+
+}  // namespace beluga
+
+#endif
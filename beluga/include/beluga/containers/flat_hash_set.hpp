@@ -0,0 +1,173 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_CONTAINERS_FLAT_HASH_SET_HPP
+#define BELUGA_CONTAINERS_FLAT_HASH_SET_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \brief Implementation of a flat open-addressing hash set for unsigned integer keys.
+ */
+
+namespace beluga {
+
+/// A flat open-addressing hash set for unsigned integer keys.
+/**
+ * This is a minimal replacement for `std::unordered_set` in hot paths that only need
+ * insertion and a unique key count, such as bucket tracking during KLD resampling.
+ * Keys are stored inline in a single power-of-two sized array with linear probing,
+ * so inserting never allocates a node and clearing retains the table capacity for
+ * reuse across cycles.
+ *
+ * The maximum representable key value is reserved as the empty slot sentinel and
+ * tracked separately, so the full key domain is still supported.
+ *
+ * \tparam Key Key type. It must be an unsigned integer type.
+ * \tparam Allocator Allocator backing the slot array, so the table can be carved out
+ *  of an arena (e.g. through `std::pmr::polymorphic_allocator`) in per-cycle scratch
+ *  use cases.
+ */
+template <class Key = std::size_t, class Allocator = std::allocator<Key>>
+class FlatHashSet {
+ public:
+  static_assert(std::is_unsigned_v<Key>, "FlatHashSet only supports unsigned integer keys");
+
+  /// Value type of the set.
+  using value_type = Key;
+  /// Size type of the set.
+  using size_type = std::size_t;
+  /// Allocator type backing the slot array.
+  using allocator_type = Allocator;
+
+  /// Constructs an empty set with a small default capacity.
+  FlatHashSet() : FlatHashSet(kMinCapacity) {}
+
+  /// Constructs an empty set with at least the given capacity.
+  /**
+   * \param capacity Number of keys the set should be able to hold without rehashing.
+   * \param allocator Allocator backing the slot array.
+   */
+  explicit FlatHashSet(size_type capacity, const Allocator& allocator = Allocator()) : slots_(allocator) {
+    reserve(capacity);
+  }
+
+  /// Returns the number of unique keys in the set.
+  [[nodiscard]] size_type size() const noexcept { return size_ + (contains_sentinel_ ? 1 : 0); }
+
+  /// Returns true if the set contains no keys.
+  [[nodiscard]] bool empty() const noexcept { return size() == 0; }
+
+  /// Returns the number of keys the set can hold before rehashing.
+  [[nodiscard]] size_type capacity() const noexcept { return slots_.size() / 2; }
+
+  /// Removes all keys from the set, retaining the table capacity.
+  void clear() noexcept {
+    std::fill(slots_.begin(), slots_.end(), kEmpty);
+    size_ = 0;
+    contains_sentinel_ = false;
+  }
+
+  /// Grows the table so it can hold at least the given number of keys without rehashing.
+  void reserve(size_type capacity) {
+    size_type table_size = kMinCapacity * 2;
+    while (table_size < capacity * 2) {
+      table_size *= 2;
+    }
+    if (table_size > slots_.size()) {
+      rehash(table_size);
+    }
+  }
+
+  /// Checks whether a key is in the set.
+  [[nodiscard]] bool contains(Key key) const noexcept {
+    if (key == kEmpty) {
+      return contains_sentinel_;
+    }
+    size_type index = slot_index(key);
+    while (slots_[index] != kEmpty) {
+      if (slots_[index] == key) {
+        return true;
+      }
+      index = (index + 1) & (slots_.size() - 1);
+    }
+    return false;
+  }
+
+  /// Inserts a key into the set.
+  /**
+   * \param key Key to insert.
+   * \return true if the key was not already present.
+   */
+  bool insert(Key key) {
+    if (key == kEmpty) {
+      return !std::exchange(contains_sentinel_, true);
+    }
+    size_type index = slot_index(key);
+    while (slots_[index] != kEmpty) {
+      if (slots_[index] == key) {
+        return false;
+      }
+      index = (index + 1) & (slots_.size() - 1);
+    }
+    slots_[index] = key;
+    ++size_;
+    if (size_ * 2 > slots_.size()) {
+      rehash(slots_.size() * 2);
+    }
+    return true;
+  }
+
+ private:
+  static constexpr size_type kMinCapacity = 8;
+  static constexpr Key kEmpty = std::numeric_limits<Key>::max();
+  // Fibonacci hashing constant, used to spread clustered keys across the table.
+  static constexpr Key kMultiplier = static_cast<Key>(0x9E3779B97F4A7C15ULL);
+
+  [[nodiscard]] size_type slot_index(Key key) const noexcept {
+    assert(!slots_.empty());
+    return static_cast<size_type>(key * kMultiplier) & (slots_.size() - 1);
+  }
+
+  void rehash(size_type table_size) {
+    assert((table_size & (table_size - 1)) == 0);
+    std::vector<Key, Allocator> old_slots =
+        std::exchange(slots_, std::vector<Key, Allocator>(table_size, kEmpty, slots_.get_allocator()));
+    for (const Key key : old_slots) {
+      if (key != kEmpty) {
+        size_type index = slot_index(key);
+        while (slots_[index] != kEmpty) {
+          index = (index + 1) & (slots_.size() - 1);
+        }
+        slots_[index] = key;
+      }
+    }
+  }
+
+  std::vector<Key, Allocator> slots_;
+  size_type size_ = 0;
+  bool contains_sentinel_ = false;
+};
+
+}  // namespace beluga
+
+#endif
@@ -0,0 +1,310 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_CONTAINERS_SE2_COLUMN_VECTOR_HPP
+#define BELUGA_CONTAINERS_SE2_COLUMN_VECTOR_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#include <beluga/containers/tuple_vector.hpp>
+#include <beluga/utility/aligned_allocator.hpp>
+#include <range/v3/iterator/basic_iterator.hpp>
+#include <range/v3/view/span.hpp>
+
+#include <sophus/se2.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a vector of SE2 elements with decomposed scalar storage.
+ */
+
+namespace beluga {
+
+/// A dynamic array of SE2 elements stored as four scalar columns (x, y, cos θ, sin θ).
+/**
+ * Iterating over whole `Sophus::SE2` elements loads interleaved rotation and translation
+ * data, which defeats vectorization of hot per-particle loops. This container keeps each
+ * pose component in its own contiguous, cache-line-aligned column, while presenting a
+ * vector-like interface of `Sophus::SE2<Scalar>` values. Reads recompose a pose on the
+ * fly and writes decompose it back into the columns, so it can be used as an internal
+ * container of `beluga::TupleContainer` and remain compatible with existing
+ * `beluga::views::states` consumers.
+ *
+ * \tparam Scalar Scalar type of the pose components.
+ * \tparam Allocator Allocator for the scalar columns.
+ */
+template <class Scalar, class Allocator = AlignedAllocator<Scalar, 64>>
+class SE2ColumnVector {
+ public:
+  /// Value type of the container.
+  using value_type = Sophus::SE2<Scalar>;
+
+  /// Size type of the container.
+  using size_type = std::size_t;
+
+  /// Difference type of the container.
+  using difference_type = std::ptrdiff_t;
+
+ private:
+  /// Cursor class that handles the iteration logic.
+  /**
+   * Reads recompose a `Sophus::SE2<Scalar>` from the scalar columns, and writes (only
+   * available for mutable cursors) decompose a pose back into them. `ranges::basic_iterator`
+   * turns this into a random access (proxy) iterator.
+   */
+  template <bool Const>
+  struct cursor {
+    /// Container type, possibly const qualified.
+    using container_type = std::conditional_t<Const, const SE2ColumnVector, SE2ColumnVector>;
+
+    /// Value type to be used by `ranges::basic_iterator`.
+    using value_type = SE2ColumnVector::value_type;
+
+    /// Default constructor. Cursor will point nowhere.
+    cursor() = default;
+
+    /// Constructs a cursor over `container` at position `index`.
+    explicit cursor(container_type* container, size_type index) : container_{container}, index_{index} {}
+
+    /// Converting constructor from a mutable cursor.
+    template <bool C = Const, std::enable_if_t<C, int> = 0>
+    cursor(const cursor<false>& other) : container_{other.container_}, index_{other.index_} {}  // NOLINT
+
+    /// Recomposes the pose at the current position.
+    [[nodiscard]] value_type read() const { return container_->recompose(index_); }
+
+    /// Decomposes a pose into the columns at the current position.
+    template <bool C = Const, std::enable_if_t<!C, int> = 0>
+    void write(const value_type& pose) const {
+      container_->decompose(index_, pose);
+    }
+
+    /// Advances the cursor one position.
+    void next() { ++index_; }
+
+    /// Rewinds the cursor one position.
+    void prev() { --index_; }
+
+    /// Advances the cursor a given offset.
+    void advance(difference_type offset) {
+      index_ = static_cast<size_type>(static_cast<difference_type>(index_) + offset);
+    }
+
+    /// Computes the distance to another cursor.
+    [[nodiscard]] difference_type distance_to(const cursor& other) const {
+      return static_cast<difference_type>(other.index_) - static_cast<difference_type>(index_);
+    }
+
+    /// Checks whether two cursors are at the same position.
+    [[nodiscard]] bool equal(const cursor& other) const { return index_ == other.index_; }
+
+    /// Target container.
+    container_type* container_{nullptr};
+    /// Current position in the target container.
+    size_type index_{0};
+  };
+
+ public:
+  /// Iterator type of the container, a proxy iterator over recomposed poses.
+  using iterator = ranges::basic_iterator<cursor<false>>;
+
+  /// Const iterator type of the container.
+  using const_iterator = ranges::basic_iterator<cursor<true>>;
+
+  /// Reference type of the container.
+  using reference = ranges::iter_reference_t<iterator>;
+
+  /// Default constructor, all columns are empty.
+  SE2ColumnVector() = default;
+
+  /// Constructs a container of size count, all poses are identity.
+  /**
+   * \param count Size of the container.
+   */
+  explicit SE2ColumnVector(size_type count) { resize(count); }
+
+  /// Constructs an empty container with a given allocator for the scalar columns.
+  /**
+   * \param alloc Allocator instance for the scalar columns.
+   */
+  explicit SE2ColumnVector(const Allocator& alloc) : x_{alloc}, y_{alloc}, cos_{alloc}, sin_{alloc} {}
+
+  /// Returns true if the container is empty.
+  [[nodiscard]] bool empty() const noexcept { return x_.empty(); }
+
+  /// Returns the size of the container.
+  [[nodiscard]] size_type size() const noexcept { return x_.size(); }
+
+  /// Returns the capacity of the container.
+  [[nodiscard]] size_type capacity() const noexcept { return x_.capacity(); }
+
+  /// Clears the container.
+  void clear() noexcept {
+    x_.clear();
+    y_.clear();
+    cos_.clear();
+    sin_.clear();
+  }
+
+  /// Releases unused capacity in all columns.
+  void shrink_to_fit() {
+    x_.shrink_to_fit();
+    y_.shrink_to_fit();
+    cos_.shrink_to_fit();
+    sin_.shrink_to_fit();
+  }
+
+  /// Reserves the specified capacity in all columns.
+  void reserve(size_type new_cap) {
+    x_.reserve(new_cap);
+    y_.reserve(new_cap);
+    cos_.reserve(new_cap);
+    sin_.reserve(new_cap);
+  }
+
+  /// Resizes the container, extending all columns with identity poses if it grows.
+  void resize(size_type count) {
+    x_.resize(count, Scalar{0});
+    y_.resize(count, Scalar{0});
+    cos_.resize(count, Scalar{1});
+    sin_.resize(count, Scalar{0});
+  }
+
+  /// Adds a pose at the end of the container, decomposing it into the columns.
+  void push_back(const value_type& pose) {
+    const auto& complex = pose.so2().unit_complex();
+    x_.push_back(pose.translation().x());
+    y_.push_back(pose.translation().y());
+    cos_.push_back(complex.x());
+    sin_.push_back(complex.y());
+  }
+
+  /// Returns a proxy to the pose at the given position.
+  [[nodiscard]] reference operator[](size_type index) { return *iterator{cursor<false>{this, index}}; }
+
+  /// Returns the pose at the given position.
+  [[nodiscard]] value_type operator[](size_type index) const { return recompose(index); }
+
+  /// Returns an iterator to the first element of the container.
+  [[nodiscard]] iterator begin() { return iterator{cursor<false>{this, 0}}; }
+
+  /// Returns an iterator past the last element of the container.
+  [[nodiscard]] iterator end() { return iterator{cursor<false>{this, size()}}; }
+
+  /// \overload
+  [[nodiscard]] const_iterator begin() const { return const_iterator{cursor<true>{this, 0}}; }
+
+  /// \overload
+  [[nodiscard]] const_iterator end() const { return const_iterator{cursor<true>{this, size()}}; }
+
+  /// Returns a contiguous span over the X translation column.
+  [[nodiscard]] auto x() const noexcept { return ranges::make_span(x_.data(), static_cast<difference_type>(size())); }
+
+  /// Returns a contiguous span over the Y translation column.
+  [[nodiscard]] auto y() const noexcept { return ranges::make_span(y_.data(), static_cast<difference_type>(size())); }
+
+  /// Returns a contiguous span over the cos θ rotation column.
+  [[nodiscard]] auto cos_theta() const noexcept {
+    return ranges::make_span(cos_.data(), static_cast<difference_type>(size()));
+  }
+
+  /// Returns a contiguous span over the sin θ rotation column.
+  [[nodiscard]] auto sin_theta() const noexcept {
+    return ranges::make_span(sin_.data(), static_cast<difference_type>(size()));
+  }
+
+  /// Returns a mutable contiguous span over the X translation column.
+  /**
+   * Mutable column spans are intended for bulk writers (e.g. batch pose
+   * generators) that fill whole columns at once. Writers of the rotation
+   * columns must keep (cos θ, sin θ) a unit complex number.
+   */
+  [[nodiscard]] auto x() noexcept { return ranges::make_span(x_.data(), static_cast<difference_type>(size())); }
+
+  /// Returns a mutable contiguous span over the Y translation column.
+  [[nodiscard]] auto y() noexcept { return ranges::make_span(y_.data(), static_cast<difference_type>(size())); }
+
+  /// Returns a mutable contiguous span over the cos θ rotation column.
+  [[nodiscard]] auto cos_theta() noexcept {
+    return ranges::make_span(cos_.data(), static_cast<difference_type>(size()));
+  }
+
+  /// Returns a mutable contiguous span over the sin θ rotation column.
+  [[nodiscard]] auto sin_theta() noexcept {
+    return ranges::make_span(sin_.data(), static_cast<difference_type>(size()));
+  }
+
+ private:
+  /// Recomposes the pose stored at the given position.
+  [[nodiscard]] value_type recompose(size_type index) const {
+    return value_type{
+        Sophus::SO2<Scalar>{cos_[index], sin_[index]},
+        Eigen::Matrix<Scalar, 2, 1>{x_[index], y_[index]},
+    };
+  }
+
+  /// Decomposes a pose into the columns at the given position.
+  void decompose(size_type index, const value_type& pose) {
+    const auto& complex = pose.so2().unit_complex();
+    x_[index] = pose.translation().x();
+    y_[index] = pose.translation().y();
+    cos_[index] = complex.x();
+    sin_[index] = complex.y();
+  }
+
+  std::vector<Scalar, Allocator> x_;
+  std::vector<Scalar, Allocator> y_;
+  std::vector<Scalar, Allocator> cos_;
+  std::vector<Scalar, Allocator> sin_;
+};
+
+namespace detail {
+
+/// Selects a decomposed column container for SE2 element types, a plain vector otherwise.
+template <class T>
+struct decomposed_column_vector {
+  /// Plain vector for non-SE2 element types.
+  using type = Vector<T>;
+};
+
+/// Specialization that selects the decomposed column container for SE2 elements.
+template <class Scalar>
+struct decomposed_column_vector<Sophus::SE2<Scalar>> {
+  /// Decomposed column container for SE2 elements.
+  using type = SE2ColumnVector<Scalar>;
+};
+
+}  // namespace detail
+
+/// Internal container selector that stores SE2 elements in decomposed scalar columns.
+template <class T>
+using DecomposedVector = typename detail::decomposed_column_vector<T>::type;
+
+/// Shorthand for a tuple of containers where SE2 members are stored as scalar columns.
+/**
+ * A drop-in alternative to `beluga::TupleVector` for pose particles, trading slightly
+ * more expensive whole-pose access for contiguous (x, y, cos θ, sin θ) columns that
+ * vectorized sensor model kernels can stream over.
+ */
+template <class T>
+class DecomposedTupleVector : public TupleContainer<DecomposedVector, T> {
+  /// Inherited constructors.
+  using TupleContainer<DecomposedVector, T>::TupleContainer;
+};
+
+}  // namespace beluga
+
+#endif
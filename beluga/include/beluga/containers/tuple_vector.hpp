@@ -15,14 +15,20 @@
 #ifndef BELUGA_CONTAINERS_TUPLE_VECTOR_HPP
 #define BELUGA_CONTAINERS_TUPLE_VECTOR_HPP
 
+#include <algorithm>
+#include <cstddef>
+#include <memory>
 #include <tuple>
 #include <vector>
 
 #include <beluga/type_traits.hpp>
+#include <beluga/utility/aligned_allocator.hpp>
 #include <beluga/views/zip.hpp>
 #include <range/v3/algorithm/copy.hpp>
 #include <range/v3/iterator/insert_iterators.hpp>
+#include <range/v3/iterator/operations.hpp>
 #include <range/v3/view/const.hpp>
+#include <range/v3/view/span.hpp>
 #include <range/v3/view/take.hpp>
 
 /**
@@ -69,6 +75,21 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
    */
   using allocator_type = void;
 
+  /// Snapshot of the storage telemetry counters of the container.
+  /**
+   * `reallocations` and `peak_size` are only tracked when the library is compiled with
+   * `BELUGA_ENABLE_TUPLE_CONTAINER_TELEMETRY` defined, and read back as zero otherwise.
+   * `bytes_reserved` is always computed from the current capacity.
+   */
+  struct StorageStats {
+    /// Bytes currently reserved across all member containers.
+    std::size_t bytes_reserved{0};
+    /// Number of capacity changes observed since construction.
+    std::size_t reallocations{0};
+    /// Largest size the container has reached since construction.
+    std::size_t peak_size{0};
+  };
+
   /// Default constructor, will default initialize all containers in the tuple.
   constexpr TupleContainer() = default;
 
@@ -78,6 +99,32 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
    */
   explicit constexpr TupleContainer(size_type count) : sequences_{((void)sizeof(Types), count)...} {}
 
+  /// Constructs an empty container, forwarding an allocator to all containers in the tuple.
+  /**
+   * The allocator is rebound by each internal container to its own element type, so a single
+   * allocator (or `std::pmr::memory_resource` pointer, for polymorphic containers) can back
+   * all member columns.
+   *
+   * \param alloc Allocator to be forwarded to each internal container.
+   */
+  template <
+      class Alloc,
+      std::enable_if_t<std::conjunction_v<std::is_constructible<InternalContainer<Types>, const Alloc&>...>, int> = 0>
+  explicit constexpr TupleContainer(const Alloc& alloc) : sequences_{InternalContainer<Types>(alloc)...} {}
+
+  /// Constructs a container of size count, forwarding an allocator to all containers in the tuple.
+  /**
+   * \param count Size of the container.
+   * \param alloc Allocator to be forwarded to each internal container.
+   */
+  template <
+      class Alloc,
+      std::enable_if_t<
+          std::conjunction_v<std::is_constructible<InternalContainer<Types>, size_type, const Alloc&>...>,
+          int> = 0>
+  constexpr TupleContainer(size_type count, const Alloc& alloc)
+      : sequences_{InternalContainer<Types>(count, alloc)...} {}
+
   /// Constructs a container from iterators.
   template <typename I, typename S>
   constexpr TupleContainer(I first, S last) {
@@ -96,6 +143,17 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
   /// Returns the capacity of the container.
   [[nodiscard]] constexpr size_type capacity() const noexcept { return std::get<0>(sequences_).capacity(); }
 
+  /// Returns a snapshot of the storage telemetry counters of the container.
+  [[nodiscard]] constexpr StorageStats storage_stats() const noexcept {
+    StorageStats stats;
+    stats.bytes_reserved = capacity() * (0 + ... + sizeof(Types));
+#ifdef BELUGA_ENABLE_TUPLE_CONTAINER_TELEMETRY
+    stats.reallocations = reallocations_;
+    stats.peak_size = peak_size_;
+#endif
+    return stats;
+  }
+
   /// Clears the container.
   constexpr void clear() noexcept {
     std::apply([](auto&&... containers) { (containers.clear(), ...); }, sequences_);
@@ -131,8 +189,9 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
       auto [last_in, last_out] = ranges::copy(limited_range, begin());
       const auto copied_size = static_cast<size_type>(ranges::distance(begin(), last_out));
       if (size() == copied_size) {
-        // Back insert the remaining elements if any.
-        ranges::copy(last_in.base(), last, ranges::back_inserter(*this));
+        // Bulk append the remaining elements if any, growing all columns once per
+        // chunk instead of once per element.
+        append_range(ranges::make_subrange(last_in.base(), last));
       } else {
         // Remove extra elements by resizing to the correct size.
         resize(copied_size);
@@ -146,6 +205,46 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
     assign(ranges::begin(range), ranges::end(range));
   }
 
+  /// Appends copies of the elements in `range` at the end of the container.
+  /**
+   * All member containers are grown at once — exactly once for sized input ranges, and
+   * once per geometrically growing chunk otherwise — before elements are written in
+   * place, amortizing the per-element growth checks that repeated `push_back()` calls
+   * would incur on every column.
+   */
+  template <typename R>
+  constexpr void append_range(R&& range) {
+    auto input = ranges::views::all(std::forward<R>(range));
+    static_assert(ranges::input_range<decltype(input)>);
+    if constexpr (ranges::sized_range<decltype(input)>) {
+      const auto old_size = size();
+      resize(old_size + static_cast<size_type>(ranges::size(input)));
+      ranges::copy(input, ranges::next(begin(), static_cast<difference_type>(old_size)));
+    } else {
+      auto first = ranges::begin(input);
+      auto last = ranges::end(input);
+      while (first != last) {
+        const auto old_size = size();
+        if (capacity() > old_size) {
+          // Fill spare capacity first, this cannot reallocate.
+          resize(capacity());
+        } else {
+          // Grow geometrically, so long inputs trigger a logarithmic number of resizes.
+          resize(old_size + std::max<size_type>(old_size, kMinAppendChunkSize));
+        }
+        auto out = ranges::next(begin(), static_cast<difference_type>(old_size));
+        auto out_last = end();
+        while (first != last && out != out_last) {
+          *out = *first;
+          ++out;
+          ++first;
+        }
+        // Remove the overallocated tail by resizing to the correct size.
+        resize(static_cast<size_type>(ranges::distance(begin(), out)));
+      }
+    }
+  }
+
   /// Reserves the specified capacity.
   /**
    * If the specified new capacity is greater than the current capacity, new storage is allocated.
@@ -154,7 +253,21 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
    * \param new_cap New capacity of the container.
    */
   constexpr void reserve(size_type new_cap) {
+    const size_type old_cap = capacity();
     std::apply([new_cap](auto&&... containers) { (containers.reserve(new_cap), ...); }, sequences_);
+    update_storage_telemetry(old_cap);
+  }
+
+  /// Releases unused capacity in all containers in the tuple.
+  /**
+   * This is the escape hatch to the capacity-retention guarantees of the assignment
+   * paths, for callers that do want to return the high-water-mark storage to the
+   * allocator.
+   */
+  constexpr void shrink_to_fit() {
+    const size_type old_cap = capacity();
+    std::apply([](auto&&... containers) { (containers.shrink_to_fit(), ...); }, sequences_);
+    update_storage_telemetry(old_cap);
   }
 
   /// Resizes the container.
@@ -163,10 +276,16 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
    * If the specified size is less than the current size, the first `count` elements of the container will be kept.
    * Otherwise, the container is extended with default initialized values.
    *
+   * With the default `TupleVector` allocator, default initialization means trivially
+   * constructible elements are left uninitialized, giving `resize_for_overwrite` semantics
+   * to the growth paths used by `assign()` where new storage is immediately overwritten.
+   *
    * \param count New size of the container.
    */
   constexpr void resize(size_type count) {
+    const size_type old_cap = capacity();
     std::apply([count](auto&&... containers) { (containers.resize(count), ...); }, sequences_);
+    update_storage_telemetry(old_cap);
   }
 
   /// Adds an element at the end of the container.
@@ -174,12 +293,45 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
    * \param value The element to be appended.
    */
   constexpr void push_back(const value_type& value) {
+    const size_type old_cap = capacity();
     push_back_impl(value, std::make_index_sequence<sizeof...(Types)>());
+    update_storage_telemetry(old_cap);
   }
 
   /// \overload
   constexpr void push_back(value_type&& value) {
+    const size_type old_cap = capacity();
     push_back_impl(std::move(value), std::make_index_sequence<sizeof...(Types)>());
+    update_storage_telemetry(old_cap);
+  }
+
+  /// Returns a pointer to the underlying storage of the Ith member column.
+  /**
+   * Only available when the internal containers provide contiguous storage.
+   * Together with `span()`, this allows vectorized kernels to operate directly over
+   * a member column without going through the zipping proxy iterator.
+   */
+  template <std::size_t I>
+  [[nodiscard]] constexpr auto* data() noexcept {
+    return std::get<I>(sequences_).data();
+  }
+
+  /// \overload
+  template <std::size_t I>
+  [[nodiscard]] constexpr const auto* data() const noexcept {
+    return std::get<I>(sequences_).data();
+  }
+
+  /// Returns a contiguous span over the underlying storage of the Ith member column.
+  template <std::size_t I>
+  [[nodiscard]] auto span() noexcept {
+    return ranges::make_span(std::get<I>(sequences_).data(), static_cast<std::ptrdiff_t>(size()));
+  }
+
+  /// \overload
+  template <std::size_t I>
+  [[nodiscard]] auto span() const noexcept {
+    return ranges::make_span(std::get<I>(sequences_).data(), static_cast<std::ptrdiff_t>(size()));
   }
 
   /// Returns an iterator to the first element of the container.
@@ -195,8 +347,26 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
   [[nodiscard]] constexpr auto end() { return all().end(); }
 
  private:
+  /// Minimum chunk size used by `append_range()` when the input range size is unknown.
+  static constexpr size_type kMinAppendChunkSize = 256;
+
   std::tuple<InternalContainer<Types>...> sequences_;
 
+#ifdef BELUGA_ENABLE_TUPLE_CONTAINER_TELEMETRY
+  std::size_t reallocations_{0};
+  std::size_t peak_size_{0};
+#endif
+
+  /// Updates the storage telemetry counters after a mutating operation, if enabled.
+  constexpr void update_storage_telemetry([[maybe_unused]] size_type old_cap) noexcept {
+#ifdef BELUGA_ENABLE_TUPLE_CONTAINER_TELEMETRY
+    if (capacity() != old_cap) {
+      ++reallocations_;
+    }
+    peak_size_ = std::max(peak_size_, size());
+#endif
+  }
+
   template <typename T, std::size_t... Ids>
   constexpr void push_back_impl(T value, std::index_sequence<Ids...>) {
     (std::get<Ids>(sequences_).push_back(std::get<Ids>(value)), ...);
@@ -215,14 +385,38 @@ class TupleContainer<InternalContainer, std::tuple<Types...>> {
 template <class T>
 using Vector = std::vector<T, std::allocator<T>>;
 
-/// Shorthand for a tuple of vectors with the default allocator.
+namespace detail {
+
+/// Rebinds an allocator to vectors of each member type.
+/**
+ * This allows a single allocator type (e.g. an arena or pool allocator, or
+ * `std::pmr::polymorphic_allocator`) to back all member containers of a tuple container.
+ *
+ * \tparam Allocator Allocator to be rebound, must satisfy the
+ *  [Allocator](https://en.cppreference.com/w/cpp/named_req/Allocator) requirements.
+ */
+template <class Allocator>
+struct vector_with_allocator {
+  /// Vector alias with the rebound allocator.
+  template <class T>
+  using type = std::vector<T, typename std::allocator_traits<Allocator>::template rebind_alloc<T>>;
+};
+
+}  // namespace detail
+
+/// Shorthand for a tuple of vectors with a configurable allocator.
 /**
  * This is needed so we can define deduction guides for this type.
+ *
+ * \tparam T Element (tuple) type of the container.
+ * \tparam Allocator Allocator rebound by each member vector to its own element type.
+ *  Defaults to a cache-line-aligned allocator, so each member column can be processed
+ *  with aligned vector loads and stores.
  */
-template <class T>
-class TupleVector : public TupleContainer<Vector, T> {
+template <class T, class Allocator = AlignedAllocator<std::byte, 64>>
+class TupleVector : public TupleContainer<detail::vector_with_allocator<Allocator>::template type, T> {
   /// Inherited constructors.
-  using TupleContainer<Vector, T>::TupleContainer;
+  using TupleContainer<detail::vector_with_allocator<Allocator>::template type, T>::TupleContainer;
 };
 
 /// Deduction guide to construct from iterators.
@@ -15,6 +15,10 @@
 #ifndef BELUGA_MOTION_OMNIDIRECTIONAL_DRIVE_MODEL_HPP
 #define BELUGA_MOTION_OMNIDIRECTIONAL_DRIVE_MODEL_HPP
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <optional>
 #include <random>
 #include <tuple>
@@ -22,6 +26,8 @@
 
 #include <beluga/type_traits/tuple_traits.hpp>
 
+#include <range/v3/view/span.hpp>
+
 #include <sophus/se2.hpp>
 #include <sophus/so2.hpp>
 
@@ -71,32 +77,174 @@ struct OmnidirectionalDriveModelParam {
   double distance_threshold = 0.01;
 };
 
+namespace detail {
+
+/// State sampling function returned by `beluga::OmnidirectionalDriveModel`.
+/**
+ * All per-control-action work — the control decomposition, the conditioned
+ * distribution parameters and the trigonometry of the first rotation — is hoisted
+ * into this object when the model is conditioned, so the per-particle call only
+ * draws noise and composes. Like the differential drive sampler, it also offers a
+ * batch form over a contiguous block of states that draws all noise variates of a
+ * block first and then applies the composition over the decomposed pose scalars
+ * with multiply-add arithmetic. The two forms consume the engine in different
+ * orders, so they produce different (equally distributed) samples.
+ *
+ * \tparam StateScalar Scalar type of the particle states. Noise variates are drawn
+ *  in double precision regardless; only the state composition runs in this type.
+ */
+template <class StateScalar = double>
+class OmnidirectionalDriveStateSampler {
+ public:
+  /// State type of a particle.
+  using state_type = Sophus::SE2<StateScalar>;
+  /// Distribution parameters of one motion increment.
+  using distribution_param_type = typename std::normal_distribution<double>::param_type;
+
+  /// Constructs a sampler from the decomposed control action.
+  /**
+   * \param first_rotation Rotation towards the translation heading, shared by all particles.
+   * \param rotation Distribution of the total rotation increment.
+   * \param translation Distribution of the longitudinal translation increment.
+   * \param strafe Distribution of the lateral translation increment.
+   */
+  OmnidirectionalDriveStateSampler(
+      Sophus::SO2d first_rotation,
+      distribution_param_type rotation,
+      distribution_param_type translation,
+      distribution_param_type strafe)
+      : first_rotation_{std::move(first_rotation)},
+        rotation_params_{rotation},
+        translation_params_{translation},
+        strafe_params_{strafe} {}
+
+  /// Samples a posterior state given a prior state, one particle at a time.
+  template <class Generator>
+  [[nodiscard]] state_type operator()(const state_type& state, Generator& gen) const {
+    static thread_local auto distribution = std::normal_distribution<double>{};
+    // This is an implementation based on the same set of parameters that is used in
+    // nav2's omni_motion_model. To simplify the implementation, the following
+    // variable substitutions were performed:
+    // - first_rotation = delta_bearing - previous_orientation
+    // - second_rotation = delta_rot_hat - first_rotation
+    const auto second_rotation =
+        (Sophus::SO2d{distribution(gen, rotation_params_)} * first_rotation_.inverse()).cast<StateScalar>();
+    const auto translation = Sophus::Vector2<StateScalar>{
+        static_cast<StateScalar>(distribution(gen, translation_params_)),
+        static_cast<StateScalar>(-distribution(gen, strafe_params_))};
+    return state * state_type{first_rotation_.cast<StateScalar>(), Sophus::Vector2<StateScalar>::Zero()} *
+           state_type{second_rotation, translation};
+  }
+
+  /// Checks whether sampling would be indistinguishable from the identity transform.
+  /**
+   * Since the noise of an odometry model scales with the control delta, a stationary
+   * control action conditions every increment distribution to a near-zero mean and
+   * spread. The first rotation does not need to be checked: it only steers the
+   * translation increments, which are below the floor themselves. Callers can then
+   * skip the propagation pass entirely, see `beluga::AmclParams::propagate_min_d`.
+   *
+   * \param translation_floor Translation floor in meters for the increment means and spreads.
+   * \param rotation_floor Rotation floor in radians for the increment means and spreads.
+   */
+  [[nodiscard]] bool is_near_identity(double translation_floor, double rotation_floor) const {
+    const auto below = [](const distribution_param_type& params, double floor) {
+      return std::abs(params.mean()) < floor && params.stddev() < floor;
+    };
+    return below(rotation_params_, rotation_floor) && below(translation_params_, translation_floor) &&
+           below(strafe_params_, translation_floor);
+  }
+
+  /// Propagates a contiguous block of states in place, batching the noise draws.
+  template <class Generator>
+  void operator()(ranges::span<state_type> states, Generator& gen) const {
+    static thread_local auto distribution = std::normal_distribution<double>{};
+    constexpr std::size_t kBlockSize = 256;
+    std::array<double, kBlockSize> rotations;
+    std::array<double, kBlockSize> translations;
+    std::array<double, kBlockSize> strafes;
+
+    // Because planar rotations commute, state * SE2{f, 0} * SE2{SO2{rho} * f^-1, tr}
+    // reduces to rotating the pose by rho and translating by R(theta + phi_f) * tr,
+    // so the first rotation's trigonometry is shared by the whole particle set.
+    const auto c1 = static_cast<StateScalar>(first_rotation_.unit_complex().x());
+    const auto s1 = static_cast<StateScalar>(first_rotation_.unit_complex().y());
+
+    const auto size = static_cast<std::size_t>(states.size());
+    for (std::size_t offset = 0; offset < size; offset += kBlockSize) {
+      const std::size_t count = std::min(kBlockSize, size - offset);
+      for (std::size_t i = 0; i < count; ++i) {
+        rotations[i] = distribution(gen, rotation_params_);
+      }
+      for (std::size_t i = 0; i < count; ++i) {
+        translations[i] = distribution(gen, translation_params_);
+      }
+      for (std::size_t i = 0; i < count; ++i) {
+        strafes[i] = distribution(gen, strafe_params_);
+      }
+      for (std::size_t i = 0; i < count; ++i) {
+        StateScalar* pose = states[static_cast<std::ptrdiff_t>(offset + i)].data();
+        const StateScalar c = pose[0];
+        const StateScalar s = pose[1];
+        const auto cr = static_cast<StateScalar>(std::cos(rotations[i]));
+        const auto sr = static_cast<StateScalar>(std::sin(rotations[i]));
+        const auto d = static_cast<StateScalar>(translations[i]);
+        const auto strafe = static_cast<StateScalar>(strafes[i]);
+        // Heading after the first (shared) rotation.
+        const StateScalar cf = c * c1 - s * s1;
+        const StateScalar sf = s * c1 + c * s1;
+        // R(theta + phi_f) * (d, -strafe), expanded.
+        pose[2] += d * cf + strafe * sf;
+        pose[3] += d * sf - strafe * cf;
+        // Total rotation by the sampled increment.
+        pose[0] = c * cr - s * sr;
+        pose[1] = s * cr + c * sr;
+      }
+    }
+  }
+
+ private:
+  Sophus::SO2d first_rotation_;                 ///< Rotation towards the translation heading.
+  distribution_param_type rotation_params_;     ///< Total rotation increment distribution.
+  distribution_param_type translation_params_;  ///< Longitudinal translation increment distribution.
+  distribution_param_type strafe_params_;       ///< Lateral translation increment distribution.
+};
+
+}  // namespace detail
+
 /// Sampled odometry model for an omnidirectional drive.
 /**
  * This class satisfies \ref MotionModelPage.
+ *
+ * \tparam StateScalar Scalar type of the particle states. The control action and
+ *  the conditioned distribution parameters stay in double precision; only the
+ *  per-particle state composition runs in this type.
  */
-class OmnidirectionalDriveModel {
+template <class StateScalar = double>
+class BasicOmnidirectionalDriveModel {
  public:
   /// Current and previous odometry estimates as motion model control action.
   using control_type = std::tuple<Sophus::SE2d, Sophus::SE2d>;
   /// 2D pose as motion model state (to match that of the particles).
-  using state_type = Sophus::SE2d;
+  using state_type = Sophus::SE2<StateScalar>;
 
   /// Parameter type that the constructor uses to configure the motion model.
   using param_type = OmnidirectionalDriveModelParam;
 
-  /// Constructs an OmnidirectionalDriveModel instance.
+  /// Constructs a BasicOmnidirectionalDriveModel instance.
   /**
    * \param params Parameters to configure this instance.
    *  See beluga::OmnidirectionalDriveModelParam for details.
    */
-  explicit OmnidirectionalDriveModel(const param_type& params) : params_{params} {}
+  explicit BasicOmnidirectionalDriveModel(const param_type& params) : params_{params} {}
 
   /// Computes a state sampling function conditioned on a given control action.
   /**
    * \tparam Control A tuple-like container matching the model's `control_action_type`.
    * \param action Control action to condition the motion model with.
-   * \return a callable satisfying \ref StateSamplingFunctionPage.
+   * \return a callable satisfying \ref StateSamplingFunctionPage. It additionally
+   *  supports batch propagation over a contiguous span of states, see
+   *  `beluga::detail::OmnidirectionalDriveStateSampler`.
    */
   template <class Control, typename = common_tuple_type_t<Control, control_type>>
   [[nodiscard]] auto operator()(Control&& action) const {
@@ -130,19 +278,8 @@ class OmnidirectionalDriveModel {
                  params_.strafe_noise_from_translation * distance_variance +
                  params_.translation_noise_from_rotation * rotation_variance(rotation))};
 
-    return [=](const state_type& state, auto& gen) {
-      static thread_local auto distribution = std::normal_distribution<double>{};
-      // This is an implementation based on the same set of parameters that is used in
-      // nav2's omni_motion_model. To simplify the implementation, the following
-      // variable substitutions were performed:
-      // - first_rotation = delta_bearing - previous_orientation
-      // - second_rotation = delta_rot_hat - first_rotation
-      const auto second_rotation = Sophus::SO2d{distribution(gen, rotation_params)} * first_rotation.inverse();
-      const auto translation =
-          Eigen::Vector2d{distribution(gen, translation_params), -distribution(gen, strafe_params)};
-      return state * Sophus::SE2d{first_rotation, Eigen::Vector2d{0.0, 0.0}} *
-             Sophus::SE2d{second_rotation, translation};
-    };
+    return detail::OmnidirectionalDriveStateSampler<StateScalar>{
+        first_rotation, rotation_params, translation_params, strafe_params};
   }
 
  private:
@@ -156,6 +293,12 @@ class OmnidirectionalDriveModel {
   }
 };
 
+/// Omnidirectional drive odometry model over double precision states.
+using OmnidirectionalDriveModel = BasicOmnidirectionalDriveModel<double>;
+
+/// Omnidirectional drive odometry model over single precision states.
+using OmnidirectionalDriveModelF = BasicOmnidirectionalDriveModel<float>;
+
 }  // namespace beluga
 
 #endif
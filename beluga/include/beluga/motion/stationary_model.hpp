@@ -37,13 +37,16 @@ namespace beluga {
  * This class satisfies \ref MotionModelPage.
  *
  * It ignores all odometry updates and only adds Gaussian noise to the input states.
+ *
+ * \tparam StateScalar Scalar type of the particle states.
  */
-class StationaryModel {
+template <class StateScalar = double>
+class BasicStationaryModel {
  public:
   /// Current and previous odometry estimates as motion model control action.
   using control_type = std::tuple<Sophus::SE2d, Sophus::SE2d>;
   /// 2D pose as motion model state (to match that of the particles).
-  using state_type = Sophus::SE2d;
+  using state_type = Sophus::SE2<StateScalar>;
 
   /// Computes a state sampling function conditioned on a given control action.
   /**
@@ -57,12 +60,20 @@ class StationaryModel {
   [[nodiscard]] auto operator()([[maybe_unused]] Control&&) const {
     return [](const state_type& state, auto& gen) {
       static thread_local auto distribution = std::normal_distribution<>{0, 0.02};
-      return state *
-             Sophus::SE2d{Sophus::SO2d{distribution(gen)}, Eigen::Vector2d{distribution(gen), distribution(gen)}};
+      return state * state_type{
+                         Sophus::SO2<StateScalar>{static_cast<StateScalar>(distribution(gen))},
+                         Sophus::Vector2<StateScalar>{
+                             static_cast<StateScalar>(distribution(gen)), static_cast<StateScalar>(distribution(gen))}};
     };
   }
 };
 
+/// Stationary motion model over double precision states.
+using StationaryModel = BasicStationaryModel<double>;
+
+/// Stationary motion model over single precision states.
+using StationaryModelF = BasicStationaryModel<float>;
+
 }  // namespace beluga
 
 #endif
@@ -48,6 +48,17 @@ struct on_effective_size_drop_policy {
     return beluga::effective_sample_size(std::forward<Range>(range)) < size * threshold;
   }
 
+  /// Overload for precomputed weight statistics.
+  /**
+   * \param statistics Weight statistics of the particle set, as computed by
+   *  `beluga::weight_statistics` or `beluga::actions::normalize`.
+   * \param threshold Percentage threshold to use for detecting the drop.
+   * \return True if resampling should be triggered, false otherwise.
+   */
+  constexpr bool operator()(const WeightStatistics& statistics, double threshold = kDefaultThreshold) const {
+    return beluga::effective_sample_size(statistics) < static_cast<double>(statistics.count) * threshold;
+  }
+
   /// Overload that binds a specified threshold.
   constexpr auto operator()(double threshold) const {
     return beluga::make_policy(ranges::bind_back(on_effective_size_drop_policy{}, threshold));
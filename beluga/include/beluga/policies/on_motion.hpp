@@ -15,6 +15,9 @@
 #ifndef BELUGA_POLICIES_ON_MOTION_HPP
 #define BELUGA_POLICIES_ON_MOTION_HPP
 
+#include <algorithm>
+#include <cmath>
+
 #include <beluga/policies/policy.hpp>
 #include <sophus/se2.hpp>
 
@@ -46,8 +49,11 @@ struct on_motion_policy_base<Sophus::SE2<Scalar>> {
    * \param min_distance The minimum translation distance to trigger the action.
    * \param min_angle The minimum rotation angle (in radians) to trigger the action.
    */
-  constexpr on_motion_policy_base(Scalar min_distance, Scalar min_angle)
-      : min_distance_(min_distance), min_angle_(min_angle) {}
+  on_motion_policy_base(Scalar min_distance, Scalar min_angle)
+      : min_distance_(min_distance),
+        min_angle_(min_angle),
+        squared_min_distance_(min_distance * min_distance),
+        cos_min_angle_(std::cos(std::min(min_angle, Sophus::Constants<Scalar>::pi()))) {}
 
   /// Return true if motion has been detected.
   /**
@@ -57,8 +63,19 @@ struct on_motion_policy_base<Sophus::SE2<Scalar>> {
    *
    * Checks the motion based on the provided SE2 pose, and triggers the action if the
    * motion surpasses the specified distance and angle thresholds.
+   *
+   * The common no-motion case is rejected with a few scalar operations: the delta
+   * translation norm and the delta rotation angle are invariant under the frame
+   * change, so both thresholds can be pre-checked against plain coordinate
+   * differences before constructing any group element.
    */
   constexpr bool operator()(const Sophus::SE2<Scalar>& prev, const Sophus::SE2<Scalar>& current) {
+    const Scalar dx = current.translation().x() - prev.translation().x();
+    const Scalar dy = current.translation().y() - prev.translation().y();
+    const Scalar cos_angle = prev.so2().unit_complex().dot(current.so2().unit_complex());
+    if (dx * dx + dy * dy <= squared_min_distance_ && cos_angle >= cos_min_angle_) {
+      return false;
+    }
     const auto delta = prev.inverse() * current;
     return std::abs(delta.translation().x()) > min_distance_ ||  //
            std::abs(delta.translation().y()) > min_distance_ ||  //
@@ -66,8 +83,10 @@ struct on_motion_policy_base<Sophus::SE2<Scalar>> {
   }
 
  private:
-  Scalar min_distance_{0.0};  ///< The minimum translation distance to trigger the action.
-  Scalar min_angle_{0.0};     ///< The minimum rotation angle (in radians) to trigger the action.
+  Scalar min_distance_{0.0};          ///< The minimum translation distance to trigger the action.
+  Scalar min_angle_{0.0};             ///< The minimum rotation angle (in radians) to trigger the action.
+  Scalar squared_min_distance_{0.0};  ///< The squared minimum distance, for the scalar fast-path check.
+  Scalar cos_min_angle_{1.0};         ///< The cosine of the minimum angle, for the scalar fast-path check.
 };
 
 /// Base implementation for the on_motion_policy algorithm.
@@ -52,8 +52,28 @@ namespace beluga {
  *   namespace where that type is defined (so it can be found by ADL).
  */
 
+/// Phantom tag type shared by all weight representations.
+struct WeightTag;
+
+/// Strongly typed weight over an arbitrary floating-point representation.
+/**
+ * All instantiations share the same phantom tag, so `beluga::weight` and
+ * `beluga::views::weights` recognize any of them as the weight of a particle.
+ */
+template <class T>
+using BasicWeight = Numeric<T, WeightTag>;
+
 /// Weight type, as a strongly typed `double`.
-using Weight = Numeric<double, struct WeightTag>;
+using Weight = BasicWeight<double>;
+
+/// Weight type, as a strongly typed `float`.
+/**
+ * Halves the footprint (and thus the memory bandwidth) of the weight column, which
+ * every action traverses multiple times per filter update. Accumulations over the
+ * column are carried out in `double` with compensated summation regardless (see
+ * `beluga::CompensatedSum`), so only per-particle storage loses precision.
+ */
+using WeightF = BasicWeight<float>;
 
 /// Cluster type, as a strongly typed `std::size_t`.
 using Cluster = Numeric<std::size_t, struct ClusterTag>;
@@ -242,7 +262,12 @@ struct weight_fn {
     return weight(std::forward<T>(t));
   }
 
-  /// Overload for tuple-like types.
+  /// Weight representation held by a tuple-like type, whichever instantiation it is.
+  template <class T>
+  using element_type = std::
+      conditional_t<has_single_element_v<beluga::Weight, std::decay_t<T>>, beluga::Weight, beluga::WeightF>;
+
+  /// Overload for tuple-like types, matching any `beluga::BasicWeight` instantiation.
   template <
       class T,
       std::enable_if_t<
@@ -251,10 +276,12 @@ struct weight_fn {
               std::negation<has_member_weight<T>>,           //
               std::negation<has_non_member_weight<T>>,       //
               is_tuple_like<T>,                              //
-              has_single_element<beluga::Weight, std::decay_t<T>>>,
+              std::disjunction<
+                  has_single_element<beluga::Weight, std::decay_t<T>>,
+                  has_single_element<beluga::WeightF, std::decay_t<T>>>>,
           int> = 0>
-  constexpr decltype(auto) operator()(T&& t) const noexcept(noexcept(element<beluga::Weight>(std::forward<T>(t)))) {
-    return element<beluga::Weight>(std::forward<T>(t));
+  constexpr decltype(auto) operator()(T&& t) const noexcept(noexcept(element<element_type<T>>(std::forward<T>(t)))) {
+    return element<element_type<T>>(std::forward<T>(t));
   }
 };
 
@@ -263,6 +290,111 @@ struct weight_fn {
 /// Customization point object for accessing the `weight` of a particle.
 inline constexpr weight_detail::weight_fn weight;
 
+namespace cluster_detail {
+
+/// \cond cluster_detail
+
+template <class T, class = void>
+struct has_member_variable_cluster : std::false_type {};
+
+template <class T>
+struct has_member_variable_cluster<T, std::void_t<decltype(std::declval<T>().cluster)>> : std::true_type {};
+
+template <class T>
+inline constexpr bool has_member_variable_cluster_v = has_member_variable_cluster<T>::value;
+
+template <class T, class = void>
+struct has_member_cluster : std::false_type {};
+
+template <class T>
+struct has_member_cluster<T, std::void_t<decltype(std::declval<T>().cluster())>> : std::true_type {};
+
+template <class T>
+inline constexpr bool has_member_cluster_v = has_member_cluster<T>::value;
+
+template <class T, class = void>
+struct has_non_member_cluster : std::false_type {};
+
+template <class T>
+struct has_non_member_cluster<T, std::void_t<decltype(cluster(std::declval<T>()))>> : std::true_type {};
+
+template <class T>
+inline constexpr bool has_non_member_cluster_v = has_non_member_cluster<T>::value;
+
+/// \endcond
+
+/// Customization point object type for accessing the `cluster` of a particle.
+/**
+ * The cluster is an optional particle attribute holding the precomputed spatial
+ * hash of the particle state, maintained by the actions that update the state so
+ * consumers can bucket particles without re-deriving hashes.
+ *
+ * See https://en.cppreference.com/w/cpp/ranges/cpo.
+ */
+struct cluster_fn {
+  /// Overload for when the particle type defines a member variable.
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              has_member_variable_cluster<T>,        //
+              std::negation<has_member_cluster<T>>,  //
+              std::negation<has_non_member_cluster<T>>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const noexcept {
+    return beluga::forward_like<T>(t.cluster);
+  }
+
+  /// Overload for when the particle type defines a member method.
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              std::negation<has_member_variable_cluster<T>>,  //
+              has_member_cluster<T>,                          //
+              std::negation<has_non_member_cluster<T>>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const noexcept(noexcept(std::forward<T>(t).cluster())) {
+    return std::forward<T>(t).cluster();
+  }
+
+  /// Overload for when there is an external function that takes this particle type.
+  /**
+   * The non-member function must be in T's namespace so it can be found by ADL.
+   */
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              std::negation<has_member_variable_cluster<T>>,  //
+              std::negation<has_member_cluster<T>>,           //
+              has_non_member_cluster<T>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const noexcept(noexcept(cluster(std::forward<T>(t)))) {
+    return cluster(std::forward<T>(t));
+  }
+
+  /// Overload for tuple-like types.
+  template <
+      class T,
+      std::enable_if_t<
+          std::conjunction_v<
+              std::negation<has_member_variable_cluster<T>>,  //
+              std::negation<has_member_cluster<T>>,           //
+              std::negation<has_non_member_cluster<T>>,       //
+              is_tuple_like<T>,                               //
+              has_single_element<beluga::Cluster, std::decay_t<T>>>,
+          int> = 0>
+  constexpr decltype(auto) operator()(T&& t) const noexcept(noexcept(element<beluga::Cluster>(std::forward<T>(t)))) {
+    return element<beluga::Cluster>(std::forward<T>(t));
+  }
+};
+
+}  // namespace cluster_detail
+
+/// Customization point object for accessing the `cluster` of a particle.
+inline constexpr cluster_detail::cluster_fn cluster;
+
 }  // namespace beluga
 
 #endif
@@ -17,11 +17,13 @@
 
 /**
  * \file
- * \brief Includes all Beluga random distributions.
+ * \brief Includes all Beluga random distributions and engines.
  */
 
+#include <beluga/random/mixture_distribution.hpp>
 #include <beluga/random/multivariate_normal_distribution.hpp>
 #include <beluga/random/multivariate_uniform_distribution.hpp>
+#include <beluga/random/random_engines.hpp>
 
 /**
  * \page RandomStateDistributionPage Beluga named requirements: RandomStateDistribution
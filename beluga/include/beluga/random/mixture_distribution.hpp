@@ -0,0 +1,79 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_RANDOM_MIXTURE_DISTRIBUTION_HPP
+#define BELUGA_RANDOM_MIXTURE_DISTRIBUTION_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <random>
+#include <utility>
+#include <vector>
+
+/**
+ * \file
+ * \brief Implementation of a weighted mixture of random state distributions.
+ */
+
+namespace beluga {
+
+/// Weighted mixture of component distributions sharing a result type.
+/**
+ * Each draw first selects a component with probability proportional to its
+ * weight, then samples from it. Useful to seed a particle filter from a short
+ * list of pose hypotheses (e.g. scan match candidates), concentrating the
+ * initial population around each of them in proportion to their scores.
+ *
+ * \note This class satisfies \ref RandomStateDistributionPage.
+ *
+ * \tparam Distribution Component distribution type. It must satisfy
+ *  \ref RandomStateDistributionPage.
+ */
+template <class Distribution>
+class MixtureDistribution {
+ public:
+  /// Result type of the component distributions.
+  using result_type = typename Distribution::result_type;
+
+  /// Constructs a mixture from components and their weights.
+  /**
+   * \param components Component distributions. Must not be empty.
+   * \param weights Non-negative component weights, one per component. They do
+   *  not need to be normalized.
+   */
+  MixtureDistribution(std::vector<Distribution> components, const std::vector<double>& weights)
+      : components_{std::move(components)}, index_distribution_{weights.begin(), weights.end()} {
+    assert(!components_.empty());
+    assert(components_.size() == weights.size());
+  }
+
+  /// Generates a random state from one of the components.
+  /**
+   * \tparam URNG Type of the random number generator, satisfying \ref RandomNumberGeneratorPage.
+   * \param generator Uniform random bit generator.
+   * \return The generated random state.
+   */
+  template <class URNG>
+  [[nodiscard]] result_type operator()(URNG& generator) {
+    return components_[index_distribution_(generator)](generator);
+  }
+
+ private:
+  std::vector<Distribution> components_;
+  std::discrete_distribution<std::size_t> index_distribution_;
+};
+
+}  // namespace beluga
+
+#endif
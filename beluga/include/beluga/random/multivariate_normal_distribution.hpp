@@ -15,8 +15,10 @@
 #ifndef BELUGA_RANDOM_MULTIVARIATE_NORMAL_DISTRIBUTION_HPP
 #define BELUGA_RANDOM_MULTIVARIATE_NORMAL_DISTRIBUTION_HPP
 
+#include <cstddef>
 #include <random>
 #include <utility>
+#include <vector>
 
 #include <beluga/random/multivariate_distribution_traits.hpp>
 
@@ -101,6 +103,36 @@ class MultivariateNormalDistributionParam {
     }
   }
 
+  /// Generates a batch of new random objects from the distribution.
+  /**
+   * All standard normal variates for the batch are drawn up front into a single
+   * block and transformed with one matrix-matrix product against the cached
+   * decomposition, instead of one matrix-vector product per sample.
+   *
+   * \tparam Generator The generator type that must meet the requirements of
+   * [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator).
+   * \param distribution A reference to a standard normal distribution instance.
+   * \param generator An uniform random bit generator object.
+   * \param count The number of samples to generate.
+   * \return A matrix holding one generated sample per column (per row for row vector types).
+   */
+  template <class Generator>
+  [[nodiscard]] auto samples(
+      std::normal_distribution<scalar_type>& distribution,
+      Generator& generator,
+      Eigen::Index count) const {
+    const auto variate = [&distribution, &generator]() { return distribution(generator); };
+    if constexpr (vector_type::ColsAtCompileTime == 1) {
+      using block_type = Eigen::Matrix<scalar_type, vector_type::RowsAtCompileTime, Eigen::Dynamic>;
+      const block_type deltas = block_type::NullaryExpr(mean_.rows(), count, variate);
+      return block_type{(transform_ * deltas).colwise() + mean_};
+    } else {
+      using block_type = Eigen::Matrix<scalar_type, Eigen::Dynamic, vector_type::ColsAtCompileTime>;
+      const block_type deltas = block_type::NullaryExpr(count, mean_.cols(), variate);
+      return block_type{(deltas * transform_).rowwise() + mean_};
+    }
+  }
+
  private:
   vector_type mean_{vector_type::Zero()};
   matrix_type transform_{make_transform(vector_type::Ones().asDiagonal())};
@@ -262,6 +294,37 @@ class MultivariateNormalDistribution {
     return multivariate_distribution_traits<T>::from_vector(params(distribution_, generator));
   }
 
+  /// Generates a batch of random objects in the distribution.
+  /**
+   * Equivalent to invoking `operator()` \p count times, but all standard normal
+   * variates are drawn up front and the covariance transform is applied as a
+   * single matrix-matrix product, which is considerably faster for large
+   * batches (e.g. global relocalization with hundreds of thousands of
+   * particles).
+   *
+   * \tparam Generator The generator type that must meet the requirements of
+   * [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator).
+   * \param generator An uniform random bit generator object.
+   * \param count The number of samples to generate.
+   * \return The generated random objects.
+   */
+  template <class Generator>
+  [[nodiscard]] std::vector<result_type> samples(Generator& generator, std::size_t count) {
+    const auto block = params_.samples(distribution_, generator, static_cast<Eigen::Index>(count));
+    auto result = std::vector<result_type>{};
+    result.reserve(count);
+    if constexpr (vector_type::ColsAtCompileTime == 1) {
+      for (Eigen::Index i = 0; i < block.cols(); ++i) {
+        result.push_back(multivariate_distribution_traits<T>::from_vector(block.col(i)));
+      }
+    } else {
+      for (Eigen::Index i = 0; i < block.rows(); ++i) {
+        result.push_back(multivariate_distribution_traits<T>::from_vector(block.row(i)));
+      }
+    }
+    return result;
+  }
+
   /// Compares this object with other distribution object.
   /**
    * Two distribution objects are equal when parameter values and internal state are the same.
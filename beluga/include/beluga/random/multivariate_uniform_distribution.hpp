@@ -15,7 +15,15 @@
 #ifndef BELUGA_RANDOM_MULTIVARIATE_UNIFORM_DISTRIBUTION_HPP
 #define BELUGA_RANDOM_MULTIVARIATE_UNIFORM_DISTRIBUTION_HPP
 
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <optional>
 #include <random>
+#include <vector>
 
 #include <sophus/se2.hpp>
 #include <sophus/se3.hpp>
@@ -31,6 +39,83 @@
 
 namespace beluga {
 
+/// Tag type to select low-discrepancy (quasi-random) sampling.
+/**
+ * Distributions constructed with this tag draw from a randomized Halton
+ * sequence instead of i.i.d. uniform variates, so a batch of N samples covers
+ * the support far more evenly. Global localization converges at noticeably
+ * lower particle counts when the initial set stratifies free space this way.
+ */
+struct LowDiscrepancy {};
+
+/// Tag instance to select low-discrepancy (quasi-random) sampling.
+inline constexpr LowDiscrepancy low_discrepancy;
+
+namespace detail {
+
+/// Computes the radical inverse of `index` in the given base.
+/**
+ * This is the per-dimension primitive of Halton (and base 2, van der Corput)
+ * low-discrepancy sequences: successive indices fill the unit interval evenly
+ * instead of clumping the way i.i.d. uniform draws do.
+ */
+inline double radical_inverse(std::size_t base, std::size_t index) {
+  const double inverse_base = 1.0 / static_cast<double>(base);
+  double result = 0.0;
+  double factor = inverse_base;
+  while (index > 0) {
+    result += static_cast<double>(index % base) * factor;
+    index /= base;
+    factor *= inverse_base;
+  }
+  return result;
+}
+
+/// Wraps a randomized quasi-random variate back into the unit interval.
+inline double wrap_unit(double value) {
+  return value < 1.0 ? value : value - 1.0;
+}
+
+/// Randomized Halton sequence over the unit hypercube.
+/**
+ * Applies a Cranley-Patterson rotation (a random per-dimension shift, drawn
+ * once from the caller's engine) to the deterministic Halton points, so
+ * distinct distribution instances produce decorrelated yet individually
+ * well-stratified sequences.
+ *
+ * \tparam NDim The dimension of the hypercube.
+ */
+template <std::size_t NDim>
+class RandomizedHalton {
+ public:
+  /// Returns the next point in the sequence, drawing the random shift on first use.
+  template <class URNG>
+  [[nodiscard]] std::array<double, NDim> operator()(URNG& engine) {
+    static constexpr std::array<std::size_t, 4> kPrimes = {2, 3, 5, 7};
+    static_assert(NDim <= kPrimes.size());
+    if (!shift_ready_) {
+      auto uniform = std::uniform_real_distribution<double>{};
+      for (auto& value : shift_) {
+        value = uniform(engine);
+      }
+      shift_ready_ = true;
+    }
+    const std::size_t index = index_++;
+    std::array<double, NDim> point;
+    for (std::size_t dim = 0; dim < NDim; ++dim) {
+      point[dim] = wrap_unit(radical_inverse(kPrimes[dim], index) + shift_[dim]);
+    }
+    return point;
+  }
+
+ private:
+  std::array<double, NDim> shift_{};
+  bool shift_ready_ = false;
+  std::size_t index_ = 0;
+};
+
+}  // namespace detail
+
 /// Primary template for a multivariate uniform distribution.
 /**
  * \tparam T The result type for sampling from the distribution.
@@ -50,6 +135,18 @@ class MultivariateUniformDistribution<Sophus::SE2d, Eigen::AlignedBox2d> {
   explicit MultivariateUniformDistribution(const Eigen::AlignedBox2d& box)
       : x_distribution_{box.min().x(), box.max().x()}, y_distribution_{box.min().y(), box.max().y()} {}
 
+  /// Constructs a low-discrepancy multivariate uniform distribution in SE(2) with 2D bounding region.
+  /**
+   * Samples follow a randomized Halton sequence over (x, y, heading), so a
+   * batch of N draws stratifies the bounding region instead of clumping.
+   *
+   * \param box The axis-aligned bounding region.
+   */
+  MultivariateUniformDistribution(const Eigen::AlignedBox2d& box, LowDiscrepancy)
+      : MultivariateUniformDistribution(box) {
+    halton_.emplace();
+  }
+
   /// Generates a random 2D pose within the bounding region.
   /**
    * \tparam URNG The type of the random number generator.
@@ -58,6 +155,16 @@ class MultivariateUniformDistribution<Sophus::SE2d, Eigen::AlignedBox2d> {
    */
   template <class URNG>
   [[nodiscard]] Sophus::SE2d operator()(URNG& engine) {
+    if (halton_.has_value()) {
+      const auto point = (*halton_)(engine);
+      return Sophus::SE2d{
+          Sophus::SO2d{Sophus::Constants<double>::pi() * (2.0 * point[2] - 1.0)},
+          Sophus::Vector2d{
+              x_distribution_.a() + point[0] * (x_distribution_.b() - x_distribution_.a()),
+              y_distribution_.a() + point[1] * (y_distribution_.b() - y_distribution_.a()),
+          },
+      };
+    }
     return Sophus::SE2d{
         Sophus::SO2d::sampleUniform(engine),
         Sophus::Vector2d{
@@ -70,12 +177,17 @@ class MultivariateUniformDistribution<Sophus::SE2d, Eigen::AlignedBox2d> {
  private:
   std::uniform_real_distribution<double> x_distribution_;
   std::uniform_real_distribution<double> y_distribution_;
+  std::optional<detail::RandomizedHalton<3>> halton_;
 };
 
 /// Deduction guide for bounding regions in SE2 space.
 MultivariateUniformDistribution(const Eigen::AlignedBox2d&)
     -> MultivariateUniformDistribution<Sophus::SE2d, Eigen::AlignedBox2d>;
 
+/// Deduction guide for low-discrepancy sampling over bounding regions in SE2 space.
+MultivariateUniformDistribution(const Eigen::AlignedBox2d&, LowDiscrepancy)
+    -> MultivariateUniformDistribution<Sophus::SE2d, Eigen::AlignedBox2d>;
+
 /// Specialization of multivariate uniform distribution for bounding regions in 3D space.
 template <>
 class MultivariateUniformDistribution<Sophus::SE3d, Eigen::AlignedBox3d> {
@@ -89,6 +201,19 @@ class MultivariateUniformDistribution<Sophus::SE3d, Eigen::AlignedBox3d> {
         y_distribution_{box.min().y(), box.max().y()},
         z_distribution_{box.min().z(), box.max().z()} {}
 
+  /// Constructs a low-discrepancy multivariate uniform distribution in SE(3) with 3D bounding region.
+  /**
+   * Translations follow a randomized Halton sequence over (x, y, z) so a batch
+   * of N draws stratifies the bounding region; rotations remain i.i.d. uniform
+   * over SO(3).
+   *
+   * \param box The axis-aligned bounding region.
+   */
+  MultivariateUniformDistribution(const Eigen::AlignedBox3d& box, LowDiscrepancy)
+      : MultivariateUniformDistribution(box) {
+    halton_.emplace();
+  }
+
   /// Generates a random 3D pose within the bounding region.
   /**
    * \tparam URNG The type of the random number generator.
@@ -97,6 +222,17 @@ class MultivariateUniformDistribution<Sophus::SE3d, Eigen::AlignedBox3d> {
    */
   template <class URNG>
   [[nodiscard]] Sophus::SE3d operator()(URNG& engine) {
+    if (halton_.has_value()) {
+      const auto point = (*halton_)(engine);
+      return Sophus::SE3d{
+          Sophus::SO3d::sampleUniform(engine),
+          Sophus::Vector3d{
+              x_distribution_.a() + point[0] * (x_distribution_.b() - x_distribution_.a()),
+              y_distribution_.a() + point[1] * (y_distribution_.b() - y_distribution_.a()),
+              z_distribution_.a() + point[2] * (z_distribution_.b() - z_distribution_.a()),
+          },
+      };
+    }
     return Sophus::SE3d{
         Sophus::SO3d::sampleUniform(engine),
         Sophus::Vector3d{
@@ -111,12 +247,17 @@ class MultivariateUniformDistribution<Sophus::SE3d, Eigen::AlignedBox3d> {
   std::uniform_real_distribution<double> x_distribution_;
   std::uniform_real_distribution<double> y_distribution_;
   std::uniform_real_distribution<double> z_distribution_;
+  std::optional<detail::RandomizedHalton<3>> halton_;
 };
 
 /// Deduction guide for bounding regions in SE3 space.
 MultivariateUniformDistribution(const Eigen::AlignedBox3d&)
     -> MultivariateUniformDistribution<Sophus::SE3d, Eigen::AlignedBox3d>;
 
+/// Deduction guide for low-discrepancy sampling over bounding regions in SE3 space.
+MultivariateUniformDistribution(const Eigen::AlignedBox3d&, LowDiscrepancy)
+    -> MultivariateUniformDistribution<Sophus::SE3d, Eigen::AlignedBox3d>;
+
 /// Specialization of multivariate uniform distribution for occupancy grids.
 /**
  * The range of the distribution is limited to the free space available in the occupancy grid.
@@ -128,19 +269,43 @@ class MultivariateUniformDistribution<Sophus::SE2d, OccupancyGrid> {
  public:
   /// Constructs a multivariate uniform distribution based on the provided occupancy grid.
   /**
+   * Shares the free cell index memoized on the grid (see
+   * `BaseOccupancyGrid2::cached_free_cells()`) and converts sampled cell indices
+   * to coordinates on demand, so construction is O(1) once the grid cache is
+   * warm instead of materializing every free cell coordinate each time. Only the
+   * grid geometry is copied; the distribution does not keep the grid alive.
+   *
+   * \tparam OccupancyGrid A type of the occupancy grid.
+   * \param grid The occupancy grid from which free states will be computed.
+   */
+  explicit MultivariateUniformDistribution(const OccupancyGrid& grid)
+      : free_cells_{grid.cached_free_cells()},
+        width_{grid.width()},
+        resolution_{grid.resolution()},
+        origin_{grid.origin()},
+        distribution_{0, free_cells_->size() - 1} {
+    assert(!free_cells_->empty());
+  }
+
+  /// Constructs a low-discrepancy multivariate uniform distribution based on the provided occupancy grid.
+  /**
+   * Samples follow a randomized Halton sequence over (free cell, heading), so a
+   * batch of N draws covers free space far more evenly than i.i.d. uniform
+   * draws. Free cells are stored in row-major order, so stratifying the cell
+   * index stratifies the map area they span.
+   *
    * \tparam OccupancyGrid A type of the occupancy grid.
    * \param grid The occupancy grid from which free states will be computed.
    */
-  constexpr explicit MultivariateUniformDistribution(const OccupancyGrid& grid)
-      : free_states_{compute_free_states(grid)}, distribution_{0, free_states_.size() - 1} {
-    assert(!free_states_.empty());
+  MultivariateUniformDistribution(const OccupancyGrid& grid, LowDiscrepancy) : MultivariateUniformDistribution(grid) {
+    halton_.emplace();
   }
 
   /// Generates a random 2D pose.
   /**
    * This function generates a random pose by sampling a random rotation
-   * from SO2 space and a random translation from the precomputed free states
-   * based on the provided occupancy grid.
+   * from SO2 space and a random free cell of the occupancy grid, whose global
+   * coordinates become the translation.
    *
    * \tparam URNG The type of the random number generator.
    * \param engine The random number generator engine.
@@ -148,16 +313,88 @@ class MultivariateUniformDistribution<Sophus::SE2d, OccupancyGrid> {
    */
   template <class URNG>
   [[nodiscard]] Sophus::SE2d operator()(URNG& engine) {
-    return {Sophus::SO2d::sampleUniform(engine), free_states_[distribution_(engine)]};
+    if (halton_.has_value()) {
+      const auto point = (*halton_)(engine);
+      const auto position = static_cast<std::size_t>(point[0] * static_cast<double>(free_cells_->size()));
+      const std::size_t index = (*free_cells_)[std::min(position, free_cells_->size() - 1)];
+      const auto xi = static_cast<double>(index % width_);
+      const auto yi = static_cast<double>(index / width_);
+      return {
+          Sophus::SO2d{Sophus::Constants<double>::pi() * (2.0 * point[1] - 1.0)},
+          origin_ * (Sophus::Vector2d{xi + 0.5, yi + 0.5} * resolution_)};
+    }
+    const std::size_t index = (*free_cells_)[distribution_(engine)];
+    const auto xi = static_cast<double>(index % width_);
+    const auto yi = static_cast<double>(index / width_);
+    return {Sophus::SO2d::sampleUniform(engine), origin_ * (Sophus::Vector2d{xi + 0.5, yi + 0.5} * resolution_)};
   }
 
- private:
-  std::vector<Eigen::Vector2d> free_states_;                 ///< Vector containing free states.
-  std::uniform_int_distribution<std::size_t> distribution_;  ///< Uniform distribution for indices.
-
-  static std::vector<Eigen::Vector2d> compute_free_states(const OccupancyGrid& grid) {
-    return grid.coordinates_for(grid.free_cells(), OccupancyGrid::Frame::kGlobal) | ranges::to<std::vector>;
+  /// Generates a batch of random 2D poses directly into decomposed pose columns.
+  /**
+   * Fills the (x, y, cos θ, sin θ) columns of \p out with \p count samples
+   * without constructing intermediate `Sophus::SE2d` values: cell indices are
+   * drawn and unflattened first, the origin transform and the heading sincos
+   * are then applied in tight columnar loops the compiler can vectorize.
+   *
+   * \tparam URNG The type of the random number generator.
+   * \tparam SE2Columns A decomposed pose container exposing `resize()` and
+   * mutable contiguous `x()`, `y()`, `cos_theta()` and `sin_theta()` columns,
+   * such as `beluga::SE2ColumnVector`.
+   * \param engine The random number generator engine.
+   * \param out The column container to fill.
+   * \param count The number of samples to generate.
+   */
+  template <class URNG, class SE2Columns>
+  void samples(URNG& engine, SE2Columns& out, std::size_t count) {
+    out.resize(count);
+    const auto x = out.x();
+    const auto y = out.y();
+    const auto cos_theta = out.cos_theta();
+    const auto sin_theta = out.sin_theta();
+    auto angle_distribution = std::uniform_real_distribution<double>{
+        -Sophus::Constants<double>::pi(), Sophus::Constants<double>::pi()};
+    if (halton_.has_value()) {
+      for (std::size_t i = 0; i < count; ++i) {
+        const auto point = (*halton_)(engine);
+        const auto position = static_cast<std::size_t>(point[0] * static_cast<double>(free_cells_->size()));
+        const std::size_t index = (*free_cells_)[std::min(position, free_cells_->size() - 1)];
+        x[static_cast<std::ptrdiff_t>(i)] = static_cast<double>(index % width_) + 0.5;
+        y[static_cast<std::ptrdiff_t>(i)] = static_cast<double>(index / width_) + 0.5;
+        sin_theta[static_cast<std::ptrdiff_t>(i)] = Sophus::Constants<double>::pi() * (2.0 * point[1] - 1.0);
+      }
+    } else {
+      for (std::size_t i = 0; i < count; ++i) {
+        const std::size_t index = (*free_cells_)[distribution_(engine)];
+        x[static_cast<std::ptrdiff_t>(i)] = static_cast<double>(index % width_) + 0.5;
+        y[static_cast<std::ptrdiff_t>(i)] = static_cast<double>(index / width_) + 0.5;
+        sin_theta[static_cast<std::ptrdiff_t>(i)] = angle_distribution(engine);
+      }
+    }
+    const auto& complex = origin_.so2().unit_complex();
+    const double origin_cos = complex.x();
+    const double origin_sin = complex.y();
+    const double origin_x = origin_.translation().x();
+    const double origin_y = origin_.translation().y();
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(count); ++i) {
+      const double px = x[i] * resolution_;
+      const double py = y[i] * resolution_;
+      x[i] = origin_cos * px - origin_sin * py + origin_x;
+      y[i] = origin_sin * px + origin_cos * py + origin_y;
+    }
+    for (std::ptrdiff_t i = 0; i < static_cast<std::ptrdiff_t>(count); ++i) {
+      const double theta = sin_theta[i];
+      cos_theta[i] = std::cos(theta);
+      sin_theta[i] = std::sin(theta);
+    }
   }
+
+ private:
+  std::shared_ptr<const std::vector<std::size_t>> free_cells_;  ///< Shared memoized free cell indices.
+  std::size_t width_;                                           ///< Grid width, to unflatten cell indices.
+  double resolution_;                                           ///< Grid resolution.
+  Sophus::SE2d origin_;                                         ///< Transform from grid local to global frame.
+  std::uniform_int_distribution<std::size_t> distribution_;     ///< Uniform distribution for indices.
+  std::optional<detail::RandomizedHalton<2>> halton_;           ///< Engaged in low-discrepancy mode.
 };
 
 /// Deduction guide for 2D occupancy grids.
@@ -165,6 +402,11 @@ template <class Derived>
 MultivariateUniformDistribution(const BaseOccupancyGrid2<Derived>&)
     -> MultivariateUniformDistribution<Sophus::SE2d, Derived>;
 
+/// Deduction guide for low-discrepancy sampling over 2D occupancy grids.
+template <class Derived>
+MultivariateUniformDistribution(const BaseOccupancyGrid2<Derived>&, LowDiscrepancy)
+    -> MultivariateUniformDistribution<Sophus::SE2d, Derived>;
+
 }  // namespace beluga
 
 #endif
@@ -0,0 +1,302 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_RANDOM_RANDOM_ENGINES_HPP
+#define BELUGA_RANDOM_RANDOM_ENGINES_HPP
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+
+/**
+ * \file
+ * \brief Implementation of fast pseudo-random number engines and the library-wide default engine hook.
+ */
+
+namespace beluga {
+
+/// Xoshiro256++ pseudo-random number engine.
+/**
+ * Satisfies the [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator)
+ * requirements with 64 bits of output per draw and 256 bits of state, making
+ * each draw a handful of shifts and additions instead of the large-state
+ * twister update of `std::mt19937`. See https://prng.di.unimi.it/ for the
+ * reference implementation and statistical test results.
+ */
+class Xoshiro256PlusPlus {
+ public:
+  /// Unsigned integer type produced by the engine.
+  using result_type = std::uint64_t;
+
+  /// Default seed value.
+  static constexpr result_type default_seed = 5489U;
+
+  /// Constructs an engine seeded with the given value.
+  explicit Xoshiro256PlusPlus(result_type seed_value = default_seed) { seed(seed_value); }
+
+  /// Seeds the engine, expanding the seed over the state with SplitMix64 as recommended by the authors.
+  void seed(result_type seed_value = default_seed) {
+    result_type z = seed_value;
+    for (auto& word : state_) {
+      z += 0x9E3779B97F4A7C15ULL;
+      result_type mixed = z;
+      mixed = (mixed ^ (mixed >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+      mixed = (mixed ^ (mixed >> 27U)) * 0x94D049BB133111EBULL;
+      word = mixed ^ (mixed >> 31U);
+    }
+  }
+
+  /// Returns the smallest value the engine can produce.
+  [[nodiscard]] static constexpr result_type min() { return 0; }
+
+  /// Returns the largest value the engine can produce.
+  [[nodiscard]] static constexpr result_type max() { return ~result_type{0}; }
+
+  /// Advances the engine state and returns the next value.
+  result_type operator()() {
+    const result_type result = rotl(state_[0] + state_[3], 23) + state_[0];
+    const result_type t = state_[1] << 17U;
+    state_[2] ^= state_[0];
+    state_[3] ^= state_[1];
+    state_[1] ^= state_[2];
+    state_[0] ^= state_[3];
+    state_[2] ^= t;
+    state_[3] = rotl(state_[3], 45);
+    return result;
+  }
+
+ private:
+  [[nodiscard]] static constexpr result_type rotl(result_type value, int shift) {
+    return (value << shift) | (value >> (64 - shift));
+  }
+
+  std::array<result_type, 4> state_;
+};
+
+/// PCG32 (PCG-XSH-RR 64/32) pseudo-random number engine.
+/**
+ * Satisfies the [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator)
+ * requirements with 32 bits of output per draw from 64 bits of state, with an
+ * optional stream selector so multiple decorrelated engines can share a seed.
+ * See https://www.pcg-random.org/ for the reference implementation.
+ */
+class Pcg32 {
+ public:
+  /// Unsigned integer type produced by the engine.
+  using result_type = std::uint32_t;
+
+  /// Default seed value.
+  static constexpr std::uint64_t default_seed = 0x853C49E6748FEA9BULL;
+
+  /// Default stream selector.
+  static constexpr std::uint64_t default_stream = 0xDA3E39CB94B95BDBULL;
+
+  /// Constructs an engine seeded with the given value, drawing from the given stream.
+  explicit Pcg32(std::uint64_t seed_value = default_seed, std::uint64_t stream = default_stream) {
+    seed(seed_value, stream);
+  }
+
+  /// Seeds the engine, optionally selecting the stream to draw from.
+  void seed(std::uint64_t seed_value = default_seed, std::uint64_t stream = default_stream) {
+    increment_ = (stream << 1U) | 1U;
+    state_ = 0U;
+    (*this)();
+    state_ += seed_value;
+    (*this)();
+  }
+
+  /// Returns the smallest value the engine can produce.
+  [[nodiscard]] static constexpr result_type min() { return 0; }
+
+  /// Returns the largest value the engine can produce.
+  [[nodiscard]] static constexpr result_type max() { return ~result_type{0}; }
+
+  /// Advances the engine state and returns the next value.
+  result_type operator()() {
+    const std::uint64_t old_state = state_;
+    state_ = old_state * 6364136223846793005ULL + increment_;
+    const auto xorshifted = static_cast<result_type>(((old_state >> 18U) ^ old_state) >> 27U);
+    const auto rotation = static_cast<result_type>(old_state >> 59U);
+    return (xorshifted >> rotation) | (xorshifted << ((32U - rotation) & 31U));
+  }
+
+ private:
+  std::uint64_t state_;
+  std::uint64_t increment_;
+};
+
+/// Philox4x32-10 counter-based pseudo-random number engine.
+/**
+ * Satisfies the [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator)
+ * requirements. Unlike stateful engines, the output is a pure function of a
+ * (seed, stream, counter) triple: engines constructed from the same seed and
+ * stream produce the same sequence regardless of how many other engines exist
+ * or which thread runs them. This makes per-element streams (e.g. one per
+ * particle, keyed by particle index) lock-free and bitwise-reproducible across
+ * thread counts. See Salmon et al., "Parallel random numbers: as easy as
+ * 1, 2, 3" (SC'11) and the Random123 reference implementation.
+ */
+class Philox4x32 {
+ public:
+  /// Unsigned integer type produced by the engine.
+  using result_type = std::uint32_t;
+
+  /// Constructs an engine producing the stream identified by (seed, stream).
+  explicit Philox4x32(std::uint64_t seed_value = 0, std::uint64_t stream = 0) { seed(seed_value, stream); }
+
+  /// Seeds the engine, restarting the stream identified by (seed, stream) from its beginning.
+  void seed(std::uint64_t seed_value = 0, std::uint64_t stream = 0) {
+    key_ = {static_cast<std::uint32_t>(seed_value), static_cast<std::uint32_t>(seed_value >> 32U)};
+    stream_ = {static_cast<std::uint32_t>(stream), static_cast<std::uint32_t>(stream >> 32U)};
+    counter_ = 0;
+    next_ = kBlockSize;
+  }
+
+  /// Returns the smallest value the engine can produce.
+  [[nodiscard]] static constexpr result_type min() { return 0; }
+
+  /// Returns the largest value the engine can produce.
+  [[nodiscard]] static constexpr result_type max() { return ~result_type{0}; }
+
+  /// Advances the engine state and returns the next value.
+  result_type operator()() {
+    if (next_ == kBlockSize) {
+      block_ = generate_block(counter_++);
+      next_ = 0;
+    }
+    return block_[next_++];
+  }
+
+ private:
+  static constexpr std::size_t kBlockSize = 4;
+  static constexpr std::size_t kRounds = 10;
+  static constexpr std::uint32_t kMultiplier0 = 0xD2511F53U;
+  static constexpr std::uint32_t kMultiplier1 = 0xCD9E8D57U;
+  static constexpr std::uint32_t kWeyl0 = 0x9E3779B9U;
+  static constexpr std::uint32_t kWeyl1 = 0xBB67AE85U;
+
+  [[nodiscard]] std::array<std::uint32_t, kBlockSize> generate_block(std::uint64_t block_counter) const {
+    std::array<std::uint32_t, kBlockSize> counter = {
+        static_cast<std::uint32_t>(block_counter), static_cast<std::uint32_t>(block_counter >> 32U), stream_[0],
+        stream_[1]};
+    std::array<std::uint32_t, 2> key = key_;
+    for (std::size_t round = 0; round < kRounds; ++round) {
+      const std::uint64_t product0 = static_cast<std::uint64_t>(kMultiplier0) * counter[0];
+      const std::uint64_t product1 = static_cast<std::uint64_t>(kMultiplier1) * counter[2];
+      counter = {
+          static_cast<std::uint32_t>(product1 >> 32U) ^ counter[1] ^ key[0],
+          static_cast<std::uint32_t>(product1),
+          static_cast<std::uint32_t>(product0 >> 32U) ^ counter[3] ^ key[1],
+          static_cast<std::uint32_t>(product0),
+      };
+      key[0] += kWeyl0;
+      key[1] += kWeyl1;
+    }
+    return counter;
+  }
+
+  std::array<std::uint32_t, 2> key_;
+  std::array<std::uint32_t, 2> stream_;
+  std::uint64_t counter_;
+  std::array<std::uint32_t, kBlockSize> block_;
+  std::size_t next_;
+};
+
+}  // namespace beluga
+
+/// Library-wide default engine hook.
+/**
+ * Define this macro to a UniformRandomBitGenerator type before including any
+ * Beluga header to change the engine that all stochastic stages (sampling views,
+ * state propagation, recovery interspersion) draw from when no engine is
+ * explicitly provided.
+ */
+#ifndef BELUGA_DEFAULT_RANDOM_ENGINE
+#define BELUGA_DEFAULT_RANDOM_ENGINE beluga::Xoshiro256PlusPlus
+#endif
+
+namespace beluga {
+
+/// The pseudo-random number engine used when none is explicitly provided.
+using default_random_engine = BELUGA_DEFAULT_RANDOM_ENGINE;
+
+namespace detail {
+
+/// Shared state of the default engine pool.
+/**
+ * Each thread owns one engine slot, so draws never contend on shared engine
+ * state. The pool-wide base seed and reseed epoch are the only shared words,
+ * and they are read-only on the hot path.
+ */
+struct RandomEnginePoolState {
+  /// Seed that per-thread slots are derived from.
+  std::atomic<std::uint64_t> base_seed;
+  /// Bumped on every reseed so existing slots know to reseed themselves.
+  std::atomic<std::uint64_t> epoch{0};
+  /// Next slot index to hand out to a newly seen thread.
+  std::atomic<std::uint64_t> next_slot{0};
+};
+
+/// Returns the process-wide default engine pool state.
+inline RandomEnginePoolState& random_engine_pool_state() {
+  static RandomEnginePoolState state{{std::random_device{}()}, {0}, {0}};
+  return state;
+}
+
+}  // namespace detail
+
+/// Seeds the pool of per-thread default engines from a single base seed.
+/**
+ * Each thread's engine is reseeded with the base seed plus its slot index the
+ * next time it is acquired, so a given thread reproduces its draw sequence
+ * after an identical reseed while distinct threads keep decorrelated streams.
+ * The default engine expands seeds with SplitMix64, so adjacent per-slot seeds
+ * do not produce correlated sequences.
+ *
+ * \param base_seed Seed that per-thread engine slots are derived from.
+ */
+inline void seed_default_random_engines(std::uint64_t base_seed) {
+  auto& state = detail::random_engine_pool_state();
+  state.base_seed.store(base_seed, std::memory_order_relaxed);
+  state.epoch.fetch_add(1, std::memory_order_release);
+}
+
+/// Returns the calling thread's engine from the default engine pool.
+/**
+ * Stochastic stages fall back to this engine when no engine is passed in,
+ * so overriding \c BELUGA_DEFAULT_RANDOM_ENGINE (or passing an engine
+ * explicitly) is enough to change the generator behind every random draw.
+ * Engines live in a thread-keyed pool: acquiring one never blocks on other
+ * threads, and \ref seed_default_random_engines reseeds every slot
+ * deterministically.
+ */
+inline default_random_engine& get_default_random_engine() {
+  auto& state = detail::random_engine_pool_state();
+  thread_local const std::uint64_t slot = state.next_slot.fetch_add(1, std::memory_order_relaxed);
+  thread_local default_random_engine engine;
+  thread_local std::uint64_t seen_epoch = ~std::uint64_t{0};
+  const std::uint64_t epoch = state.epoch.load(std::memory_order_acquire);
+  if (seen_epoch != epoch) {
+    engine.seed(static_cast<typename default_random_engine::result_type>(
+        state.base_seed.load(std::memory_order_relaxed) + slot));
+    seen_epoch = epoch;
+  }
+  return engine;
+}
+
+}  // namespace beluga
+
+#endif
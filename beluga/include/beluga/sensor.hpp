@@ -57,11 +57,16 @@
  * - beluga::BeamSensorModel
  * - beluga::LandmarkSensorModel
  * - beluga::BearingSensorModel
+ * - beluga::FusedSensorModel
  */
 
 #include <beluga/sensor/beam_model.hpp>
 #include <beluga/sensor/bearing_sensor_model.hpp>
+#include <beluga/sensor/bucketed_weighting.hpp>
+#include <beluga/sensor/deadline_weighting.hpp>
+#include <beluga/sensor/fused_sensor_model.hpp>
 #include <beluga/sensor/landmark_sensor_model.hpp>
+#include <beluga/sensor/lazy_likelihood_field_model.hpp>
 #include <beluga/sensor/likelihood_field_model.hpp>
 #include <beluga/sensor/ndt_sensor_model.hpp>
 
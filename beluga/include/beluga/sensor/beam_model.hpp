@@ -16,7 +16,11 @@
 #define BELUGA_SENSOR_BEAM_MODEL_HPP
 
 #include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <cstddef>
+#include <memory>
+#include <optional>
 #include <random>
 #include <vector>
 
@@ -24,6 +28,7 @@
 
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/all.hpp>
+#include <range/v3/view/span.hpp>
 #include <range/v3/view/transform.hpp>
 #include <sophus/se2.hpp>
 #include <sophus/so2.hpp>
@@ -101,62 +106,212 @@ class BeamSensorModel {
    *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
    */
   [[nodiscard]] auto operator()(measurement_type&& points) const {
-    return [this, points = std::move(points)](const state_type& state) -> weight_type {
-      const auto beam = Ray2d{grid_, state, params_.beam_max_range};
-      const double n = 1. / (std::sqrt(2. * M_PI) * params_.sigma_hit);
-      return std::transform_reduce(
-          points.cbegin(), points.cend(), 0.0, std::plus{}, [this, &beam, n](const auto& point) {
-            // TODO(Ramiro): We're converting from range + bearing to cartesian points in the ROS node, but we want
-            // range
-            // + bearing here. We might want to make that conversion in the likelihood model instead, and let the
-            // measurement type be range, bearing instead of x, y.
-
-            // Compute the range according to the measurement.
-            const double z = std::sqrt(point.first * point.first + point.second * point.second);
-
-            // dirty hack to prevent SO2d from calculating the hypot again to normalize the vector.
-            auto beam_bearing = Sophus::SO2d{};
-            beam_bearing.data()[0] = point.first / z;
-            beam_bearing.data()[1] = point.second / z;
-
-            // Compute range according to the map (raycasting).
-            const double z_mean = beam.cast(beam_bearing).value_or(params_.beam_max_range);
-            // 1: Correct range with local measurement noise.
-            const double eta_hit =
-                2. / (std::erf((params_.beam_max_range - z_mean) / (std::sqrt(2.) * params_.sigma_hit)) -
-                      std::erf(-z_mean / (std::sqrt(2.) * params_.sigma_hit)));
-            const double d = (z - z_mean) / params_.sigma_hit;
-            double pz = params_.z_hit * eta_hit * n * std::exp(-(d * d) / 2.);
-
-            // 2: Unexpected objects.
-            if (z < z_mean) {
-              const double eta_short = 1. / (1. - std::exp(-params_.lambda_short * z_mean));
-              pz += params_.z_short * params_.lambda_short * eta_short * std::exp(-params_.lambda_short * z);
-            }
+    return [this, points = std::move(points), cache = make_raycast_cache()](const state_type& state) -> weight_type {
+      return importance_weight(points, state, cache.get());
+    };
+  }
 
-            // 3 and 4: Max range return or random return.
-            if (z < params_.beam_max_range) {
-              pz += params_.z_rand / params_.beam_max_range;
-            } else {
-              pz += params_.z_max;
+  /// Returns a state weighting function conditioned on a borrowed view of 2D lidar hits.
+  /**
+   * Zero-copy overload for drivers that keep the hit points in a preallocated buffer
+   * reused across scans. Unlike the owning overload, the returned weighting function
+   * traverses the caller's buffer on every weighting call, so the buffer must remain
+   * valid and unchanged for as long as the function is used (i.e. until the reweight
+   * pass it conditions has completed).
+   *
+   * \param points Non-owning view of 2D lidar hit points in the reference frame of
+   *  particle states.
+   * \return a state weighting function satisfying \ref StateWeightingFunctionPage
+   *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   */
+  [[nodiscard]] auto operator()(ranges::span<const std::pair<double, double>> points) const {
+    return [this, points, cache = make_raycast_cache()](const state_type& state) -> weight_type {
+      return importance_weight(points, state, cache.get());
+    };
+  }
+
+ private:
+  /// Creates the shared per-update ray-cast cache, or nothing when caching is disabled.
+  [[nodiscard]] std::shared_ptr<RaycastCache> make_raycast_cache() const {
+    if (raycast_cache_capacity_ == 0) {
+      return nullptr;
+    }
+    return std::make_shared<RaycastCache>(raycast_cache_bins_, raycast_cache_capacity_);
+  }
+
+  /// Computes the importance weight of a state given a range of 2D lidar hit points.
+  template <class Points>
+  [[nodiscard]] weight_type importance_weight(const Points& points, const state_type& state, RaycastCache* cache)
+      const {
+    const auto beam = Ray2d{grid_, state, params_.beam_max_range};
+    const auto pose_in_grid_frame = grid_.origin().inverse() * state;
+    const auto source_cell = grid_.cell_near(pose_in_grid_frame.translation());
+    const auto source_cell_index = grid_.index_at(source_cell.x(), source_cell.y());
+    const double n = 1. / (std::sqrt(2. * M_PI) * params_.sigma_hit);
+    return std::transform_reduce(
+        points.begin(), points.end(), 0.0, std::plus{},
+        [this, &beam, &pose_in_grid_frame, source_cell_index, cache, n](const auto& point) {
+          // TODO(Ramiro): We're converting from range + bearing to cartesian points in the ROS node, but we want
+          // range
+          // + bearing here. We might want to make that conversion in the likelihood model instead, and let the
+          // measurement type be range, bearing instead of x, y.
+
+          // Compute the range according to the measurement.
+          const double z = std::sqrt(point.first * point.first + point.second * point.second);
+
+          // dirty hack to prevent SO2d from calculating the hypot again to normalize the vector.
+          auto beam_bearing = Sophus::SO2d{};
+          beam_bearing.data()[0] = point.first / z;
+          beam_bearing.data()[1] = point.second / z;
+
+          // Compute range according to the map, through the precomputed lookup
+          // table when one was prepared, or by raycasting otherwise, memoizing
+          // results per (cell, heading bucket) when the per-update cache is enabled.
+          const auto resolve = [&] {
+            if (raycast_lookup_) {
+              return raycast_lookup_
+                  ->cast(pose_in_grid_frame.translation(), pose_in_grid_frame.so2() * beam_bearing)
+                  .value_or(params_.beam_max_range);
             }
+            return beam.cast(beam_bearing).value_or(params_.beam_max_range);
+          };
+          const double z_mean =
+              cache ? cache->cast(source_cell_index, pose_in_grid_frame.so2() * beam_bearing, resolve) : resolve();
 
-            // TODO(glpuga): Investigate why AMCL and QuickMCL both use this formula for the weight.
-            // See https://github.com/Ekumen-OS/beluga/issues/153
-            return pz * pz * pz;
-          });
-    };
+          // Evaluate the four-component mixture, through the precomputed likelihood
+          // table when one was prepared, or with the exp/erf math otherwise.
+          if (!likelihood_table_.empty()) {
+            const std::size_t stride = likelihood_table_bins_ + 1;
+            return static_cast<double>(likelihood_table_[likelihood_bin(z_mean) * stride + likelihood_bin(z)]);
+          }
+          const double pz = mixture_weight(z, z_mean, n);
+
+          // TODO(glpuga): Investigate why AMCL and QuickMCL both use this formula for the weight.
+          // See https://github.com/Ekumen-OS/beluga/issues/153
+          return pz * pz * pz;
+        });
+  }
+
+  /// Evaluates the four-component beam mixture for a (measured, expected) range pair.
+  /**
+   * \param z Measured range, in meters.
+   * \param z_mean Expected range according to the map, in meters.
+   * \param n Normalization constant of the hit gaussian, hoisted by the caller.
+   */
+  [[nodiscard]] double mixture_weight(double z, double z_mean, double n) const {
+    // 1: Correct range with local measurement noise.
+    const double eta_hit = 2. / (std::erf((params_.beam_max_range - z_mean) / (std::sqrt(2.) * params_.sigma_hit)) -
+                                 std::erf(-z_mean / (std::sqrt(2.) * params_.sigma_hit)));
+    const double d = (z - z_mean) / params_.sigma_hit;
+    double pz = params_.z_hit * eta_hit * n * std::exp(-(d * d) / 2.);
+
+    // 2: Unexpected objects.
+    if (z < z_mean) {
+      const double eta_short = 1. / (1. - std::exp(-params_.lambda_short * z_mean));
+      pz += params_.z_short * params_.lambda_short * eta_short * std::exp(-params_.lambda_short * z);
+    }
+
+    // 3 and 4: Max range return or random return.
+    if (z < params_.beam_max_range) {
+      pz += params_.z_rand / params_.beam_max_range;
+    } else {
+      pz += params_.z_max;
+    }
+
+    return pz;
+  }
+
+  /// Maps a range to its likelihood table bin, with the last bin pinned at max range.
+  [[nodiscard]] std::size_t likelihood_bin(double range) const {
+    if (range >= params_.beam_max_range) {
+      return likelihood_table_bins_;
+    }
+    const auto bin = static_cast<std::size_t>(range / params_.beam_max_range * static_cast<double>(likelihood_table_bins_));
+    return std::min(bin, likelihood_table_bins_ - 1);
+  }
+
+ public:
+  /// Precomputes a ray-cast lookup table for the current map.
+  /**
+   * Once prepared, state weighting functions returned by this model resolve the
+   * expected range of each beam with an O(log n) lookup instead of a per-beam
+   * cell traversal, which dominates the update time at high particle counts.
+   * The table is rebuilt automatically when the map is updated.
+   *
+   * \param angular_bins Number of quantized ray headings; see beluga::RaycastLookupTable.
+   */
+  void prepare_raycast_lookup(std::size_t angular_bins) {
+    raycast_lookup_.emplace(grid_, angular_bins, params_.beam_max_range);
+    raycast_lookup_bins_ = angular_bins;
+  }
+
+  /// Enables a per-update ray-cast result cache.
+  /**
+   * Once enabled, each state weighting function returned by this model carries a
+   * bounded cache that memoizes expected ranges per (source cell, heading bucket)
+   * pair, so particles of a converged cloud that occupy the same cell share one
+   * traversal per beam instead of re-casting identical ray fans. The cache lives
+   * for one sensor update and its memory is fixed by the chosen capacity, unlike
+   * the precomputed table of `prepare_raycast_lookup()`; see beluga::RaycastCache.
+   *
+   * \param angular_bins Number of quantized ray headings over a full turn.
+   * \param capacity Number of cache entries, eight bytes each.
+   */
+  void enable_raycast_cache(std::size_t angular_bins, std::size_t capacity = 1 << 16) {
+    raycast_cache_bins_ = angular_bins;
+    raycast_cache_capacity_ = capacity;
+  }
+
+  /// Precomputes the beam likelihood mixture over quantized (expected, measured) range pairs.
+  /**
+   * Once prepared, the per-beam evaluation that follows ray casting becomes a single
+   * table load instead of exp/erf-class math, at the cost of quantizing both ranges
+   * to `bins` intervals over [0, beam_max_range]. Entries are evaluated at bin
+   * centers, with one extra bin per axis pinned at exactly the maximum range so the
+   * common miss and max-return cases are represented without quantization error.
+   * The table depends only on the model parameters, not on the map, so map updates
+   * do not invalidate it. Memory is 4 bytes per (expected, measured) pair.
+   *
+   * \param bins Number of quantization intervals per range axis.
+   */
+  void prepare_likelihood_table(std::size_t bins) {
+    assert(bins > 0);
+    likelihood_table_bins_ = bins;
+    const std::size_t stride = bins + 1;
+    likelihood_table_.assign(stride * stride, 0.F);
+    const double bin_size = params_.beam_max_range / static_cast<double>(bins);
+    const double n = 1. / (std::sqrt(2. * M_PI) * params_.sigma_hit);
+    for (std::size_t expected = 0; expected <= bins; ++expected) {
+      const double z_mean =
+          expected == bins ? params_.beam_max_range : (static_cast<double>(expected) + 0.5) * bin_size;
+      for (std::size_t measured = 0; measured <= bins; ++measured) {
+        const double z = measured == bins ? params_.beam_max_range : (static_cast<double>(measured) + 0.5) * bin_size;
+        const double pz = mixture_weight(z, z_mean, n);
+        likelihood_table_[expected * stride + measured] = static_cast<float>(pz * pz * pz);
+      }
+    }
   }
 
   /// Update the sensor model with a new occupancy grid map.
   /**
    * \param map New occupancy grid representing the static map.
    */
-  void update_map(map_type&& map) { grid_ = std::move(map); }
+  void update_map(map_type&& map) {
+    grid_ = std::move(map);
+    if (raycast_lookup_) {
+      prepare_raycast_lookup(raycast_lookup_bins_);
+    }
+  }
 
  private:
   param_type params_;
   OccupancyGrid grid_;
+  std::optional<RaycastLookupTable<OccupancyGrid>> raycast_lookup_;
+  std::size_t raycast_lookup_bins_ = 0;
+  std::size_t raycast_cache_bins_ = 0;
+  std::size_t raycast_cache_capacity_ = 0;
+  std::vector<float> likelihood_table_;
+  std::size_t likelihood_table_bins_ = 0;
 };
 
 }  // namespace beluga
@@ -18,13 +18,17 @@
 // external
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/all.hpp>
+#include <range/v3/view/span.hpp>
 #include <range/v3/view/transform.hpp>
 #include <sophus/se2.hpp>
 #include <sophus/se3.hpp>
 
 // standard library
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <random>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
@@ -80,14 +84,52 @@ class BearingSensorModel {
   explicit BearingSensorModel(param_type params, LandmarkMap landmark_map)
       : params_{std::move(params)}, landmark_map_{std::move(landmark_map)} {}
 
-  /// Returns a state weighting function conditioned on landmark bearing detections.
+  /// State weighting function conditioned on landmark bearing detections.
   /**
-   * \param detections Landmark bearing detections in the reference frame of particle states.
-   * \return a state weighting function satisfying \ref StateWeightingFunctionPage
-   *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   * Returned by BearingSensorModel::operator()(). It satisfies \ref StateWeightingFunctionPage
+   * and borrows a reference to the sensor model (and thus their lifetime are bound).
+   *
+   * All measurement-only computation (bearing normalization and the Gaussian scale
+   * factor) is hoisted into construction, so the per-particle call only composes the
+   * sensor pose and evaluates the detections. Besides the single-state form, a batch
+   * form over contiguous spans of states and weights is provided; actions that can
+   * access particle storage as columns (see `beluga::TupleContainer::span()`) use it
+   * to weigh all particles in one pass.
    */
-  [[nodiscard]] auto operator()(measurement_type&& detections) const {
-    return [this, detections = std::move(detections)](const state_type& state) -> weight_type {
+  class StateWeightingFunction {
+   public:
+    /// Constructs a state weighting function from a borrowed sensor model and bearing detections.
+    StateWeightingFunction(const BearingSensorModel& model, measurement_type detections)
+        : model_{&model},
+          detections_{std::move(detections)},
+          negative_inverse_two_sigma_squared_{
+              -1. / (2. * model.params_.sigma_bearing * model.params_.sigma_bearing)} {
+      normalized_bearings_.reserve(detections_.size());
+      for (const auto& detection : detections_) {
+        normalized_bearings_.push_back(detection.detection_bearing_in_sensor.normalized());
+      }
+    }
+
+    /// Computes the importance weight for a single particle state.
+    [[nodiscard]] weight_type operator()(const state_type& state) const { return importance_weight(state); }
+
+    /// Multiplies the importance weight of each state into the corresponding weight.
+    /**
+     * Batch form of the state weighting function; both spans must have the same size.
+     * Each state resolves its sensor pose once and then evaluates every detection
+     * against the landmark index over the contiguous detection arrays prepared at
+     * construction, with no per-particle dispatch in between.
+     */
+    template <class Weight>
+    void operator()(ranges::span<const state_type> states, ranges::span<Weight> weights) const {
+      assert(states.size() == weights.size());
+      for (std::ptrdiff_t index = 0; index < states.size(); ++index) {
+        weights[index] = weights[index] * importance_weight(states[index]);
+      }
+    }
+
+   private:
+    [[nodiscard]] weight_type importance_weight(const state_type& state) const {
       Sophus::SE3d robot_pose_in_world;
 
       if constexpr (std::is_same_v<state_type, Sophus::SE3d>) {
@@ -104,25 +146,25 @@ class BearingSensorModel {
       }
 
       // precalculate the sensor pose in the world frame
-      const auto sensor_pose_in_world = robot_pose_in_world * params_.sensor_pose_in_robot;
+      const auto sensor_pose_in_world = robot_pose_in_world * model_->params_.sensor_pose_in_robot;
 
-      const auto detection_weight = [this, &sensor_pose_in_world](const auto& detection) {
+      double weight = 1.0;
+      for (std::size_t index = 0; index < detections_.size(); ++index) {
         // find the landmark the most closely matches the sample bearing vector
-        const auto opt_landmark_bearing_in_sensor = landmark_map_.find_closest_bearing_landmark(
-            detection.detection_bearing_in_sensor, detection.category, sensor_pose_in_world);
+        const auto opt_landmark_bearing_in_sensor = model_->landmark_map_.find_closest_bearing_landmark(
+            detections_[index].detection_bearing_in_sensor, detections_[index].category, sensor_pose_in_world);
 
-        // if we did not find a matching landmark, return 0.0
+        // if we did not find a matching landmark, the weight vanishes
         if (!opt_landmark_bearing_in_sensor) {
           return 0.0;
         }
 
-        // recover sample bearing vector
-        const auto detection_bearing_in_sensor = detection.detection_bearing_in_sensor.normalized();
-
         // recover landmark bearing vector
         const auto& landmark_bearing_in_sensor = *opt_landmark_bearing_in_sensor;
 
-        // calculate the aperture angle between the detection and the landmark
+        // calculate the aperture angle between the detection and the landmark,
+        // using the detection bearing normalized once at construction
+        const auto& detection_bearing_in_sensor = normalized_bearings_[index];
         const auto cos_aperture = detection_bearing_in_sensor.dot(landmark_bearing_in_sensor);
         const auto sin_aperture = detection_bearing_in_sensor.cross(landmark_bearing_in_sensor).norm();
 
@@ -130,14 +172,25 @@ class BearingSensorModel {
         const auto bearing_error = std::atan2(sin_aperture, cos_aperture);
 
         // model the probability of the landmark being detected as depending on the bearing error
-        const auto bearing_error_prob =
-            std::exp(-bearing_error * bearing_error / (2. * params_.sigma_bearing * params_.sigma_bearing));
+        weight *= std::exp(bearing_error * bearing_error * negative_inverse_two_sigma_squared_);
+      }
+      return weight;
+    }
 
-        return bearing_error_prob;
-      };
+    const BearingSensorModel* model_;
+    measurement_type detections_;
+    std::vector<LandmarkBearing3> normalized_bearings_;
+    double negative_inverse_two_sigma_squared_;
+  };
 
-      return std::transform_reduce(detections.cbegin(), detections.cend(), 1.0, std::multiplies{}, detection_weight);
-    };
+  /// Returns a state weighting function conditioned on landmark bearing detections.
+  /**
+   * \param detections Landmark bearing detections in the reference frame of particle states.
+   * \return a state weighting function satisfying \ref StateWeightingFunctionPage
+   *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   */
+  [[nodiscard]] auto operator()(measurement_type&& detections) const {
+    return StateWeightingFunction{*this, std::move(detections)};
   }
 
   /// Update the sensor model with a new landmark `map`.
@@ -0,0 +1,192 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_DATA_COMPRESSED_VALUE_GRID_HPP
+#define BELUGA_SENSOR_DATA_COMPRESSED_VALUE_GRID_HPP
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <beluga/sensor/data/value_grid.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a run-length compressed tiled value grid.
+ */
+
+namespace beluga {
+
+/// Tile-compressed lookup companion to a 2D linear value grid.
+/**
+ * Partitions the source grid into fixed-size square tiles and collapses every
+ * tile holding a single repeated value to that constant; only mixed tiles keep
+ * their cells densely. On maps dominated by unknown space — where most of a
+ * likelihood field is one repeated value — this cuts field memory several-fold,
+ * letting the hot working set of lookups fit in a much smaller cache footprint.
+ *
+ * Lookups are two-level: plane coordinates resolve to a tile through a small
+ * directory, and uniform tiles answer without touching any dense storage.
+ * Out-of-map lookups resolve to a fixed border value, mirroring
+ * `beluga::PaddedValueGrid2` semantics, so the two are drop-in interchangeable
+ * as the lookup structure of `beluga::LikelihoodFieldModel`.
+ *
+ * \tparam T Any copyable type.
+ */
+template <typename T>
+class CompressedValueGrid2 {
+ public:
+  /// Cells per tile side.
+  static constexpr std::size_t kTileSide = 16;
+
+  /// Constructs the compressed grid from a source grid.
+  /**
+   * \param grid Source value grid to compress.
+   * \param border_value Value held by out-of-map space, returned for out-of-map lookups.
+   */
+  explicit CompressedValueGrid2(const ValueGrid2<T>& grid, T border_value)
+      : border_value_(border_value),
+        inner_width_(static_cast<int>(grid.width())),
+        inner_height_(static_cast<int>(grid.height())),
+        tiles_per_row_((grid.width() + kTileSide - 1) / kTileSide),
+        resolution_(grid.resolution()),
+        inverse_resolution_(grid.inverse_resolution()) {
+    const std::size_t tile_rows = (grid.height() + kTileSide - 1) / kTileSide;
+    tile_offsets_.resize(tiles_per_row_ * tile_rows, kUniformTile);
+    tile_values_.resize(tiles_per_row_ * tile_rows, border_value);
+    const auto& data = grid.data();
+    for (std::size_t tile_y = 0; tile_y < tile_rows; ++tile_y) {
+      for (std::size_t tile_x = 0; tile_x < tiles_per_row_; ++tile_x) {
+        const std::size_t x_first = tile_x * kTileSide;
+        const std::size_t y_first = tile_y * kTileSide;
+        const std::size_t x_last = std::min(x_first + kTileSide, grid.width());
+        const std::size_t y_last = std::min(y_first + kTileSide, grid.height());
+        const T& first_value = data[y_first * grid.width() + x_first];
+        bool uniform = true;
+        for (std::size_t yi = y_first; uniform && yi < y_last; ++yi) {
+          for (std::size_t xi = x_first; xi < x_last; ++xi) {
+            if (data[yi * grid.width() + xi] != first_value) {
+              uniform = false;
+              break;
+            }
+          }
+        }
+        const std::size_t tile = tile_y * tiles_per_row_ + tile_x;
+        if (uniform) {
+          tile_values_[tile] = first_value;
+          continue;
+        }
+        // Cells of partial edge tiles beyond the grid extent are filled with the
+        // border value; lookups bounds-check first, so they are never read.
+        tile_offsets_[tile] = static_cast<std::uint32_t>(dense_.size());
+        for (std::size_t yi = y_first; yi < y_first + kTileSide; ++yi) {
+          for (std::size_t xi = x_first; xi < x_first + kTileSide; ++xi) {
+            dense_.push_back(xi < x_last && yi < y_last ? data[yi * grid.width() + xi] : border_value);
+          }
+        }
+      }
+    }
+  }
+
+  /// Gets grid resolution.
+  [[nodiscard]] double resolution() const { return resolution_; }
+
+  /// Gets grid resolution reciprocal, frozen at construction.
+  [[nodiscard]] double inverse_resolution() const { return inverse_resolution_; }
+
+  /// Gets the total number of tiles.
+  [[nodiscard]] std::size_t tile_count() const { return tile_offsets_.size(); }
+
+  /// Gets the number of mixed tiles storing dense cell data.
+  [[nodiscard]] std::size_t dense_tile_count() const { return dense_.size() / (kTileSide * kTileSide); }
+
+  /// Gets the value of the cell nearest to the given plane coordinates.
+  /**
+   * Always returns a value: the border value when the coordinates fall outside
+   * the source grid.
+   *
+   * \param x Plane x-axis coordinate.
+   * \param y Plane y-axis coordinate.
+   */
+  [[nodiscard]] T data_near(double x, double y) const { return *address_near(x, y); }
+
+  /// Gathers the values of the cells nearest to a batch of plane coordinates.
+  /**
+   * Same contract as `PaddedValueGrid2::gather_near`: equivalent to one
+   * `data_near()` call per coordinate pair, with each resolved address
+   * prefetched a fixed distance ahead of its load so scattered lookups overlap
+   * their cache misses.
+   *
+   * \param xs Plane x-axis coordinates, one per lookup.
+   * \param ys Plane y-axis coordinates, one per lookup.
+   * \param count Number of lookups.
+   * \param out Caller-provided buffer where `count` values are written.
+   */
+  void gather_near(const double* xs, const double* ys, std::size_t count, T* out) const {
+    constexpr std::size_t kPrefetchDistance = 16;
+    const T* pending[kPrefetchDistance];
+    const std::size_t lookahead = std::min(kPrefetchDistance, count);
+    for (std::size_t index = 0; index < lookahead; ++index) {
+      const T* address = address_near(xs[index], ys[index]);
+      detail::prefetch(address);
+      pending[index] = address;
+    }
+    for (std::size_t index = 0; index < count; ++index) {
+      // Load before refilling the ring slot: lookup `index + kPrefetchDistance` reuses it.
+      out[index] = *pending[index % kPrefetchDistance];
+      const std::size_t ahead = index + kPrefetchDistance;
+      if (ahead < count) {
+        const T* address = address_near(xs[ahead], ys[ahead]);
+        detail::prefetch(address);
+        pending[ahead % kPrefetchDistance] = address;
+      }
+    }
+  }
+
+ private:
+  static constexpr std::uint32_t kUniformTile = std::numeric_limits<std::uint32_t>::max();
+
+  [[nodiscard]] const T* address_near(double x, double y) const {
+    const auto scaled_x = x * inverse_resolution_;
+    const auto scaled_y = y * inverse_resolution_;
+    // Same `std::floor` replacement as `BaseRegularGrid2::cell_near`.
+    const auto xi = static_cast<int>(scaled_x) - (scaled_x < 0.0);
+    const auto yi = static_cast<int>(scaled_y) - (scaled_y < 0.0);
+    if (xi < 0 || xi >= inner_width_ || yi < 0 || yi >= inner_height_) {
+      return &border_value_;
+    }
+    const auto x_cell = static_cast<std::size_t>(xi);
+    const auto y_cell = static_cast<std::size_t>(yi);
+    const std::size_t tile = (y_cell / kTileSide) * tiles_per_row_ + (x_cell / kTileSide);
+    const auto offset = tile_offsets_[tile];
+    if (offset == kUniformTile) {
+      return &tile_values_[tile];
+    }
+    return &dense_[offset + (y_cell % kTileSide) * kTileSide + (x_cell % kTileSide)];
+  }
+
+  T border_value_;
+  int inner_width_;
+  int inner_height_;
+  std::size_t tiles_per_row_;
+  double resolution_;
+  double inverse_resolution_;
+  std::vector<std::uint32_t> tile_offsets_;
+  std::vector<T> tile_values_;
+  std::vector<T> dense_;
+};
+
+}  // namespace beluga
+
+#endif
@@ -16,8 +16,8 @@
 #define BELUGA_SENSOR_DATA_DENSE_GRID_HPP
 
 #include <optional>
-#include <vector>
 
+#include <beluga/containers/circular_array.hpp>
 #include <beluga/sensor/data/regular_grid.hpp>
 
 #include <Eigen/Core>
@@ -132,23 +132,26 @@ class BaseDenseGrid2 : public BaseRegularGrid2<Derived> {
 
   /// Computes 4-connected neighborhood for cell.
   /**
+   * Neighbors are returned in a fixed capacity array to avoid heap
+   * allocations in hot loops (e.g. distance map construction).
+   *
    * \param xi Grid cell x-axis coordinate.
    * \param yi Grid cell y-axis coordinate.
    * \return range of neighbor cells.
    */
   [[nodiscard]] auto neighborhood4(int xi, int yi) const {
-    auto result = std::vector<Eigen::Vector2i>{};
+    auto result = CircularArray<Eigen::Vector2i, 4>{};
     if (xi < static_cast<int>(this->self().width() - 1)) {
-      result.emplace_back(xi + 1, yi);
+      result.push_back(Eigen::Vector2i{xi + 1, yi});
     }
     if (yi < static_cast<int>(this->self().height() - 1)) {
-      result.emplace_back(xi, yi + 1);
+      result.push_back(Eigen::Vector2i{xi, yi + 1});
     }
     if (xi > 0) {
-      result.emplace_back(xi - 1, yi);
+      result.push_back(Eigen::Vector2i{xi - 1, yi});
     }
     if (yi > 0) {
-      result.emplace_back(xi, yi - 1);
+      result.push_back(Eigen::Vector2i{xi, yi - 1});
     }
     return result;
   }
@@ -16,12 +16,16 @@
 #define BELUGA_SENSOR_DATA_LANDMARK_MAP_HPP
 
 // external
-#include <range/v3/view/filter.hpp>
+#include <range/v3/view/transform.hpp>
 #include <sophus/se3.hpp>
 
 // standard library
 #include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <optional>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -36,6 +40,11 @@
 namespace beluga {
 
 /// Basic 3D landmark map datatype
+/**
+ * Landmarks are indexed per category into a static k-d tree at construction,
+ * so nearest-landmark matching is logarithmic in the number of landmarks of
+ * the detection category instead of a linear scan over the whole map.
+ */
 class LandmarkMap {
  public:
   /// Vector of landmarks
@@ -46,8 +55,16 @@ class LandmarkMap {
   /// @brief Constructor.
   /// @param boundaries Limits of the map.
   /// @param landmarks List of landmarks that can be expected to be detected.
-  LandmarkMap(const LandmarkMapBoundaries& boundaries, landmarks_set_position_data landmarks)
-      : landmarks_(std::move(landmarks)), map_boundaries_(std::move(boundaries)) {}
+  LandmarkMap(const LandmarkMapBoundaries& boundaries, const landmarks_set_position_data& landmarks)
+      : map_boundaries_(boundaries) {
+    std::unordered_map<LandmarkCategory, std::vector<LandmarkPosition3>> positions_per_category;
+    for (const auto& landmark : landmarks) {
+      positions_per_category[landmark.category].push_back(landmark.detection_position_in_robot);
+    }
+    for (auto& [category, positions] : positions_per_category) {
+      indices_.emplace(category, KdTree{std::move(positions)});
+    }
+  }
 
   /// @brief Returns the map boundaries.
   /// @return The map boundaries.
@@ -61,31 +78,11 @@ class LandmarkMap {
       const LandmarkPosition3& detection_position_in_world,
       const LandmarkCategory& detection_category) const {
     // only consider those that have the same id
-    auto same_category_landmarks_view =
-        landmarks_ | ranges::views::filter([detection_category = detection_category](const auto& l) {
-          return detection_category == l.category;
-        });
-
-    // find the landmark that minimizes the distance to the detection position
-    // This is O(n). A spatial data structure should be used instead.
-    auto min = std::min_element(
-        same_category_landmarks_view.begin(), same_category_landmarks_view.end(),
-        [&detection_position_in_world](const auto& a, const auto& b) {
-          const auto& landmark_a_position_in_world = a.detection_position_in_robot;
-          const auto& landmark_b_position_in_world = b.detection_position_in_robot;
-
-          const auto landmark_b_squared_in_world_squared =
-              (landmark_a_position_in_world - detection_position_in_world).squaredNorm();
-          const auto landmark_b_distance_in_world_squared =
-              (landmark_b_position_in_world - detection_position_in_world).squaredNorm();
-          return landmark_b_squared_in_world_squared < landmark_b_distance_in_world_squared;
-        });
-
-    if (min == same_category_landmarks_view.end()) {
+    const auto it = indices_.find(detection_category);
+    if (it == indices_.end()) {
       return std::nullopt;
     }
-
-    return min->detection_position_in_robot;
+    return it->second.nearest(detection_position_in_world);
   }
 
   /// @brief Finds the landmark that minimizes the bearing error to a given detection and returns its data.
@@ -98,49 +95,112 @@ class LandmarkMap {
       const LandmarkCategory& detection_category,
       const world_pose_type& sensor_pose_in_world) const {
     // only consider those that have the same detection id (category)
-    auto same_category_landmarks_view =
-        landmarks_ | ranges::views::filter([detection_category = detection_category](const auto& l) {
-          return detection_category == l.category;
-        });
+    const auto it = indices_.find(detection_category);
+    if (it == indices_.end()) {
+      return std::nullopt;
+    }
 
-    // find the landmark that minimizes the bearing error
+    // Bearing error is angular, not euclidean, so the k-d tree does not apply;
+    // scan the packed per-category positions once, maximizing the dot product
+    // against the detection bearing vector without repeating transformations.
     const auto world_in_sensor_transform = sensor_pose_in_world.inverse();
 
-    // This whole search thing is very expensive, with objects getting created, normalized and
-    // destroyed multiple times and the same transformations being calculated over and over again.
-    // This will only work as a proof-of-concept, but it needs to be optimized for large numbers of
-    // landmarks.
-    const auto minimization_function = [&detection_bearing_in_sensor, &world_in_sensor_transform](
-                                           const auto& a, const auto& b) {
-      const auto& landmark_a_position_in_world = a.detection_position_in_robot;
-      const auto& landmark_b_position_in_world = b.detection_position_in_robot;
-
-      // convert the landmark locations relative to the sensor frame
-      const auto landmark_a_bearing_in_sensor = (world_in_sensor_transform * landmark_a_position_in_world).normalized();
-      const auto landmark_b_bearing_in_sensor = (world_in_sensor_transform * landmark_b_position_in_world).normalized();
-
-      // find the landmark that minimizes the bearing error by maximizing the dot product against the
-      // detection bearing vector
-      const auto dot_product_a = landmark_a_bearing_in_sensor.dot(detection_bearing_in_sensor);
-      const auto dot_product_b = landmark_b_bearing_in_sensor.dot(detection_bearing_in_sensor);
-
-      return dot_product_a > dot_product_b;
+    double best_dot_product = -std::numeric_limits<double>::infinity();
+    std::optional<LandmarkBearing3> best_bearing_in_sensor;
+    for (const auto& landmark_position_in_world : it->second.positions()) {
+      const auto landmark_bearing_in_sensor = (world_in_sensor_transform * landmark_position_in_world).normalized();
+      const auto dot_product = landmark_bearing_in_sensor.dot(detection_bearing_in_sensor);
+      if (dot_product > best_dot_product) {
+        best_dot_product = dot_product;
+        best_bearing_in_sensor = landmark_bearing_in_sensor;
+      }
+    }
+    return best_bearing_in_sensor;
+  }
+
+ private:
+  /// Static k-d tree over the landmark positions of a single category.
+  class KdTree {
+   public:
+    /// @brief Constructor, rearranges the given positions into k-d order.
+    /// @param positions Landmark positions to index.
+    explicit KdTree(std::vector<LandmarkPosition3> positions) {
+      nodes_.reserve(positions.size());
+      build(positions, 0, positions.size(), 0);
+    }
+
+    /// @brief Finds the position nearest to a query point.
+    /// @param query The query point.
+    /// @return The nearest indexed position. nullopt if the tree is empty.
+    [[nodiscard]] std::optional<LandmarkPosition3> nearest(const LandmarkPosition3& query) const {
+      if (nodes_.empty()) {
+        return std::nullopt;
+      }
+      std::size_t best = 0;
+      double best_squared_distance = std::numeric_limits<double>::infinity();
+      search(0, query, best, best_squared_distance);
+      return nodes_[best].position;
+    }
+
+    /// @brief Returns a view over the indexed positions, in unspecified order.
+    [[nodiscard]] auto positions() const {
+      return ranges::views::transform(nodes_, [](const Node& node) -> const LandmarkPosition3& {
+        return node.position;
+      });
+    }
+
+   private:
+    struct Node {
+      LandmarkPosition3 position;
+      std::int32_t left = -1;
+      std::int32_t right = -1;
+      std::int32_t axis = 0;
     };
 
-    auto min = std::min_element(
-        same_category_landmarks_view.begin(), same_category_landmarks_view.end(), minimization_function);
+    std::int32_t build(std::vector<LandmarkPosition3>& positions, std::size_t first, std::size_t last, int depth) {
+      if (first == last) {
+        return -1;
+      }
+      const auto axis = depth % 3;
+      const std::size_t median = first + (last - first) / 2;
+      const auto begin = positions.begin();
+      std::nth_element(
+          begin + static_cast<std::ptrdiff_t>(first), begin + static_cast<std::ptrdiff_t>(median),
+          begin + static_cast<std::ptrdiff_t>(last),
+          [axis](const LandmarkPosition3& lhs, const LandmarkPosition3& rhs) { return lhs[axis] < rhs[axis]; });
+      const auto index = static_cast<std::int32_t>(nodes_.size());
+      nodes_.push_back(Node{positions[median], -1, -1, axis});
+      const auto left = build(positions, first, median, depth + 1);
+      const auto right = build(positions, median + 1, last, depth + 1);
+      nodes_[static_cast<std::size_t>(index)].left = left;
+      nodes_[static_cast<std::size_t>(index)].right = right;
+      return index;
+    }
 
-    if (min == same_category_landmarks_view.end()) {
-      return std::nullopt;
+    void search(std::int32_t index, const LandmarkPosition3& query, std::size_t& best, double& best_squared_distance)
+        const {
+      if (index < 0) {
+        return;
+      }
+      const Node& node = nodes_[static_cast<std::size_t>(index)];
+      const double squared_distance = (node.position - query).squaredNorm();
+      if (squared_distance < best_squared_distance) {
+        best_squared_distance = squared_distance;
+        best = static_cast<std::size_t>(index);
+      }
+      const double delta = query[node.axis] - node.position[node.axis];
+      const auto near_child = delta < 0. ? node.left : node.right;
+      const auto far_child = delta < 0. ? node.right : node.left;
+      search(near_child, query, best, best_squared_distance);
+      if (delta * delta < best_squared_distance) {
+        search(far_child, query, best, best_squared_distance);
+      }
     }
 
-    // find the normalized bearing vector to the landmark, relative to the sensor frame
-    const auto landmark_position_in_sensor = world_in_sensor_transform * min->detection_position_in_robot;
-    return landmark_position_in_sensor.normalized();
-  }
+    std::vector<Node> nodes_;
+  };
 
- private:
-  landmarks_set_position_data landmarks_;
+  std::unordered_map<LandmarkCategory, KdTree> indices_;
   LandmarkMapBoundaries map_boundaries_;
 };
 
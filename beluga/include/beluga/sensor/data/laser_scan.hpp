@@ -16,11 +16,13 @@
 #define BELUGA_SENSOR_DATA_LASER_SCAN_HPP
 
 #include <cmath>
+#include <vector>
 
 #include <ciabatta/ciabatta.hpp>
 
 #include <sophus/types.hpp>
 
+#include <range/v3/algorithm/equal.hpp>
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/zip.hpp>
@@ -44,6 +46,12 @@ namespace beluga {
  * - `l.max_range()` returns the maximum allowed range value (in meters),
  * - `l.origin()` returns the transform, of `Sophus::SE3d` type, from the global to local
  *   frame in the sensor space;
+ *
+ * Additionally, `L` may satisfy the following optional requirements:
+ * - `l.intensities()` returns a view to the per-beam return intensities, aligned with
+ *   `l.ranges()`, when the sensor reports them. Implementations that select beams by
+ *   return quality are expected to mask pruned beams with NaN ranges, so every
+ *   consumer drops them through the regular range validity filtering.
  */
 
 /// Laser scan 2D base type.
@@ -59,11 +67,26 @@ template <typename Derived>
 class BaseLaserScan : public ciabatta::ciabatta_top<Derived> {
  public:
   /// View points in cartesian coordinates in sensor frame.
+  /**
+   * Beam angles are fixed for the life of a sensor, so the per-beam (cos, sin)
+   * directions are cached on first use and the per-scan conversion is reduced to one
+   * multiply per coordinate. The cache is keyed by the full angle table: validating it
+   * is a linear pass of comparisons, which replaces the two libm calls per beam of
+   * recomputing the trigonometry on every scan.
+   */
   [[nodiscard]] auto points_in_cartesian_coordinates() const {
-    return this->self().points_in_polar_coordinates() | ranges::views::transform([](const auto& vector) {
-             using std::cos, std::sin;
-             return Sophus::Vector2<typename Derived::Scalar>{
-                 vector.x() * cos(vector.y()), vector.x() * sin(vector.y())};
+    update_beam_direction_cache();
+    return ranges::views::zip(this->self().ranges(), beam_directions_) |
+           ranges::views::filter([this](const auto& tuple) {
+             const auto [range, direction] = tuple;
+             using std::isnan;
+             return !isnan(range) && range >= this->self().min_range() && range <= this->self().max_range();
+           }) |
+           ranges::views::transform([](const auto& tuple) {
+             const auto& [range, direction] = tuple;
+             using Scalar = typename Derived::Scalar;
+             return Sophus::Vector2<Scalar>{
+                 static_cast<Scalar>(range * direction.x()), static_cast<Scalar>(range * direction.y())};
            });
   }
 
@@ -86,6 +109,32 @@ class BaseLaserScan : public ciabatta::ciabatta_top<Derived> {
              return Sophus::Vector2<typename Derived::Scalar>{range, theta};
            });
   }
+
+ private:
+  /// Rebuilds the per-beam direction table if the beam angles changed.
+  /**
+   * The cache is stored in double precision regardless of `Derived::Scalar` (which is
+   * incomplete at member declaration time), and cast back on use.
+   */
+  void update_beam_direction_cache() const {
+    const auto angles = this->self().angles();
+    if (ranges::equal(angles, beam_angles_)) {
+      return;
+    }
+    beam_angles_.clear();
+    beam_directions_.clear();
+    for (const auto theta : angles) {
+      using std::cos, std::sin;
+      const auto angle = static_cast<double>(theta);
+      beam_angles_.push_back(angle);
+      beam_directions_.emplace_back(cos(angle), sin(angle));
+    }
+  }
+
+  /// Beam angles the cached direction table was computed from.
+  mutable std::vector<double> beam_angles_;
+  /// Per-beam (cos, sin) directions, kept in sync with `beam_angles_`.
+  mutable std::vector<Sophus::Vector2d> beam_directions_;
 };
 
 }  // namespace beluga
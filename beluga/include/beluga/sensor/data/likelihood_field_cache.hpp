@@ -0,0 +1,256 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_DATA_LIKELIHOOD_FIELD_CACHE_HPP
+#define BELUGA_SENSOR_DATA_LIKELIHOOD_FIELD_CACHE_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <exception>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <sstream>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <beluga/sensor/data/value_grid.hpp>
+#include <beluga/sensor/likelihood_field_model.hpp>
+
+/**
+ * \file
+ * \brief Implementation of an on-disk cache for precomputed likelihood fields.
+ */
+
+namespace beluga {
+
+namespace detail {
+
+/// On-disk header of a cached likelihood field file. All fields are little-endian.
+struct LikelihoodFieldCacheHeader {
+  /// File format magic number.
+  std::uint8_t magic[8];  // NOLINT(modernize-avoid-c-arrays)
+  /// File format version.
+  std::uint32_t version;
+  /// Size of the stored field scalar type, in bytes.
+  std::uint32_t scalar_size;
+  /// Content hash of the source map and model parameters.
+  std::uint64_t key;
+  /// Field width, in cells.
+  std::uint64_t width;
+  /// Field height, in cells.
+  std::uint64_t height;
+  /// Field resolution, in meters per cell.
+  double resolution;
+};
+
+static_assert(sizeof(LikelihoodFieldCacheHeader) == 48);
+static_assert(std::is_trivially_copyable_v<LikelihoodFieldCacheHeader>);
+
+/// Expected magic number of a cached likelihood field file.
+inline constexpr std::uint8_t kLikelihoodFieldCacheMagic[8] = {'B', 'L', 'G', 'L', 'F', 'C', '2', '\0'};
+
+/// Supported cached likelihood field format version.
+inline constexpr std::uint32_t kLikelihoodFieldCacheVersion = 1;
+
+/// Mixes a byte buffer into a 64-bit FNV-1a hash.
+inline std::uint64_t fnv1a_combine(std::uint64_t hash, const void* data, std::size_t size) {
+  const auto* bytes = static_cast<const unsigned char*>(data);
+  for (std::size_t index = 0; index < size; ++index) {
+    hash ^= bytes[index];
+    hash *= 0x00000100000001B3ULL;
+  }
+  return hash;
+}
+
+}  // namespace detail
+
+/// Computes the cache key identifying a likelihood field build.
+/**
+ * The key hashes everything the computed field depends on: the grid dimensions
+ * and resolution, the obstacle occupancy of every cell, and the model
+ * parameters. The grid origin is deliberately excluded, since the field is
+ * stored in grid-local coordinates and translating or rotating the map does
+ * not change it.
+ *
+ * \tparam OccupancyGrid Type representing an occupancy grid.
+ *  It must satisfy \ref OccupancyGrid2Page.
+ * \param grid Occupancy grid the field would be built from.
+ * \param params Likelihood field model parameters.
+ * \return A 64-bit content hash.
+ */
+template <class OccupancyGrid>
+std::uint64_t likelihood_field_cache_key(const OccupancyGrid& grid, const LikelihoodFieldModelParam& params) {
+  std::uint64_t hash = 0xCBF29CE484222325ULL;  // FNV-1a offset basis.
+  const std::uint64_t width = grid.width();
+  const std::uint64_t height = grid.height();
+  const double resolution = grid.resolution();
+  hash = detail::fnv1a_combine(hash, &width, sizeof(width));
+  hash = detail::fnv1a_combine(hash, &height, sizeof(height));
+  hash = detail::fnv1a_combine(hash, &resolution, sizeof(resolution));
+  const auto bitmap = grid.packed_obstacle_data();
+  hash = detail::fnv1a_combine(hash, bitmap.words().data(), bitmap.words().size() * sizeof(std::uint64_t));
+  hash = detail::fnv1a_combine(hash, &params.max_obstacle_distance, sizeof(params.max_obstacle_distance));
+  hash = detail::fnv1a_combine(hash, &params.max_laser_distance, sizeof(params.max_laser_distance));
+  hash = detail::fnv1a_combine(hash, &params.z_hit, sizeof(params.z_hit));
+  hash = detail::fnv1a_combine(hash, &params.z_random, sizeof(params.z_random));
+  hash = detail::fnv1a_combine(hash, &params.sigma_hit, sizeof(params.sigma_hit));
+  const auto use_log_likelihood = static_cast<unsigned char>(params.use_log_likelihood);
+  hash = detail::fnv1a_combine(hash, &use_log_likelihood, sizeof(use_log_likelihood));
+  return hash;
+}
+
+/// Returns the cache file name for a given cache key.
+inline std::filesystem::path likelihood_field_cache_filename(std::uint64_t key) {
+  std::ostringstream name;
+  name << "likelihood_field_" << std::hex << key << ".blf";
+  return std::filesystem::path{name.str()};
+}
+
+namespace io {
+
+/// Saves a likelihood field to a cache file loadable by `load_likelihood_field()`.
+/**
+ * \tparam FieldScalar Scalar type used to store the likelihood field.
+ * \param field Likelihood field to serialize, in row-major order.
+ * \param key Cache key identifying the build, as computed by
+ *  `beluga::likelihood_field_cache_key()`.
+ * \param path Path to the cache file to create or overwrite.
+ * \throws std::invalid_argument If the file cannot be written.
+ */
+template <typename FieldScalar>
+void save_likelihood_field(const ValueGrid2<FieldScalar>& field, std::uint64_t key, const std::filesystem::path& path) {
+  detail::LikelihoodFieldCacheHeader header{};
+  std::copy(
+      std::begin(detail::kLikelihoodFieldCacheMagic), std::end(detail::kLikelihoodFieldCacheMagic),
+      std::begin(header.magic));
+  header.version = detail::kLikelihoodFieldCacheVersion;
+  header.scalar_size = sizeof(FieldScalar);
+  header.key = key;
+  header.width = field.width();
+  header.height = field.height();
+  header.resolution = field.resolution();
+
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  file.write(
+      reinterpret_cast<const char*>(field.data().data()),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      static_cast<std::streamsize>(field.size() * sizeof(FieldScalar)));
+  if (!file) {
+    throw std::invalid_argument{"Couldn't write a likelihood field cache file at " + path.string()};
+  }
+}
+
+/// Loads a likelihood field from a cache file if it matches the given key.
+/**
+ * The file is memory-mapped and validated against the expected key, so a stale
+ * cache (from a different map or parameter set) is simply skipped. Loading a
+ * matching field is a header check plus one pass over the mapped pages, with
+ * no distance transform involved.
+ *
+ * \tparam FieldScalar Scalar type used to store the likelihood field.
+ * \param path Path to a cache file, as written by `save_likelihood_field()`.
+ * \param key Expected cache key, as computed by `beluga::likelihood_field_cache_key()`.
+ * \return The cached likelihood field, or `std::nullopt` if the file does not
+ *  exist, is not a valid cache file, or was built from different inputs.
+ */
+template <typename FieldScalar>
+std::optional<ValueGrid2<FieldScalar>> load_likelihood_field(const std::filesystem::path& path, std::uint64_t key) {
+  using header_type = detail::LikelihoodFieldCacheHeader;
+  const int descriptor = ::open(path.c_str(), O_RDONLY);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+  if (descriptor < 0) {
+    return std::nullopt;
+  }
+  struct stat status {};
+  if (::fstat(descriptor, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(header_type)) {
+    ::close(descriptor);
+    return std::nullopt;
+  }
+  const auto mapped_size = static_cast<std::size_t>(status.st_size);
+  void* address = ::mmap(nullptr, mapped_size, PROT_READ, MAP_SHARED, descriptor, 0);
+  ::close(descriptor);  // The mapping keeps its own reference to the file.
+  if (address == MAP_FAILED) {  // NOLINT(performance-no-int-to-ptr,cppcoreguidelines-pro-type-cstyle-cast)
+    return std::nullopt;
+  }
+
+  header_type header;
+  std::memcpy(&header, address, sizeof(header));
+  const std::size_t cell_count = header.width * header.height;
+  const bool valid =
+      std::equal(std::begin(header.magic), std::end(header.magic), detail::kLikelihoodFieldCacheMagic) &&
+      header.version == detail::kLikelihoodFieldCacheVersion && header.scalar_size == sizeof(FieldScalar) &&
+      header.key == key && header.width > 0 && header.resolution > 0. &&
+      mapped_size >= sizeof(header_type) + cell_count * sizeof(FieldScalar);
+  if (!valid) {
+    ::munmap(address, mapped_size);
+    return std::nullopt;
+  }
+
+  const auto* values = reinterpret_cast<const FieldScalar*>(  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      static_cast<const std::byte*>(address) + sizeof(header_type));
+  auto data = std::vector<FieldScalar>(values, values + cell_count);
+  ::munmap(address, mapped_size);
+  return ValueGrid2<FieldScalar>{std::move(data), static_cast<std::size_t>(header.width), header.resolution};
+}
+
+}  // namespace io
+
+/// Constructs a likelihood field model, loading the field from an on-disk cache when possible.
+/**
+ * The cache is keyed by a content hash of the map and the model parameters, so
+ * on the common boot where neither changed the model comes up from a header
+ * check and a memory-mapped read instead of recomputing the distance transform
+ * over the whole map. On a miss the model is built as usual and the computed
+ * field is written back for the next boot; a failed write only costs the next
+ * boot a rebuild.
+ *
+ * \tparam OccupancyGrid Type representing an occupancy grid.
+ *  It must satisfy \ref OccupancyGrid2Page.
+ * \tparam FieldScalar Scalar type used to store the likelihood field.
+ * \param params Parameters to configure the model.
+ * \param grid Occupancy grid representing the static map.
+ * \param cache_directory Directory holding the cache files, created if missing.
+ * \return A likelihood field model over the given grid.
+ */
+template <class OccupancyGrid, class FieldScalar = double>
+LikelihoodFieldModel<OccupancyGrid, FieldScalar> make_cached_likelihood_field_model(
+    const LikelihoodFieldModelParam& params,
+    const OccupancyGrid& grid,
+    const std::filesystem::path& cache_directory) {
+  const std::uint64_t key = likelihood_field_cache_key(grid, params);
+  const auto path = cache_directory / likelihood_field_cache_filename(key);
+  if (auto field = io::load_likelihood_field<FieldScalar>(path, key)) {
+    return LikelihoodFieldModel<OccupancyGrid, FieldScalar>{params, grid, std::move(*field)};
+  }
+  auto model = LikelihoodFieldModel<OccupancyGrid, FieldScalar>{params, grid};
+  try {
+    std::filesystem::create_directories(cache_directory);
+    io::save_likelihood_field(model.likelihood_field(), key, path);
+  } catch (const std::exception&) {
+    // A failed cache write must not take the filter down; the next boot just rebuilds.
+  }
+  return model;
+}
+
+}  // namespace beluga
+
+#endif
@@ -15,10 +15,11 @@
 #ifndef BELUGA_SENSOR_DATA_LINEAR_GRID_HPP
 #define BELUGA_SENSOR_DATA_LINEAR_GRID_HPP
 
+#include <cassert>
 #include <cstdint>
 #include <optional>
-#include <vector>
 
+#include <beluga/containers/circular_array.hpp>
 #include <beluga/sensor/data/dense_grid.hpp>
 
 #include <Eigen/Core>
@@ -43,6 +44,13 @@ namespace beluga {
  *   random access linear data structure containing grid cell data values;
  * - given possibly const grid cell index `i` of `std::size_t` type,
  *   `g.data_at(i)` optionally returns cell data, if cell is included;
+ * - given possibly const grid cell index `i` of `std::size_t` type known
+ *   to be included in the grid, `g.data_at_unchecked(i)` returns cell data
+ *   without bounds checking;
+ * - given possibly const grid cell coordinates `xi` and `yi` of type `int`,
+ *   or `pi` of `Eigen::Vector2i` type, known to be included in the grid,
+ *   `g.data_at_unchecked(xi, yi)` and `g.data_at_unchecked(pi)` return cell
+ *   data without bounds checking;
  * - given possibly const grid cell index `i` of `std::size_t` type,
  *   `g.coordinates_at(i)` returns embedding space coordinates as an
  *   `Eigen::Vector2d` value;
@@ -101,15 +109,54 @@ class BaseLinearGrid2 : public BaseDenseGrid2<Derived> {
     return index < this->self().size() ? std::make_optional(this->self().data()[index]) : std::nullopt;
   }
 
+  /// Gets cell data without bounds checking.
+  /**
+   * For internal loops whose indices are provably valid (e.g. ray traces
+   * clipped to the grid beforehand), where `data_at()` would re-validate and
+   * wrap cells in optionals once per O(cells) iteration. Bounds logic belongs
+   * at the loop boundary; passing a cell not included in the grid is
+   * undefined behavior.
+   *
+   * \param index Grid cell index. Must be included in the grid.
+   * \return Cell data.
+   */
+  [[nodiscard]] decltype(auto) data_at_unchecked(std::size_t index) const {
+    assert(index < this->self().size());
+    return this->self().data()[index];
+  }
+
+  /// Gets cell data without bounds checking.
+  /**
+   * \param xi Grid cell x-axis coordinate. The cell must be included in the grid.
+   * \param yi Grid cell y-axis coordinate. The cell must be included in the grid.
+   * \return Cell data.
+   */
+  [[nodiscard]] decltype(auto) data_at_unchecked(int xi, int yi) const {
+    assert(this->self().contains(xi, yi));
+    return this->self().data_at_unchecked(this->self().index_at(xi, yi));
+  }
+
+  /// Gets cell data without bounds checking.
+  /**
+   * \param pi Grid cell coordinates. The cell must be included in the grid.
+   * \return Cell data.
+   */
+  [[nodiscard]] decltype(auto) data_at_unchecked(const Eigen::Vector2i& pi) const {
+    return this->self().data_at_unchecked(pi.x(), pi.y());
+  }
+
   using BaseDenseGrid2<Derived>::neighborhood4;
 
   /// Computes 4-connected neighborhood for cell.
   /**
+   * Neighbors are returned in a fixed capacity array to avoid heap
+   * allocations in hot loops (e.g. distance map construction).
+   *
    * \param index Grid cell index.
    * \return range of neighbor cells' indices.
    */
   [[nodiscard]] auto neighborhood4(std::size_t index) const {
-    auto result = std::vector<std::size_t>{};
+    auto result = CircularArray<std::size_t, 4>{};
     const std::size_t xi = index % this->self().width();
     const std::size_t yi = index / this->self().width();
     if (xi < (this->self().width() - 1)) {
@@ -0,0 +1,360 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_DATA_NDT_BINARY_MAP_HPP
+#define BELUGA_SENSOR_DATA_NDT_BINARY_MAP_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <Eigen/Core>
+
+#include <beluga/sensor/data/ndt_cell.hpp>
+#include <beluga/sensor/data/sparse_value_grid.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a memory-mapped binary NDT map representation.
+ */
+
+namespace beluga {
+
+namespace detail {
+
+/// On-disk header of a binary NDT map file. All fields are little-endian.
+struct NDTBinaryMapHeader {
+  /// File format magic number.
+  std::uint8_t magic[8];  // NOLINT(modernize-avoid-c-arrays)
+  /// File format version.
+  std::uint32_t version;
+  /// Reserved for future use, must be zero.
+  std::uint32_t reserved;
+  /// Number of cell records following the header.
+  std::uint64_t cell_count;
+  /// Resolution of the discrete grid, in meters per cell.
+  double resolution;
+};
+
+static_assert(sizeof(NDTBinaryMapHeader) == 32);
+
+/// On-disk record for a single 2D NDT cell, sorted by cell coordinates.
+struct NDTBinaryMapRecord {
+  /// Cell coordinates.
+  std::int32_t cell[2];  // NOLINT(modernize-avoid-c-arrays)
+  /// Mean of the cell normal distribution.
+  double mean[2];  // NOLINT(modernize-avoid-c-arrays)
+  /// Covariance of the cell normal distribution, in column-major order.
+  double covariance[4];  // NOLINT(modernize-avoid-c-arrays)
+};
+
+static_assert(sizeof(NDTBinaryMapRecord) == 56);
+static_assert(std::is_trivially_copyable_v<NDTBinaryMapHeader>);
+static_assert(std::is_trivially_copyable_v<NDTBinaryMapRecord>);
+
+/// Expected magic number of a binary NDT map file.
+inline constexpr std::uint8_t kNDTBinaryMapMagic[8] = {'B', 'L', 'G', 'N', 'D', 'T', '2', '\0'};
+
+/// Supported binary NDT map format version.
+inline constexpr std::uint32_t kNDTBinaryMapVersion = 1;
+
+/// Lexicographic order over cell coordinates, shared by the writer and the lookup path.
+inline bool ndt_binary_map_record_less(const NDTBinaryMapRecord& record, const Eigen::Vector2i& key) {
+  return record.cell[0] != key.x() ? record.cell[0] < key.x() : record.cell[1] < key.y();
+}
+
+}  // namespace detail
+
+/// Read-only 2D NDT cell map backed by a memory-mapped binary file.
+/**
+ * The on-disk cell records are used in place as the map storage: loading is an
+ * `mmap()` plus header validation, with no per-cell parsing, and cold pages are
+ * faulted in on demand as cells are queried. Records are sorted by cell
+ * coordinates at write time, so lookups are binary searches over the mapped
+ * region and no index needs to be built at load time.
+ *
+ * It implements the subset of the standard associative container API that
+ * `beluga::SparseValueGrid` relies on, so `SparseValueGrid<MemoryMappedNDTMap2d>`
+ * is a valid NDT map representation for `beluga::NDTSensorModel`.
+ */
+class MemoryMappedNDTMap2d {
+ public:
+  /// Key type of the map entries.
+  using key_type = Eigen::Vector2i;
+  /// Mapped type of the map entries.
+  using mapped_type = NDTCell2d;
+  /// Type of the map entries, materialized on access.
+  struct value_type {
+    /// Cell coordinates.
+    key_type first;
+    /// NDT cell at those coordinates.
+    mapped_type second;
+  };
+  /// Size type of the map.
+  using size_type = std::size_t;
+
+  /// Constant iterator over the mapped cell records.
+  class const_iterator {
+   public:
+    /// Proxy holding a materialized entry, enabling member access on dereference.
+    struct arrow_proxy {
+      /// Materialized entry.
+      value_type value;
+      /// Arrow operator overload.
+      const value_type* operator->() const { return &value; }
+    };
+
+    /// Default constructor.
+    const_iterator() = default;
+
+    /// Constructs an iterator over a cell record.
+    explicit const_iterator(const detail::NDTBinaryMapRecord* record) : record_{record} {}
+
+    /// Dereference operator overload, materializes the entry.
+    [[nodiscard]] value_type operator*() const {
+      return value_type{
+          key_type{record_->cell[0], record_->cell[1]},
+          mapped_type{
+              Eigen::Vector2d{record_->mean[0], record_->mean[1]},
+              Eigen::Map<const Eigen::Matrix2d>{record_->covariance}}};
+    }
+
+    /// Arrow operator overload, materializes the entry behind a proxy.
+    [[nodiscard]] arrow_proxy operator->() const { return arrow_proxy{**this}; }
+
+    /// Prefix increment operator overload.
+    const_iterator& operator++() {
+      ++record_;
+      return *this;
+    }
+
+    /// Equality operator overload.
+    [[nodiscard]] bool operator==(const const_iterator& other) const { return record_ == other.record_; }
+
+    /// Inequality operator overload.
+    [[nodiscard]] bool operator!=(const const_iterator& other) const { return record_ != other.record_; }
+
+   private:
+    const detail::NDTBinaryMapRecord* record_ = nullptr;
+  };
+
+  /// Constructs an empty map, not backed by any file.
+  MemoryMappedNDTMap2d() = default;
+
+  /// Maps a binary NDT map file into memory.
+  /**
+   * \param path Path to a binary NDT map file.
+   * \throws std::invalid_argument If the file cannot be opened or is not a
+   *   valid binary NDT map.
+   */
+  explicit MemoryMappedNDTMap2d(const std::filesystem::path& path) {
+    const int descriptor = ::open(path.c_str(), O_RDONLY);  // NOLINT(cppcoreguidelines-pro-type-vararg)
+    if (descriptor < 0) {
+      throw std::invalid_argument{"Couldn't open an NDT map file at " + path.string()};
+    }
+    struct stat status {};
+    if (::fstat(descriptor, &status) != 0 || static_cast<std::size_t>(status.st_size) < sizeof(header_type)) {
+      ::close(descriptor);
+      throw std::invalid_argument{"Invalid NDT map file at " + path.string()};
+    }
+    mapped_size_ = static_cast<std::size_t>(status.st_size);
+    void* address = ::mmap(nullptr, mapped_size_, PROT_READ, MAP_SHARED, descriptor, 0);
+    ::close(descriptor);  // The mapping keeps its own reference to the file.
+    if (address == MAP_FAILED) {  // NOLINT(performance-no-int-to-ptr,cppcoreguidelines-pro-type-cstyle-cast)
+      throw std::invalid_argument{"Couldn't map the NDT map file at " + path.string()};
+    }
+    mapped_data_ = address;
+
+    header_type header;
+    std::memcpy(&header, mapped_data_, sizeof(header));
+    const bool valid = std::equal(std::begin(header.magic), std::end(header.magic), detail::kNDTBinaryMapMagic) &&
+                       header.version == detail::kNDTBinaryMapVersion && header.resolution > 0. &&
+                       mapped_size_ >= sizeof(header_type) + header.cell_count * sizeof(record_type);
+    if (!valid) {
+      ::munmap(mapped_data_, mapped_size_);
+      mapped_data_ = nullptr;
+      throw std::invalid_argument{"Invalid NDT map file at " + path.string()};
+    }
+    cell_count_ = static_cast<std::size_t>(header.cell_count);
+    resolution_ = header.resolution;
+  }
+
+  /// Move constructor.
+  MemoryMappedNDTMap2d(MemoryMappedNDTMap2d&& other) noexcept
+      : mapped_data_{std::exchange(other.mapped_data_, nullptr)},
+        mapped_size_{std::exchange(other.mapped_size_, 0)},
+        cell_count_{std::exchange(other.cell_count_, 0)},
+        resolution_{other.resolution_} {}
+
+  /// Move assignment operator overload.
+  MemoryMappedNDTMap2d& operator=(MemoryMappedNDTMap2d&& other) noexcept {
+    if (this != &other) {
+      unmap();
+      mapped_data_ = std::exchange(other.mapped_data_, nullptr);
+      mapped_size_ = std::exchange(other.mapped_size_, 0);
+      cell_count_ = std::exchange(other.cell_count_, 0);
+      resolution_ = other.resolution_;
+    }
+    return *this;
+  }
+
+  /// The mapping is not copyable, only movable.
+  MemoryMappedNDTMap2d(const MemoryMappedNDTMap2d&) = delete;
+  /// The mapping is not copyable, only movable.
+  MemoryMappedNDTMap2d& operator=(const MemoryMappedNDTMap2d&) = delete;
+
+  /// Destructor, unmaps the file.
+  ~MemoryMappedNDTMap2d() { unmap(); }
+
+  /// Returns the number of cells in the map.
+  [[nodiscard]] size_type size() const noexcept { return cell_count_; }
+
+  /// Returns the grid resolution stored in the file, in meters per cell.
+  [[nodiscard]] double resolution() const noexcept { return resolution_; }
+
+  /// Returns an iterator to the first cell record.
+  [[nodiscard]] const_iterator begin() const noexcept { return const_iterator{records()}; }
+
+  /// Returns a past-the-end iterator over the cell records.
+  [[nodiscard]] const_iterator end() const noexcept { return const_iterator{records() + cell_count_}; }
+
+  /// Finds the entry mapped to a key.
+  /**
+   * \param key Key of the entry to look up.
+   * \return An iterator to the matching entry, or `end()` if the key is not present.
+   */
+  [[nodiscard]] const_iterator find(const key_type& key) const {
+    const record_type* const first = records();
+    const record_type* const last = first + cell_count_;
+    const record_type* const lower = std::lower_bound(first, last, key, detail::ndt_binary_map_record_less);
+    if (lower == last || lower->cell[0] != key.x() || lower->cell[1] != key.y()) {
+      return end();
+    }
+    return const_iterator{lower};
+  }
+
+  /// Returns the value mapped to a key.
+  /**
+   * \param key Key of the entry to look up.
+   * \throws std::out_of_range if the key is not present.
+   */
+  [[nodiscard]] mapped_type at(const key_type& key) const {
+    const auto it = find(key);
+    if (it == end()) {
+      throw std::out_of_range{"MemoryMappedNDTMap2d: key not found"};
+    }
+    return (*it).second;
+  }
+
+ private:
+  using header_type = detail::NDTBinaryMapHeader;
+  using record_type = detail::NDTBinaryMapRecord;
+
+  [[nodiscard]] const record_type* records() const noexcept {
+    return reinterpret_cast<const record_type*>(  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+        static_cast<const std::byte*>(mapped_data_) + sizeof(header_type));
+  }
+
+  void unmap() noexcept {
+    if (mapped_data_ != nullptr) {
+      ::munmap(mapped_data_, mapped_size_);
+      mapped_data_ = nullptr;
+    }
+  }
+
+  void* mapped_data_ = nullptr;
+  std::size_t mapped_size_ = 0;
+  std::size_t cell_count_ = 0;
+  double resolution_ = 1.0;
+};
+
+namespace io {
+
+/// Saves a 2D NDT map representation to a binary file loadable by `MemoryMappedNDTMap2d`.
+/**
+ * Cell records are written sorted by cell coordinates, as required by the
+ * memory-mapped lookup path.
+ *
+ * \tparam MapType Associative container mapping `Eigen::Vector2i` cells to `beluga::NDTCell2d`.
+ * \param grid NDT map to serialize.
+ * \param path Path to the binary NDT map file to create or overwrite.
+ * \throws std::invalid_argument If the file cannot be written.
+ */
+template <typename MapType>
+void save_to_binary_2d(const SparseValueGrid<MapType>& grid, const std::filesystem::path& path) {
+  static_assert(std::is_same_v<typename MapType::mapped_type, NDTCell2d>);
+
+  std::vector<detail::NDTBinaryMapRecord> records;
+  records.reserve(grid.size());
+  for (const auto& entry : grid.data()) {
+    detail::NDTBinaryMapRecord record;
+    record.cell[0] = entry.first.x();
+    record.cell[1] = entry.first.y();
+    Eigen::Map<Eigen::Vector2d>{record.mean} = entry.second.mean;
+    Eigen::Map<Eigen::Matrix2d>{record.covariance} = entry.second.covariance;
+    records.push_back(record);
+  }
+  std::sort(records.begin(), records.end(), [](const auto& lhs, const auto& rhs) {
+    return detail::ndt_binary_map_record_less(lhs, Eigen::Vector2i{rhs.cell[0], rhs.cell[1]});
+  });
+
+  detail::NDTBinaryMapHeader header{};
+  std::copy(
+      std::begin(detail::kNDTBinaryMapMagic), std::end(detail::kNDTBinaryMapMagic), std::begin(header.magic));
+  header.version = detail::kNDTBinaryMapVersion;
+  header.cell_count = records.size();
+  header.resolution = grid.resolution();
+
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  file.write(reinterpret_cast<const char*>(&header), sizeof(header));  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+  file.write(
+      reinterpret_cast<const char*>(records.data()),  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+      static_cast<std::streamsize>(records.size() * sizeof(detail::NDTBinaryMapRecord)));
+  if (!file) {
+    throw std::invalid_argument{"Couldn't write an NDT map file at " + path.string()};
+  }
+}
+
+/// Loads a 2D NDT map from a binary file by memory-mapping it.
+/**
+ * Unlike `load_from_hdf5_2d()`, this does not parse the map cell by cell: the
+ * mapped file is used directly as cell storage and pages are faulted in on
+ * demand as the filter queries cells.
+ *
+ * \param path Path to a binary NDT map file, as written by `save_to_binary_2d()`.
+ * \return A sparse value grid backed by the mapped file.
+ */
+inline SparseValueGrid<MemoryMappedNDTMap2d> load_from_binary_2d(const std::filesystem::path& path) {
+  MemoryMappedNDTMap2d map{path};
+  const double resolution = map.resolution();
+  return SparseValueGrid<MemoryMappedNDTMap2d>{std::move(map), resolution};
+}
+
+}  // namespace io
+
+}  // namespace beluga
+
+#endif
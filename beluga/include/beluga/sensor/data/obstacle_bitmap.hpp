@@ -0,0 +1,142 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_DATA_OBSTACLE_BITMAP_HPP
+#define BELUGA_SENSOR_DATA_OBSTACLE_BITMAP_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#include <range/v3/range/concepts.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a bit-packed 2D obstacle bitmap.
+ */
+
+namespace beluga {
+
+/// Bit-packed 2D obstacle bitmap, one bit per grid cell.
+/**
+ * Stores cell occupancy in row-major order at one bit per cell, shrinking the
+ * working set of occupancy scans eightfold relative to byte-per-cell boolean
+ * storage and allowing word-level iteration: consumers can skip 64 empty cells
+ * per load and visit set cells through bit scans instead of testing each cell.
+ */
+class ObstacleBitmap2 {
+ public:
+  /// Storage word type.
+  using word_type = std::uint64_t;
+
+  /// Number of cells packed per storage word.
+  static constexpr std::size_t kBitsPerWord = 64;
+
+  /// Constructs the bitmap from a range of cell occupancy values.
+  /**
+   * \param obstacle_map Range of `bool` values in row-major order, where true
+   *  marks an obstacle (e.g. the result of `g.obstacle_data()` on a grid
+   *  satisfying \ref OccupancyGrid2Page).
+   * \param width Bitmap width, in cells. Must evenly divide the map size.
+   */
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  explicit ObstacleBitmap2(Range&& obstacle_map, std::size_t width) : width_(width) {
+    for (bool is_obstacle : obstacle_map) {
+      const std::size_t word = size_ / kBitsPerWord;
+      if (word == words_.size()) {
+        words_.push_back(word_type{0});
+      }
+      if (is_obstacle) {
+        words_[word] |= word_type{1} << (size_ % kBitsPerWord);
+      }
+      ++size_;
+    }
+    assert(width_ > 0);
+    assert(size_ % width_ == 0);
+  }
+
+  /// Gets bitmap size (ie. number of grid cells).
+  [[nodiscard]] std::size_t size() const { return size_; }
+
+  /// Gets bitmap width.
+  [[nodiscard]] std::size_t width() const { return width_; }
+
+  /// Gets bitmap height.
+  [[nodiscard]] std::size_t height() const { return width_ > 0 ? size_ / width_ : 0; }
+
+  /// Gets the packed storage words, with cell `i` at bit `i % 64` of word `i / 64`.
+  /**
+   * Bits beyond `size()` in the last word are zero.
+   */
+  [[nodiscard]] const std::vector<word_type>& words() const { return words_; }
+
+  /// Checks whether the cell at the given index holds an obstacle.
+  [[nodiscard]] bool is_set(std::size_t index) const {
+    return (words_[index / kBitsPerWord] >> (index % kBitsPerWord)) & word_type{1};
+  }
+
+  /// Checks whether any cell holds an obstacle, testing 64 cells per load.
+  [[nodiscard]] bool any() const {
+    for (const word_type word : words_) {
+      if (word != 0) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Invokes a callback with the index of every obstacle cell, in increasing order.
+  /**
+   * Empty words are skipped whole and set bits are visited through bit scans,
+   * so the cost is proportional to the number of obstacles plus one load per
+   * 64 cells rather than one test per cell.
+   *
+   * \param callback Callable taking a `std::size_t` cell index.
+   */
+  template <class Callback>
+  void for_each_set(Callback&& callback) const {
+    for (std::size_t word_index = 0; word_index < words_.size(); ++word_index) {
+      word_type word = words_[word_index];
+      while (word != 0) {
+        const std::size_t bit = count_trailing_zeros(word);
+        callback(word_index * kBitsPerWord + bit);
+        word &= word - 1;  // clear the lowest set bit
+      }
+    }
+  }
+
+ private:
+  static std::size_t count_trailing_zeros(word_type word) {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<std::size_t>(__builtin_ctzll(word));
+#else
+    std::size_t count = 0;
+    while ((word & word_type{1}) == 0) {
+      word >>= 1;
+      ++count;
+    }
+    return count;
+#endif
+  }
+
+  std::vector<word_type> words_;
+  std::size_t size_ = 0;
+  std::size_t width_;
+};
+
+}  // namespace beluga
+
+#endif
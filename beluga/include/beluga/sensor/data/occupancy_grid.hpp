@@ -16,11 +16,14 @@
 #define BELUGA_SENSOR_DATA_OCCUPANCY_GRID_HPP
 
 #include <cstdint>
+#include <memory>
 #include <tuple>
 #include <vector>
 
 #include <beluga/sensor/data/linear_grid.hpp>
+#include <beluga/sensor/data/obstacle_bitmap.hpp>
 
+#include <range/v3/range/conversion.hpp>
 #include <range/v3/view/enumerate.hpp>
 #include <range/v3/view/filter.hpp>
 #include <range/v3/view/transform.hpp>
@@ -57,6 +60,11 @@ namespace beluga {
  *   `g.free_at(xi, yi)` returns true if such cell is free;
  * - given possibly const grid cell coordinates `pi` of `Eigen::Vector2i` type,
  *   `g.free_at(p)` returns true if such cell is free;
+ * - given a possibly const grid cell index `i` of `std::size_t` type, or
+ *   coordinates `xi` and `yi` of type `int` or `pi` of `Eigen::Vector2i` type,
+ *   known to be included in the grid, `g.free_at_unchecked(i)`,
+ *   `g.free_at_unchecked(xi, yi)` and `g.free_at_unchecked(pi)` return true
+ *   if such cell is free, without bounds checking;
  * - given possibly const embedding space coordinates `x` and `y` of type `double`,
  *   `g.free_near(x, y)` returns true if the nearest cell is free;
  * - given possibly const embedding space coordinates `p` of `Eigen::Vector2d` type,
@@ -69,6 +77,10 @@ namespace beluga {
  *   corresponding frame as `Eigen::Vector2d` values;
  * - `g.free_cells()` returns a range of `std::size_t` indices to free grid cells;
  * - `g.obstacle_data()` returns a range of `bool` values, representing grid cell occupancy;
+ * - `g.packed_obstacle_data()` returns grid cell occupancy as a bit-packed
+ *   `beluga::ObstacleBitmap2` value;
+ * - `g.cached_free_cells()` returns shared ownership of a memoized vector of
+ *   `std::size_t` indices to free grid cells;
  */
 
 /// Occupancy 2D grid base type.
@@ -135,6 +147,36 @@ class BaseOccupancyGrid2 : public BaseLinearGrid2<Derived> {
    */
   [[nodiscard]] bool free_near(const Eigen::Vector2d& p) const { return this->self().free_near(p.x(), p.y()); }
 
+  /// Checks if cell is free, without bounds checking.
+  /**
+   * For internal loops whose cells are provably included in the grid (e.g.
+   * ray traces clipped to the grid beforehand), where `free_at()` would
+   * re-validate once per O(cells) iteration. Passing a cell not included in
+   * the grid is undefined behavior.
+   *
+   * \param index Grid cell index. Must be included in the grid.
+   */
+  [[nodiscard]] bool free_at_unchecked(std::size_t index) const {
+    return this->self().value_traits().is_free(this->self().data_at_unchecked(index));
+  }
+
+  /// Checks if cell is free, without bounds checking.
+  /**
+   * \param xi Grid cell x-axis coordinate. The cell must be included in the grid.
+   * \param yi Grid cell y-axis coordinate. The cell must be included in the grid.
+   */
+  [[nodiscard]] bool free_at_unchecked(int xi, int yi) const {
+    return this->self().free_at_unchecked(this->self().index_at(xi, yi));
+  }
+
+  /// Checks if cell is free, without bounds checking.
+  /**
+   * \param pi Grid cell coordinates. The cell must be included in the grid.
+   */
+  [[nodiscard]] bool free_at_unchecked(const Eigen::Vector2i& pi) const {
+    return this->self().free_at_unchecked(pi.x(), pi.y());
+  }
+
   using BaseLinearGrid2<Derived>::coordinates_at;
 
   /// Compute plane coordinates given grid cell coordinates.
@@ -179,6 +221,41 @@ class BaseOccupancyGrid2 : public BaseLinearGrid2<Derived> {
              return value_traits.is_occupied(value);
            });
   }
+
+  /// Retrieves grid occupancy as a bit-packed obstacle bitmap.
+  /**
+   * One bit per cell instead of one value per cell; consumers that scan for
+   * obstacles (e.g. beluga::euclidean_distance_transform) can iterate it at
+   * word granularity. See beluga::ObstacleBitmap2.
+   */
+  [[nodiscard]] ObstacleBitmap2 packed_obstacle_data() const {
+    return ObstacleBitmap2{this->self().obstacle_data(), this->self().width()};
+  }
+
+  /// Retrieves the free grid cell indices, memoized after the first call.
+  /**
+   * Materializes `free_cells()` once and shares the result across copies of the
+   * grid, so repeat consumers (e.g. uniform state distributions built at every
+   * global relocalization) skip the full-grid scan. Call
+   * `invalidate_free_cells_cache()` after mutating grid data in place; grids
+   * replaced wholesale on map updates need no invalidation.
+   *
+   * \return Shared ownership of the free cell index vector; holders can outlive
+   *  the grid and later cache invalidations.
+   */
+  [[nodiscard]] std::shared_ptr<const std::vector<std::size_t>> cached_free_cells() const {
+    if (!free_cells_cache_) {
+      free_cells_cache_ = std::make_shared<const std::vector<std::size_t>>(  //
+          this->self().free_cells() | ranges::to<std::vector>);
+    }
+    return free_cells_cache_;
+  }
+
+  /// Drops the memoized free cell index.
+  void invalidate_free_cells_cache() { free_cells_cache_.reset(); }
+
+ private:
+  mutable std::shared_ptr<const std::vector<std::size_t>> free_cells_cache_;
 };
 
 }  // namespace beluga
@@ -0,0 +1,183 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_DATA_OCCUPANCY_PYRAMID_HPP
+#define BELUGA_SENSOR_DATA_OCCUPANCY_PYRAMID_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a multi-resolution occupancy pyramid for ray marching.
+ */
+
+namespace beluga {
+
+/// Multi-resolution occupancy pyramid over an occupancy grid.
+/**
+ * Each level halves the resolution of the previous one, and a macro-cell is
+ * marked non-free if any of the cells it covers is non-free. The `cast()`
+ * method runs a hierarchical DDA march that skips entire empty macro-cells at
+ * the coarsest level possible, falling back to fine resolution only near
+ * potential obstacles, so long rays across open space touch a small fraction
+ * of the cells a cell-by-cell traversal visits.
+ *
+ * The pyramid borrows a reference to the grid it was built over (and thus
+ * their lifetime are bound), like `Ray2d` does.
+ *
+ * \tparam OccupancyGrid Type representing an occupancy grid.
+ *  It must satisfy \ref OccupancyGrid2Page.
+ */
+template <class OccupancyGrid>
+class OccupancyPyramid {
+ public:
+  /// Constructs a pyramid over the given grid.
+  /**
+   * \param grid Grid on which to perform ray marching.
+   */
+  explicit OccupancyPyramid(const OccupancyGrid& grid) : grid_{grid} {
+    const std::size_t width = grid.width();
+    const std::size_t height = grid.height();
+
+    auto base = Level{};
+    base.width = width;
+    base.height = height;
+    base.occupancy.resize(width * height);
+    for (std::size_t index = 0; index < width * height; ++index) {
+      base.occupancy[index] = !grid.free_at(index);
+    }
+    levels_.push_back(std::move(base));
+
+    while (levels_.back().width > 1 || levels_.back().height > 1) {
+      const auto& previous = levels_.back();
+      auto next = Level{};
+      next.width = (previous.width + 1) / 2;
+      next.height = (previous.height + 1) / 2;
+      next.occupancy.resize(next.width * next.height);
+      for (std::size_t yi = 0; yi < previous.height; ++yi) {
+        for (std::size_t xi = 0; xi < previous.width; ++xi) {
+          if (previous.occupancy[yi * previous.width + xi]) {
+            next.occupancy[(yi / 2) * next.width + (xi / 2)] = true;
+          }
+        }
+      }
+      levels_.push_back(std::move(next));
+    }
+  }
+
+  /// Casts a ray along a given direction, skipping empty macro-cells.
+  /**
+   * Mirrors the semantics of `Ray2d::cast()`: distances are measured from cell
+   * centroid to cell centroid, and rays that leave the grid or exceed the
+   * maximum range are reported as misses.
+   *
+   * \param source_pose Pose of the source of the ray in the same frame as that
+   *   on which the grid origin is defined.
+   * \param bearing Direction for ray casting, relative to the source pose.
+   * \param max_range Maximum range for the ray, in meters.
+   * \return Distance in meters to the first non free cell hit by the ray, if any.
+   */
+  [[nodiscard]] std::optional<double> cast(
+      const Sophus::SE2d& source_pose,
+      const Sophus::SO2d& bearing,
+      double max_range) const {
+    const auto pose_in_local_frame = grid_.origin().inverse() * source_pose;
+    const Eigen::Vector2d direction = (pose_in_local_frame.so2() * bearing).unit_complex();
+    const double resolution = grid_.resolution();
+    // March in fine-cell units so macro-cell boundaries are at integer multiples.
+    const Eigen::Vector2d start = pose_in_local_frame.translation() / resolution;
+    const auto source_cell = grid_.cell_near(pose_in_local_frame.translation());
+    const double t_limit = max_range / resolution;
+    // Nudge past macro-cell boundaries to avoid re-visiting them; one millionth
+    // of a cell is far below any resolution of interest.
+    constexpr double kEpsilon = 1e-6;
+
+    double t = 0.;
+    while (t <= t_limit) {
+      const Eigen::Vector2d position = start + t * direction;
+      const auto xi = static_cast<int>(std::floor(position.x()));
+      const auto yi = static_cast<int>(std::floor(position.y()));
+      if (!grid_.contains(xi, yi)) {
+        return std::nullopt;
+      }
+      if (levels_.front().occupancy[static_cast<std::size_t>(yi) * levels_.front().width + static_cast<std::size_t>(xi)]) {
+        const auto source_position = grid_.coordinates_at(source_cell.x(), source_cell.y());
+        const auto cell_position = grid_.coordinates_at(xi, yi);
+        const auto distance = (cell_position - source_position).norm();
+        if (distance > max_range) {
+          return std::make_optional(max_range);
+        }
+        return std::make_optional(distance);
+      }
+
+      // Climb to the coarsest level whose macro-cell around this position is
+      // still entirely free, then jump to the exit of that macro-cell.
+      std::size_t level = 0;
+      while (level + 1 < levels_.size() && !occupied(level + 1, xi, yi)) {
+        ++level;
+      }
+      const double span = static_cast<double>(std::size_t{1} << level);
+      double t_exit = std::numeric_limits<double>::infinity();
+      if (direction.x() > 0.) {
+        const double boundary = (std::floor(static_cast<double>(xi) / span) + 1.) * span;
+        t_exit = std::min(t_exit, (boundary - position.x()) / direction.x());
+      } else if (direction.x() < 0.) {
+        const double boundary = std::floor(static_cast<double>(xi) / span) * span;
+        t_exit = std::min(t_exit, (boundary - position.x()) / direction.x());
+      }
+      if (direction.y() > 0.) {
+        const double boundary = (std::floor(static_cast<double>(yi) / span) + 1.) * span;
+        t_exit = std::min(t_exit, (boundary - position.y()) / direction.y());
+      } else if (direction.y() < 0.) {
+        const double boundary = std::floor(static_cast<double>(yi) / span) * span;
+        t_exit = std::min(t_exit, (boundary - position.y()) / direction.y());
+      }
+      t += std::max(t_exit, 0.) + kEpsilon;
+    }
+    return std::nullopt;
+  }
+
+  /// Returns the number of levels in the pyramid, including the base grid.
+  [[nodiscard]] std::size_t levels() const { return levels_.size(); }
+
+ private:
+  /// One resolution level of the pyramid.
+  struct Level {
+    std::size_t width = 0;
+    std::size_t height = 0;
+    std::vector<bool> occupancy;
+  };
+
+  [[nodiscard]] bool occupied(std::size_t level, int xi, int yi) const {
+    const auto& data = levels_[level];
+    const auto cx = static_cast<std::size_t>(xi) >> level;
+    const auto cy = static_cast<std::size_t>(yi) >> level;
+    return data.occupancy[cy * data.width + cx];
+  }
+
+  const OccupancyGrid& grid_;
+  std::vector<Level> levels_;
+};
+
+}  // namespace beluga
+
+#endif
@@ -16,6 +16,8 @@
 #define BELUGA_SENSOR_DATA_REGULAR_GRID_HPP
 
 #include <cmath>
+#include <ratio>
+#include <type_traits>
 
 #include <ciabatta/ciabatta.hpp>
 
@@ -40,6 +42,10 @@ namespace beluga {
  * A type `G` satisfies `RegularGrid2` requirements if given `g` a possibly
  * const instance of `G`:
  * - `g.resolution()` returns the side length of all grid cells as a `double`;
+ * - optionally, `g.inverse_resolution()` returns the reciprocal of the cell
+ *   side length as a `double`; when provided (precomputed at construction or
+ *   as a compile-time constant), world-to-cell conversions use it instead of
+ *   dividing by the resolution on every query;
  * - given possibly const embedding space coordinates `x` and `y` of type `double`,
  *   `g.cell_at(x, y)` returns grid cell coordinates as an `Eigen::Vector2d` value;
  * - given possibly const embedding space coordinates `p` of `Eigen::Vector2d` type,
@@ -55,6 +61,46 @@ namespace beluga {
  *   `Eigen::Vector2d` values.
  */
 
+namespace detail {
+
+/// Detects grids exposing a precomputed resolution reciprocal.
+template <class Grid, class = void>
+struct has_inverse_resolution : std::false_type {};
+
+/// Specialization for grids providing the `inverse_resolution` accessor.
+template <class Grid>
+struct has_inverse_resolution<Grid, std::void_t<decltype(std::declval<const Grid&>().inverse_resolution())>>
+    : std::true_type {};
+
+/// Convenience template variable for `has_inverse_resolution`.
+template <class Grid>
+inline constexpr bool has_inverse_resolution_v = has_inverse_resolution<Grid>::value;
+
+}  // namespace detail
+
+/// Compile-time grid resolution policy.
+/**
+ * Grids whose resolution is fixed at build time can inherit this policy
+ * instead of storing a runtime resolution. Both the resolution and its
+ * reciprocal are then compile-time constants, so `cell_near` lowers to a
+ * multiply by a constant plus floor, with no division and no memory load.
+ *
+ * \tparam Ratio `std::ratio` expressing the cell side length in meters
+ *  (e.g. `std::centi` for 1 cm cells, `std::ratio<1, 20>` for 5 cm cells).
+ */
+template <class Ratio>
+struct StaticResolution {
+  /// Gets grid resolution.
+  [[nodiscard]] static constexpr double resolution() {
+    return static_cast<double>(Ratio::num) / static_cast<double>(Ratio::den);
+  }
+
+  /// Gets grid resolution reciprocal.
+  [[nodiscard]] static constexpr double inverse_resolution() {
+    return static_cast<double>(Ratio::den) / static_cast<double>(Ratio::num);
+  }
+};
+
 /// Regularly spaced 2D grid base type.
 /**
  * When instantiated, it satisfies \ref RegularGrid2Page.
@@ -74,7 +120,13 @@ class BaseRegularGrid2 : public ciabatta::ciabatta_top<Derived> {
    * \return Grid cell coordinates.
    */
   [[nodiscard]] Eigen::Vector2i cell_near(double x, double y) const {
-    const auto inv_resolution = 1. / this->self().resolution();
+    const auto inv_resolution = [this] {
+      if constexpr (detail::has_inverse_resolution_v<Derived>) {
+        return this->self().inverse_resolution();
+      } else {
+        return 1. / this->self().resolution();
+      }
+    }();
     const auto scaled_x = x * inv_resolution;
     const auto scaled_y = y * inv_resolution;
     // Use a poor man's replacement of `std::floor` because
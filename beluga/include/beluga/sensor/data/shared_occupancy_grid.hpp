@@ -0,0 +1,102 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_DATA_SHARED_OCCUPANCY_GRID_HPP
+#define BELUGA_SENSOR_DATA_SHARED_OCCUPANCY_GRID_HPP
+
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <beluga/sensor/data/occupancy_grid.hpp>
+
+#include <sophus/se2.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a ref-counted immutable occupancy grid handle.
+ */
+
+namespace beluga {
+
+/// Ref-counted immutable handle to an occupancy grid.
+/**
+ * Satisfies \ref OccupancyGrid2Page by forwarding to a shared, immutable
+ * underlying grid. Copying the handle bumps a reference count instead of
+ * copying grid data, so sensor models that store their map by value can
+ * swap maps with a pointer exchange; the previous map is released when the
+ * last handle referencing it is destroyed.
+ *
+ * \tparam Grid Underlying occupancy grid type. It must satisfy
+ *  \ref OccupancyGrid2Page.
+ */
+template <class Grid>
+class SharedOccupancyGrid : public BaseOccupancyGrid2<SharedOccupancyGrid<Grid>> {
+ public:
+  /// Underlying occupancy grid type.
+  using grid_type = Grid;
+
+  /// Constructs a handle taking shared ownership of an existing grid.
+  /**
+   * \param grid Shared pointer to the underlying grid. It must not be null.
+   */
+  explicit SharedOccupancyGrid(std::shared_ptr<const Grid> grid) : grid_{std::move(grid)} {}
+
+  /// Constructs a handle owning a grid moved into shared storage.
+  /**
+   * \param grid Underlying grid instance.
+   */
+  explicit SharedOccupancyGrid(Grid grid) : grid_{std::make_shared<const Grid>(std::move(grid))} {}
+
+  /// Get the underlying occupancy grid.
+  [[nodiscard]] const Grid& underlying_grid() const { return *grid_; }
+
+  /// Get the occupancy grid origin in the occupancy grid frame.
+  [[nodiscard]] const Sophus::SE2d& origin() const { return grid_->origin(); }
+
+  /// Get a reference to the underlying data storage (ie. a row-major array).
+  [[nodiscard]] const auto& data() const { return grid_->data(); }
+
+  /// Get the size of the occupancy grid (`width()` times `height()`).
+  [[nodiscard]] std::size_t size() const { return grid_->size(); }
+
+  /// Get the width of the occupancy grid.
+  [[nodiscard]] std::size_t width() const { return grid_->width(); }
+
+  /// Get the height of the occupancy grid.
+  [[nodiscard]] std::size_t height() const { return grid_->height(); }
+
+  /// Get the resolution of the occupancy grid discretization, in meters.
+  [[nodiscard]] double resolution() const { return grid_->resolution(); }
+
+  /// Get the traits for occupancy grid value interpretation.
+  [[nodiscard]] auto value_traits() const { return grid_->value_traits(); }
+
+  /// Retrieves the free grid cell indices, memoized on the underlying grid.
+  /**
+   * Forwarded so all handles to the same grid share one memoized index
+   * (see `BaseOccupancyGrid2::cached_free_cells()`).
+   */
+  [[nodiscard]] std::shared_ptr<const std::vector<std::size_t>> cached_free_cells() const {
+    return grid_->cached_free_cells();
+  }
+
+ private:
+  std::shared_ptr<const Grid> grid_;
+};
+
+}  // namespace beluga
+
+#endif
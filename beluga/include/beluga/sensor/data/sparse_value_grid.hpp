@@ -16,8 +16,11 @@
 #define BELUGA_SENSOR_DATA_SPARSE_VALUE_GRID_HPP
 
 #include <Eigen/Core>
+#include <cstddef>
 #include <optional>
 #include <type_traits>
+#include <utility>
+#include <vector>
 
 #include <beluga/sensor/data/regular_grid.hpp>
 /**
@@ -27,6 +30,20 @@
 
 namespace beluga {
 
+namespace detail {
+
+/// \cond detail
+
+template <class Map, class = void>
+struct map_has_reserve : std::false_type {};
+
+template <class Map>
+struct map_has_reserve<Map, std::void_t<decltype(std::declval<Map&>().reserve(std::size_t{}))>> : std::true_type {};
+
+/// \endcond
+
+}  // namespace detail
+
 /// Generic 2D sparse value regular grid.
 /**
  * \tparam MapType:
@@ -39,6 +56,8 @@ namespace beluga {
  * representing the value at that index, or throw 'std::out_of_range' if it doesn't exist.
  *        - 'm.find(const Eigen::Vector2i&)' should follow the same API as
  * [std::map](https://en.cppreference.com/w/cpp/container/map/find).
+ *        - the bulk construction path additionally uses 'm[key]' for insertion
+ * and 'm.reserve(n)' when the container provides it.
  */
 template <typename MapType>
 class SparseValueGrid : public BaseRegularGrid2<SparseValueGrid<MapType>> {
@@ -61,6 +80,30 @@ class SparseValueGrid : public BaseRegularGrid2<SparseValueGrid<MapType>> {
     assert(resolution_ > 0);
   }
 
+  /// Entry type taken by the bulk construction path.
+  using entry_type = std::pair<key_type, mapped_type>;
+
+  /// Bulk-constructs a grid from pre-computed (cell index, value) entries.
+  /**
+   * The map backend is sized once for the full entry count (when it supports
+   * reservation) and entries are move-inserted in order, so large maps build
+   * without the intermediate rehashes that repeated `emplace` calls incur.
+   * Duplicate cell indices keep the last value, matching repeated insertion.
+   *
+   * \param entries Pairs of grid cell index and cell value.
+   * \param resolution Grid resolution.
+   */
+  [[nodiscard]] static SparseValueGrid from_entries(std::vector<entry_type> entries, double resolution = 1.) {
+    map_type data;
+    if constexpr (detail::map_has_reserve<map_type>::value) {
+      data.reserve(entries.size());
+    }
+    for (auto& entry : entries) {
+      data[entry.first] = std::move(entry.second);
+    }
+    return SparseValueGrid{std::move(data), resolution};
+  }
+
   /// Gets grid resolution.
   [[nodiscard]] double resolution() const { return resolution_; }
 
@@ -0,0 +1,196 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_DATA_STORAGE_LAYOUT_HPP
+#define BELUGA_SENSOR_DATA_STORAGE_LAYOUT_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include <beluga/utility/aligned_allocator.hpp>
+
+#include <Eigen/Core>
+
+/**
+ * \file
+ * \brief Storage layout policies for dense 2D grids.
+ *
+ * A storage layout maps grid cell coordinates to storage indices and back.
+ * Grids templated on a layout (see beluga::ValueGrid2) can thus trade the
+ * canonical row-major order for layouts with better 2D locality.
+ */
+
+namespace beluga {
+
+/// Canonical row-major storage layout.
+/**
+ * Cell `(xi, yi)` is stored at index `yi * width + xi`. Rows are contiguous,
+ * so horizontal traversals are sequential and vertical ones are strided.
+ */
+struct RowMajorStorageLayout {
+  /// Allocator used for grid storage under this layout.
+  template <class T>
+  using allocator = std::allocator<T>;
+
+  /// Computes the storage index for the given grid cell coordinates.
+  [[nodiscard]] static std::size_t index(int xi, int yi, std::size_t width) {
+    return static_cast<std::size_t>(yi) * width + static_cast<std::size_t>(xi);
+  }
+
+  /// Computes the grid cell coordinates stored at the given index.
+  [[nodiscard]] static Eigen::Vector2i cell(std::size_t index, std::size_t width) {
+    return Eigen::Vector2i{static_cast<int>(index % width), static_cast<int>(index / width)};
+  }
+
+  /// Computes the storage size needed to hold a grid of the given dimensions.
+  [[nodiscard]] static std::size_t storage_size(std::size_t width, std::size_t height) { return width * height; }
+};
+
+/// Morton-order (Z-curve) storage layout.
+/**
+ * Cell `(xi, yi)` is stored at the index formed by interleaving the bits of
+ * both coordinates, so cells close in 2D stay close in memory regardless of
+ * direction: any aligned 8x8 block of cells spans one 64-entry storage run.
+ * Diagonal traversals (ray casting) and scattered 2D-local lookups (likelihood
+ * field beam endpoints) touch far fewer cache lines than under row-major
+ * order, at the cost of padding the storage to a power-of-two square.
+ */
+struct MortonStorageLayout {
+  /// Allocator used for grid storage under this layout.
+  template <class T>
+  using allocator = AlignedAllocator<T>;
+
+  /// Computes the storage index for the given grid cell coordinates.
+  [[nodiscard]] static std::size_t index(int xi, int yi, std::size_t /*width*/) {
+    return interleave(static_cast<std::uint32_t>(xi)) | (interleave(static_cast<std::uint32_t>(yi)) << 1);
+  }
+
+  /// Computes the grid cell coordinates stored at the given index.
+  [[nodiscard]] static Eigen::Vector2i cell(std::size_t index, std::size_t /*width*/) {
+    return Eigen::Vector2i{
+        static_cast<int>(deinterleave(static_cast<std::uint64_t>(index))),
+        static_cast<int>(deinterleave(static_cast<std::uint64_t>(index) >> 1))};
+  }
+
+  /// Computes the storage size needed to hold a grid of the given dimensions.
+  /**
+   * The Z-curve covers a power-of-two square, so storage is padded to the
+   * smallest such square enclosing the grid.
+   */
+  [[nodiscard]] static std::size_t storage_size(std::size_t width, std::size_t height) {
+    std::size_t side = 1;
+    while (side < std::max(width, height)) {
+      side <<= 1;
+    }
+    return side * side;
+  }
+
+ private:
+  /// Spreads the bits of a 32-bit value over the even bits of a 64-bit value.
+  [[nodiscard]] static std::uint64_t interleave(std::uint32_t value) {
+    std::uint64_t x = value;
+    x = (x | (x << 16)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x << 8)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x << 2)) & 0x3333333333333333ULL;
+    x = (x | (x << 1)) & 0x5555555555555555ULL;
+    return x;
+  }
+
+  /// Compacts the even bits of a 64-bit value into a 32-bit value.
+  [[nodiscard]] static std::uint32_t deinterleave(std::uint64_t value) {
+    std::uint64_t x = value & 0x5555555555555555ULL;
+    x = (x | (x >> 1)) & 0x3333333333333333ULL;
+    x = (x | (x >> 2)) & 0x0F0F0F0F0F0F0F0FULL;
+    x = (x | (x >> 4)) & 0x00FF00FF00FF00FFULL;
+    x = (x | (x >> 8)) & 0x0000FFFF0000FFFFULL;
+    x = (x | (x >> 16)) & 0x00000000FFFFFFFFULL;
+    return static_cast<std::uint32_t>(x);
+  }
+};
+
+/// Tiled storage layout with cache-line-aligned 8x8 cell tiles.
+/**
+ * The grid is split into 8x8 cell tiles stored contiguously in row-major tile
+ * order, with row-major cells within each tile and 64-byte aligned storage.
+ * A lighter-weight alternative to beluga::MortonStorageLayout: lookups
+ * clustering within an 8-cell radius (the beam endpoints of one particle in a
+ * likelihood field) resolve to one or a few whole-cache-line tiles instead of
+ * striding across distant rows, while index computation stays a couple of
+ * shifts and masks.
+ */
+struct TiledStorageLayout {
+  /// Cells per tile side.
+  static constexpr std::size_t kTileSide = 8;
+
+  /// Allocator used for grid storage under this layout.
+  template <class T>
+  using allocator = AlignedAllocator<T>;
+
+  /// Computes the storage index for the given grid cell coordinates.
+  [[nodiscard]] static std::size_t index(int xi, int yi, std::size_t width) {
+    const auto x = static_cast<std::size_t>(xi);
+    const auto y = static_cast<std::size_t>(yi);
+    const std::size_t tile = (y / kTileSide) * tiles_per_row(width) + (x / kTileSide);
+    return tile * kTileSide * kTileSide + (y % kTileSide) * kTileSide + (x % kTileSide);
+  }
+
+  /// Computes the grid cell coordinates stored at the given index.
+  [[nodiscard]] static Eigen::Vector2i cell(std::size_t index, std::size_t width) {
+    const std::size_t tile = index / (kTileSide * kTileSide);
+    const std::size_t offset = index % (kTileSide * kTileSide);
+    const std::size_t xi = (tile % tiles_per_row(width)) * kTileSide + offset % kTileSide;
+    const std::size_t yi = (tile / tiles_per_row(width)) * kTileSide + offset / kTileSide;
+    return Eigen::Vector2i{static_cast<int>(xi), static_cast<int>(yi)};
+  }
+
+  /// Computes the storage size needed to hold a grid of the given dimensions.
+  /**
+   * Storage is padded to whole tiles along both axes.
+   */
+  [[nodiscard]] static std::size_t storage_size(std::size_t width, std::size_t height) {
+    return tiles_per_row(width) * ((height + kTileSide - 1) / kTileSide) * kTileSide * kTileSide;
+  }
+
+ private:
+  /// Computes the number of tiles covering one row of the grid.
+  [[nodiscard]] static std::size_t tiles_per_row(std::size_t width) { return (width + kTileSide - 1) / kTileSide; }
+};
+
+/// Storage layout adaptor that overrides the allocator of an existing layout.
+/**
+ * Keeps the cell-to-index mapping of the base layout while switching the grid
+ * storage to the given allocator, e.g. `beluga::HugePageAllocator` to back a
+ * multi-megabyte likelihood field with huge pages:
+ *
+ * \code
+ * using Layout = beluga::StorageLayoutWithAllocator<beluga::TiledStorageLayout, beluga::HugePageAllocator<std::byte>>;
+ * auto grid = beluga::ValueGrid2<double, Layout>{...};
+ * \endcode
+ *
+ * \tparam Layout The base storage layout.
+ * \tparam Allocator The allocator to use instead, rebound to the grid value type.
+ */
+template <class Layout, class Allocator>
+struct StorageLayoutWithAllocator : public Layout {
+  /// Allocator used for grid storage under this layout.
+  template <class T>
+  using allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+};
+
+}  // namespace beluga
+
+#endif
@@ -15,11 +15,15 @@
 #ifndef BELUGA_SENSOR_DATA_VALUE_GRID_HPP
 #define BELUGA_SENSOR_DATA_VALUE_GRID_HPP
 
+#include <algorithm>
 #include <cstdint>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
+#include <beluga/containers/circular_array.hpp>
 #include <beluga/sensor/data/linear_grid.hpp>
+#include <beluga/sensor/data/storage_layout.hpp>
 
 /**
  * \file
@@ -28,22 +32,53 @@
 
 namespace beluga {
 
+namespace detail {
+
+/// Hints the CPU to fetch the given address into cache, when supported.
+inline void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+  __builtin_prefetch(address);
+#else
+  (void)address;
+#endif
+}
+
+}  // namespace detail
+
 /// Generic 2D linear value grid.
 /**
  * \tparam T Any copyable type.
+ * \tparam Layout Storage layout policy mapping cell coordinates to storage
+ *  indices (see storage_layout.hpp). Defaults to row-major order;
+ *  beluga::MortonStorageLayout keeps 2D-local accesses within cache lines
+ *  regardless of traversal direction.
  */
-template <typename T>
-class ValueGrid2 : public BaseLinearGrid2<ValueGrid2<T>> {
+template <typename T, class Layout = RowMajorStorageLayout>
+class ValueGrid2 : public BaseLinearGrid2<ValueGrid2<T, Layout>> {
  public:
+  /// Storage type used to hold grid data, allocated as the layout requires.
+  using storage_type = std::vector<T, typename Layout::template allocator<T>>;
+
   /// Constructs the grid.
   /**
-   * \param data Grid data.
+   * \param data Grid data, in row-major order. Non-row-major layouts reorder
+   *  it into their storage order on construction.
    * \param width Grid width. Must evenly divide `data` size.
    * \param resolution Grid resolution.
    */
   explicit ValueGrid2(std::vector<T> data, std::size_t width, double resolution = 1.)
-      : data_(std::move(data)), width_(width), height_(data_.size() / width), resolution_(resolution) {
-    assert(data_.size() % width == 0);
+      : width_(width), height_(data.size() / width), resolution_(resolution), inverse_resolution_(1. / resolution) {
+    assert(data.size() % width == 0);
+    if constexpr (std::is_same_v<Layout, RowMajorStorageLayout>) {
+      data_ = std::move(data);
+    } else {
+      data_.assign(Layout::storage_size(width_, height_), T{});
+      for (std::size_t yi = 0; yi < height_; ++yi) {
+        for (std::size_t xi = 0; xi < width_; ++xi) {
+          data_[Layout::index(static_cast<int>(xi), static_cast<int>(yi), width_)] = data[yi * width_ + xi];
+        }
+      }
+    }
   }
 
   /// Gets grid width.
@@ -55,17 +90,175 @@ class ValueGrid2 : public BaseLinearGrid2<ValueGrid2<T>> {
   /// Gets grid resolution.
   [[nodiscard]] double resolution() const { return resolution_; }
 
+  /// Gets grid resolution reciprocal, frozen at construction.
+  /**
+   * World-to-cell conversions in `BaseRegularGrid2` pick this up and avoid
+   * a division per query.
+   */
+  [[nodiscard]] double inverse_resolution() const { return inverse_resolution_; }
+
   /// Gets grid size (ie. number of grid cells).
-  [[nodiscard]] std::size_t size() const { return data_.size(); }
+  [[nodiscard]] std::size_t size() const { return width_ * height_; }
+
+  /// Gets grid data, in the storage order of the layout.
+  [[nodiscard]] const storage_type& data() const { return data_; }
+
+  /// Gets mutable grid data, in the storage order of the layout.
+  [[nodiscard]] storage_type& data() { return data_; }
+
+  using BaseLinearGrid2<ValueGrid2<T, Layout>>::index_at;
+
+  /// Computes the storage index for given grid cell coordinates.
+  /**
+   * \param xi Grid cell x-axis coordinate.
+   * \param yi Grid cell y-axis coordinate.
+   */
+  [[nodiscard]] std::size_t index_at(int xi, int yi) const { return Layout::index(xi, yi, width_); }
 
-  /// Gets grid data.
-  [[nodiscard]] const std::vector<T>& data() const { return data_; }
+  using BaseLinearGrid2<ValueGrid2<T, Layout>>::coordinates_at;
+
+  /// Compute plane coordinates given a storage index.
+  /**
+   * \param index Grid cell storage index.
+   * \return Plane coordinates of the cell centroid.
+   */
+  [[nodiscard]] Eigen::Vector2d coordinates_at(std::size_t index) const {
+    return this->coordinates_at(Layout::cell(index, width_));
+  }
+
+  using BaseLinearGrid2<ValueGrid2<T, Layout>>::data_at;
+
+  /// Gets cell data, if included.
+  /**
+   * \param index Grid cell storage index.
+   * \return Cell data if included, `std::nullopt` otherwise.
+   */
+  [[nodiscard]] auto data_at(std::size_t index) const {
+    return index < data_.size() ? std::make_optional(data_[index]) : std::nullopt;
+  }
+
+  using BaseLinearGrid2<ValueGrid2<T, Layout>>::neighborhood4;
+
+  /// Computes 4-connected neighborhood for cell.
+  /**
+   * \param index Grid cell storage index.
+   * \return range of neighbor cells' storage indices.
+   */
+  [[nodiscard]] auto neighborhood4(std::size_t index) const {
+    auto result = CircularArray<std::size_t, 4>{};
+    const auto cell = Layout::cell(index, width_);
+    for (const auto& neighbor : this->neighborhood4(cell.x(), cell.y())) {
+      result.push_back(this->index_at(neighbor));
+    }
+    return result;
+  }
 
  private:
-  std::vector<T> data_;
+  storage_type data_;
   std::size_t width_;
   std::size_t height_;
   double resolution_;
+  double inverse_resolution_;
+};
+
+/// Branchless lookup companion to a 2D linear value grid.
+/**
+ * Stores a copy of the source grid surrounded by a one-cell border holding a fixed
+ * value, and clamps cell coordinates into the padded extent on lookup. Any plane
+ * coordinates, no matter how far outside the map, thus land on a valid cell: in-map
+ * queries read the original data and out-of-map queries read the border value, with
+ * no bounds branch and no optional construction on the lookup path.
+ *
+ * \tparam T Any copyable type.
+ */
+template <typename T>
+class PaddedValueGrid2 {
+ public:
+  /// Constructs the padded grid from a source grid.
+  /**
+   * \param grid Source value grid to copy.
+   * \param border_value Value held by the border cells, returned for out-of-map lookups.
+   */
+  explicit PaddedValueGrid2(const ValueGrid2<T>& grid, T border_value)
+      : data_((grid.width() + 2) * (grid.height() + 2), border_value),
+        inner_width_(static_cast<int>(grid.width())),
+        inner_height_(static_cast<int>(grid.height())),
+        resolution_(grid.resolution()),
+        inverse_resolution_(grid.inverse_resolution()) {
+    const auto width = grid.width();
+    for (std::size_t yi = 0; yi < grid.height(); ++yi) {
+      const auto row = grid.data().begin() + static_cast<std::ptrdiff_t>(yi * width);
+      std::copy(row, row + static_cast<std::ptrdiff_t>(width), data_.begin() + row_offset(yi + 1) + 1);
+    }
+  }
+
+  /// Gets grid resolution.
+  [[nodiscard]] double resolution() const { return resolution_; }
+
+  /// Gets the value of the cell nearest to the given plane coordinates.
+  /**
+   * Unlike `data_near` on bounded grids, this always returns a value: the border
+   * value when the coordinates fall outside the source grid. The lookup compiles
+   * down to two clamps and one load.
+   *
+   * \param x Plane x-axis coordinate.
+   * \param y Plane y-axis coordinate.
+   */
+  [[nodiscard]] T data_near(double x, double y) const { return data_[index_near(x, y)]; }
+
+  /// Gathers the values of the cells nearest to a batch of plane coordinates.
+  /**
+   * Equivalent to one `data_near()` call per coordinate pair, but all storage
+   * indices are resolved up front and each cache line is prefetched a fixed
+   * distance ahead of its load. Scattered lookups with unpredictable addresses
+   * (e.g. the per-beam likelihood reads in beluga::LikelihoodFieldModel) thus
+   * overlap their cache misses instead of serializing them.
+   *
+   * \param xs Plane x-axis coordinates, one per lookup.
+   * \param ys Plane y-axis coordinates, one per lookup.
+   * \param count Number of lookups.
+   * \param out Caller-provided buffer where `count` values are written.
+   */
+  void gather_near(const double* xs, const double* ys, std::size_t count, T* out) const {
+    constexpr std::size_t kPrefetchDistance = 16;
+    std::size_t pending[kPrefetchDistance];
+    const std::size_t lookahead = std::min(kPrefetchDistance, count);
+    for (std::size_t index = 0; index < lookahead; ++index) {
+      const auto storage_index = index_near(xs[index], ys[index]);
+      detail::prefetch(&data_[storage_index]);
+      pending[index] = storage_index;
+    }
+    for (std::size_t index = 0; index < count; ++index) {
+      // Load before refilling the ring slot: lookup `index + kPrefetchDistance` reuses it.
+      out[index] = data_[pending[index % kPrefetchDistance]];
+      const std::size_t ahead = index + kPrefetchDistance;
+      if (ahead < count) {
+        const auto storage_index = index_near(xs[ahead], ys[ahead]);
+        detail::prefetch(&data_[storage_index]);
+        pending[ahead % kPrefetchDistance] = storage_index;
+      }
+    }
+  }
+
+ private:
+  [[nodiscard]] std::size_t index_near(double x, double y) const {
+    const auto scaled_x = x * inverse_resolution_;
+    const auto scaled_y = y * inverse_resolution_;
+    // Same `std::floor` replacement as `BaseRegularGrid2::cell_near`.
+    const auto xi = std::clamp(static_cast<int>(scaled_x) - (scaled_x < 0.0), -1, inner_width_);
+    const auto yi = std::clamp(static_cast<int>(scaled_y) - (scaled_y < 0.0), -1, inner_height_);
+    return static_cast<std::size_t>(row_offset(static_cast<std::size_t>(yi + 1))) + static_cast<std::size_t>(xi + 1);
+  }
+
+  [[nodiscard]] std::ptrdiff_t row_offset(std::size_t padded_row) const {
+    return static_cast<std::ptrdiff_t>(padded_row * static_cast<std::size_t>(inner_width_ + 2));
+  }
+
+  std::vector<T> data_;
+  int inner_width_;
+  int inner_height_;
+  double resolution_;
+  double inverse_resolution_;
 };
 
 }  // namespace beluga
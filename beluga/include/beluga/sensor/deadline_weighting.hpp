@@ -0,0 +1,106 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_DEADLINE_WEIGHTING_HPP
+#define BELUGA_SENSOR_DEADLINE_WEIGHTING_HPP
+
+#include <chrono>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file
+ * \brief Implementation of a deadline-aware state weighting function adaptor.
+ */
+
+namespace beluga {
+
+/// State weighting function that degrades to partial-beam evaluation past a time budget.
+/**
+ * This class satisfies \ref StateWeightingFunctionPage.
+ *
+ * The deadline is fixed when the instance is constructed, which in the usual pipeline
+ * happens once per sensor update (the sensor model builds a fresh weighting function for
+ * each measurement). Particles weighted before the deadline get a full evaluation;
+ * particles weighted after it get a degraded evaluation using only a fraction of the
+ * beams, provided the wrapped function supports the partial form
+ * `fn(state, beam_fraction)` (e.g. `beluga::LikelihoodFieldModel`). Wrapped functions
+ * without a partial form are always evaluated in full.
+ *
+ * Since partial weights are rescaled to full-scan magnitude by the wrapped function,
+ * both kinds of evaluation can mix within one reweight pass without biasing the
+ * normalization step.
+ *
+ * \tparam StateWeightingFunction The wrapped state weighting function type.
+ */
+template <class StateWeightingFunction>
+class DeadlineStateWeightingFunction {
+ public:
+  /// Clock used to measure the time budget.
+  using clock_type = std::chrono::steady_clock;
+
+  /// Constructs a deadline-aware state weighting function.
+  /**
+   * \param weighting_function State weighting function to wrap.
+   * \param budget Time budget, measured from construction, after which evaluations degrade.
+   * \param degraded_fraction Fraction of the beams to use after the deadline, in (0, 1].
+   */
+  DeadlineStateWeightingFunction(
+      StateWeightingFunction weighting_function,
+      clock_type::duration budget,
+      double degraded_fraction = 0.25)
+      : weighting_function_{std::move(weighting_function)},
+        deadline_{clock_type::now() + budget},
+        degraded_fraction_{degraded_fraction} {}
+
+  /// Returns the importance weight for the given state.
+  /**
+   * Full evaluation before the deadline, degraded partial-beam evaluation after it.
+   */
+  template <class State>
+  [[nodiscard]] auto operator()(const State& state) const {
+    if constexpr (std::is_invocable_v<const StateWeightingFunction&, const State&, double>) {
+      if (clock_type::now() >= deadline_) {
+        return weighting_function_(state, degraded_fraction_);
+      }
+    }
+    return weighting_function_(state);
+  }
+
+ private:
+  StateWeightingFunction weighting_function_;
+  clock_type::time_point deadline_;
+  double degraded_fraction_;
+};
+
+/// Wraps a state weighting function to degrade evaluations once a time budget expires.
+/**
+ * \param weighting_function State weighting function to wrap.
+ * \param budget Time budget, measured from this call, after which evaluations degrade.
+ * \param degraded_fraction Fraction of the beams to use after the deadline, in (0, 1].
+ * \return A \ref StateWeightingFunctionPage "state weighting function" that keeps the
+ *   reweight pass within the given budget by falling back to partial-beam weights.
+ */
+template <class StateWeightingFunction>
+[[nodiscard]] auto make_deadline_weighting(
+    StateWeightingFunction weighting_function,
+    std::chrono::steady_clock::duration budget,
+    double degraded_fraction = 0.25) {
+  return DeadlineStateWeightingFunction<StateWeightingFunction>{
+      std::move(weighting_function), budget, degraded_fraction};
+}
+
+}  // namespace beluga
+
+#endif
@@ -0,0 +1,91 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_FUSED_SENSOR_MODEL_HPP
+#define BELUGA_SENSOR_FUSED_SENSOR_MODEL_HPP
+
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file
+ * \brief Implementation of a sensor model combinator fusing multiple sensors.
+ */
+
+namespace beluga {
+
+/// Sensor model that fuses the likelihoods of multiple sensor models.
+/**
+ * This class satisfies \ref SensorModelPage.
+ *
+ * A measurement is a tuple holding one measurement per fused model, and the
+ * resulting state weighting function evaluates every conditioned model per
+ * particle in a single pass, multiplying the likelihoods. Compared to running
+ * one reweight pass per sensor, the particle set is traversed (and its states
+ * streamed through memory) only once per fusion cycle, and the product-of-
+ * likelihoods weights feed the normalization and KLD stages exactly like the
+ * weights of a single model would.
+ *
+ * \tparam SensorModels Fused sensor model types. All must share the same
+ * `state_type` and satisfy \ref SensorModelPage.
+ */
+template <class... SensorModels>
+class FusedSensorModel {
+ public:
+  static_assert(sizeof...(SensorModels) > 0, "at least one sensor model must be fused");
+
+  /// State type shared by all fused sensor models.
+  using state_type = typename std::tuple_element_t<0, std::tuple<SensorModels...>>::state_type;
+  /// Weight type resulting from the product of the fused model weights.
+  using weight_type = std::common_type_t<typename SensorModels::weight_type...>;
+  /// Measurement type, holding one measurement per fused model.
+  using measurement_type = std::tuple<typename SensorModels::measurement_type...>;
+
+  static_assert(
+      (std::is_same_v<state_type, typename SensorModels::state_type> && ...),
+      "all fused sensor models must share the same state type");
+
+  /// Constructs a FusedSensorModel instance.
+  /**
+   * \param models Sensor model instances to fuse, in measurement tuple order.
+   */
+  explicit FusedSensorModel(SensorModels... models) : models_{std::move(models)...} {}
+
+  /// Computes a state weighting function conditioned on all sensor measurements.
+  /**
+   * \param measurement Measurements to condition the fused sensor models with,
+   *  one per model.
+   * \return a callable satisfying \ref StateWeightingFunctionPage, returning the
+   *  product of the conditioned model likelihoods.
+   */
+  [[nodiscard]] auto operator()(measurement_type&& measurement) const {
+    return make_weighting_function(std::move(measurement), std::index_sequence_for<SensorModels...>{});
+  }
+
+ private:
+  template <std::size_t... Is>
+  [[nodiscard]] auto make_weighting_function(measurement_type&& measurement, std::index_sequence<Is...>) const {
+    return [weighting_functions = std::make_tuple(std::get<Is>(models_)(std::move(std::get<Is>(measurement)))...)](
+               const state_type& state) -> weight_type {
+      return (static_cast<weight_type>(std::get<Is>(weighting_functions)(state)) * ...);
+    };
+  }
+
+  std::tuple<SensorModels...> models_;
+};
+
+}  // namespace beluga
+
+#endif
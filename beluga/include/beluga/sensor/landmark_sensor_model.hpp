@@ -18,13 +18,19 @@
 // external
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/all.hpp>
+#include <range/v3/view/span.hpp>
 #include <range/v3/view/transform.hpp>
 #include <sophus/se2.hpp>
+#include <sophus/se3.hpp>
 #include <sophus/so2.hpp>
 
 // standard library
+#include <cassert>
 #include <cmath>
+#include <cstddef>
 #include <random>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 // project
@@ -82,77 +88,161 @@ class LandmarkSensorModel {
   explicit LandmarkSensorModel(param_type params, LandmarkMap landmark_map)
       : params_{std::move(params)}, landmark_map_{std::move(landmark_map)} {}
 
-  /// Returns a state weighting function conditioned on landmark position detections.
+  /// State weighting function conditioned on landmark position detections.
   /**
-   * \param detections 2D lidar hit points in the reference frame of filter particles.
-   * \return a state weighting function satisfying \ref StateWeightingFunctionPage
-   *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   * Returned by LandmarkSensorModel::operator()(). It satisfies \ref StateWeightingFunctionPage
+   * and borrows a reference to the sensor model (and thus their lifetime are bound).
+   *
+   * Per-detection invariants (range, normalized bearing and the Gaussian scale
+   * factors) are precomputed once per measurement, and the per-particle call builds
+   * the robot pose and its inverse once instead of re-deriving them per detection.
+   * Besides the single-state form, a batch form over contiguous spans of states and
+   * weights is provided; it evaluates matches in detection-major order, so
+   * consecutive map queries probe the same neighborhood of the landmark index for
+   * the whole particle set before moving on to the next detection.
    */
-  [[nodiscard]] auto operator()(measurement_type&& detections) const {
-    return [this, detections = std::move(detections)](const state_type& state) -> weight_type {
-      Sophus::SE3d robot_pose_in_world;
+  class StateWeightingFunction {
+   public:
+    /// Constructs a state weighting function from a borrowed sensor model and position detections.
+    StateWeightingFunction(const LandmarkSensorModel& model, measurement_type detections)
+        : model_{&model},
+          detections_{std::move(detections)},
+          negative_inverse_two_sigma_range_squared_{
+              -1. / (2. * model.params_.sigma_range * model.params_.sigma_range)},
+          negative_inverse_two_sigma_bearing_squared_{
+              -1. / (2. * model.params_.sigma_bearing * model.params_.sigma_bearing)} {
+      detection_ranges_.reserve(detections_.size());
+      detection_bearings_.reserve(detections_.size());
+      for (const auto& detection : detections_) {
+        detection_ranges_.push_back(detection.detection_position_in_robot.norm());
+        detection_bearings_.push_back(detection.detection_position_in_robot.normalized());
+      }
+    }
+
+    /// Computes the importance weight for a single particle state.
+    [[nodiscard]] weight_type operator()(const state_type& state) const {
+      const auto robot_pose_in_world = robot_pose_in_world_from(state);
+      const auto world_in_robot_pose = robot_pose_in_world.inverse();
+      double weight = 1.0;
+      for (std::size_t index = 0; index < detections_.size(); ++index) {
+        weight *= detection_weight(index, robot_pose_in_world, world_in_robot_pose);
+        if (weight == 0.0) {
+          return 0.0;
+        }
+      }
+      return weight;
+    }
 
+    /// Multiplies the importance weight of each state into the corresponding weight.
+    /**
+     * Batch form of the state weighting function; both spans must have the same size.
+     * The robot pose and its inverse are resolved once per state, then detections
+     * run in the outer loop so the landmark index is probed in a cache-friendly
+     * detection-major order, with weights accumulated per particle.
+     */
+    template <class Weight>
+    void operator()(ranges::span<const state_type> states, ranges::span<Weight> weights) const {
+      assert(states.size() == weights.size());
+      const auto size = static_cast<std::size_t>(states.size());
+      auto poses = std::vector<Sophus::SE3d>{};
+      auto inverse_poses = std::vector<Sophus::SE3d>{};
+      poses.reserve(size);
+      inverse_poses.reserve(size);
+      for (const auto& state : states) {
+        poses.push_back(robot_pose_in_world_from(state));
+        inverse_poses.push_back(poses.back().inverse());
+      }
+      auto products = std::vector<double>(size, 1.0);
+      for (std::size_t index = 0; index < detections_.size(); ++index) {
+        for (std::size_t particle = 0; particle < size; ++particle) {
+          if (products[particle] != 0.0) {
+            products[particle] *= detection_weight(index, poses[particle], inverse_poses[particle]);
+          }
+        }
+      }
+      for (std::size_t particle = 0; particle < size; ++particle) {
+        const auto position = static_cast<std::ptrdiff_t>(particle);
+        weights[position] = weights[position] * products[particle];
+      }
+    }
+
+   private:
+    /// Lifts a particle state into the 3D world frame of the landmark map.
+    [[nodiscard]] static Sophus::SE3d robot_pose_in_world_from(const state_type& state) {
       if constexpr (std::is_same_v<state_type, Sophus::SE3d>) {
         // The robot pose state is already given in 3D,
-        robot_pose_in_world = state;
+        return state;
       } else {
         // The robot pose state is given in 2D. Notice that in this case
         // the 2D pose of the robot is assumed to be that of the robot footprint (projection of the robot
         // on the z=0 plane of the 3D world frame). This is so that we can tie the sensor reference frame
         // to the world frame where the landmarks are given without additional structural information.
-        robot_pose_in_world = Sophus::SE3d{
+        return Sophus::SE3d{
             Sophus::SO3d::rotZ(state.so2().log()),
             Eigen::Vector3d{state.translation().x(), state.translation().y(), 0.0}};
       }
+    }
 
-      const auto detection_weight = [this, &robot_pose_in_world](const auto& detection) {
-        // calculate range and detection_bearing_in_robot to the detection from the robot
-        // the detection is already in robot frame
-        const auto& detection_category = detection.category;
-        const auto& detection_position_in_robot = detection.detection_position_in_robot;
+    /// Computes the weight contribution of one detection for one particle pose.
+    [[nodiscard]] double detection_weight(
+        std::size_t index,
+        const Sophus::SE3d& robot_pose_in_world,
+        const Sophus::SE3d& world_in_robot_pose) const {
+      const auto& detection = detections_[index];
 
-        const auto detection_range_in_robot = detection_position_in_robot.norm();
-        const auto detection_bearing_in_robot = detection_position_in_robot.normalized();
+      // convert the detection to the world frame to query the map
+      const auto detection_position_in_world = robot_pose_in_world * detection.detection_position_in_robot;
 
-        // convert the detection to the world frame to query the map
-        const auto detection_position_in_world = robot_pose_in_world * detection_position_in_robot;
+      // find the closest matching landmark in the world map
+      const auto opt_landmark_position_in_world =
+          model_->landmark_map_.find_nearest_landmark(detection_position_in_world, detection.category);
 
-        // find the closest matching landmark in the world map
-        const auto opt_landmark_position_in_world =
-            landmark_map_.find_nearest_landmark(detection_position_in_world, detection_category);
+      // if we did not find a matching landmark, the weight vanishes
+      if (!opt_landmark_position_in_world) {
+        return 0.0;
+      }
 
-        // if we did not find a matching landmark, return 0.0
-        if (!opt_landmark_position_in_world) {
-          return 0.0;
-        }
+      // convert landmark pose to world frame
+      // ignore height, because we are modelling the detection in 2D
+      const auto landmark_in_robot_position = world_in_robot_pose * *opt_landmark_position_in_world;
 
-        // convert landmark pose to world frame
-        // ignore height, because we are modelling the detection in 2D
-        const auto& landmark_position_in_world = *opt_landmark_position_in_world;
-        const auto landmark_in_robot_position = robot_pose_in_world.inverse() * landmark_position_in_world;
+      const auto landmark_range_in_robot = landmark_in_robot_position.norm();
+      const auto landmark_bearing_in_robot = landmark_in_robot_position.normalized();
 
-        const auto landmark_range_in_robot = landmark_in_robot_position.norm();
-        const auto landmark_bearing_in_robot = landmark_in_robot_position.normalized();
+      // calculate the aperture angle between the detection and the landmark,
+      // using the detection bearing normalized once at construction
+      const auto& detection_bearing_in_robot = detection_bearings_[index];
+      const auto cos_aperture = landmark_bearing_in_robot.dot(detection_bearing_in_robot);
+      const auto sin_aperture = landmark_bearing_in_robot.cross(detection_bearing_in_robot).norm();
+      const auto bearing_error = std::atan2(sin_aperture, cos_aperture);
 
-        // calculate the aperture angle between the detection and the landmark
-        const auto cos_aperture = landmark_bearing_in_robot.dot(detection_bearing_in_robot);
-        const auto sin_aperture = landmark_bearing_in_robot.cross(detection_bearing_in_robot).norm();
-        const auto bearing_error = std::atan2(sin_aperture, cos_aperture);
+      const auto range_error = detection_ranges_[index] - landmark_range_in_robot;
 
-        const auto range_error = detection_range_in_robot - landmark_range_in_robot;
+      // apply the error model from Probabilistic Robotics
+      const auto range_error_prob = std::exp(range_error * range_error * negative_inverse_two_sigma_range_squared_);
+      const auto bearing_error_prob =
+          std::exp(bearing_error * bearing_error * negative_inverse_two_sigma_bearing_squared_);
 
-        // apply the error model from Probabilistic Robotics
-        const auto range_error_prob =
-            std::exp(-range_error * range_error / (2. * params_.sigma_range * params_.sigma_range));
-        const auto bearing_error_prob =
-            std::exp(-bearing_error * bearing_error / (2. * params_.sigma_bearing * params_.sigma_bearing));
+      // We'll assume the probability of identification error to be zero
+      return range_error_prob * bearing_error_prob;
+    }
 
-        // We'll assume the probability of identification error to be zero
-        return range_error_prob * bearing_error_prob;
-      };
+    const LandmarkSensorModel* model_;
+    measurement_type detections_;
+    std::vector<double> detection_ranges_;
+    std::vector<LandmarkBearing3> detection_bearings_;
+    double negative_inverse_two_sigma_range_squared_;
+    double negative_inverse_two_sigma_bearing_squared_;
+  };
 
-      return std::transform_reduce(detections.cbegin(), detections.cend(), 1.0, std::multiplies{}, detection_weight);
-    };
+  /// Returns a state weighting function conditioned on landmark position detections.
+  /**
+   * \param detections Landmark position detections in the reference frame of filter particles.
+   * \return a state weighting function satisfying \ref StateWeightingFunctionPage
+   *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   */
+  [[nodiscard]] auto operator()(measurement_type&& detections) const {
+    return StateWeightingFunction{*this, std::move(detections)};
   }
 
   /// Update the sensor model with a new landmark `map`.
@@ -0,0 +1,341 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_SENSOR_LAZY_LIKELIHOOD_FIELD_MODEL_HPP
+#define BELUGA_SENSOR_LAZY_LIKELIHOOD_FIELD_MODEL_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <beluga/sensor/data/occupancy_grid.hpp>
+#include <beluga/sensor/likelihood_field_model.hpp>
+#include <beluga/utility/aligned_allocator.hpp>
+#include <range/v3/view/span.hpp>
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a lazily evaluated likelihood field sensor model.
+ */
+
+namespace beluga {
+
+/// Likelihood field sensor model computing and memoizing the field per tile on demand.
+/**
+ * Weight-equivalent to beluga::LikelihoodFieldModel, but instead of precomputing the
+ * likelihood of every map cell at startup, the field is materialized in fixed-size
+ * square tiles the first time a beam lands on them and memoized thereafter. Startup
+ * cost and memory are thus bounded by the region the robot actually visits, and an
+ * optional cap on cached tiles (evicting the least recently used one) keeps maps
+ * larger than available RAM usable.
+ *
+ * Tiles are computed exactly: each one scans the map obstacles within the tile bounds
+ * expanded by the obstacle influence radius (`max_obstacle_distance`), so tile values
+ * match the full distance transform.
+ *
+ * The tile cache is synchronized, so the returned state weighting functions can be
+ * used under parallel reweight policies.
+ *
+ * \note This class satisfies \ref SensorModelPage.
+ *
+ * \tparam OccupancyGrid Type representing an occupancy grid.
+ *  It must satisfy \ref OccupancyGrid2Page.
+ * \tparam FieldScalar Scalar type used to store the likelihood field tiles.
+ * \tparam StateScalar Scalar type of the particle states.
+ */
+template <class OccupancyGrid, class FieldScalar = double, class StateScalar = double>
+class LazyLikelihoodFieldModel {
+ public:
+  /// State type of a particle.
+  using state_type = Sophus::SE2<StateScalar>;
+  /// Weight type of the particle.
+  using weight_type = double;
+  /// Scalar type used to store the likelihood field tiles.
+  using field_scalar_type = FieldScalar;
+  /// Measurement type of the sensor: a point cloud for the range finder.
+  using measurement_type = std::vector<std::pair<double, double>>;
+  /// Map representation type.
+  using map_type = OccupancyGrid;
+  /// Parameter type that the constructor uses to configure the model.
+  using param_type = LikelihoodFieldModelParam;
+
+  /// Constructs a LazyLikelihoodFieldModel instance.
+  /**
+   * Construction only stores the grid and derives constants; no field cell is
+   * computed until a lookup first lands on its tile.
+   *
+   * \param params Parameters to configure this instance.
+   *  See beluga::LikelihoodFieldModelParam for details.
+   * \param grid Occupancy grid representing the static map.
+   * \param tile_side Tile side length, in cells.
+   * \param max_cached_tiles Maximum number of memoized tiles; 0 means unbounded.
+   *  When exceeded, the least recently used tile is evicted.
+   */
+  explicit LazyLikelihoodFieldModel(
+      const param_type& params,
+      map_type grid,
+      std::size_t tile_side = 64,
+      std::size_t max_cached_tiles = 0)
+      : params_{params},
+        grid_{std::move(grid)},
+        tile_side_{tile_side},
+        max_cached_tiles_{max_cached_tiles},
+        unknown_field_value_{unknown_field_value(params)},
+        world_to_grid_transform_{grid_.origin().inverse().template cast<StateScalar>()} {
+    assert(tile_side_ > 0);
+  }
+
+  /// Returns the number of tiles currently memoized.
+  [[nodiscard]] std::size_t memoized_tile_count() const {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    return tiles_.size();
+  }
+
+  /// Gets the field value of the cell nearest to the given grid-local coordinates.
+  /**
+   * Out-of-map coordinates resolve to the unknown-space value; in-map coordinates
+   * materialize their tile on first access.
+   */
+  [[nodiscard]] FieldScalar field_at(double x, double y) const {
+    const auto cell = grid_.cell_near(x, y);
+    if (!grid_.contains(cell)) {
+      return unknown_field_value_;
+    }
+    const auto [tile_index, offset] = locate(cell);
+    const auto tile_data = tile(tile_index);
+    return (*tile_data)[offset];
+  }
+
+  /// State weighting function conditioned on 2D lidar hits.
+  /**
+   * Returned by LazyLikelihoodFieldModel::operator()(). It satisfies
+   * \ref StateWeightingFunctionPage and borrows a reference to the sensor model
+   * (and thus their lifetime are bound).
+   */
+  class StateWeightingFunction {
+   public:
+    /// Constructs a state weighting function from a borrowed sensor model and lidar hit points.
+    StateWeightingFunction(const LazyLikelihoodFieldModel& model, ranges::span<const std::pair<double, double>> points)
+        : model_{&model} {
+      point_xs_.reserve(static_cast<std::size_t>(points.size()));
+      point_ys_.reserve(static_cast<std::size_t>(points.size()));
+      for (const auto& point : points) {
+        point_xs_.push_back(point.first);
+        point_ys_.push_back(point.second);
+      }
+    }
+
+    /// Computes the importance weight for a single particle state.
+    [[nodiscard]] weight_type operator()(const state_type& state) const { return importance_weight(state); }
+
+    /// Multiplies the importance weight of each state into the corresponding weight.
+    template <class Weight>
+    void operator()(ranges::span<const state_type> states, ranges::span<Weight> weights) const {
+      assert(states.size() == weights.size());
+      for (std::ptrdiff_t index = 0; index < states.size(); ++index) {
+        weights[index] = weights[index] * importance_weight(states[index]);
+      }
+    }
+
+   private:
+    [[nodiscard]] weight_type importance_weight(const state_type& state) const {
+      const auto transform = model_->world_to_grid_transform_ * state;
+      const auto x_offset = transform.translation().x();
+      const auto y_offset = transform.translation().y();
+      const auto cos_theta = transform.so2().unit_complex().x();
+      const auto sin_theta = transform.so2().unit_complex().y();
+      const bool use_log_likelihood = model_->params_.use_log_likelihood;
+      double accumulated = use_log_likelihood ? 0.0 : 1.0;
+      for (std::size_t index = 0; index < point_xs_.size(); ++index) {
+        const auto x = point_xs_[index] * cos_theta - point_ys_[index] * sin_theta + x_offset;
+        const auto y = point_xs_[index] * sin_theta + point_ys_[index] * cos_theta + y_offset;
+        accumulated += static_cast<double>(model_->field_at(x, y));
+      }
+      return use_log_likelihood ? std::exp(accumulated) : accumulated;
+    }
+
+    const LazyLikelihoodFieldModel* model_;
+    std::vector<double, AlignedAllocator<double>> point_xs_;
+    std::vector<double, AlignedAllocator<double>> point_ys_;
+  };
+
+  /// Returns a state weighting function conditioned on 2D lidar hits.
+  /**
+   * \param points 2D lidar hit points in the reference frame of particle states.
+   * \return a state weighting function satisfying \ref StateWeightingFunctionPage
+   *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   */
+  [[nodiscard]] auto operator()(measurement_type&& points) const {
+    return StateWeightingFunction{*this, ranges::make_span(points.data(), static_cast<std::ptrdiff_t>(points.size()))};
+  }
+
+  /// Returns a state weighting function conditioned on a borrowed view of 2D lidar hits.
+  /**
+   * Zero-copy overload for drivers that keep the hit points in a preallocated buffer
+   * reused across scans. The points are unpacked into the weighting function's own
+   * storage during construction, so the returned function does not reference the
+   * caller's buffer afterwards and the buffer can be overwritten with the next scan
+   * immediately.
+   *
+   * \param points Non-owning view of 2D lidar hit points in the reference frame of
+   *  particle states. It only needs to remain valid for the duration of this call.
+   * \return a state weighting function satisfying \ref StateWeightingFunctionPage
+   *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   */
+  [[nodiscard]] auto operator()(ranges::span<const std::pair<double, double>> points) const {
+    return StateWeightingFunction{*this, points};
+  }
+
+  /// Update the sensor model with a new occupancy grid map, dropping all memoized tiles.
+  /**
+   * \param grid New occupancy grid representing the static map.
+   */
+  void update_map(map_type grid) {
+    const std::lock_guard<std::mutex> lock{mutex_};
+    grid_ = std::move(grid);
+    world_to_grid_transform_ = grid_.origin().inverse().template cast<StateScalar>();
+    tiles_.clear();
+  }
+
+ private:
+  /// One memoized field tile.
+  struct CachedTile {
+    /// Tile cell values, row-major within the tile. Shared so readers outlive eviction.
+    std::shared_ptr<const std::vector<FieldScalar>> data;
+    /// Recency stamp for least-recently-used eviction.
+    std::size_t last_used;
+  };
+
+  /// Maps a grid cell to its tile index and the cell offset within the tile.
+  [[nodiscard]] std::pair<std::size_t, std::size_t> locate(const Eigen::Vector2i& cell) const {
+    const auto xi = static_cast<std::size_t>(cell.x());
+    const auto yi = static_cast<std::size_t>(cell.y());
+    const std::size_t tiles_per_row = (grid_.width() + tile_side_ - 1) / tile_side_;
+    const std::size_t tile_index = (yi / tile_side_) * tiles_per_row + xi / tile_side_;
+    const std::size_t offset = (yi % tile_side_) * tile_side_ + xi % tile_side_;
+    return {tile_index, offset};
+  }
+
+  /// Gets the memoized data of a tile, computing it on first access.
+  [[nodiscard]] std::shared_ptr<const std::vector<FieldScalar>> tile(std::size_t tile_index) const {
+    {
+      const std::lock_guard<std::mutex> lock{mutex_};
+      const auto it = tiles_.find(tile_index);
+      if (it != tiles_.end()) {
+        it->second.last_used = ++use_counter_;
+        return it->second.data;
+      }
+    }
+    // Computed outside the lock; concurrent misses on the same tile may compute
+    // it twice, but the first insertion wins and the duplicate is discarded.
+    auto data = compute_tile(tile_index);
+    const std::lock_guard<std::mutex> lock{mutex_};
+    const auto [it, inserted] = tiles_.try_emplace(tile_index, CachedTile{std::move(data), ++use_counter_});
+    if (inserted && max_cached_tiles_ > 0 && tiles_.size() > max_cached_tiles_) {
+      const auto oldest = std::min_element(tiles_.begin(), tiles_.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.last_used < rhs.second.last_used;
+      });
+      tiles_.erase(oldest);
+    }
+    return it->second.data;
+  }
+
+  /// Computes the field values of a tile from the map obstacles within its influence.
+  [[nodiscard]] std::shared_ptr<const std::vector<FieldScalar>> compute_tile(std::size_t tile_index) const {
+    const std::size_t width = grid_.width();
+    const std::size_t height = grid_.height();
+    const std::size_t tiles_per_row = (width + tile_side_ - 1) / tile_side_;
+    const std::size_t x_first = (tile_index % tiles_per_row) * tile_side_;
+    const std::size_t y_first = (tile_index / tiles_per_row) * tile_side_;
+    const std::size_t x_last = std::min(x_first + tile_side_ - 1, width - 1);
+    const std::size_t y_last = std::min(y_first + tile_side_ - 1, height - 1);
+
+    // Obstacles that can be the nearest one to any cell of the tile.
+    const auto influence_radius =
+        static_cast<std::size_t>(std::ceil(params_.max_obstacle_distance / grid_.resolution()));
+    const auto lower = [](std::size_t value, std::size_t margin) { return value > margin ? value - margin : 0; };
+    const std::size_t x_search_first = lower(x_first, influence_radius);
+    const std::size_t y_search_first = lower(y_first, influence_radius);
+    const std::size_t x_search_last = std::min(x_last + influence_radius, width - 1);
+    const std::size_t y_search_last = std::min(y_last + influence_radius, height - 1);
+
+    const auto obstacle_data = grid_.obstacle_data();
+    auto obstacles = std::vector<Eigen::Vector2d>{};
+    for (std::size_t yi = y_search_first; yi <= y_search_last; ++yi) {
+      for (std::size_t xi = x_search_first; xi <= x_search_last; ++xi) {
+        const auto index = grid_.index_at(static_cast<int>(xi), static_cast<int>(yi));
+        if (obstacle_data[static_cast<std::ptrdiff_t>(index)]) {
+          obstacles.push_back(grid_.coordinates_at(index));
+        }
+      }
+    }
+
+    const double squared_max_distance = params_.max_obstacle_distance * params_.max_obstacle_distance;
+    auto values = std::vector<FieldScalar>(tile_side_ * tile_side_, unknown_field_value_);
+    for (std::size_t yi = y_first; yi <= y_last; ++yi) {
+      for (std::size_t xi = x_first; xi <= x_last; ++xi) {
+        const auto coordinates = grid_.coordinates_at(grid_.index_at(static_cast<int>(xi), static_cast<int>(yi)));
+        double squared_distance = squared_max_distance;
+        for (const auto& obstacle : obstacles) {
+          squared_distance = std::min(squared_distance, (coordinates - obstacle).squaredNorm());
+        }
+        values[(yi - y_first) * tile_side_ + (xi - x_first)] = to_field_value(squared_distance);
+      }
+    }
+    return std::make_shared<const std::vector<FieldScalar>>(std::move(values));
+  }
+
+  /// Computes the field value for a cell at a given squared distance to its nearest obstacle.
+  [[nodiscard]] FieldScalar to_field_value(double squared_distance) const {
+    const auto amplitude = params_.z_hit / (params_.sigma_hit * std::sqrt(2 * Sophus::Constants<double>::pi()));
+    const auto two_squared_sigma = 2 * params_.sigma_hit * params_.sigma_hit;
+    const auto offset = params_.z_random / params_.max_laser_distance;
+    const auto likelihood = amplitude * std::exp(-squared_distance / two_squared_sigma) + offset;
+    if (params_.use_log_likelihood) {
+      return static_cast<FieldScalar>(std::log(likelihood));
+    }
+    return static_cast<FieldScalar>(likelihood * likelihood * likelihood);
+  }
+
+  /// Computes the field value assigned to space not covered by the map.
+  [[nodiscard]] static FieldScalar unknown_field_value(const param_type& params) {
+    const auto unknown_space_occupancy_prob = 1. / params.max_laser_distance;
+    return static_cast<FieldScalar>(
+        params.use_log_likelihood
+            ? std::log(unknown_space_occupancy_prob)
+            : unknown_space_occupancy_prob * unknown_space_occupancy_prob * unknown_space_occupancy_prob);
+  }
+
+  param_type params_;
+  map_type grid_;
+  std::size_t tile_side_;
+  std::size_t max_cached_tiles_;
+  FieldScalar unknown_field_value_;
+  state_type world_to_grid_transform_;
+  mutable std::mutex mutex_;
+  mutable std::unordered_map<std::size_t, CachedTile> tiles_;
+  mutable std::size_t use_counter_ = 0;
+};
+
+}  // namespace beluga
+
+#endif
@@ -15,10 +15,15 @@
 #ifndef BELUGA_SENSOR_NDT_SENSOR_MODEL_HPP
 #define BELUGA_SENSOR_NDT_SENSOR_MODEL_HPP
 
+#include <algorithm>
 #include <cassert>
+#include <cstddef>
 #include <cstdint>
+#include <execution>
 #include <filesystem>
+#include <numeric>
 #include <stdexcept>
+#include <thread>
 #include <type_traits>
 #include <unordered_map>
 #include <vector>
@@ -32,27 +37,14 @@
 #include <sophus/se3.hpp>
 #include <sophus/so2.hpp>
 
+#include <beluga/algorithm/voxel_downsample.hpp>
 #include <beluga/sensor/data/ndt_cell.hpp>
 #include <beluga/sensor/data/sparse_value_grid.hpp>
+#include <beluga/utility/aligned_allocator.hpp>
 
 namespace beluga {
 
 namespace detail {
-/// Hash function for N dimensional Eigen::Vectors of int.
-/// The code is from `hash_combine` function of the Boost library. See
-/// http://www.boost.org/doc/libs/1_55_0/doc/html/hash/reference.html#boost.hash_combine .
-template <int N>
-struct CellHasher {
-  /// Hashes an integer N dimensional integer vector.
-  size_t operator()(const Eigen::Matrix<int, N, 1> vector) const {
-    size_t seed = 0;
-    for (auto i = 0L; i < vector.size(); ++i) {
-      auto elem = *(vector.data() + i);
-      seed ^= std::hash<int>()(elem) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
-    }
-    return seed;
-  }
-};
 
 /// Fit a vector of points to an NDT cell, by computing its mean and covariance.
 template <int NDim, typename Scalar = double>
@@ -73,32 +65,114 @@ inline NDTCell<NDim, Scalar> fit_points(const std::vector<Eigen::Matrix<Scalar,
   return NDTCell<NDim, Scalar>{mean, cov};
 }
 
-/// Given a number of N dimensional points and a resolution, constructs a vector of NDT cells, by clusterizing the
-/// points using 'resolution' and fitting a normal distribution to each of the resulting clusters if they contain a
-/// minimum number of points in them.
+/// Streaming mean and covariance accumulator for the points falling in one cell.
+/**
+ * Uses Welford's online update, so clustering does not need to buffer the member
+ * points of each cell. Partial accumulators built over disjoint point subsets can
+ * be merged with the parallel combination of Chan et al.
+ */
 template <int NDim, typename Scalar = double>
-inline std::vector<NDTCell<NDim, Scalar>> to_cells(
-    const std::vector<Eigen::Matrix<Scalar, NDim, 1>>& points,
-    const double resolution) {
-  static constexpr int kMinPointsPerCell = 5;
+struct CellAccumulator {
+  /// Number of points accumulated so far.
+  std::size_t count = 0;
+  /// Running mean of the accumulated points.
+  Eigen::Matrix<Scalar, NDim, 1> mean = Eigen::Matrix<Scalar, NDim, 1>::Zero();
+  /// Running sum of outer products of deviations from the mean (M2).
+  Eigen::Matrix<Scalar, NDim, NDim> moment = Eigen::Matrix<Scalar, NDim, NDim>::Zero();
+
+  /// Accumulates one point.
+  void add(const Eigen::Matrix<Scalar, NDim, 1>& point) {
+    ++count;
+    const Eigen::Matrix<Scalar, NDim, 1> delta = point - mean;
+    mean += delta / static_cast<Scalar>(count);
+    moment += delta * (point - mean).transpose();
+  }
 
-  const Eigen::Map<const Eigen::Matrix<Scalar, NDim, Eigen::Dynamic>> points_view(
-      reinterpret_cast<const Scalar*>(points.data()), NDim, static_cast<int64_t>(points.size()));
+  /// Merges an accumulator built over a disjoint subset of the points.
+  void merge(const CellAccumulator& other) {
+    if (other.count == 0) {
+      return;
+    }
+    if (count == 0) {
+      *this = other;
+      return;
+    }
+    const Eigen::Matrix<Scalar, NDim, 1> delta = other.mean - mean;
+    const auto total = static_cast<Scalar>(count + other.count);
+    moment += other.moment +
+              (delta * delta.transpose()) * (static_cast<Scalar>(count) * static_cast<Scalar>(other.count) / total);
+    mean += delta * (static_cast<Scalar>(other.count) / total);
+    count += other.count;
+  }
 
-  std::vector<NDTCell<NDim, Scalar>> ret;
-  ret.reserve(static_cast<size_t>(points_view.cols()) / kMinPointsPerCell);
+  /// Fits an NDT cell from the accumulated statistics, using the sample covariance.
+  [[nodiscard]] NDTCell<NDim, Scalar> fit() const {
+    static constexpr double kMinVariance = 1e-5;
+    assert(count > 1);
+    Eigen::Matrix<Scalar, NDim, NDim> cov = moment / static_cast<Scalar>(count - 1);
+    cov(0, 0) = std::max(cov(0, 0), static_cast<Scalar>(kMinVariance));
+    cov(1, 1) = std::max(cov(1, 1), static_cast<Scalar>(kMinVariance));
+    if constexpr (NDim == 3) {
+      cov(2, 2) = std::max(cov(2, 2), static_cast<Scalar>(kMinVariance));
+    }
+    return NDTCell<NDim, Scalar>{mean, cov};
+  }
+};
 
-  std::unordered_map<Eigen::Matrix<int, NDim, 1>, std::vector<Eigen::Matrix<Scalar, NDim, 1>>, CellHasher<NDim>>
-      cell_grid;
-  for (const Eigen::Matrix<Scalar, NDim, 1>& col : points) {
-    cell_grid[(col / resolution).template cast<int>()].emplace_back(col);
+/// Given a number of N dimensional points and a resolution, constructs a vector of NDT cells, by clusterizing the
+/// points using 'resolution' and fitting a normal distribution to each of the resulting clusters if they contain a
+/// minimum number of points in them.
+/**
+ * Points are partitioned into contiguous chunks clustered in parallel into
+ * per-chunk streaming accumulators, which are then merged. Building-scale
+ * clouds thus scale across cores and no per-cell point buffers are kept;
+ * small inputs (e.g. single scans) collapse to one chunk with no threading
+ * overhead.
+ *
+ * The input may be any sized random access range of N dimensional points,
+ * such as a plain vector of Eigen vectors or a strided zero-copy view over
+ * a raw sensor message (see e.g. beluga_ros::PointCloud3). Points are cast
+ * to `Scalar` one at a time as they are accumulated, so no widened copy of
+ * the cloud is ever materialized.
+ */
+template <int NDim, typename Scalar = double, class Range>
+inline std::vector<NDTCell<NDim, Scalar>> to_cells(const Range& points, const double resolution) {
+  static constexpr std::size_t kMinPointsPerCell = 5;
+  static constexpr std::size_t kMinPointsPerChunk = 65536;
+  using accumulator_map_type =
+      std::unordered_map<Eigen::Matrix<int, NDim, 1>, CellAccumulator<NDim, Scalar>, CellHasher<NDim>>;
+
+  const std::size_t num_chunks = std::clamp<std::size_t>(
+      points.size() / kMinPointsPerChunk, 1, std::max(1U, std::thread::hardware_concurrency()));
+  const std::size_t chunk_size = (points.size() + num_chunks - 1) / num_chunks;
+
+  auto partials = std::vector<accumulator_map_type>(num_chunks);
+  auto chunks = std::vector<std::size_t>(num_chunks);
+  std::iota(chunks.begin(), chunks.end(), 0);
+  std::for_each(std::execution::par, chunks.begin(), chunks.end(), [&](std::size_t chunk) {
+    auto& accumulators = partials[chunk];
+    const std::size_t first = chunk * chunk_size;
+    const std::size_t last = std::min(first + chunk_size, points.size());
+    for (std::size_t index = first; index < last; ++index) {
+      const Eigen::Matrix<Scalar, NDim, 1> point = points[index].template cast<Scalar>();
+      accumulators[(point / resolution).template cast<int>()].add(point);
+    }
+  });
+
+  auto& accumulators = partials.front();
+  for (std::size_t chunk = 1; chunk < num_chunks; ++chunk) {
+    for (const auto& [cell, accumulator] : partials[chunk]) {
+      accumulators[cell].merge(accumulator);
+    }
   }
 
-  for (const auto& [cell, points_in_cell] : cell_grid) {
-    if (points_in_cell.size() < kMinPointsPerCell) {
+  std::vector<NDTCell<NDim, Scalar>> ret;
+  ret.reserve(accumulators.size());
+  for (const auto& [cell, accumulator] : accumulators) {
+    if (accumulator.count < kMinPointsPerCell) {
       continue;
     }
-    ret.push_back(fit_points<NDim, Scalar>(points_in_cell));
+    ret.push_back(accumulator.fit());
   }
 
   return ret;
@@ -191,6 +265,89 @@ class NDTSensorModel {
     assert(params_.minimum_likelihood >= 0);
   }
 
+  /// State weighting function for batches of measurement cells.
+  /**
+   * This class satisfies \ref StateWeightingFunctionPage.
+   *
+   * Measurement cell means are packed into a single matrix on construction, so
+   * for each particle the whole batch is transformed with one matrix product and
+   * the Mahalanobis exponents of all neighbor matches are accumulated into a
+   * contiguous buffer that is exponentiated in one fused pass, instead of
+   * evaluating one small quadratic form and one `std::exp()` call at a time.
+   */
+  class StateWeightingFunction {
+   public:
+    /// Scalar type used by the measurement cells.
+    using scalar_type = typename ndt_cell_type::scalar_type;
+
+    /// Constructs a state weighting function.
+    /**
+     * \param model Sensor model defining the map and likelihood parameters.
+     *   A reference to it is borrowed, binding their lifetimes.
+     * \param cells Measurement NDT cells in the reference frame of particle states.
+     */
+    StateWeightingFunction(const NDTSensorModel& model, std::vector<ndt_cell_type> cells) : model_{model} {
+      means_.resize(2, static_cast<Eigen::Index>(cells.size()));
+      covariances_.reserve(cells.size());
+      for (std::size_t index = 0; index < cells.size(); ++index) {
+        means_.col(static_cast<Eigen::Index>(index)) = cells[index].mean;
+        covariances_.push_back(cells[index].covariance);
+      }
+    }
+
+    /// Returns the importance weight for the given particle state.
+    [[nodiscard]] weight_type operator()(const state_type& state) const {
+      const Eigen::Matrix<scalar_type, 2, 2> rotation = state.so2().matrix();
+      const Eigen::Matrix<scalar_type, 2, Eigen::Dynamic> transformed_means =
+          (rotation * means_).colwise() + state.translation();
+
+      // Per-thread scratch buffers, so concurrent per-particle calls under a
+      // parallel execution policy don't contend nor allocate on every call.
+      thread_local std::vector<double> exponents;
+      thread_local std::vector<std::size_t> match_counts;
+      exponents.clear();
+      match_counts.assign(covariances_.size(), 0);
+
+      for (std::size_t index = 0; index < covariances_.size(); ++index) {
+        const auto column = static_cast<Eigen::Index>(index);
+        const Eigen::Matrix<scalar_type, 2, 2> rotated_covariance =
+            rotation * covariances_[index] * rotation.transpose();
+        const typename map_type::key_type measurement_cell =
+            model_.cells_data_.cell_near(transformed_means.col(column));
+        for (const auto& offset : model_.params_.neighbors_kernel) {
+          const auto maybe_ndt = model_.cells_data_.data_at(measurement_cell + offset);
+          if (maybe_ndt.has_value()) {
+            const Eigen::Matrix<scalar_type, 2, 1> error = transformed_means.col(column) - maybe_ndt->mean;
+            exponents.push_back(
+                (-model_.params_.d2 / 2.0) *
+                error.dot((rotated_covariance + maybe_ndt->covariance).inverse() * error));
+            ++match_counts[index];
+          }
+        }
+      }
+
+      Eigen::Map<Eigen::ArrayXd> packed_exponents{exponents.data(), static_cast<Eigen::Index>(exponents.size())};
+      packed_exponents = packed_exponents.exp();
+
+      weight_type weight = 1.0;
+      std::size_t first = 0;
+      for (const std::size_t count : match_counts) {
+        double likelihood = 0;
+        for (std::size_t match = first; match < first + count; ++match) {
+          likelihood += model_.params_.d1 * exponents[match];
+        }
+        first += count;
+        weight += std::max(likelihood, model_.params_.minimum_likelihood);
+      }
+      return weight;
+    }
+
+   private:
+    const NDTSensorModel& model_;
+    Eigen::Matrix<scalar_type, 2, Eigen::Dynamic> means_;
+    std::vector<Eigen::Matrix<scalar_type, 2, 2>, AlignedAllocator<Eigen::Matrix<scalar_type, 2, 2>>> covariances_;
+  };
+
   /// Returns a state weighting function conditioned on 2D / 3D lidar hits.
   /**
    * \param points 2D lidar hit points in the reference frame of particle states.
@@ -198,12 +355,28 @@ class NDTSensorModel {
    *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
    */
   [[nodiscard]] auto operator()(measurement_type&& points) const {
-    return [this, cells = detail::to_cells<ndt_cell_type::num_dim, typename ndt_cell_type::scalar_type>(
-                      points, cells_data_.resolution())](const state_type& state) -> weight_type {
-      return std::transform_reduce(
-          cells.cbegin(), cells.cend(), 1.0, std::plus{},
-          [this, state](const ndt_cell_type& ndt_cell) { return likelihood_at(state * ndt_cell); });
-    };
+    return StateWeightingFunction{
+        *this,
+        detail::to_cells<ndt_cell_type::num_dim, typename ndt_cell_type::scalar_type>(points, cells_data_.resolution())};
+  }
+
+  /// Returns a state weighting function conditioned on lidar hit points.
+  /**
+   * Overload for generic point ranges, e.g. strided zero-copy views over raw
+   * sensor messages (see beluga_ros::PointCloud3). Points are clustered into
+   * measurement cells in place, without first materializing a
+   * `measurement_type` buffer.
+   *
+   * \param points Lidar hit points in the reference frame of particle states,
+   *  as a sized random access range of fixed size Eigen vectors.
+   * \return a state weighting function satisfying \ref StateWeightingFunctionPage
+   *  and borrowing a reference to this sensor model (and thus their lifetime are bound).
+   */
+  template <class Range, typename = std::enable_if_t<!std::is_same_v<std::decay_t<Range>, measurement_type>>>
+  [[nodiscard]] auto operator()(const Range& points) const {
+    return StateWeightingFunction{
+        *this,
+        detail::to_cells<ndt_cell_type::num_dim, typename ndt_cell_type::scalar_type>(points, cells_data_.resolution())};
   }
 
   /// Returns the L2 likelihood scaled by 'd1' and 'd2' set in the parameters for this instance for 'measurement', for
@@ -22,5 +22,6 @@
 
 #include <beluga/testing/sophus_matchers.hpp>
 #include <beluga/testing/sophus_printers.hpp>
+#include <beluga/testing/synthetic_world.hpp>
 
 #endif
@@ -63,6 +63,15 @@ struct has_weight<T, std::void_t<decltype(beluga::weight(std::declval<T>()))>> :
 template <class T>
 inline constexpr bool has_weight_v = has_weight<T>::value;
 
+template <class T, class = void>
+struct has_cluster : public std::false_type {};
+
+template <class T>
+struct has_cluster<T, std::void_t<decltype(beluga::cluster(std::declval<T>()))>> : std::true_type {};
+
+template <class T>
+inline constexpr bool has_cluster_v = has_cluster<T>::value;
+
 template <class T, class = void>
 struct is_particle : public std::false_type {};
 
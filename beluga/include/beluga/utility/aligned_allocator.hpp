@@ -0,0 +1,100 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_UTILITY_ALIGNED_ALLOCATOR_HPP
+#define BELUGA_UTILITY_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+/**
+ * \file
+ * \brief Implementation of an over-aligned memory allocator.
+ */
+
+namespace beluga {
+
+/// An allocator that over-aligns all allocations to a given byte boundary.
+/**
+ * Satisfies the [Allocator](https://en.cppreference.com/w/cpp/named_req/Allocator)
+ * requirements, so it can be used with any standard container. Storage obtained through
+ * this allocator is aligned to `Alignment` bytes, allowing aligned vector loads and
+ * stores over contiguous element columns.
+ *
+ * \tparam T Element type to allocate.
+ * \tparam Alignment Alignment in bytes, must be a power of two and at least `alignof(T)`.
+ */
+template <class T, std::size_t Alignment = 64>
+class AlignedAllocator {
+ public:
+  static_assert((Alignment & (Alignment - 1)) == 0, "Alignment must be a power of two");
+  static_assert(Alignment >= alignof(T), "Alignment must be at least the natural alignment of T");
+
+  /// Value type of the allocations.
+  using value_type = T;
+
+  /// Alignment of the allocations, in bytes.
+  static constexpr std::size_t alignment = Alignment;
+
+  /// Rebinds the allocator to a different value type, keeping the alignment.
+  template <class U>
+  struct rebind {  // NOLINT(readability-identifier-naming)
+    /// The rebound allocator type.
+    using other = AlignedAllocator<U, Alignment>;
+  };
+
+  /// Default constructor.
+  constexpr AlignedAllocator() noexcept = default;
+
+  /// Converting constructor from an allocator for a different value type.
+  template <class U>
+  constexpr AlignedAllocator(const AlignedAllocator<U, Alignment>&) noexcept {}  // NOLINT(google-explicit-constructor)
+
+  /// Allocates storage for `count` elements aligned to `Alignment` bytes.
+  [[nodiscard]] T* allocate(std::size_t count) {
+    return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{Alignment}));
+  }
+
+  /// Default-initializes (instead of value-initializing) an element constructed without arguments.
+  /**
+   * This gives containers using this allocator `resize_for_overwrite` semantics on growth:
+   * trivially constructible elements claim storage without being zeroed, which matters when
+   * large particle buffers are resized only to be immediately overwritten. Construction with
+   * arguments falls back to the `std::allocator_traits` default.
+   */
+  template <class U>
+  void construct(U* pointer) noexcept(std::is_nothrow_default_constructible_v<U>) {
+    ::new (static_cast<void*>(pointer)) U;
+  }
+
+  /// Deallocates storage previously obtained from `allocate()`.
+  void deallocate(T* pointer, std::size_t) noexcept { ::operator delete(pointer, std::align_val_t{Alignment}); }
+};
+
+/// Compares two aligned allocators for equality, they are stateless and thus always equal.
+template <class T, class U, std::size_t Alignment>
+constexpr bool operator==(const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&) noexcept {
+  return true;
+}
+
+/// Compares two aligned allocators for inequality.
+template <class T, class U, std::size_t Alignment>
+constexpr bool operator!=(const AlignedAllocator<T, Alignment>&, const AlignedAllocator<U, Alignment>&) noexcept {
+  return false;
+}
+
+}  // namespace beluga
+
+#endif
@@ -15,9 +15,14 @@
 #ifndef BELUGA_UTILITY_INDEXING_ITERATOR_HPP
 #define BELUGA_UTILITY_INDEXING_ITERATOR_HPP
 
+#include <array>
+#include <cstddef>
 #include <cstdint>
 #include <iterator>
 #include <type_traits>
+#include <vector>
+
+#include <range/v3/iterator/concepts.hpp>
 
 /**
  * \file
@@ -26,16 +31,74 @@
 
 namespace beluga {
 
+/// Trait for indexable containers whose subscript operator accesses flat storage.
+/**
+ * `has_contiguous_layout<T>` derives from `std::true_type` when `T` guarantees that `t[i]` refers
+ * to `*(t.data() + i)` for every valid index `i`. Container types upholding that guarantee may
+ * specialize this trait, so that indexing iterators over them model the contiguous iterator
+ * concept and bulk operations (copies, row traversals) can lower to flat memory operations.
+ *
+ * Note that exposing a `data()` member is not sufficient: beluga::CircularArray, for instance,
+ * has flat storage but maps logical indices onto it non-linearly, so it must not (and does not)
+ * specialize this trait.
+ *
+ * \tparam Indexable Container type. It must support subscripting.
+ */
+template <class Indexable>
+struct has_contiguous_layout : std::false_type {};
+
+/// Specialization for const containers, deferring to the unqualified container type.
+template <class Indexable>
+struct has_contiguous_layout<const Indexable> : has_contiguous_layout<Indexable> {};
+
+/// Specialization for `std::vector`, whose subscript operator is defined in terms of flat storage.
+template <class T, class Allocator>
+struct has_contiguous_layout<std::vector<T, Allocator>> : std::true_type {};
+
+/// Specialization for `std::array`, whose subscript operator is defined in terms of flat storage.
+template <class T, std::size_t N>
+struct has_contiguous_layout<std::array<T, N>> : std::true_type {};
+
+/// Convenience template variable for beluga::has_contiguous_layout.
+template <class Indexable>
+inline constexpr bool has_contiguous_layout_v = has_contiguous_layout<Indexable>::value;
+
+namespace detail {
+
+/// \cond detail
+
+/// Iterator tags for IndexingIterator specializations over arbitrary indexables.
+template <bool IsContiguous>
+struct indexing_iterator_tags {
+  /// Category of the iterator.
+  using iterator_category = std::random_access_iterator_tag;
+};
+
+/// Iterator tags for IndexingIterator specializations over contiguous indexables.
+template <>
+struct indexing_iterator_tags<true> {
+  /// Category of the iterator.
+  using iterator_category = std::random_access_iterator_tag;
+  /// Concept of the iterator, strengthening the category for concept-aware code.
+  using iterator_concept = ranges::contiguous_iterator_tag;
+};
+
+/// \endcond
+
+}  // namespace detail
+
 /// A random access iterator for any indexable container.
 /**
  * It can provide a pair of iterators for any container type that supports subscripting with an integral-like index.
+ * For container types that additionally guarantee a contiguous layout (see beluga::has_contiguous_layout), the
+ * iterator advertises itself as contiguous, unlocking memcpy-class optimizations in concept-aware algorithms.
  *
  * \tparam Indexable Container type, potentially const. It must support subscripting.
  * \tparam Index Container index type. It must be default constructible and integral-like.
  * Defaults to the indexable container size type, if defined.
  */
 template <class Indexable, class Index = typename Indexable::size_type>
-class IndexingIterator {
+class IndexingIterator : public detail::indexing_iterator_tags<has_contiguous_layout_v<Indexable>> {
  public:
   /// Value type of the iterator.
   using value_type =
@@ -46,8 +109,6 @@ class IndexingIterator {
   using pointer = decltype(std::addressof(std::declval<Indexable>()[std::declval<Index>()]));
   /// Signed difference type of the iterator.
   using difference_type = std::make_signed_t<decltype(std::declval<Index>() - std::declval<Index>())>;
-  /// Category of the iterator.
-  using iterator_category = std::random_access_iterator_tag;
 
   /// Default constructor. Iterator will point nowhere.
   explicit IndexingIterator() = default;
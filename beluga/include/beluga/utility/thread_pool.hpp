@@ -0,0 +1,472 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_UTILITY_THREAD_POOL_HPP
+#define BELUGA_UTILITY_THREAD_POOL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <execution>
+#include <functional>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+/**
+ * \file
+ * \brief Implementation of a persistent work-stealing thread pool and a matching execution policy.
+ */
+
+namespace beluga {
+
+/// A persistent work-stealing thread pool.
+/**
+ * Standard execution policies dispatch through the backing parallel runtime with
+ * non-deterministic chunking and no thread reuse guarantees. This pool keeps a fixed
+ * set of workers alive across filter updates, each with its own task deque: workers
+ * pop from the front of their own deque and steal from the back of their neighbors'
+ * when idle. Bulk operations split their iteration space into chunks sized to the
+ * input so tasks stay coarse enough to amortize scheduling overhead.
+ *
+ * Prefer passing this pool to algorithms through `beluga::execution::pool_policy`
+ * rather than using the bulk interface directly.
+ *
+ * On multi-socket machines, enable static partitioning together with thread pinning:
+ * every bulk operation then splits into at most one chunk per worker with a fixed
+ * chunk-to-worker mapping and work stealing disabled, so each contiguous block of a
+ * particle column is always touched by the same pinned thread. That stable access
+ * pattern is what the kernel's NUMA balancing needs to migrate the backing pages to
+ * the node of their worker and keep them there, making the reweight stage scale past
+ * one socket. The trade-off is no load balancing between workers, which only pays
+ * off when per-element work is uniform, as it is for the particle actions.
+ */
+class ThreadPool {
+ public:
+  /// Constructor.
+  /**
+   * \param thread_count Number of worker threads. Zero selects the hardware concurrency.
+   * \param pin_threads Whether to pin each worker to a CPU core (Linux only, best effort).
+   * \param static_partitioning Whether to use a fixed chunk-to-worker mapping without
+   *   work stealing, keeping bulk operation partitions local to one worker each.
+   */
+  explicit ThreadPool(std::size_t thread_count = 0, bool pin_threads = false, bool static_partitioning = false)
+      : static_partitioning_{static_partitioning} {
+    if (thread_count == 0) {
+      thread_count = std::max<std::size_t>(1, std::thread::hardware_concurrency());
+    }
+    workers_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i) {
+      workers_.push_back(std::make_unique<Worker>());
+    }
+    threads_.reserve(thread_count);
+    for (std::size_t i = 0; i < thread_count; ++i) {
+      threads_.emplace_back([this, i] { run(i); });
+      if (pin_threads) {
+        pin_to_core(threads_.back(), i);
+      }
+    }
+  }
+
+  /// Destructor. Drains pending work and joins all workers.
+  ~ThreadPool() {
+    {
+      const std::lock_guard<std::mutex> lock{mutex_};
+      stopping_ = true;
+    }
+    work_available_.notify_all();
+    for (auto& thread : threads_) {
+      thread.join();
+    }
+  }
+
+  ThreadPool(const ThreadPool&) = delete;
+  ThreadPool& operator=(const ThreadPool&) = delete;
+
+  /// Returns the number of worker threads.
+  [[nodiscard]] std::size_t thread_count() const noexcept { return threads_.size(); }
+
+  /// Returns whether the pool uses a fixed chunk-to-worker mapping without stealing.
+  [[nodiscard]] bool static_partitioning() const noexcept { return static_partitioning_; }
+
+  /// Runs `fn(index)` for every index in `[0, task_count)` across the workers and blocks until done.
+  template <class Fn>
+  void bulk_execute(std::size_t task_count, Fn fn) {
+    if (task_count == 0) {
+      return;
+    }
+    auto state = std::make_shared<BulkState>();
+    state->remaining.store(task_count, std::memory_order_relaxed);
+    {
+      const std::lock_guard<std::mutex> lock{mutex_};
+      for (std::size_t task = 0; task < task_count; ++task) {
+        auto& worker = *workers_[task % workers_.size()];
+        const std::lock_guard<std::mutex> queue_lock{worker.mutex};
+        worker.queue.emplace_back([fn, task, state] {
+          fn(task);
+          if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            const std::lock_guard<std::mutex> done_lock{state->mutex};
+            state->done = true;
+            state->condition.notify_all();
+          }
+        });
+      }
+    }
+    work_available_.notify_all();
+    std::unique_lock<std::mutex> done_lock{state->mutex};
+    state->condition.wait(done_lock, [&state] { return state->done; });
+  }
+
+  /// Enqueues a single task and returns a future for its result.
+  /**
+   * Tasks submitted to a single-worker pool run in submission order, which makes this
+   * a convenient way to serialize asynchronous stages (see `beluga::Amcl::update_async()`).
+   * With more than one worker, submitted tasks may run concurrently and be stolen
+   * like any other work.
+   *
+   * \param fn Callable invocable without arguments, run on one of the workers.
+   * \return A future holding the eventual result of invoking `fn`.
+   */
+  template <class Fn>
+  [[nodiscard]] auto submit(Fn fn) -> std::future<std::invoke_result_t<Fn>> {
+    auto task = std::make_shared<std::packaged_task<std::invoke_result_t<Fn>()>>(std::move(fn));
+    auto future = task->get_future();
+    {
+      // The pool mutex is held while enqueuing (as in bulk_execute) so an idle
+      // worker cannot miss the wakeup between its pending-work check and its wait.
+      const std::lock_guard<std::mutex> lock{mutex_};
+      auto& worker = *workers_[next_submission_.fetch_add(1, std::memory_order_relaxed) % workers_.size()];
+      const std::lock_guard<std::mutex> queue_lock{worker.mutex};
+      worker.queue.emplace_back([task] { (*task)(); });
+    }
+    notify_for_single_task();
+    return future;
+  }
+
+  /// Enqueues a single fire-and-forget task.
+  /**
+   * Like `submit()` but without the packaged-task and future machinery, for callers
+   * that signal completion through their own channel, e.g. by posting a continuation
+   * to an external executor from within the task. The ordering guarantees of
+   * `submit()` apply.
+   *
+   * \param fn Callable invocable without arguments, run on one of the workers.
+   *   It must be copyable, as it is type-erased into the worker queue.
+   */
+  template <class Fn>
+  void execute(Fn fn) {
+    {
+      // The pool mutex is held while enqueuing (as in bulk_execute) so an idle
+      // worker cannot miss the wakeup between its pending-work check and its wait.
+      const std::lock_guard<std::mutex> lock{mutex_};
+      auto& worker = *workers_[next_submission_.fetch_add(1, std::memory_order_relaxed) % workers_.size()];
+      const std::lock_guard<std::mutex> queue_lock{worker.mutex};
+      worker.queue.emplace_back(std::move(fn));
+    }
+    notify_for_single_task();
+  }
+
+  /// Number of chunks a bulk operation over `size` elements should be split into.
+  [[nodiscard]] std::size_t chunk_count(std::size_t size) const noexcept {
+    constexpr std::size_t kMinChunkSize = 1024;
+    constexpr std::size_t kChunksPerThread = 4;
+    const std::size_t bounded_by_size = std::max<std::size_t>(1, size / kMinChunkSize);
+    if (static_partitioning_) {
+      // One chunk per worker at most: chunk i always lands on worker i, so every
+      // contiguous block of the input is touched by the same thread on every pass.
+      return std::min(thread_count(), bounded_by_size);
+    }
+    return std::min(thread_count() * kChunksPerThread, bounded_by_size);
+  }
+
+  /// Applies `fn` to every element in `[first, last)`, in parallel.
+  /**
+   * \tparam Iterator A random access iterator type.
+   */
+  template <class Iterator, class Fn>
+  void for_each(Iterator first, Iterator last, Fn fn) {
+    const auto size = static_cast<std::size_t>(std::distance(first, last));
+    const std::size_t chunks = chunk_count(size);
+    bulk_execute(chunks, [=](std::size_t chunk) {
+      const std::size_t chunk_begin = chunk * size / chunks;
+      const std::size_t chunk_end = (chunk + 1) * size / chunks;
+      auto it = first + static_cast<std::ptrdiff_t>(chunk_begin);
+      for (std::size_t i = chunk_begin; i < chunk_end; ++i, ++it) {
+        fn(*it);
+      }
+    });
+  }
+
+  /// Applies `fn` to every element in `[first, last)` writing the results through `out`, in parallel.
+  template <class Iterator, class Output, class Fn>
+  void transform(Iterator first, Iterator last, Output out, Fn fn) {
+    const auto size = static_cast<std::size_t>(std::distance(first, last));
+    const std::size_t chunks = chunk_count(size);
+    bulk_execute(chunks, [=](std::size_t chunk) {
+      const std::size_t chunk_begin = chunk * size / chunks;
+      const std::size_t chunk_end = (chunk + 1) * size / chunks;
+      auto it = first + static_cast<std::ptrdiff_t>(chunk_begin);
+      auto out_it = out + static_cast<std::ptrdiff_t>(chunk_begin);
+      for (std::size_t i = chunk_begin; i < chunk_end; ++i, ++it, ++out_it) {
+        *out_it = fn(*it);
+      }
+    });
+  }
+
+  /// Binary transform overload over two input ranges.
+  template <class Iterator1, class Iterator2, class Output, class Fn>
+  void transform(Iterator1 first1, Iterator1 last1, Iterator2 first2, Output out, Fn fn) {
+    const auto size = static_cast<std::size_t>(std::distance(first1, last1));
+    const std::size_t chunks = chunk_count(size);
+    bulk_execute(chunks, [=](std::size_t chunk) {
+      const std::size_t chunk_begin = chunk * size / chunks;
+      const std::size_t chunk_end = (chunk + 1) * size / chunks;
+      auto it1 = first1 + static_cast<std::ptrdiff_t>(chunk_begin);
+      auto it2 = first2 + static_cast<std::ptrdiff_t>(chunk_begin);
+      auto out_it = out + static_cast<std::ptrdiff_t>(chunk_begin);
+      for (std::size_t i = chunk_begin; i < chunk_end; ++i, ++it1, ++it2, ++out_it) {
+        *out_it = fn(*it1, *it2);
+      }
+    });
+  }
+
+  /// Parallel transform-reduce with per-chunk partial results.
+  /**
+   * `init` is folded in exactly once; `reduce` must be associative and commutative,
+   * matching the requirements of the standard parallel `std::transform_reduce`.
+   */
+  template <class Iterator, class T, class BinaryOp, class UnaryOp>
+  T transform_reduce(Iterator first, Iterator last, T init, BinaryOp reduce, UnaryOp transform_op) {
+    const auto size = static_cast<std::size_t>(std::distance(first, last));
+    if (size == 0) {
+      return init;
+    }
+    const std::size_t chunks = chunk_count(size);
+    auto partials = std::vector<T>(chunks, init);
+    auto* partials_data = partials.data();
+    bulk_execute(chunks, [=](std::size_t chunk) {
+      const std::size_t chunk_begin = chunk * size / chunks;
+      const std::size_t chunk_end = (chunk + 1) * size / chunks;
+      auto it = first + static_cast<std::ptrdiff_t>(chunk_begin);
+      T partial = transform_op(*it);
+      ++it;
+      for (std::size_t i = chunk_begin + 1; i < chunk_end; ++i, ++it) {
+        partial = reduce(std::move(partial), transform_op(*it));
+      }
+      partials_data[chunk] = std::move(partial);
+    });
+    T result = std::move(init);
+    for (auto& partial : partials) {
+      result = reduce(std::move(result), std::move(partial));
+    }
+    return result;
+  }
+
+ private:
+  /// Per-worker task deque; owners pop from the front, thieves steal from the back.
+  struct Worker {
+    std::mutex mutex;
+    std::deque<std::function<void()>> queue;
+  };
+
+  /// Completion state shared between the tasks of one bulk operation.
+  struct BulkState {
+    std::atomic<std::size_t> remaining{0};
+    std::mutex mutex;
+    std::condition_variable condition;
+    bool done = false;
+  };
+
+  void run(std::size_t worker_index) {
+    for (;;) {
+      auto task = pop_or_steal(worker_index);
+      if (task) {
+        task();
+        continue;
+      }
+      std::unique_lock<std::mutex> lock{mutex_};
+      work_available_.wait(lock, [this, worker_index] { return stopping_ || any_work_pending_for(worker_index); });
+      if (stopping_ && !any_work_pending()) {
+        return;
+      }
+    }
+  }
+
+  [[nodiscard]] std::function<void()> pop_or_steal(std::size_t worker_index) {
+    {
+      auto& own = *workers_[worker_index];
+      const std::lock_guard<std::mutex> lock{own.mutex};
+      if (!own.queue.empty()) {
+        auto task = std::move(own.queue.front());
+        own.queue.pop_front();
+        return task;
+      }
+    }
+    if (static_partitioning_) {
+      return nullptr;  // Tasks stay on their assigned worker, keeping partitions local.
+    }
+    for (std::size_t offset = 1; offset < workers_.size(); ++offset) {
+      auto& victim = *workers_[(worker_index + offset) % workers_.size()];
+      const std::lock_guard<std::mutex> lock{victim.mutex};
+      if (!victim.queue.empty()) {
+        auto task = std::move(victim.queue.back());
+        victim.queue.pop_back();
+        return task;
+      }
+    }
+    return nullptr;
+  }
+
+  [[nodiscard]] bool any_work_pending() {
+    for (const auto& worker : workers_) {
+      const std::lock_guard<std::mutex> lock{worker->mutex};
+      if (!worker->queue.empty()) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+  /// Returns whether there is pending work the given worker is allowed to run.
+  [[nodiscard]] bool any_work_pending_for(std::size_t worker_index) {
+    if (!static_partitioning_) {
+      return any_work_pending();
+    }
+    // Without stealing, only the worker's own queue matters; waking on foreign
+    // work would spin until that queue drains.
+    auto& own = *workers_[worker_index];
+    const std::lock_guard<std::mutex> lock{own.mutex};
+    return !own.queue.empty();
+  }
+
+  /// Wakes a worker able to run a freshly enqueued single task.
+  void notify_for_single_task() {
+    if (static_partitioning_) {
+      // Any single notified worker may not own the queue the task landed in, and
+      // without stealing it would go back to sleep; wake them all instead.
+      work_available_.notify_all();
+    } else {
+      work_available_.notify_one();
+    }
+  }
+
+  static void pin_to_core([[maybe_unused]] std::thread& thread, [[maybe_unused]] std::size_t core) {
+#ifdef __linux__
+    cpu_set_t cpuset;
+    CPU_ZERO(&cpuset);
+    CPU_SET(core % std::max(1U, std::thread::hardware_concurrency()), &cpuset);
+    pthread_setaffinity_np(thread.native_handle(), sizeof(cpu_set_t), &cpuset);
+#endif
+  }
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+  std::mutex mutex_;
+  std::condition_variable work_available_;
+  std::atomic<std::size_t> next_submission_{0};
+  bool stopping_ = false;
+  /// Fixed chunk-to-worker mapping without stealing, for NUMA page locality.
+  bool static_partitioning_ = false;
+};
+
+namespace execution {
+
+/// Execution-policy-like type that dispatches element operations to a persistent `beluga::ThreadPool`.
+/**
+ * Unlike the standard policies this one carries state (a pool reference), so it can
+ * be passed wherever the particle actions and `beluga::Amcl` accept an execution
+ * policy. The referenced pool must outlive every copy of the policy.
+ */
+class pool_policy {  // NOLINT(readability-identifier-naming)
+ public:
+  /// Constructs a policy targeting the given pool.
+  explicit pool_policy(ThreadPool& pool) noexcept : pool_{&pool} {}
+
+  /// Returns the targeted pool.
+  [[nodiscard]] ThreadPool& pool() const noexcept { return *pool_; }
+
+ private:
+  ThreadPool* pool_;
+};
+
+/// Applies `fn` to every element, dispatching to either the standard policy overload or a pool.
+template <class ExecutionPolicy, class Iterator, class Fn>
+void for_each(ExecutionPolicy&& policy, Iterator first, Iterator last, Fn fn) {
+  if constexpr (std::is_same_v<std::decay_t<ExecutionPolicy>, pool_policy>) {
+    policy.pool().for_each(first, last, std::move(fn));
+  } else {
+    std::for_each(policy, first, last, std::move(fn));
+  }
+}
+
+/// Unary transform, dispatching to either the standard policy overload or a pool.
+template <class ExecutionPolicy, class Iterator, class Output, class Fn>
+void transform(ExecutionPolicy&& policy, Iterator first, Iterator last, Output out, Fn fn) {
+  if constexpr (std::is_same_v<std::decay_t<ExecutionPolicy>, pool_policy>) {
+    policy.pool().transform(first, last, out, std::move(fn));
+  } else {
+    std::transform(policy, first, last, out, std::move(fn));
+  }
+}
+
+/// Binary transform, dispatching to either the standard policy overload or a pool.
+template <class ExecutionPolicy, class Iterator1, class Iterator2, class Output, class Fn>
+void transform(ExecutionPolicy&& policy, Iterator1 first1, Iterator1 last1, Iterator2 first2, Output out, Fn fn) {
+  if constexpr (std::is_same_v<std::decay_t<ExecutionPolicy>, pool_policy>) {
+    policy.pool().transform(first1, last1, first2, out, std::move(fn));
+  } else {
+    std::transform(policy, first1, last1, first2, out, std::move(fn));
+  }
+}
+
+/// Transform-reduce, dispatching to either the standard policy overload or a pool.
+template <class ExecutionPolicy, class Iterator, class T, class BinaryOp, class UnaryOp>
+T transform_reduce(ExecutionPolicy&& policy, Iterator first, Iterator last, T init, BinaryOp reduce, UnaryOp unary) {
+  if constexpr (std::is_same_v<std::decay_t<ExecutionPolicy>, pool_policy>) {
+    return policy.pool().transform_reduce(first, last, std::move(init), std::move(reduce), std::move(unary));
+  } else {
+    return std::transform_reduce(policy, first, last, std::move(init), std::move(reduce), std::move(unary));
+  }
+}
+
+}  // namespace execution
+
+/// Trait extending `std::is_execution_policy` with the beluga execution policies.
+template <class T>
+struct is_execution_policy : std::is_execution_policy<T> {};
+
+/// Specialization for `beluga::execution::pool_policy`.
+template <>
+struct is_execution_policy<execution::pool_policy> : std::true_type {};
+
+/// Convenience template variable for `is_execution_policy`.
+template <class T>
+inline constexpr bool is_execution_policy_v = is_execution_policy<T>::value;
+
+}  // namespace beluga
+
+#endif
@@ -0,0 +1,61 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_UTILITY_TRACEPOINT_HPP
+#define BELUGA_UTILITY_TRACEPOINT_HPP
+
+/**
+ * \file
+ * \brief USDT tracepoint macros for the particle filter pipeline.
+ *
+ * The macros expand to static `dtrace`-style probes under the `beluga`
+ * provider, which LTTng, bpftrace and perf can attach to on production
+ * binaries without rebuilding. An unattached probe costs a single `nop`
+ * instruction, so they are compiled in by default wherever `<sys/sdt.h>`
+ * is available; define `BELUGA_DISABLE_TRACEPOINTS` to compile them out
+ * entirely (mirroring `BELUGA_DISABLE_AMCL_INSTRUMENTATION`).
+ *
+ * Example, attributing update latency to stages on a live robot:
+ *
+ * ```bash
+ * bpftrace -e 'usdt:/path/to/binary:beluga:resample_end { @count = hist(arg0); }'
+ * ```
+ */
+
+#if !defined(BELUGA_DISABLE_TRACEPOINTS) && defined(__has_include)
+#if __has_include(<sys/sdt.h>)
+#include <sys/sdt.h>
+/// \brief Defined when the tracepoint macros expand to real probes.
+#define BELUGA_TRACEPOINTS_AVAILABLE 1
+#endif
+#endif
+
+#if defined(BELUGA_TRACEPOINTS_AVAILABLE)
+
+/// Emits a named tracepoint with no payload.
+#define BELUGA_TRACEPOINT(name) DTRACE_PROBE(beluga, name)
+/// Emits a named tracepoint with one integer payload argument.
+#define BELUGA_TRACEPOINT1(name, arg1) DTRACE_PROBE1(beluga, name, arg1)
+/// Emits a named tracepoint with two integer payload arguments.
+#define BELUGA_TRACEPOINT2(name, arg1, arg2) DTRACE_PROBE2(beluga, name, arg1, arg2)
+
+#else
+
+#define BELUGA_TRACEPOINT(name) static_cast<void>(0)
+#define BELUGA_TRACEPOINT1(name, arg1) static_cast<void>(0)
+#define BELUGA_TRACEPOINT2(name, arg1, arg2) static_cast<void>(0)
+
+#endif
+
+#endif  // BELUGA_UTILITY_TRACEPOINT_HPP
@@ -18,8 +18,11 @@
 #include <beluga/views/elements.hpp>
 #include <beluga/views/particles.hpp>
 #include <beluga/views/random_intersperse.hpp>
+#include <beluga/views/residual_sample.hpp>
 #include <beluga/views/sample.hpp>
+#include <beluga/views/systematic_sample.hpp>
 #include <beluga/views/take_evenly.hpp>
+#include <beluga/views/take_spread.hpp>
 #include <beluga/views/take_while_kld.hpp>
 #include <beluga/views/zip.hpp>
 
@@ -15,8 +15,15 @@
 #ifndef BELUGA_VIEWS_PARTICLES_HPP
 #define BELUGA_VIEWS_PARTICLES_HPP
 
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
 #include <beluga/primitives.hpp>
+#include <beluga/type_traits/tuple_traits.hpp>
+
 #include <range/v3/view/transform.hpp>
+#include <range/v3/view/view.hpp>
 
 /**
  * \file
@@ -25,13 +32,115 @@
 
 namespace beluga::views {
 
+namespace detail {
+
+/// Detects containers exposing a contiguous span over their Ith member column.
+/**
+ * Satisfied by structure-of-arrays containers like `beluga::TupleVector`, whose
+ * `span<I>()` member returns the raw storage of one column.
+ */
+template <class Range, std::size_t I, class = void>
+struct has_column_span : std::false_type {};
+
+/// Specialization for containers providing the column span accessor.
+template <class Range, std::size_t I>
+struct has_column_span<Range, I, std::void_t<decltype(std::declval<Range&>().template span<I>())>> : std::true_type {};
+
+/// Detects containers exposing a contiguous span over their column of type `T`.
+template <class Range, class T, class = void>
+struct has_typed_column_span : std::false_type {};
+
+/// Specialization for containers providing the column span accessor.
+template <class Range, class T>
+struct has_typed_column_span<
+    Range,
+    T,
+    std::enable_if_t<
+        has_single_element_v<T, typename Range::value_type>,
+        std::void_t<decltype(std::declval<Range&>().template span<tuple_index_v<T, typename Range::value_type>>())>>>
+    : std::true_type {};
+
+/// Implementation detail for the states range adaptor object.
+struct states_fn {  // NOLINT(readability-identifier-naming)
+  /// Overload that unwraps contiguous state columns or falls back to a lazy transform.
+  /**
+   * Lvalue structure-of-arrays containers (e.g. `beluga::TupleVector`) yield a raw
+   * contiguous span over the state column, so consumers like `beluga::estimate` can
+   * dispatch to contiguous-memory implementations instead of iterating through
+   * proxy cursors. Any other range yields the usual lazy transform.
+   */
+  template <class Range>
+  constexpr auto operator()(Range&& range) const {
+    using container_type = std::remove_reference_t<Range>;
+    if constexpr (std::is_lvalue_reference_v<Range&&> && has_column_span<container_type, 0>::value) {
+      // Structure-of-arrays particles are tuples, whose state is their first element.
+      return range.template span<0>();
+    } else {
+      return ranges::views::transform(std::forward<Range>(range), beluga::state);
+    }
+  }
+};
+
+/// Implementation detail for the weights range adaptor object.
+struct weights_fn {  // NOLINT(readability-identifier-naming)
+  /// Overload that unwraps contiguous weight columns or falls back to a lazy transform.
+  /** See `states_fn::operator()`. */
+  template <class Range>
+  constexpr auto operator()(Range&& range) const {
+    using container_type = std::remove_reference_t<Range>;
+    if constexpr (
+        std::is_lvalue_reference_v<Range&&> && has_typed_column_span<container_type, beluga::Weight>::value) {
+      return range.template span<tuple_index_v<beluga::Weight, typename container_type::value_type>>();
+    } else if constexpr (
+        std::is_lvalue_reference_v<Range&&> && has_typed_column_span<container_type, beluga::WeightF>::value) {
+      return range.template span<tuple_index_v<beluga::WeightF, typename container_type::value_type>>();
+    } else {
+      return ranges::views::transform(std::forward<Range>(range), beluga::weight);
+    }
+  }
+};
+
+/// Implementation detail for the clusters range adaptor object.
+struct clusters_fn {  // NOLINT(readability-identifier-naming)
+  /// Overload that unwraps contiguous cluster columns or falls back to a lazy transform.
+  /** See `states_fn::operator()`. */
+  template <class Range>
+  constexpr auto operator()(Range&& range) const {
+    using container_type = std::remove_reference_t<Range>;
+    if constexpr (
+        std::is_lvalue_reference_v<Range&&> && has_typed_column_span<container_type, beluga::Cluster>::value) {
+      return range.template span<tuple_index_v<beluga::Cluster, typename container_type::value_type>>();
+    } else {
+      return ranges::views::transform(std::forward<Range>(range), beluga::cluster);
+    }
+  }
+};
+
+}  // namespace detail
+
 /// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
 /// will obtain a reference to the state of each particle in the input range lazily.
-inline constexpr auto states = ranges::views::transform(beluga::state);
+/**
+ * Over structure-of-arrays containers with a contiguous state column (e.g.
+ * `beluga::TupleVector`), the view unwraps to a raw contiguous span instead.
+ */
+inline constexpr auto states = ranges::make_view_closure(detail::states_fn{});
 
 /// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
 /// will obtain a reference to the weight of each particle in the input range lazily.
-inline constexpr auto weights = ranges::views::transform(beluga::weight);
+/**
+ * Over structure-of-arrays containers with a contiguous weight column (e.g.
+ * `beluga::TupleVector`), the view unwraps to a raw contiguous span instead.
+ */
+inline constexpr auto weights = ranges::make_view_closure(detail::weights_fn{});
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// will obtain a reference to the cluster of each particle in the input range lazily.
+/**
+ * Over structure-of-arrays containers with a contiguous cluster column (e.g.
+ * `beluga::TupleVector`), the view unwraps to a raw contiguous span instead.
+ */
+inline constexpr auto clusters = ranges::make_view_closure(detail::clusters_fn{});
 
 }  // namespace beluga::views
 
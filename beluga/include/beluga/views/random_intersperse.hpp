@@ -15,7 +15,10 @@
 #ifndef BELUGA_VIEWS_RANDOM_INTERSPERSE_HPP
 #define BELUGA_VIEWS_RANDOM_INTERSPERSE_HPP
 
+#include <cmath>
+#include <cstddef>
 #include <functional>
+#include <limits>
 #include <optional>
 #include <random>
 #include <type_traits>
@@ -24,6 +27,8 @@
 #include <range/v3/utility/random.hpp>
 #include <range/v3/view/adaptor.hpp>
 
+#include <beluga/random/random_engines.hpp>
+
 /**
  * \file
  * \brief Implementation of a random_intersperse range adaptor object.
@@ -41,7 +46,7 @@ namespace detail {
  *  [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator)
  *  requirements.
  */
-template <class Range, class Fn, class URNG = typename ranges::detail::default_random_engine>
+template <class Range, class Fn, class URNG = beluga::default_random_engine>
 struct random_intersperse_view
     : public ranges::view_adaptor<
           random_intersperse_view<Range, Fn, URNG>,
@@ -65,10 +70,11 @@ struct random_intersperse_view
       Range range,
       Fn fn,
       double probability,
-      URNG& engine = ranges::detail::get_random_engine())
+      URNG& engine = beluga::get_default_random_engine())
       : random_intersperse_view::view_adaptor{std::move(range)},
         fn_{std::move(fn)},
-        distribution_{probability},
+        probability_{probability},
+        log_one_minus_probability_{std::log1p(-probability)},
         engine_{std::addressof(engine)} {}
 
  private:
@@ -112,10 +118,42 @@ struct random_intersperse_view
   [[nodiscard]] constexpr auto begin_adaptor() { return adaptor{this}; }
 
   /// Return whether we should intersperse a value or increment the input iterator.
-  [[nodiscard]] constexpr bool should_intersperse() { return distribution_(*engine_); }
+  /**
+   * Instead of evaluating a Bernoulli draw per element, the number of consecutive
+   * non-insertions is drawn from the equivalent geometric distribution and counted
+   * down, so the common no-insert path costs a single decrement and no generator
+   * call. This matters when the insertion probability is close to zero.
+   */
+  [[nodiscard]] bool should_intersperse() {
+    if (!skip_count_.has_value()) {
+      skip_count_ = generate_skip_count();
+    }
+    if (*skip_count_ > 0) {
+      --*skip_count_;
+      return false;
+    }
+    skip_count_ = generate_skip_count();
+    return true;
+  }
+
+  /// Draw the number of elements to pass through before the next insertion.
+  [[nodiscard]] std::size_t generate_skip_count() {
+    if (probability_ <= 0.0) {
+      return std::numeric_limits<std::size_t>::max();
+    }
+    if (probability_ >= 1.0) {
+      return 0;
+    }
+    const double uniform = std::uniform_real_distribution<double>{}(*engine_);
+    const double count = std::log1p(-uniform) / log_one_minus_probability_;
+    constexpr auto kMaxCount = static_cast<double>(std::numeric_limits<std::size_t>::max());
+    return count < kMaxCount ? static_cast<std::size_t>(count) : std::numeric_limits<std::size_t>::max();
+  }
 
   ranges::semiregular_box_t<Fn> fn_;
-  std::bernoulli_distribution distribution_;
+  double probability_ = 0.0;
+  double log_one_minus_probability_ = 0.0;
+  std::optional<std::size_t> skip_count_;
   URNG* engine_;
 };
 
@@ -136,12 +174,12 @@ struct random_intersperse_fn {
    * \param probability The probability of inserting a value on each iteration.
    * \param engine The random number generator object.
    */
-  template <class Range, class Fn, class URNG = typename ranges::detail::default_random_engine>
+  template <class Range, class Fn, class URNG = beluga::default_random_engine>
   constexpr auto operator()(
       Range&& range,
       Fn fn,
       double probability = kDefaultProbability,
-      URNG& engine = ranges::detail::get_random_engine()) const {
+      URNG& engine = beluga::get_default_random_engine()) const {
     // Support nullary function objects and distribution-like objects (that take a URNG).
     auto gen = [&fn, &engine]() {
       if constexpr (std::is_invocable_v<Fn>) {
@@ -172,11 +210,11 @@ struct random_intersperse_fn {
    * \param probability The probability of inserting a value on each iteration.
    * \param engine The random number generator object.
    */
-  template <class Fn, class URNG = typename ranges::detail::default_random_engine>
+  template <class Fn, class URNG = beluga::default_random_engine>
   constexpr auto operator()(
       Fn fn,
       double probability = kDefaultProbability,
-      URNG& engine = ranges::detail::get_random_engine()) const {
+      URNG& engine = beluga::get_default_random_engine()) const {
     return ranges::make_view_closure(
         ranges::bind_back(random_intersperse_fn{}, std::move(fn), probability, std::ref(engine)));
   }
@@ -0,0 +1,265 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_VIEWS_RESIDUAL_SAMPLE_HPP
+#define BELUGA_VIEWS_RESIDUAL_SAMPLE_HPP
+
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/iterator/operations.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/utility/random.hpp>
+#include <range/v3/view/common.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/repeat_n.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/view.hpp>
+
+#include <beluga/random/random_engines.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a residual sample range adaptor object.
+ */
+
+namespace beluga::views {
+
+namespace detail {
+
+/// Implementation of the residual sample view.
+/**
+ * \tparam Range A [random access](https://en.cppreference.com/w/cpp/ranges/random_access_range) and
+ *  [sized](https://en.cppreference.com/w/cpp/ranges/sized_range) range.
+ * \tparam URNG A random number generator that satisfies the
+ *  [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator)
+ *  requirements.
+ */
+template <class Range, class URNG = beluga::default_random_engine>
+struct residual_sample_view : public ranges::view_facade<residual_sample_view<Range, URNG>, ranges::finite> {
+ public:
+  /// Default constructor.
+  residual_sample_view() = default;
+
+  /// Construct the view from an existing range.
+  /**
+   * The deterministic replica counts and the residual distribution are computed once at
+   * construction time; iteration then emits floor(count · wᵢ / W) copies of each element
+   * with a tight sequential sweep, followed by randomly drawn elements covering the
+   * remainder.
+   *
+   * \param range The range to be adapted.
+   * \param weights The weights associated with each element of `range`, iterated in lockstep.
+   * \param count Number of samples the view will produce.
+   * \param engine The random number generator object.
+   */
+  template <class Weights>
+  constexpr residual_sample_view(
+      Range range,
+      Weights&& weights,
+      std::size_t count,
+      URNG& engine = beluga::get_default_random_engine())
+      : range_{std::move(range)}, count_{count}, engine_{std::addressof(engine)} {
+    assert(ranges::size(range_) > 0);
+    auto common_weights = ranges::views::common(weights);
+    const double total_weight = ranges::accumulate(common_weights, 0.0);
+    assert(total_weight > 0.0);
+    const double scale = static_cast<double>(count_) / total_weight;
+    replicas_.reserve(static_cast<std::size_t>(ranges::size(range_)));
+    residuals_.reserve(static_cast<std::size_t>(ranges::size(range_)));
+    std::size_t deterministic_total = 0;
+    for (const double weight : common_weights) {
+      const double scaled = weight * scale;
+      const auto replicas = static_cast<std::size_t>(scaled);
+      replicas_.push_back(replicas);
+      residuals_.push_back(scaled - static_cast<double>(replicas));
+      deterministic_total += replicas;
+    }
+    assert(deterministic_total <= count_);
+    residual_count_ = count_ - deterministic_total;
+    if (residual_count_ > 0) {
+      residual_distribution_ =
+          std::discrete_distribution<std::ptrdiff_t>{residuals_.begin(), residuals_.end()};
+    }
+  }
+
+ private:
+  // `ranges::range_access` needs access to the cursor members.
+  friend ranges::range_access;
+
+  static_assert(ranges::sized_range<Range>);
+  static_assert(ranges::random_access_range<Range>);
+
+  /// Cursor class that handles the iteration logic.
+  struct cursor {
+   public:
+    /// Default constructor.
+    cursor() = default;
+
+    /// Construct a cursor from the parent view elements.
+    constexpr explicit cursor(residual_sample_view* view) : view_{view}, first_{ranges::begin(view_->range_)} {
+      skip_to_next_replica();
+    }
+
+    /// Access the current element.
+    [[nodiscard]] constexpr decltype(auto) read() const { return *(first_ + offset_); }
+
+    /// Move on to the next sample.
+    constexpr void next() {
+      if (index_ < view_->replicas_.size()) {
+        if (++emitted_ < view_->replicas_[index_]) {
+          return;  // Emit another copy of the current element.
+        }
+        ++index_;
+        emitted_ = 0;
+        skip_to_next_replica();
+        return;
+      }
+      ++residual_emitted_;
+      if (residual_emitted_ < view_->residual_count_) {
+        offset_ = view_->residual_distribution_(*view_->engine_);
+      }
+    }
+
+    /// Check whether all samples have been produced.
+    [[nodiscard]] constexpr bool equal(ranges::default_sentinel_t) const {
+      return index_ == view_->replicas_.size() && residual_emitted_ == view_->residual_count_;
+    }
+
+   private:
+    /// Skip input elements with no deterministic replicas, falling through to the residual phase.
+    constexpr void skip_to_next_replica() {
+      while (index_ < view_->replicas_.size() && view_->replicas_[index_] == 0) {
+        ++index_;
+      }
+      if (index_ < view_->replicas_.size()) {
+        offset_ = static_cast<std::ptrdiff_t>(index_);
+      } else if (view_->residual_count_ > 0) {
+        offset_ = view_->residual_distribution_(*view_->engine_);
+      }
+    }
+
+    residual_sample_view* view_;
+    ranges::iterator_t<Range> first_;
+    std::ptrdiff_t offset_{0};
+    std::size_t index_{0};
+    std::size_t emitted_{0};
+    std::size_t residual_emitted_{0};
+  };
+
+  /// Return the cursor for the begin iterator.
+  [[nodiscard]] constexpr auto begin_cursor() { return cursor{this}; }
+
+  Range range_;
+  std::size_t count_{0};
+  std::size_t residual_count_{0};
+  std::vector<std::size_t> replicas_;
+  std::vector<double> residuals_;
+  std::discrete_distribution<std::ptrdiff_t> residual_distribution_;
+  URNG* engine_{nullptr};
+};
+
+/// Implementation detail for a residual sample algorithm.
+struct residual_sample_base_fn {
+ protected:
+  /// Sample from weighted ranges.
+  template <class Range, class Weights, class URNG>
+  constexpr auto sample_from_range(Range&& range, Weights&& weights, std::size_t count, URNG& engine) const {
+    static_assert(ranges::sized_range<Range>);
+    static_assert(ranges::random_access_range<Range>);
+    static_assert(ranges::input_range<Weights>);
+    return residual_sample_view<ranges::views::all_t<Range>, URNG>{
+        ranges::views::all(std::forward<Range>(range)), std::forward<Weights>(weights), count, engine};
+  }
+
+  /// Sample from any range.
+  /**
+   * If the input range is a particle range, it will extract the weights and treat it as a weighted
+   * range. The new particles will all have a weight equal to 1, since, after resampling, the
+   * probability will be represented by the number of particles rather than their individual weight.
+   *
+   * If the input range is not a particle range, it will assume a uniform distribution.
+   */
+  template <class Range, class URNG>
+  constexpr auto sample_from_range(Range&& range, std::size_t count, URNG& engine) const {
+    static_assert(ranges::sized_range<Range>);
+    static_assert(ranges::random_access_range<Range>);
+    if constexpr (beluga::is_particle_range_v<Range>) {
+      return sample_from_range(beluga::views::states(range), beluga::views::weights(range), count, engine) |
+             ranges::views::transform(beluga::make_from_state<ranges::range_value_t<Range>>);
+    } else {
+      const auto size = static_cast<std::ptrdiff_t>(ranges::size(range));
+      return sample_from_range(std::forward<Range>(range), ranges::views::repeat_n(1.0, size), count, engine);
+    }
+  }
+};
+
+/// Implementation detail for a residual sample range adaptor object.
+struct residual_sample_fn : public residual_sample_base_fn {
+  /// Overload that takes a range, a weight range, a sample count and an engine.
+  template <
+      class Range,
+      class Weights,
+      class URNG,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<ranges::range<Weights>, int> = 0>
+  constexpr auto operator()(Range&& range, Weights&& weights, std::size_t count, URNG& engine) const {
+    return sample_from_range(std::forward<Range>(range), std::forward<Weights>(weights), count, engine);
+  }
+
+  /// Overload that takes a range, a sample count and an engine.
+  template <class Range, class URNG, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, std::size_t count, URNG& engine) const {
+    return sample_from_range(std::forward<Range>(range), count, engine);
+  }
+
+  /// Overload that takes a range and a sample count, using the default engine.
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, std::size_t count) const {
+    auto& engine = beluga::get_default_random_engine();
+    return sample_from_range(std::forward<Range>(range), count, engine);
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  constexpr auto operator()(std::size_t count) const {
+    return ranges::make_view_closure(ranges::bind_back(residual_sample_fn{}, count));
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// will residually sample from an input range.
+/**
+ * This view implements residual resampling for a given range of particles: each particle
+ * is first replicated deterministically floor(count · wᵢ / W) times by a tight sequential
+ * sweep over the input, and only the remaining samples are drawn randomly from the
+ * residual weights. Most of the output is therefore produced without random draws, which
+ * is considerably cheaper and more cache-friendly than fully multinomial resampling with
+ * `beluga::views::sample` at large particle counts.
+ *
+ * Like `beluga::views::systematic_sample`, the number of output samples must be specified
+ * up front.
+ */
+inline constexpr detail::residual_sample_fn residual_sample;
+
+}  // namespace beluga::views
+
+#endif
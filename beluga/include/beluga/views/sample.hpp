@@ -21,6 +21,7 @@
 #include <range/v3/view/common.hpp>
 #include <range/v3/view/generate.hpp>
 
+#include <beluga/random/random_engines.hpp>
 #include <beluga/type_traits/particle_traits.hpp>
 #include <beluga/views/particles.hpp>
 
@@ -43,7 +44,7 @@ namespace detail {
  *  [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator)
  *  requirements.
  */
-template <class Range, class Distribution, class URNG = typename ranges::detail::default_random_engine>
+template <class Range, class Distribution, class URNG = beluga::default_random_engine>
 struct sample_view : public ranges::view_facade<sample_view<Range, Distribution, URNG>, ranges::infinite> {
  public:
   /// Default constructor.
@@ -55,7 +56,7 @@ struct sample_view : public ranges::view_facade<sample_view<Range, Distribution,
    * \param distribution The random number distribution to use to sample elements.
    * \param engine The random number generator object.
    */
-  constexpr sample_view(Range range, Distribution distribution, URNG& engine = ranges::detail::get_random_engine())
+  constexpr sample_view(Range range, Distribution distribution, URNG& engine = beluga::get_default_random_engine())
       : range_{std::move(range)}, distribution_{std::move(distribution)}, engine_{std::addressof(engine)} {
     assert(ranges::size(range) > 0);
     assert(distribution_.min() == 0);
@@ -180,7 +181,7 @@ struct sample_fn : public sample_base_fn {
   template <class T, class U>
   constexpr auto operator()(T&& t, U&& u) const {
     if constexpr (ranges::range<T> && ranges::range<U>) {
-      auto& engine = ranges::detail::get_random_engine();
+      auto& engine = beluga::get_default_random_engine();
       return sample_from_range(std::forward<T>(t), std::forward<U>(u), engine);
     } else if constexpr (is_random_distribution_v<T>) {
       static_assert(std::is_lvalue_reference_v<U&&>);  // Assume U is a URNG
@@ -196,10 +197,10 @@ struct sample_fn : public sample_base_fn {
   template <class T>
   constexpr auto operator()(T&& t) const {
     if constexpr (ranges::range<T>) {
-      auto& engine = ranges::detail::get_random_engine();
+      auto& engine = beluga::get_default_random_engine();
       return sample_from_range(std::forward<T>(t), engine);
     } else if constexpr (is_random_distribution_v<T>) {
-      auto& engine = ranges::detail::get_random_engine();
+      auto& engine = beluga::get_default_random_engine();
       return sample_from_distribution(std::forward<T>(t), engine);
     } else {
       static_assert(std::is_lvalue_reference_v<T&&>);  // Assume T is a URNG
@@ -230,6 +231,8 @@ struct sample_fn : public sample_base_fn {
  * The core idea is to draw random indices / iterators to the input particle range
  * from a [multinomial distribution](https://en.wikipedia.org/wiki/Multinomial_distribution)
  * parameterized after particle weights (and assumed uniform for non-weighted particle ranges).
+ * The weights need not be normalized: the underlying `std::discrete_distribution` divides
+ * by their sum internally, so ranges with deferred weight normalization sample correctly.
  *
  * This view can also be used to convert any random distribution (a callable that takes a URNG as an
  * input argument) into an infinite view that generates values from that distribution.
@@ -0,0 +1,240 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_VIEWS_SYSTEMATIC_SAMPLE_HPP
+#define BELUGA_VIEWS_SYSTEMATIC_SAMPLE_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <random>
+
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/iterator/operations.hpp>
+#include <range/v3/numeric/accumulate.hpp>
+#include <range/v3/utility/random.hpp>
+#include <range/v3/view/facade.hpp>
+#include <range/v3/view/common.hpp>
+#include <range/v3/view/repeat_n.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/view.hpp>
+
+#include <beluga/random/random_engines.hpp>
+#include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/views/particles.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a systematic (low-variance) sample range adaptor object.
+ */
+
+namespace beluga::views {
+
+namespace detail {
+
+/// Implementation of the systematic sample view.
+/**
+ * \tparam Range A [random access](https://en.cppreference.com/w/cpp/ranges/random_access_range) and
+ *  [sized](https://en.cppreference.com/w/cpp/ranges/sized_range) range.
+ * \tparam Weights An [input range](https://en.cppreference.com/w/cpp/ranges/input_range) of weights,
+ *  iterated in lockstep with `Range`.
+ * \tparam URNG A random number generator that satisfies the
+ *  [UniformRandomBitGenerator](https://en.cppreference.com/w/cpp/named_req/UniformRandomBitGenerator)
+ *  requirements.
+ */
+template <class Range, class Weights, class URNG = beluga::default_random_engine>
+struct systematic_sample_view
+    : public ranges::view_facade<systematic_sample_view<Range, Weights, URNG>, ranges::finite> {
+ public:
+  /// Default constructor.
+  systematic_sample_view() = default;
+
+  /// Construct the view from an existing range.
+  /**
+   * A single random offset is drawn at construction time; the `count` output elements are
+   * then taken by sweeping the cumulative weight distribution once, making the whole
+   * resampling pass O(n + count) instead of O(count log n).
+   *
+   * \param range The range to be adapted.
+   * \param weights The weights associated with each element of `range`.
+   * \param count Number of samples the view will produce.
+   * \param engine The random number generator object.
+   */
+  constexpr systematic_sample_view(
+      Range range,
+      Weights weights,
+      std::size_t count,
+      URNG& engine = beluga::get_default_random_engine())
+      : range_{std::move(range)}, weights_{std::move(weights)}, count_{count} {
+    assert(ranges::size(range_) > 0);
+    const double total_weight = ranges::accumulate(weights_ | ranges::views::common, 0.0);
+    assert(total_weight > 0.0);
+    step_ = total_weight / static_cast<double>(count_);
+    auto distribution = std::uniform_real_distribution<double>{0.0, 1.0};
+    offset_ = distribution(engine) * step_;
+  }
+
+ private:
+  // `ranges::range_access` needs access to the cursor members.
+  friend ranges::range_access;
+
+  static_assert(ranges::forward_range<Range>);
+
+  /// Cursor class that handles the iteration logic.
+  struct cursor {
+   public:
+    /// Default constructor.
+    cursor() = default;
+
+    /// Construct a cursor from the parent view elements.
+    constexpr explicit cursor(systematic_sample_view* view)
+        : view_{view},
+          it_{ranges::begin(view_->range_)},
+          weight_it_{ranges::begin(view_->weights_)},
+          cumulative_{static_cast<double>(*weight_it_)} {
+      advance_to_threshold();
+    }
+
+    /// Access the current element.
+    [[nodiscard]] constexpr decltype(auto) read() const { return *it_; }
+
+    /// Move on to the next sample.
+    constexpr void next() {
+      ++index_;
+      advance_to_threshold();
+    }
+
+    /// Check whether all samples have been produced.
+    [[nodiscard]] constexpr bool equal(ranges::default_sentinel_t) const { return index_ == view_->count_; }
+
+   private:
+    /// Advance the input iterators until the cumulative weight covers the current threshold.
+    constexpr void advance_to_threshold() {
+      if (index_ == view_->count_) {
+        return;
+      }
+      const double threshold = view_->offset_ + static_cast<double>(index_) * view_->step_;
+      auto next_it = ranges::next(it_);
+      while (cumulative_ <= threshold && next_it != ranges::end(view_->range_)) {
+        it_ = next_it;
+        ++next_it;
+        ++weight_it_;
+        cumulative_ += static_cast<double>(*weight_it_);
+      }
+    }
+
+    systematic_sample_view* view_;
+    ranges::iterator_t<Range> it_;
+    ranges::iterator_t<Weights> weight_it_;
+    double cumulative_{0.0};
+    std::size_t index_{0};
+  };
+
+  /// Return the cursor for the begin iterator.
+  [[nodiscard]] constexpr auto begin_cursor() { return cursor{this}; }
+
+  Range range_;
+  Weights weights_;
+  std::size_t count_{0};
+  double step_{0.0};
+  double offset_{0.0};
+};
+
+/// Implementation detail for a systematic sample algorithm.
+struct systematic_sample_base_fn {
+ protected:
+  /// Sample from weighted ranges.
+  template <class Range, class Weights, class URNG>
+  constexpr auto sample_from_range(Range&& range, Weights&& weights, std::size_t count, URNG& engine) const {
+    static_assert(ranges::sized_range<Range>);
+    static_assert(ranges::forward_range<Range>);
+    static_assert(ranges::input_range<Weights>);
+    return systematic_sample_view{
+        ranges::views::all(std::forward<Range>(range)), ranges::views::all(std::forward<Weights>(weights)), count,
+        engine};
+  }
+
+  /// Sample from any range.
+  /**
+   * If the input range is a particle range, it will extract the weights and treat it as a weighted
+   * range. The new particles will all have a weight equal to 1, since, after resampling, the
+   * probability will be represented by the number of particles rather than their individual weight.
+   *
+   * If the input range is not a particle range, it will assume a uniform distribution.
+   */
+  template <class Range, class URNG>
+  constexpr auto sample_from_range(Range&& range, std::size_t count, URNG& engine) const {
+    static_assert(ranges::sized_range<Range>);
+    static_assert(ranges::forward_range<Range>);
+    if constexpr (beluga::is_particle_range_v<Range>) {
+      return sample_from_range(beluga::views::states(range), beluga::views::weights(range), count, engine) |
+             ranges::views::transform(beluga::make_from_state<ranges::range_value_t<Range>>);
+    } else {
+      const auto size = static_cast<std::ptrdiff_t>(ranges::size(range));
+      return sample_from_range(std::forward<Range>(range), ranges::views::repeat_n(1.0, size), count, engine);
+    }
+  }
+};
+
+/// Implementation detail for a systematic sample range adaptor object.
+struct systematic_sample_fn : public systematic_sample_base_fn {
+  /// Overload that takes a range, a weight range, a sample count and an engine.
+  template <
+      class Range,
+      class Weights,
+      class URNG,
+      std::enable_if_t<ranges::range<Range>, int> = 0,
+      std::enable_if_t<ranges::range<Weights>, int> = 0>
+  constexpr auto operator()(Range&& range, Weights&& weights, std::size_t count, URNG& engine) const {
+    return sample_from_range(std::forward<Range>(range), std::forward<Weights>(weights), count, engine);
+  }
+
+  /// Overload that takes a range, a sample count and an engine.
+  template <class Range, class URNG, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, std::size_t count, URNG& engine) const {
+    return sample_from_range(std::forward<Range>(range), count, engine);
+  }
+
+  /// Overload that takes a range and a sample count, using the default engine.
+  template <class Range, std::enable_if_t<ranges::range<Range>, int> = 0>
+  constexpr auto operator()(Range&& range, std::size_t count) const {
+    auto& engine = beluga::get_default_random_engine();
+    return sample_from_range(std::forward<Range>(range), count, engine);
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  constexpr auto operator()(std::size_t count) const {
+    return ranges::make_view_closure(ranges::bind_back(systematic_sample_fn{}, count));
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// will systematically sample from an input range.
+/**
+ * This view implements systematic (also known as low-variance or stochastic universal)
+ * resampling for a given range of particles: a single random offset is drawn and `count`
+ * equally spaced positions along the cumulative weight distribution select the output
+ * particles. Compared to the multinomial resampling implemented by `beluga::views::sample`
+ * it needs one random draw per resampling pass instead of one per particle, runs in O(n)
+ * and introduces less sampling variance.
+ *
+ * Unlike `beluga::views::sample`, the number of output samples must be specified up front,
+ * since the spacing between positions depends on it.
+ */
+inline constexpr detail::systematic_sample_fn systematic_sample;
+
+}  // namespace beluga::views
+
+#endif
@@ -0,0 +1,176 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_VIEWS_TAKE_SPREAD_HPP
+#define BELUGA_VIEWS_TAKE_SPREAD_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+#include <range/v3/functional/bind_back.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/view/cache1.hpp>
+#include <range/v3/view/enumerate.hpp>
+#include <range/v3/view/filter.hpp>
+
+#include <beluga/views/elements.hpp>
+
+/**
+ * \file
+ * \brief Implementation of a take_spread range adaptor object.
+ */
+
+namespace beluga::views {
+
+namespace detail {
+
+/// \cond detail
+
+template <class Point, class = void>
+struct has_xy_members : std::false_type {};
+
+template <class Point>
+struct has_xy_members<Point, std::void_t<decltype(std::declval<Point>().x()), decltype(std::declval<Point>().y())>>
+    : std::true_type {};
+
+/// Euclidean distance between two point-like values.
+/**
+ * Supports types with `x()` / `y()` member functions (e.g. Eigen vectors) and
+ * tuple-like types with two elements (e.g. `std::pair<double, double>`).
+ */
+template <class Point>
+double point_distance(const Point& first, const Point& second) {
+  if constexpr (has_xy_members<Point>::value) {
+    const double dx = static_cast<double>(second.x()) - static_cast<double>(first.x());
+    const double dy = static_cast<double>(second.y()) - static_cast<double>(first.y());
+    return std::sqrt(dx * dx + dy * dy);
+  } else {
+    const double dx = static_cast<double>(std::get<0>(second)) - static_cast<double>(std::get<0>(first));
+    const double dy = static_cast<double>(std::get<1>(second)) - static_cast<double>(std::get<1>(first));
+    return std::sqrt(dx * dx + dy * dy);
+  }
+}
+
+/// \endcond
+
+/// Implementation detail for a take_spread range adaptor object.
+struct take_spread_fn {  // NOLINT(readability-identifier-naming)
+  /// Overload that implements the take_spread algorithm.
+  /**
+   * \tparam Range A [forward range](https://en.cppreference.com/w/cpp/ranges/forward_range) of 2D points
+   *  that is also a [sized range](https://en.cppreference.com/w/cpp/ranges/sized_range).
+   * \param range Source range from where to take elements.
+   * \param count Number of elements to take.
+   *
+   * Elements are selected evenly spaced along the cumulative point-to-point path length
+   * rather than by index, so dense clusters of nearly coincident points are thinned
+   * aggressively while isolated points in sparse regions are kept. The source range is
+   * traversed once eagerly to measure the spatial density before the view is returned.
+   *
+   * If `count` or the range size are zero, it returns an empty range.
+   * If `count` is greater than the range size, it returns all the elements.
+   * The first and last elements of the range are always included.
+   * If all points are coincident, the selection degrades to even index spacing.
+   */
+  template <class Range>
+  auto operator()(Range&& range, std::size_t count) const {
+    static_assert(ranges::forward_range<Range>);
+    static_assert(ranges::sized_range<Range>);
+    const std::size_t size = ranges::size(range);
+
+    auto mask = std::vector<bool>(size, false);
+    if (size > 0UL && count > 0UL) {
+      if (count >= size || count == 1UL || size == 1UL) {
+        std::fill(mask.begin(), mask.end(), count >= size);
+        mask.front() = true;
+      } else {
+        // Single eager pass: accumulate the path length and mark an element whenever
+        // the cumulative distance crosses into the next of `count - 1` length buckets.
+        // This is the distance-domain analog of beluga::views::take_evenly.
+        double path_length = 0.0;
+        auto it = ranges::begin(range);
+        auto previous = it;
+        mask.front() = true;
+        auto lengths = std::vector<double>(size, 0.0);
+        for (std::size_t index = 1UL; index < size; ++index) {
+          ++it;
+          path_length += point_distance(*previous, *it);
+          lengths[index] = path_length;
+          previous = it;
+        }
+        if (path_length > 0.0) {
+          const double bucket = path_length / static_cast<double>(count - 1UL);
+          for (std::size_t index = 1UL; index + 1UL < size; ++index) {
+            const auto m0 = static_cast<std::size_t>(lengths[index - 1UL] / bucket);
+            const auto m1 = static_cast<std::size_t>(lengths[index] / bucket);
+            mask[index] = m0 != m1;
+          }
+        } else {
+          // All points are coincident, fall back to even index spacing.
+          for (std::size_t index = 1UL; index + 1UL < size; ++index) {
+            const std::size_t m0 = (index - 1UL) * (count - 1UL) / (size - 1UL);
+            const std::size_t m1 = index * (count - 1UL) / (size - 1UL);
+            mask[index] = m0 != m1;
+          }
+        }
+        mask.back() = true;
+      }
+    }
+
+    const auto filter_function = [mask = std::move(mask)](const auto& pair) {
+      const auto [index, _] = pair;
+      return mask[static_cast<std::size_t>(index)];
+    };
+
+    // `cache1` ensures that views prior to `filter` in the pipeline are iterated exactly once.
+    // This is needed because filter needs to dereference the input iterator twice.
+    return ranges::views::enumerate(std::forward<Range>(range)) | ranges::views::cache1 |
+           ranges::views::filter(filter_function) | beluga::views::elements<1>;
+  }
+
+  /// Overload that returns a view closure to compose with other views.
+  /**
+   * \param count Number of elements to take.
+   */
+  constexpr auto operator()(std::size_t count) const {
+    return ranges::make_view_closure(ranges::bind_back(take_spread_fn{}, count));
+  }
+};
+
+}  // namespace detail
+
+/// [Range adaptor object](https://en.cppreference.com/w/cpp/named_req/RangeAdaptorObject) that
+/// will take elements spaced evenly over the spatial extent of a range of 2D points.
+/**
+ * Given a source range of points and an integral count, returns a range consisting of
+ * `count` points selected to maximize spatial spread: selections are evenly spaced along
+ * the cumulative point-to-point path length instead of by index. Compared to
+ * `beluga::views::take_evenly`, this thins redundant points in dense angular clusters of
+ * a laser scan and preserves isolated points in sparse, informative regions, allowing a
+ * smaller measurement budget for the same localization accuracy.
+ *
+ * If `count` or the range size are zero, it returns an empty range.
+ * If `count` is greater than the range size, it returns all the elements.
+ * The first and last elements of the range are always included.
+ */
+inline constexpr detail::take_spread_fn take_spread;  // NOLINT(readability-identifier-naming)
+
+}  // namespace beluga::views
+
+#endif
@@ -15,13 +15,19 @@
 #ifndef BELUGA_VIEWS_TAKE_WHILE_KLD_HPP
 #define BELUGA_VIEWS_TAKE_WHILE_KLD_HPP
 
+#include <array>
 #include <cmath>
-#include <unordered_set>
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <vector>
 
 #include <range/v3/view/take.hpp>
 #include <range/v3/view/take_while.hpp>
 
+#include <beluga/containers/flat_hash_set.hpp>
 #include <beluga/type_traits/particle_traits.hpp>
+#include <beluga/utility/tracepoint.hpp>
 
 /**
  * \file
@@ -35,8 +41,57 @@ namespace detail {
 /// Default upper standard normal quantile, P = 0.999
 constexpr double kDefaultKldZ = 3.;
 
+/// Default number of precomputed chi-square bound entries, see beluga::kld_condition().
+constexpr std::size_t kDefaultKldTableSize = 4096;
+
 }  // namespace detail
 
+/// Bucket occupancy telemetry of a single KLD-bounded take.
+/**
+ * Filled in by the condition returned by beluga::kld_condition() as it runs, at the cost
+ * of a couple of scalar updates per sample. Useful to audit the spatial hash resolution
+ * driving the take: a too-coarse resolution collapses the samples into a handful of
+ * buckets and every take terminates at the minimum, while a too-fine one keeps opening
+ * buckets and pushes every take to the maximum
+ * (see beluga::suggest_spatial_hash_resolution()).
+ */
+struct KldBucketStatistics {
+  /// Length of the bucket growth trajectory; covers every reachable bucket count.
+  static constexpr std::size_t kTrajectoryLength = std::numeric_limits<std::size_t>::digits;
+
+  /// Number of samples taken.
+  std::size_t samples = 0;
+  /// Number of distinct buckets (spatial hashes) the samples fell into.
+  std::size_t buckets = 0;
+  /// Sample count at which the bucket count first reached each power of two.
+  /**
+   * `bucket_growth_samples[i]` is the number of samples that had been taken when the
+   * `2^i`-th distinct bucket appeared, or zero if the take never got that far. The tail
+   * of this trajectory tells whether the take terminated because new samples stopped
+   * discovering new buckets (resolution and particle spread in agreement), or while
+   * buckets were still opening at close to one per sample (under-resolved take).
+   */
+  std::array<std::size_t, kTrajectoryLength> bucket_growth_samples = {};
+
+  /// Returns the average number of samples per occupied bucket.
+  [[nodiscard]] double average_occupancy() const noexcept {
+    return buckets > 0 ? static_cast<double>(samples) / static_cast<double>(buckets) : 0.0;
+  }
+
+  /// Returns the expected number of hash collisions among the occupied buckets.
+  /**
+   * Birthday-bound estimate assuming uniformly distributed hashes over the full
+   * `std::size_t` range, which the fibonacci hashing scheme approximates (counting
+   * actual collisions would require keeping the cell coordinates next to the hashes).
+   * A value anywhere near one means distinct cells are being conflated and the KLD
+   * bound is operating on an undercounted bucket total.
+   */
+  [[nodiscard]] double expected_hash_collisions() const noexcept {
+    const auto k = static_cast<double>(buckets);
+    return std::ldexp(k * (k - 1.) / 2., -std::numeric_limits<std::size_t>::digits);
+  }
+};
+
 /// Returns a callable object that verifies if the KLD condition is being satisfied.
 /**
  * The callable object will compute the minimum number of samples based on a Kullback-Leibler
@@ -61,6 +116,12 @@ constexpr double kDefaultKldZ = 3.;
  *  distrubution.
  * \param z Upper standard normal quantile for the probability that the error in the
  *  estimated distribution is less than epsilon.
+ * \param table_size Number of bucket counts for which the chi-square bound is precomputed
+ *  up front; larger counts fall back to evaluating the bound on the fly.
+ * \param resource Memory resource backing the bound table and the bucket set, so both
+ *  can be carved out of a per-cycle scratch arena. Defaults to the default resource.
+ * \param statistics Optional bucket occupancy telemetry, reset and then filled in as
+ *  the condition runs. See beluga::KldBucketStatistics.
  * \return A callable object with prototype `(std::size_t hash) -> bool`.
  *  `hash` is the spatial hash of the particle being added. \n
  *  The returned callable object is stateful, tracking the total number of particles and
@@ -69,7 +130,13 @@ constexpr double kDefaultKldZ = 3.;
  *  and the KLD condition is satisfied, if not it will be true. \n
  *  i.e. A return value of true means that you need to keep sampling to satisfy the condition.
  */
-inline auto kld_condition(std::size_t min, double epsilon, double z = beluga::detail::kDefaultKldZ) {
+inline auto kld_condition(
+    std::size_t min,
+    double epsilon,
+    double z = beluga::detail::kDefaultKldZ,
+    std::size_t table_size = beluga::detail::kDefaultKldTableSize,
+    std::pmr::memory_resource* resource = nullptr,
+    KldBucketStatistics* statistics = nullptr) {
   auto target_size = [two_epsilon = 2 * epsilon, z](std::size_t k) {
     if (k <= 2U) {
       return std::numeric_limits<std::size_t>::max();
@@ -80,10 +147,53 @@ inline auto kld_condition(std::size_t min, double epsilon, double z = beluga::de
     return static_cast<std::size_t>(std::ceil(result));
   };
 
-  return [=, count = 0ULL, buckets = std::unordered_set<std::size_t>{}](std::size_t hash) mutable {
+  if (resource == nullptr) {
+    resource = std::pmr::get_default_resource();
+  }
+
+  // The Wilson-Hilferty bound is precomputed for every bucket count up to the requested
+  // table size, turning the per-new-bucket math into an array load. The bucket count is
+  // bounded by the number of samples taken, so passing that maximum covers all lookups.
+  auto table = std::pmr::vector<std::size_t>{resource};
+  table.reserve(table_size + 1);
+  for (std::size_t k = 0; k <= table_size; ++k) {
+    table.push_back(target_size(k));
+  }
+
+  if (statistics != nullptr) {
+    *statistics = KldBucketStatistics{};  // Telemetry describes a single take.
+  }
+
+  // A flat open-addressing set preallocated to the minimum sample count avoids
+  // per-insert node allocations, which dominate this condition in profiles.
+  using bucket_set = beluga::FlatHashSet<std::size_t, std::pmr::polymorphic_allocator<std::size_t>>;
+  return [=, table = std::move(table), count = 0ULL,
+          buckets = bucket_set{min, std::pmr::polymorphic_allocator<std::size_t>{resource}}](std::size_t hash) mutable {
     count++;
     buckets.insert(hash);
-    return count <= min || count <= target_size(buckets.size());
+    const std::size_t k = buckets.size();
+    if (statistics != nullptr) {
+      statistics->samples = count;
+      if (k > statistics->buckets) {
+        statistics->buckets = k;
+        if ((k & (k - 1)) == 0) {
+          // The bucket count just reached a power of two; log where in the take.
+          std::size_t order = 0;
+          while ((std::size_t{1} << order) < k) {
+            ++order;
+          }
+          statistics->bucket_growth_samples[order] = count;
+        }
+      }
+    }
+    const bool keep_sampling = count <= min || count <= (k < table.size() ? table[k] : target_size(k));
+    if (!keep_sampling) {
+      // The take terminates here; the sample count and bucket count tell a tracing
+      // session how many particles the KLD criterion settled on and over how many
+      // occupied buckets, without the filter having to report them after the fact.
+      BELUGA_TRACEPOINT2(kld_condition_met, count, k);
+    }
+    return keep_sampling;
   };
 }
 
@@ -103,6 +213,10 @@ struct take_while_kld_fn {
    * \param max Maximum samples to take.
    * \param epsilon See beluga::kld_condition() for details.
    * \param z See beluga::kld_condition() for details.
+   * \param resource Memory resource backing the per-take scratch storage, see
+   * beluga::kld_condition() for details.
+   * \param statistics Optional bucket occupancy telemetry of the take, see
+   * beluga::kld_condition() for details.
    *
    * The hasher will be called with range elements by default. If that is not possible,
    * it will assume that the range contains particles and invoke the hasher with the
@@ -115,11 +229,20 @@ struct take_while_kld_fn {
       std::size_t min,
       std::size_t max,
       double epsilon,
-      double z = beluga::detail::kDefaultKldZ) const {
+      double z = beluga::detail::kDefaultKldZ,
+      std::pmr::memory_resource* resource = nullptr,
+      KldBucketStatistics* statistics = nullptr) const {
     static_assert(ranges::input_range<Range>);
 
     auto proj = [&hasher]() {
-      if constexpr (std::is_invocable_r_v<std::size_t, Hasher, ranges::range_value_t<Range>>) {
+      if constexpr (has_cluster_v<ranges::range_value_t<Range>>) {
+        // Particles carrying a precomputed spatial hash (see `beluga::cluster`) are
+        // bucketed by that column directly instead of re-deriving the hash from the
+        // state. The pipeline that updates the states is responsible for keeping the
+        // column coherent (e.g. the hasher overload of `beluga::actions::propagate`).
+        (void)hasher;
+        return [](const auto& particle) { return static_cast<std::size_t>(beluga::cluster(particle)); };
+      } else if constexpr (std::is_invocable_r_v<std::size_t, Hasher, ranges::range_value_t<Range>>) {
         // Try to invoke the hasher with the range values by default.
         return std::move(hasher);
       } else {
@@ -131,8 +254,11 @@ struct take_while_kld_fn {
       }
     }();
 
-    return ranges::views::all(std::forward<Range>(range)) |                                      //
-           ranges::views::take_while(beluga::kld_condition(min, epsilon, z), std::move(proj)) |  //
+    // Sizing the chi-square bound table to the maximum sample count makes every
+    // lookup during the take an array load.
+    return ranges::views::all(std::forward<Range>(range)) |  //
+           ranges::views::take_while(
+               beluga::kld_condition(min, epsilon, z, max, resource, statistics), std::move(proj)) |  //
            ranges::views::take(max);
   }
 
@@ -144,6 +270,10 @@ struct take_while_kld_fn {
    * \param max Maximum samples to take.
    * \param epsilon See beluga::kld_condition() for details.
    * \param z See beluga::kld_condition() for details.
+   * \param resource Memory resource backing the per-take scratch storage, see
+   * beluga::kld_condition() for details.
+   * \param statistics Optional bucket occupancy telemetry of the take, see
+   * beluga::kld_condition() for details.
    */
   template <class Hasher>
   constexpr auto operator()(
@@ -151,8 +281,11 @@ struct take_while_kld_fn {
       std::size_t min,
       std::size_t max,
       double epsilon,
-      double z = beluga::detail::kDefaultKldZ) const {
-    return ranges::make_view_closure(ranges::bind_back(take_while_kld_fn{}, std::move(hasher), min, max, epsilon, z));
+      double z = beluga::detail::kDefaultKldZ,
+      std::pmr::memory_resource* resource = nullptr,
+      KldBucketStatistics* statistics = nullptr) const {
+    return ranges::make_view_closure(
+        ranges::bind_back(take_while_kld_fn{}, std::move(hasher), min, max, epsilon, z, resource, statistics));
   }
 };
 
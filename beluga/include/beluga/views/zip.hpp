@@ -17,6 +17,7 @@
 
 #include <tuple>
 
+#include <range/v3/range/concepts.hpp>
 #include <range/v3/view/zip.hpp>
 
 /**
@@ -60,7 +61,18 @@ struct zip_fn {
   /// Overload that implements the zip_view algorithm.
   template <class... Ranges>
   constexpr auto operator()(Ranges&&... ranges) const {
-    return ranges::views::iter_zip_with(as_common_tuple_indirect_fn{}, std::forward<Ranges>(ranges)...);
+    auto view = ranges::views::iter_zip_with(as_common_tuple_indirect_fn{}, std::forward<Ranges>(ranges)...);
+    // Parallel algorithms partition work by iterator arithmetic, so the zipped view must
+    // not weaken the traversal or size guarantees of its inputs. These assertions keep
+    // the cursor conformant if the underlying view implementation ever changes.
+    if constexpr ((ranges::sized_range<Ranges> && ...)) {
+      static_assert(ranges::sized_range<decltype(view)>);
+    }
+    if constexpr ((ranges::random_access_range<Ranges> && ...)) {
+      static_assert(ranges::random_access_range<decltype(view)>);
+      static_assert(ranges::sized_sentinel_for<ranges::iterator_t<decltype(view)>, ranges::iterator_t<decltype(view)>>);
+    }
+    return view;
   }
 };
 
@@ -26,6 +26,7 @@
 #include <range/v3/view/indirect.hpp>
 #include <range/v3/view/move.hpp>
 #include <range/v3/view/reverse.hpp>
+#include <range/v3/view/take.hpp>
 #include <range/v3/view/transform.hpp>
 
 namespace {
@@ -87,4 +88,14 @@ TEST(AssignAction, List) {
   ASSERT_TRUE(ranges::equal(input, std::list{3, 1}));
 }
 
+TEST(AssignAction, RetainsCapacity) {
+  auto input = std::vector{1, 2, 3, 4, 5, 6, 7, 8};
+  const auto high_water_capacity = input.capacity();
+  input |= ranges::views::take(2) | beluga::actions::assign;
+  ASSERT_TRUE(ranges::equal(input, std::vector{1, 2}));
+  ASSERT_GE(input.capacity(), high_water_capacity);
+  input.shrink_to_fit();
+  ASSERT_LT(input.capacity(), high_water_capacity);
+}
+
 }  // namespace
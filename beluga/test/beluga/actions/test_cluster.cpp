@@ -0,0 +1,95 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <execution>
+#include <tuple>
+#include <vector>
+
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/actions/cluster.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+constexpr std::array<double, 3> kResolution = {1.0, 1.0, 1.0};
+
+Sophus::SE2d make_pose(double x, double y) {
+  return Sophus::SE2d{Sophus::SO2d{0.0}, Eigen::Vector2d{x, y}};
+}
+
+TEST(ClusterAction, AssignsDenseIdsInFirstSeenOrder) {
+  auto input = std::vector{
+      std::make_tuple(make_pose(0.5, 0.5), beluga::Weight(1.0), beluga::Cluster(42)),
+      std::make_tuple(make_pose(10.5, 10.5), beluga::Weight(1.0), beluga::Cluster(42)),
+      std::make_tuple(make_pose(0.5, 0.5), beluga::Weight(1.0), beluga::Cluster(42))};
+  input |= beluga::actions::cluster(kResolution);
+  ASSERT_EQ(std::get<beluga::Cluster>(input[0]), 0UL);
+  ASSERT_EQ(std::get<beluga::Cluster>(input[1]), 1UL);
+  ASSERT_EQ(std::get<beluga::Cluster>(input[2]), 0UL);
+}
+
+TEST(ClusterAction, MergesAdjacentCells) {
+  auto input = std::vector{
+      std::make_tuple(make_pose(0.5, 0.5), beluga::Weight(1.0), beluga::Cluster(0)),
+      std::make_tuple(make_pose(1.5, 0.5), beluga::Weight(1.0), beluga::Cluster(0)),   // adjacent in x
+      std::make_tuple(make_pose(2.5, 1.5), beluga::Weight(1.0), beluga::Cluster(0)),   // diagonal neighbor
+      std::make_tuple(make_pose(10.5, 0.5), beluga::Weight(1.0), beluga::Cluster(0))};  // isolated
+  input |= beluga::actions::cluster(kResolution);
+  ASSERT_EQ(std::get<beluga::Cluster>(input[0]), std::get<beluga::Cluster>(input[1]));
+  ASSERT_EQ(std::get<beluga::Cluster>(input[1]), std::get<beluga::Cluster>(input[2]));
+  ASSERT_NE(std::get<beluga::Cluster>(input[0]), std::get<beluga::Cluster>(input[3]));
+}
+
+TEST(ClusterAction, SeparatesDistinctRotations) {
+  const auto translation = Eigen::Vector2d{0.5, 0.5};
+  auto input = std::vector{
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{0.5}, translation}, beluga::Weight(1.0), beluga::Cluster(0)),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{-2.5}, translation}, beluga::Weight(1.0), beluga::Cluster(0))};
+  input |= beluga::actions::cluster(kResolution);
+  ASSERT_NE(std::get<beluga::Cluster>(input[0]), std::get<beluga::Cluster>(input[1]));
+}
+
+TEST(ClusterAction, SequencedExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(make_pose(0.5, 0.5), beluga::Weight(1.0), beluga::Cluster(42))};
+  input |= beluga::actions::cluster(std::execution::seq, kResolution);
+  ASSERT_EQ(std::get<beluga::Cluster>(input.front()), 0UL);
+}
+
+TEST(ClusterAction, ParallelExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(make_pose(0.5, 0.5), beluga::Weight(1.0), beluga::Cluster(42))};
+  input |= beluga::actions::cluster(std::execution::par, kResolution);
+  ASSERT_EQ(std::get<beluga::Cluster>(input.front()), 0UL);
+}
+
+TEST(ClusterAction, StructureOfArrays) {
+  auto input = beluga::TupleVector<std::tuple<Sophus::SE2d, beluga::Weight, beluga::Cluster>>{
+      std::make_tuple(make_pose(0.5, 0.5), beluga::Weight(1.0), beluga::Cluster(42)),
+      std::make_tuple(make_pose(1.5, 0.5), beluga::Weight(1.0), beluga::Cluster(42)),
+      std::make_tuple(make_pose(10.5, 10.5), beluga::Weight(1.0), beluga::Cluster(42))};
+  input |= beluga::actions::cluster(kResolution);
+  const auto clusters = input.span<2>();
+  ASSERT_EQ(clusters[0], 0UL);
+  ASSERT_EQ(clusters[1], 0UL);
+  ASSERT_EQ(clusters[2], 1UL);
+}
+
+}  // namespace
@@ -0,0 +1,70 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+
+#include "beluga/actions/discard_below.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+TEST(DiscardBelowAction, DiscardsAndRenormalizes) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(0.5)),
+      std::make_tuple(2, beluga::Weight(0.001)),
+      std::make_tuple(3, beluga::Weight(0.3)),
+      std::make_tuple(4, beluga::Weight(0.199)),
+  };
+  input |= beluga::actions::discard_below(0.01);
+  // Survivors keep their relative order and their weights sum back to one.
+  auto states = input | beluga::views::states | ranges::to<std::vector>;
+  ASSERT_THAT(states, testing::ElementsAre(1, 3, 4));
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_NEAR(weights[0], 0.5 / 0.999, 1e-12);
+  ASSERT_NEAR(weights[1], 0.3 / 0.999, 1e-12);
+  ASSERT_NEAR(weights[2], 0.199 / 0.999, 1e-12);
+}
+
+TEST(DiscardBelowAction, CompactsTupleContainersInPlace) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::Weight>>{
+      std::make_tuple(1, beluga::Weight(0.9)),
+      std::make_tuple(2, beluga::Weight(0.0)),
+      std::make_tuple(3, beluga::Weight(0.1)),
+  };
+  input |= beluga::actions::discard_below(0.05);
+  ASSERT_EQ(input.size(), 2UL);
+  auto states = input | beluga::views::states | ranges::to<std::vector>;
+  ASSERT_THAT(states, testing::ElementsAre(1, 3));
+}
+
+TEST(DiscardBelowAction, DegenerateSetIsLeftUntouched) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(0.001)),
+      std::make_tuple(2, beluga::Weight(0.002)),
+  };
+  input |= beluga::actions::discard_below(0.01);
+  // Emptying the filter would be worse than resampling from a degenerate set.
+  ASSERT_EQ(input.size(), 2UL);
+  ASSERT_DOUBLE_EQ(beluga::weight(input.front()), 0.001);
+}
+
+}  // namespace
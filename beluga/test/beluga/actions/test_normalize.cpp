@@ -16,11 +16,16 @@
 
 #include <cmath>
 #include <execution>
+#include <functional>
 #include <tuple>
 #include <vector>
 
+#include <sophus/se2.hpp>
+
 #include "beluga/actions/normalize.hpp"
+#include "beluga/algorithm/estimation.hpp"
 #include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
 
 namespace {
 
@@ -81,6 +86,15 @@ TEST(NormalizeAction, MultipleElements) {
   ASSERT_EQ(input[2], 3.0);
 }
 
+TEST(NormalizeAction, FloatWeights) {
+  auto input = std::vector{
+      std::make_tuple(5, beluga::WeightF(1.0F)),  //
+      std::make_tuple(8, beluga::WeightF(3.0F))};
+  input |= beluga::actions::normalize;
+  ASSERT_FLOAT_EQ(beluga::weight(input[0]), 0.25F);
+  ASSERT_FLOAT_EQ(beluga::weight(input[1]), 0.75F);
+}
+
 TEST(NormalizeAction, ZeroFactor) {
   auto input = std::vector{std::make_tuple(5, beluga::Weight(4.0))};
   input |= beluga::actions::normalize(0.0);
@@ -93,4 +107,20 @@ TEST(NormalizeAction, NegativeFactor) {
   ASSERT_EQ(input.front(), std::make_tuple(5, beluga::Weight(-2.0)));
 }
 
+TEST(NormalizeAction, RecordsEstimateStatistics) {
+  auto input = std::vector{
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{0.1}, Sophus::Vector2d{1.0, 2.0}}, beluga::Weight(4.0)),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{0.3}, Sophus::Vector2d{3.0, -1.0}}, beluga::Weight(2.0)),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{-0.2}, Sophus::Vector2d{2.0, 0.5}}, beluga::Weight(6.0))};
+  auto statistics = beluga::SE2EstimateStatistics<double>{};
+  input |= beluga::actions::normalize(std::ref(statistics));
+  // The weights are normalized and the statistics yield the same estimate as a dedicated pass.
+  ASSERT_EQ(beluga::weight(input.front()), 4.0 / 12.0);
+  const auto [expected_pose, expected_covariance] =
+      beluga::estimate(beluga::views::states(input), beluga::views::weights(input));
+  const auto [pose, covariance] = beluga::estimate(statistics);
+  ASSERT_TRUE(pose.matrix().isApprox(expected_pose.matrix()));
+  ASSERT_TRUE(covariance.isApprox(expected_covariance));
+}
+
 }  // namespace
@@ -17,14 +17,22 @@
 
 #include <execution>
 #include <functional>
+#include <random>
+#include <set>
 #include <tuple>
 #include <vector>
 
+#include <Eigen/Core>
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/take_exactly.hpp>
 
 #include "beluga/actions/assign.hpp"
 #include "beluga/actions/propagate.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/motion/differential_drive_model.hpp"
 #include "beluga/primitives.hpp"
 #include "beluga/views/particles.hpp"
 #include "beluga/views/sample.hpp"
@@ -49,6 +57,69 @@ TEST(PropagateAction, ParallelExecutionPolicy) {
   ASSERT_EQ(input.front(), std::make_tuple(6, 1.0));
 }
 
+TEST(PropagateAction, ParallelUnsequencedExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(1.0))};
+  input |= beluga::actions::propagate(std::execution::par_unseq, [](int value) { return ++value; });
+  ASSERT_EQ(input.front(), std::make_tuple(6, 1.0));
+}
+
+TEST(PropagateAction, RefreshesClusterColumn) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(1.0), beluga::Cluster(0))};
+  const auto hasher = [](int value) { return static_cast<std::size_t>(value * 10); };
+  input |= beluga::actions::propagate([](int value) { return ++value; }, hasher);
+  ASSERT_EQ(std::get<0>(input.front()), 6);
+  ASSERT_EQ(beluga::cluster(input.front()), 60UL);  // Hash of the propagated state, not the original.
+}
+
+TEST(PropagateAction, RefreshesClusterColumnWithPolicy) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(1.0), beluga::Cluster(0))};
+  const auto hasher = [](int value) { return static_cast<std::size_t>(value * 10); };
+  input |= beluga::actions::propagate(std::execution::par, [](int value) { return ++value; }, hasher);
+  ASSERT_EQ(std::get<0>(input.front()), 6);
+  ASSERT_EQ(beluga::cluster(input.front()), 60UL);
+}
+
+TEST(PropagateAction, ParallelUnsequencedStridedRandomStreams) {
+  auto input = std::vector<std::tuple<int, beluga::Weight>>(100, std::make_tuple(0, beluga::Weight(1.0)));
+  input |= beluga::actions::propagate(  //
+      std::execution::par_unseq,        //
+      [](int, auto& engine) { return std::uniform_int_distribution<int>{0, 1'000'000}(engine); });
+  // Each element samples from its own stream; draws must not be all identical.
+  auto states = input | beluga::views::states | ranges::to<std::vector>;
+  ASSERT_GT(std::set<int>(states.begin(), states.end()).size(), 1);
+}
+
+TEST(PropagateAction, ParallelSamplingIsReproducible) {
+  const auto run = [] {
+    beluga::get_default_random_engine().seed(42);
+    auto input = std::vector<std::tuple<int, beluga::Weight>>(100, std::make_tuple(0, beluga::Weight(1.0)));
+    input |= beluga::actions::propagate(  //
+        std::execution::par,              //
+        [](int, auto& engine) { return std::uniform_int_distribution<int>{0, 1'000'000}(engine); });
+    return input | beluga::views::states | ranges::to<std::vector>;
+  };
+  // Per-particle counter-based streams make parallel draws independent of the
+  // thread partitioning, so two identically seeded runs must match exactly.
+  ASSERT_EQ(run(), run());
+}
+
+TEST(PropagateAction, BatchCapableModelOverContiguousStates) {
+  // A sampling function with a span overload propagates the contiguous state
+  // column of a tuple container in one batch call under the sequenced policy.
+  auto input = beluga::TupleVector<std::tuple<Sophus::SE2d, beluga::Weight>>{
+      std::make_tuple(Sophus::SE2d{}, beluga::Weight(1.0)),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{1.0, 2.0}}, beluga::Weight(1.0)),
+  };
+  const auto model = beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{0.0, 0.0, 0.0, 0.0}};
+  const auto action = std::make_tuple(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{1.0, 0.0}}, Sophus::SE2d{});
+  input |= beluga::actions::propagate(std::execution::seq, model(action));
+  auto states = input | beluga::views::states | ranges::to<std::vector>;
+  // Without noise, every pose advances one meter along its heading.
+  ASSERT_NEAR(states[0].translation().x(), 1.0, 1e-9);
+  ASSERT_NEAR(states[1].translation().x(), 2.0, 1e-9);
+  ASSERT_NEAR(states[1].translation().y(), 2.0, 1e-9);
+}
+
 TEST(PropagateAction, Composition) {
   auto input = std::vector{std::make_tuple(5, beluga::Weight(1.0))};
   input |= beluga::actions::propagate([](int value) { return --value; }) |  //
@@ -15,6 +15,7 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <execution>
 #include <functional>
 #include <tuple>
@@ -22,14 +23,30 @@
 
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/intersperse.hpp>
+#include <range/v3/view/span.hpp>
 
 #include "beluga/actions/assign.hpp"
 #include "beluga/actions/reweight.hpp"
+#include "beluga/containers/tuple_vector.hpp"
 #include "beluga/primitives.hpp"
 #include "beluga/views/particles.hpp"
 
 namespace {
 
+struct BatchCapableModel {
+  double operator()(int value) const { return static_cast<double>(value); }
+
+  template <class Weight>
+  void operator()(ranges::span<const int> states, ranges::span<Weight> weights) const {
+    ++*batch_calls;
+    for (std::ptrdiff_t index = 0; index < states.size(); ++index) {
+      weights[index] = weights[index] * static_cast<double>(states[index]);
+    }
+  }
+
+  int* batch_calls;
+};
+
 TEST(ReweightAction, DefaultExecutionPolicy) {
   auto input = std::vector{std::make_tuple(5, beluga::Weight(2.0))};
   input |= beluga::actions::reweight([](int value) { return value; });
@@ -48,6 +65,12 @@ TEST(ReweightAction, ParallelExecutionPolicy) {
   ASSERT_EQ(input.front(), std::make_tuple(5, 10.0));
 }
 
+TEST(ReweightAction, ParallelUnsequencedExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(2.0))};
+  input |= beluga::actions::reweight(std::execution::par_unseq, [](int value) { return value; });
+  ASSERT_EQ(input.front(), std::make_tuple(5, 10.0));
+}
+
 TEST(ReweightAction, Composition) {
   auto input = std::vector{std::make_tuple(4, beluga::Weight(0.5)), std::make_tuple(4, beluga::Weight(1.0))};
   input |= beluga::actions::reweight([](int value) { return value; }) |           //
@@ -57,6 +80,26 @@ TEST(ReweightAction, Composition) {
   ASSERT_THAT(weights, testing::ElementsAre(2, 1, 4));
 }
 
+TEST(ReweightAction, BatchModelOverColumnStorage) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::Weight>>{};
+  for (int i = 0; i < 100; ++i) {
+    input.push_back(std::make_tuple(2, beluga::Weight(1.5)));
+  }
+  int batch_calls = 0;
+  input |= beluga::actions::reweight(BatchCapableModel{&batch_calls});
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::Each(3.0));
+  ASSERT_GE(batch_calls, 1);
+}
+
+TEST(ReweightAction, BatchModelFallsBackWithoutColumnStorage) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(2.0))};
+  int batch_calls = 0;
+  input |= beluga::actions::reweight(BatchCapableModel{&batch_calls});
+  ASSERT_EQ(input.front(), std::make_tuple(5, 10.0));
+  ASSERT_EQ(batch_calls, 0);
+}
+
 TEST(ReweightAction, StatefulModel) {
   auto input = std::vector{std::make_tuple(4, beluga::Weight(0.5)), std::make_tuple(4, beluga::Weight(1.0))};
   auto model = [value = 0](int) mutable { return value++; };
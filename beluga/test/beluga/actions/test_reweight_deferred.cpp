@@ -0,0 +1,94 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <execution>
+#include <functional>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+#include <sophus/se2.hpp>
+
+#include "beluga/actions/reweight_deferred.hpp"
+#include "beluga/actions/reweight_normalized.hpp"
+#include "beluga/algorithm/estimation.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+TEST(ReweightDeferredAction, LeavesWeightsUnnormalized) {
+  auto input = std::vector{
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{}, Sophus::Vector2d{1.0, 0.0}}, beluga::Weight(1.0)),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{}, Sophus::Vector2d{3.0, 0.0}}, beluga::Weight(1.0))};
+  auto statistics = beluga::WeightStatistics{};
+  auto estimate_statistics = beluga::SE2EstimateStatistics<double>{};
+  input |= beluga::actions::reweight_deferred(
+      [](const Sophus::SE2d& state) { return state.translation().x(); }, 1.0, std::ref(statistics),
+      std::ref(estimate_statistics));
+  // The raw products are left in place; no normalization sweep runs.
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(1.0, 3.0));
+  EXPECT_EQ(statistics.sum, 4.0);
+  EXPECT_EQ(statistics.count, 2);
+}
+
+TEST(ReweightDeferredAction, MatchesEagerStatistics) {
+  constexpr double kScale = 2.0;
+  auto eager = std::vector{
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{0.1}, Sophus::Vector2d{1.0, 2.0}}, beluga::Weight(0.25)),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{0.3}, Sophus::Vector2d{3.0, -1.0}}, beluga::Weight(0.5)),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{-0.2}, Sophus::Vector2d{2.0, 0.5}}, beluga::Weight(0.25))};
+  // A deferred pipeline holding the same set carries the pending scale in its weights.
+  auto deferred = eager;
+  for (auto&& weight : deferred | beluga::views::weights) {
+    weight = weight * kScale;
+  }
+
+  const auto model = [](const Sophus::SE2d& state) { return state.translation().x(); };
+  auto eager_statistics = beluga::WeightStatistics{};
+  auto eager_estimate_statistics = beluga::SE2EstimateStatistics<double>{};
+  eager |= beluga::actions::reweight_normalized(model, std::ref(eager_statistics), std::ref(eager_estimate_statistics));
+  auto statistics = beluga::WeightStatistics{};
+  auto estimate_statistics = beluga::SE2EstimateStatistics<double>{};
+  deferred |= beluga::actions::reweight_deferred(model, kScale, std::ref(statistics), std::ref(estimate_statistics));
+
+  // Dividing the entering scale out of the recorded statistics reproduces the eager ones.
+  EXPECT_DOUBLE_EQ(statistics.sum, eager_statistics.sum);
+  EXPECT_DOUBLE_EQ(statistics.squared_sum, eager_statistics.squared_sum);
+  EXPECT_EQ(statistics.count, eager_statistics.count);
+  const auto [expected_pose, expected_covariance] = beluga::estimate(eager_estimate_statistics);
+  const auto [pose, covariance] = beluga::estimate(estimate_statistics);
+  ASSERT_TRUE(pose.matrix().isApprox(expected_pose.matrix()));
+  ASSERT_TRUE(covariance.isApprox(expected_covariance));
+}
+
+TEST(ReweightDeferredAction, ParallelExecutionPolicy) {
+  auto input = std::vector{
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{}, Sophus::Vector2d{1.0, 0.0}}, beluga::Weight(1.0)),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{}, Sophus::Vector2d{3.0, 0.0}}, beluga::Weight(1.0))};
+  auto statistics = beluga::WeightStatistics{};
+  auto estimate_statistics = beluga::SE2EstimateStatistics<double>{};
+  input |= beluga::actions::reweight_deferred(
+      std::execution::par, [](const Sophus::SE2d& state) { return state.translation().x(); }, 1.0,
+      std::ref(statistics), std::ref(estimate_statistics));
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(1.0, 3.0));
+  EXPECT_EQ(statistics.sum, 4.0);
+}
+
+}  // namespace
@@ -0,0 +1,97 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <execution>
+#include <functional>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+#include <sophus/se2.hpp>
+
+#include "beluga/actions/normalize.hpp"
+#include "beluga/actions/reweight.hpp"
+#include "beluga/actions/reweight_normalized.hpp"
+#include "beluga/algorithm/estimation.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+TEST(ReweightNormalizedAction, DefaultExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0)), std::make_tuple(3, beluga::Weight(1.0))};
+  input |= beluga::actions::reweight_normalized([](int value) { return value; });
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(0.25, 0.75));
+}
+
+TEST(ReweightNormalizedAction, SequencedExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(5, beluga::Weight(2.0))};
+  input |= beluga::actions::reweight_normalized(std::execution::seq, [](int value) { return value; });
+  ASSERT_EQ(input.front(), std::make_tuple(5, 1.0));
+}
+
+TEST(ReweightNormalizedAction, ParallelExecutionPolicy) {
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0)), std::make_tuple(3, beluga::Weight(1.0))};
+  input |= beluga::actions::reweight_normalized(std::execution::par, [](int value) { return value; });
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(0.25, 0.75));
+}
+
+TEST(ReweightNormalizedAction, MatchesSeparateActions) {
+  auto fused = std::vector{
+      std::make_tuple(1, beluga::Weight(0.5)),  //
+      std::make_tuple(2, beluga::Weight(1.5)),  //
+      std::make_tuple(3, beluga::Weight(2.0))};
+  auto separate = fused;
+  fused |= beluga::actions::reweight_normalized([](int value) { return value; });
+  separate |= beluga::actions::reweight([](int value) { return value; }) | beluga::actions::normalize;
+  ASSERT_EQ(fused, separate);
+}
+
+TEST(ReweightNormalizedAction, RecordsWeightStatistics) {
+  auto input = std::vector{std::make_tuple(1, beluga::Weight(1.0)), std::make_tuple(3, beluga::Weight(1.0))};
+  auto statistics = beluga::WeightStatistics{};
+  input |= beluga::actions::reweight_normalized([](int value) { return value; }, std::ref(statistics));
+  // The statistics are taken over the weights before normalization.
+  EXPECT_EQ(statistics.sum, 4.0);
+  EXPECT_EQ(statistics.squared_sum, 10.0);
+  EXPECT_EQ(statistics.count, 2);
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::ElementsAre(0.25, 0.75));
+}
+
+TEST(ReweightNormalizedAction, RecordsEstimateStatistics) {
+  auto input = std::vector{
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{0.1}, Sophus::Vector2d{1.0, 2.0}}, beluga::Weight(1.0)),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{0.3}, Sophus::Vector2d{3.0, -1.0}}, beluga::Weight(1.0)),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{-0.2}, Sophus::Vector2d{2.0, 0.5}}, beluga::Weight(1.0))};
+  auto statistics = beluga::WeightStatistics{};
+  auto estimate_statistics = beluga::SE2EstimateStatistics<double>{};
+  input |= beluga::actions::reweight_normalized(
+      [](const Sophus::SE2d& state) { return state.translation().x(); }, std::ref(statistics),
+      std::ref(estimate_statistics));
+  EXPECT_EQ(statistics.sum, 6.0);
+  // The statistics yield the same estimate as a dedicated pass over the normalized set.
+  const auto [expected_pose, expected_covariance] =
+      beluga::estimate(beluga::views::states(input), beluga::views::weights(input));
+  const auto [pose, covariance] = beluga::estimate(estimate_statistics);
+  ASSERT_TRUE(pose.matrix().isApprox(expected_pose.matrix()));
+  ASSERT_TRUE(covariance.isApprox(expected_covariance));
+}
+
+}  // namespace
@@ -14,6 +14,7 @@
 
 #include <gtest/gtest.h>
 
+#include <utility>
 #include <vector>
 
 #include <Eigen/Core>
@@ -204,4 +205,24 @@ TEST(Bresenham, Modified) {
   }
 }
 
+TEST(Bresenham, StaticVariantsMatchRuntimeSelection) {
+  const auto endpoints = std::vector<std::pair<Eigen::Vector2i, Eigen::Vector2i>>{
+      {{0, 0}, {0, 0}}, {{0, 0}, {1, 1}}, {{1, 1}, {0, 0}}, {{0, 0}, {2, 1}},
+      {{2, 1}, {0, 0}}, {{0, 2}, {0, 0}}, {{3, 2}, {0, 0}}, {{0, 0}, {7, 3}},
+  };
+
+  for (const auto& [p0, p1] : endpoints) {
+    {
+      const auto expected_trace = Bresenham2i{Bresenham2i::kStandard}(p0, p1) | ranges::to<std::vector>;
+      const auto trace = StandardBresenham2i{}(p0, p1) | ranges::to<std::vector>;
+      EXPECT_EQ(trace, expected_trace);
+    }
+    {
+      const auto expected_trace = Bresenham2i{Bresenham2i::kModified}(p0, p1) | ranges::to<std::vector>;
+      const auto trace = ModifiedBresenham2i{}(p0, p1) | ranges::to<std::vector>;
+      EXPECT_EQ(trace, expected_trace);
+    }
+  }
+}
+
 }  // namespace beluga
@@ -0,0 +1,100 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <optional>
+
+#include <sophus/common.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/algorithm/raycasting/lookup_table.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+namespace beluga {
+
+using testing::StaticOccupancyGrid;
+
+TEST(RaycastLookupTable, Nominal) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  constexpr double kMaxRange = 5.;
+  const auto lookup = RaycastLookupTable{grid, 64, kMaxRange};
+
+  {
+    // Horizontal ray that hits the occupied cell (centered at (1.25, 1.25)).
+    const auto range = lookup.cast(Eigen::Vector2d{0., 1.25}, Sophus::SO2d{0.});
+    ASSERT_TRUE(range.has_value());
+    EXPECT_NEAR(*range, 1.25, 1e-6);
+  }
+
+  {
+    // Downwards ray that hits the occupied cell.
+    const auto range = lookup.cast(Eigen::Vector2d{1.25, 0.}, Sophus::SO2d{Sophus::Constants<double>::pi() / 2.});
+    ASSERT_TRUE(range.has_value());
+    EXPECT_NEAR(*range, 1.25, 1e-6);
+  }
+
+  {
+    // Horizontal ray that misses the occupied cell row.
+    const auto range = lookup.cast(Eigen::Vector2d{0., 0.25}, Sophus::SO2d{0.});
+    EXPECT_EQ(range, std::nullopt);
+  }
+
+  {
+    // Ray pointing away from the occupied cell.
+    const auto range = lookup.cast(Eigen::Vector2d{0., 1.25}, Sophus::SO2d{Sophus::Constants<double>::pi()});
+    EXPECT_EQ(range, std::nullopt);
+  }
+}
+
+TEST(RaycastLookupTable, MaxRange) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto lookup = RaycastLookupTable{grid, 64, 1.};
+  const auto range = lookup.cast(Eigen::Vector2d{0., 1.25}, Sophus::SO2d{0.});
+  EXPECT_EQ(range, std::nullopt);
+}
+
+TEST(RaycastLookupTable, EmptyGrid) {
+  constexpr double kResolution = 0.5;
+  const auto grid = StaticOccupancyGrid<5, 5>{
+      {false, false, false, false, false, false, false, false, false, false, false, false, false,
+       false, false, false, false, false, false, false, false, false, false, false, false},
+      kResolution};
+
+  const auto lookup = RaycastLookupTable{grid, 64, 5.};
+  const auto range = lookup.cast(Eigen::Vector2d{0., 0.}, Sophus::SO2d{0.});
+  EXPECT_EQ(range, std::nullopt);
+}
+
+}  // namespace beluga
@@ -14,10 +14,20 @@
 
 #include <gtest/gtest.h>
 
+#include <chrono>
+#include <cstddef>
 #include <execution>
+#include <future>
+#include <memory_resource>
+#include <numeric>
+#include <sstream>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/range/conversion.hpp>
+
 #include <Eigen/Core>
 #include <sophus/se2.hpp>
 
@@ -66,6 +76,20 @@ auto make_amcl(const beluga::AmclParams& params = {}) {
   };
   return amcl;
 }
+
+/// Sensor model stub assigning every particle the measured value as its weight.
+struct FakeSensorModel {
+  using state_type = Sophus::SE2d;
+  using weight_type = double;
+  using measurement_type = double;
+  using map_type = int;
+
+  void update_map(map_type) {}
+
+  auto operator()(measurement_type value) const {
+    return [value](const state_type&) { return value; };
+  }
+};
 }  // namespace
 
 namespace beluga {
@@ -112,6 +136,160 @@ TEST(TestAmclCore, UpdateWithParticlesNoMotion) {
   ASSERT_FALSE(estimate.has_value());
 }
 
+TEST(TestAmclCore, RetiredParticlesSnapshot) {
+  auto amcl = make_amcl();
+  ASSERT_EQ(amcl.update_epoch(), 0UL);
+  ASSERT_EQ(amcl.retired_particles().particles.size(), 0UL);
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  const auto count_before_resample = amcl.particles().size();
+  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
+  ASSERT_TRUE(estimate.has_value());
+  ASSERT_TRUE(amcl.last_update_stats().resampled);
+  // The resample retired the pre-resample set into the snapshot buffer.
+  const auto snapshot = amcl.retired_particles();
+  ASSERT_EQ(snapshot.epoch, 1UL);
+  ASSERT_EQ(snapshot.epoch, amcl.update_epoch());
+  ASSERT_EQ(snapshot.particles.size(), count_before_resample);
+}
+
+TEST(TestAmclCore, SetParticleBounds) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_EQ(amcl.particles().size(), AmclParams{}.max_particles);
+  amcl.set_particle_bounds(10UL, 20UL);
+  // The particle state is untouched; the new bounds apply on the next resample.
+  ASSERT_EQ(amcl.particles().size(), AmclParams{}.max_particles);
+  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
+  ASSERT_TRUE(estimate.has_value());
+  ASSERT_LE(amcl.particles().size(), 20UL);
+}
+
+TEST(TestAmclCore, SkipsPropagationWhenStationary) {
+  auto params = beluga::AmclParams{};
+  params.propagate_min_d = 1e-3;
+  params.propagate_min_a = 1e-3;
+  params.resample_interval = 100UL;  // Avoid resampling to observe the states directly.
+  auto amcl = make_amcl(params);
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  const auto states_before = amcl.particles() | beluga::views::states | ranges::to<std::vector>;
+  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
+  ASSERT_TRUE(estimate.has_value());
+  // A stationary control conditions a near-identity sampler, so the propagation
+  // pass is skipped and the states are left bit-identical.
+  const auto states_after = amcl.particles() | beluga::views::states | ranges::to<std::vector>;
+  ASSERT_TRUE(ranges::equal(
+      states_before, states_after, [](const auto& lhs, const auto& rhs) { return lhs.matrix() == rhs.matrix(); }));
+}
+
+TEST(TestAmclCore, DeferredWeightNormalization) {
+  auto params = beluga::AmclParams{};
+  params.resample_interval = 100UL;  // Avoid resampling so the pending factor accumulates.
+  auto amcl = make_amcl(params);
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_EQ(amcl.weight_normalization(), 1.0);
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement).has_value());
+  ASSERT_FALSE(amcl.last_update_stats().resampled);
+  // The update skipped the normalization write pass: the weights are left as raw
+  // products and their sum is exactly the tracked pending factor.
+  const auto weights = amcl.particles() | beluga::views::weights | ranges::to<std::vector>;
+  const double sum = std::accumulate(weights.begin(), weights.end(), 0.0);
+  ASSERT_GT(amcl.weight_normalization(), 0.0);
+  ASSERT_NEAR(sum / amcl.weight_normalization(), 1.0, 1e-9);
+  // Materializing normalized weights divides the pending factor out.
+  amcl.normalize_weights();
+  ASSERT_EQ(amcl.weight_normalization(), 1.0);
+  const auto normalized = amcl.particles() | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_NEAR(std::accumulate(normalized.begin(), normalized.end(), 0.0), 1.0, 1e-9);
+}
+
+TEST(TestAmclCore, IntegratesOdometryBetweenMeasurements) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  // No odometry was ever integrated, measurement-only updates cannot run.
+  ASSERT_FALSE(amcl.update(kDummyMeasurement).has_value());
+  // High-rate readings collapse into the most recent one.
+  amcl.integrate_odometry(Sophus::SE2d{});
+  amcl.integrate_odometry(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{0.1, 0.0}});
+  amcl.integrate_odometry(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{0.3, 0.0}});
+  ASSERT_TRUE(amcl.update(kDummyMeasurement).has_value());
+  // The reading is retained, so without new readings there is no motion increment
+  // and the update policy gates the next measurement-only update.
+  ASSERT_FALSE(amcl.update(kDummyMeasurement).has_value());
+}
+
+TEST(TestAmclCore, UpdateBatchRunsSingleResample) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  auto batch = std::vector{
+      std::make_pair(kDummyControl, kDummyMeasurement),
+      std::make_pair(kDummyControl, kDummyMeasurement),
+      std::make_pair(kDummyControl, kDummyMeasurement),
+  };
+  auto estimate = amcl.update_batch(std::move(batch));
+  ASSERT_TRUE(estimate.has_value());
+  // All three pairs were reweighted but the tail ran once.
+  ASSERT_TRUE(amcl.last_update_stats().resampled);
+}
+
+TEST(TestAmclCore, BatchedUpdatesAccumulateUntilFull) {
+  auto params = beluga::AmclParams{};
+  params.measurement_batch_size = 3UL;
+  auto amcl = make_amcl(params);
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_FALSE(amcl.update(kDummyControl, kDummyMeasurement).has_value());
+  ASSERT_FALSE(amcl.update(kDummyControl, kDummyMeasurement).has_value());
+  // The third accepted pair fills the batch and triggers the full update.
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement).has_value());
+}
+
+TEST(TestAmclCore, AdaptiveParticleBudget) {
+  auto params = beluga::AmclParams{};
+  params.target_update_latency = std::chrono::milliseconds{100};
+  auto amcl = make_amcl(params);
+  ASSERT_EQ(amcl.effective_max_particles(), params.max_particles);
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
+  ASSERT_TRUE(estimate.has_value());
+  // The adjusted ceiling must stay within the configured bounds.
+  ASSERT_GE(amcl.effective_max_particles(), params.min_particles);
+  ASSERT_LE(amcl.effective_max_particles(), params.max_particles);
+}
+
+TEST(TestAmclCore, UpdateStatsReportStageCounts) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
+  ASSERT_TRUE(estimate.has_value());
+  const auto& stats = amcl.last_update_stats();
+  ASSERT_EQ(stats.particle_count, AmclParams{}.max_particles);
+  ASSERT_TRUE(stats.resampled);
+  ASSERT_EQ(stats.resampled_count, amcl.particles().size());
+}
+
+TEST(TestAmclCore, UpdateAsyncWithParticles) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  auto first = amcl.update_async(kDummyControl, kDummyMeasurement);
+  auto second = amcl.update_async(kDummyControl, kDummyMeasurement);
+  // Cycles are serialized in submission order on the worker, so the first (forced
+  // by initialization) must produce an estimate and the second, with no motion in
+  // between, must be skipped just as with synchronous updates.
+  ASSERT_TRUE(first.get().has_value());
+  ASSERT_FALSE(second.get().has_value());
+}
+
+TEST(TestAmclCore, UpdateAsyncSignalsCompletionOnExecutor) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  auto done = std::promise<bool>{};
+  // An inline executor stands in for an event loop post operation.
+  auto executor = [](auto work) { work(); };
+  amcl.update_async(kDummyControl, kDummyMeasurement, executor, [&done](auto result) {
+    done.set_value(result.has_value());
+  });
+  ASSERT_TRUE(done.get_future().get());
+}
+
 TEST(TestAmclCore, UpdateWithParticlesForced) {
   auto amcl = make_amcl();
   ASSERT_EQ(amcl.particles().size(), 0);
@@ -171,6 +349,198 @@ TEST(TestAmclCore, SelectiveResampleCanBeConstructed) {
   ASSERT_TRUE(estimate.has_value());
 }
 
+TEST(TestAmclCore, ScratchMemoryResource) {
+  auto arena = std::pmr::monotonic_buffer_resource{};
+  auto amcl = make_amcl();
+  amcl.use_scratch_memory_resource(arena);
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  for (int iteration = 0; iteration < 3; ++iteration) {
+    amcl.force_update();
+    ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement).has_value());
+  }
+}
+
+TEST(TestAmclCore, SnapshotRoundTrip) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_TRUE(amcl.update(kDummyControl, kDummyMeasurement).has_value());
+
+  std::stringstream buffer{std::ios::in | std::ios::out | std::ios::binary};
+  amcl.save(buffer);
+
+  auto restored = make_amcl();
+  restored.restore(buffer);
+  ASSERT_EQ(restored.particles().size(), amcl.particles().size());
+  ASSERT_TRUE(
+      ranges::equal(beluga::views::weights(restored.particles()), beluga::views::weights(amcl.particles())));
+  // The restored filter must run its next update unconditionally, like after initialize().
+  ASSERT_TRUE(restored.update(kDummyControl, kDummyMeasurement).has_value());
+}
+
+TEST(TestAmclCore, RestoreRejectsInvalidSnapshot) {
+  auto amcl = make_amcl();
+  std::stringstream buffer{"definitely not a snapshot", std::ios::in | std::ios::binary};
+  ASSERT_THROW(amcl.restore(buffer), std::invalid_argument);
+}
+
+TEST(TestAmclCore, StaticallyComposedPolicies) {
+  constexpr double kResolution = 1.0;
+  // clang-format off
+  const auto map = beluga::testing::StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false ,
+    false, false, false, false , false,
+    false, false, true , false, false,
+    false, false , false, false, false,
+    false , false, false, false, false},
+    kResolution};
+  // clang-format on
+  const auto params = beluga::AmclParams{};
+  auto random_state_maker = []() { return Sophus::SE2d{}; };
+  beluga::spatial_hash<Sophus::SE2d> hasher{0.1, 0.1, 0.1};
+
+  // Passing the concrete policy instances deduces their types, so the gating checks
+  // are direct calls instead of the type-erased defaults.
+  beluga::Amcl amcl{
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},  //
+      beluga::BeamSensorModel{beluga::BeamModelParam{}, map},                 //
+      std::move(random_state_maker),
+      std::move(hasher),
+      beluga::policies::on_motion(params.update_min_d, params.update_min_a),
+      beluga::policies::every_n(params.resample_interval),
+      params,
+      std::execution::seq,
+  };
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
+  ASSERT_TRUE(estimate.has_value());
+  // Without motion the statically typed policy must skip, just like the erased default.
+  estimate = amcl.update(kDummyControl, kDummyMeasurement);
+  ASSERT_FALSE(estimate.has_value());
+}
+
+TEST(TestAmclCore, BoundedVariantClampsToCompileTimeCapacity) {
+  constexpr std::size_t kCapacity = 300;
+  constexpr double kResolution = 1.0;
+  // clang-format off
+  const auto map = beluga::testing::StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false ,
+    false, false, false, false , false,
+    false, false, true , false, false,
+    false, false , false, false, false,
+    false , false, false, false, false},
+    kResolution};
+  // clang-format on
+  using SensorModel = beluga::BeamSensorModel<beluga::testing::StaticOccupancyGrid<5, 5>>;
+
+  auto amcl = beluga::BoundedAmcl<kCapacity, beluga::DifferentialDriveModel, SensorModel, Sophus::SE2d (*)()>{
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},  //
+      SensorModel{beluga::BeamModelParam{}, map},                             //
+      +[]() { return Sophus::SE2d{}; },
+      beluga::spatial_hash<Sophus::SE2d>{0.1, 0.1, 0.1},
+  };
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  // Default parameters ask for more particles than the compile-time bound allows.
+  static_assert(AmclParams{}.max_particles > decltype(amcl)::kMaxParticles);
+  ASSERT_EQ(amcl.particles().size(), kCapacity);
+  auto estimate = amcl.update(kDummyControl, kDummyMeasurement);
+  ASSERT_TRUE(estimate.has_value());
+  ASSERT_LE(amcl.particles().size(), kCapacity);
+}
+
+TEST(TestAmclCore, StagedRecoveryEscalation) {
+  auto params = beluga::AmclParams{};
+  params.recovery_likelihood_threshold = 1.0;
+  params.recovery_trigger_window = 2UL;
+  params.recovery_escalation_window = 3UL;
+
+  // With the fake sensor model the average weight equals the measured value, so
+  // degradation can be driven directly: 5.0 is healthy, 0.1 is degraded.
+  auto amcl = beluga::Amcl{
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},  //
+      FakeSensorModel{},                                                      //
+      +[]() { return Sophus::SE2d{}; },
+      beluga::spatial_hash<Sophus::SE2d>{0.1, 0.1, 0.1},
+      std::move(params),  //
+      std::execution::seq,
+  };
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_EQ(amcl.recovery_stage(), beluga::AmclRecoveryStage::kTracking);
+
+  // A healthy update stores the recovery anchor and keeps the filter tracking.
+  amcl.force_update();
+  ASSERT_TRUE(amcl.update(kDummyControl, 5.0).has_value());
+  ASSERT_EQ(amcl.recovery_stage(), beluga::AmclRecoveryStage::kTracking);
+
+  // Two consecutive degraded updates trigger the local re-seed.
+  for (int i = 0; i < 2; ++i) {
+    amcl.force_update();
+    ASSERT_TRUE(amcl.update(kDummyControl, 0.1).has_value());
+  }
+  ASSERT_EQ(amcl.recovery_stage(), beluga::AmclRecoveryStage::kLocalRecovery);
+
+  // Three further degraded updates escalate to free-space-wide sampling.
+  for (int i = 0; i < 3; ++i) {
+    amcl.force_update();
+    ASSERT_TRUE(amcl.update(kDummyControl, 0.1).has_value());
+  }
+  ASSERT_EQ(amcl.recovery_stage(), beluga::AmclRecoveryStage::kGlobalRecovery);
+
+  // A healthy update returns the filter to tracking from any recovery stage.
+  amcl.force_update();
+  ASSERT_TRUE(amcl.update(kDummyControl, 5.0).has_value());
+  ASSERT_EQ(amcl.recovery_stage(), beluga::AmclRecoveryStage::kTracking);
+}
+
+TEST(TestAmclCore, CachedDerivedRandomStateGenerator) {
+  auto params = beluga::AmclParams{};
+  params.min_particles = 2;
+  params.max_particles = 100;
+  params.alpha_slow = 0.0;
+  params.alpha_fast = 100.0;
+
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto map = beluga::testing::StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false ,
+    false, false, false, false , false,
+    false, false, false , false, false,
+    false, false , false, false, false,
+    false , false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  // Count how often the particle-conditioned generator is derived.
+  int derivations = 0;
+  auto random_state_maker = [&derivations](const auto& particles) {
+    ++derivations;
+    const auto last_particle_state = beluga::views::states(particles).back();
+    return [last_particle_state]() { return last_particle_state; };
+  };
+
+  beluga::spatial_hash<Sophus::SE2d> hasher{0.5, 0.5, 0.5};
+  beluga::Amcl amcl{
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},   //
+      beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, map},  //
+      std::move(random_state_maker),
+      std::move(hasher),
+      std::move(params),  //
+      std::execution::seq,
+  };
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  for (int i = 0; i < 5; ++i) {
+    amcl.force_update();
+    amcl.update(kDummyControl, kDummyMeasurement);
+  }
+  // Derivation is lazy and cached: at most one construction across all resamples,
+  // instead of one per resampling cycle.
+  ASSERT_LE(derivations, 1);
+  // A map update invalidates the cache, allowing at most one more derivation.
+  amcl.update_map(map);
+  amcl.force_update();
+  amcl.update(kDummyControl, kDummyMeasurement);
+  ASSERT_LE(derivations, 2);
+}
+
 TEST(TestAmclCore, TestRandomParticlesInserting) {
   auto params = beluga::AmclParams{};
   params.min_particles = 2;
@@ -0,0 +1,97 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <execution>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+#include <sophus/se2.hpp>
+
+#include "beluga/algorithm/amcl_core.hpp"
+#include "beluga/algorithm/amcl_ensemble.hpp"
+#include "beluga/algorithm/spatial_hash.hpp"
+#include "beluga/motion/differential_drive_model.hpp"
+#include "beluga/sensor/beam_model.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+namespace {
+
+const auto kDummyControl = Sophus::SE2d{};
+const std::vector kDummyMeasurement = {
+    std::make_pair(0.0, 0.0),
+    std::make_pair(0.0, 0.0),
+    std::make_pair(0.0, 0.0),
+};
+
+auto make_filter(const beluga::AmclParams& params = {}) {
+  constexpr double kResolution = 1.0;
+  // clang-format off
+  const auto map = beluga::testing::StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false ,
+    false, false, false, false , false,
+    false, false, true , false, false,
+    false, false , false, false, false,
+    false , false, false, false, false},
+    kResolution};
+  // clang-format on
+  auto random_state_maker = []() { return Sophus::SE2d{}; };
+  beluga::spatial_hash<Sophus::SE2d> hasher{0.1, 0.1, 0.1};
+  beluga::Amcl amcl{
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},  //
+      beluga::BeamSensorModel{beluga::BeamModelParam{}, map},                 //
+      std::move(random_state_maker),
+      std::move(hasher),
+      params,
+      std::execution::seq,
+  };
+  return amcl;
+}
+
+template <class Filter>
+auto make_ensemble(std::size_t count, std::size_t cull_interval) {
+  auto filters = std::vector<Filter>{};
+  filters.reserve(count);
+  for (std::size_t index = 0; index < count; ++index) {
+    auto filter = make_filter();
+    filter.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+    filters.push_back(std::move(filter));
+  }
+  return beluga::AmclEnsemble<Filter>{std::move(filters), cull_interval};
+}
+
+using FilterType = decltype(make_filter());
+
+TEST(TestAmclEnsemble, UpdateReturnsBestEstimate) {
+  auto ensemble = make_ensemble<FilterType>(4, 10);
+  ASSERT_EQ(ensemble.size(), 4);
+  ASSERT_FALSE(ensemble.converged());
+  auto estimate = ensemble.update(kDummyControl, kDummyMeasurement);
+  ASSERT_TRUE(estimate.has_value());
+}
+
+TEST(TestAmclEnsemble, CullsDownToSingleSurvivor) {
+  auto ensemble = make_ensemble<FilterType>(4, 1);
+  for (int iteration = 0; iteration < 4 && !ensemble.converged(); ++iteration) {
+    ensemble.force_update();
+    (void)ensemble.update(kDummyControl, kDummyMeasurement);
+  }
+  ASSERT_TRUE(ensemble.converged());
+  ASSERT_EQ(ensemble.size(), 1);
+}
+
+}  // namespace
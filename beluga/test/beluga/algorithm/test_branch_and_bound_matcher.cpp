@@ -0,0 +1,123 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <range/v3/view/span.hpp>
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/algorithm/branch_and_bound_matcher.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+namespace {
+
+using beluga::testing::StaticOccupancyGrid;
+
+constexpr std::size_t kSize = 16;
+
+// An asymmetric L-shaped wall, so a full-score match pins down the pose.
+std::array<bool, kSize * kSize> make_l_shaped_map() {
+  auto data = std::array<bool, kSize * kSize>{};
+  for (std::size_t y = 4; y <= 10; ++y) {
+    data[y * kSize + 4] = true;
+  }
+  for (std::size_t x = 4; x <= 8; ++x) {
+    data[4 * kSize + x] = true;
+  }
+  return data;
+}
+
+// Scan points as seen from a robot at the center of cell (tx, ty) with no rotation:
+// one endpoint per occupied cell of the map.
+std::vector<std::pair<double, double>> make_scan_from(const std::array<bool, kSize * kSize>& data, int tx, int ty) {
+  auto points = std::vector<std::pair<double, double>>{};
+  for (std::size_t yi = 0; yi < kSize; ++yi) {
+    for (std::size_t xi = 0; xi < kSize; ++xi) {
+      if (data[yi * kSize + xi]) {
+        points.emplace_back(static_cast<double>(xi) - static_cast<double>(tx), static_cast<double>(yi) - static_cast<double>(ty));
+      }
+    }
+  }
+  return points;
+}
+
+TEST(BranchAndBoundScanMatcher, RecoversExactPose) {
+  const auto data = make_l_shaped_map();
+  const auto matcher = beluga::BranchAndBoundScanMatcher{StaticOccupancyGrid<kSize, kSize>{data}};
+  const auto points = make_scan_from(data, 8, 8);
+  const auto candidates = matcher.match(ranges::make_span(points.data(), static_cast<std::ptrdiff_t>(points.size())));
+  ASSERT_FALSE(candidates.empty());
+  EXPECT_DOUBLE_EQ(candidates.front().score, 1.0);
+  const auto matches_true_pose = [](const auto& candidate) {
+    return candidate.score == 1.0 &&                                      //
+           std::abs(candidate.pose.translation().x() - 8.5) < 1e-9 &&     //
+           std::abs(candidate.pose.translation().y() - 8.5) < 1e-9 &&     //
+           std::abs(candidate.pose.so2().log()) < 0.2;
+  };
+  EXPECT_TRUE(std::any_of(candidates.begin(), candidates.end(), matches_true_pose));
+}
+
+TEST(BranchAndBoundScanMatcher, SortsCandidatesByScore) {
+  const auto data = make_l_shaped_map();
+  const auto matcher = beluga::BranchAndBoundScanMatcher{StaticOccupancyGrid<kSize, kSize>{data}};
+  const auto points = make_scan_from(data, 8, 8);
+  const auto candidates = matcher.match(ranges::make_span(points.data(), static_cast<std::ptrdiff_t>(points.size())));
+  ASSERT_FALSE(candidates.empty());
+  EXPECT_TRUE(std::is_sorted(candidates.begin(), candidates.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.score > rhs.score;
+  }));
+}
+
+TEST(BranchAndBoundScanMatcher, AppliesMapOrigin) {
+  const auto data = make_l_shaped_map();
+  const auto origin = Sophus::SE2d{Sophus::SO2d{Sophus::Constants<double>::pi() / 2}, Eigen::Vector2d{5.0, -3.0}};
+  const auto matcher = beluga::BranchAndBoundScanMatcher{StaticOccupancyGrid<kSize, kSize>{data, 1.0, origin}};
+  const auto points = make_scan_from(data, 8, 8);
+  const auto candidates = matcher.match(ranges::make_span(points.data(), static_cast<std::ptrdiff_t>(points.size())));
+  ASSERT_FALSE(candidates.empty());
+  const auto expected = origin * Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{8.5, 8.5}};
+  const auto matches_expected_pose = [&expected](const auto& candidate) {
+    return candidate.score == 1.0 &&
+           (candidate.pose.translation() - expected.translation()).norm() < 1e-9 &&
+           std::abs((expected.so2().inverse() * candidate.pose.so2()).log()) < 0.2;
+  };
+  EXPECT_TRUE(std::any_of(candidates.begin(), candidates.end(), matches_expected_pose));
+}
+
+TEST(BranchAndBoundScanMatcher, ReturnsEmptyBelowMinScore) {
+  auto data = std::array<bool, kSize * kSize>{};
+  data[8 * kSize + 8] = true;  // a single occupied cell cannot explain a spread-out scan
+  const auto matcher = beluga::BranchAndBoundScanMatcher{StaticOccupancyGrid<kSize, kSize>{data}};
+  const auto points = std::vector<std::pair<double, double>>{{3.0, 0.0}, {-3.0, 0.0}, {0.0, 3.0}, {0.0, -3.0}};
+  const auto candidates = matcher.match(ranges::make_span(points.data(), static_cast<std::ptrdiff_t>(points.size())));
+  EXPECT_TRUE(candidates.empty());
+}
+
+TEST(BranchAndBoundScanMatcher, ReturnsEmptyForEmptyScan) {
+  const auto matcher = beluga::BranchAndBoundScanMatcher{StaticOccupancyGrid<kSize, kSize>{make_l_shaped_map()}};
+  const auto points = std::vector<std::pair<double, double>>{};
+  const auto candidates = matcher.match(ranges::make_span(points.data(), static_cast<std::ptrdiff_t>(points.size())));
+  EXPECT_TRUE(candidates.empty());
+}
+
+}  // namespace
@@ -0,0 +1,74 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+#include "beluga/algorithm/compensated_sum.hpp"
+
+namespace {
+
+TEST(CompensatedSum, SumsExactValues) {
+  auto sum = beluga::CompensatedSum<double>{};
+  sum += 1.0;
+  sum += 2.0;
+  sum += 3.0;
+  ASSERT_EQ(sum.value(), 6.0);
+}
+
+TEST(CompensatedSum, RecoversCancelledAddends) {
+  // Naive left-to-right summation of this sequence yields 0.0: both unit addends
+  // are absorbed by the large terms. The compensation term retains them.
+  auto sum = beluga::CompensatedSum<double>{};
+  sum += 1.0;
+  sum += 1e100;
+  sum += 1.0;
+  sum += -1e100;
+  ASSERT_EQ(sum.value(), 2.0);
+}
+
+TEST(CompensatedSum, ErrorDoesNotGrowWithAddendCount) {
+  // 0.1 is not representable in binary; naive summation accumulates one rounding
+  // error per addition while the compensated result stays within one ulp.
+  constexpr std::size_t kCount = 10'000'000;
+  auto compensated = beluga::CompensatedSum<double>{};
+  double naive = 0.0;
+  for (std::size_t i = 0; i < kCount; ++i) {
+    compensated += 0.1;
+    naive += 0.1;
+  }
+  const double expected = static_cast<double>(kCount) * 0.1;
+  ASSERT_DOUBLE_EQ(compensated.value(), expected);
+  ASSERT_LT(std::abs(compensated.value() - expected), std::abs(naive - expected));
+}
+
+TEST(CompensatedSumOverRange, MatchesAccumulator) {
+  const auto values = std::vector<double>{1.0, 1e100, 1.0, -1e100};
+  ASSERT_EQ(beluga::compensated_sum(values), 2.0);
+}
+
+TEST(CompensatedSumOverRange, PromotesReducedPrecisionValues) {
+  // Each float value is exact; the accumulation in double keeps them all.
+  const auto values = std::vector<float>(1'000'000, 0.5F);
+  ASSERT_EQ(beluga::compensated_sum(values), 500'000.0);
+}
+
+TEST(CompensatedSumOverRange, EmptyRange) {
+  ASSERT_EQ(beluga::compensated_sum(std::vector<double>{}), 0.0);
+}
+
+}  // namespace
@@ -19,6 +19,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <execution>
 #include <vector>
 
 #include "beluga/algorithm/distance_map.hpp"
@@ -78,4 +79,110 @@ TEST(DistanceMap, Case3) {
   ASSERT_THAT(distance_map, testing::ElementsAre(5, 4, 3, 2, 1, 0));
 }
 
+TEST(EuclideanDistanceTransform, None) {
+  auto map = std::vector<bool>{};
+  auto distance_map = beluga::euclidean_distance_transform(map, 3);
+  ASSERT_EQ(distance_map.size(), 0);
+}
+
+TEST(EuclideanDistanceTransform, Empty) {
+  auto map = std::vector<bool>(9, false);
+  auto distance_map = beluga::euclidean_distance_transform(map, 3);
+  ASSERT_THAT(distance_map, testing::Each(testing::Ge(1e19)));
+}
+
+TEST(EuclideanDistanceTransform, Full) {
+  auto map = std::vector<bool>(9, true);
+  auto distance_map = beluga::euclidean_distance_transform(map, 3);
+  ASSERT_THAT(distance_map, testing::Each(testing::DoubleEq(0.)));
+}
+
+TEST(EuclideanDistanceTransform, SingleObstacle) {
+  // clang-format off
+  auto map = std::vector<bool>{
+    false, false, false,
+    false, true , false,
+    false, false, false};
+  const auto expected = std::vector<double>{
+    2., 1., 2.,
+    1., 0., 1.,
+    2., 1., 2.};
+  // clang-format on
+  auto distance_map = beluga::euclidean_distance_transform(map, 3);
+  ASSERT_THAT(distance_map, testing::Pointwise(testing::DoubleEq(), expected));
+}
+
+TEST(EuclideanDistanceTransform, ResolutionScalesSquaredDistances) {
+  // clang-format off
+  auto map = std::vector<bool>{
+    true , false, false,
+    false, false, false,
+    false, false, false};
+  const auto expected = std::vector<double>{
+    0.  , 0.25, 1.  ,
+    0.25, 0.5 , 1.25,
+    1.  , 1.25, 2.  };
+  // clang-format on
+  auto distance_map = beluga::euclidean_distance_transform(map, 3, 0.5);
+  ASSERT_THAT(distance_map, testing::Pointwise(testing::DoubleEq(), expected));
+}
+
+TEST(EuclideanDistanceTransform, ParallelPolicyMatchesSequential) {
+  auto map = std::vector<bool>(32 * 32, false);
+  map[5 * 32 + 7] = true;
+  map[20 * 32 + 25] = true;
+  map[31 * 32 + 0] = true;
+  auto sequential = beluga::euclidean_distance_transform(std::execution::seq, map, 32);
+  auto parallel = beluga::euclidean_distance_transform(std::execution::par, map, 32);
+  ASSERT_THAT(parallel, testing::Pointwise(testing::DoubleEq(), sequential));
+}
+
+TEST(IncrementalDistanceMap, MatchesBatchConstruction) {
+  auto map = std::array<bool, 7>{false, true, false, false, false, true, false};
+  auto batch = beluga::nearest_obstacle_distance_map(map, array_distance, make_neighbors_function(7));
+  auto incremental = beluga::IncrementalDistanceMap{map, array_distance, make_neighbors_function(7)};
+  ASSERT_THAT(incremental.distances(), testing::Pointwise(testing::Eq(), batch));
+}
+
+TEST(IncrementalDistanceMap, InsertionMatchesRebuild) {
+  auto map = std::array<bool, 7>{false, true, false, false, false, false, false};
+  auto incremental = beluga::IncrementalDistanceMap{map, array_distance, make_neighbors_function(7)};
+  incremental.insert_obstacle(5);
+
+  map[5] = true;
+  auto rebuilt = beluga::IncrementalDistanceMap{map, array_distance, make_neighbors_function(7)};
+  ASSERT_THAT(incremental.distances(), testing::Pointwise(testing::Eq(), rebuilt.distances()));
+}
+
+TEST(IncrementalDistanceMap, RemovalMatchesRebuild) {
+  auto map = std::array<bool, 7>{false, true, false, false, false, true, false};
+  auto incremental = beluga::IncrementalDistanceMap{map, array_distance, make_neighbors_function(7)};
+  incremental.remove_obstacle(5);
+
+  map[5] = false;
+  auto rebuilt = beluga::IncrementalDistanceMap{map, array_distance, make_neighbors_function(7)};
+  ASSERT_THAT(incremental.distances(), testing::Pointwise(testing::Eq(), rebuilt.distances()));
+  EXPECT_EQ(incremental.nearest_obstacle(6), 1U);
+}
+
+TEST(IncrementalDistanceMap, RemovingLastObstacleLeavesCellsUnreachable) {
+  auto map = std::array<bool, 3>{false, true, false};
+  auto incremental = beluga::IncrementalDistanceMap{map, array_distance, make_neighbors_function(3)};
+  incremental.remove_obstacle(1);
+  using MapType = decltype(incremental);
+  ASSERT_THAT(incremental.distances(), testing::Each(testing::Eq(MapType::unreachable())));
+  EXPECT_EQ(incremental.nearest_obstacle(0), MapType::kNoObstacle);
+}
+
+TEST(EuclideanDistanceTransform, PackedBitmapMatchesUnpackedRange) {
+  auto map = std::vector<bool>(32 * 32, false);
+  map[5 * 32 + 7] = true;
+  map[20 * 32 + 25] = true;
+  map[31 * 32 + 0] = true;
+  const auto bitmap = beluga::ObstacleBitmap2{map, 32};
+  auto unpacked = beluga::euclidean_distance_transform(map, 32, 0.5);
+  auto packed = beluga::euclidean_distance_transform(bitmap, 0.5);
+  ASSERT_THAT(packed, testing::Pointwise(testing::DoubleEq(), unpacked));
+}
+
 }  // namespace
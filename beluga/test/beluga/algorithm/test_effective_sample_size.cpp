@@ -14,6 +14,7 @@
 
 #include <gtest/gtest.h>
 
+#include <execution>
 #include <vector>
 
 #include "beluga/algorithm/effective_sample_size.hpp"
@@ -79,4 +80,34 @@ TEST(EffectiveSampleSize, Particles) {
   ASSERT_NEAR(beluga::effective_sample_size(particles), 2.66, 0.01);
 }
 
+TEST(EffectiveSampleSize, FloatWeights) {
+  // Large uniform float columns stress the accumulation; the compensated sums keep
+  // the result exact despite one million reduced-precision addends.
+  auto weights = std::vector<beluga::WeightF>(1'000'000, beluga::WeightF(0.25F));
+  ASSERT_NEAR(beluga::effective_sample_size(weights), 1'000'000.0, 0.01);
+}
+
+TEST(EffectiveSampleSize, ExecutionPolicyOverloadsMatch) {
+  auto weights = std::vector{1.0, 0.5, 0.5};
+  const auto expected = beluga::effective_sample_size(weights);
+  ASSERT_DOUBLE_EQ(beluga::effective_sample_size(std::execution::seq, weights), expected);
+  ASSERT_DOUBLE_EQ(beluga::effective_sample_size(std::execution::par, weights), expected);
+}
+
+TEST(EffectiveSampleSize, CachedQueriesReuseTheValueWithinOneEpoch) {
+  auto weights = std::vector{1.0, 0.5, 0.5};
+  auto cache = beluga::EffectiveSampleSizeCache{};
+  const auto initial = cache(weights, 0);
+  ASSERT_NEAR(initial, 2.66, 0.01);
+  weights.back() = 0.0;
+  // Same epoch: the stale cached value is returned without another pass.
+  ASSERT_DOUBLE_EQ(cache(weights, 0), initial);
+  // Bumping the epoch (as a stage rewriting the weights would) recomputes.
+  ASSERT_NEAR(cache(weights, 1), 1.8, 0.01);
+  // Invalidation forces a recomputation even within the same epoch.
+  weights.back() = 0.5;
+  cache.invalidate();
+  ASSERT_DOUBLE_EQ(cache(weights, 1), initial);
+}
+
 }  // namespace
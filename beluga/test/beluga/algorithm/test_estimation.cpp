@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <cstddef>
 #include <limits>
 #include <numeric>
 #include <vector>
@@ -189,6 +190,113 @@ TEST_F(PoseCovarianceEstimation, RandomWalkWithSmoothRotationWithUniformWeights)
   ASSERT_THAT(covariance.col(2).eval(), Vector3Near({0.0000, 0.0000, 0.1355}, kTolerance));
 }
 
+TEST_F(PoseCovarianceEstimation, LargeSetUsesChunkedReduction) {
+  // replicate the random walk states enough times to exercise the multi-chunk
+  // parallel reduction; the replicated set has the same mean, and its covariance
+  // approaches the population covariance (the random walk values times 0.9) as
+  // the weighted averaging factor tends to one
+  const auto base_states = std::vector{
+      SE2d{SO2d{Constants::pi() * 0.1}, Vector2d{0.0, -2.0}},  //
+      SE2d{SO2d{Constants::pi() * 0.2}, Vector2d{1.0, -1.0}},  //
+      SE2d{SO2d{Constants::pi() * 0.3}, Vector2d{2.0, 1.0}},   //
+      SE2d{SO2d{Constants::pi() * 0.2}, Vector2d{3.0, 2.0}},   //
+      SE2d{SO2d{Constants::pi() * 0.2}, Vector2d{2.0, 1.0}},   //
+      SE2d{SO2d{Constants::pi() * 0.2}, Vector2d{1.0, -1.0}},  //
+      SE2d{SO2d{Constants::pi() * 0.3}, Vector2d{2.0, -2.0}},  //
+      SE2d{SO2d{Constants::pi() * 0.4}, Vector2d{3.0, -1.0}},  //
+      SE2d{SO2d{Constants::pi() * 0.5}, Vector2d{2.0, 1.0}},   //
+      SE2d{SO2d{Constants::pi() * 0.4}, Vector2d{1.0, 2.0}},   //
+  };
+  auto states = std::vector<SE2d>{};
+  states.reserve(base_states.size() * 5'000);
+  for (int i = 0; i < 5'000; ++i) {
+    states.insert(states.end(), base_states.begin(), base_states.end());
+  }
+  const auto weights = std::vector(states.size(), 1.0);
+  constexpr double kTolerance = 0.001;
+  const auto [pose, covariance] = beluga::estimate(states, weights);
+  ASSERT_THAT(pose, SE2Near(SO2d{0.8762}, Vector2d{1.700, 0.0}, kTolerance));
+  ASSERT_THAT(covariance.col(0).eval(), Vector3Near({0.8100, 0.5000, 0.0000}, kTolerance));
+  ASSERT_THAT(covariance.col(1).eval(), Vector3Near({0.5000, 2.2000, 0.0000}, kTolerance));
+  ASSERT_THAT(covariance.col(2).eval(), Vector3Near({0.0000, 0.0000, 0.1355}, kTolerance));
+}
+
+TEST_F(PoseCovarianceEstimation, ClusterEstimateReportsDominantMode) {
+  // two distinct hypotheses far apart; the plain estimate would blend them into
+  // a useless midpoint, while the cluster estimate must report the heavier one
+  const auto states = std::vector{
+      SE2d{SO2d{0.0}, Vector2d{0.0, 0.0}},    //
+      SE2d{SO2d{0.0}, Vector2d{0.0, 0.0}},    //
+      SE2d{SO2d{0.0}, Vector2d{0.0, 0.0}},    //
+      SE2d{SO2d{0.0}, Vector2d{10.0, 10.0}},  //
+      SE2d{SO2d{0.0}, Vector2d{10.0, 10.0}},  //
+  };
+  const auto weights = std::vector{1.0, 1.0, 1.0, 2.0, 2.0};
+  constexpr double kTolerance = 0.001;
+  const auto result = beluga::cluster_estimate(states, weights);
+  ASSERT_EQ(result.num_modes, 2U);
+  ASSERT_THAT(result.pose, SE2Near(SO2d{0.0}, Vector2d{10.0, 10.0}, kTolerance));
+  ASSERT_NEAR(result.weight_fraction, 4.0 / 7.0, kTolerance);
+}
+
+TEST_F(PoseCovarianceEstimation, ClusterEstimateMatchesEstimateForSingleMode) {
+  // with a single cluster the dominant mode estimate must match the plain estimate
+  const auto states = std::vector{
+      SE2d{SO2d{Constants::pi() / 6}, Vector2d{0.1, -0.3}}, SE2d{SO2d{Constants::pi() / 8}, Vector2d{0.2, -0.2}},
+      SE2d{SO2d{Constants::pi() / 7}, Vector2d{0.0, -0.1}}, SE2d{SO2d{Constants::pi() / 9}, Vector2d{0.3, -0.05}}};
+  const auto weights = std::vector{0.4, 0.3, 0.2, 0.1};
+  constexpr double kTolerance = 0.001;
+  const auto [pose, covariance] = beluga::estimate(states, weights);
+  const auto cluster = beluga::cluster_estimate(states, weights);
+  ASSERT_EQ(cluster.num_modes, 1U);
+  ASSERT_NEAR(cluster.weight_fraction, 1.0, kTolerance);
+  ASSERT_THAT(cluster.pose, SE2Near(pose.so2(), pose.translation(), kTolerance));
+  ASSERT_TRUE(cluster.covariance.isApprox(covariance, kTolerance));
+}
+
+TEST_F(PoseCovarianceEstimation, ClusterEstimateFromPrecomputedClusters) {
+  // a precomputed cluster column must yield the same result as hashing the states
+  const auto states = std::vector{
+      SE2d{SO2d{0.0}, Vector2d{0.0, 0.0}},    //
+      SE2d{SO2d{0.0}, Vector2d{0.0, 0.0}},    //
+      SE2d{SO2d{0.0}, Vector2d{0.0, 0.0}},    //
+      SE2d{SO2d{0.0}, Vector2d{10.0, 10.0}},  //
+      SE2d{SO2d{0.0}, Vector2d{10.0, 10.0}},  //
+  };
+  const auto weights = std::vector{1.0, 1.0, 1.0, 2.0, 2.0};
+  const auto hasher = beluga::spatial_hash<SE2d>{1.0, 1.0, 1.0};
+  auto clusters = std::vector<std::size_t>{};
+  clusters.reserve(states.size());
+  for (const auto& state : states) {
+    clusters.push_back(hasher(state));
+  }
+  constexpr double kTolerance = 0.001;
+  const auto expected = beluga::cluster_estimate(states, weights, hasher);
+  const auto result = beluga::cluster_estimate(states, weights, clusters);
+  ASSERT_EQ(result.num_modes, expected.num_modes);
+  ASSERT_NEAR(result.weight_fraction, expected.weight_fraction, kTolerance);
+  ASSERT_THAT(result.pose, SE2Near(expected.pose.so2(), expected.pose.translation(), kTolerance));
+  ASSERT_TRUE(result.covariance.isApprox(expected.covariance, kTolerance));
+}
+
+TEST_F(PoseCovarianceEstimation, LazyEstimateMatchesEstimate) {
+  // the lazy handle must produce the same mean and covariance as the eager estimate
+  const auto states = std::vector{
+      SE2d{SO2d{Constants::pi() / 6}, Vector2d{0.1, -0.3}}, SE2d{SO2d{Constants::pi() / 8}, Vector2d{0.2, -0.2}},
+      SE2d{SO2d{Constants::pi() / 7}, Vector2d{0.0, -0.1}}, SE2d{SO2d{Constants::pi() / 9}, Vector2d{0.3, -0.05}}};
+  const auto weights = std::vector{0.4, 0.3, 0.2, 0.1};
+  const auto [expected_pose, expected_covariance] = beluga::estimate(states, weights);
+  const auto lazy = beluga::LazyEstimate{beluga::se2_estimate_statistics(states, weights)};
+  ASSERT_TRUE(lazy.pose().matrix().isApprox(expected_pose.matrix()));
+  ASSERT_TRUE(lazy.covariance().isApprox(expected_covariance));
+  // structured bindings and pair conversion mirror the eager interface
+  const auto& [pose, covariance] = lazy;
+  ASSERT_TRUE(pose.matrix().isApprox(expected_pose.matrix()));
+  ASSERT_TRUE(covariance.isApprox(expected_covariance));
+  const std::pair<SE2d, Sophus::Matrix3d> pair = lazy;
+  ASSERT_TRUE(pair.first.matrix().isApprox(expected_pose.matrix()));
+}
+
 TEST_F(PoseCovarianceEstimation, WeightsCanSingleOutOneSample) {
   // test the weights have effect by selecting a few states and ignoring others
   const auto states = std::vector{
@@ -0,0 +1,96 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "beluga/algorithm/index_resample.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+using Particles = beluga::TupleVector<std::tuple<int, beluga::Weight>>;
+
+TEST(IndexResample, SystematicIndicesAllWeightOnOneParticle) {
+  const auto weights = std::vector{0.0, 3.0, 0.0};
+  auto indices = beluga::ResampleIndices{};
+  auto engine = std::mt19937{42};
+  beluga::systematic_resample_indices(weights, 8, indices, engine);
+  ASSERT_EQ(indices.size(), 8);
+  for (const auto index : indices) {
+    EXPECT_EQ(index, 1);
+  }
+}
+
+TEST(IndexResample, SystematicIndicesAscendingAndProportional) {
+  const auto weights = std::vector{1.0, 1.0, 2.0};
+  auto indices = beluga::ResampleIndices{};
+  auto engine = std::mt19937{42};
+  beluga::systematic_resample_indices(weights, 400, indices, engine);
+  ASSERT_EQ(indices.size(), 400);
+  ASSERT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+  // Systematic sampling reproduces the weight proportions up to one sample.
+  EXPECT_NEAR(static_cast<double>(std::count(indices.begin(), indices.end(), 2U)), 200.0, 1.0);
+}
+
+TEST(IndexResample, MultinomialIndicesAscendingAndInRange) {
+  const auto weights = std::vector{0.25, 0.5, 0.25};
+  auto indices = beluga::ResampleIndices{};
+  auto engine = std::mt19937{42};
+  beluga::multinomial_resample_indices(weights, 1000, indices, engine);
+  ASSERT_EQ(indices.size(), 1000);
+  ASSERT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+  EXPECT_LT(indices.back(), 3U);
+  // The dominant weight should be the most sampled by a wide margin.
+  EXPECT_GT(std::count(indices.begin(), indices.end(), 1U), 400);
+}
+
+TEST(IndexResample, ApplyGathersAllColumns) {
+  auto input = Particles{};
+  input.push_back({10, 0.1});
+  input.push_back({20, 0.2});
+  input.push_back({30, 0.3});
+  auto output = Particles{};
+  const auto indices = beluga::ResampleIndices{2, 0, 2, 1};
+  beluga::apply_resample_indices(input, output, indices);
+  ASSERT_EQ(output.size(), 4);
+  const auto states = std::vector<int>{output.span<0>().begin(), output.span<0>().end()};
+  ASSERT_THAT(states, testing::ElementsAre(30, 10, 30, 20));
+  const auto weights = std::vector<double>{output.span<1>().begin(), output.span<1>().end()};
+  ASSERT_THAT(weights, testing::ElementsAre(0.3, 0.1, 0.3, 0.2));
+}
+
+TEST(IndexResample, ResamplesWithUnitWeights) {
+  auto input = Particles{};
+  input.push_back({1, 0.0});
+  input.push_back({2, 3.0});
+  input.push_back({3, 0.0});
+  auto output = Particles{};
+  auto engine = std::mt19937{42};
+  beluga::index_resample(input, output, 8, engine);
+  ASSERT_EQ(output.size(), 8);
+  for (auto&& [state, weight] : output) {
+    EXPECT_EQ(state, 2);
+    EXPECT_EQ(weight, 1.0);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,63 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include <beluga/algorithm/latency_budget_controller.hpp>
+
+namespace {
+
+using namespace std::chrono_literals;
+
+TEST(LatencyBudgetController, StartsAtMaximumCeiling) {
+  auto controller = beluga::LatencyBudgetController{10ms, 500, 2000};
+  ASSERT_EQ(controller.ceiling(), 2000);
+}
+
+TEST(LatencyBudgetController, TightensCeilingWhenOverBudget) {
+  // 2000 particles took 20ms (10us each), so only 1000 fit in the 10ms target.
+  auto controller = beluga::LatencyBudgetController{10ms, 500, 2000, 1.0};
+  ASSERT_EQ(controller(20ms, 2000), 1000);
+}
+
+TEST(LatencyBudgetController, RelaxesCeilingWhenUnderBudget) {
+  auto controller = beluga::LatencyBudgetController{10ms, 500, 2000, 1.0};
+  ASSERT_EQ(controller(20ms, 2000), 1000);
+  // The platform freed up: the same particle count now takes a quarter of the time.
+  ASSERT_EQ(controller(5ms, 1000), 2000);
+}
+
+TEST(LatencyBudgetController, CeilingStaysWithinBounds) {
+  auto controller = beluga::LatencyBudgetController{10ms, 500, 2000, 1.0};
+  ASSERT_EQ(controller(1000ms, 2000), 500);
+  ASSERT_EQ(controller(1us, 2000), 2000);
+}
+
+TEST(LatencyBudgetController, IgnoresEmptyOrUninstrumentedUpdates) {
+  auto controller = beluga::LatencyBudgetController{10ms, 500, 2000, 1.0};
+  // No particles processed, or instrumentation compiled out (zero duration).
+  ASSERT_EQ(controller(10ms, 0), 2000);
+  ASSERT_EQ(controller(0ms, 2000), 2000);
+}
+
+TEST(LatencyBudgetController, ResetRestoresMaximumCeiling) {
+  auto controller = beluga::LatencyBudgetController{10ms, 500, 2000, 1.0};
+  ASSERT_EQ(controller(20ms, 2000), 1000);
+  controller.reset();
+  ASSERT_EQ(controller.ceiling(), 2000);
+}
+
+}  // namespace
@@ -0,0 +1,74 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <execution>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include "beluga/algorithm/parallel_resample.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+TEST(ParallelResample, ProducesRequestedCount) {
+  auto input = std::vector{1, 2, 3};
+  auto output = std::vector<int>{};
+  auto engine = std::mt19937{42};
+  beluga::parallel_resample(std::execution::seq, input, output, 10, engine);
+  ASSERT_EQ(output.size(), 10);
+}
+
+TEST(ParallelResample, AllWeightOnOneParticle) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::Weight>>{};
+  input.push_back({1, 0.0});
+  input.push_back({2, 3.0});
+  input.push_back({3, 0.0});
+  auto output = beluga::TupleVector<std::tuple<int, beluga::Weight>>{};
+  auto engine = std::mt19937{42};
+  beluga::parallel_resample(std::execution::par, input, output, 8, engine);
+  ASSERT_EQ(output.size(), 8);
+  for (auto&& [state, weight] : output) {
+    EXPECT_EQ(state, 2);
+    EXPECT_EQ(weight, 1.0);
+  }
+}
+
+TEST(ParallelResample, MatchesSequentialResult) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::Weight>>{};
+  auto generator = std::mt19937{1234};
+  auto distribution = std::uniform_real_distribution<double>{0.1, 1.0};
+  for (int i = 0; i < 100; ++i) {
+    input.push_back({i, distribution(generator)});
+  }
+  auto sequential_output = beluga::TupleVector<std::tuple<int, beluga::Weight>>{};
+  auto parallel_output = beluga::TupleVector<std::tuple<int, beluga::Weight>>{};
+  auto sequential_engine = std::mt19937{42};
+  auto parallel_engine = std::mt19937{42};
+  beluga::parallel_resample(std::execution::seq, input, sequential_output, 200, sequential_engine);
+  beluga::parallel_resample(std::execution::par, input, parallel_output, 200, parallel_engine);
+  ASSERT_EQ(sequential_output.size(), parallel_output.size());
+  auto it = parallel_output.begin();
+  for (auto&& particle : sequential_output) {
+    EXPECT_EQ(std::get<0>(particle), std::get<0>(*it));
+    ++it;
+  }
+}
+
+}  // namespace
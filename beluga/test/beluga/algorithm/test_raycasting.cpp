@@ -15,7 +15,9 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstddef>
 #include <optional>
+#include <vector>
 
 #include <sophus/common.hpp>
 #include <sophus/se2.hpp>
@@ -130,6 +132,37 @@ TEST(Raycasting, NonIdentityGridOrigin) {
   }
 }
 
+TEST(Raycasting, FanMatchesIndividualCasts) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  constexpr double kMaxRange = 5.;
+  const auto pose = Sophus::SE2d{0., Eigen::Vector2d{0., 1.}};
+  const auto ray = Ray2d{grid, pose, kMaxRange};
+
+  auto bearings = std::vector<Sophus::SO2d>{};
+  constexpr int kBearingCount = 16;
+  for (int i = 0; i < kBearingCount; ++i) {
+    bearings.emplace_back(2. * Sophus::Constants<double>::pi() * i / kBearingCount);
+  }
+
+  auto results = std::vector<std::optional<double>>{};
+  ray.cast_fan(bearings, results);
+
+  ASSERT_EQ(results.size(), bearings.size());
+  for (std::size_t i = 0; i < bearings.size(); ++i) {
+    EXPECT_EQ(results[i], ray.cast(bearings[i])) << "bearing index " << i;
+  }
+}
+
 TEST(BaselineRaycasting, Nominal) {
   constexpr double kResolution = 0.5;
   // Note that axes are:
@@ -0,0 +1,69 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include "beluga/algorithm/voxel_downsample.hpp"
+
+namespace {
+
+TEST(VoxelDownsample, ReducesCoVoxelPointsToTheirCentroid) {
+  const std::vector<Eigen::Vector2d> points = {{0.1, 0.1}, {0.3, 0.2}, {0.2, 0.3}};
+  const auto centroids = beluga::voxel_downsample<2>(points, 0.5);
+  ASSERT_EQ(centroids.size(), 1UL);
+  EXPECT_NEAR(centroids.front().x(), 0.2, 1e-12);
+  EXPECT_NEAR(centroids.front().y(), 0.2, 1e-12);
+}
+
+TEST(VoxelDownsample, KeepsPointsInDistinctVoxelsApart) {
+  const std::vector<Eigen::Vector2d> points = {{0.1, 0.1}, {1.6, 1.6}, {3.2, 0.1}};
+  const auto centroids = beluga::voxel_downsample<2>(points, 0.5);
+  ASSERT_EQ(centroids.size(), 3UL);
+}
+
+TEST(VoxelDownsample, ReportsMultiplicityPerVoxel) {
+  const std::vector<Eigen::Vector2d> points = {{0.1, 0.1}, {0.3, 0.2}, {0.2, 0.3}, {1.6, 1.6}};
+  const auto centroids = beluga::voxel_downsample_with_multiplicity<2>(points, 0.5);
+  ASSERT_EQ(centroids.size(), 2UL);
+  std::size_t total = 0;
+  for (const auto& [centroid, count] : centroids) {
+    total += count;
+    if (count == 3UL) {
+      EXPECT_NEAR(centroid.x(), 0.2, 1e-12);
+      EXPECT_NEAR(centroid.y(), 0.2, 1e-12);
+    } else {
+      EXPECT_EQ(count, 1UL);
+      EXPECT_NEAR(centroid.x(), 1.6, 1e-12);
+    }
+  }
+  EXPECT_EQ(total, points.size());
+}
+
+TEST(VoxelDownsample, SupportsThreeDimensionalClouds) {
+  const std::vector<Eigen::Vector3d> points = {{0.1, 0.1, 0.1}, {0.2, 0.2, 0.2}, {0.1, 0.1, 1.6}};
+  const auto centroids = beluga::voxel_downsample<3>(points, 0.5);
+  ASSERT_EQ(centroids.size(), 2UL);
+}
+
+TEST(VoxelDownsample, EmptyCloud) {
+  const std::vector<Eigen::Vector2d> points;
+  EXPECT_TRUE(beluga::voxel_downsample<2>(points, 0.5).empty());
+}
+
+}  // namespace
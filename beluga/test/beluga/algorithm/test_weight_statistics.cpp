@@ -0,0 +1,127 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <functional>
+#include <limits>
+#include <tuple>
+#include <vector>
+
+#include "beluga/actions/normalize.hpp"
+#include "beluga/algorithm/effective_sample_size.hpp"
+#include "beluga/algorithm/weight_statistics.hpp"
+#include "beluga/primitives.hpp"
+
+namespace {
+
+TEST(WeightStatistics, EmptyRange) {
+  const auto statistics = beluga::weight_statistics(std::vector<double>{});
+  EXPECT_EQ(statistics.sum, 0.0);
+  EXPECT_EQ(statistics.squared_sum, 0.0);
+  EXPECT_EQ(statistics.count, 0);
+  EXPECT_EQ(statistics.average(), 0.0);
+}
+
+TEST(WeightStatistics, SinglePassValues) {
+  const auto statistics = beluga::weight_statistics(std::vector{1.0, 2.0, 3.0});
+  EXPECT_EQ(statistics.sum, 6.0);
+  EXPECT_EQ(statistics.squared_sum, 14.0);
+  EXPECT_EQ(statistics.count, 3);
+  EXPECT_EQ(statistics.average(), 2.0);
+}
+
+TEST(WeightStatistics, FromParticleRange) {
+  const auto input = std::vector<std::tuple<int, beluga::Weight>>{{5, 0.5}, {6, 1.5}};
+  const auto statistics = beluga::weight_statistics(input);
+  EXPECT_EQ(statistics.sum, 2.0);
+  EXPECT_EQ(statistics.squared_sum, 2.5);
+  EXPECT_EQ(statistics.count, 2);
+}
+
+TEST(WeightStatistics, EffectiveSampleSizeMatchesRangeOverload) {
+  const auto weights = std::vector{0.1, 0.4, 0.3, 0.2};
+  const auto statistics = beluga::weight_statistics(weights);
+  EXPECT_DOUBLE_EQ(beluga::effective_sample_size(statistics), beluga::effective_sample_size(weights));
+}
+
+TEST(WeightStatistics, EntropyOfUniformWeights) {
+  const auto statistics = beluga::weight_statistics(std::vector(8UL, 0.25));
+  EXPECT_NEAR(statistics.entropy(), 3.0, 1e-12);  // log2(8)
+  EXPECT_EQ(statistics.max_min_ratio(), 1.0);
+  EXPECT_EQ(statistics.histogram.front(), 8);
+}
+
+TEST(WeightStatistics, EntropyIsScaleInvariant) {
+  const auto weights = std::vector{0.1, 0.4, 0.3, 0.2};
+  auto scaled = weights;
+  for (auto& weight : scaled) {
+    weight *= 1000.0;
+  }
+  const auto statistics = beluga::weight_statistics(weights);
+  const auto scaled_statistics = beluga::weight_statistics(scaled);
+  EXPECT_NEAR(statistics.entropy(), scaled_statistics.entropy(), 1e-9);
+}
+
+TEST(WeightStatistics, DegenerateWeights) {
+  auto weights = std::vector(7UL, 1e-6);
+  weights.push_back(1.0);
+  const auto statistics = beluga::weight_statistics(weights);
+  EXPECT_LT(statistics.entropy(), 0.1);
+  EXPECT_NEAR(statistics.max_min_ratio(), 1e6, 1.0);
+  EXPECT_EQ(statistics.histogram.front(), 1);  // only the peak is near the peak
+  EXPECT_EQ(statistics.histogram.back(), 7);   // everyone else is in the catch-all bucket
+}
+
+TEST(WeightStatistics, ZeroWeights) {
+  const auto statistics = beluga::weight_statistics(std::vector{0.5, 0.0});
+  EXPECT_EQ(statistics.max_min_ratio(), std::numeric_limits<double>::infinity());
+  EXPECT_EQ(statistics.histogram.back(), 1);
+}
+
+TEST(WeightStatistics, HistogramReanchorsOnNewPeak) {
+  auto statistics = beluga::WeightStatistics{};
+  statistics.add(0.25);
+  statistics.add(1.0);  // raising the peak moves 0.25 two octaves down
+  EXPECT_EQ(statistics.histogram[0], 1);
+  EXPECT_EQ(statistics.histogram[2], 1);
+}
+
+TEST(WeightStatistics, MergeMatchesSequentialAccumulation) {
+  const auto weights = std::vector{0.25, 0.125, 1.0, 0.5};
+  auto first = beluga::weight_statistics(std::vector{0.25, 0.125});
+  const auto second = beluga::weight_statistics(std::vector{1.0, 0.5});
+  first.merge(second);
+  const auto expected = beluga::weight_statistics(weights);
+  EXPECT_EQ(first.top_exponent, expected.top_exponent);
+  for (std::size_t index = 0; index < beluga::WeightStatistics::kHistogramBucketCount; ++index) {
+    EXPECT_EQ(first.histogram[index], expected.histogram[index]) << "bucket " << index;
+  }
+  EXPECT_NEAR(first.entropy(), expected.entropy(), 1e-12);
+  EXPECT_EQ(first.max_min_ratio(), expected.max_min_ratio());
+}
+
+TEST(WeightStatistics, ComputedByNormalize) {
+  auto input = std::vector<std::tuple<int, beluga::Weight>>{{5, 1.0}, {6, 3.0}};
+  auto statistics = beluga::WeightStatistics{};
+  input |= beluga::actions::normalize(std::ref(statistics));
+  EXPECT_EQ(statistics.sum, 4.0);
+  EXPECT_EQ(statistics.squared_sum, 10.0);
+  EXPECT_EQ(statistics.count, 2);
+  ASSERT_EQ(std::get<1>(input.front()), 0.25);
+  ASSERT_EQ(std::get<1>(input.back()), 0.75);
+}
+
+}  // namespace
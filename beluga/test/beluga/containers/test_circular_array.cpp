@@ -189,6 +189,9 @@ TEST(CircularArrayTest, Swap) {
 
 TEST(CircularArrayTest, RangeLike) {
   static_assert(ranges::random_access_range<beluga::CircularArray<int, 5>>);
+  // Circular arrays map logical indices onto storage non-linearly, so their
+  // iterators must not be strengthened to contiguous despite exposing `data()`.
+  static_assert(!ranges::contiguous_range<beluga::CircularArray<int, 5>>);
   const auto input_array = beluga::CircularArray<int, 5>{{1, 2, 3, 4, 5}};
   const auto output_array = input_array | ranges::views::stride(2) |
                             ranges::views::transform([](int x) { return x * x; }) |
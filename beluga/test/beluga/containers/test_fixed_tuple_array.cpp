@@ -0,0 +1,65 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <tuple>
+
+#include <range/v3/algorithm/equal.hpp>
+#include <range/v3/view/filter.hpp>
+
+#include "beluga/containers/fixed_tuple_array.hpp"
+
+namespace {
+
+TEST(FixedCapacityVector, BasicOperations) {
+  auto vector = beluga::FixedCapacityVector<int, 4>{};
+  ASSERT_TRUE(vector.empty());
+  ASSERT_EQ(vector.capacity(), 4);
+  vector.push_back(1);
+  vector.push_back(2);
+  ASSERT_EQ(vector.size(), 2);
+  EXPECT_EQ(vector[0], 1);
+  EXPECT_EQ(vector[1], 2);
+  vector.clear();
+  ASSERT_TRUE(vector.empty());
+}
+
+TEST(FixedTupleArray, PushBack) {
+  auto sequence = beluga::FixedTupleArray<std::tuple<int, double>, 4>{};
+  sequence.push_back(std::make_tuple(1, 2.0));
+  sequence.push_back(std::make_tuple(3, 4.0));
+  const auto expected = std::array{std::make_tuple(1, 2.0), std::make_tuple(3, 4.0)};
+  ASSERT_TRUE(ranges::equal(expected, sequence));
+}
+
+TEST(FixedTupleArray, AssignFromRange) {
+  const auto input = std::array{std::make_tuple(1, 1.0), std::make_tuple(2, 2.0), std::make_tuple(3, 3.0)};
+  auto sequence = beluga::FixedTupleArray<std::tuple<int, double>, 8>{};
+  sequence.assign_range(input);
+  ASSERT_TRUE(ranges::equal(input, sequence));
+  sequence.assign_range(input | ranges::views::filter([](const auto& value) { return std::get<0>(value) != 2; }));
+  ASSERT_EQ(sequence.size(), 2);
+}
+
+TEST(FixedTupleArray, ResizeWithinCapacity) {
+  auto sequence = beluga::FixedTupleArray<std::tuple<int, double>, 8>{};
+  sequence.resize(5);
+  ASSERT_EQ(sequence.size(), 5);
+  sequence.resize(2);
+  ASSERT_EQ(sequence.size(), 2);
+}
+
+}  // namespace
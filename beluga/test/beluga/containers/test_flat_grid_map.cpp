@@ -0,0 +1,94 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <stdexcept>
+#include <utility>
+
+#include <Eigen/Core>
+
+#include "beluga/containers/flat_grid_map.hpp"
+
+namespace {
+
+TEST(FlatGridMap, InsertAndFind) {
+  auto map = beluga::FlatGridMap<Eigen::Vector2i, int>{};
+  EXPECT_TRUE(map.empty());
+  map[Eigen::Vector2i{1, 2}] = 10;
+  map[Eigen::Vector2i{-3, 4}] = 20;
+  EXPECT_EQ(map.size(), 2);
+
+  const auto& const_map = map;
+  const auto hit = const_map.find(Eigen::Vector2i{1, 2});
+  ASSERT_NE(hit, const_map.end());
+  EXPECT_EQ(hit->second, 10);
+  EXPECT_EQ(const_map.find(Eigen::Vector2i{0, 0}), const_map.end());
+}
+
+TEST(FlatGridMap, AtThrowsOnMissingKey) {
+  auto map = beluga::FlatGridMap<Eigen::Vector2i, int>{};
+  map[Eigen::Vector2i{1, 1}] = 42;
+  EXPECT_EQ(map.at(Eigen::Vector2i{1, 1}), 42);
+  EXPECT_THROW(static_cast<void>(map.at(Eigen::Vector2i{2, 2})), std::out_of_range);
+}
+
+TEST(FlatGridMap, SubscriptOverwritesExistingValue) {
+  auto map = beluga::FlatGridMap<Eigen::Vector2i, int>{};
+  map[Eigen::Vector2i{5, 5}] = 1;
+  map[Eigen::Vector2i{5, 5}] = 2;
+  EXPECT_EQ(map.size(), 1);
+  EXPECT_EQ(map.at(Eigen::Vector2i{5, 5}), 2);
+}
+
+TEST(FlatGridMap, BulkBuildKeepsLastDuplicate) {
+  auto entries = beluga::FlatGridMap<Eigen::Vector2i, int>::storage_type{};
+  entries.emplace_back(Eigen::Vector2i{0, 0}, 1);
+  entries.emplace_back(Eigen::Vector2i{1, 0}, 2);
+  entries.emplace_back(Eigen::Vector2i{0, 0}, 3);
+  const auto map = beluga::FlatGridMap<Eigen::Vector2i, int>{std::move(entries)};
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_EQ(map.at(Eigen::Vector2i{0, 0}), 3);
+  EXPECT_EQ(map.at(Eigen::Vector2i{1, 0}), 2);
+}
+
+TEST(FlatGridMap, GrowsBeyondInitialCapacity) {
+  auto map = beluga::FlatGridMap<Eigen::Vector2i, int>{};
+  for (int x = -20; x < 20; ++x) {
+    for (int y = -20; y < 20; ++y) {
+      map[Eigen::Vector2i{x, y}] = x * 100 + y;
+    }
+  }
+  EXPECT_EQ(map.size(), 1600);
+  for (int x = -20; x < 20; ++x) {
+    for (int y = -20; y < 20; ++y) {
+      ASSERT_EQ(map.at(Eigen::Vector2i{x, y}), x * 100 + y);
+    }
+  }
+}
+
+TEST(FlatGridMap, EntriesAreContiguousInInsertionOrder) {
+  auto map = beluga::FlatGridMap<Eigen::Vector2i, int>{};
+  map[Eigen::Vector2i{1, 0}] = 1;
+  map[Eigen::Vector2i{2, 0}] = 2;
+  map[Eigen::Vector2i{3, 0}] = 3;
+  const auto& entries = map.entries();
+  ASSERT_EQ(entries.size(), 3);
+  EXPECT_EQ(entries[0].second, 1);
+  EXPECT_EQ(entries[1].second, 2);
+  EXPECT_EQ(entries[2].second, 3);
+  EXPECT_EQ(&entries[2], &entries[1] + 1);
+}
+
+}  // namespace
@@ -0,0 +1,84 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <limits>
+#include <memory_resource>
+#include <unordered_set>
+
+#include "beluga/containers/flat_hash_set.hpp"
+
+namespace {
+
+TEST(FlatHashSet, InsertAndContains) {
+  auto set = beluga::FlatHashSet<std::size_t>{};
+  EXPECT_TRUE(set.empty());
+  EXPECT_TRUE(set.insert(5));
+  EXPECT_TRUE(set.insert(25));
+  EXPECT_FALSE(set.insert(5));
+  EXPECT_EQ(set.size(), 2);
+  EXPECT_TRUE(set.contains(5));
+  EXPECT_TRUE(set.contains(25));
+  EXPECT_FALSE(set.contains(3));
+}
+
+TEST(FlatHashSet, SentinelKeyIsSupported) {
+  auto set = beluga::FlatHashSet<std::size_t>{};
+  const auto key = std::numeric_limits<std::size_t>::max();
+  EXPECT_FALSE(set.contains(key));
+  EXPECT_TRUE(set.insert(key));
+  EXPECT_FALSE(set.insert(key));
+  EXPECT_TRUE(set.contains(key));
+  EXPECT_EQ(set.size(), 1);
+}
+
+TEST(FlatHashSet, ClearRetainsCapacity) {
+  auto set = beluga::FlatHashSet<std::size_t>{1000};
+  const auto capacity = set.capacity();
+  ASSERT_GE(capacity, 1000);
+  for (std::size_t i = 0; i < 1000; ++i) {
+    set.insert(i * 31);
+  }
+  set.clear();
+  EXPECT_TRUE(set.empty());
+  EXPECT_EQ(set.capacity(), capacity);
+}
+
+TEST(FlatHashSet, GrowsBeyondInitialCapacity) {
+  auto set = beluga::FlatHashSet<std::size_t>{};
+  auto reference = std::unordered_set<std::size_t>{};
+  for (std::size_t i = 0; i < 10'000; ++i) {
+    const std::size_t key = (i * i) % 4'000;
+    EXPECT_EQ(set.insert(key), reference.insert(key).second);
+  }
+  EXPECT_EQ(set.size(), reference.size());
+  for (const auto key : reference) {
+    EXPECT_TRUE(set.contains(key));
+  }
+}
+
+TEST(FlatHashSet, SupportsPolymorphicAllocators) {
+  auto arena = std::pmr::monotonic_buffer_resource{};
+  auto set = beluga::FlatHashSet<std::size_t, std::pmr::polymorphic_allocator<std::size_t>>{
+      100, std::pmr::polymorphic_allocator<std::size_t>{&arena}};
+  for (std::size_t i = 0; i < 1'000; ++i) {
+    set.insert(i * 17);
+  }
+  EXPECT_EQ(set.size(), 1'000);
+  EXPECT_TRUE(set.contains(17));
+}
+
+}  // namespace
@@ -0,0 +1,86 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <vector>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/range/concepts.hpp>
+
+#include <sophus/se2.hpp>
+
+#include "beluga/containers/se2_column_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/testing/sophus_matchers.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+using beluga::testing::SE2Near;
+using Constants = Sophus::Constants<double>;
+
+TEST(SE2ColumnVector, PushBackAndRead) {
+  auto poses = beluga::SE2ColumnVector<double>{};
+  poses.push_back(Sophus::SE2d{Sophus::SO2d{Constants::pi() / 2}, Eigen::Vector2d{1.0, 2.0}});
+  ASSERT_EQ(poses.size(), 1);
+  ASSERT_THAT(poses[0], SE2Near(Sophus::SO2d{Constants::pi() / 2}, Eigen::Vector2d{1.0, 2.0}, 1e-9));
+}
+
+TEST(SE2ColumnVector, WriteThroughProxy) {
+  auto poses = beluga::SE2ColumnVector<double>{2};
+  poses[1] = Sophus::SE2d{Sophus::SO2d{0.5}, Eigen::Vector2d{3.0, 4.0}};
+  ASSERT_THAT(poses[0], SE2Near(Sophus::SO2d{0.0}, Eigen::Vector2d{0.0, 0.0}, 1e-9));
+  ASSERT_THAT(static_cast<const decltype(poses)&>(poses)[1], SE2Near(Sophus::SO2d{0.5}, Eigen::Vector2d{3.0, 4.0}, 1e-9));
+}
+
+TEST(SE2ColumnVector, Columns) {
+  auto poses = beluga::SE2ColumnVector<double>{};
+  poses.push_back(Sophus::SE2d{Sophus::SO2d{0.0}, Eigen::Vector2d{1.0, 2.0}});
+  poses.push_back(Sophus::SE2d{Sophus::SO2d{0.0}, Eigen::Vector2d{3.0, 4.0}});
+  ASSERT_EQ(poses.x().size(), 2);
+  EXPECT_DOUBLE_EQ(poses.x()[1], 3.0);
+  EXPECT_DOUBLE_EQ(poses.y()[1], 4.0);
+  EXPECT_DOUBLE_EQ(poses.cos_theta()[0], 1.0);
+  EXPECT_DOUBLE_EQ(poses.sin_theta()[0], 0.0);
+}
+
+TEST(SE2ColumnVector, CopyFromPoseRange) {
+  const auto input = std::vector{
+      Sophus::SE2d{Sophus::SO2d{0.1}, Eigen::Vector2d{1.0, 2.0}},
+      Sophus::SE2d{Sophus::SO2d{0.2}, Eigen::Vector2d{3.0, 4.0}},
+  };
+  auto poses = beluga::SE2ColumnVector<double>{input.size()};
+  ranges::copy(input, poses.begin());
+  ASSERT_THAT(poses[0], SE2Near(input[0].so2(), input[0].translation(), 1e-9));
+  ASSERT_THAT(poses[1], SE2Near(input[1].so2(), input[1].translation(), 1e-9));
+}
+
+TEST(SE2ColumnVector, ModelsRandomAccessRange) {
+  static_assert(ranges::random_access_range<beluga::SE2ColumnVector<double>>);
+  static_assert(ranges::sized_range<beluga::SE2ColumnVector<double>>);
+}
+
+TEST(DecomposedTupleVector, ParticleStorage) {
+  auto particles = beluga::DecomposedTupleVector<std::tuple<Sophus::SE2d, beluga::Weight>>{};
+  particles.push_back(std::make_tuple(Sophus::SE2d{Sophus::SO2d{0.5}, Eigen::Vector2d{1.0, 2.0}}, beluga::Weight(0.5)));
+  ASSERT_EQ(particles.size(), 1);
+  auto states = beluga::views::states(particles);
+  ASSERT_THAT(
+      static_cast<Sophus::SE2d>(*states.begin()), SE2Near(Sophus::SO2d{0.5}, Eigen::Vector2d{1.0, 2.0}, 1e-9));
+}
+
+}  // namespace
@@ -17,6 +17,8 @@
 
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <memory_resource>
 #include <ostream>
 #include <tuple>
 #include <type_traits>
@@ -267,4 +269,64 @@ TEST(TupleVectorTest, AssignFromNonSizedRangeReserved) {
   ASSERT_TRUE(ranges::equal(input, output));
 }
 
+TEST(TupleVectorTest, AppendFromSizedRange) {
+  const auto input = std::array{std::make_tuple(2, 2.0), std::make_tuple(3, 3.0)};
+  auto output = beluga::TupleVector<std::tuple<int, double>>{};
+  output.push_back(std::make_tuple(1, 1.0));
+  output.append_range(input);
+  const auto expected =
+      std::array{std::make_tuple(1, 1.0), std::make_tuple(2, 2.0), std::make_tuple(3, 3.0)};
+  ASSERT_TRUE(ranges::equal(expected, output));
+}
+
+TEST(TupleVectorTest, AppendFromNonSizedRange) {
+  const auto input = std::array{std::make_tuple(1, 1.0), std::make_tuple(2, 2.0), std::make_tuple(3, 3.0)};
+  auto output = beluga::TupleVector<std::tuple<int, double>>{};
+  output.append_range(input | ranges::views::filter([](const auto& value) { return std::get<0>(value) != 2; }));
+  const auto expected = std::array{std::make_tuple(1, 1.0), std::make_tuple(3, 3.0)};
+  ASSERT_TRUE(ranges::equal(expected, output));
+}
+
+TEST(TupleVectorTest, StorageStats) {
+  auto sequence = beluga::TupleVector<std::tuple<int, double>>{};
+  ASSERT_EQ(sequence.storage_stats().bytes_reserved, 0);
+  sequence.reserve(10);
+  ASSERT_EQ(sequence.storage_stats().bytes_reserved, 10 * (sizeof(int) + sizeof(double)));
+}
+
+TEST(TupleVectorTest, ColumnDataAndSpan) {
+  auto sequence = beluga::TupleVector<std::tuple<int, double>>{};
+  sequence.push_back(std::make_tuple(1, 2.0));
+  sequence.push_back(std::make_tuple(3, 4.0));
+  ASSERT_EQ(sequence.data<0>(), sequence.span<0>().data());
+  ASSERT_EQ(sequence.span<0>().size(), 2);
+  EXPECT_EQ(sequence.span<0>()[0], 1);
+  EXPECT_EQ(sequence.span<0>()[1], 3);
+  EXPECT_EQ(sequence.span<1>()[0], 2.0);
+  EXPECT_EQ(sequence.span<1>()[1], 4.0);
+}
+
+TEST(TupleVectorTest, ColumnsAreCacheLineAligned) {
+  auto sequence = beluga::TupleVector<std::tuple<int, double>>{100};
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(sequence.data<0>()) % 64, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(sequence.data<1>()) % 64, 0);
+}
+
+TEST(TupleVectorTest, PolymorphicAllocator) {
+  std::array<std::byte, 1024> buffer;
+  std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size()};
+  auto sequence = beluga::TupleVector<std::tuple<int, double>, std::pmr::polymorphic_allocator<std::byte>>{&resource};
+  sequence.push_back(std::make_tuple(1, 2.0));
+  sequence.push_back(std::make_tuple(3, 4.0));
+  const auto expected = std::array{std::make_tuple(1, 2.0), std::make_tuple(3, 4.0)};
+  ASSERT_TRUE(ranges::equal(expected, sequence));
+}
+
+TEST(TupleVectorTest, PolymorphicAllocatorWithSize) {
+  std::array<std::byte, 1024> buffer;
+  std::pmr::monotonic_buffer_resource resource{buffer.data(), buffer.size()};
+  auto sequence = beluga::TupleVector<std::tuple<int, double>, std::pmr::polymorphic_allocator<std::byte>>{3, &resource};
+  ASSERT_EQ(sequence.size(), 3);
+}
+
 }  // namespace
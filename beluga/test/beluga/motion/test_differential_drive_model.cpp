@@ -16,10 +16,13 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <cstddef>
 #include <functional>
 #include <random>
 #include <tuple>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include <Eigen/Core>
 #include <sophus/common.hpp>
@@ -28,6 +31,7 @@
 
 #include <range/v3/view/common.hpp>
 #include <range/v3/view/generate.hpp>
+#include <range/v3/view/span.hpp>
 #include <range/v3/view/take_exactly.hpp>
 
 #include "beluga/motion/differential_drive_model.hpp"
@@ -230,4 +234,71 @@ TEST(DifferentialDriveModelSamples, RotateTranslateRotateThirdQuadrant) {
   ASSERT_NEAR(stddev, std::sqrt(alpha * rotation_variance), tolerance);
 }
 
+TEST_F(DifferentialDriveModelTest, BatchMatchesPerStateWithoutNoise) {
+  constexpr double kTolerance = 1e-9;
+  const auto control_action = std::make_tuple(SE2d{SO2d{0.0}, Vector2d{1.0, 0.0}}, SE2d{SO2d{0.0}, Vector2d{0.0, 0.0}});
+  const auto state_sampling_function = motion_model_(control_action);
+  auto states = std::vector<SE2d>{
+      SE2d{SO2d{0.0}, Vector2d{0.0, 0.0}},
+      SE2d{SO2d{Constants::pi() / 2}, Vector2d{1.0, 2.0}},
+      SE2d{SO2d{-Constants::pi() / 4}, Vector2d{-3.0, 0.5}},
+  };
+  auto expected = states;
+  for (auto& state : expected) {
+    state = state_sampling_function(state, generator_);
+  }
+  // Without noise both forms are deterministic, so the vectorized composition
+  // must reproduce the per-state Sophus composition exactly.
+  state_sampling_function(
+      ranges::make_span(states.data(), static_cast<std::ptrdiff_t>(states.size())), generator_);
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    ASSERT_THAT(states[i], SE2Near(expected[i], kTolerance));
+  }
+}
+
+TEST(DifferentialDriveModelFloat, TranslateWithoutNoise) {
+  constexpr float kTolerance = 0.001F;
+  // Control actions stay double precision; only the particle states are float.
+  const auto motion_model = beluga::DifferentialDriveModelF{beluga::DifferentialDriveModelParam{0.0, 0.0, 0.0, 0.0}};
+  auto generator = std::mt19937{std::random_device()()};
+  const auto control_action = std::make_tuple(SE2d{SO2d{0.0}, Vector2d{1.0, 0.0}}, SE2d{SO2d{0.0}, Vector2d{0.0, 0.0}});
+  const auto state_sampling_function = motion_model(control_action);
+  const auto result = state_sampling_function(Sophus::SE2f{Sophus::SO2f{0.0F}, Eigen::Vector2f{2.0F, 0.0F}}, generator);
+  static_assert(std::is_same_v<std::decay_t<decltype(result)>, Sophus::SE2f>);
+  ASSERT_NEAR(result.translation().x(), 3.0F, kTolerance);
+  ASSERT_NEAR(result.translation().y(), 0.0F, kTolerance);
+}
+
+TEST(DifferentialDriveModelFloat, BatchMatchesPerStateWithoutNoise) {
+  constexpr float kTolerance = 1e-5F;
+  const auto motion_model = beluga::DifferentialDriveModelF{beluga::DifferentialDriveModelParam{0.0, 0.0, 0.0, 0.0}};
+  auto generator = std::mt19937{std::random_device()()};
+  const auto control_action = std::make_tuple(SE2d{SO2d{0.0}, Vector2d{1.0, 0.0}}, SE2d{SO2d{0.0}, Vector2d{0.0, 0.0}});
+  const auto state_sampling_function = motion_model(control_action);
+  auto states = std::vector<Sophus::SE2f>{
+      Sophus::SE2f{Sophus::SO2f{0.0F}, Eigen::Vector2f{0.0F, 0.0F}},
+      Sophus::SE2f{Sophus::SO2f{Sophus::Constants<float>::pi() / 2}, Eigen::Vector2f{1.0F, 2.0F}},
+  };
+  auto expected = states;
+  for (auto& state : expected) {
+    state = state_sampling_function(state, generator);
+  }
+  state_sampling_function(ranges::make_span(states.data(), static_cast<std::ptrdiff_t>(states.size())), generator);
+  for (std::size_t i = 0; i < states.size(); ++i) {
+    ASSERT_NEAR(states[i].translation().x(), expected[i].translation().x(), kTolerance);
+    ASSERT_NEAR(states[i].translation().y(), expected[i].translation().y(), kTolerance);
+    ASSERT_NEAR(states[i].so2().log(), expected[i].so2().log(), kTolerance);
+  }
+}
+
+TEST(DifferentialDriveModelSamples, NearIdentityQuery) {
+  constexpr double kFloor = 1e-3;
+  const auto motion_model = UUT{beluga::DifferentialDriveModelParam{0.1, 0.1, 0.1, 0.1}};
+  const auto pose = SE2d{SO2d{Constants::pi() / 3}, Vector2d{2.0, 5.0}};
+  // A stationary control conditions every increment to a near-zero mean and spread.
+  ASSERT_TRUE(motion_model(std::make_tuple(pose, pose)).is_near_identity(kFloor, kFloor));
+  const auto moved = pose * SE2d{SO2d{0.0}, Vector2d{0.5, 0.0}};
+  ASSERT_FALSE(motion_model(std::make_tuple(moved, pose)).is_near_identity(kFloor, kFloor));
+}
+
 }  // namespace
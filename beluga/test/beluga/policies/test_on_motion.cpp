@@ -31,6 +31,26 @@ TEST(OnMotionPolicy, TriggerOnMotion) {
   ASSERT_TRUE(policy(pose2));   // Second pose triggers the policy
 }
 
+TEST(OnMotionPolicy, TriggerNearThresholds) {
+  auto policy = beluga::policies::on_motion(0.1, 0.05);
+  const Sophus::SE2d pose1(Sophus::SO2d(0.0), Eigen::Vector2d(1.0, 2.0));
+  const Sophus::SE2d pose2(Sophus::SO2d(0.0), Eigen::Vector2d(1.101, 2.0));
+  const Sophus::SE2d pose3(Sophus::SO2d(0.051), Eigen::Vector2d(1.101, 2.0));
+
+  ASSERT_TRUE(policy(pose1));  // First pose triggers the policy
+  ASSERT_TRUE(policy(pose2));  // Translation just above the threshold triggers the policy
+  ASSERT_TRUE(policy(pose3));  // Rotation just above the threshold triggers the policy
+}
+
+TEST(OnMotionPolicy, NoTriggerWithPureRotationBelowThreshold) {
+  auto policy = beluga::policies::on_motion(0.1, 0.05);
+  const Sophus::SE2d pose1(Sophus::SO2d(0.0), Eigen::Vector2d(1.0, 2.0));
+  const Sophus::SE2d pose2(Sophus::SO2d(0.049), Eigen::Vector2d(1.0, 2.0));
+
+  ASSERT_TRUE(policy(pose1));   // First pose triggers the policy
+  ASSERT_FALSE(policy(pose2));  // Rotation just below the threshold should not trigger the policy
+}
+
 TEST(OnMotionPolicy, NoTriggerWithoutMotion) {
   auto policy = beluga::policies::on_motion(0.1, 0.05);
   const Sophus::SE2d pose1(Sophus::SO2d(0.1), Eigen::Vector2d(1.0, 2.0));
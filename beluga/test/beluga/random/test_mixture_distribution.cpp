@@ -0,0 +1,59 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+#include "beluga/random/mixture_distribution.hpp"
+
+namespace {
+
+TEST(MixtureDistribution, SelectsComponentsByWeight) {
+  auto components = std::vector<std::normal_distribution<double>>{
+      std::normal_distribution<double>{-10.0, 0.1},
+      std::normal_distribution<double>{+10.0, 0.1},
+  };
+  auto distribution = beluga::MixtureDistribution{std::move(components), std::vector<double>{1.0, 3.0}};
+  auto engine = std::mt19937{42};
+  constexpr std::size_t kCount = 10'000;
+  std::size_t positive = 0;
+  for (std::size_t i = 0; i < kCount; ++i) {
+    const auto sample = distribution(engine);
+    ASSERT_LT(std::min(std::abs(sample - 10.0), std::abs(sample + 10.0)), 1.0);
+    if (sample > 0.0) {
+      ++positive;
+    }
+  }
+  EXPECT_NEAR(static_cast<double>(positive) / static_cast<double>(kCount), 0.75, 0.03);
+}
+
+TEST(MixtureDistribution, SingleComponent) {
+  auto components = std::vector<std::uniform_real_distribution<double>>{
+      std::uniform_real_distribution<double>{2.0, 3.0},
+  };
+  auto distribution = beluga::MixtureDistribution{std::move(components), std::vector<double>{1.0}};
+  auto engine = std::mt19937{42};
+  for (std::size_t i = 0; i < 100; ++i) {
+    const auto sample = distribution(engine);
+    ASSERT_GE(sample, 2.0);
+    ASSERT_LT(sample, 3.0);
+  }
+}
+
+}  // namespace
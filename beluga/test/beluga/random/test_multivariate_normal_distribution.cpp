@@ -98,6 +98,38 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_pair(Eigen::Vector2d{3.0, 4.0}, testing::as<Eigen::Matrix2d>({{1.5, -0.3}, {-0.3, 1.5}})),
         std::make_pair(Eigen::Vector2d{5.0, 6.0}, testing::as<Eigen::Matrix2d>({{2.0, 0.7}, {0.7, 2.0}}))));
 
+TEST(MultivariateNormalDistribution, BatchSamplingMatchesDistributionStatistics) {
+  constexpr double kTolerance = 0.01;
+  const auto expected_mean = Eigen::Vector2d{3.0, 4.0};
+  const auto expected_covariance = testing::as<Eigen::Matrix2d>({{1.5, -0.3}, {-0.3, 1.5}});
+  auto generator = std::mt19937{std::random_device()()};
+  auto distribution = beluga::MultivariateNormalDistribution{expected_mean, expected_covariance};
+  const auto sequence = distribution.samples(generator, 1'000'000);
+  const auto sum = std::accumulate(sequence.begin(), sequence.end(), Eigen::Vector2d{0, 0});
+  const auto mean = Eigen::Vector2d{sum / sequence.size()};
+  ASSERT_NEAR(mean(0), expected_mean(0), kTolerance);
+  ASSERT_NEAR(mean(1), expected_mean(1), kTolerance);
+  const auto covariance = beluga::calculate_covariance(sequence, mean);
+  ASSERT_NEAR(covariance(0, 0), expected_covariance(0, 0), kTolerance);
+  ASSERT_NEAR(covariance(0, 1), expected_covariance(0, 1), kTolerance);
+  ASSERT_NEAR(covariance(1, 0), expected_covariance(1, 0), kTolerance);
+  ASSERT_NEAR(covariance(1, 1), expected_covariance(1, 1), kTolerance);
+}
+
+TEST(MultivariateNormalDistribution, BatchSamplingSE2Elements) {
+  constexpr double kTolerance = 0.001;
+  auto generator = std::mt19937{std::random_device()()};
+  auto expected_mean = Sophus::SE2d{Sophus::SO2d{1.57}, Eigen::Vector2d{1.0, 2.0}};
+  auto distribution = beluga::MultivariateNormalDistribution{expected_mean, Eigen::Matrix3d::Zero()};
+  const auto sequence = distribution.samples(generator, 10);
+  ASSERT_EQ(sequence.size(), 10U);
+  for (const auto& pose : sequence) {
+    ASSERT_NEAR(pose.so2().log(), expected_mean.so2().log(), kTolerance);
+    ASSERT_NEAR(pose.translation()(0), expected_mean.translation()(0), kTolerance);
+    ASSERT_NEAR(pose.translation()(1), expected_mean.translation()(1), kTolerance);
+  }
+}
+
 TEST(MultivariateNormalDistribution, RowVector) {
   constexpr double kTolerance = 0.001;
   auto generator = std::mt19937{std::random_device()()};
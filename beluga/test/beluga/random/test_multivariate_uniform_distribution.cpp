@@ -15,12 +15,14 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <unordered_map>
 
 #include <range/v3/range/primitives.hpp>
 #include <range/v3/view/take_exactly.hpp>
 
+#include "beluga/containers/se2_column_vector.hpp"
 #include "beluga/random/multivariate_uniform_distribution.hpp"
 #include "beluga/test/static_occupancy_grid.hpp"
 #include "beluga/testing/sophus_matchers.hpp"
@@ -123,4 +125,83 @@ TEST(MultivariateUniformDistribution, GridSomeFreeSlots) {
   ASSERT_NEAR(static_cast<double>(buckets[Sophus::Vector2d(1.5, 2.5)]) / kSize, 0.25, kTolerance);
 }
 
+TEST(MultivariateUniformDistribution, BatchSamplingIntoColumns) {
+  constexpr double kTolerance = 1e-9;
+  constexpr double kResolution = 0.5;
+  const auto origin = Sophus::SE2d{Sophus::SO2d{0.3}, Sophus::Vector2d{1.0, 2.0}};
+  const auto grid = beluga::testing::StaticOccupancyGrid<3, 3>{
+      {true, false, true,   //
+       false, true, false,  //
+       true, false, true},
+      kResolution,
+      origin,
+  };
+  auto distribution = beluga::MultivariateUniformDistribution{grid};
+  auto engine = std::mt19937{std::random_device()()};
+
+  auto columns = beluga::SE2ColumnVector<double>{};
+  distribution.samples(engine, columns, 200);
+  ASSERT_EQ(columns.size(), 200U);
+
+  const auto free_cells = *grid.cached_free_cells();
+  for (const auto& pose : columns) {
+    // The rotation columns must hold a unit complex number.
+    ASSERT_NEAR(pose.so2().unit_complex().norm(), 1.0, kTolerance);
+    // The translation must be the center of one of the free cells.
+    const auto matches_cell = [&](std::size_t index) {
+      const auto xi = static_cast<double>(index % grid.width());
+      const auto yi = static_cast<double>(index / grid.width());
+      const auto center = origin * (Sophus::Vector2d{xi + 0.5, yi + 0.5} * kResolution);
+      return (pose.translation() - center).norm() < kTolerance;
+    };
+    ASSERT_TRUE(std::any_of(free_cells.begin(), free_cells.end(), matches_cell));
+  }
+}
+
+TEST(MultivariateUniformDistribution, LowDiscrepancyBoundingRegion2d) {
+  auto region = Eigen::AlignedBox2d{};
+  region.min() = Eigen::Vector2d{3.00, -2.00};
+  region.max() = Eigen::Vector2d{5.00, 2.00};
+  auto distribution = beluga::MultivariateUniformDistribution{region, beluga::low_discrepancy};
+  auto engine = std::mt19937{std::random_device()()};
+  for (int i = 0; i < 100; ++i) {
+    const auto pose = distribution(engine);
+    ASSERT_TRUE(region.contains(pose.translation()));
+  }
+}
+
+TEST(MultivariateUniformDistribution, LowDiscrepancyCoversFreeCells) {
+  constexpr double kResolution = 1.0;
+  const auto grid = beluga::testing::StaticOccupancyGrid<3, 3>{
+      {true, false, true,   //
+       false, true, false,  //
+       true, false, true},
+      kResolution,
+  };
+  auto distribution = beluga::MultivariateUniformDistribution{grid, beluga::low_discrepancy};
+  auto engine = std::mt19937{std::random_device()()};
+
+  struct bucket_hash {
+    std::size_t operator()(const Sophus::Vector2d& s) const noexcept {
+      const std::size_t h1 = std::hash<double>{}(s.x());
+      const std::size_t h2 = std::hash<double>{}(s.y());
+      return h1 ^ (h2 << 1);
+    }
+  };
+
+  struct bucket_equal {
+    bool operator()(const Sophus::Vector2d& lhs, const Sophus::Vector2d& rhs) const noexcept {
+      return lhs.x() == rhs.x() && lhs.y() == rhs.y();
+    }
+  };
+
+  // Four consecutive base 2 quasi-random points are spaced exactly 1/4 apart,
+  // so four draws must visit each of the four free cells exactly once.
+  std::unordered_map<Sophus::Vector2d, std::size_t, bucket_hash, bucket_equal> buckets;
+  for (int i = 0; i < 4; ++i) {
+    ++buckets[distribution(engine).translation()];
+  }
+  ASSERT_EQ(ranges::size(buckets), 4);
+}
+
 }  // namespace
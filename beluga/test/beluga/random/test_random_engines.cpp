@@ -0,0 +1,125 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <random>
+#include <thread>
+
+#include "beluga/random/random_engines.hpp"
+
+namespace {
+
+TEST(Xoshiro256PlusPlus, DeterministicForEqualSeeds) {
+  auto first = beluga::Xoshiro256PlusPlus{42};
+  auto second = beluga::Xoshiro256PlusPlus{42};
+  for (int i = 0; i < 1'000; ++i) {
+    ASSERT_EQ(first(), second());
+  }
+}
+
+TEST(Xoshiro256PlusPlus, DifferentSeedsDiverge) {
+  auto first = beluga::Xoshiro256PlusPlus{42};
+  auto second = beluga::Xoshiro256PlusPlus{43};
+  bool diverged = false;
+  for (int i = 0; i < 1'000; ++i) {
+    diverged = diverged || (first() != second());
+  }
+  ASSERT_TRUE(diverged);
+}
+
+TEST(Xoshiro256PlusPlus, DrivesStandardDistributions) {
+  auto engine = beluga::Xoshiro256PlusPlus{123};
+  auto distribution = std::uniform_real_distribution<double>{0.0, 1.0};
+  double sum = 0.0;
+  constexpr int kCount = 100'000;
+  for (int i = 0; i < kCount; ++i) {
+    const double value = distribution(engine);
+    ASSERT_GE(value, 0.0);
+    ASSERT_LT(value, 1.0);
+    sum += value;
+  }
+  ASSERT_NEAR(sum / kCount, 0.5, 0.01);
+}
+
+TEST(Pcg32, MatchesReferenceImplementation) {
+  // First outputs of the pcg32-demo program for seed 42, stream 54.
+  auto engine = beluga::Pcg32{42, 54};
+  ASSERT_EQ(engine(), 2707161783U);
+  ASSERT_EQ(engine(), 2068313097U);
+  ASSERT_EQ(engine(), 3122475824U);
+}
+
+TEST(Pcg32, StreamsAreDecorrelated) {
+  auto first = beluga::Pcg32{42, 1};
+  auto second = beluga::Pcg32{42, 2};
+  bool diverged = false;
+  for (int i = 0; i < 1'000; ++i) {
+    diverged = diverged || (first() != second());
+  }
+  ASSERT_TRUE(diverged);
+}
+
+TEST(Philox4x32, MatchesReferenceImplementation) {
+  // Random123 known-answer test for philox4x32-10 with zero counter and key.
+  auto engine = beluga::Philox4x32{0, 0};
+  ASSERT_EQ(engine(), 0x6627E8D5U);
+  ASSERT_EQ(engine(), 0xE169C58DU);
+  ASSERT_EQ(engine(), 0xBC57AC4CU);
+  ASSERT_EQ(engine(), 0x9B00DBD8U);
+}
+
+TEST(Philox4x32, StreamsAreIndependentAndReproducible) {
+  auto first = beluga::Philox4x32{42, 7};
+  auto second = beluga::Philox4x32{42, 7};
+  auto third = beluga::Philox4x32{42, 8};
+  bool diverged = false;
+  for (int i = 0; i < 1'000; ++i) {
+    const auto value = first();
+    ASSERT_EQ(value, second());
+    diverged = diverged || (value != third());
+  }
+  ASSERT_TRUE(diverged);
+}
+
+TEST(Philox4x32, SeedRestartsTheStream) {
+  auto engine = beluga::Philox4x32{42, 7};
+  const auto value = engine();
+  engine.seed(42, 7);
+  ASSERT_EQ(engine(), value);
+}
+
+TEST(DefaultRandomEngine, ReturnsThreadLocalInstance) {
+  auto& first = beluga::get_default_random_engine();
+  auto& second = beluga::get_default_random_engine();
+  ASSERT_EQ(&first, &second);
+}
+
+TEST(DefaultRandomEngine, PoolReseedRestartsTheSequence) {
+  beluga::seed_default_random_engines(42);
+  const auto value = beluga::get_default_random_engine()();
+  beluga::seed_default_random_engines(42);
+  ASSERT_EQ(beluga::get_default_random_engine()(), value);
+}
+
+TEST(DefaultRandomEngine, PoolSlotsAreDecorrelatedAcrossThreads) {
+  beluga::seed_default_random_engines(42);
+  const auto value = beluga::get_default_random_engine()();
+  std::uint64_t other = 0;
+  std::thread{[&other] { other = beluga::get_default_random_engine()(); }}.join();
+  ASSERT_NE(other, value);
+}
+
+}  // namespace
@@ -0,0 +1,102 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "beluga/sensor/data/compressed_value_grid.hpp"
+#include "beluga/sensor/data/value_grid.hpp"
+
+namespace {
+
+constexpr std::size_t kTileSide = beluga::CompressedValueGrid2<int>::kTileSide;
+
+// A 48x48 grid that is one repeated value except for a few cells in one tile.
+beluga::ValueGrid2<int> make_sparse_grid() {
+  constexpr std::size_t kWidth = 3 * kTileSide;
+  constexpr std::size_t kHeight = 3 * kTileSide;
+  auto data = std::vector<int>(kWidth * kHeight, 7);
+  data[20 * kWidth + 20] = 1;
+  data[21 * kWidth + 22] = 2;
+  return beluga::ValueGrid2<int>{std::move(data), kWidth, 0.5};
+}
+
+TEST(CompressedValueGrid2, CollapsesUniformTiles) {
+  const auto compressed = beluga::CompressedValueGrid2<int>{make_sparse_grid(), -1};
+
+  EXPECT_EQ(compressed.tile_count(), 9);
+  EXPECT_EQ(compressed.dense_tile_count(), 1);
+}
+
+TEST(CompressedValueGrid2, LookupsMatchSourceGrid) {
+  const auto grid = make_sparse_grid();
+  const auto compressed = beluga::CompressedValueGrid2<int>{grid, -1};
+
+  for (std::size_t yi = 0; yi < 3 * kTileSide; ++yi) {
+    for (std::size_t xi = 0; xi < 3 * kTileSide; ++xi) {
+      const auto x = (static_cast<double>(xi) + 0.5) * grid.resolution();
+      const auto y = (static_cast<double>(yi) + 0.5) * grid.resolution();
+      ASSERT_EQ(compressed.data_near(x, y), grid.data_near(x, y).value()) << "cell (" << xi << ", " << yi << ")";
+    }
+  }
+}
+
+TEST(CompressedValueGrid2, OutOfMapLookupsReturnBorderValue) {
+  const auto compressed = beluga::CompressedValueGrid2<int>{make_sparse_grid(), -1};
+
+  EXPECT_EQ(compressed.data_near(-0.25, 0.25), -1);
+  EXPECT_EQ(compressed.data_near(0.25, -0.25), -1);
+  EXPECT_EQ(compressed.data_near(24.25, 0.25), -1);
+  EXPECT_EQ(compressed.data_near(0.25, 24.25), -1);
+  EXPECT_EQ(compressed.data_near(-1000.0, 1000.0), -1);
+}
+
+TEST(CompressedValueGrid2, SupportsPartialEdgeTiles) {
+  // 20x20 grid: edge tiles only partially overlap the grid extent.
+  constexpr std::size_t kWidth = 20;
+  auto data = std::vector<int>(kWidth * kWidth, 3);
+  data[19 * kWidth + 19] = 9;
+  const auto grid = beluga::ValueGrid2<int>{std::move(data), kWidth, 1.0};
+  const auto compressed = beluga::CompressedValueGrid2<int>{grid, -1};
+
+  EXPECT_EQ(compressed.tile_count(), 4);
+  EXPECT_EQ(compressed.dense_tile_count(), 1);
+  EXPECT_EQ(compressed.data_near(19.5, 19.5), 9);
+  EXPECT_EQ(compressed.data_near(18.5, 19.5), 3);
+  EXPECT_EQ(compressed.data_near(20.5, 19.5), -1);
+}
+
+TEST(CompressedValueGrid2, GatherMatchesScalarLookups) {
+  const auto compressed = beluga::CompressedValueGrid2<int>{make_sparse_grid(), -1};
+
+  // More lookups than the gather prefetch distance, mixing uniform tiles,
+  // the dense tile, and out-of-map coordinates.
+  constexpr std::size_t kCount = 40;
+  std::vector<double> xs;
+  std::vector<double> ys;
+  for (std::size_t index = 0; index < kCount; ++index) {
+    xs.push_back(-2.0 + 0.7 * static_cast<double>(index));
+    ys.push_back(26.0 - 0.7 * static_cast<double>(index));
+  }
+
+  std::vector<int> values(kCount);
+  compressed.gather_near(xs.data(), ys.data(), kCount, values.data());
+  for (std::size_t index = 0; index < kCount; ++index) {
+    EXPECT_EQ(values[index], compressed.data_near(xs[index], ys[index])) << "lookup " << index;
+  }
+}
+
+}  // namespace
@@ -15,7 +15,10 @@
 #include <gtest/gtest.h>
 
 // standard library
+#include <algorithm>
+#include <limits>
 #include <optional>
+#include <random>
 
 // external
 #include <sophus/se3.hpp>
@@ -66,6 +69,36 @@ TEST_F(LandmarkMapCartesianTest, EmptyMap) {
   ASSERT_FALSE(nearest.has_value());
 }
 
+TEST_F(LandmarkMapCartesianTest, IndexMatchesLinearScan) {
+  auto landmarks = beluga::LandmarkMap::landmarks_set_position_data{};
+  std::mt19937 generator{42};
+  std::uniform_real_distribution<double> coordinate{0.0, 10.0};
+  for (int i = 0; i < 500; ++i) {
+    landmarks.push_back(
+        {beluga::LandmarkPosition3{coordinate(generator), coordinate(generator), coordinate(generator)},
+         static_cast<beluga::LandmarkCategory>(i % 3)});
+  }
+  const auto uut = beluga::LandmarkMap(default_map_boundaries, landmarks);
+
+  for (int i = 0; i < 50; ++i) {
+    const auto query =
+        beluga::LandmarkPosition3{coordinate(generator), coordinate(generator), coordinate(generator)};
+    const auto category = static_cast<beluga::LandmarkCategory>(i % 3);
+
+    double expected_squared_distance = std::numeric_limits<double>::infinity();
+    for (const auto& landmark : landmarks) {
+      if (landmark.category == category) {
+        expected_squared_distance =
+            std::min(expected_squared_distance, (landmark.detection_position_in_robot - query).squaredNorm());
+      }
+    }
+
+    const auto nearest = uut.find_nearest_landmark(query, category);
+    ASSERT_TRUE(nearest.has_value());
+    EXPECT_NEAR((*nearest - query).squaredNorm(), expected_squared_distance, 1e-9);
+  }
+}
+
 struct LandmarkMapBearingTest : public ::testing::Test {
   beluga::LandmarkMapBoundaries default_map_boundaries{
       Eigen::Vector3d{0.0, 1.0, 2.0}, Eigen::Vector3d{10.0, 11.0, 12.0}};
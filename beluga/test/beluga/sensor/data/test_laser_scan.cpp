@@ -50,6 +50,8 @@ class SimpleLaserScan : public beluga::BaseLaserScan<SimpleLaserScan> {
 
   [[nodiscard]] auto angles() const { return angles_ | ranges::views::all; }
 
+  void set_angles(std::vector<double> angles) { angles_ = std::move(angles); }
+
   [[nodiscard]] static auto min_range() { return kMinRange; }
 
   [[nodiscard]] static auto max_range() { return kMaxRange; }
@@ -101,4 +103,25 @@ TEST(LaserScan, TransformCartesian) {
                  Vector2Near<double>({0., -40.}, kTolerance)));
 }
 
+TEST(LaserScan, CartesianCacheTracksAngleChanges) {
+  const auto pi = Sophus::Constants<double>::pi();
+  auto laser_scan = SimpleLaserScan{
+      {10., 20.},
+      {0., pi / 2},
+  };
+  const auto expected = ElementsAre(
+      Vector2Near<double>({10., 0.}, kTolerance),  //
+      Vector2Near<double>({0., 20.}, kTolerance));
+  ASSERT_THAT(laser_scan.points_in_cartesian_coordinates() | ranges::to<std::vector>, expected);
+  // Converting again reuses the cached per-beam directions.
+  ASSERT_THAT(laser_scan.points_in_cartesian_coordinates() | ranges::to<std::vector>, expected);
+  // Changing the angle table invalidates the cache.
+  laser_scan.set_angles({pi, -pi / 2});
+  ASSERT_THAT(
+      laser_scan.points_in_cartesian_coordinates() | ranges::to<std::vector>,
+      ElementsAre(
+          Vector2Near<double>({-10., 0.}, kTolerance),  //
+          Vector2Near<double>({0., -20.}, kTolerance)));
+}
+
 }  // namespace
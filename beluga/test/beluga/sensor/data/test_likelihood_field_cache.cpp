@@ -0,0 +1,125 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <optional>
+
+#include "beluga/sensor/data/likelihood_field_cache.hpp"
+#include "beluga/sensor/likelihood_field_model.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+namespace {
+
+using beluga::testing::StaticOccupancyGrid;
+
+auto make_test_grid() {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  return StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, true ,
+    false, false, false, true , false,
+    false, false, true , false, false,
+    false, true , false, false, false,
+    true , false, false, false, false},
+    kResolution};
+  // clang-format on
+}
+
+std::filesystem::path make_test_cache_directory(const char* name) {
+  const auto path = std::filesystem::temp_directory_path() / name;
+  std::filesystem::remove_all(path);
+  return path;
+}
+
+TEST(LikelihoodFieldCache, RoundTrip) {
+  const auto grid = make_test_grid();
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  const auto key = beluga::likelihood_field_cache_key(grid, params);
+  const auto path = make_test_cache_directory("beluga_likelihood_field_cache_round_trip") /
+                    beluga::likelihood_field_cache_filename(key);
+  std::filesystem::create_directories(path.parent_path());
+
+  const auto reference = beluga::LikelihoodFieldModel<StaticOccupancyGrid<5, 5>>{params, grid};
+  beluga::io::save_likelihood_field(reference.likelihood_field(), key, path);
+
+  const auto field = beluga::io::load_likelihood_field<double>(path, key);
+  ASSERT_TRUE(field.has_value());
+  EXPECT_EQ(field->width(), reference.likelihood_field().width());
+  EXPECT_EQ(field->height(), reference.likelihood_field().height());
+  EXPECT_DOUBLE_EQ(field->resolution(), reference.likelihood_field().resolution());
+  EXPECT_THAT(field->data(), testing::Pointwise(testing::DoubleEq(), reference.likelihood_field().data()));
+
+  std::filesystem::remove_all(path.parent_path());
+}
+
+TEST(LikelihoodFieldCache, KeyMismatchIsSkipped) {
+  const auto grid = make_test_grid();
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  const auto key = beluga::likelihood_field_cache_key(grid, params);
+  const auto path = make_test_cache_directory("beluga_likelihood_field_cache_mismatch") /
+                    beluga::likelihood_field_cache_filename(key);
+  std::filesystem::create_directories(path.parent_path());
+
+  const auto reference = beluga::LikelihoodFieldModel<StaticOccupancyGrid<5, 5>>{params, grid};
+  beluga::io::save_likelihood_field(reference.likelihood_field(), key, path);
+
+  EXPECT_FALSE(beluga::io::load_likelihood_field<double>(path, key + 1).has_value());
+  EXPECT_FALSE(beluga::io::load_likelihood_field<float>(path, key).has_value());
+  EXPECT_FALSE(beluga::io::load_likelihood_field<double>(path.parent_path() / "missing.blf", key).has_value());
+
+  std::filesystem::remove_all(path.parent_path());
+}
+
+TEST(LikelihoodFieldCache, KeyTracksInputs) {
+  const auto grid = make_test_grid();
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  const auto key = beluga::likelihood_field_cache_key(grid, params);
+  EXPECT_EQ(key, beluga::likelihood_field_cache_key(grid, params));
+
+  params.sigma_hit = 0.3;
+  EXPECT_NE(key, beluga::likelihood_field_cache_key(grid, params));
+
+  // clang-format off
+  const auto other_grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    0.5};
+  // clang-format on
+  params.sigma_hit = 0.2;
+  EXPECT_NE(key, beluga::likelihood_field_cache_key(other_grid, params));
+}
+
+TEST(LikelihoodFieldCache, CachedModelMatchesBuiltModel) {
+  const auto grid = make_test_grid();
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  const auto cache_directory = make_test_cache_directory("beluga_likelihood_field_cache_model");
+
+  const auto reference = beluga::LikelihoodFieldModel<StaticOccupancyGrid<5, 5>>{params, grid};
+  // First call misses and populates the cache, second call loads from it.
+  const auto first = beluga::make_cached_likelihood_field_model(params, grid, cache_directory);
+  const auto second = beluga::make_cached_likelihood_field_model(params, grid, cache_directory);
+  EXPECT_THAT(first.likelihood_field().data(), testing::Pointwise(testing::DoubleEq(), reference.likelihood_field().data()));
+  EXPECT_THAT(
+      second.likelihood_field().data(), testing::Pointwise(testing::DoubleEq(), reference.likelihood_field().data()));
+
+  std::filesystem::remove_all(cache_directory);
+}
+
+}  // namespace
@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 
 #include <cstddef>
+#include <numeric>
 #include <optional>
 #include <vector>
 
@@ -61,4 +62,136 @@ TEST(LinearGrid2, DataAtIndex) {
   EXPECT_EQ(grid.data_at(10), std::nullopt);
 }
 
+TEST(LinearGrid2, DataAtIndexUnchecked) {
+  constexpr std::size_t kWidth = 4;
+  constexpr std::size_t kResolution = 1;
+  const auto grid =
+      beluga::ValueGrid2<bool>{{{true, false, true, false, false, true, false, true}}, kWidth, kResolution};
+
+  EXPECT_TRUE(grid.data_at_unchecked(0));
+  EXPECT_FALSE(grid.data_at_unchecked(3));
+  EXPECT_TRUE(grid.data_at_unchecked(5));
+  EXPECT_FALSE(grid.data_at_unchecked(2, 0));
+  EXPECT_TRUE(grid.data_at_unchecked(Eigen::Vector2i(1, 1)));
+}
+
+TEST(MortonValueGrid2, LayoutIndicesRoundTrip) {
+  constexpr std::size_t kWidth = 16;
+  for (int yi = 0; yi < 16; ++yi) {
+    for (int xi = 0; xi < 16; ++xi) {
+      const auto index = beluga::MortonStorageLayout::index(xi, yi, kWidth);
+      EXPECT_EQ(beluga::MortonStorageLayout::cell(index, kWidth), Eigen::Vector2i(xi, yi));
+    }
+  }
+}
+
+TEST(MortonValueGrid2, CellLookupsMatchRowMajorGrid) {
+  constexpr std::size_t kWidth = 4;
+  constexpr double kResolution = 0.5;
+  auto values = std::vector<int>(16);
+  std::iota(values.begin(), values.end(), 0);
+  const auto row_major = beluga::ValueGrid2<int>{values, kWidth, kResolution};
+  const auto morton = beluga::ValueGrid2<int, beluga::MortonStorageLayout>{values, kWidth, kResolution};
+
+  ASSERT_EQ(morton.size(), row_major.size());
+  for (int yi = 0; yi < 4; ++yi) {
+    for (int xi = 0; xi < 4; ++xi) {
+      EXPECT_EQ(morton.data_at(xi, yi), row_major.data_at(xi, yi));
+      const auto index = morton.index_at(xi, yi);
+      EXPECT_EQ(morton.coordinates_at(index), row_major.coordinates_at(row_major.index_at(xi, yi)));
+    }
+  }
+  EXPECT_EQ(morton.data_near(0.75, 1.25), row_major.data_near(0.75, 1.25));
+  EXPECT_EQ(morton.data_at(4, 0), std::nullopt);
+}
+
+TEST(MortonValueGrid2, StoragePadsToPowerOfTwoSquare) {
+  constexpr std::size_t kWidth = 3;
+  const auto grid = beluga::ValueGrid2<int, beluga::MortonStorageLayout>{std::vector<int>(6, 1), kWidth};
+  EXPECT_EQ(grid.size(), 6U);
+  EXPECT_EQ(grid.data().size(), 16U);  // 4x4 Z-curve square enclosing 3x2
+}
+
+TEST(TiledValueGrid2, LayoutIndicesRoundTrip) {
+  constexpr std::size_t kWidth = 20;
+  for (int yi = 0; yi < 12; ++yi) {
+    for (int xi = 0; xi < 20; ++xi) {
+      const auto index = beluga::TiledStorageLayout::index(xi, yi, kWidth);
+      EXPECT_EQ(beluga::TiledStorageLayout::cell(index, kWidth), Eigen::Vector2i(xi, yi));
+    }
+  }
+}
+
+TEST(TiledValueGrid2, CellLookupsMatchRowMajorGrid) {
+  constexpr std::size_t kWidth = 10;
+  constexpr double kResolution = 0.5;
+  auto values = std::vector<int>(100);
+  std::iota(values.begin(), values.end(), 0);
+  const auto row_major = beluga::ValueGrid2<int>{values, kWidth, kResolution};
+  const auto tiled = beluga::ValueGrid2<int, beluga::TiledStorageLayout>{values, kWidth, kResolution};
+
+  ASSERT_EQ(tiled.size(), row_major.size());
+  for (int yi = 0; yi < 10; ++yi) {
+    for (int xi = 0; xi < 10; ++xi) {
+      EXPECT_EQ(tiled.data_at(xi, yi), row_major.data_at(xi, yi));
+    }
+  }
+  EXPECT_EQ(tiled.data_near(3.75, 4.25), row_major.data_near(3.75, 4.25));
+  EXPECT_EQ(tiled.data_at(10, 0), std::nullopt);
+}
+
+TEST(TiledValueGrid2, StoragePadsToWholeTiles) {
+  constexpr std::size_t kWidth = 10;
+  const auto grid = beluga::ValueGrid2<int, beluga::TiledStorageLayout>{std::vector<int>(100, 1), kWidth};
+  EXPECT_EQ(grid.size(), 100U);
+  EXPECT_EQ(grid.data().size(), 4U * 64U);  // 2x2 tiles of 8x8 cells enclosing 10x10
+}
+
+TEST(PaddedValueGrid2, InMapLookupsMatchSourceGrid) {
+  constexpr std::size_t kWidth = 2;
+  constexpr double kResolution = 0.5;
+  const auto grid = beluga::ValueGrid2<int>{{{1, 2, 3, 4}}, kWidth, kResolution};
+  const auto padded = beluga::PaddedValueGrid2<int>{grid, -1};
+
+  EXPECT_EQ(padded.data_near(0.25, 0.25), 1);
+  EXPECT_EQ(padded.data_near(0.75, 0.25), 2);
+  EXPECT_EQ(padded.data_near(0.25, 0.75), 3);
+  EXPECT_EQ(padded.data_near(0.75, 0.75), 4);
+}
+
+TEST(PaddedValueGrid2, OutOfMapLookupsReturnBorderValue) {
+  constexpr std::size_t kWidth = 2;
+  constexpr double kResolution = 0.5;
+  const auto grid = beluga::ValueGrid2<int>{{{1, 2, 3, 4}}, kWidth, kResolution};
+  const auto padded = beluga::PaddedValueGrid2<int>{grid, -1};
+
+  EXPECT_EQ(padded.data_near(-0.25, 0.25), -1);
+  EXPECT_EQ(padded.data_near(0.25, -0.25), -1);
+  EXPECT_EQ(padded.data_near(1.25, 0.25), -1);
+  EXPECT_EQ(padded.data_near(0.25, 1.25), -1);
+  EXPECT_EQ(padded.data_near(-1000.0, 1000.0), -1);
+}
+
+TEST(PaddedValueGrid2, GatherMatchesScalarLookups) {
+  constexpr std::size_t kWidth = 2;
+  constexpr double kResolution = 0.5;
+  const auto grid = beluga::ValueGrid2<int>{{{1, 2, 3, 4}}, kWidth, kResolution};
+  const auto padded = beluga::PaddedValueGrid2<int>{grid, -1};
+
+  // More lookups than the gather prefetch distance, mixing in- and out-of-map coordinates.
+  constexpr std::size_t kCount = 40;
+  std::vector<double> xs;
+  std::vector<double> ys;
+  for (std::size_t index = 0; index < kCount; ++index) {
+    xs.push_back(-0.55 + 0.05 * static_cast<double>(index));
+    ys.push_back(1.45 - 0.05 * static_cast<double>(index));
+  }
+
+  std::vector<int> values(kCount);
+  padded.gather_near(xs.data(), ys.data(), kCount, values.data());
+  for (std::size_t index = 0; index < kCount; ++index) {
+    EXPECT_EQ(values[index], padded.data_near(xs[index], ys[index])) << "lookup " << index;
+  }
+}
+
 }  // namespace
@@ -0,0 +1,98 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <filesystem>
+#include <fstream>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+#include <Eigen/Core>
+
+#include "beluga/containers/flat_grid_map.hpp"
+#include "beluga/sensor/data/ndt_binary_map.hpp"
+#include "beluga/sensor/data/ndt_cell.hpp"
+#include "beluga/sensor/data/sparse_value_grid.hpp"
+
+namespace beluga {
+
+namespace {
+
+std::filesystem::path make_test_map_path(const char* name) {
+  return std::filesystem::temp_directory_path() / name;
+}
+
+SparseValueGrid<FlatGridMap<Eigen::Vector2i, NDTCell2d>> make_test_grid() {
+  FlatGridMap<Eigen::Vector2i, NDTCell2d> map;
+  map[Eigen::Vector2i{0, 0}] = NDTCell2d{Eigen::Vector2d{0.25, 0.25}, Eigen::Matrix2d::Identity() * 0.3};
+  map[Eigen::Vector2i{2, -1}] = NDTCell2d{Eigen::Vector2d{1.25, -0.25}, Eigen::Matrix2d::Identity() * 0.5};
+  map[Eigen::Vector2i{-4, 3}] = NDTCell2d{Eigen::Vector2d{-1.75, 1.75}, Eigen::Matrix2d::Identity() * 0.7};
+  return SparseValueGrid<FlatGridMap<Eigen::Vector2i, NDTCell2d>>{std::move(map), 0.5};
+}
+
+}  // namespace
+
+TEST(NDTBinaryMap, RoundTrip) {
+  const auto path = make_test_map_path("beluga_ndt_binary_map_round_trip.bin");
+  const auto source = make_test_grid();
+  io::save_to_binary_2d(source, path);
+
+  const auto grid = io::load_from_binary_2d(path);
+  EXPECT_EQ(grid.size(), source.size());
+  EXPECT_DOUBLE_EQ(grid.resolution(), source.resolution());
+
+  for (const auto& [cell, expected] : source.data()) {
+    const auto maybe_cell = grid.data_at(cell);
+    ASSERT_TRUE(maybe_cell.has_value());
+    EXPECT_TRUE(maybe_cell->mean.isApprox(expected.mean));
+    EXPECT_TRUE(maybe_cell->covariance.isApprox(expected.covariance));
+  }
+  EXPECT_EQ(grid.data_at(Eigen::Vector2i{7, 7}), std::nullopt);
+
+  std::filesystem::remove(path);
+}
+
+TEST(NDTBinaryMap, IterationMatchesSize) {
+  const auto path = make_test_map_path("beluga_ndt_binary_map_iteration.bin");
+  io::save_to_binary_2d(make_test_grid(), path);
+
+  const MemoryMappedNDTMap2d map{path};
+  std::size_t count = 0;
+  for (const auto& [cell, value] : map) {
+    EXPECT_NE(map.find(cell), map.end());
+    ++count;
+  }
+  EXPECT_EQ(count, map.size());
+
+  std::filesystem::remove(path);
+}
+
+TEST(NDTBinaryMap, NonExistingFileThrows) {
+  ASSERT_THROW(io::load_from_binary_2d("bad_file.bin"), std::invalid_argument);
+}
+
+TEST(NDTBinaryMap, InvalidFileThrows) {
+  const auto path = make_test_map_path("beluga_ndt_binary_map_invalid.bin");
+  {
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    file << "definitely not an NDT map, but long enough to hold a header....";
+  }
+  ASSERT_THROW(io::load_from_binary_2d(path), std::invalid_argument);
+  std::filesystem::remove(path);
+}
+
+}  // namespace beluga
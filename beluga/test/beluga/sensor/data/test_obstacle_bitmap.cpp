@@ -0,0 +1,86 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <vector>
+
+#include "beluga/sensor/data/obstacle_bitmap.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+namespace {
+
+using beluga::testing::StaticOccupancyGrid;
+
+TEST(ObstacleBitmap2, PackedBitsMatchSourceCells) {
+  auto map = std::vector<bool>(200, false);
+  map[0] = true;
+  map[63] = true;
+  map[64] = true;
+  map[199] = true;
+  const auto bitmap = beluga::ObstacleBitmap2{map, 10};
+
+  ASSERT_EQ(bitmap.size(), map.size());
+  EXPECT_EQ(bitmap.width(), 10U);
+  EXPECT_EQ(bitmap.height(), 20U);
+  EXPECT_EQ(bitmap.words().size(), 4U);
+  for (std::size_t index = 0; index < map.size(); ++index) {
+    EXPECT_EQ(bitmap.is_set(index), map[index]) << "at index " << index;
+  }
+}
+
+TEST(ObstacleBitmap2, ForEachSetVisitsObstaclesInOrder) {
+  auto map = std::vector<bool>(130, false);
+  const auto expected = std::vector<std::size_t>{3, 63, 64, 127, 129};
+  for (const std::size_t index : expected) {
+    map[index] = true;
+  }
+  const auto bitmap = beluga::ObstacleBitmap2{map, 13};
+
+  auto visited = std::vector<std::size_t>{};
+  bitmap.for_each_set([&visited](std::size_t index) { visited.push_back(index); });
+  EXPECT_EQ(visited, expected);
+}
+
+TEST(ObstacleBitmap2, AnyTestsWordsNotCells) {
+  EXPECT_FALSE(beluga::ObstacleBitmap2(std::vector<bool>(128, false), 8).any());
+  auto map = std::vector<bool>(128, false);
+  map[127] = true;
+  EXPECT_TRUE(beluga::ObstacleBitmap2(map, 8).any());
+}
+
+TEST(ObstacleBitmap2, MatchesGridObstacleData) {
+  constexpr double kResolution = 1.;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, true ,
+    false, false, false, true , false,
+    false, false, true , false, false,
+    false, true , false, false, false,
+    true , false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto bitmap = grid.packed_obstacle_data();
+  const auto obstacle_data = grid.obstacle_data();
+  ASSERT_EQ(bitmap.size(), grid.size());
+  std::size_t index = 0;
+  for (const bool is_obstacle : obstacle_data) {
+    EXPECT_EQ(bitmap.is_set(index), is_obstacle) << "at index " << index;
+    ++index;
+  }
+}
+
+}  // namespace
@@ -45,6 +45,22 @@ TEST(OccupancyGrid2, FreeAtCell) {
   EXPECT_TRUE(grid.free_at(Eigen::Vector2i(1, 4)));
 }
 
+TEST(OccupancyGrid2, FreeAtCellUnchecked) {
+  constexpr double kResolution = 1.;
+
+  const auto grid = StaticOccupancyGrid<5, 5>{
+      {false, false, false, false, true,  false, false, false, true,  false, false, false, true,
+       false, false, false, true,  false, false, false, true,  false, false, false, false},
+      kResolution};
+
+  EXPECT_TRUE(grid.free_at_unchecked(0));
+  EXPECT_FALSE(grid.free_at_unchecked(8));
+  EXPECT_FALSE(grid.free_at_unchecked(2, 2));
+  EXPECT_TRUE(grid.free_at_unchecked(3, 2));
+  EXPECT_FALSE(grid.free_at_unchecked(Eigen::Vector2i(0, 4)));
+  EXPECT_TRUE(grid.free_at_unchecked(Eigen::Vector2i(1, 4)));
+}
+
 TEST(OccupancyGrid2, FreeNearCell) {
   constexpr double kResolution = 1.;
 
@@ -79,6 +95,21 @@ TEST(OccupancyGrid2, AllFreeCells) {
   ASSERT_THAT(grid.free_cells() | ranges::to<std::vector>, testing::Pointwise(testing::Eq(), expected_free_cells));
 }
 
+TEST(OccupancyGrid2, CachedFreeCells) {
+  auto grid = StaticOccupancyGrid<2, 5>{{false, false, false, false, true, false, false, false, true, false}};
+
+  const auto expected_free_cells = std::vector<std::size_t>{0, 1, 2, 3, 5, 6, 7, 9};
+  const auto free_cells = grid.cached_free_cells();
+  ASSERT_THAT(*free_cells, testing::Pointwise(testing::Eq(), expected_free_cells));
+
+  // Repeat calls share the memoized index until it is invalidated.
+  ASSERT_EQ(grid.cached_free_cells(), free_cells);
+  grid.data()[0] = true;
+  grid.invalidate_free_cells_cache();
+  const auto expected_after_update = std::vector<std::size_t>{1, 2, 3, 5, 6, 7, 9};
+  ASSERT_THAT(*grid.cached_free_cells(), testing::Pointwise(testing::Eq(), expected_after_update));
+}
+
 TEST(OccupancyGrid2, ObstacleData) {
   const auto grid = StaticOccupancyGrid<5, 2>{{false, false, false, false, true, false, false, false, true, false}};
 
@@ -0,0 +1,119 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <optional>
+
+#include <sophus/common.hpp>
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/algorithm/raycasting.hpp"
+#include "beluga/sensor/data/occupancy_pyramid.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+namespace beluga {
+
+using testing::StaticOccupancyGrid;
+
+TEST(OccupancyPyramid, Nominal) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  constexpr double kMaxRange = 5.;
+  const auto pyramid = OccupancyPyramid{grid};
+
+  {
+    // Horizontal ray that hits the occupied cell.
+    const auto pose = Sophus::SE2d{0., Eigen::Vector2d{0., 1.}};
+    const auto distance = pyramid.cast(pose, Sophus::SO2d{0.}, kMaxRange);
+    ASSERT_TRUE(distance.has_value());
+    EXPECT_NEAR(*distance, 1., 1e-9);
+  }
+
+  {
+    // Horizontal ray that hits the map boundary.
+    const auto pose = Sophus::SE2d{0., Eigen::Vector2d{0.5, 0.}};
+    EXPECT_EQ(pyramid.cast(pose, Sophus::SO2d{0.}, kMaxRange), std::nullopt);
+  }
+
+  {
+    // Ray that exceeds the maximum range before any hit.
+    const auto pose = Sophus::SE2d{0., Eigen::Vector2d{0., 1.}};
+    EXPECT_EQ(pyramid.cast(pose, Sophus::SO2d{0.}, 0.5), std::nullopt);
+  }
+}
+
+TEST(OccupancyPyramid, MatchesRaycastingOnCardinalDirections) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, true ,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    true , false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  constexpr double kMaxRange = 5.;
+  const auto pyramid = OccupancyPyramid{grid};
+
+  const auto poses = std::array{
+      Sophus::SE2d{0., Eigen::Vector2d{0., 1.}},
+      Sophus::SE2d{0., Eigen::Vector2d{1.25, 0.}},
+      Sophus::SE2d{0., Eigen::Vector2d{2., 2.}},
+  };
+  const auto bearings = std::array{
+      Sophus::SO2d{0.},
+      Sophus::SO2d{Sophus::Constants<double>::pi() / 2.},
+      Sophus::SO2d{Sophus::Constants<double>::pi()},
+      Sophus::SO2d{-Sophus::Constants<double>::pi() / 2.},
+  };
+
+  for (const auto& pose : poses) {
+    const auto ray = Ray2d{grid, pose, kMaxRange};
+    for (const auto& bearing : bearings) {
+      const auto expected = ray.cast(bearing);
+      const auto actual = pyramid.cast(pose, bearing, kMaxRange);
+      ASSERT_EQ(actual.has_value(), expected.has_value());
+      if (expected.has_value()) {
+        EXPECT_NEAR(*actual, *expected, 1e-9);
+      }
+    }
+  }
+}
+
+TEST(OccupancyPyramid, LevelCount) {
+  constexpr double kResolution = 0.5;
+  const auto grid = StaticOccupancyGrid<5, 5>{
+      {false, false, false, false, false, false, false, false, false, false, false, false, true,
+       false, false, false, false, false, false, false, false, false, false, false, false},
+      kResolution};
+  const auto pyramid = OccupancyPyramid{grid};
+  EXPECT_EQ(pyramid.levels(), std::size_t{4});  // 5x5 -> 3x3 -> 2x2 -> 1x1
+}
+
+}  // namespace beluga
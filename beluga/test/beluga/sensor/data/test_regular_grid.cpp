@@ -14,6 +14,7 @@
 
 #include <gtest/gtest.h>
 
+#include <ratio>
 #include <vector>
 
 #include <range/v3/range/conversion.hpp>
@@ -27,6 +28,9 @@ class TestRegularGrid2 : public beluga::BaseRegularGrid2<TestRegularGrid2> {
   [[nodiscard]] static double resolution() { return 1.; }
 };
 
+class TestStaticResolutionGrid2 : public beluga::BaseRegularGrid2<TestStaticResolutionGrid2>,
+                                  public beluga::StaticResolution<std::ratio<1, 20>> {};
+
 TEST(RegularGrid2, NearestCells) {
   const auto grid = TestRegularGrid2{};
 
@@ -37,6 +41,18 @@ TEST(RegularGrid2, NearestCells) {
   EXPECT_EQ(grid.cell_near(Eigen::Vector2d(1.5, 0.5)), Eigen::Vector2i(1, 0));
 }
 
+TEST(RegularGrid2, NearestCellsWithStaticResolution) {
+  const auto grid = TestStaticResolutionGrid2{};
+
+  static_assert(TestStaticResolutionGrid2::resolution() == 0.05);
+  static_assert(TestStaticResolutionGrid2::inverse_resolution() == 20.);
+
+  EXPECT_EQ(grid.cell_near(0, 0), Eigen::Vector2i(0, 0));
+  EXPECT_EQ(grid.cell_near(0.26, 0.09), Eigen::Vector2i(5, 1));
+  EXPECT_EQ(grid.cell_near(-0.01, -0.06), Eigen::Vector2i(-1, -2));
+  EXPECT_TRUE(grid.coordinates_at(5, 1).isApprox(Eigen::Vector2d(0.275, 0.075)));
+}
+
 TEST(RegularGrid2, CoordinatesAtCell) {
   const auto grid = TestRegularGrid2{};
 
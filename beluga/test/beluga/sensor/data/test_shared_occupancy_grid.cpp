@@ -0,0 +1,71 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+
+#include "beluga/sensor/data/shared_occupancy_grid.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+namespace {
+
+using beluga::testing::StaticOccupancyGrid;
+
+TEST(SharedOccupancyGrid, ForwardsGridInterface) {
+  constexpr double kResolution = 0.5;
+  const auto handle = beluga::SharedOccupancyGrid{
+      StaticOccupancyGrid<2, 5>{{false, false, false, false, true, false, false, false, true, false}, kResolution}};
+
+  EXPECT_EQ(handle.width(), 5);
+  EXPECT_EQ(handle.height(), 2);
+  EXPECT_EQ(handle.size(), 10);
+  EXPECT_EQ(handle.resolution(), kResolution);
+  EXPECT_TRUE(handle.free_at(0));
+  EXPECT_FALSE(handle.free_at(4));
+  EXPECT_TRUE(handle.coordinates_at(handle.index_at(1, 1)).isApprox(Eigen::Vector2d(0.75, 0.75)));
+
+  const auto expected_free_cells = std::vector<std::size_t>{0, 1, 2, 3, 5, 6, 7, 9};
+  ASSERT_THAT(handle.free_cells() | ranges::to<std::vector>, testing::Pointwise(testing::Eq(), expected_free_cells));
+}
+
+TEST(SharedOccupancyGrid, CopiesShareTheUnderlyingGrid) {
+  const auto handle = beluga::SharedOccupancyGrid{
+      StaticOccupancyGrid<2, 5>{{false, false, false, false, true, false, false, false, true, false}}};
+
+  const auto copy = handle;  // NOLINT(performance-unnecessary-copy-initialization)
+  EXPECT_EQ(&copy.underlying_grid(), &handle.underlying_grid());
+  EXPECT_EQ(copy.cached_free_cells(), handle.cached_free_cells());
+}
+
+TEST(SharedOccupancyGrid, OldGridOutlivesHandleReassignment) {
+  auto grid = std::make_shared<const StaticOccupancyGrid<2, 5>>(
+      std::array<bool, 10>{false, false, false, false, true, false, false, false, true, false});
+  auto handle = beluga::SharedOccupancyGrid<StaticOccupancyGrid<2, 5>>{grid};
+
+  handle = beluga::SharedOccupancyGrid<StaticOccupancyGrid<2, 5>>{
+      std::make_shared<const StaticOccupancyGrid<2, 5>>(std::array<bool, 10>{})};
+  // The original grid is retired only once the last reader releases it.
+  EXPECT_EQ(grid.use_count(), 1);
+  EXPECT_FALSE(grid->free_at(4));
+}
+
+}  // namespace
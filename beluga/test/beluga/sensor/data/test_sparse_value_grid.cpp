@@ -18,9 +18,12 @@
 #include <map>
 #include <optional>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include <Eigen/Core>
 
+#include "beluga/containers/flat_grid_map.hpp"
 #include "beluga/sensor/data/sparse_value_grid.hpp"
 
 namespace beluga {
@@ -38,8 +41,10 @@ struct Hasher {
   std::size_t operator()(const Eigen::Vector2i&) const { return 1; }
 };
 
-using SparseGridTestCases =
-    testing::Types<std::unordered_map<Eigen::Vector2i, int, Hasher>, std::map<Eigen::Vector2i, int, Less>>;
+using SparseGridTestCases = testing::Types<
+    std::unordered_map<Eigen::Vector2i, int, Hasher>,
+    std::map<Eigen::Vector2i, int, Less>,
+    beluga::FlatGridMap<Eigen::Vector2i, int>>;
 
 TYPED_TEST_SUITE(SparseGridTests, SparseGridTestCases, );
 
@@ -109,6 +114,36 @@ TYPED_TEST(SparseGridTests, DataAccessing) {
   }
 }
 
+TYPED_TEST(SparseGridTests, BulkConstructionMatchesIncrementalConstruction) {
+  using Grid = beluga::SparseValueGrid<TypeParam>;
+  auto entries = std::vector<typename Grid::entry_type>{
+      {Eigen::Vector2i{1, 2}, 1},
+      {Eigen::Vector2i{4, 2}, 2},
+      {Eigen::Vector2i{3, 2}, 3},
+      {Eigen::Vector2i{2, 2}, 4},
+  };
+
+  const auto grid = Grid::from_entries(std::move(entries), 0.5);
+  ASSERT_EQ(grid.size(), 4);
+  ASSERT_DOUBLE_EQ(grid.resolution(), 0.5);
+  ASSERT_EQ(grid.data_at(Eigen::Vector2i(1, 2)), std::make_optional<int>(1));
+  ASSERT_EQ(grid.data_at(Eigen::Vector2i(4, 2)), std::make_optional<int>(2));
+  ASSERT_EQ(grid.data_at(Eigen::Vector2i(3, 2)), std::make_optional<int>(3));
+  ASSERT_EQ(grid.data_at(Eigen::Vector2i(2, 2)), std::make_optional<int>(4));
+}
+
+TYPED_TEST(SparseGridTests, BulkConstructionKeepsLastDuplicate) {
+  using Grid = beluga::SparseValueGrid<TypeParam>;
+  auto entries = std::vector<typename Grid::entry_type>{
+      {Eigen::Vector2i{1, 2}, 1},
+      {Eigen::Vector2i{1, 2}, 5},
+  };
+
+  const auto grid = Grid::from_entries(std::move(entries));
+  ASSERT_EQ(grid.size(), 1);
+  ASSERT_EQ(grid.data_at(Eigen::Vector2i(1, 2)), std::make_optional<int>(5));
+}
+
 TYPED_TEST(SparseGridTests, AllAccessorMethodsAreEquivalent) {
   const TypeParam data{
       {Eigen::Vector2i{1, 2}, 1}, {Eigen::Vector2i{4, 2}, 2}, {Eigen::Vector2i{3, 2}, 3}, {Eigen::Vector2i{2, 2}, 4}};
@@ -17,6 +17,8 @@
 #include <utility>
 #include <vector>
 
+#include <range/v3/view/span.hpp>
+
 #include "beluga/sensor/beam_model.hpp"
 #include "beluga/test/static_occupancy_grid.hpp"
 
@@ -81,6 +83,108 @@ TEST(BeamSensorModel, ImportanceWeight) {
   }
 }
 
+TEST(BeamSensorModel, SpanMeasurementMatchesOwningOverload) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = GetParams();
+  auto sensor_model = UUT{params, grid};
+
+  // The span overload borrows the buffer, so it must outlive the weighting function.
+  const auto buffer = std::vector<std::pair<double, double>>{{1., 1.}, {0.75, 0.75}};
+  auto state_weighting_function = sensor_model(ranges::make_span(buffer.data(), 2));
+  const auto expected = sensor_model(std::vector{buffer})(grid.origin());
+  EXPECT_DOUBLE_EQ(state_weighting_function(grid.origin()), expected);
+}
+
+TEST(BeamSensorModel, RaycastLookupMatchesRaycasting) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = GetParams();
+  auto reference_model = UUT{params, grid};
+  auto lookup_model = UUT{params, grid};
+  lookup_model.prepare_raycast_lookup(720);
+
+  const auto measurement = std::vector<std::pair<double, double>>{{1., 1.}};
+  auto reference_weighting = reference_model(std::vector<std::pair<double, double>>{measurement});
+  auto lookup_weighting = lookup_model(std::vector<std::pair<double, double>>{measurement});
+
+  // The lookup measures from the source point instead of its cell centroid, so the
+  // expected ranges (and thus the weights) agree only up to that discretization.
+  EXPECT_NEAR(reference_weighting(grid.origin()), lookup_weighting(grid.origin()), 0.2);
+}
+
+TEST(BeamSensorModel, RaycastCacheMatchesRaycasting) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = GetParams();
+  auto reference_model = UUT{params, grid};
+  auto cached_model = UUT{params, grid};
+  cached_model.enable_raycast_cache(720);
+
+  const auto measurement = std::vector<std::pair<double, double>>{{1., 1.}, {0.75, 0.75}};
+  auto reference_weighting = reference_model(std::vector<std::pair<double, double>>{measurement});
+  auto cached_weighting = cached_model(std::vector<std::pair<double, double>>{measurement});
+
+  // The first evaluation fills the cache, further evaluations from the same cell hit it.
+  // Cached ranges are stored in single precision, hence the tolerance.
+  const auto expected = reference_weighting(grid.origin());
+  EXPECT_NEAR(cached_weighting(grid.origin()), expected, 1e-6);
+  EXPECT_NEAR(cached_weighting(grid.origin()), expected, 1e-6);
+}
+
+TEST(BeamSensorModel, LikelihoodTableMatchesDirectEvaluation) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = GetParams();
+  auto reference_model = UUT{params, grid};
+  auto tabulated_model = UUT{params, grid};
+  tabulated_model.prepare_likelihood_table(8192);
+
+  for (const auto& point : {std::pair{1., 1.}, std::pair{0.75, 0.75}, std::pair{2.25, 2.25}}) {
+    auto reference_weighting = reference_model(std::vector<std::pair<double, double>>{point});
+    auto tabulated_weighting = tabulated_model(std::vector<std::pair<double, double>>{point});
+    // Entries are evaluated at bin centers, so the weights agree up to the
+    // quantization of both ranges.
+    EXPECT_NEAR(reference_weighting(grid.origin()), tabulated_weighting(grid.origin()), 5e-2);
+  }
+}
+
 TEST(BeamSensorModel, GridUpdates) {
   const auto origin = Sophus::SE2d{};
 
@@ -15,6 +15,7 @@
 #include <gtest/gtest.h>
 
 // standard library
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <numeric>
@@ -24,6 +25,7 @@
 
 // external
 #include <range/v3/range/conversion.hpp>
+#include <range/v3/view/span.hpp>
 #include <range/v3/view/transform.hpp>
 
 #include <sophus/common.hpp>
@@ -161,6 +163,23 @@ TYPED_TEST(BearingSensorModelTests, OneStdInBearing) {
   }
 }
 
+TYPED_TEST(BearingSensorModelTests, BatchMatchesPerState) {
+  auto map = LandmarkMap(default_map_boundaries, {{{1.0, -2.0, 1.0}, 0}});
+  const auto sensor_model = TypeParam{get_default_model_params(), std::move(map)};
+  const auto state_weighting_function = sensor_model({{{1.0, 0.0, 0.0}, 0}, {{1.0, 1.0, 0.0}, 0}});
+
+  auto states = std::vector<typename TypeParam::state_type>{
+      get_robot_pose_in_world<typename TypeParam::state_type>(), typename TypeParam::state_type{}};
+  auto weights = std::vector<double>(states.size(), 1.0);
+  state_weighting_function(
+      ranges::make_span(states.data(), static_cast<std::ptrdiff_t>(states.size())),
+      ranges::make_span(weights.data(), static_cast<std::ptrdiff_t>(weights.size())));
+
+  for (std::size_t index = 0; index < states.size(); ++index) {
+    EXPECT_DOUBLE_EQ(weights[index], state_weighting_function(states[index]));
+  }
+}
+
 TYPED_TEST(BearingSensorModelTests, NoSuchLandmark) {
   // perfect bearing measurement
   auto map = LandmarkMap(default_map_boundaries, {{{1.0, -1.0, 1.0}, 0}});
@@ -0,0 +1,74 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <tuple>
+#include <vector>
+
+#include "beluga/actions/reweight.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/sensor/bucketed_weighting.hpp"
+
+namespace {
+
+struct CoarseHasher {
+  std::size_t operator()(double state) const { return state < 5. ? 0 : 1; }
+};
+
+struct CountingModel {
+  std::size_t* evaluations;
+  double operator()(double state) const {
+    ++*evaluations;
+    return state < 5. ? 2.0 : 3.0;
+  }
+};
+
+TEST(BucketedWeighting, SharesWeightsWithinBuckets) {
+  auto input = beluga::TupleVector<std::tuple<double, beluga::Weight>>{};
+  for (int i = 0; i < 50; ++i) {
+    input.push_back({1.0, beluga::Weight(1.0)});
+    input.push_back({9.0, beluga::Weight(1.0)});
+  }
+
+  std::size_t evaluations = 0;
+  input |= beluga::actions::reweight(
+      beluga::make_bucketed_weighting(CountingModel{&evaluations}, CoarseHasher{}));
+
+  // One sensor model evaluation per bucket, not per particle.
+  EXPECT_EQ(evaluations, 2);
+  for (const auto& [state, weight] : input) {
+    EXPECT_DOUBLE_EQ(weight, state < 5. ? 2.0 : 3.0);
+  }
+}
+
+TEST(BucketedWeighting, FallsBackToPerStateWithoutColumnStorage) {
+  auto input = std::vector<std::tuple<double, beluga::Weight>>{};
+  for (int i = 0; i < 10; ++i) {
+    input.emplace_back(1.0, beluga::Weight(1.0));
+  }
+
+  std::size_t evaluations = 0;
+  input |= beluga::actions::reweight(
+      beluga::make_bucketed_weighting(CountingModel{&evaluations}, CoarseHasher{}));
+
+  EXPECT_EQ(evaluations, input.size());
+  for (const auto& [state, weight] : input) {
+    EXPECT_DOUBLE_EQ(weight, 2.0);
+  }
+}
+
+}  // namespace
@@ -0,0 +1,68 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstddef>
+
+#include "beluga/sensor/deadline_weighting.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+struct CountingFunction {
+  std::size_t* full_calls;
+  std::size_t* partial_calls;
+  double operator()(double /*state*/) const {
+    ++*full_calls;
+    return 1.5;
+  }
+  double operator()(double /*state*/, double fraction) const {
+    ++*partial_calls;
+    return fraction;
+  }
+};
+
+struct FullOnlyFunction {
+  double operator()(double /*state*/) const { return 2.0; }
+};
+
+TEST(DeadlineWeighting, FullEvaluationWithinBudget) {
+  std::size_t full_calls = 0;
+  std::size_t partial_calls = 0;
+  const auto weighting_function =
+      beluga::make_deadline_weighting(CountingFunction{&full_calls, &partial_calls}, 1h);
+  EXPECT_DOUBLE_EQ(weighting_function(0.0), 1.5);
+  EXPECT_EQ(full_calls, 1);
+  EXPECT_EQ(partial_calls, 0);
+}
+
+TEST(DeadlineWeighting, DegradedEvaluationPastDeadline) {
+  std::size_t full_calls = 0;
+  std::size_t partial_calls = 0;
+  const auto weighting_function =
+      beluga::make_deadline_weighting(CountingFunction{&full_calls, &partial_calls}, 0s, 0.25);
+  EXPECT_DOUBLE_EQ(weighting_function(0.0), 0.25);
+  EXPECT_EQ(full_calls, 0);
+  EXPECT_EQ(partial_calls, 1);
+}
+
+TEST(DeadlineWeighting, FullOnlyFunctionsAreNeverDegraded) {
+  const auto weighting_function = beluga::make_deadline_weighting(FullOnlyFunction{}, 0s);
+  EXPECT_DOUBLE_EQ(weighting_function(0.0), 2.0);
+}
+
+}  // namespace
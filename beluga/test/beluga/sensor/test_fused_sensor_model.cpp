@@ -0,0 +1,65 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <tuple>
+
+#include "beluga/sensor/fused_sensor_model.hpp"
+
+namespace {
+
+/// Minimal sensor model weighting states by their distance to the measurement.
+struct OffsetModel {
+  using state_type = double;
+  using weight_type = double;
+  using measurement_type = double;
+
+  std::size_t* conditioned_count = nullptr;
+
+  [[nodiscard]] auto operator()(measurement_type&& measurement) const {
+    if (conditioned_count != nullptr) {
+      ++*conditioned_count;
+    }
+    return [measurement](const state_type& state) -> weight_type { return state + measurement; };
+  }
+};
+
+TEST(FusedSensorModel, MultipliesLikelihoods) {
+  const auto model = beluga::FusedSensorModel{OffsetModel{}, OffsetModel{}};
+  const auto weighting_function = model(std::make_tuple(1.0, 2.0));
+  // (2 + 1) * (2 + 2)
+  EXPECT_DOUBLE_EQ(weighting_function(2.0), 12.0);
+}
+
+TEST(FusedSensorModel, ConditionsEveryModelOncePerMeasurement) {
+  std::size_t first_count = 0;
+  std::size_t second_count = 0;
+  const auto model = beluga::FusedSensorModel{OffsetModel{&first_count}, OffsetModel{&second_count}};
+  const auto weighting_function = model(std::make_tuple(0.0, 0.0));
+  weighting_function(1.0);
+  weighting_function(2.0);
+  // Conditioning happens once per fused measurement, not per particle.
+  EXPECT_EQ(first_count, 1);
+  EXPECT_EQ(second_count, 1);
+}
+
+TEST(FusedSensorModel, SingleModelIsTransparent) {
+  const auto model = beluga::FusedSensorModel{OffsetModel{}};
+  const auto weighting_function = model(std::make_tuple(3.0));
+  EXPECT_DOUBLE_EQ(weighting_function(1.0), 4.0);
+}
+
+}  // namespace
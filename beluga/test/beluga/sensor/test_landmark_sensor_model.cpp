@@ -15,11 +15,14 @@
 #include <gtest/gtest.h>
 
 // standard library
+#include <cstddef>
 #include <functional>
 #include <numeric>
 #include <utility>
 #include <vector>
 
+#include <range/v3/view/span.hpp>
+
 // external
 #include <sophus/common.hpp>
 #include <sophus/se2.hpp>
@@ -162,6 +165,23 @@ TYPED_TEST(LandmarkSensorModelTests, OneStdInBearing) {
   }
 }
 
+TYPED_TEST(LandmarkSensorModelTests, BatchMatchesPerState) {
+  auto map = LandmarkMap{default_map_boundaries, {{{3.0, -2.0, 0.0}, 0}}};
+  const auto sensor_model = TypeParam{get_default_model_params(), std::move(map)};
+  const auto state_weighting_function = sensor_model({{{1.0, 2.0, 0.0}, 0}, {{0.0, 2.0, 0.0}, 0}});
+
+  auto states = std::vector<typename TypeParam::state_type>{
+      get_robot_pose_in_world<typename TypeParam::state_type>(), typename TypeParam::state_type{}};
+  auto weights = std::vector<double>(states.size(), 1.0);
+  state_weighting_function(
+      ranges::make_span(states.data(), static_cast<std::ptrdiff_t>(states.size())),
+      ranges::make_span(weights.data(), static_cast<std::ptrdiff_t>(weights.size())));
+
+  for (std::size_t index = 0; index < states.size(); ++index) {
+    EXPECT_DOUBLE_EQ(weights[index], state_weighting_function(states[index]));
+  }
+}
+
 TYPED_TEST(LandmarkSensorModelTests, NoSuchLandmark) {
   const auto pose = get_robot_pose_in_world<typename TypeParam::state_type>();
   // test case where there is not landmark in the map of the detected id
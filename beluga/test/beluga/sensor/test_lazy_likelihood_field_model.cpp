@@ -0,0 +1,96 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include <sophus/common.hpp>
+
+#include "beluga/sensor/lazy_likelihood_field_model.hpp"
+#include "beluga/sensor/likelihood_field_model.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+namespace {
+
+using beluga::testing::StaticOccupancyGrid;
+
+using EagerUUT = beluga::LikelihoodFieldModel<StaticOccupancyGrid<5, 5>>;
+using LazyUUT = beluga::LazyLikelihoodFieldModel<StaticOccupancyGrid<5, 5>>;
+
+StaticOccupancyGrid<5, 5> make_grid() {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  return StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+}
+
+TEST(LazyLikelihoodFieldModel, NoTilesComputedAtStartup) {
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  const auto sensor_model = LazyUUT{params, make_grid()};
+  ASSERT_EQ(sensor_model.memoized_tile_count(), 0U);
+}
+
+TEST(LazyLikelihoodFieldModel, WeightsMatchEagerModel) {
+  const auto grid = make_grid();
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  const auto eager_model = EagerUUT{params, grid};
+  const auto lazy_model = LazyUUT{params, grid, 2};
+
+  const auto points = std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {-50.0, 50.0}};
+  const auto states = std::vector<Sophus::SE2d>{
+      grid.origin(),
+      Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{1.25, 1.25}},
+      Sophus::SE2d{Sophus::SO2d{Sophus::Constants<double>::pi() / 2}, Eigen::Vector2d{0.5, 0.0}}};
+
+  auto eager_weighting_function = eager_model(std::vector<std::pair<double, double>>{points});
+  auto lazy_weighting_function = lazy_model(std::vector<std::pair<double, double>>{points});
+  for (const auto& state : states) {
+    ASSERT_NEAR(eager_weighting_function(state), lazy_weighting_function(state), 1e-12);
+  }
+  ASSERT_GT(lazy_model.memoized_tile_count(), 0U);
+}
+
+TEST(LazyLikelihoodFieldModel, CachedTileCountIsBounded) {
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  const auto sensor_model = LazyUUT{params, make_grid(), 1, 2};
+
+  // Touch every cell of the map; with one-cell tiles and a cap of two,
+  // eviction must keep the cache at the cap.
+  for (int yi = 0; yi < 5; ++yi) {
+    for (int xi = 0; xi < 5; ++xi) {
+      (void)sensor_model.field_at(0.25 + 0.5 * xi, 0.25 + 0.5 * yi);
+    }
+  }
+  ASSERT_EQ(sensor_model.memoized_tile_count(), 2U);
+}
+
+TEST(LazyLikelihoodFieldModel, MapUpdateDropsMemoizedTiles) {
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto sensor_model = LazyUUT{params, make_grid()};
+  (void)sensor_model.field_at(1.25, 1.25);
+  ASSERT_GT(sensor_model.memoized_tile_count(), 0U);
+  sensor_model.update_map(make_grid());
+  ASSERT_EQ(sensor_model.memoized_tile_count(), 0U);
+}
+
+}  // namespace
@@ -15,10 +15,15 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include <range/v3/range/conversion.hpp>
+#include <range/v3/view/span.hpp>
 #include <range/v3/view/transform.hpp>
 #include <sophus/common.hpp>
 
@@ -105,6 +110,220 @@ TEST(LikelihoodFieldModel, ImportanceWeight) {
   }
 }
 
+TEST(LikelihoodFieldModel, SpanMeasurementMatchesOwningOverload) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto sensor_model = UUT{params, grid};
+
+  auto buffer = std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {1.30, 1.30}};
+  const auto expected = sensor_model(std::vector{buffer})(grid.origin());
+
+  auto state_weighting_function = sensor_model(ranges::make_span(buffer.data(), 3));
+  // The points are unpacked on construction, so the buffer can be reused right away.
+  buffer.assign({{0.0, 0.0}, {0.0, 0.0}, {0.0, 0.0}});
+  ASSERT_DOUBLE_EQ(state_weighting_function(grid.origin()), expected);
+}
+
+TEST(LikelihoodFieldModel, LogLikelihoodMode) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  params.use_log_likelihood = true;
+  auto sensor_model = UUT{params, grid};
+
+  {
+    // A single beam hitting the obstacle: the weight is the beam likelihood itself.
+    auto state_weighting_function = sensor_model(std::vector<std::pair<double, double>>{{1.25, 1.25}});
+    ASSERT_NEAR(1.022, state_weighting_function(grid.origin()), 0.003);
+  }
+
+  {
+    // Two beams: the weight is the product of the individual beam likelihoods.
+    auto state_weighting_function = sensor_model(std::vector<std::pair<double, double>>{{1.25, 1.25}, {1.25, 1.25}});
+    ASSERT_NEAR(1.022 * 1.022, state_weighting_function(grid.origin()), 0.006);
+  }
+}
+
+TEST(LikelihoodFieldModel, SinglePrecisionField) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto sensor_model = beluga::LikelihoodFieldModel<StaticOccupancyGrid<5, 5>, float>{params, grid};
+
+  static_assert(
+      std::is_same_v<decltype(sensor_model.likelihood_field().data()), const std::vector<float>&>,
+      "the field storage scalar must match the template parameter");
+
+  auto state_weighting_function = sensor_model(std::vector<std::pair<double, double>>{{1.25, 1.25}});
+  ASSERT_NEAR(2.068, state_weighting_function(grid.origin()), 0.003);
+}
+
+TEST(LikelihoodFieldModel, GaussNewtonPoseRefinement) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, true , false, false, false,
+    false, false, false, false, false,
+    false, false, false, true , false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto sensor_model = UUT{params, grid};
+
+  // Hit points landing exactly on both obstacles when measured from the identity pose.
+  const auto points = std::vector<std::pair<double, double>>{{0.75, 0.75}, {1.75, 1.75}};
+  const auto seed = Sophus::SE2d{Sophus::SO2d{0.05}, Eigen::Vector2d{0.1, -0.1}};
+
+  const auto refined = sensor_model.refine_pose(points, seed, 10);
+  EXPECT_LT(refined.translation().norm(), 0.01);
+  EXPECT_LT(std::abs(refined.so2().log()), 0.01);
+
+  auto state_weighting_function = sensor_model(std::vector<std::pair<double, double>>{points});
+  EXPECT_GE(state_weighting_function(refined), state_weighting_function(seed));
+}
+
+TEST(LikelihoodFieldModel, PoseRefinementWithoutPointsKeepsSeed) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto sensor_model = UUT{params, grid};
+
+  const auto seed = Sophus::SE2d{Sophus::SO2d{0.3}, Eigen::Vector2d{0.4, 0.2}};
+  const auto refined = sensor_model.refine_pose({}, seed);
+  EXPECT_TRUE(refined.matrix().isApprox(seed.matrix()));
+}
+
+TEST(LikelihoodFieldModel, CompressedFieldMatchesPaddedField) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto compressed_params = params;
+  compressed_params.compress_likelihood_field = true;
+
+  auto sensor_model = UUT{params, grid};
+  auto compressed_sensor_model = UUT{compressed_params, grid};
+
+  const auto points =
+      std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {1.30, 1.30}, {-50.0, 50.0}};
+  auto state_weighting_function = sensor_model(std::vector<std::pair<double, double>>{points});
+  auto compressed_state_weighting_function = compressed_sensor_model(std::vector<std::pair<double, double>>{points});
+
+  const auto states = std::vector<Sophus::SE2d>{
+      grid.origin(),
+      Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{1.25, 1.25}},
+      Sophus::SE2d{Sophus::SO2d{Sophus::Constants<double>::pi() / 2}, Eigen::Vector2d{0.0, 0.0}}};
+  for (const auto& state : states) {
+    ASSERT_DOUBLE_EQ(compressed_state_weighting_function(state), state_weighting_function(state));
+  }
+}
+
+TEST(LikelihoodFieldModel, BatchFormMatchesSingleStateForm) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto sensor_model = UUT{params, grid};
+
+  auto state_weighting_function =
+      sensor_model(std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {1.30, 1.30}});
+
+  const auto states = std::vector<Sophus::SE2d>{
+      grid.origin(),
+      Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{1.25, 1.25}},
+      Sophus::SE2d{Sophus::SO2d{Sophus::Constants<double>::pi() / 2}, Eigen::Vector2d{0.0, 0.0}}};
+  auto weights = std::vector<double>(states.size(), 1.0);
+
+  state_weighting_function(
+      ranges::make_span(states.data(), static_cast<std::ptrdiff_t>(states.size())),
+      ranges::make_span(weights.data(), static_cast<std::ptrdiff_t>(weights.size())));
+
+  for (std::size_t index = 0; index < states.size(); ++index) {
+    ASSERT_NEAR(weights[index], state_weighting_function(states[index]), 1e-12);
+  }
+}
+
+TEST(LikelihoodFieldModel, PartialBeamEvaluationMatchesFullOnEvenScans) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto sensor_model = UUT{params, grid};
+
+  auto state_weighting_function = sensor_model(
+      std::vector<std::pair<double, double>>{{1.25, 1.25}, {1.25, 1.25}, {2.25, 2.25}, {2.25, 2.25}});
+
+  const double full_weight = state_weighting_function(grid.origin());
+  // Points are stored in bit-reversed scan order, so the half-scan prefix holds one
+  // hit and one miss; after rescaling the partial weight matches the full evaluation.
+  EXPECT_NEAR(full_weight, state_weighting_function(grid.origin(), 0.5), 1e-9);
+  EXPECT_NEAR(full_weight, state_weighting_function(grid.origin(), 1.0), 1e-9);
+}
+
 TEST(LikelihoodFieldModel, GridWithOffset) {
   constexpr double kResolution = 2.0;
   // clang-format off
@@ -189,6 +408,37 @@ TEST(LikelihoodFieldModel, GridWithRotationAndOffset) {
   }
 }
 
+TEST(LikelihoodFieldModel, IncrementalMapUpdateMatchesFullRebuild) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto initial_grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+
+  const auto updated_grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, false, false, true },
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto incrementally_updated_model = UUT{params, initial_grid};
+  incrementally_updated_model.update_map(updated_grid, {2, 2, 4, 4});
+
+  const auto rebuilt_model = UUT{params, updated_grid};
+
+  ASSERT_THAT(
+      incrementally_updated_model.likelihood_field().data(),
+      testing::Pointwise(testing::DoubleNear(1e-9), rebuilt_model.likelihood_field().data()));
+}
+
 TEST(LikelihoodFieldModel, GridUpdates) {
   const auto origin = Sophus::SE2d{};
 
@@ -228,4 +478,145 @@ TEST(LikelihoodFieldModel, GridUpdates) {
   }
 }
 
+// Test backend that records field uploads and weighs states against its own copy of
+// the field, following the contract documented in `LikelihoodFieldModel::WeightingBackend`.
+class RecordingWeightingBackend : public UUT::WeightingBackend {
+ public:
+  void upload_field(
+      ranges::span<const double> field,
+      std::size_t width,
+      double resolution,
+      const Sophus::SE2d& world_to_field,
+      double unknown_value,
+      bool log_space) override {
+    field_ = std::vector<double>(field.begin(), field.end());
+    width_ = width;
+    resolution_ = resolution;
+    world_to_field_ = world_to_field;
+    unknown_value_ = unknown_value;
+    log_space_ = log_space;
+    ++upload_count_;
+  }
+
+  void weigh(
+      ranges::span<const Sophus::SE2d> states,
+      ranges::span<const double> point_xs,
+      ranges::span<const double> point_ys,
+      ranges::span<double> importance_weights) override {
+    const auto height = field_.size() / width_;
+    for (std::ptrdiff_t index = 0; index < states.size(); ++index) {
+      const auto transform = world_to_field_ * states[index];
+      double accumulated = 0.0;
+      for (std::ptrdiff_t point = 0; point < point_xs.size(); ++point) {
+        const auto position = transform * Eigen::Vector2d{point_xs[point], point_ys[point]};
+        const auto x = static_cast<int>(std::floor(position.x() / resolution_));
+        const auto y = static_cast<int>(std::floor(position.y() / resolution_));
+        const bool inside = x >= 0 && y >= 0 && static_cast<std::size_t>(x) < width_ &&
+                            static_cast<std::size_t>(y) < height;
+        accumulated += inside ? field_[static_cast<std::size_t>(y) * width_ + static_cast<std::size_t>(x)]
+                              : unknown_value_;
+      }
+      importance_weights[index] = log_space_ ? std::exp(accumulated) : 1.0 + accumulated;
+    }
+  }
+
+  [[nodiscard]] std::size_t upload_count() const { return upload_count_; }
+
+ private:
+  std::vector<double> field_;
+  std::size_t width_{0};
+  double resolution_{0.0};
+  Sophus::SE2d world_to_field_;
+  double unknown_value_{0.0};
+  bool log_space_{false};
+  std::size_t upload_count_{0};
+};
+
+TEST(LikelihoodFieldModel, FloatStateInstantiation) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto sensor_model = beluga::LikelihoodFieldModel<StaticOccupancyGrid<5, 5>, double, float>{params, grid};
+  static_assert(std::is_same_v<decltype(sensor_model)::state_type, Sophus::SE2f>);
+  auto reference_model = UUT{params, grid};
+
+  auto state_weighting_function = sensor_model(std::vector<std::pair<double, double>>{{1.25, 1.25}, {2.25, 2.25}});
+  auto reference_weighting_function =
+      reference_model(std::vector<std::pair<double, double>>{{1.25, 1.25}, {2.25, 2.25}});
+
+  // Same field and points; only the state precision differs.
+  EXPECT_NEAR(
+      state_weighting_function(Sophus::SE2f{Sophus::SO2f{}, Eigen::Vector2f{1.0F, 1.0F}}),
+      reference_weighting_function(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{1.0, 1.0}}), 1e-4);
+}
+
+TEST(LikelihoodFieldModel, WeightingBackendReceivesFieldUploads) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto sensor_model = UUT{params, grid};
+
+  auto backend = std::make_shared<RecordingWeightingBackend>();
+  ASSERT_EQ(backend->upload_count(), 0U);
+
+  // Attaching uploads the current field right away; a map swap re-uploads.
+  sensor_model.set_weighting_backend(backend);
+  ASSERT_EQ(backend->upload_count(), 1U);
+  sensor_model.update_map(std::move(grid));
+  ASSERT_EQ(backend->upload_count(), 2U);
+}
+
+TEST(LikelihoodFieldModel, BatchFormRoutesThroughWeightingBackend) {
+  constexpr double kResolution = 0.5;
+  // clang-format off
+  const auto grid = StaticOccupancyGrid<5, 5>{{
+    false, false, false, false, false,
+    false, false, false, false, false,
+    false, false, true , false, false,
+    false, false, false, false, false,
+    false, false, false, false, false},
+    kResolution};
+  // clang-format on
+
+  const auto params = beluga::LikelihoodFieldModelParam{2.0, 20.0, 0.5, 0.5, 0.2};
+  auto sensor_model = UUT{params, grid};
+
+  auto state_weighting_function =
+      sensor_model(std::vector<std::pair<double, double>>{{1.20, 1.20}, {1.25, 1.25}, {1.30, 1.30}});
+
+  const auto states = std::vector<Sophus::SE2d>{
+      grid.origin(),
+      Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{1.25, 1.25}},
+      Sophus::SE2d{Sophus::SO2d{Sophus::Constants<double>::pi() / 2}, Eigen::Vector2d{0.0, 0.0}}};
+  auto weights = std::vector<double>(states.size(), 1.0);
+
+  sensor_model.set_weighting_backend(std::make_shared<RecordingWeightingBackend>());
+  state_weighting_function(
+      ranges::make_span(states.data(), static_cast<std::ptrdiff_t>(states.size())),
+      ranges::make_span(weights.data(), static_cast<std::ptrdiff_t>(weights.size())));
+
+  // A contract-faithful backend reproduces the CPU path weights.
+  for (std::size_t index = 0; index < states.size(); ++index) {
+    ASSERT_NEAR(weights[index], state_weighting_function(states[index]), 1e-12);
+  }
+}
+
 }  // namespace
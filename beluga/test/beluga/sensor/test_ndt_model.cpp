@@ -130,6 +130,20 @@ TEST(NDTSensorModelTests, ToCellsNotEnoughPointsInCell) {
   ASSERT_EQ(cells.size(), 0UL);
 }
 
+TEST(NDTSensorModelTests, ToCellsMatchesFitPoints) {
+  const double map_res = 0.5;
+  const std::vector map_data{
+      Eigen::Vector2d{0.1, 0.2},  Eigen::Vector2d{0.112, 0.22}, Eigen::Vector2d{0.15, 0.23},
+      Eigen::Vector2d{0.1, 0.24}, Eigen::Vector2d{0.16, 0.25},  Eigen::Vector2d{0.1, 0.26},
+  };
+  const auto cells = detail::to_cells<2UL>(map_data, map_res);
+  ASSERT_EQ(cells.size(), 1UL);
+  // The streaming accumulation must match the two-pass fit over the same points.
+  const auto expected = detail::fit_points<2>(map_data);
+  ASSERT_TRUE(cells.front().mean.isApprox(expected.mean, 1e-9));
+  ASSERT_TRUE(cells.front().covariance.isApprox(expected.covariance, 1e-9));
+}
+
 TEST(NDTSensorModelTests, SensorModel) {
   const double map_res = 0.5;
   const std::vector map_data{
@@ -155,6 +169,37 @@ TEST(NDTSensorModelTests, SensorModel) {
   ASSERT_DOUBLE_EQ(state_weighing_fn(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{-10, -10}}), 1.0);
 }
 
+TEST(NDTSensorModelTests, BatchedWeightMatchesPerCellLikelihoods) {
+  const double map_res = 0.5;
+  const std::vector map_data{
+      Eigen::Vector2d{0.1, 0.2},  Eigen::Vector2d{0.112, 0.22}, Eigen::Vector2d{0.15, 0.23},
+      Eigen::Vector2d{0.1, 0.24}, Eigen::Vector2d{0.16, 0.25},  Eigen::Vector2d{0.1, 0.26},
+      Eigen::Vector2d{1.1, 1.2},  Eigen::Vector2d{1.112, 1.22}, Eigen::Vector2d{1.15, 1.23},
+      Eigen::Vector2d{1.1, 1.24}, Eigen::Vector2d{1.16, 1.25},  Eigen::Vector2d{1.1, 1.26},
+  };
+
+  typename sparse_grid_2d_t::map_type map_cells_data;
+  for (const auto& cell : detail::to_cells<2UL>(map_data, map_res)) {
+    map_cells_data[(cell.mean.array() / map_res).cast<int>()] = cell;
+  }
+  const NDTSensorModel model{{}, sparse_grid_2d_t{map_cells_data, map_res}};
+
+  std::vector measurement = map_data;
+  const auto state_weighing_fn = model(std::move(measurement));
+
+  for (const auto& state : {
+           Sophus::SE2d{},
+           Sophus::SE2d{Sophus::SO2d{0.3}, Eigen::Vector2d{0.1, -0.2}},
+           Sophus::SE2d{Sophus::SO2d{-1.2}, Eigen::Vector2d{0.5, 0.25}},
+       }) {
+    double expected = 1.0;
+    for (const auto& cell : detail::to_cells<2UL>(map_data, map_res)) {
+      expected += model.likelihood_at(state * cell);
+    }
+    ASSERT_NEAR(state_weighing_fn(state), expected, 1e-12);
+  }
+}
+
 TEST(NDTSensorModelTests, LoadFromHDF5HappyPath) {
   const auto ndt_map_representation = io::load_from_hdf5_2d<sparse_grid_2d_t>("./test_data/turtlebot3_world.hdf5");
   ASSERT_EQ(ndt_map_representation.size(), 30UL);
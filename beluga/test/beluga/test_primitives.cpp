@@ -14,6 +14,7 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
 #include <tuple>
 
 #include <range/v3/utility/common_tuple.hpp>
@@ -69,6 +70,7 @@ class PrimitivesTest : public testing::Test {};
 
 using PrimitivesTestCases = testing::Types<
     std::tuple<int, beluga::Weight>,
+    std::tuple<int, beluga::WeightF>,
     ranges::common_tuple<int, beluga::Weight>,
     user::SimplestPossibleParticle,
     user::ParticleWithMemberExtensions,
@@ -90,4 +92,23 @@ TYPED_TEST(PrimitivesTest, Const) {
   ASSERT_EQ(beluga::weight(particle), 5);
 }
 
+TEST(ClusterPrimitive, TupleElement) {
+  auto particle = std::make_tuple(1, beluga::Weight(2.0), beluga::Cluster(3));
+  ASSERT_EQ(beluga::cluster(particle), 3UL);
+  beluga::cluster(particle) = 4;
+  ASSERT_EQ(beluga::cluster(particle), 4UL);
+}
+
+TEST(ClusterPrimitive, MemberVariable) {
+  struct Particle {
+    int state;
+    double weight;
+    std::size_t cluster;
+  };
+  auto particle = Particle{1, 2.0, 3};
+  ASSERT_EQ(beluga::cluster(particle), 3UL);
+  beluga::cluster(particle) = 4;
+  ASSERT_EQ(beluga::cluster(particle), 4UL);
+}
+
 }  // namespace
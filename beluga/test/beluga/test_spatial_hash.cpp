@@ -16,15 +16,22 @@
 
 #include <algorithm>
 #include <array>
+#include <cmath>
+#include <cstddef>
 #include <iterator>
+#include <ratio>
 #include <tuple>
 #include <vector>
 
 #include <range/v3/range/conversion.hpp>
 #include <range/v3/view/cartesian_product.hpp>
 #include <range/v3/view/iota.hpp>
+#include <range/v3/view/span.hpp>
 #include <range/v3/view/transform.hpp>
 
+#include <sophus/se2.hpp>
+#include <sophus/se3.hpp>
+
 #include "beluga/algorithm/spatial_hash.hpp"
 
 namespace {
@@ -152,4 +159,140 @@ TEST(SpatialHash, NonPeriodicityCheck2) {
   }
 }
 
+TEST(SpatialHash, BatchMatchesPerStateHash) {
+  const auto hasher = beluga::spatial_hash<Sophus::SE2d>{0.5, 0.5, 0.25};
+  const auto states = std::vector{
+      Sophus::SE2d{Sophus::SO2d{0.1}, Eigen::Vector2d{1.3, -2.7}},
+      Sophus::SE2d{Sophus::SO2d{-1.5}, Eigen::Vector2d{-0.4, 0.0}},
+      Sophus::SE2d{Sophus::SO2d{2.8}, Eigen::Vector2d{10.0, 5.1}},
+  };
+
+  auto x = std::vector<double>{};
+  auto y = std::vector<double>{};
+  auto cos_theta = std::vector<double>{};
+  auto sin_theta = std::vector<double>{};
+  for (const auto& state : states) {
+    x.push_back(state.translation().x());
+    y.push_back(state.translation().y());
+    cos_theta.push_back(state.so2().unit_complex().x());
+    sin_theta.push_back(state.so2().unit_complex().y());
+  }
+
+  auto hashes = std::vector<std::size_t>(states.size());
+  const auto size = static_cast<std::ptrdiff_t>(states.size());
+  hasher(
+      ranges::make_span(x.data(), size), ranges::make_span(y.data(), size), ranges::make_span(cos_theta.data(), size),
+      ranges::make_span(sin_theta.data(), size), ranges::make_span(hashes.data(), size));
+
+  for (std::size_t index = 0; index < states.size(); ++index) {
+    EXPECT_EQ(hashes[index], hasher(states[index]));
+  }
+}
+
+TEST(SpatialHash, FloatStateMatchesDoubleStateHash) {
+  const auto double_hasher = beluga::spatial_hash<Sophus::SE2d>{0.5, 0.5, 0.25};
+  const auto float_hasher = beluga::spatial_hash<Sophus::SE2f>{0.5, 0.5, 0.25};
+  // Cell-center poses are exactly representable in both precisions, so a float
+  // state must land in the same bucket as its double counterpart.
+  const auto states = std::vector{
+      Sophus::SE2d{Sophus::SO2d{0.125}, Eigen::Vector2d{1.25, -2.75}},
+      Sophus::SE2d{Sophus::SO2d{-1.4}, Eigen::Vector2d{-0.5, 0.0}},
+      Sophus::SE2d{Sophus::SO2d{0.0}, Eigen::Vector2d{10.0, 5.25}},
+  };
+  for (const auto& state : states) {
+    EXPECT_EQ(float_hasher(state.cast<float>()), double_hasher(state));
+  }
+}
+
+TEST(SpatialHash, StaticResolutionMatchesRuntimeResolution) {
+  const auto runtime_hasher = beluga::spatial_hash<Sophus::SE2d>{0.5, 0.5, 0.25};
+  const auto static_hasher = beluga::static_spatial_hash<std::ratio<1, 2>, std::ratio<1, 4>>{};
+  const auto states = std::vector{
+      Sophus::SE2d{Sophus::SO2d{0.1}, Eigen::Vector2d{1.3, -2.7}},
+      Sophus::SE2d{Sophus::SO2d{-1.5}, Eigen::Vector2d{-0.4, 0.0}},
+      Sophus::SE2d{Sophus::SO2d{2.8}, Eigen::Vector2d{10.0, 5.1}},
+  };
+  for (const auto& state : states) {
+    EXPECT_EQ(static_hasher(state), runtime_hasher(state));
+  }
+}
+
+TEST(SpatialHash, Se3BucketsByResolution) {
+  const auto hasher = beluga::spatial_hash<Sophus::SE3d>{0.5, 0.25};
+
+  // States within the same translation and rotation cells share a bucket.
+  const auto reference = Sophus::SE3d{Sophus::SO3d::rotZ(0.05), Eigen::Vector3d{1.3, -2.7, 0.6}};
+  const auto nearby = Sophus::SE3d{Sophus::SO3d::rotZ(0.1), Eigen::Vector3d{1.4, -2.6, 0.7}};
+  EXPECT_EQ(hasher(reference), hasher(nearby));
+
+  // Moving one resolution step along any axis changes the bucket.
+  EXPECT_NE(hasher(reference), hasher(Sophus::SE3d{reference.so3(), reference.translation() + Eigen::Vector3d{0.5, 0., 0.}}));
+  EXPECT_NE(hasher(reference), hasher(Sophus::SE3d{reference.so3(), reference.translation() + Eigen::Vector3d{0., 0.5, 0.}}));
+  EXPECT_NE(hasher(reference), hasher(Sophus::SE3d{reference.so3(), reference.translation() + Eigen::Vector3d{0., 0., 0.5}}));
+  EXPECT_NE(hasher(reference), hasher(Sophus::SE3d{Sophus::SO3d::rotZ(0.4) * reference.so3(), reference.translation()}));
+  EXPECT_NE(hasher(reference), hasher(Sophus::SE3d{Sophus::SO3d::rotX(0.4) * reference.so3(), reference.translation()}));
+}
+
+TEST(SpatialHash, Se3NoCollisionsOverTranslationGrid) {
+  const auto hasher = beluga::spatial_hash<Sophus::SE3d>{1.0, 1.0};
+  constexpr int kLimit = 20;
+
+  // Brute-force search for collisions over the translation lattice.
+  auto hashes = std::vector<std::size_t>{};
+  for (int x = -kLimit; x <= kLimit; ++x) {
+    for (int y = -kLimit; y <= kLimit; ++y) {
+      for (int z = -kLimit; z <= kLimit; ++z) {
+        hashes.push_back(hasher(
+            Sophus::SE3d{Sophus::SO3d{}, Eigen::Vector3d{static_cast<double>(x), static_cast<double>(y), static_cast<double>(z)}}));
+      }
+    }
+  }
+  std::sort(std::begin(hashes), std::end(hashes));
+  auto it = std::adjacent_find(std::begin(hashes), std::end(hashes));
+  const bool has_duplicates = it != std::end(hashes);
+  ASSERT_FALSE(has_duplicates);
+}
+
+TEST(SuggestSpatialHashResolution, MatchesKnownSpread) {
+  // 1000 states evenly spread over [0, 10] in x, [0, 2] in y, fixed heading;
+  // the uniform distribution over [0, L] has a standard deviation of L / sqrt(12).
+  auto states = std::vector<Sophus::SE2d>{};
+  for (std::size_t index = 0; index < 1000; ++index) {
+    const double fraction = static_cast<double>(index) / 999.;
+    states.emplace_back(Sophus::SO2d{0.5}, Eigen::Vector2d{10. * fraction, 2. * fraction});
+  }
+  const auto resolution = beluga::suggest_spatial_hash_resolution(states, 2.0);
+  EXPECT_NEAR(resolution[0], 10. / std::sqrt(12.) / 2., 0.05);
+  EXPECT_NEAR(resolution[1], 2. / std::sqrt(12.) / 2., 0.05);
+  EXPECT_EQ(resolution[2], 1e-3);  // no angular spread, floored suggestion
+}
+
+TEST(SuggestSpatialHashResolution, CollapsedSetIsFloored) {
+  const auto states = std::vector(10UL, Sophus::SE2d{Sophus::SO2d{1.0}, Eigen::Vector2d{3.0, -2.0}});
+  const auto resolution = beluga::suggest_spatial_hash_resolution(states);
+  EXPECT_EQ(resolution[0], 1e-3);
+  EXPECT_EQ(resolution[1], 1e-3);
+  EXPECT_EQ(resolution[2], 1e-3);
+}
+
+TEST(SuggestSpatialHashResolution, TooFewStatesReturnsDefaults) {
+  const auto states = std::vector{Sophus::SE2d{}};
+  const auto resolution = beluga::suggest_spatial_hash_resolution(states);
+  EXPECT_EQ(resolution[0], 1.);
+  EXPECT_EQ(resolution[1], 1.);
+  EXPECT_EQ(resolution[2], 1.);
+}
+
+TEST(SuggestSpatialHashResolution, AngularSpread) {
+  // Headings spread uniformly over a quarter turn give a measurable circular stddev.
+  auto states = std::vector<Sophus::SE2d>{};
+  for (std::size_t index = 0; index < 1000; ++index) {
+    const double fraction = static_cast<double>(index) / 999.;
+    states.emplace_back(Sophus::SO2d{fraction * Sophus::Constants<double>::pi() / 2.}, Eigen::Vector2d{0., 0.});
+  }
+  const auto resolution = beluga::suggest_spatial_hash_resolution(states, 2.0);
+  const double expected_sigma = Sophus::Constants<double>::pi() / 2. / std::sqrt(12.);
+  EXPECT_NEAR(resolution[2], expected_sigma / 2., 0.05);
+}
+
 }  // namespace
@@ -0,0 +1,101 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <Eigen/Core>
+
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/testing/synthetic_world.hpp"
+
+namespace {
+
+using beluga::testing::generate_world;
+using beluga::testing::simulate_scan;
+using beluga::testing::SyntheticWorldParams;
+
+TEST(SyntheticWorld, Dimensions) {
+  auto params = SyntheticWorldParams{};
+  params.width = 20.0;
+  params.height = 10.0;
+  params.resolution = 0.1;
+  const auto world = generate_world(params);
+  EXPECT_EQ(world.width(), 200UL);
+  EXPECT_EQ(world.height(), 100UL);
+  EXPECT_EQ(world.size(), 20'000UL);
+  EXPECT_DOUBLE_EQ(world.resolution(), 0.1);
+}
+
+TEST(SyntheticWorld, DeterministicForEqualSeeds) {
+  const auto first = generate_world();
+  const auto second = generate_world();
+  ASSERT_EQ(first.data(), second.data());
+}
+
+TEST(SyntheticWorld, DifferentSeedsDiffer) {
+  auto params = SyntheticWorldParams{};
+  params.seed = 1337U;
+  const auto world = generate_world(params);
+  const auto reference = generate_world();
+  ASSERT_NE(world.data(), reference.data());
+}
+
+TEST(SyntheticWorld, EnclosedByOuterWalls) {
+  const auto world = generate_world();
+  const auto traits = world.value_traits();
+  for (std::size_t xi = 0; xi < world.width(); ++xi) {
+    ASSERT_TRUE(traits.is_occupied(world.data()[xi]));
+    ASSERT_TRUE(traits.is_occupied(world.data()[(world.height() - 1) * world.width() + xi]));
+  }
+  for (std::size_t yi = 0; yi < world.height(); ++yi) {
+    ASSERT_TRUE(traits.is_occupied(world.data()[yi * world.width()]));
+    ASSERT_TRUE(traits.is_occupied(world.data()[yi * world.width() + world.width() - 1]));
+  }
+}
+
+TEST(SyntheticWorld, MostlyFreeInterior) {
+  const auto world = generate_world();
+  const auto traits = world.value_traits();
+  const auto free_count = static_cast<std::size_t>(
+      std::count_if(world.data().begin(), world.data().end(), [&traits](auto value) { return traits.is_free(value); }));
+  // Walls and clutter should not dominate; rooms stay navigable.
+  EXPECT_GT(free_count, world.size() / 2);
+}
+
+TEST(SyntheticWorld, SimulatedScanHitsWalls) {
+  const auto world = generate_world();
+  constexpr double kMaxRange = 30.0;
+  const auto pose = Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{5.0, 5.0}};
+  const auto points = simulate_scan(world, pose, 360UL, kMaxRange);
+  ASSERT_FALSE(points.empty());
+  for (const auto& [x, y] : points) {
+    EXPECT_LE(std::hypot(x, y), kMaxRange);
+  }
+}
+
+TEST(SyntheticWorld, SimulatedScanIsDeterministic) {
+  const auto world = generate_world();
+  const auto pose = Sophus::SE2d{Sophus::SO2d{0.3}, Eigen::Vector2d{15.0, 25.0}};
+  const auto first = simulate_scan(world, pose);
+  const auto second = simulate_scan(world, pose);
+  ASSERT_EQ(first, second);
+}
+
+}  // namespace
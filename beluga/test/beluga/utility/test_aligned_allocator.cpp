@@ -0,0 +1,56 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <vector>
+
+#include "beluga/utility/aligned_allocator.hpp"
+
+namespace {
+
+TEST(AlignedAllocator, AllocationsAreAligned) {
+  beluga::AlignedAllocator<double, 64> allocator;
+  double* pointer = allocator.allocate(13);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pointer) % 64, 0);
+  allocator.deallocate(pointer, 13);
+}
+
+TEST(AlignedAllocator, WorksWithStandardContainers) {
+  std::vector<float, beluga::AlignedAllocator<float, 64>> vector;
+  vector.resize(100);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(vector.data()) % 64, 0);
+}
+
+TEST(AlignedAllocator, DefaultInitializingConstruct) {
+  struct TrackingDefault {
+    TrackingDefault() : value(42) {}
+    int value;
+  };
+  beluga::AlignedAllocator<TrackingDefault, 64> allocator;
+  TrackingDefault* pointer = allocator.allocate(1);
+  allocator.construct(pointer);
+  // Non-trivial types are still default constructed.
+  EXPECT_EQ(pointer->value, 42);
+  pointer->~TrackingDefault();
+  allocator.deallocate(pointer, 1);
+}
+
+TEST(AlignedAllocator, ComparesEqual) {
+  EXPECT_TRUE((beluga::AlignedAllocator<int, 64>{} == beluga::AlignedAllocator<double, 64>{}));
+  EXPECT_FALSE((beluga::AlignedAllocator<int, 64>{} != beluga::AlignedAllocator<double, 64>{}));
+}
+
+}  // namespace
@@ -0,0 +1,85 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <vector>
+
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/sensor/data/storage_layout.hpp"
+#include "beluga/sensor/data/value_grid.hpp"
+#include "beluga/utility/huge_page_allocator.hpp"
+
+namespace {
+
+TEST(HugePageAllocator, LargeAllocationsAreHugePageAligned) {
+  beluga::HugePageAllocator<double> allocator;
+  constexpr std::size_t kCount = beluga::HugePageAllocator<double>::kHugePageSize / sizeof(double);
+  double* pointer = allocator.allocate(kCount);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pointer) % beluga::HugePageAllocator<double>::kHugePageSize, 0);
+  allocator.deallocate(pointer, kCount);
+}
+
+TEST(HugePageAllocator, SmallAllocationsFallBackToCacheLineAlignment) {
+  beluga::HugePageAllocator<double> allocator;
+  double* pointer = allocator.allocate(13);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(pointer) % 64, 0);
+  allocator.deallocate(pointer, 13);
+}
+
+TEST(HugePageAllocator, WorksWithStandardContainers) {
+  std::vector<float, beluga::HugePageAllocator<float>> vector;
+  vector.resize(1'000'000);
+  EXPECT_EQ(
+      reinterpret_cast<std::uintptr_t>(vector.data()) % beluga::HugePageAllocator<float>::kHugePageSize,  //
+      0);
+}
+
+TEST(HugePageAllocator, WorksAsParticleContainerAllocator) {
+  using Particle = std::tuple<int, beluga::Weight>;
+  auto particles = beluga::TupleVector<Particle, beluga::HugePageAllocator<std::byte>>{};
+  particles.resize(100);
+  EXPECT_EQ(particles.size(), 100UL);
+}
+
+TEST(HugePageAllocator, WorksAsGridStorageAllocator) {
+  using Layout = beluga::StorageLayoutWithAllocator<beluga::RowMajorStorageLayout, beluga::HugePageAllocator<std::byte>>;
+  const auto grid = beluga::ValueGrid2<double, Layout>{{1., 2., 3., 4.}, 2};
+  EXPECT_EQ(grid.data_at(1, 1).value(), 4.);
+}
+
+TEST(HugePageAllocator, DefaultInitializingConstruct) {
+  struct TrackingDefault {
+    TrackingDefault() : value(42) {}
+    int value;
+  };
+  beluga::HugePageAllocator<TrackingDefault> allocator;
+  TrackingDefault* pointer = allocator.allocate(1);
+  allocator.construct(pointer);
+  // Non-trivial types are still default constructed.
+  EXPECT_EQ(pointer->value, 42);
+  pointer->~TrackingDefault();
+  allocator.deallocate(pointer, 1);
+}
+
+TEST(HugePageAllocator, ComparesEqual) {
+  EXPECT_TRUE((beluga::HugePageAllocator<int>{} == beluga::HugePageAllocator<double>{}));
+  EXPECT_FALSE((beluga::HugePageAllocator<int>{} != beluga::HugePageAllocator<double>{}));
+}
+
+}  // namespace
@@ -16,6 +16,8 @@
 #include <gtest/gtest.h>
 
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <cstdlib>
 #include <functional>
 #include <iterator>
@@ -49,6 +51,27 @@ TEST(IndexingIterator, ConstIteratorTraits) {
   static_assert(std::is_same_v<typename Iterator::difference_type, ssize_type>);
 }
 
+TEST(IndexingIterator, ContiguousIteratorTraits) {
+  // Containers that guarantee flat storage subscripting strengthen the iterator to contiguous.
+  static_assert(ranges::contiguous_iterator<beluga::IndexingIterator<std::vector<int>>>);
+  static_assert(ranges::contiguous_iterator<beluga::IndexingIterator<const std::vector<int>>>);
+  static_assert(ranges::contiguous_iterator<beluga::IndexingIterator<std::array<int, 4>>>);
+  static_assert(ranges::contiguous_iterator<beluga::IndexingIterator<const std::array<int, 4>>>);
+}
+
+TEST(IndexingIterator, NonContiguousIteratorTraitsByDefault) {
+  // Exposing `data()` is not enough to be treated as contiguous; the trait is strictly opt-in.
+  struct PlainIndexable {
+    using size_type = std::size_t;
+    int& operator[](size_type);
+    int* data();
+  };
+  static_assert(!beluga::has_contiguous_layout_v<PlainIndexable>);
+  using Iterator = beluga::IndexingIterator<PlainIndexable>;
+  static_assert(ranges::random_access_iterator<Iterator>);
+  static_assert(!ranges::contiguous_iterator<Iterator>);
+}
+
 TEST(IndexingIterator, Arithmetic) {
   const auto sequence = std::vector{0, 1};
   auto begin = beluga::IndexingIterator(sequence);
@@ -0,0 +1,93 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <chrono>
+
+#include "beluga/utility/scoped_profiler.hpp"
+
+namespace {
+
+using namespace std::chrono_literals;
+
+TEST(ScopedProfiler, EmptySnapshot) {
+  const auto profiler = beluga::Profiler{};
+  ASSERT_TRUE(profiler.snapshot().empty());
+}
+
+TEST(ScopedProfiler, RecordAggregates) {
+  auto profiler = beluga::Profiler{};
+  profiler.record("stage", 1ms);
+  profiler.record("stage", 3ms);
+  const auto snapshot = profiler.snapshot();
+  ASSERT_EQ(snapshot.size(), 1U);
+  const auto& aggregate = snapshot.at("stage");
+  ASSERT_EQ(aggregate.count, 2U);
+  ASSERT_EQ(aggregate.mean, 2ms);
+  ASSERT_EQ(aggregate.max, 3ms);
+}
+
+TEST(ScopedProfiler, PercentileWithinBucketResolution) {
+  auto profiler = beluga::Profiler{};
+  for (int i = 0; i < 95; ++i) {
+    profiler.record("stage", 1ms);
+  }
+  for (int i = 0; i < 5; ++i) {
+    profiler.record("stage", 100ms);
+  }
+  const auto aggregate = profiler.snapshot().at("stage");
+  // The p95 lands in the 1 ms bucket; its upper edge is below 2 ms.
+  ASSERT_GE(aggregate.p95, 1ms);
+  ASSERT_LT(aggregate.p95, 2ms);
+  ASSERT_EQ(aggregate.max, 100ms);
+}
+
+TEST(ScopedProfiler, PercentileClampedToMax) {
+  auto profiler = beluga::Profiler{};
+  profiler.record("stage", 1ms);
+  const auto aggregate = profiler.snapshot().at("stage");
+  ASSERT_EQ(aggregate.p95, 1ms);
+}
+
+TEST(ScopedProfiler, ScopedMeasurement) {
+  auto profiler = beluga::Profiler{};
+  {
+    const auto measurement = profiler.measure("scope");
+    static_cast<void>(measurement);
+  }
+  const auto snapshot = profiler.snapshot();
+  ASSERT_EQ(snapshot.at("scope").count, 1U);
+}
+
+TEST(ScopedProfiler, SeparateSections) {
+  auto profiler = beluga::Profiler{};
+  profiler.record("first", 1ms);
+  profiler.record("second", 2ms);
+  profiler.record("second", 4ms);
+  const auto snapshot = profiler.snapshot();
+  ASSERT_EQ(snapshot.size(), 2U);
+  ASSERT_EQ(snapshot.at("first").count, 1U);
+  ASSERT_EQ(snapshot.at("second").count, 2U);
+}
+
+TEST(ScopedProfiler, Reset) {
+  auto profiler = beluga::Profiler{};
+  profiler.record("stage", 1ms);
+  profiler.reset();
+  ASSERT_TRUE(profiler.snapshot().empty());
+}
+
+}  // namespace
@@ -0,0 +1,136 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <future>
+#include <numeric>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+
+#include "beluga/actions/reweight.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/utility/thread_pool.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+TEST(ThreadPool, BulkExecuteRunsEveryTask) {
+  auto pool = beluga::ThreadPool{4};
+  std::atomic<std::size_t> counter{0};
+  pool.bulk_execute(100, [&counter](std::size_t) { counter.fetch_add(1); });
+  ASSERT_EQ(counter.load(), 100);
+}
+
+TEST(ThreadPool, ExecuteRunsFireAndForgetTask) {
+  auto pool = beluga::ThreadPool{2};
+  auto done = std::promise<int>{};
+  pool.execute([&done] { done.set_value(42); });
+  ASSERT_EQ(done.get_future().get(), 42);
+}
+
+TEST(ThreadPool, SubmitReturnsResultThroughFuture) {
+  auto pool = beluga::ThreadPool{2};
+  auto future = pool.submit([] { return 42; });
+  ASSERT_EQ(future.get(), 42);
+}
+
+TEST(ThreadPool, SubmitToSingleWorkerRunsInOrder) {
+  auto pool = beluga::ThreadPool{1};
+  auto order = std::vector<int>{};
+  auto first = pool.submit([&order] { order.push_back(1); });
+  auto second = pool.submit([&order] { order.push_back(2); });
+  auto third = pool.submit([&order] { order.push_back(3); });
+  first.wait();
+  second.wait();
+  third.wait();
+  ASSERT_EQ(order, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(ThreadPool, ForEach) {
+  auto pool = beluga::ThreadPool{4};
+  auto values = std::vector<int>(10'000, 1);
+  pool.for_each(values.begin(), values.end(), [](int& value) { value = 2; });
+  ASSERT_EQ(std::accumulate(values.begin(), values.end(), 0), 20'000);
+}
+
+TEST(ThreadPool, Transform) {
+  auto pool = beluga::ThreadPool{2};
+  auto input = std::vector<int>(5'000);
+  std::iota(input.begin(), input.end(), 0);
+  auto output = std::vector<int>(input.size());
+  pool.transform(input.begin(), input.end(), output.begin(), [](int value) { return value * 2; });
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    ASSERT_EQ(output[i], input[i] * 2);
+  }
+}
+
+TEST(ThreadPool, TransformReduce) {
+  auto pool = beluga::ThreadPool{4};
+  auto values = std::vector<int>(10'000, 1);
+  const int total = pool.transform_reduce(values.begin(), values.end(), 5, std::plus<>{}, [](int value) {
+    return value * 3;
+  });
+  ASSERT_EQ(total, 30'005);
+}
+
+TEST(ThreadPool, ChunkCountScalesWithInput) {
+  auto pool = beluga::ThreadPool{4};
+  ASSERT_EQ(pool.chunk_count(100), 1);
+  ASSERT_LE(pool.chunk_count(1'000'000), 16);
+  ASSERT_GE(pool.chunk_count(1'000'000), 4);
+}
+
+TEST(ThreadPool, StaticPartitioningRunsEveryTask) {
+  auto pool = beluga::ThreadPool{4, false, true};
+  ASSERT_TRUE(pool.static_partitioning());
+  std::atomic<std::size_t> counter{0};
+  pool.bulk_execute(100, [&counter](std::size_t) { counter.fetch_add(1); });
+  ASSERT_EQ(counter.load(), 100);
+  auto future = pool.submit([] { return 42; });
+  ASSERT_EQ(future.get(), 42);
+}
+
+TEST(ThreadPool, StaticPartitioningKeepsChunksOnTheirWorker) {
+  auto pool = beluga::ThreadPool{4, false, true};
+  ASSERT_EQ(pool.chunk_count(1'000'000), 4);
+  auto values = std::vector<std::thread::id>(100'000);
+  const auto record = [](std::thread::id& slot) { slot = std::this_thread::get_id(); };
+  pool.for_each(values.begin(), values.end(), record);
+  auto repeat = std::vector<std::thread::id>(values.size());
+  pool.for_each(repeat.begin(), repeat.end(), record);
+  // With a fixed chunk-to-worker mapping and no stealing, every element is
+  // touched by the same thread on every pass.
+  ASSERT_EQ(values, repeat);
+}
+
+TEST(ThreadPool, PoolPolicyDrivesActions) {
+  auto pool = beluga::ThreadPool{2};
+  auto policy = beluga::execution::pool_policy{pool};
+  static_assert(beluga::is_execution_policy_v<beluga::execution::pool_policy>);
+
+  auto input = std::vector<std::tuple<int, beluga::Weight>>(10'000, std::make_tuple(2, beluga::Weight(1.0)));
+  input |= beluga::actions::reweight(policy, [](int value) { return value; });
+  auto weights = input | beluga::views::weights | ranges::to<std::vector>;
+  ASSERT_THAT(weights, testing::Each(2.0));
+}
+
+}  // namespace
@@ -0,0 +1,83 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+
+namespace {
+
+TEST(ParticlesView, StatesUnwrapToContiguousSpanOverTupleContainers) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::Weight>>{
+      std::make_tuple(1, beluga::Weight(0.5)),
+      std::make_tuple(2, beluga::Weight(0.5)),
+  };
+  auto states = input | beluga::views::states;
+  // The view is the raw state column, not a proxy-cursor transform.
+  ASSERT_EQ(&states[1], &states[0] + 1);
+  states[0] = 42;
+  ASSERT_EQ(std::get<0>(input.front()), 42);
+}
+
+TEST(ParticlesView, WeightsUnwrapToContiguousSpanOverTupleContainers) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::Weight>>{
+      std::make_tuple(1, beluga::Weight(0.25)),
+      std::make_tuple(2, beluga::Weight(0.75)),
+  };
+  auto weights = beluga::views::weights(input);
+  ASSERT_EQ(&weights[1], &weights[0] + 1);
+  ASSERT_DOUBLE_EQ(weights[1], 0.75);
+}
+
+TEST(ParticlesView, FloatWeightsUnwrapToContiguousSpanOverTupleContainers) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::WeightF>>{
+      std::make_tuple(1, beluga::WeightF(0.25F)),
+      std::make_tuple(2, beluga::WeightF(0.75F)),
+  };
+  auto weights = beluga::views::weights(input);
+  ASSERT_EQ(&weights[1], &weights[0] + 1);
+  ASSERT_FLOAT_EQ(weights[1], 0.75F);
+}
+
+TEST(ParticlesView, ClustersUnwrapToContiguousSpanOverTupleContainers) {
+  auto input = beluga::TupleVector<std::tuple<int, beluga::Weight, beluga::Cluster>>{
+      std::make_tuple(1, beluga::Weight(1.0), beluga::Cluster(3)),
+  };
+  auto clusters = input | beluga::views::clusters;
+  ASSERT_EQ(clusters[0], 3UL);
+}
+
+TEST(ParticlesView, FallsBackToLazyTransformOverGenericRanges) {
+  auto input = std::vector{
+      std::make_tuple(1, beluga::Weight(0.5)),
+      std::make_tuple(2, beluga::Weight(1.5)),
+  };
+  auto states = input | beluga::views::states | ranges::to<std::vector>;
+  ASSERT_THAT(states, testing::ElementsAre(1, 2));
+  // The lazy transform still yields mutable references.
+  for (auto&& weight : input | beluga::views::weights) {
+    weight = 1.0;
+  }
+  ASSERT_DOUBLE_EQ(beluga::weight(input.back()), 1.0);
+}
+
+}  // namespace
@@ -16,6 +16,8 @@
 #include <gtest/gtest.h>
 
 #include <array>
+#include <cstddef>
+#include <random>
 #include <vector>
 
 #include <range/v3/algorithm/count.hpp>
@@ -147,6 +149,41 @@ TEST(RandomIntersperseView, ZeroProbabilityMultipass) {
   ASSERT_THAT(output | ranges::to<std::vector>, testing::ElementsAre(10, 20, 30));
 }
 
+/// A pass-through engine that counts how many times it is invoked.
+struct CountingEngine {
+  using result_type = std::mt19937::result_type;
+  static constexpr result_type min() { return std::mt19937::min(); }
+  static constexpr result_type max() { return std::mt19937::max(); }
+  result_type operator()() {
+    ++calls;
+    return engine();
+  }
+  std::mt19937 engine{42};
+  std::size_t calls = 0;
+};
+
+TEST(RandomIntersperseView, NoGeneratorCallsOnZeroProbability) {
+  const double probability = 0.0;
+  auto engine = CountingEngine{};
+  const int size = 1'000;
+  auto output = ranges::views::iota(1, size + 1) |
+                beluga::views::random_intersperse([]() { return 0; }, probability, engine);
+  ASSERT_EQ(ranges::count(output, 0), 0);
+  ASSERT_EQ(engine.calls, 0);
+}
+
+TEST(RandomIntersperseView, FewGeneratorCallsOnLowProbability) {
+  const double probability = 0.01;
+  auto engine = CountingEngine{};
+  const int size = 100'000;
+  auto output = ranges::views::iota(1, size + 1) |
+                beluga::views::random_intersperse([]() { return 0; }, probability, engine);
+  const auto count = ranges::count(output, 0);
+  ASSERT_GT(count, 0);
+  // One skip count is drawn per insertion, not per element.
+  ASSERT_LT(engine.calls, static_cast<std::size_t>(size) / 10);
+}
+
 class RandomIntersperseViewWithParam : public ::testing::TestWithParam<double> {};
 
 TEST_P(RandomIntersperseViewWithParam, TestPercentage) {
@@ -0,0 +1,77 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/all.hpp>
+
+#include "beluga/primitives.hpp"
+#include "beluga/views/residual_sample.hpp"
+
+namespace {
+
+TEST(ResidualSampleView, ProducesRequestedCount) {
+  auto input = std::vector{1, 2, 3};
+  auto output = beluga::views::residual_sample(input, 7) | ranges::to<std::vector>;
+  ASSERT_EQ(output.size(), 7);
+}
+
+TEST(ResidualSampleView, UniformWeightsAreFullyDeterministic) {
+  auto input = std::vector{1, 2, 3, 4};
+  auto output = beluga::views::residual_sample(input, 8) | ranges::to<std::vector>;
+  ASSERT_THAT(output, testing::ElementsAre(1, 1, 2, 2, 3, 3, 4, 4));
+}
+
+TEST(ResidualSampleView, AllWeightOnOneElement) {
+  auto input = std::vector{1, 2, 3};
+  auto weights = std::vector{0.0, 1.0, 0.0};
+  auto engine = std::mt19937{std::random_device()()};
+  auto output =
+      beluga::views::residual_sample(ranges::views::all(input), ranges::views::all(weights), std::size_t{5}, engine) |
+      ranges::to<std::vector>;
+  ASSERT_THAT(output, testing::Each(2));
+}
+
+TEST(ResidualSampleView, DeterministicReplicasAtLeastFloor) {
+  auto input = std::vector{1, 2};
+  auto weights = std::vector{0.3, 0.7};
+  auto engine = std::mt19937{std::random_device()()};
+  auto output =
+      beluga::views::residual_sample(ranges::views::all(input), ranges::views::all(weights), std::size_t{10}, engine) |
+      ranges::to<std::vector>;
+  const auto ones = std::count(output.begin(), output.end(), 1);
+  const auto twos = std::count(output.begin(), output.end(), 2);
+  EXPECT_GE(ones, 3);  // floor(10 * 0.3)
+  EXPECT_GE(twos, 7);  // floor(10 * 0.7)
+  EXPECT_EQ(ones + twos, 10);
+}
+
+TEST(ResidualSampleView, ParticleRangeResetsWeights) {
+  auto input = std::vector<std::tuple<int, beluga::Weight>>{{1, 0.0}, {2, 4.0}, {3, 0.0}};
+  auto output = input | beluga::views::residual_sample(4) | ranges::to<std::vector>;
+  ASSERT_EQ(output.size(), 4);
+  for (const auto& [state, weight] : output) {
+    EXPECT_EQ(state, 2);
+    EXPECT_EQ(weight, 1.0);
+  }
+}
+
+}  // namespace
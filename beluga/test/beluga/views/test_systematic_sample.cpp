@@ -0,0 +1,75 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+#include <range/v3/view/all.hpp>
+
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+#include "beluga/views/systematic_sample.hpp"
+
+namespace {
+
+TEST(SystematicSampleView, ConceptChecksFromContiguousRange) {
+  auto input = std::vector{1, 2, 3};
+  auto view = beluga::views::systematic_sample(input, 3);
+  static_assert(ranges::input_range<decltype(view)>);
+  auto output = view | ranges::to<std::vector>;
+  ASSERT_EQ(output.size(), 3);
+}
+
+TEST(SystematicSampleView, UniformWeightsYieldEachElementOnce) {
+  auto input = std::vector{1, 2, 3, 4, 5};
+  auto output = beluga::views::systematic_sample(input, input.size()) | ranges::to<std::vector>;
+  ASSERT_THAT(output, testing::ElementsAre(1, 2, 3, 4, 5));
+}
+
+TEST(SystematicSampleView, AllWeightOnOneElement) {
+  auto input = std::vector{1, 2, 3};
+  auto weights = std::vector{0.0, 1.0, 0.0};
+  auto engine = std::mt19937{std::random_device()()};
+  auto output = beluga::views::systematic_sample(
+                    ranges::views::all(input), ranges::views::all(weights), std::size_t{4}, engine) |
+                ranges::to<std::vector>;
+  ASSERT_THAT(output, testing::Each(2));
+}
+
+TEST(SystematicSampleView, ParticleRangeResetsWeights) {
+  auto input = std::vector<std::tuple<int, beluga::Weight>>{{1, 0.0}, {2, 5.0}, {3, 0.0}};
+  auto output = input | beluga::views::systematic_sample(4) | ranges::to<std::vector>;
+  ASSERT_EQ(output.size(), 4);
+  for (const auto& [state, weight] : output) {
+    EXPECT_EQ(state, 2);
+    EXPECT_EQ(weight, 1.0);
+  }
+}
+
+TEST(SystematicSampleView, ProportionalSampling) {
+  auto input = std::vector<std::tuple<int, beluga::Weight>>{{1, 0.25}, {2, 0.75}};
+  auto output = input | beluga::views::systematic_sample(100) | ranges::to<std::vector>;
+  const auto twos = std::count_if(output.begin(), output.end(), [](const auto& p) { return std::get<0>(p) == 2; });
+  // Systematic sampling guarantees counts within one of the expected value.
+  EXPECT_GE(twos, 74);
+  EXPECT_LE(twos, 76);
+}
+
+}  // namespace
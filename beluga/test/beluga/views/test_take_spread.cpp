@@ -0,0 +1,80 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <utility>
+#include <vector>
+
+#include <range/v3/range/conversion.hpp>
+
+#include "beluga/views/take_spread.hpp"
+
+namespace {
+
+using Point = std::pair<double, double>;
+
+TEST(TakeSpreadView, TakeZero) {
+  const auto input = std::vector<Point>{{0., 0.}, {1., 0.}, {2., 0.}};
+  const auto output = input | beluga::views::take_spread(0) | ranges::to<std::vector>;
+  EXPECT_TRUE(output.empty());
+}
+
+TEST(TakeSpreadView, EmptyRange) {
+  const auto input = std::vector<Point>{};
+  const auto output = input | beluga::views::take_spread(3) | ranges::to<std::vector>;
+  EXPECT_TRUE(output.empty());
+}
+
+TEST(TakeSpreadView, TakeOne) {
+  const auto input = std::vector<Point>{{0., 0.}, {1., 0.}, {2., 0.}};
+  const auto output = input | beluga::views::take_spread(1) | ranges::to<std::vector>;
+  ASSERT_THAT(output, testing::ElementsAre(Point{0., 0.}));
+}
+
+TEST(TakeSpreadView, CountLargerThanSize) {
+  const auto input = std::vector<Point>{{0., 0.}, {1., 0.}, {2., 0.}};
+  const auto output = input | beluga::views::take_spread(10) | ranges::to<std::vector>;
+  ASSERT_THAT(output, testing::ElementsAre(Point{0., 0.}, Point{1., 0.}, Point{2., 0.}));
+}
+
+TEST(TakeSpreadView, EvenlySpacedPointsMatchEvenIndexSpacing) {
+  const auto input = std::vector<Point>{{0., 0.}, {1., 0.}, {2., 0.}, {3., 0.}, {4., 0.}};
+  const auto output = input | beluga::views::take_spread(3) | ranges::to<std::vector>;
+  ASSERT_THAT(output, testing::ElementsAre(Point{0., 0.}, Point{2., 0.}, Point{4., 0.}));
+}
+
+TEST(TakeSpreadView, DenseClusterIsThinned) {
+  // A dense cluster of five nearly coincident points followed by two isolated points.
+  const auto input = std::vector<Point>{
+      {0.00, 0.}, {0.01, 0.}, {0.02, 0.}, {0.03, 0.}, {0.04, 0.}, {5.00, 0.}, {10.00, 0.}};
+  const auto output = input | beluga::views::take_spread(3) | ranges::to<std::vector>;
+  // The cluster contributes a single point; the isolated points are all preserved.
+  ASSERT_THAT(output, testing::ElementsAre(Point{0.00, 0.}, Point{5.00, 0.}, Point{10.00, 0.}));
+}
+
+TEST(TakeSpreadView, CoincidentPointsFallBackToIndexSpacing) {
+  const auto input = std::vector<Point>{{1., 1.}, {1., 1.}, {1., 1.}, {1., 1.}, {1., 1.}};
+  const auto output = input | beluga::views::take_spread(3) | ranges::to<std::vector>;
+  ASSERT_EQ(output.size(), 3);
+}
+
+TEST(TakeSpreadView, FirstAndLastAreAlwaysIncluded) {
+  const auto input = std::vector<Point>{{0., 0.}, {0.1, 0.}, {0.2, 0.}, {0.3, 0.}, {9., 0.}};
+  const auto output = input | beluga::views::take_spread(2) | ranges::to<std::vector>;
+  ASSERT_THAT(output, testing::ElementsAre(Point{0., 0.}, Point{9., 0.}));
+}
+
+}  // namespace
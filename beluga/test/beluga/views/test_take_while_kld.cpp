@@ -147,6 +147,65 @@ INSTANTIATE_TEST_SUITE_P(
         std::make_tuple(kPercentile99th, 7, 843),
         std::make_tuple(kPercentile99th, 100, 6733)));
 
+TEST(KldCondition, TableFallbackMatchesDirectEvaluation) {
+  // a table too small for the bucket count must fall back to on-the-fly evaluation
+  // and make exactly the same decisions as a fully covering table
+  const std::size_t min = 0;
+  const double epsilon = 0.01;
+  auto covering = GenerateDistinctHashes(100) |  //
+                  ranges::views::take_while(beluga::kld_condition(min, epsilon, kPercentile90th));
+  auto truncated = GenerateDistinctHashes(100) |  //
+                   ranges::views::take_while(beluga::kld_condition(min, epsilon, kPercentile90th, 2));
+  ASSERT_EQ(ranges::distance(covering), ranges::distance(truncated));
+}
+
+TEST(KldCondition, BucketStatistics) {
+  const std::size_t min = 0;
+  const double epsilon = 0.01;
+  auto statistics = beluga::KldBucketStatistics{};
+  auto output = GenerateDistinctHashes(7) |  //
+                ranges::views::take_while(beluga::kld_condition(
+                    min, epsilon, kPercentile90th, beluga::detail::kDefaultKldTableSize, nullptr, &statistics));
+  const auto count = static_cast<std::size_t>(ranges::distance(output));
+  ASSERT_EQ(statistics.samples, count + 1);  // the sample that failed the condition was also counted
+  ASSERT_EQ(statistics.buckets, 7);
+  EXPECT_DOUBLE_EQ(statistics.average_occupancy(), static_cast<double>(count + 1) / 7.);
+  EXPECT_LT(statistics.expected_hash_collisions(), 1e-15);
+  // The generated hashes open one bucket per sample until the cluster count is exhausted.
+  EXPECT_EQ(statistics.bucket_growth_samples[0], 1);  // 1 bucket
+  EXPECT_EQ(statistics.bucket_growth_samples[1], 2);  // 2 buckets
+  EXPECT_EQ(statistics.bucket_growth_samples[2], 4);  // 4 buckets
+  EXPECT_EQ(statistics.bucket_growth_samples[3], 0);  // 8 buckets, never reached
+}
+
+TEST(KldCondition, BucketStatisticsResetPerCondition) {
+  const std::size_t min = 0;
+  const double epsilon = 0.01;
+  auto statistics = beluga::KldBucketStatistics{};
+  ranges::distance(
+      GenerateDistinctHashes(100) |  //
+      ranges::views::take_while(beluga::kld_condition(
+          min, epsilon, kPercentile90th, beluga::detail::kDefaultKldTableSize, nullptr, &statistics)));
+  auto output = GenerateDistinctHashes(3) |  //
+                ranges::views::take_while(beluga::kld_condition(
+                    min, epsilon, kPercentile90th, beluga::detail::kDefaultKldTableSize, nullptr, &statistics));
+  const auto count = static_cast<std::size_t>(ranges::distance(output));
+  ASSERT_EQ(statistics.samples, count + 1);
+  ASSERT_EQ(statistics.buckets, 3);
+}
+
+TEST(TakeWhileKld, BucketStatistics) {
+  const std::size_t min = 0;
+  const std::size_t max = 1'000;
+  const double epsilon = 0.01;
+  auto statistics = beluga::KldBucketStatistics{};
+  auto output = GenerateDistinctHashes(4) |
+                beluga::views::take_while_kld(identity, min, max, epsilon, kPercentile90th, nullptr, &statistics) |
+                ranges::to<std::vector>;
+  ASSERT_EQ(statistics.buckets, 4);
+  ASSERT_GE(statistics.samples, output.size());
+}
+
 TEST(TakeWhileKld, TakeZero) {
   const std::size_t min = 2;
   const std::size_t max = 3;
@@ -234,4 +293,22 @@ TEST(TakeWhileKld, HashStoredInParticle) {
   ASSERT_EQ(ranges::distance(output), 3);
 }
 
+TEST(TakeWhileKld, PrecomputedClusterColumn) {
+  auto input = std::array{
+      std::make_tuple(1, beluga::Weight(1.0), beluga::Cluster(42)),
+      std::make_tuple(2, beluga::Weight(1.0), beluga::Cluster(43)),
+      std::make_tuple(3, beluga::Weight(1.0), beluga::Cluster(44))};
+  const std::size_t min = 2;
+  const std::size_t max = 5;
+  const double epsilon = 0.1;
+  int hasher_calls = 0;
+  const auto hasher = [&hasher_calls](int) {
+    ++hasher_calls;
+    return std::size_t{0};
+  };
+  auto output = input | beluga::views::take_while_kld(hasher, min, max, epsilon);
+  ASSERT_EQ(ranges::distance(output), 3);
+  ASSERT_EQ(hasher_calls, 0);  // The precomputed cluster column takes precedence over the hasher.
+}
+
 }  // namespace
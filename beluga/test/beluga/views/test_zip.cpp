@@ -0,0 +1,86 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <list>
+#include <tuple>
+#include <vector>
+
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/concepts.hpp>
+#include <range/v3/range/primitives.hpp>
+
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/zip.hpp"
+
+namespace {
+
+TEST(ZipView, ConceptChecksFromVectors) {
+  auto first = std::vector<int>{1, 2, 3};
+  auto second = std::vector<double>{1., 2., 3.};
+  auto zipped = beluga::views::zip(first, second);
+
+  static_assert(ranges::sized_range<decltype(zipped)>);
+  static_assert(ranges::random_access_range<decltype(zipped)>);
+  static_assert(ranges::sized_sentinel_for<ranges::iterator_t<decltype(zipped)>, ranges::iterator_t<decltype(zipped)>>);
+}
+
+TEST(ZipView, ConceptChecksFromList) {
+  auto first = std::list<int>{1, 2, 3};
+  auto second = std::vector<double>{1., 2., 3.};
+  auto zipped = beluga::views::zip(first, second);
+
+  static_assert(ranges::sized_range<decltype(zipped)>);
+  static_assert(!ranges::random_access_range<decltype(zipped)>);
+  static_assert(ranges::bidirectional_range<decltype(zipped)>);
+}
+
+TEST(ZipView, ConceptChecksFromTupleVector) {
+  auto container = beluga::TupleVector<std::tuple<int, beluga::Weight>>{};
+  auto view = ranges::views::all(container);
+
+  static_assert(ranges::sized_range<decltype(view)>);
+  static_assert(ranges::random_access_range<decltype(view)>);
+  static_assert(ranges::sized_sentinel_for<ranges::iterator_t<decltype(view)>, ranges::iterator_t<decltype(view)>>);
+}
+
+TEST(ZipView, IteratorDifferenceArithmetic) {
+  auto container = beluga::TupleVector<std::tuple<int, beluga::Weight>>{};
+  for (int i = 0; i < 10; ++i) {
+    container.push_back({i, 1.0});
+  }
+
+  auto first = ranges::begin(container);
+  auto last = ranges::end(container);
+  ASSERT_EQ(last - first, 10);
+  ASSERT_EQ(first + 10, last);
+
+  auto middle = first + 5;
+  ASSERT_EQ(std::get<0>(*middle), 5);
+  ASSERT_EQ(middle - first, 5);
+  ASSERT_EQ(last - middle, 5);
+  ASSERT_EQ(std::get<0>(first[7]), 7);
+}
+
+TEST(ZipView, DereferencesIntoTuples) {
+  auto first = std::vector<int>{1, 2, 3};
+  auto second = std::vector<double>{1., 2., 3.};
+  auto zipped = beluga::views::zip(first, second);
+  static_assert(std::is_same_v<ranges::range_value_t<decltype(zipped)>, std::tuple<int, double>>);
+  ASSERT_EQ(std::get<0>(*ranges::begin(zipped)), 1);
+}
+
+}  // namespace
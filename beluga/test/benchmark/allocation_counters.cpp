@@ -0,0 +1,110 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "allocation_counters.hpp"
+
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+namespace beluga::benchmarking {
+
+namespace {
+
+thread_local std::uint64_t allocation_count = 0;
+thread_local std::uint64_t allocation_bytes = 0;
+
+}  // namespace
+
+AllocationStats allocation_stats_snapshot() {
+  return AllocationStats{allocation_count, allocation_bytes};
+}
+
+namespace detail {
+
+void* counted_allocate(std::size_t size) {
+  ++allocation_count;
+  allocation_bytes += size;
+  if (void* pointer = std::malloc(size)) {  // NOLINT(cppcoreguidelines-no-malloc)
+    return pointer;
+  }
+  throw std::bad_alloc{};
+}
+
+void* counted_allocate(std::size_t size, std::align_val_t alignment) {
+  ++allocation_count;
+  allocation_bytes += size;
+  // aligned_alloc requires the size to be a multiple of the alignment.
+  const auto align = static_cast<std::size_t>(alignment);
+  const std::size_t padded_size = (size + align - 1) / align * align;
+  if (void* pointer = std::aligned_alloc(align, padded_size)) {
+    return pointer;
+  }
+  throw std::bad_alloc{};
+}
+
+}  // namespace detail
+
+}  // namespace beluga::benchmarking
+
+// Replacement allocation functions; definitions must live in exactly one
+// translation unit of the benchmark executable.
+
+void* operator new(std::size_t size) {
+  return beluga::benchmarking::detail::counted_allocate(size);
+}
+
+void* operator new[](std::size_t size) {
+  return beluga::benchmarking::detail::counted_allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+  return beluga::benchmarking::detail::counted_allocate(size, alignment);
+}
+
+void* operator new[](std::size_t size, std::align_val_t alignment) {
+  return beluga::benchmarking::detail::counted_allocate(size, alignment);
+}
+
+void operator delete(void* pointer) noexcept {
+  std::free(pointer);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+void operator delete[](void* pointer) noexcept {
+  std::free(pointer);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+  std::free(pointer);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+void operator delete[](void* pointer, std::size_t) noexcept {
+  std::free(pointer);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+void operator delete(void* pointer, std::align_val_t) noexcept {
+  std::free(pointer);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+void operator delete[](void* pointer, std::align_val_t) noexcept {
+  std::free(pointer);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+void operator delete(void* pointer, std::size_t, std::align_val_t) noexcept {
+  std::free(pointer);  // NOLINT(cppcoreguidelines-no-malloc)
+}
+
+void operator delete[](void* pointer, std::size_t, std::align_val_t) noexcept {
+  std::free(pointer);  // NOLINT(cppcoreguidelines-no-malloc)
+}
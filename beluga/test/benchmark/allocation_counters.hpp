@@ -0,0 +1,81 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_TEST_BENCHMARK_ALLOCATION_COUNTERS_HPP
+#define BELUGA_TEST_BENCHMARK_ALLOCATION_COUNTERS_HPP
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+
+/**
+ * \file
+ * \brief Allocation instrumentation for benchmarks, on top of global `operator new` interposition.
+ */
+
+namespace beluga::benchmarking {
+
+/// Snapshot of the calling thread's cumulative heap allocation activity.
+/**
+ * Backed by the replacement `operator new` / `operator delete` definitions in
+ * allocation_counters.cpp, which bump thread-local counters on every
+ * allocation. Only allocations made by the calling thread are visible, which
+ * is what benchmarks want: worker threads spawned by parallel execution
+ * policies don't pollute the measurement of the driving loop.
+ */
+struct AllocationStats {
+  /// Number of allocations performed so far.
+  std::uint64_t count = 0;
+  /// Total bytes requested so far.
+  std::uint64_t bytes = 0;
+};
+
+/// Reads the calling thread's allocation counters.
+[[nodiscard]] AllocationStats allocation_stats_snapshot();
+
+/// Scoped allocation tracker reported as benchmark counters.
+/**
+ * Brackets a benchmark loop with `start()` / `stop()` and publishes the
+ * allocations and bytes per iteration via `report()`, so zero steady-state
+ * allocation claims are checked by CI numbers instead of code review memory.
+ */
+class AllocationCounters {
+ public:
+  /// Latches the current allocation counters; call right before the benchmark loop.
+  void start() { start_ = allocation_stats_snapshot(); }
+
+  /// Computes the allocation activity since `start()`; call right after the loop.
+  void stop() {
+    const auto end = allocation_stats_snapshot();
+    count_ = end.count - start_.count;
+    bytes_ = end.bytes - start_.bytes;
+  }
+
+  /// Publishes the latched values as per-iteration benchmark counters.
+  void report(benchmark::State& state) const {
+    state.counters["allocations"] =
+        benchmark::Counter(static_cast<double>(count_), benchmark::Counter::kAvgIterations);
+    state.counters["alloc_bytes"] =
+        benchmark::Counter(static_cast<double>(bytes_), benchmark::Counter::kAvgIterations);
+  }
+
+ private:
+  AllocationStats start_;
+  std::uint64_t count_ = 0;
+  std::uint64_t bytes_ = 0;
+};
+
+}  // namespace beluga::benchmarking
+
+#endif  // BELUGA_TEST_BENCHMARK_ALLOCATION_COUNTERS_HPP
@@ -0,0 +1,130 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <thread>
+#include <tuple>
+
+#include <Eigen/Core>
+
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/actions/normalize.hpp"
+#include "beluga/actions/propagate.hpp"
+#include "beluga/actions/reweight.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+
+namespace {
+
+using Particles = beluga::TupleVector<std::tuple<Sophus::SE2d, beluga::Weight>>;
+
+/// Particle set spread along a line, all with unit weight.
+auto make_particles(std::size_t count) {
+  auto particles = Particles{};
+  particles.resize(count);
+  auto states = particles.template span<0>();
+  for (std::size_t index = 0; index < count; ++index) {
+    states[static_cast<std::ptrdiff_t>(index)] =
+        Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{0.01 * static_cast<double>(index), 0.0}};
+  }
+  return particles;
+}
+
+/// Small rigid motion; the orbit it induces keeps states bounded across iterations.
+const auto kMotionDelta = Sophus::SE2d{Sophus::SO2d{0.01}, Eigen::Vector2d{0.01, 0.0}};
+
+/// Weighting function with per-particle transcendental cost, returning a
+/// constant weight so repeated application cannot drift into denormals.
+double dummy_weighting(const Sophus::SE2d& state) {
+  const double x = state.translation().x();
+  double value = std::exp(-x * x);
+  benchmark::DoNotOptimize(value);
+  return 1.0;
+}
+
+/// Attach the per-core throughput counters used to read scaling efficiency:
+/// dividing the parallel `items_per_core` rate by the sequential one gives
+/// the efficiency of that policy at that size on this machine.
+void set_scaling_counters(benchmark::State& state, std::size_t count) {
+  const auto cores = static_cast<double>(std::thread::hardware_concurrency());
+  const auto total = static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count);
+  state.SetItemsProcessed(total);
+  state.counters["cores"] = cores;
+  state.counters["items_per_core"] = benchmark::Counter(static_cast<double>(total) / cores, benchmark::Counter::kIsRate);
+}
+
+template <class ExecutionPolicy>
+void BM_Actions_Propagate(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  auto particles = make_particles(count);
+  for (auto _ : state) {
+    particles |= beluga::actions::propagate(ExecutionPolicy{}, [](const Sophus::SE2d& s) { return s * kMotionDelta; });
+  }
+  set_scaling_counters(state, count);
+}
+
+template <class ExecutionPolicy>
+void BM_Actions_Reweight(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  auto particles = make_particles(count);
+  for (auto _ : state) {
+    particles |= beluga::actions::reweight(ExecutionPolicy{}, dummy_weighting);
+  }
+  set_scaling_counters(state, count);
+}
+
+template <class ExecutionPolicy>
+void BM_Actions_Normalize(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  auto particles = make_particles(count);
+  for (auto _ : state) {
+    particles |= beluga::actions::normalize(ExecutionPolicy{});
+  }
+  set_scaling_counters(state, count);
+}
+
+template <class ExecutionPolicy>
+void BM_Actions_Composed(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  auto particles = make_particles(count);
+  for (auto _ : state) {
+    particles |= beluga::actions::propagate(ExecutionPolicy{}, [](const Sophus::SE2d& s) { return s * kMotionDelta; }) |
+                 beluga::actions::reweight(ExecutionPolicy{}, dummy_weighting) |
+                 beluga::actions::normalize(ExecutionPolicy{});
+  }
+  set_scaling_counters(state, count);
+}
+
+// 1k to 1M particles under every policy, so the point where parallel execution
+// stops paying on the host hardware can be read off directly.
+#define BELUGA_ACTION_BENCHMARK(name)                                                                 \
+  BENCHMARK_TEMPLATE(name, std::execution::sequenced_policy)->RangeMultiplier(10)->Range(1'000, 1'000'000); \
+  BENCHMARK_TEMPLATE(name, std::execution::parallel_policy)->RangeMultiplier(10)->Range(1'000, 1'000'000);  \
+  BENCHMARK_TEMPLATE(name, std::execution::parallel_unsequenced_policy)->RangeMultiplier(10)->Range(1'000, 1'000'000)
+
+BELUGA_ACTION_BENCHMARK(BM_Actions_Propagate);
+BELUGA_ACTION_BENCHMARK(BM_Actions_Reweight);
+BELUGA_ACTION_BENCHMARK(BM_Actions_Normalize);
+BELUGA_ACTION_BENCHMARK(BM_Actions_Composed);
+
+#undef BELUGA_ACTION_BENCHMARK
+
+}  // namespace
@@ -0,0 +1,111 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <execution>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <sophus/se2.hpp>
+
+#include <beluga/algorithm/amcl_core.hpp>
+#include <beluga/algorithm/spatial_hash.hpp>
+#include <beluga/motion/differential_drive_model.hpp>
+#include <beluga/sensor/likelihood_field_model.hpp>
+#include <beluga/test/static_occupancy_grid.hpp>
+
+namespace {
+
+constexpr std::size_t kMapSize = 64;
+constexpr double kMapResolution = 0.1;
+constexpr std::size_t kNumBeams = 100;
+
+/// Synthetic room: occupied border cells, free interior.
+auto make_synthetic_grid() {
+  auto array = std::array<bool, kMapSize * kMapSize>{};
+  for (std::size_t index = 0; index < kMapSize; ++index) {
+    array[index] = true;                                  // bottom wall
+    array[(kMapSize - 1) * kMapSize + index] = true;      // top wall
+    array[index * kMapSize] = true;                       // left wall
+    array[index * kMapSize + kMapSize - 1] = true;        // right wall
+  }
+  return beluga::testing::StaticOccupancyGrid<kMapSize, kMapSize>{array, kMapResolution};
+}
+
+/// Synthetic scan: beams hitting a circle around the sensor.
+auto make_synthetic_measurement() {
+  constexpr double kRange = 1.5;
+  auto measurement = std::vector<std::pair<double, double>>{};
+  measurement.reserve(kNumBeams);
+  for (std::size_t beam = 0; beam < kNumBeams; ++beam) {
+    const double angle = 2.0 * Sophus::Constants<double>::pi() * static_cast<double>(beam) /
+                         static_cast<double>(kNumBeams);
+    measurement.emplace_back(kRange * std::cos(angle), kRange * std::sin(angle));
+  }
+  return measurement;
+}
+
+/// End-to-end update cycle: propagation, reweighting, resampling and estimation
+/// in one pipeline, so stage-local wins that pessimize the whole (e.g. by
+/// evicting the next stage's working set) still show up.
+template <class ExecutionPolicy>
+void BM_Amcl_Update(benchmark::State& state) {
+  const auto num_particles = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+
+  auto params = beluga::AmclParams{};
+  params.min_particles = num_particles;
+  params.max_particles = num_particles;
+
+  auto amcl = beluga::Amcl{
+      beluga::DifferentialDriveModel{beluga::DifferentialDriveModelParam{}},
+      beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, make_synthetic_grid()},
+      []() { return Sophus::SE2d{}; },
+      beluga::spatial_hash<Sophus::SE2d>{0.1, 0.1, 0.1},
+      params,
+      ExecutionPolicy{},
+  };
+
+  const auto center = kMapResolution * static_cast<double>(kMapSize) / 2.0;
+  amcl.initialize(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{center, center}}, Eigen::Vector3d::Ones().asDiagonal());
+
+  const auto measurement = make_synthetic_measurement();
+  // Alternate between two odometry poses farther apart than the update
+  // distance threshold, so no cycle is skipped as stationary.
+  const auto controls =
+      std::array{Sophus::SE2d{}, Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{2.0 * params.update_min_d, 0.0}}};
+
+  std::size_t cycle = 0;
+  for (auto _ : state) {
+    auto estimate = amcl.update(controls[cycle++ % controls.size()], measurement);
+    benchmark::DoNotOptimize(estimate);
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_Amcl_Update, std::execution::sequenced_policy)
+    ->RangeMultiplier(4)
+    ->Range(500, 32'000)
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_Amcl_Update, std::execution::parallel_policy)
+    ->RangeMultiplier(4)
+    ->Range(500, 32'000)
+    ->Complexity();
+
+}  // namespace
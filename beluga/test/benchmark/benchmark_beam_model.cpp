@@ -0,0 +1,163 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <sophus/common.hpp>
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/sensor/beam_model.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+namespace {
+
+constexpr double kResolution = 0.05;
+constexpr std::size_t kNumParticles = 16;
+
+/// Synthetic room: occupied border cells, free interior.
+template <std::size_t MapSize>
+auto make_walled_grid() {
+  auto array = std::array<bool, MapSize * MapSize>{};
+  for (std::size_t index = 0; index < MapSize; ++index) {
+    array[index] = true;
+    array[(MapSize - 1) * MapSize + index] = true;
+    array[index * MapSize] = true;
+    array[index * MapSize + MapSize - 1] = true;
+  }
+  return beluga::testing::StaticOccupancyGrid<MapSize, MapSize>{array, kResolution};
+}
+
+/// Synthetic scan: beams hitting a circle around the sensor.
+auto make_measurement(std::size_t num_beams, double hit_range) {
+  auto measurement = std::vector<std::pair<double, double>>{};
+  measurement.reserve(num_beams);
+  for (std::size_t beam = 0; beam < num_beams; ++beam) {
+    const double angle =
+        2.0 * Sophus::Constants<double>::pi() * static_cast<double>(beam) / static_cast<double>(num_beams);
+    measurement.emplace_back(hit_range * std::cos(angle), hit_range * std::sin(angle));
+  }
+  return measurement;
+}
+
+/// Particle states jittered around the room center.
+auto make_particles(double center) {
+  auto particles = std::vector<Sophus::SE2d>{};
+  particles.reserve(kNumParticles);
+  for (std::size_t index = 0; index < kNumParticles; ++index) {
+    const double offset = 0.02 * static_cast<double>(index);
+    particles.emplace_back(
+        Sophus::SO2d{0.01 * static_cast<double>(index)}, Eigen::Vector2d{center + offset, center - offset});
+  }
+  return particles;
+}
+
+/// Per-particle weighting cost of the beam model; items processed are particles,
+/// so the reported rate is directly comparable across beam counts and map sizes.
+template <std::size_t MapSize>
+void BM_BeamSensorModel(benchmark::State& state) {
+  const auto num_beams = static_cast<std::size_t>(state.range(0));
+  const auto max_range = static_cast<double>(state.range(1));
+
+  auto params = beluga::BeamModelParam{};
+  params.beam_max_range = max_range;
+  const auto model = beluga::BeamSensorModel{params, make_walled_grid<MapSize>()};
+
+  const double center = kResolution * static_cast<double>(MapSize) / 2.0;
+  const double hit_range = 0.8 * std::min(max_range, center);
+  const auto particles = make_particles(center);
+  const auto weighting = model(make_measurement(num_beams, hit_range));
+
+  for (auto _ : state) {
+    for (const auto& particle : particles) {
+      benchmark::DoNotOptimize(weighting(particle));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kNumParticles));
+}
+
+/// Same sweep with the precomputed ray-cast lookup table enabled, so the table
+/// has the per-beam traversal baseline right next to it.
+template <std::size_t MapSize>
+void BM_BeamSensorModel_RaycastLookup(benchmark::State& state) {
+  const auto num_beams = static_cast<std::size_t>(state.range(0));
+  const auto max_range = static_cast<double>(state.range(1));
+
+  auto params = beluga::BeamModelParam{};
+  params.beam_max_range = max_range;
+  auto model = beluga::BeamSensorModel{params, make_walled_grid<MapSize>()};
+  model.prepare_raycast_lookup(1024);
+
+  const double center = kResolution * static_cast<double>(MapSize) / 2.0;
+  const double hit_range = 0.8 * std::min(max_range, center);
+  const auto particles = make_particles(center);
+  const auto weighting = model(make_measurement(num_beams, hit_range));
+
+  for (auto _ : state) {
+    for (const auto& particle : particles) {
+      benchmark::DoNotOptimize(weighting(particle));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kNumParticles));
+}
+
+// Sweep beam count (first argument) and max beam range in meters (second
+// argument) for increasing map sizes.
+BENCHMARK_TEMPLATE(BM_BeamSensorModel, 256)
+    ->ArgNames({"beams", "range"})
+    ->Args({30, 10})
+    ->Args({180, 10})
+    ->Args({720, 10})
+    ->Args({30, 60})
+    ->Args({180, 60})
+    ->Args({720, 60});
+
+BENCHMARK_TEMPLATE(BM_BeamSensorModel, 512)
+    ->ArgNames({"beams", "range"})
+    ->Args({30, 10})
+    ->Args({180, 10})
+    ->Args({720, 10})
+    ->Args({30, 60})
+    ->Args({180, 60})
+    ->Args({720, 60});
+
+BENCHMARK_TEMPLATE(BM_BeamSensorModel, 1024)
+    ->ArgNames({"beams", "range"})
+    ->Args({30, 10})
+    ->Args({180, 10})
+    ->Args({720, 10})
+    ->Args({30, 60})
+    ->Args({180, 60})
+    ->Args({720, 60});
+
+BENCHMARK_TEMPLATE(BM_BeamSensorModel_RaycastLookup, 512)
+    ->ArgNames({"beams", "range"})
+    ->Args({30, 10})
+    ->Args({180, 10})
+    ->Args({720, 10})
+    ->Args({30, 60})
+    ->Args({180, 60})
+    ->Args({720, 60});
+
+}  // namespace
@@ -0,0 +1,168 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <execution>
+#include <vector>
+
+#include "beluga/algorithm/distance_map.hpp"
+#include "beluga/sensor/data/obstacle_bitmap.hpp"
+#include "beluga/sensor/likelihood_field_model.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+#include "allocation_counters.hpp"
+
+namespace {
+
+constexpr double kResolution = 0.05;
+
+/// Obstacle map with the given percentage of cells occupied, deterministically scattered.
+auto make_obstacle_map(std::size_t size, std::int64_t density_percent) {
+  auto map = std::vector<bool>(size, false);
+  std::uint64_t lcg = 12345;
+  for (std::size_t index = 0; index < size; ++index) {
+    lcg = lcg * 6364136223846793005ULL + 1442695040888963407ULL;
+    map[index] = static_cast<std::int64_t>((lcg >> 33U) % 100) < density_percent;
+  }
+  return map;
+}
+
+/// Construction cost of the wavefront-expansion distance map, the pre-EDT
+/// likelihood field build path; its priority queue is the expected hotspot.
+void BM_NearestObstacleDistanceMap(benchmark::State& state) {
+  const auto side = static_cast<std::size_t>(state.range(0));
+  const auto size = side * side;
+  state.SetComplexityN(state.range(0) * state.range(0));
+  const auto obstacle_map = make_obstacle_map(size, state.range(1));
+
+  const auto distance_function = [side](std::size_t first, std::size_t second) {
+    const auto x0 = static_cast<double>(first % side);
+    const auto y0 = static_cast<double>(first / side);
+    const auto x1 = static_cast<double>(second % side);
+    const auto y1 = static_cast<double>(second / side);
+    return std::sqrt((x1 - x0) * (x1 - x0) + (y1 - y0) * (y1 - y0)) * kResolution;
+  };
+  const auto neighbors_function = [side, size](std::size_t index) {
+    auto neighbors = std::vector<std::size_t>{};
+    if (index >= side) {
+      neighbors.push_back(index - side);
+    }
+    if (index + side < size) {
+      neighbors.push_back(index + side);
+    }
+    if (index % side != 0U) {
+      neighbors.push_back(index - 1);
+    }
+    if ((index + 1) % side != 0U) {
+      neighbors.push_back(index + 1);
+    }
+    return neighbors;
+  };
+
+  auto allocations = beluga::benchmarking::AllocationCounters{};
+  allocations.start();
+  for (auto _ : state) {
+    auto distance_map = beluga::nearest_obstacle_distance_map(obstacle_map, distance_function, neighbors_function);
+    benchmark::DoNotOptimize(distance_map.data());
+  }
+  allocations.stop();
+  allocations.report(state);
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(size));
+}
+
+BENCHMARK(BM_NearestObstacleDistanceMap)
+    ->ArgNames({"side", "density"})
+    ->Args({1024, 5})
+    ->Args({1024, 20})
+    ->Args({1024, 50})
+    ->Args({2048, 5})
+    ->Args({2048, 20})
+    ->Args({4096, 5})
+    ->Complexity();
+
+/// Construction cost of the exact two-pass Euclidean distance transform that
+/// replaced the wavefront expansion in the likelihood field build.
+template <class ExecutionPolicy>
+void BM_EuclideanDistanceTransform(benchmark::State& state) {
+  const auto side = static_cast<std::size_t>(state.range(0));
+  const auto size = side * side;
+  state.SetComplexityN(state.range(0) * state.range(0));
+  const auto bitmap = beluga::ObstacleBitmap2{make_obstacle_map(size, state.range(1)), side};
+
+  auto allocations = beluga::benchmarking::AllocationCounters{};
+  allocations.start();
+  for (auto _ : state) {
+    auto distance_map = beluga::euclidean_distance_transform(ExecutionPolicy{}, bitmap, kResolution);
+    benchmark::DoNotOptimize(distance_map.data());
+  }
+  allocations.stop();
+  allocations.report(state);
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(size));
+}
+
+BENCHMARK_TEMPLATE(BM_EuclideanDistanceTransform, std::execution::sequenced_policy)
+    ->ArgNames({"side", "density"})
+    ->Args({1024, 20})
+    ->Args({2048, 20})
+    ->Args({4096, 20})
+    ->Complexity();
+BENCHMARK_TEMPLATE(BM_EuclideanDistanceTransform, std::execution::parallel_policy)
+    ->ArgNames({"side", "density"})
+    ->Args({1024, 5})
+    ->Args({1024, 20})
+    ->Args({1024, 50})
+    ->Args({2048, 20})
+    ->Args({4096, 20})
+    ->Args({8192, 20})
+    ->Complexity();
+
+/// End-to-end likelihood field model construction: distance transform, field
+/// mapping and the padded lookup copy, i.e. the startup and map-switch cost.
+template <std::size_t MapSize>
+void BM_LikelihoodFieldConstruction(benchmark::State& state) {
+  const auto obstacle_map = make_obstacle_map(MapSize * MapSize, state.range(0));
+  auto array = std::array<bool, MapSize * MapSize>{};
+  for (std::size_t index = 0; index < obstacle_map.size(); ++index) {
+    array[index] = obstacle_map[index];
+  }
+  const auto grid = beluga::testing::StaticOccupancyGrid<MapSize, MapSize>{array, kResolution};
+
+  auto params = beluga::LikelihoodFieldModelParam{};
+  params.max_obstacle_distance = 2.0;
+  params.max_laser_distance = 100.0;
+  params.z_hit = 0.5;
+  params.z_random = 0.5;
+  params.sigma_hit = 0.2;
+
+  auto allocations = beluga::benchmarking::AllocationCounters{};
+  allocations.start();
+  for (auto _ : state) {
+    auto model = beluga::LikelihoodFieldModel{params, grid};
+    benchmark::DoNotOptimize(model);
+  }
+  allocations.stop();
+  allocations.report(state);
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(MapSize * MapSize));
+}
+
+BENCHMARK_TEMPLATE(BM_LikelihoodFieldConstruction, 256)->ArgNames({"density"})->Arg(20);
+BENCHMARK_TEMPLATE(BM_LikelihoodFieldConstruction, 512)->ArgNames({"density"})->Arg(20);
+BENCHMARK_TEMPLATE(BM_LikelihoodFieldConstruction, 1024)->ArgNames({"density"})->Arg(5)->Arg(20)->Arg(50);
+
+}  // namespace
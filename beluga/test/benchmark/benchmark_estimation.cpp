@@ -0,0 +1,123 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/algorithm/estimation.hpp"
+#include "beluga/random/multivariate_normal_distribution.hpp"
+#include "beluga/random/multivariate_uniform_distribution.hpp"
+#include "beluga/test/static_occupancy_grid.hpp"
+
+namespace {
+
+/// Pose set spread over position and heading, with non-uniform weights.
+auto make_weighted_poses(std::size_t count) {
+  auto poses = std::vector<Sophus::SE2d>{};
+  auto weights = std::vector<double>{};
+  poses.reserve(count);
+  weights.reserve(count);
+  for (std::size_t index = 0; index < count; ++index) {
+    const auto value = static_cast<double>(index);
+    poses.emplace_back(Sophus::SO2d{0.001 * value}, Eigen::Vector2d{0.01 * value, -0.01 * value});
+    weights.push_back(1.0 + 0.5 * static_cast<double>(index % 7));
+  }
+  return std::make_pair(std::move(poses), std::move(weights));
+}
+
+/// Weighted mean and covariance over the full pose set, the per-update
+/// estimation cost.
+void BM_Estimate(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+  const auto [poses, weights] = make_weighted_poses(count);
+  for (auto _ : state) {
+    auto estimate = beluga::estimate(poses, weights);
+    benchmark::DoNotOptimize(estimate);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+}
+
+BENCHMARK(BM_Estimate)->RangeMultiplier(10)->Range(1'000, 1'000'000)->Complexity();
+
+/// Pose sampling throughput from a normal distribution, the per-particle
+/// cost of pose initialization and recovery injection.
+void BM_MultivariateNormalSample(benchmark::State& state) {
+  const auto mean = Sophus::SE2d{Sophus::SO2d{0.5}, Eigen::Vector2d{1.0, 2.0}};
+  const Eigen::Matrix3d covariance = Eigen::Vector3d{0.25, 0.25, 0.04}.asDiagonal();
+  auto distribution = beluga::MultivariateNormalDistribution{mean, covariance};
+  auto engine = std::mt19937{42};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(distribution(engine));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+BENCHMARK(BM_MultivariateNormalSample);
+
+constexpr double kResolution = 0.05;
+
+/// Synthetic map with free cells everywhere except a wall every eighth row.
+template <std::size_t MapSize>
+auto make_striped_grid() {
+  auto array = std::array<bool, MapSize * MapSize>{};
+  for (std::size_t y = 0; y < MapSize; y += 8) {
+    for (std::size_t x = 0; x < MapSize; ++x) {
+      array[y * MapSize + x] = true;
+    }
+  }
+  return beluga::testing::StaticOccupancyGrid<MapSize, MapSize>{array, kResolution};
+}
+
+/// Construction cost of the uniform-over-free-space distribution, dominated
+/// by the free cell scan; this is a startup (and map switch) cost.
+template <std::size_t MapSize>
+void BM_MultivariateUniformConstruction(benchmark::State& state) {
+  const auto grid = make_striped_grid<MapSize>();
+  for (auto _ : state) {
+    auto distribution = beluga::MultivariateUniformDistribution{grid};
+    benchmark::DoNotOptimize(distribution);
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_MultivariateUniformConstruction, 256);
+BENCHMARK_TEMPLATE(BM_MultivariateUniformConstruction, 512);
+BENCHMARK_TEMPLATE(BM_MultivariateUniformConstruction, 1024);
+
+/// Pose sampling throughput from the uniform-over-free-space distribution.
+template <std::size_t MapSize>
+void BM_MultivariateUniformSample(benchmark::State& state) {
+  const auto grid = make_striped_grid<MapSize>();
+  auto distribution = beluga::MultivariateUniformDistribution{grid};
+  auto engine = std::mt19937{42};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(distribution(engine));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()));
+}
+
+BENCHMARK_TEMPLATE(BM_MultivariateUniformSample, 256);
+BENCHMARK_TEMPLATE(BM_MultivariateUniformSample, 1024);
+
+}  // namespace
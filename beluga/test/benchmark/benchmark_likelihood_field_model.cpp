@@ -23,6 +23,8 @@
 #include <sophus/se2.hpp>
 #include <sophus/so2.hpp>
 
+#include "perf_event_counters.hpp"
+
 namespace {
 
 constexpr std::size_t kNumParticles = 2'000;
@@ -34,6 +36,8 @@ void BM_PointTransform_Baseline(benchmark::State& state) {
   const auto particles = std::vector<Sophus::SE2d>{kNumParticles};
   const auto points = std::vector<std::pair<double, double>>(size);
   const auto origin = Sophus::SE2d{};
+  auto counters = beluga::benchmarking::PerfEventCounters{};
+  counters.start();
   for (auto _ : state) {
     for (const auto& pose : particles) {
       const auto transform = origin * pose;
@@ -48,6 +52,8 @@ void BM_PointTransform_Baseline(benchmark::State& state) {
       }
     }
   }
+  counters.stop();
+  counters.report(state);
 }
 
 void BM_PointTransform_EigenSophus(benchmark::State& state) {
@@ -57,6 +63,8 @@ void BM_PointTransform_EigenSophus(benchmark::State& state) {
   const auto particles = std::vector<Sophus::SE2d>{kNumParticles};
   const auto points = std::vector<Eigen::Vector2d>(size);
   const auto origin = Sophus::SE2d{};
+  auto counters = beluga::benchmarking::PerfEventCounters{};
+  counters.start();
   for (auto _ : state) {
     for (const auto& pose : particles) {
       const auto transform = origin * pose;
@@ -68,6 +76,8 @@ void BM_PointTransform_EigenSophus(benchmark::State& state) {
       }
     }
   }
+  counters.stop();
+  counters.report(state);
 }
 
 BENCHMARK(BM_PointTransform_Baseline)->RangeMultiplier(2)->Range(128, 1024)->Complexity();
@@ -0,0 +1,194 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <Eigen/Core>
+
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/sensor/data/ndt_cell.hpp"
+#include "beluga/sensor/data/sparse_value_grid.hpp"
+#include "beluga/sensor/ndt_sensor_model.hpp"
+
+namespace {
+
+using sparse_grid_2d_t =
+    beluga::SparseValueGrid<std::unordered_map<Eigen::Vector2i, beluga::NDTCell2d, beluga::detail::CellHasher<2>>>;
+
+constexpr double kResolution = 0.5;
+
+/// NDT cell centered in its grid cell, with a small isotropic covariance.
+auto make_cell(const Eigen::Vector2i& index) {
+  const Eigen::Vector2d mean = (index.cast<double>() + Eigen::Vector2d{0.5, 0.5}) * kResolution;
+  const Eigen::Matrix2d covariance = 0.01 * Eigen::Matrix2d::Identity();
+  return beluga::NDTCell2d{mean, covariance};
+}
+
+/// Map entries filling a square region with the given number of cells.
+auto make_entries(std::size_t num_cells) {
+  const auto side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(num_cells))));
+  auto entries = std::vector<sparse_grid_2d_t::entry_type>{};
+  entries.reserve(num_cells);
+  for (int y = 0; y < side && entries.size() < num_cells; ++y) {
+    for (int x = 0; x < side && entries.size() < num_cells; ++x) {
+      const auto index = Eigen::Vector2i{x, y};
+      entries.emplace_back(index, make_cell(index));
+    }
+  }
+  return entries;
+}
+
+/// Lookup cost across map sizes (first argument) and hit ratios in percent
+/// (second argument); misses exercise the failed-probe path of the backend.
+void BM_SparseValueGrid_Lookup(benchmark::State& state) {
+  const auto num_cells = static_cast<std::size_t>(state.range(0));
+  const auto hit_percent = static_cast<std::size_t>(state.range(1));
+  const auto grid = sparse_grid_2d_t::from_entries(make_entries(num_cells), kResolution);
+  const auto side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(num_cells))));
+
+  // Deterministic query mix: misses are taken outside the populated region.
+  auto queries = std::vector<Eigen::Vector2i>{};
+  queries.reserve(1024);
+  std::uint64_t lcg = 1;
+  for (std::size_t index = 0; index < 1024; ++index) {
+    lcg = lcg * 6364136223846793005ULL + 1442695040888963407ULL;
+    const auto x = static_cast<int>((lcg >> 33U) % static_cast<std::uint64_t>(side));
+    lcg = lcg * 6364136223846793005ULL + 1442695040888963407ULL;
+    const auto y = static_cast<int>((lcg >> 33U) % static_cast<std::uint64_t>(side));
+    const bool hit = (index % 100) < hit_percent;
+    queries.emplace_back(hit ? x : x + side, y);
+  }
+
+  for (auto _ : state) {
+    for (const auto& query : queries) {
+      benchmark::DoNotOptimize(grid.data_at(query));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(queries.size()));
+}
+
+BENCHMARK(BM_SparseValueGrid_Lookup)
+    ->ArgNames({"cells", "hits"})
+    ->Args({1'000, 100})
+    ->Args({1'000, 50})
+    ->Args({1'000, 0})
+    ->Args({100'000, 100})
+    ->Args({100'000, 50})
+    ->Args({100'000, 0})
+    ->Args({1'000'000, 100})
+    ->Args({1'000'000, 50})
+    ->Args({1'000'000, 0});
+
+/// Bulk construction cost across map sizes.
+void BM_SparseValueGrid_Build(benchmark::State& state) {
+  const auto num_cells = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+  const auto entries = make_entries(num_cells);
+  for (auto _ : state) {
+    auto grid = sparse_grid_2d_t::from_entries(entries, kResolution);
+    benchmark::DoNotOptimize(grid.size());
+  }
+}
+
+BENCHMARK(BM_SparseValueGrid_Build)->RangeMultiplier(10)->Range(1'000, 1'000'000)->Complexity();
+
+/// Point-to-cell clustering cost across cloud sizes (first argument) and
+/// points per cell (second argument), i.e. the NDT map construction path.
+void BM_NdtToCells(benchmark::State& state) {
+  const auto num_points = static_cast<std::size_t>(state.range(0));
+  const auto points_per_cell = static_cast<std::size_t>(state.range(1));
+  state.SetComplexityN(state.range(0));
+
+  const auto num_cells = std::max<std::size_t>(num_points / points_per_cell, 1);
+  const auto side = static_cast<std::size_t>(std::ceil(std::sqrt(static_cast<double>(num_cells))));
+  auto points = std::vector<Eigen::Vector2d>{};
+  points.reserve(num_points);
+  for (std::size_t index = 0; index < num_points; ++index) {
+    const auto cell = index % num_cells;
+    const double jitter = 0.1 * kResolution * static_cast<double>(index % points_per_cell) /
+                          static_cast<double>(points_per_cell);
+    points.emplace_back(
+        (static_cast<double>(cell % side) + 0.5) * kResolution + jitter,
+        (static_cast<double>(cell / side) + 0.5) * kResolution + jitter);
+  }
+
+  for (auto _ : state) {
+    auto cells = beluga::detail::to_cells<2>(points, kResolution);
+    benchmark::DoNotOptimize(cells.data());
+  }
+}
+
+BENCHMARK(BM_NdtToCells)
+    ->ArgNames({"points", "per_cell"})
+    ->Args({1'000, 10})
+    ->Args({100'000, 10})
+    ->Args({1'000'000, 10})
+    ->Args({1'000'000, 100})
+    ->Complexity();
+
+/// Per-particle weighting cost of the NDT sensor model across map sizes
+/// (first argument) and measurement cell counts (second argument).
+void BM_NdtSensorModel_Weighting(benchmark::State& state) {
+  constexpr std::size_t kNumParticles = 16;
+  const auto num_cells = static_cast<std::size_t>(state.range(0));
+  const auto num_measurement_cells = static_cast<std::size_t>(state.range(1));
+
+  const auto model = beluga::NDTSensorModel{
+      beluga::NDTModelParam2d{}, sparse_grid_2d_t::from_entries(make_entries(num_cells), kResolution)};
+
+  // One point per measurement cell is enough to form the cell batch once
+  // clustering minimums are met; reuse map cell centers so lookups hit.
+  auto points = std::vector<Eigen::Vector2d>{};
+  const auto side = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(num_cells))));
+  for (std::size_t cell = 0; cell < num_measurement_cells; ++cell) {
+    const auto index = Eigen::Vector2i{static_cast<int>(cell) % side, static_cast<int>(cell) / side};
+    const Eigen::Vector2d center = (index.cast<double>() + Eigen::Vector2d{0.5, 0.5}) * kResolution;
+    for (std::size_t repeat = 0; repeat < 8; ++repeat) {
+      points.emplace_back(center + Eigen::Vector2d{0.01 * static_cast<double>(repeat), 0.0});
+    }
+  }
+  const auto weighting = model(std::move(points));
+
+  auto particles = std::vector<Sophus::SE2d>{};
+  particles.reserve(kNumParticles);
+  for (std::size_t index = 0; index < kNumParticles; ++index) {
+    particles.emplace_back(Sophus::SO2d{0.001 * static_cast<double>(index)}, Eigen::Vector2d::Zero());
+  }
+
+  for (auto _ : state) {
+    for (const auto& particle : particles) {
+      benchmark::DoNotOptimize(weighting(particle));
+    }
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations() * kNumParticles));
+}
+
+BENCHMARK(BM_NdtSensorModel_Weighting)
+    ->ArgNames({"cells", "scan_cells"})
+    ->Args({10'000, 50})
+    ->Args({10'000, 200})
+    ->Args({1'000'000, 50})
+    ->Args({1'000'000, 200});
+
+}  // namespace
@@ -15,7 +15,9 @@
 #include <benchmark/benchmark.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <initializer_list>
+#include <optional>
 #include <vector>
 
 #include <Eigen/Core>
@@ -29,6 +31,7 @@
 #include "beluga/sensor/data/occupancy_grid.hpp"
 #include "beluga/test/raycasting.hpp"
 #include "beluga/test/static_occupancy_grid.hpp"
+#include "beluga/testing/synthetic_world.hpp"
 
 namespace {
 
@@ -208,4 +211,92 @@ BENCHMARK_TEMPLATE(BM_RayCasting2d, StaticOccupancyGrid)
     ->Args({2, 1024})
     ->Complexity();
 
+constexpr int kFanBearingCount = 180;
+
+[[nodiscard]] std::vector<Sophus::SO2d> make_fan_bearings() {
+  auto bearings = std::vector<Sophus::SO2d>{};
+  bearings.reserve(kFanBearingCount);
+  for (int i = 0; i < kFanBearingCount; ++i) {
+    bearings.emplace_back(2. * Sophus::Constants<double>::pi() * i / kFanBearingCount);
+  }
+  return bearings;
+}
+
+template <template <std::size_t, std::size_t> class Grid>
+void BM_RayCasting2d_FanPerRay(benchmark::State& state) {
+  constexpr double kMaxRange = 100.0;
+  constexpr double kResolution = 0.05;
+
+  const auto n = static_cast<int>(state.range(0));
+  auto grid = Grid<1280, 1280>{{}, kResolution};
+  grid.data()[grid.index_at(n, n)] = true;
+  grid.data()[grid.index_at(0, n)] = true;
+  grid.data()[grid.index_at(n, 0)] = true;
+
+  const auto source_pose = Sophus::SE2d{0., Eigen::Vector2d{0., 0.}};
+  const auto bearings = make_fan_bearings();
+  const auto beam = beluga::Ray2d{grid, source_pose, kMaxRange};
+  auto results = std::vector<std::optional<double>>{};
+  for (auto _ : state) {
+    results.clear();
+    for (const auto& bearing : bearings) {
+      results.push_back(beam.cast(bearing));
+    }
+    benchmark::DoNotOptimize(results.data());
+  }
+  state.SetComplexityN(n);
+}
+
+template <template <std::size_t, std::size_t> class Grid>
+void BM_RayCasting2d_Fan(benchmark::State& state) {
+  constexpr double kMaxRange = 100.0;
+  constexpr double kResolution = 0.05;
+
+  const auto n = static_cast<int>(state.range(0));
+  auto grid = Grid<1280, 1280>{{}, kResolution};
+  grid.data()[grid.index_at(n, n)] = true;
+  grid.data()[grid.index_at(0, n)] = true;
+  grid.data()[grid.index_at(n, 0)] = true;
+
+  const auto source_pose = Sophus::SE2d{0., Eigen::Vector2d{0., 0.}};
+  const auto bearings = make_fan_bearings();
+  const auto beam = beluga::Ray2d{grid, source_pose, kMaxRange};
+  auto results = std::vector<std::optional<double>>{};
+  for (auto _ : state) {
+    beam.cast_fan(bearings, results);
+    benchmark::DoNotOptimize(results.data());
+  }
+  state.SetComplexityN(n);
+}
+
+BENCHMARK_TEMPLATE(BM_RayCasting2d_FanPerRay, StaticOccupancyGrid)
+    ->Arg(128)
+    ->Arg(256)
+    ->Arg(512)
+    ->Arg(1024)
+    ->Complexity();
+
+BENCHMARK_TEMPLATE(BM_RayCasting2d_Fan, StaticOccupancyGrid)
+    ->Arg(128)
+    ->Arg(256)
+    ->Arg(512)
+    ->Arg(1024)
+    ->Complexity();
+
+/// Full scan simulation on a generated building-scale map, whose footprint
+/// does not fit in cache like the synthetic grids above do.
+void BM_RayCasting2d_SyntheticWorld(benchmark::State& state) {
+  constexpr double kMaxRange = 30.0;
+  const auto beams = static_cast<std::size_t>(state.range(0));
+  const auto world = beluga::testing::generate_world();
+  // Room interior, away from the structural walls.
+  const auto source_pose = Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{5.0, 5.0}};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(beluga::testing::simulate_scan(world, source_pose, beams, kMaxRange));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(beams));
+}
+
+BENCHMARK(BM_RayCasting2d_SyntheticWorld)->Arg(360)->Arg(1'080)->Arg(3'600);
+
 }  // namespace
@@ -0,0 +1,139 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * \file
+ * \brief Compares a Google Benchmark JSON result file against a committed baseline.
+ *
+ * Usage: benchmark_regression_check BASELINE CURRENT [TOLERANCE]
+ *
+ * Exits nonzero if any benchmark present in both files regressed its CPU time
+ * by more than the tolerance (a fraction, 0.2 meaning 20% slower). A missing
+ * baseline file is reported and skipped, so platforms without a recorded
+ * baseline still run the benchmarks without gating on them. This is plain
+ * C++ so the gate runs on-robot, where the Python tooling is unavailable.
+ */
+
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+
+namespace {
+
+/// Extracts the quoted value following the given key, or an empty string.
+std::string extract_string(const std::string& line, const std::string& key) {
+  const auto key_pos = line.find("\"" + key + "\"");
+  if (key_pos == std::string::npos) {
+    return "";
+  }
+  const auto open = line.find('"', line.find(':', key_pos));
+  if (open == std::string::npos) {
+    return "";
+  }
+  const auto close = line.find('"', open + 1);
+  if (close == std::string::npos) {
+    return "";
+  }
+  return line.substr(open + 1, close - open - 1);
+}
+
+/// Extracts the numeric value following the given key, or a negative sentinel.
+double extract_number(const std::string& line, const std::string& key) {
+  const auto key_pos = line.find("\"" + key + "\"");
+  if (key_pos == std::string::npos) {
+    return -1.0;
+  }
+  const auto colon = line.find(':', key_pos);
+  if (colon == std::string::npos) {
+    return -1.0;
+  }
+  return std::strtod(line.c_str() + colon + 1, nullptr);
+}
+
+/// Parses benchmark names and CPU times out of a Google Benchmark JSON file.
+/**
+ * The format is stable and line-oriented ("name" precedes "cpu_time" within
+ * each entry of the "benchmarks" array), so a line scanner is enough and keeps
+ * this tool dependency-free for cross-compiled targets.
+ */
+std::map<std::string, double> parse_results(const std::string& path) {
+  auto results = std::map<std::string, double>{};
+  std::ifstream file{path};
+  std::string line;
+  std::string name;
+  while (std::getline(file, line)) {
+    if (const auto value = extract_string(line, "name"); !value.empty()) {
+      name = value;
+    }
+    if (const auto value = extract_number(line, "cpu_time"); value >= 0.0 && !name.empty()) {
+      results.emplace(name, value);
+      name.clear();
+    }
+  }
+  return results;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  if (argc < 3) {
+    std::cerr << "usage: " << argv[0] << " BASELINE CURRENT [TOLERANCE]" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const std::string baseline_path = argv[1];
+  const std::string current_path = argv[2];
+  const double tolerance = argc > 3 ? std::strtod(argv[3], nullptr) : 0.2;
+
+  if (!std::ifstream{baseline_path}.good()) {
+    std::cout << "No baseline at " << baseline_path << ", skipping regression check" << std::endl;
+    return EXIT_SUCCESS;
+  }
+
+  const auto baseline = parse_results(baseline_path);
+  const auto current = parse_results(current_path);
+  if (baseline.empty()) {
+    std::cerr << "No benchmark entries in baseline " << baseline_path << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (current.empty()) {
+    std::cerr << "No benchmark entries in " << current_path << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  int regressions = 0;
+  for (const auto& [name, baseline_time] : baseline) {
+    const auto it = current.find(name);
+    if (it == current.end()) {
+      std::cout << "MISSING " << name << " (present in baseline only)" << std::endl;
+      continue;
+    }
+    const double ratio = it->second / baseline_time;
+    if (ratio > 1.0 + tolerance) {
+      ++regressions;
+      std::cout << "REGRESSED " << name << ": " << baseline_time << " -> " << it->second << " (" << (ratio - 1.0) * 100.0
+                << "% slower)" << std::endl;
+    }
+  }
+
+  if (regressions > 0) {
+    std::cerr << regressions << " benchmark(s) regressed beyond the " << tolerance * 100.0 << "% tolerance"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "All " << baseline.size() << " baseline benchmarks within tolerance" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,240 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
+
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/range/access.hpp>
+#include <range/v3/range/primitives.hpp>
+#include <range/v3/view/subrange.hpp>
+#include <range/v3/view/take_exactly.hpp>
+
+#include "beluga/algorithm/index_resample.hpp"
+#include "beluga/algorithm/spatial_hash.hpp"
+#include "beluga/containers/tuple_vector.hpp"
+#include "beluga/primitives.hpp"
+#include "beluga/views/particles.hpp"
+#include "beluga/views/random_intersperse.hpp"
+#include "beluga/views/residual_sample.hpp"
+#include "beluga/views/sample.hpp"
+#include "beluga/views/systematic_sample.hpp"
+#include "beluga/views/take_while_kld.hpp"
+
+namespace {
+
+struct State {
+  double x = 0.;
+  double y = 0.;
+  double theta = 0.;
+};
+
+}  // namespace
+
+template <>
+struct beluga::spatial_hash<State> {
+  std::size_t operator()(const State& state) const {
+    const auto tuple = std::make_tuple(state.x, state.y);
+    return beluga::spatial_hash<std::decay_t<decltype(tuple)>>{std::array{1., 1.}}(tuple);
+  }
+};
+
+namespace {
+
+using Container = beluga::TupleVector<std::tuple<State, beluga::Weight>>;
+
+/// Weight skew scenarios; which resampling strategy wins depends on them.
+enum Skew : std::int64_t {
+  kUniform = 0,     ///< All particles carry the same weight.
+  kPeaked = 1,      ///< Weights decay exponentially; a small cluster dominates.
+  kDegenerate = 2,  ///< One particle holds virtually all the mass.
+};
+
+/// Particle set with spread-out states and the given weight skew.
+auto make_particles(std::size_t count, std::int64_t skew) {
+  auto container = Container{count};
+  double step = 0;
+  std::size_t index = 0;
+  for (auto&& [state, weight] : container) {
+    state.x = step;
+    if (index % 2 == 0) {
+      step += 0.05;
+    }
+    switch (skew) {
+      case kPeaked:
+        weight = std::exp(-10. * static_cast<double>(index) / static_cast<double>(count));
+        break;
+      case kDegenerate:
+        weight = index == 0 ? 1e6 : 1e-6;
+        break;
+      default:
+        weight = 1.;
+        break;
+    }
+    ++index;
+  }
+  return container;
+}
+
+/// Multinomial resampling through the discrete-distribution-backed sample view.
+void BM_Resample_Multinomial(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+  const auto container = make_particles(count, state.range(1));
+  auto new_container = Container{count};
+  for (auto _ : state) {
+    auto samples = container |              //
+                   beluga::views::sample |  //
+                   ranges::views::take_exactly(count);
+    benchmark::DoNotOptimize(ranges::copy(samples, ranges::begin(new_container)).out);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+/// Systematic (low-variance) resampling; a single uniform draw per resample.
+void BM_Resample_Systematic(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+  const auto container = make_particles(count, state.range(1));
+  auto new_container = Container{count};
+  for (auto _ : state) {
+    auto samples = container | beluga::views::systematic_sample(count);
+    benchmark::DoNotOptimize(ranges::copy(samples, ranges::begin(new_container)).out);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+/// Residual resampling; deterministic replicas plus a multinomial remainder.
+void BM_Resample_Residual(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+  const auto container = make_particles(count, state.range(1));
+  auto new_container = Container{count};
+  for (auto _ : state) {
+    auto samples = container | beluga::views::residual_sample(count);
+    benchmark::DoNotOptimize(ranges::copy(samples, ranges::begin(new_container)).out);
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+#define BELUGA_RESAMPLE_BENCHMARK(benchmark_name)              \
+  BENCHMARK(benchmark_name)                                    \
+      ->ArgNames({"particles", "skew"})                        \
+      ->Args({1'000, kUniform})                                \
+      ->Args({1'000, kPeaked})                                 \
+      ->Args({1'000, kDegenerate})                             \
+      ->Args({100'000, kUniform})                              \
+      ->Args({100'000, kPeaked})                               \
+      ->Args({100'000, kDegenerate})                           \
+      ->Args({1'000'000, kUniform})                            \
+      ->Args({1'000'000, kPeaked})                             \
+      ->Args({1'000'000, kDegenerate})                         \
+      ->Complexity()
+
+/// Index-based systematic resampling: compact index buffer first, then a
+/// column-wise gather over the TupleVector storage.
+void BM_Resample_IndexBasedSystematic(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+  const auto container = make_particles(count, state.range(1));
+  auto new_container = Container{count};
+  auto indices = beluga::ResampleIndices{};
+  for (auto _ : state) {
+    beluga::systematic_resample_indices(beluga::views::weights(container), count, indices);
+    beluga::apply_resample_indices(container, new_container, indices);
+    benchmark::DoNotOptimize(new_container.data<0>());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+/// Index computation alone, to read the index/data-movement cost split
+/// against the combined benchmark above.
+void BM_Resample_IndexComputationOnly(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+  const auto container = make_particles(count, state.range(1));
+  auto indices = beluga::ResampleIndices{};
+  for (auto _ : state) {
+    beluga::systematic_resample_indices(beluga::views::weights(container), count, indices);
+    benchmark::DoNotOptimize(indices.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+BELUGA_RESAMPLE_BENCHMARK(BM_Resample_Multinomial);
+BELUGA_RESAMPLE_BENCHMARK(BM_Resample_Systematic);
+BELUGA_RESAMPLE_BENCHMARK(BM_Resample_Residual);
+BELUGA_RESAMPLE_BENCHMARK(BM_Resample_IndexBasedSystematic);
+BELUGA_RESAMPLE_BENCHMARK(BM_Resample_IndexComputationOnly);
+
+constexpr double kRandomStateProbability = 0.05;
+constexpr double kKldEpsilon = 0.05;
+constexpr double kKldZ = 3.;
+
+/// Returns a generator of random particles for recovery interspersion.
+auto make_random_particle_fn() {
+  return [x = 0.]() mutable {
+    x += 0.05;
+    return std::make_tuple(State{x, 0., 0.}, beluga::Weight{1.});
+  };
+}
+
+/// The production flow: multinomial sampling with random-state interspersion
+/// and KLD-adaptive termination.
+void BM_Resample_MultinomialKldFlow(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+  const auto container = make_particles(count, state.range(1));
+  auto new_container = Container{count};
+  for (auto _ : state) {
+    auto samples = container |              //
+                   beluga::views::sample |  //
+                   beluga::views::random_intersperse(make_random_particle_fn(), kRandomStateProbability) |
+                   beluga::views::take_while_kld(beluga::spatial_hash<State>{}, 0UL, count, kKldEpsilon, kKldZ);
+    auto last = ranges::copy(samples, ranges::begin(new_container)).out;
+    state.counters["SampleSize"] =
+        static_cast<double>(ranges::size(ranges::make_subrange(ranges::begin(new_container), last)));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+/// Same flow with the systematic strategy feeding the interspersion and the
+/// KLD cutoff; the sampler caps the stream at the requested count by itself.
+void BM_Resample_SystematicKldFlow(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+  const auto container = make_particles(count, state.range(1));
+  auto new_container = Container{count};
+  for (auto _ : state) {
+    auto samples = container |                                  //
+                   beluga::views::systematic_sample(count) |    //
+                   beluga::views::random_intersperse(make_random_particle_fn(), kRandomStateProbability) |
+                   beluga::views::take_while_kld(beluga::spatial_hash<State>{}, 0UL, count, kKldEpsilon, kKldZ);
+    auto last = ranges::copy(samples, ranges::begin(new_container)).out;
+    state.counters["SampleSize"] =
+        static_cast<double>(ranges::size(ranges::make_subrange(ranges::begin(new_container), last)));
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+}
+
+BELUGA_RESAMPLE_BENCHMARK(BM_Resample_MultinomialKldFlow);
+BELUGA_RESAMPLE_BENCHMARK(BM_Resample_SystematicKldFlow);
+
+}  // namespace
@@ -15,14 +15,20 @@
 #include <benchmark/benchmark.h>
 
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <iterator>
+#include <ratio>
 #include <tuple>
+#include <vector>
 
 #include <range/v3/view/generate.hpp>
+#include <range/v3/view/span.hpp>
 #include <range/v3/view/take_exactly.hpp>
 #include <range/v3/view/transform.hpp>
 
+#include <sophus/se2.hpp>
+
 #include "beluga/algorithm/spatial_hash.hpp"
 
 namespace {
@@ -51,4 +57,80 @@ void BM_Hashing(benchmark::State& state) {
 
 BENCHMARK(BM_Hashing)->RangeMultiplier(2)->Range(100'000, 1'000'000)->Complexity();
 
+auto MakeDecomposedStates(std::size_t count) {
+  auto x = std::vector<double>(count);
+  auto y = std::vector<double>(count);
+  auto cos_theta = std::vector<double>(count);
+  auto sin_theta = std::vector<double>(count);
+  for (std::size_t index = 0; index < count; ++index) {
+    const double theta = 0.001 * static_cast<double>(index);
+    x[index] = 0.25 * static_cast<double>(index);
+    y[index] = -0.5 * static_cast<double>(index);
+    cos_theta[index] = std::cos(theta);
+    sin_theta[index] = std::sin(theta);
+  }
+  return std::make_tuple(std::move(x), std::move(y), std::move(cos_theta), std::move(sin_theta));
+}
+
+void BM_HashingSE2(benchmark::State& state) {
+  const auto hasher = beluga::spatial_hash<Sophus::SE2d>{1., 1., 1.};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+
+  const auto [x, y, cos_theta, sin_theta] = MakeDecomposedStates(count);
+  auto states = std::vector<Sophus::SE2d>{};
+  states.reserve(count);
+  for (std::size_t index = 0; index < count; ++index) {
+    states.emplace_back(Sophus::SO2d{cos_theta[index], sin_theta[index]}, Eigen::Vector2d{x[index], y[index]});
+  }
+
+  auto hashes = std::vector<std::size_t>(count);
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < count; ++index) {
+      hashes[index] = hasher(states[index]);
+    }
+    benchmark::DoNotOptimize(hashes.data());
+  }
+}
+
+BENCHMARK(BM_HashingSE2)->RangeMultiplier(2)->Range(100'000, 1'000'000)->Complexity();
+
+void BM_HashingSE2Batch(benchmark::State& state) {
+  const auto hasher = beluga::spatial_hash<Sophus::SE2d>{1., 1., 1.};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+
+  const auto [x, y, cos_theta, sin_theta] = MakeDecomposedStates(count);
+
+  auto hashes = std::vector<std::size_t>(count);
+  for (auto _ : state) {
+    hasher(
+        ranges::make_span(x.data(), state.range(0)), ranges::make_span(y.data(), state.range(0)),
+        ranges::make_span(cos_theta.data(), state.range(0)), ranges::make_span(sin_theta.data(), state.range(0)),
+        ranges::make_span(hashes.data(), state.range(0)));
+    benchmark::DoNotOptimize(hashes.data());
+  }
+}
+
+BENCHMARK(BM_HashingSE2Batch)->RangeMultiplier(2)->Range(100'000, 1'000'000)->Complexity();
+
+void BM_HashingSE2BatchStaticResolution(benchmark::State& state) {
+  const auto hasher = beluga::static_spatial_hash<std::ratio<1>>{};
+  const auto count = static_cast<std::size_t>(state.range(0));
+  state.SetComplexityN(state.range(0));
+
+  const auto [x, y, cos_theta, sin_theta] = MakeDecomposedStates(count);
+
+  auto hashes = std::vector<std::size_t>(count);
+  for (auto _ : state) {
+    hasher(
+        ranges::make_span(x.data(), state.range(0)), ranges::make_span(y.data(), state.range(0)),
+        ranges::make_span(cos_theta.data(), state.range(0)), ranges::make_span(sin_theta.data(), state.range(0)),
+        ranges::make_span(hashes.data(), state.range(0)));
+    benchmark::DoNotOptimize(hashes.data());
+  }
+}
+
+BENCHMARK(BM_HashingSE2BatchStaticResolution)->RangeMultiplier(2)->Range(100'000, 1'000'000)->Complexity();
+
 }  // namespace
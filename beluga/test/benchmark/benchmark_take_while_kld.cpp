@@ -31,6 +31,8 @@
 #include "beluga/views/sample.hpp"
 #include "beluga/views/take_while_kld.hpp"
 
+#include "allocation_counters.hpp"
+
 namespace {
 
 struct State {
@@ -66,6 +68,8 @@ void BM_FixedResample(benchmark::State& state) {
     weight = 1.;
   }
 
+  auto allocations = beluga::benchmarking::AllocationCounters{};
+  allocations.start();
   for (auto _ : state) {
     auto samples = container |              //
                    beluga::views::sample |  //
@@ -75,6 +79,8 @@ void BM_FixedResample(benchmark::State& state) {
     auto result = ranges::make_subrange(first, last);
     state.counters["SampleSize"] = static_cast<double>(ranges::size(result));
   }
+  allocations.stop();
+  allocations.report(state);
 }
 
 BENCHMARK(BM_FixedResample)->RangeMultiplier(2)->Range(128, 1'000'000)->Complexity();
@@ -102,6 +108,8 @@ void BM_AdaptiveResample(benchmark::State& state) {
   const double kld_epsilon = 0.05;
   const double kld_z = 3.;
 
+  auto allocations = beluga::benchmarking::AllocationCounters{};
+  allocations.start();
   for (auto _ : state) {
     auto samples =
         container |              //
@@ -113,6 +121,8 @@ void BM_AdaptiveResample(benchmark::State& state) {
     state.counters["SampleSize"] = static_cast<double>(ranges::size(result));
     state.counters["Percentage"] = static_cast<double>(ranges::size(result)) / static_cast<double>(max_samples);
   }
+  allocations.stop();
+  allocations.report(state);
 }
 
 BENCHMARK(BM_AdaptiveResample)->RangeMultiplier(2)->Range(128, 1'000'000)->Complexity();
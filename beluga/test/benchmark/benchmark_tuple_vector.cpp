@@ -15,18 +15,26 @@
 #include <benchmark/benchmark.h>
 
 #include <cstddef>
+#include <cstdint>
 #include <tuple>
 #include <vector>
 
+#include <range/v3/algorithm/copy.hpp>
+#include <range/v3/algorithm/fill.hpp>
 #include <range/v3/algorithm/transform.hpp>
 #include <range/v3/iterator/insert_iterators.hpp>
 #include <range/v3/range/access.hpp>
 #include <range/v3/view/filter.hpp>
+#include <range/v3/view/take_exactly.hpp>
 #include <range/v3/view/transform.hpp>
 
 #include "beluga/containers/tuple_vector.hpp"
 #include "beluga/primitives.hpp"
 #include "beluga/views/particles.hpp"
+#include "beluga/views/sample.hpp"
+
+#include "allocation_counters.hpp"
+#include "perf_event_counters.hpp"
 
 namespace {
 
@@ -75,32 +83,44 @@ double update_weight(const State& state) {
 void BM_Update_Baseline_StructureOfArrays(benchmark::State& state) {
   Arrays arrays;
   arrays.resize(kParticleCount);
+  auto counters = beluga::benchmarking::PerfEventCounters{};
+  counters.start();
   for (auto _ : state) {
     for (std::size_t i = 0; i < kParticleCount; ++i) {
       arrays.weights[i] = update_weight(arrays.states[i]);
     }
   }
+  counters.stop();
+  counters.report(state);
 }
 
 void BM_Update_Baseline_ArrayOfStructures(benchmark::State& state) {
   std::vector<Particle> particles;
   particles.resize(kParticleCount);
+  auto counters = beluga::benchmarking::PerfEventCounters{};
+  counters.start();
   for (auto _ : state) {
     for (std::size_t i = 0; i < kParticleCount; ++i) {
       auto&& particle = particles[i];
       std::get<1>(particle) = update_weight(std::get<0>(particle));
     }
   }
+  counters.stop();
+  counters.report(state);
 }
 
 template <class Container>
 void BM_Update(benchmark::State& state) {
   auto container = Container{};
   container.resize(kParticleCount);
+  auto counters = beluga::benchmarking::PerfEventCounters{};
+  counters.start();
   for (auto _ : state) {
     auto weights = beluga::views::weights(container);
     ranges::transform(beluga::views::states(container), ranges::begin(weights), update_weight);
   }
+  counters.stop();
+  counters.report(state);
 }
 
 BENCHMARK(BM_Update_Baseline_StructureOfArrays);
@@ -142,12 +162,16 @@ void BM_PushBack(benchmark::State& state) {
   container.resize(kParticleCount);
   auto new_container = Container{};
   new_container.reserve(kParticleCount);
+  auto allocations = beluga::benchmarking::AllocationCounters{};
+  allocations.start();
   for (auto _ : state) {
     new_container.clear();
     ranges::transform(beluga::views::states(container), ranges::back_inserter(new_container), [](const State& state) {
       return std::make_tuple(state, 0, 0);
     });
   }
+  allocations.stop();
+  allocations.report(state);
 }
 
 BENCHMARK(BM_PushBack_Baseline_StructureOfArrays);
@@ -199,11 +223,15 @@ void BM_AssignFromSized(benchmark::State& state) {
   auto container = Container{};
   container.resize(kParticleCount);
   auto new_container = Container{};
+  auto allocations = beluga::benchmarking::AllocationCounters{};
+  allocations.start();
   for (auto _ : state) {
     new_container.assign_range(
         beluga::views::states(container) |  //
         ranges::views::transform([](const State& state) { return std::make_tuple(state, 0, 0); }));
   }
+  allocations.stop();
+  allocations.report(state);
 }
 
 template <class Container>
@@ -211,12 +239,16 @@ void BM_AssignFromNonSized(benchmark::State& state) {
   auto container = Container{};
   container.resize(kParticleCount);
   auto new_container = Container{};
+  auto allocations = beluga::benchmarking::AllocationCounters{};
+  allocations.start();
   for (auto _ : state) {
     new_container.assign_range(
         beluga::views::states(container) |                  //
         ranges::views::filter([](auto) { return true; }) |  //
         ranges::views::transform([](const State& state) { return std::make_tuple(state, 0, 0); }));
   }
+  allocations.stop();
+  allocations.report(state);
 }
 
 template <class Container>
@@ -225,12 +257,16 @@ void BM_AssignFromNonSizedReserved(benchmark::State& state) {
   container.resize(kParticleCount);
   auto new_container = Container{};
   new_container.reserve(kParticleCount);
+  auto allocations = beluga::benchmarking::AllocationCounters{};
+  allocations.start();
   for (auto _ : state) {
     new_container.assign_range(
         beluga::views::states(container) |                  //
         ranges::views::filter([](auto) { return true; }) |  //
         ranges::views::transform([](const State& state) { return std::make_tuple(state, 0, 0); }));
   }
+  allocations.stop();
+  allocations.report(state);
 }
 
 BENCHMARK(BM_Assign_Baseline_StructureOfArrays);
@@ -241,4 +277,79 @@ BENCHMARK_TEMPLATE(BM_Transform, StructureOfArrays);
 BENCHMARK(BM_Assign_Baseline_ArrayOfStructures);
 BENCHMARK_TEMPLATE(BM_Transform, ArrayOfStructures);
 
+// Pipeline-realistic access patterns, swept over particle counts so layout
+// regressions show up at the sizes the filter actually runs with.
+
+template <class Container>
+void BM_SequentialReweight(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  auto container = Container{};
+  container.resize(count);
+  auto counters = beluga::benchmarking::PerfEventCounters{};
+  counters.start();
+  auto allocations = beluga::benchmarking::AllocationCounters{};
+  allocations.start();
+  for (auto _ : state) {
+    auto weights = beluga::views::weights(container);
+    ranges::transform(beluga::views::states(container), ranges::begin(weights), update_weight);
+  }
+  allocations.stop();
+  allocations.report(state);
+  counters.stop();
+  counters.report(state);
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+}
+
+BENCHMARK_TEMPLATE(BM_SequentialReweight, StructureOfArrays)->Arg(1'000)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(BM_SequentialReweight, ArrayOfStructures)->Arg(1'000)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+
+template <class Container>
+void BM_ResampleGather(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  auto container = Container{};
+  container.resize(count);
+  ranges::fill(beluga::views::weights(container), 1.0);
+  auto new_container = Container{};
+  new_container.resize(count);
+  auto counters = beluga::benchmarking::PerfEventCounters{};
+  counters.start();
+  auto allocations = beluga::benchmarking::AllocationCounters{};
+  allocations.start();
+  for (auto _ : state) {
+    ranges::copy(
+        container | beluga::views::sample | ranges::views::take_exactly(static_cast<std::ptrdiff_t>(count)),
+        ranges::begin(new_container));
+  }
+  allocations.stop();
+  allocations.report(state);
+  counters.stop();
+  counters.report(state);
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+}
+
+BENCHMARK_TEMPLATE(BM_ResampleGather, StructureOfArrays)->Arg(1'000)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(BM_ResampleGather, ArrayOfStructures)->Arg(1'000)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+
+template <class Container>
+void BM_ZipTraversal(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  auto container = Container{};
+  container.resize(count);
+  auto counters = beluga::benchmarking::PerfEventCounters{};
+  counters.start();
+  for (auto _ : state) {
+    double total = 0.;
+    for (auto&& particle : container) {
+      total += std::get<1>(particle) + std::get<0>(particle).x;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  counters.stop();
+  counters.report(state);
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+}
+
+BENCHMARK_TEMPLATE(BM_ZipTraversal, StructureOfArrays)->Arg(1'000)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+BENCHMARK_TEMPLATE(BM_ZipTraversal, ArrayOfStructures)->Arg(1'000)->Arg(10'000)->Arg(100'000)->Arg(1'000'000);
+
 }  // namespace
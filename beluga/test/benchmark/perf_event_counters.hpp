@@ -0,0 +1,138 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_TEST_BENCHMARK_PERF_EVENT_COUNTERS_HPP
+#define BELUGA_TEST_BENCHMARK_PERF_EVENT_COUNTERS_HPP
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include <cstring>
+#endif
+
+/**
+ * \file
+ * \brief Hardware counter instrumentation for benchmarks, on top of `perf_event_open(2)`.
+ */
+
+namespace beluga::benchmarking {
+
+/// Scoped group of hardware performance counters reported as benchmark counters.
+/**
+ * Opens instructions, cycles, cache miss and branch miss counters for the
+ * calling thread, brackets the benchmark loop with `start()` / `stop()`, and
+ * publishes per-iteration averages via `report()`. Layout-oriented changes can
+ * then be judged by cache behavior instead of wall time alone, which is noisy
+ * on shared CI machines.
+ *
+ * Counters that the kernel refuses to open (no `perf_event` support in the
+ * container, restrictive `perf_event_paranoid`, or events not backed by the
+ * virtualized PMU) are silently skipped, so benchmarks run unchanged where the
+ * instrumentation is unavailable.
+ */
+class PerfEventCounters {
+ public:
+  /// Opens the counter group for the calling thread.
+  PerfEventCounters() {
+#if defined(__linux__)
+    open_counter("instructions", PERF_COUNT_HW_INSTRUCTIONS);
+    open_counter("cycles", PERF_COUNT_HW_CPU_CYCLES);
+    open_counter("cache_misses", PERF_COUNT_HW_CACHE_MISSES);
+    open_counter("branch_misses", PERF_COUNT_HW_BRANCH_MISSES);
+#endif
+  }
+
+  /// Not copyable, instances own file descriptors.
+  PerfEventCounters(const PerfEventCounters&) = delete;
+  /// Not copy-assignable, instances own file descriptors.
+  PerfEventCounters& operator=(const PerfEventCounters&) = delete;
+
+  ~PerfEventCounters() {
+#if defined(__linux__)
+    for (const auto& counter : counters_) {
+      close(counter.fd);
+    }
+#endif
+  }
+
+  /// Resets and enables all counters; call right before the benchmark loop.
+  void start() {
+#if defined(__linux__)
+    for (const auto& counter : counters_) {
+      ioctl(counter.fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(counter.fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+#endif
+  }
+
+  /// Disables all counters and latches their values; call right after the loop.
+  void stop() {
+#if defined(__linux__)
+    for (auto& counter : counters_) {
+      ioctl(counter.fd, PERF_EVENT_IOC_DISABLE, 0);
+      std::uint64_t value = 0;
+      if (read(counter.fd, &value, sizeof(value)) == static_cast<ssize_t>(sizeof(value))) {
+        counter.value = value;
+      }
+    }
+#endif
+  }
+
+  /// Publishes the latched values as per-iteration benchmark counters.
+  void report(benchmark::State& state) const {
+    for (const auto& counter : counters_) {
+      state.counters[counter.name] =
+          benchmark::Counter(static_cast<double>(counter.value), benchmark::Counter::kAvgIterations);
+    }
+  }
+
+ private:
+  struct Counter {
+    const char* name;
+    int fd;
+    std::uint64_t value;
+  };
+
+#if defined(__linux__)
+  void open_counter(const char* name, std::uint64_t config) {
+    perf_event_attr attr;
+    std::memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    const int fd = static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0));
+    if (fd >= 0) {
+      counters_.push_back(Counter{name, fd, 0});
+    }
+  }
+#endif
+
+  std::vector<Counter> counters_;
+};
+
+}  // namespace beluga::benchmarking
+
+#endif  // BELUGA_TEST_BENCHMARK_PERF_EVENT_COUNTERS_HPP
@@ -16,6 +16,8 @@ find_package(ament_cmake REQUIRED)
 find_package(beluga REQUIRED)
 find_package(beluga_ros REQUIRED)
 find_package(bondcpp REQUIRED)
+find_package(diagnostic_msgs REQUIRED)
+find_package(map_msgs REQUIRED)
 find_package(rclcpp REQUIRED)
 find_package(rclcpp_components REQUIRED)
 find_package(rclcpp_lifecycle REQUIRED)
@@ -33,6 +35,8 @@ ament_target_dependencies(
   PUBLIC beluga
          beluga_ros
          bondcpp
+         diagnostic_msgs
+         map_msgs
          rclcpp
          rclcpp_components
          rclcpp_lifecycle
@@ -46,6 +50,8 @@ ament_export_dependencies(
   beluga
   beluga_ros
   bondcpp
+  diagnostic_msgs
+  map_msgs
   rclcpp
   rclcpp_components
   rclcpp_lifecycle
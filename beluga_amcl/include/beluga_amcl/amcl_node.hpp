@@ -15,9 +15,13 @@
 #ifndef BELUGA_AMCL_AMCL_NODE_HPP
 #define BELUGA_AMCL_AMCL_NODE_HPP
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include <message_filters/subscriber.h>
 #include <tf2_ros/buffer.h>
@@ -27,14 +31,19 @@
 #include <bondcpp/bond.hpp>
 #include <rclcpp_lifecycle/lifecycle_node.hpp>
 
+#include <builtin_interfaces/msg/time.hpp>
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
 #include <geometry_msgs/msg/pose_array.hpp>
 #include <geometry_msgs/msg/pose_with_covariance_stamped.hpp>
+#include <map_msgs/msg/occupancy_grid_update.hpp>
 #include <nav_msgs/msg/occupancy_grid.hpp>
 #include <sensor_msgs/msg/laser_scan.hpp>
 #include <std_srvs/srv/empty.hpp>
+#include <tf2_msgs/msg/tf_message.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
 
 #include <beluga/beluga.hpp>
+#include <beluga/utility/thread_pool.hpp>
 #include <beluga_ros/amcl.hpp>
 
 /**
@@ -86,17 +95,65 @@ class AmclNode : public rclcpp_lifecycle::LifecycleNode {
   auto make_particle_filter(nav_msgs::msg::OccupancyGrid::SharedPtr) const -> std::unique_ptr<beluga_ros::Amcl>;
 
   /// Callback for occupancy grid map updates.
+  /**
+   * Does not touch the particle filter itself: it hands the map to a background
+   * worker that builds a replacement filter (the sensor model rebuild can take
+   * seconds on large maps), so with a multithreaded executor scan processing
+   * keeps running while the rebuild is in flight.
+   */
   void map_callback(nav_msgs::msg::OccupancyGrid::SharedPtr);
 
+  /// Callback for incremental occupancy grid map updates.
+  /**
+   * Applies the patch to the stored map in place and forwards the changed region
+   * to the particle filter, so small map touch-ups cost work proportional to the
+   * patched area instead of a full sensor model rebuild.
+   */
+  void map_update_callback(map_msgs::msg::OccupancyGridUpdate::SharedPtr);
+
+  /// Swap in a replacement particle filter built by the map update worker, if any.
+  /**
+   * Must run in the common callback group, where touching the particle filter is
+   * safe. The worker arms a one-shot timer in that group to trigger it as soon as
+   * a rebuild finishes; the laser and timer callbacks also invoke it as a fallback.
+   */
+  void apply_pending_particle_filter();
+
   /// Callback for periodic particle cloud updates.
   void timer_callback();
 
+  /// Publish filter health telemetry as diagnostics.
+  /**
+   * Reads the filter profiler (see `beluga_ros::Amcl::profiler()`) and publishes
+   * one diagnostic status with count/mean/p95/max per pipeline stage, plus one
+   * with the weight degeneracy telemetry of the last update (see
+   * `beluga_ros::Amcl::last_weight_statistics()`), flagging a warning when most
+   * particles carry a vanishing share of the weight. Must run in the common
+   * callback group, where touching the particle filter is safe.
+   */
+  void publish_filter_diagnostics();
+
   /// Callback for node to configure and activate itself.
   void autostart_callback();
 
   /// Callback for laser scan updates.
+  /**
+   * First stage of the scan pipeline: it looks up the relevant transforms,
+   * converts the scan to a packed measurement and stages it for
+   * process_pending_measurement(). It runs in its own callback group, so with a
+   * multithreaded executor the next scan is converted while the filter stage
+   * processes the previous one.
+   */
   void laser_callback(sensor_msgs::msg::LaserScan::ConstSharedPtr);
 
+  /// Update the particle filter with the staged measurement and publish the results.
+  /**
+   * Second stage of the scan pipeline. Must run in the common callback group,
+   * where touching the particle filter is safe; the conversion stage re-arms a
+   * one-shot timer in that group to trigger it once per staged measurement.
+   */
+  void process_pending_measurement();
+
   /// Callback for pose (re)initialization.
   void initial_pose_callback(geometry_msgs::msg::PoseWithCovarianceStamped::SharedPtr);
 
@@ -106,6 +163,18 @@ class AmclNode : public rclcpp_lifecycle::LifecycleNode {
       std::shared_ptr<std_srvs::srv::Empty::Request> request,
       std::shared_ptr<std_srvs::srv::Empty::Response> response);
 
+  /// Callback for the branch-and-bound relocalization service.
+  /**
+   * Runs a coarse-to-fine branch-and-bound scan match of the last laser
+   * measurement over the whole map and seeds the filter with a mixture of
+   * normal distributions around the resulting pose candidates. Falls back to
+   * a uniform reinitialization when the search finds no candidate.
+   */
+  void relocalization_callback(
+      std::shared_ptr<rmw_request_id_t> request_header,
+      std::shared_ptr<std_srvs::srv::Empty::Request> request,
+      std::shared_ptr<std_srvs::srv::Empty::Response> response);
+
   /// Callback for the no motion update service.
   void nomotion_update_callback(
       std::shared_ptr<rmw_request_id_t> request_header,
@@ -136,6 +205,9 @@ class AmclNode : public rclcpp_lifecycle::LifecycleNode {
   /// Node bond with the lifecycle manager.
   std::unique_ptr<bond::Bond> bond_;
 
+  /// Callback group serializing every callback that touches the particle filter.
+  rclcpp::CallbackGroup::SharedPtr common_callback_group_;
+
   /// Timer for periodic particle cloud updates.
   rclcpp::TimerBase::SharedPtr timer_;
 
@@ -150,16 +222,30 @@ class AmclNode : public rclcpp_lifecycle::LifecycleNode {
   /// Estimated pose publisher.
   rclcpp_lifecycle::LifecyclePublisher<geometry_msgs::msg::PoseWithCovarianceStamped>::SharedPtr pose_pub_;
 
+  /// Filter timing diagnostics publisher.
+  rclcpp_lifecycle::LifecyclePublisher<diagnostic_msgs::msg::DiagnosticArray>::SharedPtr diagnostics_pub_;
+  /// Timer for periodic filter timing diagnostics.
+  rclcpp::TimerBase::SharedPtr diagnostics_timer_;
+
+  /// Particle cloud message reused across publications to avoid reallocation.
+  geometry_msgs::msg::PoseArray particle_cloud_message_;
+  /// Particle markers message reused across publications to avoid reallocation.
+  visualization_msgs::msg::MarkerArray particle_markers_message_;
+
   /// Pose (re)initialization subscription.
   rclcpp::Subscription<geometry_msgs::msg::PoseWithCovarianceStamped>::SharedPtr initial_pose_sub_;
   /// Occupancy grid map updates subscription.
   rclcpp::Subscription<nav_msgs::msg::OccupancyGrid>::SharedPtr map_sub_;
+  /// Incremental occupancy grid map patch subscription.
+  rclcpp::Subscription<map_msgs::msg::OccupancyGridUpdate>::SharedPtr map_update_sub_;
   /// Laser scan updates subscription.
   std::unique_ptr<message_filters::Subscriber<sensor_msgs::msg::LaserScan, rclcpp_lifecycle::LifecycleNode>>
       laser_scan_sub_;
 
   /// Global relocalization service server.
   rclcpp::Service<std_srvs::srv::Empty>::SharedPtr global_localization_server_;
+  /// Branch-and-bound relocalization service server.
+  rclcpp::Service<std_srvs::srv::Empty>::SharedPtr relocalization_server_;
   /// No motion update service server.
   rclcpp::Service<std_srvs::srv::Empty>::SharedPtr nomotion_update_server_;
 
@@ -173,11 +259,73 @@ class AmclNode : public rclcpp_lifecycle::LifecycleNode {
   std::unique_ptr<tf2_ros::MessageFilter<sensor_msgs::msg::LaserScan>> laser_scan_filter_;
   /// Connection for laser scan updates filter and callback.
   message_filters::Connection laser_scan_connection_;
+  /// Cached laser-to-base transform, resolved once per frame pair.
+  /**
+   * The laser mount is static, so the per-scan tf2 buffer lookup (and the
+   * buffer mutex it contends on) is paid only on the first scan. The cache is
+   * accessed exclusively from the conversion callback group.
+   */
+  std::optional<Sophus::SE3d> cached_laser_pose_in_base_;
+  /// Frame pair (base, laser) the cached laser pose was resolved for.
+  std::pair<std::string, std::string> cached_laser_pose_frames_;
+  /// Subscription whose sole purpose is invalidating the cached laser pose
+  /// when the static transforms are (re)published.
+  rclcpp::Subscription<tf2_msgs::msg::TFMessage>::SharedPtr static_transform_sub_;
 
   /// Particle filter instance.
   std::unique_ptr<beluga_ros::Amcl> particle_filter_;
+  /// Background worker that rebuilds the particle filter when a new map arrives.
+  std::unique_ptr<beluga::ThreadPool> map_update_worker_;
+  /// Protects the pending filter slot and the worker handle shared with the map callback.
+  std::mutex pending_filter_mutex_;
+  /// Replacement particle filter built from the latest map, waiting to be swapped in.
+  std::unique_ptr<beluga_ros::Amcl> pending_particle_filter_;
+  /// Map the pending particle filter was built from, swapped in alongside it.
+  nav_msgs::msg::OccupancyGrid::SharedPtr pending_map_;
+  /// One-shot timer armed by the worker to swap the filter in without waiting for a scan.
+  rclcpp::TimerBase::SharedPtr filter_swap_timer_;
+  /// Whether a particle filter instance exists, readable from the map callback thread.
+  std::atomic<bool> particle_filter_exists_{false};
+
+  /// Laser measurement converted off the filter path, staged for the filter stage.
+  struct PendingMeasurement {
+    /// Scan timestamp.
+    builtin_interfaces::msg::Time stamp;
+    /// Base pose in the odometry frame at the scan timestamp.
+    Sophus::SE2d base_pose_in_odom;
+    /// Packed measurement; see beluga_ros::LaserScan::fill_measurement().
+    std::vector<std::pair<double, double>> measurement;
+  };
+
+  /// Callback group for the scan conversion stage, kept apart from the common
+  /// group so conversions overlap with filter updates under a multithreaded executor.
+  rclcpp::CallbackGroup::SharedPtr conversion_callback_group_;
+  /// Protects the pending measurement slot.
+  std::mutex pending_measurement_mutex_;
+  /// Latest converted measurement awaiting a filter update; newer conversions overwrite it.
+  PendingMeasurement pending_measurement_;
+  /// Whether the pending measurement slot holds an unprocessed measurement.
+  bool pending_measurement_available_{false};
+  /// Scratch buffer of the conversion stage, reused across scans.
+  std::vector<std::pair<double, double>> conversion_measurement_;
+  /// Scratch buffer of the filter stage, reused across scans.
+  std::vector<std::pair<double, double>> filter_measurement_;
+  /// One-shot timer re-armed by the conversion stage to run the filter stage promptly.
+  rclcpp::TimerBase::SharedPtr measurement_timer_;
+  /// Whether the scheduling configuration was applied to the filter update thread.
+  bool scheduling_applied_{false};
+  /// Map the current particle filter was built from; patches are applied to it in place.
+  nav_msgs::msg::OccupancyGrid::SharedPtr last_known_map_;
+  /// Scan matcher for the relocalization service, built lazily and reset when the map changes.
+  std::unique_ptr<beluga::BranchAndBoundScanMatcher<beluga_ros::OccupancyGrid>> relocalization_matcher_;
   /// Last known pose estimate, if any.
+  /**
+   * The mean is refreshed on every filter update; the covariance is refreshed
+   * at timer rate from `latest_estimate_handle_`.
+   */
   std::optional<std::pair<Sophus::SE2d, Eigen::Matrix3d>> last_known_estimate_;
+  /// Estimate handle of the last filter update, retaining the statistics to finish the covariance on demand.
+  std::optional<beluga_ros::Amcl::estimation_type> latest_estimate_handle_;
   /// Last known map to odom correction estimate, if any.
   std::optional<Sophus::SE2d> last_known_odom_transform_in_map_;
   /// Whether to broadcast transforms or not.
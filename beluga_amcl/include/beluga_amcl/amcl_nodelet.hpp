@@ -38,6 +38,7 @@
 #include <memory>
 #include <mutex>
 #include <utility>
+#include <vector>
 
 #include <sophus/se2.hpp>
 
@@ -99,8 +100,26 @@ class AmclNodelet : public nodelet::Nodelet {
   void particle_cloud_timer_callback(const ros::TimerEvent& ev);
 
   /// Callback for laser scan updates.
+  /**
+   * First stage of the scan pipeline: it converts the scan on the arriving
+   * callback thread (transform lookups, range filtering and projection) and
+   * admits the result through a latest-wins slot, so with a multithreaded
+   * spinner the next scan is converted while the previous one updates the
+   * filter. When filter updates overrun the scan period, intermediate
+   * measurements are shed instead of queuing up, bounding scan-to-pose latency
+   * under overload. Dropping scans loses no odometry since the control window is
+   * fed absolute odometry poses looked up at the processed scan's timestamp.
+   */
   void laser_callback(const sensor_msgs::LaserScan::ConstPtr& laser_scan);
 
+  /// Update the particle filter with the measurement staged in the filter-stage
+  /// buffer and publish the result.
+  /**
+   * \param stamp Timestamp of the converted scan.
+   * \param base_pose_in_odom Base pose in the odometry frame at that timestamp.
+   */
+  void laser_update(const ros::Time& stamp, const Sophus::SE2d& base_pose_in_odom);
+
   /// Callback for pose (re)initialization.
   void initial_pose_callback(const geometry_msgs::PoseWithCovarianceStamped::ConstPtr& message);
 
@@ -140,6 +159,35 @@ class AmclNodelet : public nodelet::Nodelet {
   /// Mutex for particle filter access.
   mutable std::mutex mutex_;
 
+  /// Laser measurement converted off the filter path, staged for the filter stage.
+  struct PendingMeasurement {
+    /// Scan timestamp.
+    ros::Time stamp;
+    /// Base pose in the odometry frame at the scan timestamp.
+    Sophus::SE2d base_pose_in_odom;
+    /// Packed measurement; see beluga_ros::LaserScan::fill_measurement().
+    std::vector<std::pair<double, double>> measurement;
+  };
+
+  /// Serializes the scan conversion stage and guards its scratch state.
+  std::mutex conversion_mutex_;
+  /// Copy of the configuration read by the conversion stage, which cannot take
+  /// the filter mutex without stalling behind in-flight filter updates.
+  beluga_amcl::AmclConfig conversion_config_;
+  /// Scratch buffer of the conversion stage, reused across scans.
+  std::vector<std::pair<double, double>> conversion_measurement_;
+
+  /// Mutex for the pending measurement slot.
+  std::mutex pending_measurement_mutex_;
+  /// Latest converted measurement awaiting processing; newer arrivals overwrite it.
+  PendingMeasurement pending_measurement_;
+  /// Whether the pending measurement slot holds an unprocessed measurement.
+  bool pending_measurement_available_{false};
+  /// Whether some thread is currently draining the pending measurement slot.
+  bool laser_update_in_progress_{false};
+  /// Scratch buffer of the filter stage, reused across scans.
+  std::vector<std::pair<double, double>> filter_measurement_;
+
   /// Timer for periodic particle cloud updates.
   ros::Timer particle_cloud_timer_;
   /// Particle cloud publisher.
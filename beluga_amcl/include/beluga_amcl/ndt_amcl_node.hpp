@@ -21,6 +21,7 @@
 #include <tf2_ros/transform_listener.h>
 
 #include <beluga/beluga.hpp>
+#include <beluga/containers/flat_grid_map.hpp>
 #include <beluga/motion/differential_drive_model.hpp>
 #include <beluga/motion/omnidirectional_drive_model.hpp>
 #include <beluga/motion/stationary_model.hpp>
@@ -28,9 +29,11 @@
 #include <beluga/sensor/data/ndt_cell.hpp>
 #include <beluga/sensor/data/sparse_value_grid.hpp>
 #include <beluga/sensor/ndt_sensor_model.hpp>
+#include <beluga/utility/thread_pool.hpp>
 
 #include <execution>
 #include <functional>
+#include <mutex>
 #include <optional>
 #include <sophus/se2.hpp>
 #include <tuple>
@@ -59,8 +62,7 @@
 namespace beluga_amcl {
 
 /// Underlying map representation for the NDT sensor model.
-using NDTMapRepresentation =
-    beluga::SparseValueGrid<std::unordered_map<Eigen::Vector2i, beluga::NDTCell2d, beluga::detail::CellHasher<2>>>;
+using NDTMapRepresentation = beluga::SparseValueGrid<beluga::FlatGridMap<Eigen::Vector2i, beluga::NDTCell2d>>;
 
 /// Type of a particle-dependent random state generator.
 using RandomStateGenerator = std::function<std::function<beluga::NDTSensorModel<NDTMapRepresentation>::state_type()>(
@@ -133,6 +135,15 @@ class NdtAmclNode : public rclcpp_lifecycle::LifecycleNode {
   /// Instantiate particle filter given an initial occupancy grid map and the current parametrization.
   auto make_particle_filter() const -> std::unique_ptr<NdtAmclVariant>;
 
+  /// Swap in a replacement particle filter built by the map loading worker, if any.
+  /**
+   * Must run in the common callback group, where touching the particle filter is
+   * safe. The worker arms a one-shot timer in that group to trigger it as soon as
+   * the NDT map finishes loading; the laser and timer callbacks also invoke it as
+   * a fallback.
+   */
+  void apply_pending_particle_filter();
+
   /// Callback for periodic particle cloud updates.
   void timer_callback();
 
@@ -158,6 +169,8 @@ class NdtAmclNode : public rclcpp_lifecycle::LifecycleNode {
 
   /// Node bond with the lifecycle manager.
   std::unique_ptr<bond::Bond> bond_;
+  /// Callback group serializing every callback that touches the particle filter.
+  rclcpp::CallbackGroup::SharedPtr common_callback_group_;
   /// Timer for periodic particle cloud updates.
   rclcpp::TimerBase::SharedPtr timer_;
   /// Timer for node to configure and activate itself.
@@ -187,12 +200,22 @@ class NdtAmclNode : public rclcpp_lifecycle::LifecycleNode {
 
   /// Particle filter instance.
   std::unique_ptr<NdtAmclVariant> particle_filter_ = nullptr;
+  /// Background worker that loads the NDT map and builds the particle filter.
+  std::unique_ptr<beluga::ThreadPool> map_update_worker_;
+  /// Protects the pending filter slot and the worker handle shared with the worker.
+  std::mutex pending_filter_mutex_;
+  /// Replacement particle filter built from the configured map, waiting to be swapped in.
+  std::unique_ptr<NdtAmclVariant> pending_particle_filter_;
+  /// One-shot timer armed by the worker to swap the filter in without waiting for a scan.
+  rclcpp::TimerBase::SharedPtr filter_swap_timer_;
   /// Last known pose estimate, if any.
   std::optional<std::pair<Sophus::SE2d, Eigen::Matrix3d>> last_known_estimate_ = std::nullopt;
   /// Last known map to odom correction estimate, if any.
   std::optional<Sophus::SE2d> last_known_odom_transform_in_map_;
   /// Whether to broadcast transforms or not.
   bool enable_tf_broadcast_{false};
+  /// Whether the scheduling configuration was applied to the filter update thread.
+  bool scheduling_applied_{false};
 };
 
 }  // namespace beluga_amcl
@@ -15,7 +15,15 @@
 #ifndef BELUGA_AMCL_ROS2_COMMON_HPP
 #define BELUGA_AMCL_ROS2_COMMON_HPP
 
+#include <cstdint>
 #include <string_view>
+#include <vector>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#endif
 
 #include <bondcpp/bond.hpp>
 #include <geometry_msgs/msg/pose_stamped.hpp>
@@ -394,6 +402,46 @@ inline void declare_common_params(rclcpp_lifecycle::LifecycleNode& node) {
     node.declare_parameter("execution_policy", "seq", descriptor);
   }
 
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Scheduling class for the thread running filter updates [default, fifo]. "
+        "With `fifo`, SCHED_FIFO is requested on first update (requires CAP_SYS_NICE); "
+        "under a single-threaded executor this is the node's executor thread. "
+        "Eliminates preemption jitter in tail scan-to-pose latency.";
+    node.declare_parameter("scheduling.policy", rclcpp::ParameterValue("default"), descriptor);
+  }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description = "Real-time priority used with the `fifo` scheduling policy.";
+    descriptor.integer_range.resize(1);
+    descriptor.integer_range[0].from_value = 1;
+    descriptor.integer_range[0].to_value = 99;
+    descriptor.integer_range[0].step = 1;
+    node.declare_parameter("scheduling.priority", rclcpp::ParameterValue(30), descriptor);
+  }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "CPUs the filter update thread is pinned to, empty for no pinning. "
+        "Worker threads spawned from it (e.g. by the `par` execution policy) "
+        "inherit the affinity mask, keeping the whole update on isolated cores.";
+    node.declare_parameter("scheduling.cpu_affinity", rclcpp::ParameterValue(std::vector<int64_t>{}), descriptor);
+  }
+
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Whether to prefault and lock the process memory on activation (requires "
+        "CAP_IPC_LOCK or a sufficient memlock limit). Avoids the first-touch page "
+        "fault stalls on the freshly built likelihood field and particle storage "
+        "during the first seconds after activation, and keeps them from being "
+        "paged out later.";
+    node.declare_parameter("memory.lock_and_prefault", false, descriptor);
+  }
+
   {
     auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
     descriptor.description = "Whether the node should configure and activate itself or not.";
@@ -407,5 +455,74 @@ inline void declare_common_params(rclcpp_lifecycle::LifecycleNode& node) {
   }
 }
 
+/// Prefaults and locks the process memory, when enabled by the `memory.lock_and_prefault` parameter.
+/**
+ * Locks current mappings — faulting them in as a side effect — and every future one, so the
+ * hot structures built around activation (the likelihood or NDT field, the particle columns)
+ * reach steady-state access cost on the first scan instead of after the working set has been
+ * faulted in, and are never paged out afterwards. Call it from the activation callback, after
+ * declare_common_params(). Failures degrade gracefully with a warning — typically a missing
+ * CAP_IPC_LOCK capability or an insufficient RLIMIT_MEMLOCK.
+ */
+inline void prefault_and_lock_memory(rclcpp_lifecycle::LifecycleNode& node) {
+  if (!node.get_parameter("memory.lock_and_prefault").as_bool()) {
+    return;
+  }
+#ifdef __linux__
+  if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+    RCLCPP_WARN(
+        node.get_logger(),
+        "Could not lock the process memory, missing CAP_IPC_LOCK or insufficient memlock limit?");
+  }
+#else
+  RCLCPP_WARN(node.get_logger(), "Memory locking is only supported on Linux, ignoring memory.lock_and_prefault");
+#endif
+}
+
+/// Applies the configured scheduling class, priority and CPU affinity to the calling thread.
+/**
+ * Reads the `scheduling.*` parameters declared by declare_common_params(). Call it from
+ * the thread running filter updates, before the first update: threads spawned afterwards
+ * (e.g. the workers of the `par` execution policy) inherit the affinity mask, so the
+ * whole update stays on the configured cores. Failures degrade gracefully to the
+ * default scheduling with a warning — typically a missing CAP_SYS_NICE capability.
+ */
+inline void apply_thread_scheduling(rclcpp_lifecycle::LifecycleNode& node) {
+  const auto policy = node.get_parameter("scheduling.policy").as_string();
+  if (policy == "fifo") {
+#ifdef __linux__
+    sched_param scheduling_params{};
+    scheduling_params.sched_priority = static_cast<int>(node.get_parameter("scheduling.priority").as_int());
+    const int error = pthread_setschedparam(pthread_self(), SCHED_FIFO, &scheduling_params);
+    if (error != 0) {
+      RCLCPP_WARN(
+          node.get_logger(), "Could not apply SCHED_FIFO priority %d (error %d), missing CAP_SYS_NICE?",
+          scheduling_params.sched_priority, error);
+    }
+#else
+    RCLCPP_WARN(node.get_logger(), "Real-time scheduling is only supported on Linux, ignoring scheduling.policy");
+#endif
+  } else if (policy != "default") {
+    RCLCPP_WARN(node.get_logger(), "Unknown scheduling.policy '%s', expected 'default' or 'fifo'", policy.c_str());
+  }
+
+  const auto affinity = node.get_parameter("scheduling.cpu_affinity").as_integer_array();
+  if (!affinity.empty()) {
+#ifdef __linux__
+    cpu_set_t cpu_set;
+    CPU_ZERO(&cpu_set);
+    for (const auto cpu : affinity) {
+      CPU_SET(static_cast<std::size_t>(cpu), &cpu_set);
+    }
+    const int error = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set), &cpu_set);
+    if (error != 0) {
+      RCLCPP_WARN(node.get_logger(), "Could not apply the configured CPU affinity (error %d)", error);
+    }
+#else
+    RCLCPP_WARN(node.get_logger(), "CPU affinity is only supported on Linux, ignoring scheduling.cpu_affinity");
+#endif
+  }
+}
+
 }  // namespace beluga_amcl
 #endif
@@ -12,12 +12,15 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <algorithm>
 #include <chrono>
 #include <cstddef>
 #include <execution>
 #include <functional>
 #include <limits>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
 #include <ratio>
 #include <stdexcept>
@@ -34,20 +37,25 @@
 #include <tf2_ros/buffer_interface.h>
 #include <tf2_ros/create_timer_ros.h>
 #include <tf2_ros/message_filter.h>
+#include <tf2_ros/qos.hpp>
 #include <tf2_ros/transform_broadcaster.h>
 #include <tf2_ros/transform_listener.h>
 
 #include <Eigen/Core>
 #include <sophus/se2.hpp>
 
+#include <range/v3/view/span.hpp>
+
 #include <message_filters/subscriber.h>
 #include <bondcpp/bond.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <rclcpp_lifecycle/lifecycle_node.hpp>
 
+#include <diagnostic_msgs/msg/diagnostic_array.hpp>
 #include <geometry_msgs/msg/pose_array.hpp>
 #include <geometry_msgs/msg/pose_with_covariance_stamped.hpp>
 #include <lifecycle_msgs/msg/state.hpp>
+#include <map_msgs/msg/occupancy_grid_update.hpp>
 #include <nav_msgs/msg/occupancy_grid.hpp>
 #include <sensor_msgs/msg/laser_scan.hpp>
 #include <std_srvs/srv/empty.hpp>
@@ -56,7 +64,9 @@
 #include <beluga/motion/omnidirectional_drive_model.hpp>
 #include <beluga/motion/stationary_model.hpp>
 #include <beluga/sensor/beam_model.hpp>
+#include <beluga/sensor/data/likelihood_field_cache.hpp>
 #include <beluga/sensor/likelihood_field_model.hpp>
+#include <beluga/utility/thread_pool.hpp>
 #include <beluga_ros/amcl.hpp>
 #include <beluga_ros/messages.hpp>
 #include <beluga_ros/particle_cloud.hpp>
@@ -88,6 +98,15 @@ AmclNode::AmclNode(const rclcpp::NodeOptions& options) : rclcpp_lifecycle::Lifec
     declare_parameter("laser_model_type", rclcpp::ParameterValue(std::string(kLikelihoodFieldModelName)), descriptor);
   }
 
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Directory where computed likelihood fields are cached across runs, "
+        "keyed by a content hash of the map and the model parameters. "
+        "An empty string disables the cache.";
+    declare_parameter("likelihood_field_cache_path", rclcpp::ParameterValue(std::string{}), descriptor);
+  }
+
   {
     auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
     descriptor.description = "Maximum distance to do obstacle inflation on map, used in likelihood field model.";
@@ -171,6 +190,18 @@ AmclNode::AmclNode(const rclcpp::NodeOptions& options) : rclcpp_lifecycle::Lifec
     declare_parameter("first_map_only", false, descriptor);
   }
 
+  {
+    auto descriptor = rcl_interfaces::msg::ParameterDescriptor();
+    descriptor.description =
+        "Maximum number of particles sampled into published particle cloud and marker messages. "
+        "Zero means no limit.";
+    descriptor.integer_range.resize(1);
+    descriptor.integer_range[0].from_value = 0;
+    descriptor.integer_range[0].to_value = std::numeric_limits<int>::max();
+    descriptor.integer_range[0].step = 1;
+    declare_parameter("max_particle_cloud_size", rclcpp::ParameterValue(0), descriptor);
+  }
+
   if (get_parameter("autostart").as_bool()) {
     auto autostart_delay = std::chrono::duration<double>(get_parameter("autostart_delay").as_double());
     autostart_timer_ = create_wall_timer(autostart_delay, std::bind(&AmclNode::autostart_callback, this));
@@ -206,14 +237,17 @@ AmclNode::CallbackReturn AmclNode::on_configure(const rclcpp_lifecycle::State&)
   particle_markers_pub_ =
       create_publisher<visualization_msgs::msg::MarkerArray>("particle_markers", rclcpp::SystemDefaultsQoS());
   pose_pub_ = create_publisher<geometry_msgs::msg::PoseWithCovarianceStamped>("pose", rclcpp::SystemDefaultsQoS());
+  diagnostics_pub_ = create_publisher<diagnostic_msgs::msg::DiagnosticArray>("/diagnostics", rclcpp::SystemDefaultsQoS());
   return CallbackReturn::SUCCESS;
 }
 
 AmclNode::CallbackReturn AmclNode::on_activate(const rclcpp_lifecycle::State&) {
   RCLCPP_INFO(get_logger(), "Activating");
+  prefault_and_lock_memory(*this);
   particle_cloud_pub_->on_activate();
   particle_markers_pub_->on_activate();
   pose_pub_->on_activate();
+  diagnostics_pub_->on_activate();
 
   {
     bond_ = std::make_unique<bond::Bond>("bond", get_name(), shared_from_this());
@@ -224,21 +258,62 @@ AmclNode::CallbackReturn AmclNode::on_activate(const rclcpp_lifecycle::State&) {
   }
 
   // Accessing the particle filter is not thread safe.
-  // This ensures that different callbacks are not called concurrently.
-  auto common_callback_group = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  // This ensures that the callbacks that do are not called concurrently.
+  common_callback_group_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
   auto common_subscription_options = rclcpp::SubscriptionOptions{};
-  common_subscription_options.callback_group = common_callback_group;
+  common_subscription_options.callback_group = common_callback_group_;
+
+  // Map updates do not touch the particle filter directly: the expensive sensor model
+  // rebuild runs on a background worker and the result is swapped in from the common
+  // group. Keeping the map subscription in its own reentrant group lets a multithreaded
+  // executor keep servicing scans while a map republish is being processed. Under a
+  // single-threaded executor behavior is unchanged.
+  auto map_callback_group = create_callback_group(rclcpp::CallbackGroupType::Reentrant);
+  auto map_subscription_options = rclcpp::SubscriptionOptions{};
+  map_subscription_options.callback_group = map_callback_group;
+
+  // A single worker so replacement filters are built in map arrival order.
+  map_update_worker_ = std::make_unique<beluga::ThreadPool>(1);
+
+  // Scan conversion gets its own mutually exclusive group: one conversion lane
+  // next to the filter lane, so a multithreaded executor converts scan N+1 while
+  // scan N is still updating the filter. Under a single-threaded executor the
+  // stages simply run back to back.
+  conversion_callback_group_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
 
   {
     using namespace std::chrono_literals;
-    timer_ = create_wall_timer(200ms, std::bind(&AmclNode::timer_callback, this), common_callback_group);
+    timer_ = create_wall_timer(200ms, std::bind(&AmclNode::timer_callback, this), common_callback_group_);
+
+    // Diagnostics read the filter profiler, so the timer lives in the common
+    // group where touching the particle filter is safe.
+    diagnostics_timer_ =
+        create_wall_timer(1s, std::bind(&AmclNode::publish_filter_diagnostics, this), common_callback_group_);
+
+    // One-shot trigger for the filter stage; the conversion stage re-arms it
+    // once per staged measurement and it cancels itself after firing.
+    measurement_timer_ = create_wall_timer(
+        0s,
+        [this]() {
+          measurement_timer_->cancel();
+          process_pending_measurement();
+        },
+        common_callback_group_);
+    measurement_timer_->cancel();
   }
 
   {
     map_sub_ = create_subscription<nav_msgs::msg::OccupancyGrid>(
         get_parameter("map_topic").as_string(), rclcpp::QoS(rclcpp::KeepLast(1)).transient_local().reliable(),
-        std::bind(&AmclNode::map_callback, this, std::placeholders::_1), common_subscription_options);
+        std::bind(&AmclNode::map_callback, this, std::placeholders::_1), map_subscription_options);
     RCLCPP_INFO(get_logger(), "Subscribed to map_topic: %s", map_sub_->get_topic_name());
+
+    // Incremental patches are applied inline: their cost is proportional to the
+    // patched area, so they can run in the common group without a worker.
+    map_update_sub_ = create_subscription<map_msgs::msg::OccupancyGridUpdate>(
+        get_parameter("map_topic").as_string() + "_updates", rclcpp::QoS(rclcpp::KeepLast(10)).reliable(),
+        std::bind(&AmclNode::map_update_callback, this, std::placeholders::_1), common_subscription_options);
+    RCLCPP_INFO(get_logger(), "Subscribed to map updates topic: %s", map_update_sub_->get_topic_name());
   }
 
   {
@@ -257,11 +332,21 @@ AmclNode::CallbackReturn AmclNode::on_activate(const rclcpp_lifecycle::State&) {
         *tf_buffer_, this,
         false);  // avoid using dedicated tf thread
 
+    // Take the intra-process path when composed in the same process as the laser
+    // driver: scans are then delivered as shared pointers to the publisher's own
+    // message, which beluga_ros::LaserScan wraps without serialization or copy.
+    // When the publisher lives in another process this falls back to the regular
+    // rmw path. Loaned messages are not an option here because
+    // sensor_msgs/LaserScan contains unbounded sequences.
+    auto laser_subscription_options = common_subscription_options;
+    laser_subscription_options.callback_group = conversion_callback_group_;
+    laser_subscription_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+
     using LaserScanSubscriber =
         message_filters::Subscriber<sensor_msgs::msg::LaserScan, rclcpp_lifecycle::LifecycleNode>;
     laser_scan_sub_ = std::make_unique<LaserScanSubscriber>(
         shared_from_this(), get_parameter("scan_topic").as_string(), rmw_qos_profile_sensor_data,
-        common_subscription_options);
+        laser_subscription_options);
 
     // Message filter that caches laser scan readings until it is possible to transform
     // from laser frame to odom frame and update the particle filter.
@@ -272,6 +357,17 @@ AmclNode::CallbackReturn AmclNode::on_activate(const rclcpp_lifecycle::State&) {
     laser_scan_connection_ =
         laser_scan_filter_->registerCallback(std::bind(&AmclNode::laser_callback, this, std::placeholders::_1));
     RCLCPP_INFO(get_logger(), "Subscribed to scan_topic: %s", laser_scan_sub_->getTopic().c_str());
+
+    // The laser mount is static, so the scan path caches the laser-to-base
+    // composition after the first resolution. Any (re)publication of the static
+    // transforms drops the cache; sharing the conversion callback group makes
+    // the invalidation mutually exclusive with the scan path, so no lock is needed.
+    auto invalidation_options = rclcpp::SubscriptionOptions{};
+    invalidation_options.callback_group = conversion_callback_group_;
+    static_transform_sub_ = create_subscription<tf2_msgs::msg::TFMessage>(
+        "/tf_static", tf2_ros::StaticListenerQoS(),
+        [this](tf2_msgs::msg::TFMessage::ConstSharedPtr) { cached_laser_pose_in_base_.reset(); },
+        invalidation_options);
   }
 
   {
@@ -284,15 +380,23 @@ AmclNode::CallbackReturn AmclNode::on_activate(const rclcpp_lifecycle::State&) {
         std::bind(
             &AmclNode::global_localization_callback, this, std::placeholders::_1, std::placeholders::_2,
             std::placeholders::_3),
-        rmw_qos_profile_services_default, common_callback_group);
+        rmw_qos_profile_services_default, common_callback_group_);
     RCLCPP_INFO(get_logger(), "Created reinitialize_global_localization service");
 
+    relocalization_server_ = create_service<std_srvs::srv::Empty>(
+        "relocalize",
+        std::bind(
+            &AmclNode::relocalization_callback, this, std::placeholders::_1, std::placeholders::_2,
+            std::placeholders::_3),
+        rmw_qos_profile_services_default, common_callback_group_);
+    RCLCPP_INFO(get_logger(), "Created relocalize service");
+
     nomotion_update_server_ = create_service<std_srvs::srv::Empty>(
         "request_nomotion_update",
         std::bind(
             &AmclNode::nomotion_update_callback, this, std::placeholders::_1, std::placeholders::_2,
             std::placeholders::_3),
-        rmw_qos_profile_services_default, common_callback_group);
+        rmw_qos_profile_services_default, common_callback_group_);
     RCLCPP_INFO(get_logger(), "Created request_nomotion_update service");
 
 #pragma GCC diagnostic pop
@@ -306,15 +410,42 @@ AmclNode::CallbackReturn AmclNode::on_deactivate(const rclcpp_lifecycle::State&)
   particle_cloud_pub_->on_deactivate();
   particle_markers_pub_->on_deactivate();
   pose_pub_->on_deactivate();
+  diagnostics_pub_->on_deactivate();
+  diagnostics_timer_.reset();
   map_sub_.reset();
+  map_update_sub_.reset();
   initial_pose_sub_.reset();
   laser_scan_connection_.disconnect();
   laser_scan_filter_.reset();
   laser_scan_sub_.reset();
+  static_transform_sub_.reset();
+  cached_laser_pose_in_base_.reset();
+  measurement_timer_.reset();
+  {
+    const std::lock_guard<std::mutex> lock{pending_measurement_mutex_};
+    pending_measurement_available_ = false;
+  }
   tf_listener_.reset();
   tf_broadcaster_.reset();
   tf_buffer_.reset();
   global_localization_server_.reset();
+  relocalization_server_.reset();
+  // Join the map update worker before tearing the node down, so that no filter
+  // rebuild outlives the entities it uses; then drop any unapplied result.
+  {
+    auto worker = std::unique_ptr<beluga::ThreadPool>{};
+    {
+      const std::lock_guard<std::mutex> lock{pending_filter_mutex_};
+      worker = std::move(map_update_worker_);
+    }
+    worker.reset();
+  }
+  {
+    const std::lock_guard<std::mutex> lock{pending_filter_mutex_};
+    pending_particle_filter_.reset();
+    pending_map_.reset();
+    filter_swap_timer_.reset();
+  }
   bond_.reset();
   return CallbackReturn::SUCCESS;
 }
@@ -324,7 +455,12 @@ AmclNode::CallbackReturn AmclNode::on_cleanup(const rclcpp_lifecycle::State&) {
   particle_cloud_pub_.reset();
   particle_markers_pub_.reset();
   pose_pub_.reset();
+  diagnostics_pub_.reset();
   particle_filter_.reset();
+  particle_filter_exists_ = false;
+  last_known_map_.reset();
+  relocalization_matcher_.reset();
+  latest_estimate_handle_.reset();
   enable_tf_broadcast_ = false;
   return CallbackReturn::SUCCESS;
 }
@@ -401,6 +537,10 @@ auto AmclNode::get_sensor_model(std::string_view name, nav_msgs::msg::OccupancyG
     params.z_hit = get_parameter("z_hit").as_double();
     params.z_random = get_parameter("z_rand").as_double();
     params.sigma_hit = get_parameter("sigma_hit").as_double();
+    const auto cache_path = get_parameter("likelihood_field_cache_path").as_string();
+    if (!cache_path.empty()) {
+      return beluga::make_cached_likelihood_field_model(params, beluga_ros::OccupancyGrid{map}, cache_path);
+    }
     return beluga::LikelihoodFieldModel{params, beluga_ros::OccupancyGrid{map}};
   }
   if (name == kBeamSensorModelName) {
@@ -455,11 +595,6 @@ auto AmclNode::make_particle_filter(nav_msgs::msg::OccupancyGrid::SharedPtr map)
 void AmclNode::map_callback(nav_msgs::msg::OccupancyGrid::SharedPtr map) {
   RCLCPP_INFO(get_logger(), "A new map was received");
 
-  if (particle_filter_ && get_parameter("first_map_only").as_bool()) {
-    RCLCPP_WARN(get_logger(), "Ignoring new map because the particle filter has already been initialized");
-    return;
-  }
-
   const auto global_frame_id = get_parameter("global_frame_id").as_string();
   if (map->header.frame_id != global_frame_id) {
     RCLCPP_WARN_THROTTLE(
@@ -467,20 +602,71 @@ void AmclNode::map_callback(nav_msgs::msg::OccupancyGrid::SharedPtr map) {
         map->header.frame_id.c_str(), global_frame_id.c_str());
   }
 
-  const bool should_reset_initial_pose = get_parameter("always_reset_initial_pose").as_bool() ||  //
-                                         (!particle_filter_ && !last_known_estimate_.has_value());
+  const std::lock_guard<std::mutex> lock{pending_filter_mutex_};
 
-  if (!particle_filter_) {
+  if (get_parameter("first_map_only").as_bool() && (particle_filter_exists_ || pending_particle_filter_)) {
+    RCLCPP_WARN(get_logger(), "Ignoring new map because the particle filter has already been initialized");
+    return;
+  }
+
+  if (!map_update_worker_) {
+    return;  // The node was deactivated while this callback was in flight.
+  }
+
+  // Building the replacement filter rebuilds the sensor model (e.g. the likelihood
+  // field), which can take seconds on large maps, so it runs on the worker instead
+  // of blocking an executor thread. The finished filter is swapped in by the next
+  // callback in the common group; see apply_pending_particle_filter().
+  map_update_worker_->execute([this, map = std::move(map)]() mutable {
+    // Work on a private copy: later patches mutate the stored message in place,
+    // which must not alias a message other in-process subscribers may hold.
+    map = std::make_shared<nav_msgs::msg::OccupancyGrid>(*map);
+    auto filter = std::unique_ptr<beluga_ros::Amcl>{};
     try {
-      particle_filter_ = make_particle_filter(std::move(map));
+      filter = make_particle_filter(map);
     } catch (const std::invalid_argument& error) {
       RCLCPP_ERROR(get_logger(), "Could not initialize particle filter: %s", error.what());
       return;
     }
-  } else {
-    particle_filter_->update_map(beluga_ros::OccupancyGrid{std::move(map)});
+    const std::lock_guard<std::mutex> inner_lock{pending_filter_mutex_};
+    pending_particle_filter_ = std::move(filter);  // if multiple maps queued up, the latest wins
+    pending_map_ = std::move(map);
+    // Arm a one-shot timer in the common group so the swap does not have to wait for
+    // the next scan or the periodic timer; it cancels itself after firing, like the
+    // autostart timer does.
+    using namespace std::chrono_literals;
+    filter_swap_timer_ = create_wall_timer(
+        0s,
+        [this] {
+          filter_swap_timer_->cancel();
+          apply_pending_particle_filter();
+        },
+        common_callback_group_);
+  });
+}
+
+void AmclNode::apply_pending_particle_filter() {
+  auto filter = std::unique_ptr<beluga_ros::Amcl>{};
+  auto map = nav_msgs::msg::OccupancyGrid::SharedPtr{};
+  {
+    const std::lock_guard<std::mutex> lock{pending_filter_mutex_};
+    filter = std::move(pending_particle_filter_);
+    map = std::move(pending_map_);
+  }
+
+  if (!filter) {
+    return;
   }
 
+  const bool had_particle_filter = particle_filter_ != nullptr;
+  particle_filter_ = std::move(filter);
+  last_known_map_ = std::move(map);
+  relocalization_matcher_.reset();  // stale against the new map, rebuilt on demand
+  particle_filter_exists_ = true;
+
+  const bool should_reset_initial_pose = get_parameter("always_reset_initial_pose").as_bool() ||  //
+                                         (!had_particle_filter && !last_known_estimate_.has_value());
+
   if (should_reset_initial_pose) {
     const auto initial_estimate = get_initial_estimate();
     if (initial_estimate.has_value()) {
@@ -500,28 +686,157 @@ void AmclNode::map_callback(nav_msgs::msg::OccupancyGrid::SharedPtr map) {
   enable_tf_broadcast_ = false;
 }
 
+void AmclNode::map_update_callback(map_msgs::msg::OccupancyGridUpdate::SharedPtr message) {
+  apply_pending_particle_filter();
+
+  if (!particle_filter_ || !last_known_map_) {
+    RCLCPP_WARN_THROTTLE(
+        get_logger(), *get_clock(), 2000, "Ignoring map update because no map has been received yet");
+    return;
+  }
+
+  auto& map = *last_known_map_;
+  if (message->header.frame_id != map.header.frame_id) {
+    RCLCPP_WARN_THROTTLE(
+        get_logger(), *get_clock(), 2000, "Map update frame \"%s\" doesn't match map frame \"%s\"",
+        message->header.frame_id.c_str(), map.header.frame_id.c_str());
+  }
+
+  if (message->width == 0U || message->height == 0U) {
+    return;  // Nothing to do.
+  }
+
+  if (message->x < 0 || message->y < 0 ||  //
+      static_cast<std::size_t>(message->x) + message->width > map.info.width ||
+      static_cast<std::size_t>(message->y) + message->height > map.info.height ||
+      message->data.size() != static_cast<std::size_t>(message->width) * message->height) {
+    RCLCPP_ERROR(get_logger(), "Ignoring map update that does not fit within the current map");
+    return;
+  }
+
+  // Patch the stored map in place; the particle filter then refreshes only the
+  // sensor model state the changed region can affect.
+  const auto x_min = static_cast<std::size_t>(message->x);
+  const auto y_min = static_cast<std::size_t>(message->y);
+  for (std::size_t row = 0U; row < message->height; ++row) {
+    const auto* source = &message->data[row * message->width];
+    auto* target = &map.data[(y_min + row) * map.info.width + x_min];
+    std::copy(source, source + message->width, target);
+  }
+
+  const auto changed_region = beluga_ros::Amcl::map_region_type{
+      x_min, y_min, x_min + message->width - 1U, y_min + message->height - 1U};
+
+  relocalization_matcher_.reset();  // stale against the patched map, rebuilt on demand
+
+  const auto update_start_time = std::chrono::high_resolution_clock::now();
+  particle_filter_->update_map(beluga_ros::OccupancyGrid{last_known_map_}, changed_region);
+  const auto update_stop_time = std::chrono::high_resolution_clock::now();
+  const auto update_duration = update_stop_time - update_start_time;
+
+  RCLCPP_INFO(
+      get_logger(), "Applied a %ux%u map update in %.3fms", message->width, message->height,
+      std::chrono::duration<double, std::milli>(update_duration).count());
+}
+
 void AmclNode::timer_callback() {
+  apply_pending_particle_filter();
+
   if (!particle_filter_) {
     return;
   }
 
+  // Materialize the covariance of the latest filter estimate at timer rate
+  // rather than at sensor rate; pose messages published in between carry the
+  // mean of their update and the covariance refreshed here.
+  if (latest_estimate_handle_.has_value() && last_known_estimate_.has_value()) {
+    last_known_estimate_->second = latest_estimate_handle_->covariance();
+  }
+
+  // Visualization messages are sampled down to the configured budget and reuse
+  // member message buffers, so publishing stays cheap regardless of how many
+  // particles the filter is carrying.
+  const auto max_cloud_size = static_cast<std::size_t>(get_parameter("max_particle_cloud_size").as_int());
+
   if (particle_cloud_pub_->get_subscription_count() > 0) {
-    auto message = beluga_ros::msg::PoseArray{};
-    beluga_ros::assign_particle_cloud(particle_filter_->particles(), message);
-    beluga_ros::stamp_message(get_parameter("global_frame_id").as_string(), now(), message);
-    particle_cloud_pub_->publish(message);
+    const auto size = particle_filter_->particles().size();
+    const auto sample_size = max_cloud_size > 0UL ? std::min(size, max_cloud_size) : size;
+    beluga_ros::assign_particle_cloud(particle_filter_->particles(), sample_size, particle_cloud_message_);
+    beluga_ros::stamp_message(get_parameter("global_frame_id").as_string(), now(), particle_cloud_message_);
+    particle_cloud_pub_->publish(particle_cloud_message_);
   }
 
   if (particle_markers_pub_->get_subscription_count() > 0) {
-    auto message = beluga_ros::msg::MarkerArray{};
-    beluga_ros::assign_particle_cloud(particle_filter_->particles(), message);
-    beluga_ros::stamp_message(get_parameter("global_frame_id").as_string(), now(), message);
-    particle_markers_pub_->publish(message);
+    const auto max_samples = max_cloud_size > 0UL ? max_cloud_size : std::numeric_limits<std::size_t>::max();
+    beluga_ros::assign_particle_cloud(particle_filter_->particles(), max_samples, particle_markers_message_);
+    beluga_ros::stamp_message(get_parameter("global_frame_id").as_string(), now(), particle_markers_message_);
+    particle_markers_pub_->publish(particle_markers_message_);
   }
 }
 
+void AmclNode::publish_filter_diagnostics() {
+  if (!particle_filter_ || diagnostics_pub_->get_subscription_count() == 0) {
+    return;
+  }
+
+  auto timing_status = diagnostic_msgs::msg::DiagnosticStatus{};
+  timing_status.name = std::string{get_name()} + ": Filter timing";
+  timing_status.hardware_id = get_name();
+  timing_status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+  timing_status.message = "OK";
+
+  const auto to_milliseconds = [](std::chrono::nanoseconds duration) {
+    return std::to_string(std::chrono::duration<double, std::milli>(duration).count());
+  };
+  for (const auto& [name, aggregate] : particle_filter_->profiler().snapshot()) {
+    auto& count = timing_status.values.emplace_back();
+    count.key = std::string{name} + " count";
+    count.value = std::to_string(aggregate.count);
+    auto& mean = timing_status.values.emplace_back();
+    mean.key = std::string{name} + " mean (ms)";
+    mean.value = to_milliseconds(aggregate.mean);
+    auto& p95 = timing_status.values.emplace_back();
+    p95.key = std::string{name} + " p95 (ms)";
+    p95.value = to_milliseconds(aggregate.p95);
+    auto& max = timing_status.values.emplace_back();
+    max.key = std::string{name} + " max (ms)";
+    max.value = to_milliseconds(aggregate.max);
+  }
+
+  auto weight_status = diagnostic_msgs::msg::DiagnosticStatus{};
+  weight_status.name = std::string{get_name()} + ": Filter weight health";
+  weight_status.hardware_id = get_name();
+  weight_status.level = diagnostic_msgs::msg::DiagnosticStatus::OK;
+  weight_status.message = "OK";
+
+  const auto& statistics = particle_filter_->last_weight_statistics();
+  if (statistics.count > 0 && statistics.histogram.back() > statistics.count / 2) {
+    // Degeneracy onset: most particles carry a vanishing share of the peak weight.
+    weight_status.level = diagnostic_msgs::msg::DiagnosticStatus::WARN;
+    weight_status.message = "Most particles carry a vanishing share of the weight";
+  }
+
+  auto& entropy = weight_status.values.emplace_back();
+  entropy.key = "weight entropy (bits)";
+  entropy.value = std::to_string(statistics.entropy());
+  auto& ratio = weight_status.values.emplace_back();
+  ratio.key = "weight max/min ratio";
+  ratio.value = std::to_string(statistics.max_min_ratio());
+  auto& histogram = weight_status.values.emplace_back();
+  histogram.key = "weight histogram (octaves below peak)";
+  histogram.value = std::accumulate(
+      std::next(statistics.histogram.begin()), statistics.histogram.end(), std::to_string(statistics.histogram.front()),
+      [](std::string partial, std::size_t bucket) { return std::move(partial) + " " + std::to_string(bucket); });
+
+  auto message = diagnostic_msgs::msg::DiagnosticArray{};
+  message.header.stamp = now();
+  message.status.push_back(std::move(timing_status));
+  message.status.push_back(std::move(weight_status));
+  diagnostics_pub_->publish(message);
+}
+
 void AmclNode::laser_callback(sensor_msgs::msg::LaserScan::ConstSharedPtr laser_scan) {
-  if (!particle_filter_) {
+  if (!particle_filter_exists_) {
     RCLCPP_WARN_THROTTLE(
         get_logger(), *get_clock(), 2000, "Ignoring laser data because the particle filter has not been initialized");
     return;
@@ -543,41 +858,105 @@ void AmclNode::laser_callback(sensor_msgs::msg::LaserScan::ConstSharedPtr laser_
     return;
   }
 
-  auto laser_pose_in_base = Sophus::SE3d{};
-  try {
-    tf2::convert(
-        tf_buffer_
-            ->lookupTransform(
-                get_parameter("base_frame_id").as_string(), laser_scan->header.frame_id,
-                tf2_ros::fromMsg(laser_scan->header.stamp))
-            .transform,
-        laser_pose_in_base);
-  } catch (const tf2::TransformException& error) {
-    RCLCPP_ERROR(get_logger(), "Could not transform from base to laser: %s", error.what());
+  // The laser mount is static: resolve the laser-to-base composition once and
+  // reuse it, keeping the second tf2 buffer lookup (and the buffer mutex it
+  // contends on) off the per-scan critical path. A /tf_static publication or a
+  // frame change invalidates the cache.
+  const auto base_frame = get_parameter("base_frame_id").as_string();
+  if (!cached_laser_pose_in_base_ ||
+      cached_laser_pose_frames_ != std::make_pair(base_frame, laser_scan->header.frame_id)) {
+    auto laser_pose_in_base = Sophus::SE3d{};
+    try {
+      tf2::convert(
+          tf_buffer_
+              ->lookupTransform(base_frame, laser_scan->header.frame_id, tf2_ros::fromMsg(laser_scan->header.stamp))
+              .transform,
+          laser_pose_in_base);
+    } catch (const tf2::TransformException& error) {
+      RCLCPP_ERROR(get_logger(), "Could not transform from base to laser: %s", error.what());
+      return;
+    }
+    cached_laser_pose_in_base_ = laser_pose_in_base;
+    cached_laser_pose_frames_ = {base_frame, laser_scan->header.frame_id};
+  }
+
+  // Convert here, off the filter path: by the time the filter stage picks the
+  // measurement up, range filtering, decimation and projection are already paid for.
+  beluga_ros::LaserScan{
+      laser_scan,
+      *cached_laser_pose_in_base_,
+      static_cast<std::size_t>(get_parameter("max_beams").as_int()),
+      get_parameter("laser_min_range").as_double(),
+      get_parameter("laser_max_range").as_double(),
+  }
+      .fill_measurement(conversion_measurement_);
+
+  {
+    const std::lock_guard<std::mutex> lock{pending_measurement_mutex_};
+    if (pending_measurement_available_) {
+      RCLCPP_WARN_THROTTLE(
+          get_logger(), *get_clock(), 2000, "Filter update is falling behind, dropping a stale laser scan");
+    }
+    pending_measurement_.stamp = laser_scan->header.stamp;
+    pending_measurement_.base_pose_in_odom = base_pose_in_odom;
+    // Swapping instead of moving keeps both vector capacities in play.
+    std::swap(pending_measurement_.measurement, conversion_measurement_);
+    pending_measurement_available_ = true;
+  }
+  measurement_timer_->reset();  // schedule the filter stage
+}
+
+void AmclNode::process_pending_measurement() {
+  // Elevate the thread running filter updates once, before the first update;
+  // worker threads spawned from it inherit the configured CPU affinity.
+  if (!scheduling_applied_) {
+    apply_thread_scheduling(*this);
+    scheduling_applied_ = true;
+  }
+
+  apply_pending_particle_filter();
+
+  auto stamp = builtin_interfaces::msg::Time{};
+  auto base_pose_in_odom = Sophus::SE2d{};
+  {
+    const std::lock_guard<std::mutex> lock{pending_measurement_mutex_};
+    if (!pending_measurement_available_) {
+      return;
+    }
+    stamp = pending_measurement_.stamp;
+    base_pose_in_odom = pending_measurement_.base_pose_in_odom;
+    std::swap(filter_measurement_, pending_measurement_.measurement);
+    pending_measurement_available_ = false;
+  }
+
+  if (!particle_filter_) {
+    RCLCPP_WARN_THROTTLE(
+        get_logger(), *get_clock(), 2000, "Ignoring laser data because the particle filter has not been initialized");
     return;
   }
 
   const auto update_start_time = std::chrono::high_resolution_clock::now();
   const auto new_estimate = particle_filter_->update(
       base_pose_in_odom,  //
-      beluga_ros::LaserScan{
-          laser_scan,
-          laser_pose_in_base,
-          static_cast<std::size_t>(get_parameter("max_beams").as_int()),
-          get_parameter("laser_min_range").as_double(),
-          get_parameter("laser_max_range").as_double(),
-      });
+      ranges::make_span(filter_measurement_.data(), static_cast<std::ptrdiff_t>(filter_measurement_.size())));
   const auto update_stop_time = std::chrono::high_resolution_clock::now();
   const auto update_duration = update_stop_time - update_start_time;
 
   if (new_estimate.has_value()) {
-    const auto& [base_pose_in_map, _] = new_estimate.value();
+    const auto& base_pose_in_map = new_estimate->pose();
     last_known_odom_transform_in_map_ = base_pose_in_map * base_pose_in_odom.inverse();
-    last_known_estimate_ = new_estimate;
+    latest_estimate_handle_ = new_estimate;
+    if (last_known_estimate_.has_value()) {
+      // Only the mean is refreshed at sensor rate; the covariance is finished
+      // from the retained statistics on the slower timer (see timer_callback()).
+      last_known_estimate_->first = base_pose_in_map;
+    } else {
+      last_known_estimate_ = std::make_pair(base_pose_in_map, new_estimate->covariance());
+    }
 
     RCLCPP_INFO(
         get_logger(), "Particle filter update iteration stats: %ld particles %ld points - %.3fms",
-        particle_filter_->particles().size(), laser_scan->ranges.size(),
+        particle_filter_->particles().size(), filter_measurement_.size(),
         std::chrono::duration<double, std::milli>(update_duration).count());
   }
 
@@ -591,7 +970,7 @@ void AmclNode::laser_callback(sensor_msgs::msg::LaserScan::ConstSharedPtr laser_
     if (last_known_odom_transform_in_map_.has_value()) {
       auto message = geometry_msgs::msg::TransformStamped{};
       // Sending a transform that is valid into the future so that odom can be used.
-      const auto expiration_stamp = tf2_ros::fromMsg(laser_scan->header.stamp) +
+      const auto expiration_stamp = tf2_ros::fromMsg(stamp) +
                                     tf2::durationFromSec(get_parameter("transform_tolerance").as_double());
       message.header.stamp = tf2_ros::toMsg(expiration_stamp);
       message.header.frame_id = get_parameter("global_frame_id").as_string();
@@ -601,12 +980,13 @@ void AmclNode::laser_callback(sensor_msgs::msg::LaserScan::ConstSharedPtr laser_
     }
   }
 
-  // New pose messages are only published on updates to the filter.
+  // New pose messages are only published on updates to the filter. The mean is
+  // current as of this update; the covariance is the last one materialized.
   if (new_estimate.has_value()) {
     auto message = geometry_msgs::msg::PoseWithCovarianceStamped{};
-    message.header.stamp = laser_scan->header.stamp;
+    message.header.stamp = stamp;
     message.header.frame_id = get_parameter("global_frame_id").as_string();
-    const auto& [base_pose_in_map, base_pose_covariance] = new_estimate.value();
+    const auto& [base_pose_in_map, base_pose_covariance] = last_known_estimate_.value();
     tf2::toMsg(base_pose_in_map, message.pose.pose);
     tf2::covarianceEigenToRowMajor(base_pose_covariance, message.pose.covariance);
     pose_pub_->publish(message);
@@ -640,6 +1020,71 @@ void AmclNode::global_localization_callback(
   initialize_from_map();
 }
 
+void AmclNode::relocalization_callback(
+    [[maybe_unused]] std::shared_ptr<rmw_request_id_t> request_header,
+    [[maybe_unused]] std::shared_ptr<std_srvs::srv::Empty::Request> req,
+    [[maybe_unused]] std::shared_ptr<std_srvs::srv::Empty::Response> res) {
+  if (!particle_filter_ || !last_known_map_) {
+    RCLCPP_WARN(get_logger(), "Ignoring relocalization request because the particle filter has not been initialized");
+    return;
+  }
+
+  if (filter_measurement_.empty()) {
+    RCLCPP_WARN(get_logger(), "Ignoring relocalization request because no laser scan has been processed yet");
+    return;
+  }
+
+  if (!relocalization_matcher_) {
+    const auto build_start_time = std::chrono::high_resolution_clock::now();
+    relocalization_matcher_ = std::make_unique<beluga::BranchAndBoundScanMatcher<beluga_ros::OccupancyGrid>>(
+        beluga_ros::OccupancyGrid{last_known_map_}, beluga::BranchAndBoundSearchParam{});
+    const auto build_stop_time = std::chrono::high_resolution_clock::now();
+    RCLCPP_INFO(
+        get_logger(), "Built relocalization matcher in %.3fms",
+        std::chrono::duration<double, std::milli>(build_stop_time - build_start_time).count());
+  }
+
+  const auto match_start_time = std::chrono::high_resolution_clock::now();
+  const auto candidates = relocalization_matcher_->match(
+      ranges::make_span(filter_measurement_.data(), static_cast<std::ptrdiff_t>(filter_measurement_.size())));
+  const auto match_stop_time = std::chrono::high_resolution_clock::now();
+
+  if (candidates.empty()) {
+    RCLCPP_WARN(get_logger(), "Scan matching found no pose candidates, falling back to a uniform reinitialization");
+    initialize_from_map();
+    return;
+  }
+
+  // Seed the filter with a mixture of normals centered on the candidates, weighted by
+  // their scores. The spreads are on the order of the match resolution cell, loose
+  // enough for the next few updates to settle on the right hypothesis.
+  auto components = std::vector<beluga::MultivariateNormalDistribution<Sophus::SE2d>>{};
+  auto weights = std::vector<double>{};
+  components.reserve(candidates.size());
+  weights.reserve(candidates.size());
+  auto covariance = Eigen::Matrix3d{Eigen::Vector3d{0.05, 0.05, 0.01}.asDiagonal()};
+  for (const auto& candidate : candidates) {
+    components.emplace_back(candidate.pose, covariance);
+    weights.push_back(candidate.score);
+  }
+
+  try {
+    particle_filter_->initialize(beluga::MixtureDistribution{std::move(components), weights});
+  } catch (const std::runtime_error& error) {
+    RCLCPP_ERROR(get_logger(), "Could not initialize particles: %s", error.what());
+    return;
+  }
+
+  latest_estimate_handle_.reset();  // its statistics describe the replaced particle set
+  enable_tf_broadcast_ = true;
+
+  RCLCPP_INFO(
+      get_logger(), "Particle filter initialized with %ld particles about %zu scan match candidates "
+      "(best score %.2f, matched in %.3fms)",
+      particle_filter_->particles().size(), candidates.size(), candidates.front().score,
+      std::chrono::duration<double, std::milli>(match_stop_time - match_start_time).count());
+}
+
 void AmclNode::nomotion_update_callback(
     [[maybe_unused]] std::shared_ptr<rmw_request_id_t> request_header,
     [[maybe_unused]] std::shared_ptr<std_srvs::srv::Empty::Request> req,
@@ -670,6 +1115,7 @@ bool AmclNode::initialize_from_estimate(const std::pair<Sophus::SE2d, Eigen::Mat
     return false;
   }
 
+  latest_estimate_handle_.reset();  // its statistics describe the replaced particle set
   enable_tf_broadcast_ = true;
 
   RCLCPP_INFO(
@@ -688,6 +1134,7 @@ bool AmclNode::initialize_from_map() {
   }
 
   particle_filter_->initialize_from_map();
+  latest_estimate_handle_.reset();  // its statistics describe the replaced particle set
   enable_tf_broadcast_ = true;
 
   RCLCPP_INFO(
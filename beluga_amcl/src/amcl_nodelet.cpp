@@ -15,6 +15,7 @@
 #include <optional>
 
 #include <range/v3/algorithm/transform.hpp>
+#include <range/v3/view/span.hpp>
 
 #include <nodelet/nodelet.h>
 #include <pluginlib/class_list_macros.h>
@@ -50,6 +51,41 @@ constexpr std::string_view kBeamSensorModelName = "beam";
 constexpr std::string_view kAMCLDifferentialModelName = "diff-corrected";
 constexpr std::string_view kAMCLOmnidirectionalModelName = "omni-corrected";
 
+/// Checks whether any field that parameterizes the particle filter itself changed.
+/**
+ * The KLD particle bounds are deliberately left out: they are applied live
+ * through `beluga_ros::Amcl::set_particle_bounds()` without reinitialization.
+ */
+bool filter_config_changed(const beluga_amcl::AmclConfig& lhs, const beluga_amcl::AmclConfig& rhs) {
+  return lhs.update_min_d != rhs.update_min_d ||                          //
+         lhs.update_min_a != rhs.update_min_a ||                          //
+         lhs.resample_interval != rhs.resample_interval ||                //
+         lhs.selective_resampling != rhs.selective_resampling ||          //
+         lhs.recovery_alpha_slow != rhs.recovery_alpha_slow ||            //
+         lhs.recovery_alpha_fast != rhs.recovery_alpha_fast ||            //
+         lhs.kld_err != rhs.kld_err ||                                    //
+         lhs.kld_z != rhs.kld_z ||                                        //
+         lhs.spatial_resolution_x != rhs.spatial_resolution_x ||          //
+         lhs.spatial_resolution_y != rhs.spatial_resolution_y ||          //
+         lhs.spatial_resolution_theta != rhs.spatial_resolution_theta ||  //
+         lhs.odom_model_type != rhs.odom_model_type ||                    //
+         lhs.odom_alpha1 != rhs.odom_alpha1 ||                            //
+         lhs.odom_alpha2 != rhs.odom_alpha2 ||                            //
+         lhs.odom_alpha3 != rhs.odom_alpha3 ||                            //
+         lhs.odom_alpha4 != rhs.odom_alpha4 ||                            //
+         lhs.odom_alpha5 != rhs.odom_alpha5 ||                            //
+         lhs.laser_model_type != rhs.laser_model_type ||                  //
+         lhs.laser_likelihood_max_dist != rhs.laser_likelihood_max_dist ||  //
+         lhs.laser_max_range != rhs.laser_max_range ||                    //
+         lhs.laser_z_hit != rhs.laser_z_hit ||                            //
+         lhs.laser_z_rand != rhs.laser_z_rand ||                          //
+         lhs.laser_z_max != rhs.laser_z_max ||                            //
+         lhs.laser_z_short != rhs.laser_z_short ||                        //
+         lhs.laser_lambda_short != rhs.laser_lambda_short ||              //
+         lhs.laser_sigma_hit != rhs.laser_sigma_hit ||                    //
+         lhs.execution_policy != rhs.execution_policy;
+}
+
 }  // namespace
 
 void AmclNodelet::onInit() {
@@ -129,9 +165,27 @@ void AmclNodelet::config_callback(beluga_amcl::AmclConfig& config, [[maybe_unuse
     config.scan_topic = config_.scan_topic;
   }
 
+  const auto previous_config = config_;
   configured_ = true;
   config_ = config;
 
+  {
+    // Snapshot the values the scan conversion stage reads, since it cannot take
+    // the filter mutex without stalling behind in-flight filter updates.
+    const std::lock_guard<std::mutex> conversion_lock(conversion_mutex_);
+    conversion_config_ = config;
+  }
+
+  if (particle_filter_) {
+    // The KLD particle bounds only parameterize the resampling stage, so they
+    // are applied live, keeping the converged particle set.
+    particle_filter_->set_particle_bounds(
+        static_cast<std::size_t>(config_.min_particles), static_cast<std::size_t>(config_.max_particles));
+    if (!filter_config_changed(previous_config, config_)) {
+      return;
+    }
+  }
+
   if (last_known_estimate_.has_value()) {
     initialize_from_estimate(last_known_estimate_.value());
   }
@@ -388,57 +442,111 @@ void AmclNodelet::particle_cloud_timer_callback(const ros::TimerEvent& ev) {
 }
 
 void AmclNodelet::laser_callback(const sensor_msgs::LaserScan::ConstPtr& laser_scan) {
-  std::lock_guard<std::mutex> lock(mutex_);
-  if (!particle_filter_) {
-    NODELET_WARN_THROTTLE(2, "Ignoring laser data because the particle filter has not been initialized");
-    return;
-  }
+  // First pipeline stage: convert the scan on the arriving callback thread, so
+  // with a multithreaded spinner this conversion overlaps with the filter update
+  // of the previous scan.
+  {
+    auto base_pose_in_odom = Sophus::SE2d{};
+    auto laser_pose_in_base = Sophus::SE3d{};
+    {
+      std::lock_guard<std::mutex> lock(conversion_mutex_);
+      try {
+        // Use the lookupTransform overload with no timeout since we're not using a dedicated
+        // tf thread. The message filter we are using avoids the need for it.
+        tf2::convert(
+            tf_buffer_
+                ->lookupTransform(
+                    conversion_config_.odom_frame_id, conversion_config_.base_frame_id, laser_scan->header.stamp)
+                .transform,
+            base_pose_in_odom);
+      } catch (const tf2::TransformException& error) {
+        NODELET_ERROR("Could not transform from odom to base: %s", error.what());
+        return;
+      }
+
+      try {
+        tf2::convert(
+            tf_buffer_
+                ->lookupTransform(
+                    conversion_config_.base_frame_id, laser_scan->header.frame_id, laser_scan->header.stamp)
+                .transform,
+            laser_pose_in_base);
+      } catch (const tf2::TransformException& error) {
+        NODELET_ERROR("Could not transform from base to laser: %s", error.what());
+        return;
+      }
 
-  auto base_pose_in_odom = Sophus::SE2d{};
-  try {
-    // Use the lookupTransform overload with no timeout since we're not using a dedicated
-    // tf thread. The message filter we are using avoids the need for it.
-    tf2::convert(
-        tf_buffer_->lookupTransform(config_.odom_frame_id, config_.base_frame_id, laser_scan->header.stamp).transform,
-        base_pose_in_odom);
-  } catch (const tf2::TransformException& error) {
-    NODELET_ERROR("Could not transform from odom to base: %s", error.what());
-    return;
+      beluga_ros::LaserScan{
+          laser_scan,
+          laser_pose_in_base,
+          static_cast<std::size_t>(conversion_config_.laser_max_beams),
+          conversion_config_.laser_min_range,
+          conversion_config_.laser_max_range,
+      }
+          .fill_measurement(conversion_measurement_);
+    }
+
+    std::lock_guard<std::mutex> lock(pending_measurement_mutex_);
+    if (pending_measurement_available_) {
+      NODELET_WARN_THROTTLE(2, "Filter update is falling behind, dropping a stale laser scan");
+    }
+    pending_measurement_.stamp = laser_scan->header.stamp;
+    pending_measurement_.base_pose_in_odom = base_pose_in_odom;
+    // Swapping instead of moving keeps both vector capacities in play.
+    std::swap(pending_measurement_.measurement, conversion_measurement_);
+    pending_measurement_available_ = true;  // latest wins
+    if (laser_update_in_progress_) {
+      return;  // the thread already updating will drain the slot when done
+    }
+    laser_update_in_progress_ = true;
+  }
+
+  // Drain the slot until no newer measurement arrived while updating. Scans shed
+  // here never compound latency: the next update simply spans a longer odometry
+  // delta, which the motion model handles through the control window as usual.
+  while (true) {
+    auto stamp = ros::Time{};
+    auto base_pose_in_odom = Sophus::SE2d{};
+    {
+      std::lock_guard<std::mutex> lock(pending_measurement_mutex_);
+      if (!pending_measurement_available_) {
+        laser_update_in_progress_ = false;
+        return;
+      }
+      stamp = pending_measurement_.stamp;
+      base_pose_in_odom = pending_measurement_.base_pose_in_odom;
+      std::swap(filter_measurement_, pending_measurement_.measurement);
+      pending_measurement_available_ = false;
+    }
+    laser_update(stamp, base_pose_in_odom);
   }
+}
 
-  auto laser_pose_in_base = Sophus::SE3d{};
-  try {
-    tf2::convert(
-        tf_buffer_->lookupTransform(config_.base_frame_id, laser_scan->header.frame_id, laser_scan->header.stamp)
-            .transform,
-        laser_pose_in_base);
-  } catch (const tf2::TransformException& error) {
-    NODELET_ERROR("Could not transform from base to laser: %s", error.what());
+void AmclNodelet::laser_update(const ros::Time& stamp, const Sophus::SE2d& base_pose_in_odom) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (!particle_filter_) {
+    NODELET_WARN_THROTTLE(2, "Ignoring laser data because the particle filter has not been initialized");
     return;
   }
 
   const auto update_start_time = std::chrono::high_resolution_clock::now();
   const auto new_estimate = particle_filter_->update(
       base_pose_in_odom,  //
-      beluga_ros::LaserScan{
-          laser_scan,
-          laser_pose_in_base,
-          static_cast<std::size_t>(config_.laser_max_beams),
-          config_.laser_min_range,
-          config_.laser_max_range,
-      });
+      ranges::make_span(filter_measurement_.data(), static_cast<std::ptrdiff_t>(filter_measurement_.size())));
   const auto update_stop_time = std::chrono::high_resolution_clock::now();
   const auto update_duration = update_stop_time - update_start_time;
 
   if (new_estimate.has_value()) {
-    const auto& [base_pose_in_map, _] = new_estimate.value();
+    const auto& base_pose_in_map = new_estimate->pose();
     last_known_odom_transform_in_map_ = base_pose_in_map * base_pose_in_odom.inverse();
-    last_known_estimate_ = new_estimate;
+    // The nodelet publishes pose and covariance together on every update, so the
+    // covariance is materialized right away.
+    last_known_estimate_ = std::pair<Sophus::SE2d, Eigen::Matrix3d>{*new_estimate};
 
     NODELET_INFO(
         "Particle filter update iteration stats: %ld particles %ld points - %.3fms",
         particle_filter_->particles().size(),  //
-        laser_scan->ranges.size(),             //
+        filter_measurement_.size(),            //
         std::chrono::duration<double, std::milli>(update_duration).count());
   }
 
@@ -452,7 +560,7 @@ void AmclNodelet::laser_callback(const sensor_msgs::LaserScan::ConstPtr& laser_s
   // New pose messages are only published on updates to the filter.
   if (new_estimate.has_value()) {
     auto message = geometry_msgs::PoseWithCovarianceStamped{};
-    message.header.stamp = laser_scan->header.stamp;
+    message.header.stamp = stamp;
     message.header.frame_id = config_.global_frame_id;
     tf2::toMsg(base_pose_in_map, message.pose.pose);
     tf2::covarianceEigenToRowMajor(base_pose_covariance, message.pose.covariance);
@@ -17,6 +17,7 @@
 #include <execution>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <string>
@@ -60,6 +61,7 @@
 #include <beluga/motion/stationary_model.hpp>
 #include <beluga/random/multivariate_normal_distribution.hpp>
 #include <beluga/sensor/ndt_sensor_model.hpp>
+#include <beluga/utility/thread_pool.hpp>
 #include <beluga/views/particles.hpp>
 #include <beluga_ros/messages.hpp>
 #include <beluga_ros/particle_cloud.hpp>
@@ -142,7 +144,7 @@ NdtAmclNode::CallbackReturn NdtAmclNode::on_configure(const rclcpp_lifecycle::St
 
 NdtAmclNode::CallbackReturn NdtAmclNode::on_activate(const rclcpp_lifecycle::State&) {
   RCLCPP_INFO(get_logger(), "Activating");
-  particle_filter_ = make_particle_filter();
+  prefault_and_lock_memory(*this);
   particle_cloud_pub_->on_activate();
   pose_pub_->on_activate();
 
@@ -155,15 +157,48 @@ NdtAmclNode::CallbackReturn NdtAmclNode::on_activate(const rclcpp_lifecycle::Sta
   }
 
   // Accessing the particle filter is not thread safe.
-  // This ensures that different callbacks are not called concurrently.
-  auto common_callback_group = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  // This ensures that the callbacks that do are not called concurrently.
+  common_callback_group_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
   auto common_subscription_options = rclcpp::SubscriptionOptions{};
-  common_subscription_options.callback_group = common_callback_group;
+  common_subscription_options.callback_group = common_callback_group_;
+
+  // Parsing the map file and building the NDT model can take several seconds, so it
+  // runs on a background worker instead of blocking the lifecycle transition. The
+  // node keeps localizing with the previously built filter (if any) until the
+  // replacement is swapped in; see apply_pending_particle_filter().
+  map_update_worker_ = std::make_unique<beluga::ThreadPool>(1);
+  map_update_worker_->execute([this] {
+    const auto start_time = std::chrono::high_resolution_clock::now();
+    auto filter = std::unique_ptr<NdtAmclVariant>{};
+    try {
+      filter = make_particle_filter();
+    } catch (const std::exception& error) {
+      RCLCPP_ERROR(get_logger(), "Could not initialize particle filter: %s", error.what());
+      return;
+    }
+    const auto duration = std::chrono::high_resolution_clock::now() - start_time;
+    RCLCPP_INFO(
+        get_logger(), "NDT map loaded and particle filter built in %.3fs",
+        std::chrono::duration<double>(duration).count());
+    const std::lock_guard<std::mutex> lock{pending_filter_mutex_};
+    pending_particle_filter_ = std::move(filter);
+    // Arm a one-shot timer in the common group so the swap does not have to wait for
+    // the next scan or the periodic timer; it cancels itself after firing, like the
+    // autostart timer does.
+    using namespace std::chrono_literals;
+    filter_swap_timer_ = create_wall_timer(
+        0s,
+        [this] {
+          filter_swap_timer_->cancel();
+          apply_pending_particle_filter();
+        },
+        common_callback_group_);
+  });
 
   {
     using namespace std::chrono_literals;
     // TODO(alon): create a parameter for the timer rate?
-    timer_ = create_wall_timer(200ms, std::bind(&NdtAmclNode::timer_callback, this), common_callback_group);
+    timer_ = create_wall_timer(200ms, std::bind(&NdtAmclNode::timer_callback, this), common_callback_group_);
   }
 
   {
@@ -202,7 +237,11 @@ NdtAmclNode::CallbackReturn NdtAmclNode::on_activate(const rclcpp_lifecycle::Sta
     if (initial_estimate.has_value()) {
       last_known_estimate_ = initial_estimate;
       last_known_odom_transform_in_map_.reset();
-      initialize_from_estimate(initial_estimate.value());
+      if (particle_filter_) {
+        initialize_from_estimate(initial_estimate.value());
+      }
+      // With no previous filter, initialization happens when the map finishes
+      // loading and the replacement filter is swapped in.
     }
   }
   return CallbackReturn::SUCCESS;
@@ -219,6 +258,21 @@ NdtAmclNode::CallbackReturn NdtAmclNode::on_deactivate(const rclcpp_lifecycle::S
   tf_listener_.reset();
   tf_broadcaster_.reset();
   tf_buffer_.reset();
+  // Join the map loading worker before tearing the node down, so that no build
+  // outlives the entities it uses; then drop any unapplied result.
+  {
+    auto worker = std::unique_ptr<beluga::ThreadPool>{};
+    {
+      const std::lock_guard<std::mutex> lock{pending_filter_mutex_};
+      worker = std::move(map_update_worker_);
+    }
+    worker.reset();
+  }
+  {
+    const std::lock_guard<std::mutex> lock{pending_filter_mutex_};
+    pending_particle_filter_.reset();
+    filter_swap_timer_.reset();
+  }
   bond_.reset();
   return CallbackReturn::SUCCESS;
 }
@@ -359,7 +413,27 @@ auto NdtAmclNode::make_particle_filter() const -> std::unique_ptr<NdtAmclVariant
   return std::make_unique<NdtAmclVariant>(std::move(amcl));
 }
 
+void NdtAmclNode::apply_pending_particle_filter() {
+  auto filter = std::unique_ptr<NdtAmclVariant>{};
+  {
+    const std::lock_guard<std::mutex> lock{pending_filter_mutex_};
+    filter = std::move(pending_particle_filter_);
+  }
+
+  if (!filter) {
+    return;
+  }
+
+  particle_filter_ = std::move(filter);
+
+  if (last_known_estimate_.has_value()) {
+    initialize_from_estimate(last_known_estimate_.value());
+  }
+}
+
 void NdtAmclNode::timer_callback() {
+  apply_pending_particle_filter();
+
   if (!particle_filter_) {
     return;
   }
@@ -380,6 +454,15 @@ void NdtAmclNode::timer_callback() {
 // TODO(alon): Wouldn't it be better in the callback of each message to simply receive
 // it and define another timer or thread to do the work of calculation and publication?
 void NdtAmclNode::laser_callback(sensor_msgs::msg::LaserScan::ConstSharedPtr laser_scan) {
+  // Elevate the thread running filter updates once, before the first update;
+  // worker threads spawned from it inherit the configured CPU affinity.
+  if (!scheduling_applied_) {
+    apply_thread_scheduling(*this);
+    scheduling_applied_ = true;
+  }
+
+  apply_pending_particle_filter();
+
   if (!particle_filter_ || !last_known_estimate_.has_value()) {
     RCLCPP_WARN_THROTTLE(
         get_logger(), *get_clock(), 2000, "Ignoring laser data because the particle filter has not been initialized");
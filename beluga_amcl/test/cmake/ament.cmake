@@ -31,3 +31,6 @@ target_include_directories(test_ndt_amcl_node
                            PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/test_utils)
 target_compile_options(test_ndt_amcl_node PRIVATE -Wno-deprecated-copy)
 target_link_libraries(test_ndt_amcl_node ndt_amcl_node_component)
+# The shared tester node publishes map patches; the NDT component itself does not
+# depend on them.
+ament_target_dependencies(test_ndt_amcl_node map_msgs)
@@ -236,6 +236,37 @@ TEST_F(TestNode, MapWithWrongFrame) {
   ASSERT_TRUE(wait_for_initialization());
 }
 
+TEST_F(TestNode, MapUpdatePatch) {
+  amcl_node_->configure();
+  amcl_node_->activate();
+  tester_node_->publish_map();
+  ASSERT_TRUE(wait_for_initialization());
+  const auto particle_count = amcl_node_->particle_filter()->particles().size();
+  tester_node_->publish_map_update();
+  spin_for(50ms, tester_node_, amcl_node_);
+  // A patch refreshes the sensor model in place without reinitializing the filter.
+  ASSERT_TRUE(amcl_node_->is_initialized());
+  ASSERT_EQ(amcl_node_->particle_filter()->particles().size(), particle_count);
+}
+
+TEST_F(TestNode, MapUpdateBeforeMap) {
+  amcl_node_->configure();
+  amcl_node_->activate();
+  tester_node_->publish_map_update();
+  spin_for(50ms, tester_node_, amcl_node_);
+  ASSERT_FALSE(amcl_node_->is_initialized());
+}
+
+TEST_F(TestNode, MapUpdateOutOfBounds) {
+  amcl_node_->configure();
+  amcl_node_->activate();
+  tester_node_->publish_map();
+  ASSERT_TRUE(wait_for_initialization());
+  tester_node_->publish_map_update_out_of_bounds();
+  spin_for(50ms, tester_node_, amcl_node_);
+  ASSERT_TRUE(amcl_node_->is_initialized());
+}
+
 TEST_F(TestNode, SetInitialPose) {
   amcl_node_->set_parameter(rclcpp::Parameter{"set_initial_pose", true});
   amcl_node_->set_parameter(rclcpp::Parameter{"initial_pose.x", 34.0});
@@ -30,6 +30,7 @@
 #include <geometry_msgs/msg/pose_stamped.hpp>
 #include <geometry_msgs/msg/pose_with_covariance_stamped.hpp>
 #include <lifecycle_msgs/msg/state.hpp>
+#include <map_msgs/msg/occupancy_grid_update.hpp>
 #include <nav_msgs/msg/occupancy_grid.hpp>
 #include <sensor_msgs/msg/laser_scan.hpp>
 #include <std_srvs/srv/empty.hpp>
@@ -46,6 +47,9 @@ class TesterNode : public rclcpp::Node {
   TesterNode() : rclcpp::Node{"tester_node", "", rclcpp::NodeOptions()} {
     map_publisher_ = create_publisher<nav_msgs::msg::OccupancyGrid>("map", rclcpp::SystemDefaultsQoS());
 
+    map_updates_publisher_ =
+        create_publisher<map_msgs::msg::OccupancyGridUpdate>("map_updates", rclcpp::SystemDefaultsQoS());
+
     initial_pose_publisher_ =
         create_publisher<geometry_msgs::msg::PoseWithCovarianceStamped>("initialpose", rclcpp::SystemDefaultsQoS());
 
@@ -117,6 +121,28 @@ class TesterNode : public rclcpp::Node {
     map_publisher_->publish(map);
   }
 
+  void publish_map_update() {
+    auto update = map_msgs::msg::OccupancyGridUpdate{};
+    update.header.frame_id = "map";
+    update.x = 0;
+    update.y = 0;
+    update.width = 1;
+    update.height = 1;
+    update.data = std::vector<std::int8_t>{100};
+    map_updates_publisher_->publish(update);
+  }
+
+  void publish_map_update_out_of_bounds() {
+    auto update = map_msgs::msg::OccupancyGridUpdate{};
+    update.header.frame_id = "map";
+    update.x = 10;
+    update.y = 10;
+    update.width = 5;
+    update.height = 5;
+    update.data = std::vector<std::int8_t>(5 * 5, 100);
+    map_updates_publisher_->publish(update);
+  }
+
   void publish_default_initial_pose() {
     auto pose = geometry_msgs::msg::PoseWithCovarianceStamped{};
     pose.header.frame_id = "map";
@@ -240,6 +266,7 @@ class TesterNode : public rclcpp::Node {
   using PublisherPtr = std::shared_ptr<rclcpp::Publisher<Message>>;
 
   PublisherPtr<nav_msgs::msg::OccupancyGrid> map_publisher_;
+  PublisherPtr<map_msgs::msg::OccupancyGridUpdate> map_updates_publisher_;
   PublisherPtr<geometry_msgs::msg::PoseWithCovarianceStamped> initial_pose_publisher_;
   PublisherPtr<sensor_msgs::msg::LaserScan> laser_scan_publisher_;
 
@@ -0,0 +1,379 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * \file
+ * \brief Offline multi-bag evaluation engine.
+ *
+ * Feeds recorded measurement/odometry sequences straight into `beluga_ros::Amcl`
+ * without executors, timers or message serialization in between, so bags replay
+ * at CPU-bound speed. Every run — one per bag and parameter combination — is
+ * dispatched to a pool of forked worker processes and reports its metrics
+ * (latency distribution, particle counts and pose error against the recorded
+ * ground truth) as one CSV row on standard output, ready for the analysis
+ * scripts in this package.
+ *
+ * Example:
+ *
+ *     evaluate_bags --workers 8 --sensor-models likelihood,beam \
+ *         --max-particles 2000,5000 path/to/bag [path/to/other/bag ...]
+ */
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <tf2/convert.h>
+
+#include <Eigen/Core>
+#include <sophus/se2.hpp>
+#include <sophus/se3.hpp>
+
+#include <range/v3/view/generate_n.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
+
+#include <beluga/motion/differential_drive_model.hpp>
+#include <beluga/random/multivariate_normal_distribution.hpp>
+#include <beluga/sensor/beam_model.hpp>
+#include <beluga/sensor/likelihood_field_model.hpp>
+
+#include <beluga_ros/amcl.hpp>
+#include <beluga_ros/laser_scan.hpp>
+#include <beluga_ros/occupancy_grid.hpp>
+#include <beluga_ros/tf2_sophus.hpp>
+
+#include <rosbag2_storage/storage_filter.hpp>
+
+#include <nav_msgs/msg/occupancy_grid.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+#include <rosbag2_cpp/reader.hpp>
+#include <sensor_msgs/msg/laser_scan.hpp>
+
+namespace {
+
+constexpr std::string_view kMapTopic = "/map";
+constexpr std::string_view kScanTopic = "/scan";
+constexpr std::string_view kOdomTopic = "/odometry/ground_truth";
+
+/// Read messages from a specific topic in a ROS bag.
+template <typename Message>
+auto read_messages(const std::filesystem::path& bagfile, std::string_view topic) {
+  auto reader = std::make_shared<rosbag2_cpp::Reader>();  // wrapped in a shared pointer to make it copyable :)
+  reader->open(bagfile.native());
+
+  auto filter = rosbag2_storage::StorageFilter{};
+  filter.topics.emplace_back(topic);
+  reader->set_filter(filter);
+
+  std::size_t size = 0UL;
+  for (const auto& [topic_metadata, message_count] : reader->get_metadata().topics_with_message_count) {
+    if (topic_metadata.name == topic) {
+      size = message_count;
+      break;
+    }
+  }
+
+  return ranges::views::generate_n([reader]() mutable { return reader->read_next<Message>(); }, size);
+}
+
+/// Returns the given percentile of the recorded latencies.
+auto percentile(std::vector<std::chrono::nanoseconds> latencies, double fraction) {
+  const auto rank = static_cast<std::ptrdiff_t>(fraction * static_cast<double>(latencies.size() - 1));
+  std::nth_element(latencies.begin(), latencies.begin() + rank, latencies.end());
+  return latencies[static_cast<std::size_t>(rank)];
+}
+
+/// One evaluation run: a bag replayed under one parameter combination.
+struct RunConfig {
+  std::string bag;
+  std::string sensor_model;
+  std::size_t max_particles;
+};
+
+/// Tool options parsed from the command line.
+struct Options {
+  std::size_t workers = std::max(1U, std::thread::hardware_concurrency());
+  std::vector<std::string> sensor_models = {"likelihood"};
+  std::vector<std::size_t> max_particles = {2000UL};
+  std::vector<std::string> bags;
+};
+
+std::vector<std::string> split(const std::string& values) {
+  auto result = std::vector<std::string>{};
+  auto stream = std::istringstream{values};
+  for (std::string token; std::getline(stream, token, ',');) {
+    result.push_back(token);
+  }
+  return result;
+}
+
+[[noreturn]] void usage_error(const std::string& message) {
+  std::cerr << message << "\n"
+            << "usage: evaluate_bags [--workers N] [--sensor-models likelihood,beam]\n"
+            << "                     [--max-particles N[,N...]] BAG [BAG...]\n";
+  std::exit(EXIT_FAILURE);
+}
+
+Options parse_options(int argc, char** argv) {
+  auto options = Options{};
+  for (int i = 1; i < argc; ++i) {
+    const auto argument = std::string{argv[i]};
+    const auto next = [&]() -> std::string {
+      if (++i >= argc) {
+        usage_error("Missing value for " + argument);
+      }
+      return argv[i];
+    };
+    if (argument == "--workers") {
+      options.workers = std::stoul(next());
+    } else if (argument == "--sensor-models") {
+      options.sensor_models = split(next());
+    } else if (argument == "--max-particles") {
+      options.max_particles.clear();
+      for (const auto& value : split(next())) {
+        options.max_particles.push_back(std::stoul(value));
+      }
+    } else if (!argument.empty() && argument.front() == '-') {
+      usage_error("Unknown option " + argument);
+    } else {
+      options.bags.push_back(argument);
+    }
+  }
+  if (options.bags.empty()) {
+    usage_error("No bags given");
+  }
+  if (options.workers == 0) {
+    usage_error("--workers must be positive");
+  }
+  for (const auto& name : options.sensor_models) {
+    if (name != "likelihood" && name != "beam") {
+      usage_error("Unknown sensor model " + name);
+    }
+  }
+  return options;
+}
+
+beluga_ros::Amcl::sensor_model_variant make_sensor_model(
+    const std::string& name,
+    const beluga_ros::OccupancyGrid& map) {
+  if (name == "beam") {
+    auto params = beluga::BeamModelParam{};
+    params.beam_max_range = 100.0;
+    return beluga::BeamSensorModel{params, map};
+  }
+  auto params = beluga::LikelihoodFieldModelParam{};
+  params.max_obstacle_distance = 2.0;
+  params.max_laser_distance = 100.0;
+  params.z_hit = 0.5;
+  params.z_random = 0.5;
+  params.sigma_hit = 0.2;
+  return beluga::LikelihoodFieldModel{params, map};
+}
+
+/// Replays one bag through one filter configuration and returns the CSV row.
+std::string evaluate(const RunConfig& config) {
+  auto maps = read_messages<nav_msgs::msg::OccupancyGrid>(config.bag, kMapTopic);
+  if (maps.size() != 1) {
+    throw std::runtime_error{"Expected exactly one map message in " + config.bag};
+  }
+  auto map = beluga_ros::OccupancyGrid{std::make_shared<nav_msgs::msg::OccupancyGrid>(*maps.begin())};
+
+  auto scan_to_measurement = ranges::views::transform([](sensor_msgs::msg::LaserScan msg) {
+    const auto laser_transform = Sophus::SE3d{Eigen::Quaterniond{1., 0., 0., 0.}, Eigen::Vector3d{0.28, 0., 0.}};
+    return beluga_ros::LaserScan{
+        std::make_shared<sensor_msgs::msg::LaserScan>(msg),
+        laser_transform,
+        60,    // max beam count
+        0.,    // range min
+        100.,  // range max
+    };
+  });
+
+  auto odometry_to_sophus = ranges::views::transform([](const nav_msgs::msg::Odometry& message) {
+    Sophus::SE2d out;
+    tf2::convert(message.pose.pose, out);
+    return out;
+  });
+
+  auto odometry = read_messages<nav_msgs::msg::Odometry>(config.bag, kOdomTopic) | odometry_to_sophus;
+  auto measurements = read_messages<sensor_msgs::msg::LaserScan>(config.bag, kScanTopic) | scan_to_measurement;
+  if (odometry.size() != measurements.size()) {
+    throw std::runtime_error{"Mismatched odometry and scan message counts in " + config.bag};
+  }
+
+  auto motion_params = beluga::DifferentialDriveModelParam{};
+  motion_params.rotation_noise_from_rotation = 0.2;
+  motion_params.rotation_noise_from_translation = 0.2;
+  motion_params.translation_noise_from_translation = 0.2;
+  motion_params.translation_noise_from_rotation = 0.2;
+
+  auto params = beluga_ros::AmclParams{};
+  params.max_particles = config.max_particles;
+
+  auto filter = beluga_ros::Amcl{
+      map,
+      beluga::DifferentialDriveModel{motion_params},
+      make_sensor_model(config.sensor_model, map),
+      params,
+      std::execution::par};
+
+  bool initialized = false;
+  auto latencies = std::vector<std::chrono::nanoseconds>{};
+  std::size_t particle_count_sum = 0;
+  double error_sum = 0.0;
+  double max_error = 0.0;
+
+  const auto wall_start = std::chrono::steady_clock::now();
+  for (auto [measurement, odom] : ranges::views::zip(measurements, odometry)) {
+    if (!initialized) {
+      // Seed around the first ground truth pose, as a deployed system would
+      // around an operator-provided initial pose.
+      filter.initialize(
+          odom, Eigen::Matrix3d{{0.125, 0.0, 0.0}, {0.0, 0.125, 0.0}, {0.0, 0.0, 0.04}});
+      initialized = true;
+    }
+    const auto start = std::chrono::steady_clock::now();
+    const auto estimate = filter.update(odom, std::move(measurement));
+    const auto stop = std::chrono::steady_clock::now();
+    if (!estimate.has_value()) {
+      continue;  // Skipped by the update policy; no filter cycle ran.
+    }
+    latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start));
+    particle_count_sum += filter.particles().size();
+    const double error = (estimate->pose().translation() - odom.translation()).norm();
+    error_sum += error;
+    max_error = std::max(max_error, error);
+  }
+  const auto wall_stop = std::chrono::steady_clock::now();
+
+  if (latencies.size() < 2UL) {
+    throw std::runtime_error{"Less than 2 filter updates replaying " + config.bag};
+  }
+
+  const auto updates = static_cast<double>(latencies.size());
+  auto row = std::ostringstream{};
+  row << config.bag << ',' << config.sensor_model << ',' << config.max_particles << ','  //
+      << latencies.size() << ','                                                         //
+      << std::chrono::duration<double, std::milli>(percentile(latencies, 0.50)).count() << ','
+      << std::chrono::duration<double, std::milli>(percentile(latencies, 0.99)).count() << ','
+      << static_cast<double>(particle_count_sum) / updates << ','  //
+      << error_sum / updates << ',' << max_error << ','            //
+      << std::chrono::duration<double>(wall_stop - wall_start).count();
+  return row.str();
+}
+
+/// Runs one configuration in a forked child, reporting its CSV row over a pipe.
+pid_t spawn(const RunConfig& config, int* read_fd) {
+  int fds[2];
+  if (pipe(fds) != 0) {
+    throw std::runtime_error{"Failed to create a pipe"};
+  }
+  const pid_t pid = fork();
+  if (pid < 0) {
+    throw std::runtime_error{"Failed to fork a worker"};
+  }
+  if (pid == 0) {
+    close(fds[0]);
+    int status = EXIT_SUCCESS;
+    try {
+      const auto row = evaluate(config) + "\n";
+      if (write(fds[1], row.data(), row.size()) != static_cast<ssize_t>(row.size())) {
+        status = EXIT_FAILURE;
+      }
+    } catch (const std::exception& error) {
+      const auto message = std::string{error.what()} + "\n";
+      static_cast<void>(write(STDERR_FILENO, message.data(), message.size()));
+      status = EXIT_FAILURE;
+    }
+    close(fds[1]);
+    _exit(status);
+  }
+  close(fds[1]);
+  *read_fd = fds[0];
+  return pid;
+}
+
+/// Reads whatever the worker wrote before exiting.
+std::string drain(int fd) {
+  auto contents = std::string{};
+  char buffer[4096];
+  for (ssize_t count = read(fd, buffer, sizeof(buffer)); count > 0; count = read(fd, buffer, sizeof(buffer))) {
+    contents.append(buffer, static_cast<std::size_t>(count));
+  }
+  close(fd);
+  return contents;
+}
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  const auto options = parse_options(argc, argv);
+
+  auto runs = std::vector<RunConfig>{};
+  for (const auto& bag : options.bags) {
+    for (const auto& sensor_model : options.sensor_models) {
+      for (const auto max_particles : options.max_particles) {
+        runs.push_back(RunConfig{bag, sensor_model, max_particles});
+      }
+    }
+  }
+
+  std::cout << "bag,sensor_model,max_particles,updates,p50_ms,p99_ms,"
+            << "mean_particles,mean_error_m,max_error_m,wall_s" << std::endl;
+
+  auto active = std::map<pid_t, int>{};  // worker pid to pipe read end
+  std::size_t next = 0;
+  int failures = 0;
+  while (next < runs.size() || !active.empty()) {
+    while (active.size() < options.workers && next < runs.size()) {
+      int read_fd = -1;
+      const pid_t pid = spawn(runs[next], &read_fd);
+      active.emplace(pid, read_fd);
+      ++next;
+    }
+    int status = 0;
+    const pid_t pid = waitpid(-1, &status, 0);
+    if (pid < 0) {
+      break;
+    }
+    const auto it = active.find(pid);
+    if (it == active.end()) {
+      continue;
+    }
+    const auto row = drain(it->second);
+    active.erase(it);
+    if (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS) {
+      std::cout << row << std::flush;
+    } else {
+      ++failures;
+    }
+  }
+  return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
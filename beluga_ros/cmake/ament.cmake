@@ -38,6 +38,11 @@ target_include_directories(
   beluga_ros INTERFACE $<BUILD_INTERFACE:${CMAKE_CURRENT_SOURCE_DIR}/include>
                        $<INSTALL_INTERFACE:include/${PROJECT_NAME}>)
 target_link_libraries(beluga_ros INTERFACE beluga::beluga)
+if(UNIX AND NOT APPLE)
+  # shm_open and friends, used by the shared-memory particle mirror, live in
+  # librt on glibc older than 2.34.
+  target_link_libraries(beluga_ros INTERFACE rt)
+endif()
 ament_target_dependencies(
   beluga_ros
   INTERFACE geometry_msgs
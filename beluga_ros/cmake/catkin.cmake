@@ -46,6 +46,11 @@ target_include_directories(
             $<INSTALL_INTERFACE:include/${PROJECT_NAME}>)
 target_link_libraries(${PROJECT_NAME} INTERFACE beluga::beluga
                                                 ${catkin_LIBRARIES})
+if(UNIX AND NOT APPLE)
+  # shm_open and friends, used by the shared-memory particle mirror, live in
+  # librt on glibc older than 2.34.
+  target_link_libraries(${PROJECT_NAME} INTERFACE rt)
+endif()
 target_compile_definitions(${PROJECT_NAME} INTERFACE BELUGA_ROS_VERSION=1)
 target_compile_features(${PROJECT_NAME} INTERFACE cxx_std_17)
 
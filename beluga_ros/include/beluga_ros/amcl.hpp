@@ -15,14 +15,24 @@
 #ifndef BELUGA_ROS_AMCL_HPP
 #define BELUGA_ROS_AMCL_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <functional>
+#include <memory>
 #include <optional>
+#include <stdexcept>
+#include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 #include <beluga/beluga.hpp>
+#include <beluga/utility/scoped_profiler.hpp>
+#include <beluga/utility/thread_pool.hpp>
 #include <beluga_ros/laser_scan.hpp>
 #include <beluga_ros/occupancy_grid.hpp>
 
+#include <range/v3/view/span.hpp>
 #include <range/v3/view/take_exactly.hpp>
 
 /**
@@ -90,6 +100,9 @@ class Amcl {
   /// Weighted SE(2) state particle type.
   using particle_type = std::tuple<Sophus::SE2d, beluga::Weight>;
 
+  /// Pose estimate handle type returned by update(); see beluga::LazyEstimate.
+  using estimation_type = beluga::LazyEstimate<double>;
+
   /// Motion model variant type for runtime selection support.
   using motion_model_variant = std::variant<
       beluga::DifferentialDriveModel,     //
@@ -130,27 +143,44 @@ class Amcl {
     if (params_.selective_resampling) {
       resample_policy_ = resample_policy_ && beluga::policies::on_effective_size_drop;
     }
+    // The initially configured map holds bank index 0; its state lives in the
+    // active members, so its bank slot stays empty.
+    map_bank_.push_back(std::nullopt);
+    bind_pipeline();
   }
 
   /// Returns a reference to the current set of particles.
   [[nodiscard]] const auto& particles() const { return particles_; }
 
   /// Initialize particles using a custom distribution.
+  /**
+   * The existing particle columns are overwritten in place, so repeated
+   * reinitializations (e.g. operator-triggered pose re-seeding) reuse the
+   * storage already sized for `max_particles` instead of reallocating it.
+   */
   template <class Distribution>
   void initialize(Distribution distribution) {
-    particles_ = beluga::views::sample(std::move(distribution)) |                    //
-                 ranges::views::transform(beluga::make_from_state<particle_type>) |  //
-                 ranges::views::take_exactly(params_.max_particles) |                //
-                 ranges::to<beluga::TupleVector>;
+    particles_.assign_range(
+        beluga::views::sample(std::move(distribution)) |                    //
+        ranges::views::transform(beluga::make_from_state<particle_type>) |  //
+        ranges::views::take_exactly(params_.max_particles));
     force_update_ = true;
   }
 
   /// Initialize particles with a given pose and covariance.
   /**
+   * All states are drawn through the batch sampling path of
+   * `beluga::MultivariateNormalDistribution`, which applies the covariance
+   * transform as a single matrix-matrix product instead of one draw per particle.
+   *
    * \throw std::runtime_error If the provided covariance is invalid.
    */
   void initialize(Sophus::SE2d pose, Sophus::Matrix3d covariance) {
-    initialize(beluga::MultivariateNormalDistribution{pose, covariance});
+    auto distribution = beluga::MultivariateNormalDistribution{std::move(pose), std::move(covariance)};
+    particles_.assign_range(
+        distribution.samples(beluga::get_default_random_engine(), params_.max_particles) |
+        ranges::views::transform(beluga::make_from_state<particle_type>));
+    force_update_ = true;
   }
 
   /// Initialize particles using the default map distribution.
@@ -162,6 +192,89 @@ class Amcl {
     std::visit([&](auto& sensor_model) { sensor_model.update_map(std::move(map)); }, sensor_model_);
   }
 
+  /// Region type for partial map updates; see beluga::LikelihoodFieldModel::CellRegion.
+  using map_region_type = beluga::LikelihoodFieldModel<beluga_ros::OccupancyGrid>::CellRegion;
+
+  /// Apply a partial update of the map used for localization.
+  /**
+   * Variant of update_map() for maps whose occupancy changed only within a known
+   * region, as published by mapping stacks that emit patches instead of full map
+   * republishes. Sensor models with precomputed state (the likelihood field) only
+   * recompute the affected cells, so routine patches cost proportionally to the
+   * changed area; models without precomputed state take the regular full update,
+   * which for them is cheap anyway.
+   *
+   * \param map New occupancy grid representing the static map. It must share the
+   *  frame, dimensions and resolution of the current map, with occupancy changes
+   *  confined to the given region.
+   * \param changed_region Axis-aligned cell bounds of the changed area.
+   */
+  void update_map(beluga_ros::OccupancyGrid map, const map_region_type& changed_region) {
+    map_distribution_ = beluga::MultivariateUniformDistribution{map};
+    std::visit(
+        [&](auto& sensor_model) {
+          using model_type = std::decay_t<decltype(sensor_model)>;
+          if constexpr (std::is_same_v<model_type, beluga::LikelihoodFieldModel<beluga_ros::OccupancyGrid>>) {
+            sensor_model.update_map(map, changed_region);
+          } else {
+            sensor_model.update_map(std::move(map));
+          }
+        },
+        sensor_model_);
+  }
+
+  /// Add a preprocessed map to the map bank.
+  /**
+   * Multi-map sites (e.g. multi-floor buildings) can preprocess one sensor model
+   * per map up front and later activate any of them through switch_map() in
+   * constant time, instead of tearing the filter down and rebuilding the
+   * likelihood field when the map changes. The initially configured map holds
+   * bank index 0.
+   *
+   * \param map Occupancy grid representing the static map.
+   * \param sensor_model Sensor model preprocessed over that map.
+   * \return Bank index identifying the map for switch_map().
+   */
+  std::size_t add_map(beluga_ros::OccupancyGrid map, sensor_model_variant sensor_model) {
+    map_bank_.push_back(MapBankEntry{beluga::MultivariateUniformDistribution{std::move(map)}, std::move(sensor_model)});
+    return map_bank_.size() - 1UL;
+  }
+
+  /// Returns the bank index of the active map.
+  [[nodiscard]] std::size_t active_map_index() const { return active_map_index_; }
+
+  /// Switch the active map to a previously added bank entry.
+  /**
+   * The switch is a constant-time exchange of preprocessed state behind the
+   * shared map handles: no likelihood field is rebuilt. The previously active
+   * map keeps its bank index and can be switched back to at the same cost.
+   *
+   * \param index Bank index of the map to activate, as returned by add_map().
+   * \param reinitialize Whether to re-seed the particles uniformly over the
+   *  newly active map. Pass false to keep the current particle set, e.g. when
+   *  the pose in the new map is known and a call to initialize() follows.
+   * \throw std::out_of_range If the index does not identify a bank entry.
+   */
+  void switch_map(std::size_t index, bool reinitialize = true) {
+    if (index >= map_bank_.size()) {
+      throw std::out_of_range{"Invalid map bank index"};
+    }
+    if (index != active_map_index_) {
+      auto entry = std::move(*map_bank_[index]);
+      map_bank_[active_map_index_] = MapBankEntry{std::move(map_distribution_), std::move(sensor_model_)};
+      map_bank_[index].reset();
+      map_distribution_ = std::move(entry.distribution);
+      sensor_model_ = std::move(entry.sensor_model);
+      bind_pipeline();
+      active_map_index_ = index;
+    }
+    if (reinitialize) {
+      initialize_from_map();
+    } else {
+      force_update_ = true;
+    }
+  }
+
   /// Update particles based on motion and sensor information.
   /**
    * This method performs a particle filter update step using motion and sensor data. It evaluates whether
@@ -172,11 +285,11 @@ class Amcl {
    *
    * \param base_pose_in_odom Base pose in the odometry frame.
    * \param laser_scan Laser scan data.
-   * \return An optional pair containing the estimated pose and covariance after the update,
-   *         or std::nullopt if no update was performed.
+   * \return An optional estimate handle after the update, or std::nullopt if no
+   *         update was performed. The mean pose is computed eagerly; the
+   *         covariance is only materialized if the caller reads it.
    */
-  auto update(Sophus::SE2d base_pose_in_odom, beluga_ros::LaserScan laser_scan)
-      -> std::optional<std::pair<Sophus::SE2d, Sophus::Matrix3d>> {
+  auto update(Sophus::SE2d base_pose_in_odom, beluga_ros::LaserScan laser_scan) -> std::optional<estimation_type> {
     if (particles_.empty()) {
       return std::nullopt;
     }
@@ -185,26 +298,217 @@ class Amcl {
       return std::nullopt;
     }
 
-    // TODO(nahuel): Remove this once we update the measurement type.
-    auto measurement = laser_scan.points_in_cartesian_coordinates() |  //
-                       ranges::views::transform([&laser_scan](const auto& p) {
-                         const auto result = laser_scan.origin() * Sophus::Vector3d{p.x(), p.y(), 0};
-                         return std::make_pair(result.x(), result.y());
-                       }) |
-                       ranges::to<std::vector>;
+    // Fused scan conversion: filtering, decimation and projection run in one pass
+    // into a buffer reused across scans; the sensor models borrow it through their
+    // span overloads, so no per-scan measurement vector is allocated.
+    laser_scan.fill_measurement(measurement_buffer_);
+    return update_impl(
+        base_pose_in_odom,
+        ranges::make_span(measurement_buffer_.data(), static_cast<std::ptrdiff_t>(measurement_buffer_.size())));
+  }
 
-    std::visit(
-        [&, this](auto& policy, auto& motion_model, auto& sensor_model) {
-          particles_ |=
-              beluga::actions::propagate(policy, motion_model(control_action_window_ << base_pose_in_odom)) |  //
-              beluga::actions::reweight(policy, sensor_model(std::move(measurement))) |                        //
-              beluga::actions::normalize(policy);
+  /// Update particles based on motion information and a pre-converted measurement.
+  /**
+   * Overload for pipelined callers that convert scans off the filter path (see
+   * LaserScan::fill_measurement() for the expected packing), so the next scan can
+   * be converted while this update runs. Conversion is then paid for every scan,
+   * including those discarded by the update policy; the usual trade is paying it
+   * on a thread that would otherwise sit idle.
+   *
+   * \param base_pose_in_odom Base pose in the odometry frame.
+   * \param measurement Pre-converted laser scan measurement; it only needs to
+   *        remain valid for the duration of the call.
+   * \return An optional estimate handle after the update, or std::nullopt if no
+   *         update was performed. The mean pose is computed eagerly; the
+   *         covariance is only materialized if the caller reads it.
+   */
+  auto update(Sophus::SE2d base_pose_in_odom, ranges::span<const std::pair<double, double>> measurement)
+      -> std::optional<estimation_type> {
+    if (particles_.empty()) {
+      return std::nullopt;
+    }
+
+    if (!update_policy_(base_pose_in_odom) && !force_update_) {
+      return std::nullopt;
+    }
+
+    return update_impl(base_pose_in_odom, measurement);
+  }
+
+  /// Result-delivery callback type for try_update().
+  using estimate_callback = std::function<void(std::optional<estimation_type>)>;
+
+  /// Hand a measurement to an internal worker for asynchronous processing.
+  /**
+   * Non-blocking counterpart of update(): the filter cycle runs on an internal
+   * worker thread and the given callback is invoked from that thread with the
+   * resulting estimate (or std::nullopt when the update policy skipped the cycle)
+   * once it completes. When a cycle is already in flight the measurement is
+   * dropped and false is returned immediately, making overload behavior an
+   * explicit drop-and-continue instead of queue growth inside the caller's
+   * executor. The busy indication covers the completion callback as well, and
+   * the destructor joins the worker, waiting for an in-flight cycle.
+   *
+   * While a cycle is in flight the filter must not be touched through any other
+   * method; serializing initialize(), update_map() and friends against accepted
+   * cycles remains the caller's responsibility.
+   *
+   * \param base_pose_in_odom Base pose in the odometry frame.
+   * \param laser_scan Laser scan data; conversion also runs on the worker.
+   * \param callback Invoked from the worker thread with the update result.
+   * \return True if the cycle was accepted, false if one was already in flight.
+   */
+  bool try_update(Sophus::SE2d base_pose_in_odom, beluga_ros::LaserScan laser_scan, estimate_callback callback) {
+    if (update_in_flight_.exchange(true)) {
+      return false;
+    }
+    ensure_worker();
+    worker_->execute([this, base_pose_in_odom, laser_scan = std::move(laser_scan),
+                      callback = std::move(callback)]() mutable {
+      auto estimate = update(base_pose_in_odom, std::move(laser_scan));
+      if (callback) {
+        callback(std::move(estimate));
+      }
+      update_in_flight_ = false;
+    });
+    return true;
+  }
+
+  /// Overload of try_update() taking a pre-converted measurement.
+  /**
+   * The measurement is copied into an internal buffer before this method returns,
+   * so the caller's buffer can be overwritten with the next scan immediately.
+   *
+   * \param base_pose_in_odom Base pose in the odometry frame.
+   * \param measurement Pre-converted laser scan measurement.
+   * \param callback Invoked from the worker thread with the update result.
+   * \return True if the cycle was accepted, false if one was already in flight.
+   */
+  bool try_update(
+      Sophus::SE2d base_pose_in_odom,
+      ranges::span<const std::pair<double, double>> measurement,
+      estimate_callback callback) {
+    if (update_in_flight_.exchange(true)) {
+      return false;
+    }
+    ensure_worker();
+    staged_measurement_.assign(measurement.begin(), measurement.end());
+    worker_->execute([this, base_pose_in_odom, callback = std::move(callback)]() {
+      auto estimate = update(
+          base_pose_in_odom,
+          ranges::make_span(staged_measurement_.data(), static_cast<std::ptrdiff_t>(staged_measurement_.size())));
+      if (callback) {
+        callback(std::move(estimate));
+      }
+      update_in_flight_ = false;
+    });
+    return true;
+  }
+
+  /// Force a manual update of the particles on the next iteration of the filter.
+  void force_update() { force_update_ = true; }
+
+  /// Adjusts the KLD particle count bounds for subsequent resamples.
+  /**
+   * The bounds only parameterize the resampling stage (the
+   * `beluga::views::take_while_kld` loop), so they can be changed at runtime
+   * without reinitializing the filter or touching particle state; the new
+   * bounds take effect on the next resample.
+   *
+   * \param min_particles Minimum allowed number of particles.
+   * \param max_particles Maximum allowed number of particles.
+   */
+  void set_particle_bounds(std::size_t min_particles, std::size_t max_particles) {
+    params_.min_particles = min_particles;
+    params_.max_particles = max_particles;
+  }
+
+  /// Returns the profiler aggregating stage timings across every update that ran.
+  /**
+   * Stage durations of every cycle are folded into named histograms, so
+   * long-running telemetry (e.g. ROS diagnostics) can read count/mean/p95/max
+   * per stage at any time (see `beluga::Profiler::snapshot()`). Reading is not
+   * synchronized against in-flight try_update() cycles; read it from the same
+   * serialization domain that drives updates. Inert when
+   * `BELUGA_DISABLE_PROFILING` is defined.
+   */
+  [[nodiscard]] const beluga::Profiler& profiler() const { return profiler_; }
+
+  /// Returns the weight statistics recorded during the last update that ran.
+  /**
+   * Taken over the unnormalized weights in the reweight sweep, together with the
+   * degeneracy telemetry (weight entropy, extrema, coarse histogram; see
+   * `beluga::WeightStatistics`) accumulated in that same pass. As with profiler(),
+   * read it from the same serialization domain that drives updates.
+   */
+  [[nodiscard]] const beluga::WeightStatistics& last_weight_statistics() const { return weight_statistics_; }
+
+  /// Returns the KLD bucket occupancy telemetry of the last resample that ran.
+  /**
+   * See `beluga::KldBucketStatistics`. Useful to audit the configured spatial hash
+   * resolutions (see `beluga::suggest_spatial_hash_resolution()`). Untouched by
+   * updates that did not resample, and subject to the same serialization caveat as
+   * profiler().
+   */
+  [[nodiscard]] const beluga::KldBucketStatistics& last_kld_statistics() const { return kld_statistics_; }
+
+ private:
+  /// Creates the worker backing try_update() on first use.
+  /**
+   * Callers are serialized by winning the in-flight flag, so no further locking is
+   * needed, and filters that never use the asynchronous path spawn no thread.
+   */
+  void ensure_worker() {
+    if (!worker_) {
+      worker_ = std::make_unique<beluga::ThreadPool>(1);
+    }
+  }
+
+  /// Concrete propagate-reweight-normalize pipeline type, erased at the update boundary.
+  using pipeline_type = std::function<void(const Sophus::SE2d&, ranges::span<const std::pair<double, double>>)>;
+
+  /// Materialize the concrete update pipeline for the configured variants.
+  /**
+   * Visiting the motion model, sensor model and execution policy variants once
+   * here, instead of on every update, gives the compiler a concrete
+   * instantiation per combination to inline the hot loops across stages;
+   * updates then pay a single indirect call at this coarser boundary. The
+   * captured references point into the member variants, which are only
+   * reassigned by switch_map(), which re-binds the pipeline (update_map()
+   * mutates the active sensor model in place).
+   */
+  void bind_pipeline() {
+    pipeline_ = std::visit(
+        [this](auto& policy, auto& motion_model, auto& sensor_model) -> pipeline_type {
+          return [this, &policy, &motion_model, &sensor_model](
+                     const Sophus::SE2d& base_pose_in_odom,
+                     ranges::span<const std::pair<double, double>> measurement) {
+            {
+              const auto scope = profiler_.measure("propagate");
+              particles_ |=
+                  beluga::actions::propagate(policy, motion_model(control_action_window_ << base_pose_in_odom));
+            }
+            {
+              const auto scope = profiler_.measure("reweight");
+              particles_ |= beluga::actions::reweight_normalized(
+                  policy, sensor_model(measurement), std::ref(weight_statistics_), std::ref(estimate_statistics_));
+            }
+          };
         },
         execution_policy_, motion_model_, sensor_model_);
+  }
+
+  /// Shared tail of the update() overloads; assumes the update gating already passed.
+  auto update_impl(Sophus::SE2d base_pose_in_odom, ranges::span<const std::pair<double, double>> measurement)
+      -> std::optional<estimation_type> {
+    const auto update_scope = profiler_.measure("update");
+    pipeline_(base_pose_in_odom, measurement);
 
-    const double random_state_probability = random_probability_estimator_(particles_);
+    const double random_state_probability = random_probability_estimator_(weight_statistics_);
 
-    if (resample_policy_(particles_)) {
+    const bool resampled = resample_policy_(particles_);
+    if (resampled) {
+      const auto scope = profiler_.measure("resample");
       auto random_state = ranges::compose(beluga::make_from_state<particle_type>, std::ref(map_distribution_));
 
       if (random_state_probability > 0.0) {
@@ -218,18 +522,25 @@ class Amcl {
                         params_.min_particles,  //
                         params_.max_particles,  //
                         params_.kld_epsilon,    //
-                        params_.kld_z) |
+                        params_.kld_z,          //
+                        nullptr,                //
+                        &kld_statistics_) |
                     beluga::actions::assign;
     }
 
     force_update_ = false;
-    return beluga::estimate(beluga::views::states(particles_), beluga::views::weights(particles_));
+    if (resampled) {
+      // Resampling replaced the particle set, invalidating the statistics taken
+      // during normalization, so they are re-accumulated with a dedicated pass.
+      const auto scope = profiler_.measure("estimate");
+      estimate_statistics_ =
+          beluga::se2_estimate_statistics(beluga::views::states(particles_), beluga::views::weights(particles_));
+    }
+    // The handle computes the mean eagerly; the covariance is only finished from
+    // the statistics if the caller actually reads it.
+    return estimation_type{estimate_statistics_};
   }
 
-  /// Force a manual update of the particles on the next iteration of the filter.
-  void force_update() { force_update_ = true; }
-
- private:
   beluga::TupleVector<particle_type> particles_;
 
   AmclParams params_;
@@ -239,12 +550,45 @@ class Amcl {
   execution_policy_variant execution_policy_;
 
   beluga::spatial_hash<Sophus::SE2d> spatial_hasher_;
+  beluga::WeightStatistics weight_statistics_;
+  /// Bucket occupancy telemetry of the last resample, filled in by the KLD condition.
+  beluga::KldBucketStatistics kld_statistics_;
+  /// Aggregated stage timings across updates; see profiler().
+  beluga::Profiler profiler_;
+  /// Pose estimation statistics of the current update, filled in by the reweight action.
+  beluga::SE2EstimateStatistics<double> estimate_statistics_;
   beluga::ThrunRecoveryProbabilityEstimator random_probability_estimator_;
   beluga::any_policy<Sophus::SE2d> update_policy_;
   beluga::any_policy<decltype(particles_)> resample_policy_;
 
   beluga::RollingWindow<Sophus::SE2d, 2> control_action_window_;
 
+  /// Concrete update pipeline bound once at construction time; see bind_pipeline().
+  pipeline_type pipeline_;
+
+  /// Preprocessed per-map state held by the map bank.
+  struct MapBankEntry {
+    /// Uniform distribution over the free cells of the map.
+    beluga::MultivariateUniformDistribution<Sophus::SE2d, beluga_ros::OccupancyGrid> distribution;
+    /// Sensor model preprocessed over the map.
+    sensor_model_variant sensor_model;
+  };
+
+  /// Map bank; the active map's slot is empty while its state is swapped into the active members.
+  std::vector<std::optional<MapBankEntry>> map_bank_;
+  /// Bank index of the active map.
+  std::size_t active_map_index_{0};
+
+  /// Packed measurement buffer reused across scans; see LaserScan::fill_measurement().
+  std::vector<std::pair<double, double>> measurement_buffer_;
+
+  /// Worker that runs asynchronous filter cycles; created on first try_update() call.
+  std::unique_ptr<beluga::ThreadPool> worker_;
+  /// Measurement staged for the worker, reused across asynchronous cycles.
+  std::vector<std::pair<double, double>> staged_measurement_;
+  /// Whether an asynchronous filter cycle is in flight.
+  std::atomic<bool> update_in_flight_{false};
+
   bool force_update_{true};
 };
 
@@ -15,6 +15,12 @@
 #ifndef BELUGA_ROS_LASER_SCAN_HPP
 #define BELUGA_ROS_LASER_SCAN_HPP
 
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
+
 #include <range/v3/view/iota.hpp>
 
 #include <beluga/sensor/data/laser_scan.hpp>
@@ -46,17 +52,23 @@ class LaserScan : public beluga::BaseLaserScan<LaserScan> {
   /// \param max_beams Maximum number of beams to consider.
   /// \param min_range Minimum allowed range value (in meters).
   /// \param max_range Maximum allowed range value (in meters).
+  /// \param min_intensity Minimum return intensity for a beam to be kept. Beams
+  /// below it are masked with NaN ranges, so every consumer drops them through
+  /// the regular range validity filtering. Ignored when zero (the default) or
+  /// when the message carries no intensities.
   explicit LaserScan(
       beluga_ros::msg::LaserScanConstSharedPtr scan,
       Sophus::SE3d origin = Sophus::SE3d(),
       std::size_t max_beams = std::numeric_limits<std::size_t>::max(),
       Scalar min_range = std::numeric_limits<Scalar>::min(),
-      Scalar max_range = std::numeric_limits<Scalar>::max())
+      Scalar max_range = std::numeric_limits<Scalar>::max(),
+      Scalar min_intensity = 0.)
       : scan_(std::move(scan)),
         origin_(std::move(origin)),
         max_beams_(max_beams),
         min_range_(std::max(static_cast<Scalar>(scan_->range_min), min_range)),
-        max_range_(std::min(static_cast<Scalar>(scan_->range_max), max_range)) {
+        max_range_(std::min(static_cast<Scalar>(scan_->range_max), max_range)),
+        min_intensity_(min_intensity) {
     assert(scan_ != nullptr);
   }
 
@@ -72,23 +84,137 @@ class LaserScan : public beluga::BaseLaserScan<LaserScan> {
   }
 
   /// Get laser scan range measurements as a range.
+  /**
+   * Beams pruned by the intensity threshold read as NaN, so they are dropped by the
+   * same validity filtering that already handles invalid returns.
+   */
   [[nodiscard]] auto ranges() const {
-    return scan_->ranges | beluga::views::take_evenly(max_beams_) |
+    return ranges::views::iota(0, static_cast<int>(scan_->ranges.size())) | beluga::views::take_evenly(max_beams_) |
+           ranges::views::transform([this](int i) {
+             const auto index = static_cast<std::size_t>(i);
+             if (pruned_by_intensity(index)) {
+               return std::numeric_limits<Scalar>::quiet_NaN();
+             }
+             return static_cast<Scalar>(scan_->ranges[index]);
+           });
+  }
+
+  /// Get laser scan return intensities as a range, aligned with `ranges()`.
+  /**
+   * Empty when the sensor does not report intensities.
+   */
+  [[nodiscard]] auto intensities() const {
+    return scan_->intensities | beluga::views::take_evenly(max_beams_) |
            ranges::views::transform([](auto value) { return static_cast<Scalar>(value); });
   }
 
+  /// Eagerly converts the scan into a packed planar point measurement.
+  /**
+   * Fuses the stages the lazy view stack evaluates one element at a time — beam
+   * decimation (see `beluga::views::take_evenly`), range validity and NaN filtering,
+   * polar-to-cartesian conversion, and the planar projection through `origin()` into
+   * the filter frame — into a single pass over the raw message. The output buffer is
+   * cleared but keeps its capacity, so one preallocated buffer serves every scan with
+   * no per-scan allocation; pair it with the span-taking sensor model overloads (see
+   * e.g. `beluga::LikelihoodFieldModel`).
+   *
+   * Per-beam trigonometry exploits the uniform angle increment: each beam direction
+   * is obtained from the previous one with a complex rotation by the increment (two
+   * multiply-adds per coordinate), re-seeded from libm every few hundred beams to
+   * bound drift, instead of calling sincos per beam.
+   *
+   * \param out Destination buffer of planar points in the filter frame.
+   */
+  void fill_measurement(std::vector<std::pair<Scalar, Scalar>>& out) const {
+    out.clear();
+    const std::size_t size = scan_->ranges.size();
+    const std::size_t count = max_beams_;
+    if (size == 0UL || count == 0UL) {
+      return;
+    }
+
+    // Same element selection as beluga::views::take_evenly.
+    const auto keep = [size, count](std::size_t index) {
+      if (count > size) {
+        return true;
+      }
+      if (count == 1UL) {
+        return index == 0UL;
+      }
+      if (index == 0UL || index == size - 1UL) {
+        return true;
+      }
+      const std::size_t m0 = (index - 1UL) * (count - 1UL) / (size - 1UL);
+      const std::size_t m1 = index * (count - 1UL) / (size - 1UL);
+      return m0 != m1;
+    };
+
+    // Planar projection of the 3D sensor origin, as in origin() * (x, y, 0).
+    const auto rotation = origin_.rotationMatrix();
+    const auto translation = origin_.translation();
+    const double r00 = rotation(0, 0);
+    const double r01 = rotation(0, 1);
+    const double r10 = rotation(1, 0);
+    const double r11 = rotation(1, 1);
+
+    const auto angle_min = static_cast<double>(scan_->angle_min);
+    const auto angle_increment = static_cast<double>(scan_->angle_increment);
+    const double step_cos = std::cos(angle_increment);
+    const double step_sin = std::sin(angle_increment);
+    double beam_cos = std::cos(angle_min);
+    double beam_sin = std::sin(angle_min);
+    constexpr std::size_t kReseedPeriod = 512;
+
+    for (std::size_t index = 0UL; index < size; ++index) {
+      if (index > 0UL) {
+        if (index % kReseedPeriod == 0UL) {
+          const double angle = angle_min + static_cast<double>(index) * angle_increment;
+          beam_cos = std::cos(angle);
+          beam_sin = std::sin(angle);
+        } else {
+          const double next_cos = beam_cos * step_cos - beam_sin * step_sin;
+          beam_sin = beam_cos * step_sin + beam_sin * step_cos;
+          beam_cos = next_cos;
+        }
+      }
+      if (!keep(index)) {
+        continue;
+      }
+      if (pruned_by_intensity(index)) {
+        continue;
+      }
+      const auto range = static_cast<Scalar>(scan_->ranges[index]);
+      if (std::isnan(range) || range < min_range_ || range > max_range_) {
+        continue;
+      }
+      const double x = range * beam_cos;
+      const double y = range * beam_sin;
+      out.emplace_back(r00 * x + r01 * y + translation.x(), r10 * x + r11 * y + translation.y());
+    }
+  }
+
   /// Get the minimum range measurement.
   [[nodiscard]] auto min_range() const { return min_range_; }
 
   /// Get the maximum range measurement.
   [[nodiscard]] auto max_range() const { return max_range_; }
 
+  /// Get the minimum return intensity for a beam to be kept.
+  [[nodiscard]] auto min_intensity() const { return min_intensity_; }
+
  private:
+  /// Returns true if the beam at the given index fails the intensity threshold.
+  [[nodiscard]] bool pruned_by_intensity(std::size_t index) const {
+    return min_intensity_ > 0. && index < scan_->intensities.size() &&
+           static_cast<Scalar>(scan_->intensities[index]) < min_intensity_;
+  }
+
   beluga_ros::msg::LaserScanConstSharedPtr scan_;
   Sophus::SE3d origin_;
   std::size_t max_beams_;
   Scalar min_range_;
   Scalar max_range_;
+  Scalar min_intensity_;
 };
 
 }  // namespace beluga_ros
@@ -22,6 +22,8 @@
 #include <geometry_msgs/msg/transform.hpp>
 #include <nav_msgs/msg/occupancy_grid.hpp>
 #include <sensor_msgs/msg/laser_scan.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
 #include <std_msgs/msg/color_rgba.hpp>
 #include <visualization_msgs/msg/marker.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
@@ -34,6 +36,8 @@
 #include <geometry_msgs/Transform.h>
 #include <nav_msgs/OccupancyGrid.h>
 #include <sensor_msgs/LaserScan.h>
+#include <sensor_msgs/PointCloud2.h>
+#include <sensor_msgs/PointField.h>
 #include <std_msgs/ColorRGBA.h>
 #include <visualization_msgs/Marker.h>
 #include <visualization_msgs/MarkerArray.h>
@@ -58,6 +62,9 @@ using MarkerArray = visualization_msgs::msg::MarkerArray;
 using OccupancyGrid = nav_msgs::msg::OccupancyGrid;
 using OccupancyGridConstSharedPtr = OccupancyGrid::ConstSharedPtr;
 using Point = geometry_msgs::msg::Point;
+using PointCloud2 = sensor_msgs::msg::PointCloud2;
+using PointCloud2ConstSharedPtr = PointCloud2::ConstSharedPtr;
+using PointField = sensor_msgs::msg::PointField;
 using Pose = geometry_msgs::msg::Pose;
 using PoseArray = geometry_msgs::msg::PoseArray;
 using Transform = geometry_msgs::msg::Transform;
@@ -72,6 +79,9 @@ using MarkerArray = visualization_msgs::MarkerArray;
 using OccupancyGrid = nav_msgs::OccupancyGrid;
 using OccupancyGridConstSharedPtr = OccupancyGrid::ConstPtr;
 using Point = geometry_msgs::Point;
+using PointCloud2 = sensor_msgs::PointCloud2;
+using PointCloud2ConstSharedPtr = PointCloud2::ConstPtr;
+using PointField = sensor_msgs::PointField;
 using Pose = geometry_msgs::Pose;
 using PoseArray = geometry_msgs::PoseArray;
 using Transform = geometry_msgs::Transform;
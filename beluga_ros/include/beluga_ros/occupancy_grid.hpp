@@ -16,10 +16,13 @@
 #define BELUGA_ROS_OCCUPANCY_GRID_HPP
 
 #include <cmath>
+#include <cstddef>
 #include <memory>
 #include <utility>
 #include <vector>
 
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
 #include <sophus/se2.hpp>
 #include <sophus/so2.hpp>
 
@@ -33,6 +36,7 @@
 #error BELUGA_ROS_VERSION is not defined or invalid
 #endif
 
+#include <beluga/sensor/data/obstacle_bitmap.hpp>
 #include <beluga/sensor/data/occupancy_grid.hpp>
 #include <beluga_ros/messages.hpp>
 
@@ -44,6 +48,17 @@
 namespace beluga_ros {
 
 /// Thin wrapper type for 2D `nav_msgs/OccupancyGrid` messages.
+/**
+ * Acts as a ref-counted immutable map handle: copies share ownership of the
+ * underlying message, so passing grids by value (e.g. through map updates)
+ * exchanges a pointer rather than copying map data, and the old message is
+ * released when the last wrapper referencing it is destroyed.
+ *
+ * The trinary classification of the raw `int8` data is resolved once at wrap
+ * time into bit-packed free and obstacle masks shared across copies, so
+ * occupancy queries (`free_at()`, `obstacle_data()`) are single-bit loads
+ * instead of per-access value comparisons.
+ */
 class OccupancyGrid : public beluga::BaseOccupancyGrid2<OccupancyGrid> {
  public:
   /// Traits for occupancy grid value interpretation.
@@ -72,11 +87,35 @@ class OccupancyGrid : public beluga::BaseOccupancyGrid2<OccupancyGrid> {
   ///
   /// \param grid Occupancy grid message.
   explicit OccupancyGrid(beluga_ros::msg::OccupancyGridConstSharedPtr grid)
-      : grid_(std::move(grid)), origin_(make_origin_transform(grid_->info.origin)) {}
+      : grid_(std::move(grid)),
+        origin_(make_origin_transform(grid_->info.origin)),
+        masks_(std::make_shared<const Masks>(make_masks(*grid_))) {}
 
   /// Get the occupancy grid origin in the occupancy grid frame.
   [[nodiscard]] const Sophus::SE2d& origin() const { return origin_; }
 
+  using beluga::BaseOccupancyGrid2<OccupancyGrid>::free_at;
+
+  /// Checks if cell is free, as a single bit load from the precomputed free mask.
+  /**
+   * Note cells not included in the grid are non-free too.
+   *
+   * \param index Grid cell index.
+   */
+  [[nodiscard]] bool free_at(std::size_t index) const { return index < size() && masks_->free.is_set(index); }
+
+  /// Retrieves grid data using true booleans for obstacles, from the precomputed obstacle mask.
+  [[nodiscard]] auto obstacle_data() const {
+    return ranges::views::iota(std::size_t{0}, size()) |
+           ranges::views::transform([masks = masks_](std::size_t index) { return masks->obstacles.is_set(index); });
+  }
+
+  /// Retrieves grid occupancy as a bit-packed obstacle bitmap.
+  /**
+   * Returns a copy of the mask precomputed at wrap time instead of repacking.
+   */
+  [[nodiscard]] beluga::ObstacleBitmap2 packed_obstacle_data() const { return masks_->obstacles; }
+
   /// Get the size of the occupancy grid (`width()` times `height()`).
   [[nodiscard]] std::size_t size() const { return grid_->data.size(); }
 
@@ -96,8 +135,22 @@ class OccupancyGrid : public beluga::BaseOccupancyGrid2<OccupancyGrid> {
   [[nodiscard]] static auto value_traits() { return ValueTraits{}; }
 
  private:
+  /// Bit-packed trinary classification of the grid data, computed once at wrap time.
+  struct Masks {
+    beluga::ObstacleBitmap2 free;       ///< One bit per cell, set for free cells.
+    beluga::ObstacleBitmap2 obstacles;  ///< One bit per cell, set for occupied cells.
+  };
+
   beluga_ros::msg::OccupancyGridConstSharedPtr grid_;
   Sophus::SE2d origin_;
+  std::shared_ptr<const Masks> masks_;
+
+  static Masks make_masks(const beluga_ros::msg::OccupancyGrid& grid) {
+    const auto width = static_cast<std::size_t>(grid.info.width);
+    return Masks{
+        beluga::ObstacleBitmap2{grid.data | ranges::views::transform(&ValueTraits::is_free), width},
+        beluga::ObstacleBitmap2{grid.data | ranges::views::transform(&ValueTraits::is_occupied), width}};
+  }
 
   static Sophus::SE2d make_origin_transform(const beluga_ros::msg::Pose& origin) {
     const auto rotation = Sophus::SO2d{tf2::getYaw(origin.orientation)};
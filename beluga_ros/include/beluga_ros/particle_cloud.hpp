@@ -16,9 +16,12 @@
 #define BELUGA_ROS_PARTICLE_CLOUD_HPP
 
 #include <cmath>
-#include <map>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <type_traits>
+#include <unordered_map>
 
 #include <range/v3/range/primitives.hpp>
 #include <range/v3/view/take_exactly.hpp>
@@ -29,6 +32,7 @@
 
 #include <beluga/algorithm/spatial_hash.hpp>
 #include <beluga/primitives.hpp>
+#include <beluga/views/particles.hpp>
 #include <beluga/views/sample.hpp>
 #include <beluga/views/zip.hpp>
 
@@ -113,10 +117,8 @@ assign_particle_cloud(Particles&& particles, std::size_t size, beluga_ros::msg::
   message.poses.clear();
   if (ranges::size(particles) > 0) {
     message.poses.reserve(size);
-    for (const auto& particle : particles | beluga::views::sample | ranges::views::take_exactly(size)) {
-      auto& pose = message.poses.emplace_back();
-      tf2::toMsg(beluga::state(particle), pose);
-    }
+    tf2::toMsgs(
+        particles | beluga::views::sample | ranges::views::take_exactly(size) | beluga::views::states, message.poses);
   }
   return message;
 }
@@ -135,12 +137,76 @@ Message& assign_particle_cloud(Particles&& particles, Message& message) {
   return assign_particle_cloud(std::forward<Particles>(particles), ranges::size(particles), message);
 }
 
-/// Assign a pose distribution to a markers message for visualization.
+/// Assign a pose distribution to a compact point cloud message.
 /**
+ * Compact wire format for particle cloud telemetry. Each particle is packed as four
+ * float32 values (x, y, theta, weight) as described by the message point fields,
+ * spending 16 bytes per particle where a PoseArray spends 56 serializing a planar
+ * pose as a 3D pose with a quaternion, at the cost of single precision. The data
+ * buffer is reused across calls on the same message, so repeated publications do
+ * not reallocate.
+ *
  * \param particles Pose distribution, as a particle cloud itself.
+ * \param[out] message Point cloud message to be assigned.
+ * \tparam Particles A sized range type whose value type satisfies \ref ParticlePage "Particle" named requirements.
+ */
+template <
+    class Particles,
+    class Particle = ranges::range_value_t<Particles>,
+    class State = typename beluga::state_t<Particle>,
+    class Scalar = typename State::Scalar,
+    typename = std::enable_if_t<std::is_same_v<State, typename Sophus::SE2<Scalar>>>>
+beluga_ros::msg::PointCloud2& assign_particle_cloud(Particles&& particles, beluga_ros::msg::PointCloud2& message) {
+  static_assert(ranges::sized_range<decltype(particles)>);
+  constexpr std::uint32_t kPointStep = 4U * sizeof(float);
+
+  const auto size = static_cast<std::uint32_t>(ranges::size(particles));
+
+  message.fields.resize(4);
+  const auto setup_field = [&message](std::size_t index, const char* name) {
+    auto& field = message.fields[index];
+    field.name = name;
+    field.offset = static_cast<std::uint32_t>(index * sizeof(float));
+    field.datatype = beluga_ros::msg::PointField::FLOAT32;
+    field.count = 1;
+  };
+  setup_field(0, "x");
+  setup_field(1, "y");
+  setup_field(2, "theta");
+  setup_field(3, "weight");
+
+  message.height = 1;
+  message.width = size;
+  message.is_bigendian = false;
+  message.point_step = kPointStep;
+  message.row_step = size * kPointStep;
+  message.is_dense = true;
+
+  message.data.resize(std::size_t{size} * kPointStep);
+  auto* cursor = reinterpret_cast<float*>(message.data.data());
+  auto states = beluga::views::states(particles);
+  auto weights = beluga::views::weights(particles);
+  for (const auto& [state, weight] : beluga::views::zip(states, weights)) {
+    *cursor++ = static_cast<float>(state.translation().x());
+    *cursor++ = static_cast<float>(state.translation().y());
+    *cursor++ = static_cast<float>(state.so2().log());
+    *cursor++ = static_cast<float>(static_cast<double>(weight));
+  }
+  return message;
+}
+
+/// Assign a pose distribution to a markers message for visualization, up to a sample budget.
+/**
+ * \param particles Pose distribution, as a particle cloud itself.
+ * \param max_samples Maximum number of particles to histogram. When the distribution
+ * holds more particles than this, a weighted subsample of this size is histogrammed
+ * instead, bounding both the time spent here and the size of the resulting message
+ * regardless of the filter population.
  * \param linear_resolution Linear resolution, in meters, for visualization.
  * \param angular_resolution Angular resolution, in radians, for visualization.
- * \param[out] message Markers message to be assigned.
+ * \param[out] message Markers message to be assigned. Marker point and color buffers
+ * are reused across calls on the same message, so repeated publications do not
+ * reallocate.
  * \tparam Particles A sized range type whose value type satisfies \ref ParticlePage "Particle" named requirements.
  */
 template <
@@ -152,6 +218,7 @@ template <
     typename = std::enable_if_t<std::is_same_v<State, typename Sophus::SE2<Scalar>>>>
 beluga_ros::msg::MarkerArray& assign_particle_cloud(
     Particles&& particles,
+    std::size_t max_samples,
     Scalar linear_resolution,
     Scalar angular_resolution,
     beluga_ros::msg::MarkerArray& message) {
@@ -166,23 +233,35 @@ beluga_ros::msg::MarkerArray& assign_particle_cloud(
   // Only the combination of both the state distribution and the candidate weights together
   // provide information about the probability density at each candidate.
   auto max_bin_weight = Weight{1e-3};
-  auto states = beluga::views::states(particles);
-  auto weights = beluga::views::weights(particles);
   using StateHistogram = std::unordered_map<State, Weight, beluga::spatial_hash<State>, detail::almost_equal_to<State>>;
   auto histogram = StateHistogram{
       10U, beluga::spatial_hash<State>{linear_resolution, angular_resolution},
       detail::almost_equal_to<State>{linear_resolution, angular_resolution}};
-  for (const auto& [state, weight] : beluga::views::zip(states, weights)) {
-    auto& bin_weight = histogram[state];
-    bin_weight += weight;
-    if (bin_weight > max_bin_weight) {
-      max_bin_weight = bin_weight;
+  if (max_samples < ranges::size(particles)) {
+    // Weighted subsampling down to the budget: the number of copies each candidate
+    // gets in the subsample is the density proxy at its bin, consistent with the
+    // rationale above for resampled populations.
+    for (const auto& particle : particles | beluga::views::sample | ranges::views::take_exactly(max_samples)) {
+      auto& bin_weight = histogram[beluga::state(particle)];
+      bin_weight += Weight{1.0};
+      if (bin_weight > max_bin_weight) {
+        max_bin_weight = bin_weight;
+      }
+    }
+  } else {
+    auto states = beluga::views::states(particles);
+    auto weights = beluga::views::weights(particles);
+    for (const auto& [state, weight] : beluga::views::zip(states, weights)) {
+      auto& bin_weight = histogram[state];
+      bin_weight += weight;
+      if (bin_weight > max_bin_weight) {
+        max_bin_weight = bin_weight;
+      }
     }
   }
 
-  message.markers.clear();
-
   if (histogram.empty()) {
+    message.markers.clear();
     return message;
   }
 
@@ -203,8 +282,12 @@ beluga_ros::msg::MarkerArray& assign_particle_cloud(
   const auto arrow_head_left_corner =
       kArrowBodyLength * Translation::UnitX() + (kArrowHeadWidth / Scalar{2.0}) * Translation::UnitY();
 
-  message.markers.reserve(2);
-  auto& arrow_bodies = message.markers.emplace_back();
+  // Keep the two markers (and thus their point and color buffers) across calls on
+  // the same message, clearing instead of destroying them, so that repeated
+  // publications reuse previously allocated storage.
+  message.markers.resize(2);
+
+  auto& arrow_bodies = message.markers[0];
   arrow_bodies.id = 0;
   arrow_bodies.ns = "bodies";
   arrow_bodies.color.a = 1.0;
@@ -212,10 +295,12 @@ beluga_ros::msg::MarkerArray& assign_particle_cloud(
   arrow_bodies.lifetime.sec = 1;
   arrow_bodies.type = beluga_ros::msg::Marker::LINE_LIST;
   arrow_bodies.action = beluga_ros::msg::Marker::ADD;
+  arrow_bodies.points.clear();
+  arrow_bodies.colors.clear();
   arrow_bodies.points.reserve(histogram.size() * 2);  // 2 vertices per arrow body
   arrow_bodies.colors.reserve(histogram.size() * 2);
 
-  auto& arrow_heads = message.markers.emplace_back();
+  auto& arrow_heads = message.markers[1];
   arrow_heads.id = 1;
   arrow_heads.ns = "heads";
   arrow_heads.scale.x = 1.0;
@@ -226,6 +311,8 @@ beluga_ros::msg::MarkerArray& assign_particle_cloud(
   arrow_heads.lifetime.sec = 1;
   arrow_heads.type = beluga_ros::msg::Marker::TRIANGLE_LIST;
   arrow_heads.action = beluga_ros::msg::Marker::ADD;
+  arrow_heads.points.clear();
+  arrow_heads.colors.clear();
   arrow_heads.points.reserve(histogram.size() * 3);  // 3 vertices per arrow head
   arrow_heads.colors.reserve(histogram.size() * 3);
 
@@ -260,9 +347,36 @@ beluga_ros::msg::MarkerArray& assign_particle_cloud(
   return message;
 }
 
+/// Assign a pose distribution to a markers message for visualization.
+/**
+ * All particles in the distribution are histogrammed.
+ *
+ * \param particles Pose distribution, as a particle cloud itself.
+ * \param linear_resolution Linear resolution, in meters, for visualization.
+ * \param angular_resolution Angular resolution, in radians, for visualization.
+ * \param[out] message Markers message to be assigned.
+ * \tparam Particles A sized range type whose value type satisfies \ref ParticlePage "Particle" named requirements.
+ */
+template <
+    class Particles,
+    class Particle = ranges::range_value_t<Particles>,
+    class State = typename beluga::state_t<Particle>,
+    class Scalar = typename State::Scalar,
+    typename = std::enable_if_t<std::is_same_v<State, typename Sophus::SE2<Scalar>>>>
+beluga_ros::msg::MarkerArray& assign_particle_cloud(
+    Particles&& particles,
+    Scalar linear_resolution,
+    Scalar angular_resolution,
+    beluga_ros::msg::MarkerArray& message) {
+  return assign_particle_cloud(
+      std::forward<Particles>(particles), std::numeric_limits<std::size_t>::max(), linear_resolution,
+      angular_resolution, message);
+}
+
 /// Assign a pose distribution to a markers message for visualization with suitable resolutions.
 /**
  * \param particles Pose distribution, as a particle cloud itself.
+ * \param max_samples Maximum number of particles to histogram; see the budgeted overload.
  * \param[out] message Markers message to be assigned.
  * \tparam Particles A sized range type whose value type satisfies \ref ParticlePage "Particle" named requirements.
  */
@@ -271,11 +385,27 @@ template <
     class Particle = ranges::range_value_t<Particles>,
     class State = typename beluga::state_t<Particle>,
     class Scalar = typename State::Scalar>
-beluga_ros::msg::MarkerArray& assign_particle_cloud(Particles&& particles, beluga_ros::msg::MarkerArray& message) {
+beluga_ros::msg::MarkerArray&
+assign_particle_cloud(Particles&& particles, std::size_t max_samples, beluga_ros::msg::MarkerArray& message) {
   constexpr auto kDefaultLinearResolution = Scalar{1e-3};   // ie. 1 mm
   constexpr auto kDefaultAngularResolution = Scalar{1e-3};  // ie. 0.05 degrees
   return assign_particle_cloud(
-      std::forward<Particles>(particles), kDefaultLinearResolution, kDefaultAngularResolution, message);
+      std::forward<Particles>(particles), max_samples, kDefaultLinearResolution, kDefaultAngularResolution, message);
+}
+
+/// Assign a pose distribution to a markers message for visualization with suitable resolutions.
+/**
+ * \param particles Pose distribution, as a particle cloud itself.
+ * \param[out] message Markers message to be assigned.
+ * \tparam Particles A sized range type whose value type satisfies \ref ParticlePage "Particle" named requirements.
+ */
+template <
+    class Particles,
+    class Particle = ranges::range_value_t<Particles>,
+    class State = typename beluga::state_t<Particle>,
+    class Scalar = typename State::Scalar>
+beluga_ros::msg::MarkerArray& assign_particle_cloud(Particles&& particles, beluga_ros::msg::MarkerArray& message) {
+  return assign_particle_cloud(std::forward<Particles>(particles), std::numeric_limits<std::size_t>::max(), message);
 }
 
 }  // namespace beluga_ros
@@ -0,0 +1,318 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ROS_PARTICLE_MIRROR_HPP
+#define BELUGA_ROS_PARTICLE_MIRROR_HPP
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+/**
+ * \file
+ * \brief Shared-memory mirror of a particle container for external monitoring tools.
+ */
+
+namespace beluga_ros {
+
+namespace detail {
+
+/// In-memory header of a shared-memory particle mirror segment.
+/**
+ * Followed in the segment by the particle columns as flat arrays in particle
+ * tuple order, each sized for the mirror capacity.
+ */
+struct ParticleMirrorHeader {
+  /// Maximum number of particle columns a mirror can carry.
+  static constexpr std::size_t kMaxColumns = 8;
+
+  /// Segment format magic number.
+  std::uint8_t magic[8];  // NOLINT(modernize-avoid-c-arrays)
+  /// Segment format version.
+  std::uint32_t version;
+  /// Number of particle columns following the header.
+  std::uint32_t column_count;
+  /// Maximum number of particles the columns are sized for.
+  std::uint64_t capacity;
+  /// Element size of each column, in bytes, zero past `column_count`.
+  std::uint64_t column_sizes[kMaxColumns];  // NOLINT(modernize-avoid-c-arrays)
+  /// Seqlock word; odd while a write is in progress, bumped twice per write.
+  std::atomic<std::uint64_t> sequence;
+  /// Number of particles currently mirrored.
+  std::uint64_t particle_count;
+};
+
+static_assert(std::atomic<std::uint64_t>::is_always_lock_free);
+
+/// Expected magic number of a shared-memory particle mirror segment.
+inline constexpr std::uint8_t kParticleMirrorMagic[8] = {'B', 'L', 'G', 'M', 'I', 'R', 'R', '\0'};
+
+/// Supported shared-memory particle mirror format version.
+inline constexpr std::uint32_t kParticleMirrorVersion = 1;
+
+}  // namespace detail
+
+/// Shared-memory mirror of a particle container, readable by external processes.
+/**
+ * Maps a named POSIX shared memory segment holding the particle columns as flat
+ * arrays, exactly as they are laid out in a `beluga::TupleVector`, guarded by a
+ * seqlock. `write()` is a handful of column `memcpy` calls bracketed by two
+ * sequence bumps, so mirroring after each filter cycle has a fixed, serialization
+ * free cost on the filter thread, and monitoring tools in other processes read
+ * the particle state at memory speed through `ParticleMirrorReader` instead of
+ * subscribing to full particle cloud messages.
+ *
+ * The writer owns the segment name: construction creates (or truncates) the
+ * segment and destruction unlinks it.
+ *
+ * \tparam ParticleType Full particle type the mirrored containers hold. All its
+ * elements must be trivially copyable.
+ */
+template <class ParticleType>
+class ParticleMirror {
+ public:
+  /// Number of particle columns mirrored.
+  static constexpr std::size_t kColumnCount = std::tuple_size_v<ParticleType>;
+  static_assert(kColumnCount <= detail::ParticleMirrorHeader::kMaxColumns);
+
+  /// Constructor.
+  /**
+   * \param name Segment name, in `shm_open()` form (i.e. starting with a slash).
+   * \param capacity Maximum number of particles the mirror can hold.
+   * \throws std::runtime_error If the segment cannot be created or mapped.
+   */
+  ParticleMirror(std::string name, std::size_t capacity) : name_(std::move(name)), capacity_(capacity) {
+    const int descriptor = shm_open(name_.c_str(), O_CREAT | O_RDWR, 0644);
+    if (descriptor < 0) {
+      throw std::runtime_error{"Couldn't create shared memory segment " + name_ + ": " + std::strerror(errno)};
+    }
+    const std::size_t size = segment_size(capacity_);
+    if (ftruncate(descriptor, static_cast<off_t>(size)) != 0) {
+      close(descriptor);
+      shm_unlink(name_.c_str());
+      throw std::runtime_error{"Couldn't size shared memory segment " + name_ + ": " + std::strerror(errno)};
+    }
+    void* const mapping = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    if (mapping == MAP_FAILED) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast,performance-no-int-to-ptr)
+      shm_unlink(name_.c_str());
+      throw std::runtime_error{"Couldn't map shared memory segment " + name_ + ": " + std::strerror(errno)};
+    }
+    data_ = static_cast<std::uint8_t*>(mapping);
+    auto* const header = new (data_) detail::ParticleMirrorHeader{};
+    std::copy(
+        std::begin(detail::kParticleMirrorMagic), std::end(detail::kParticleMirrorMagic), std::begin(header->magic));
+    header->version = detail::kParticleMirrorVersion;
+    header->column_count = static_cast<std::uint32_t>(kColumnCount);
+    header->capacity = capacity_;
+    const auto sizes = column_element_sizes();
+    std::copy(sizes.begin(), sizes.end(), std::begin(header->column_sizes));
+  }
+
+  /// Not copyable, the mirror owns the mapping and the segment name.
+  ParticleMirror(const ParticleMirror&) = delete;
+  /// \copydoc ParticleMirror(const ParticleMirror&)
+  ParticleMirror& operator=(const ParticleMirror&) = delete;
+
+  /// Destructor, unmaps and unlinks the segment.
+  ~ParticleMirror() {
+    munmap(data_, segment_size(capacity_));
+    shm_unlink(name_.c_str());
+  }
+
+  /// Get the segment name.
+  [[nodiscard]] const std::string& name() const { return name_; }
+
+  /// Get the maximum number of particles the mirror can hold.
+  [[nodiscard]] std::size_t capacity() const { return capacity_; }
+
+  /// Mirrors the given particle container into the segment.
+  /**
+   * Bumps the seqlock to odd, copies each particle column with one bulk `memcpy`
+   * and bumps it back to even, so concurrent readers either see a consistent
+   * mirror or retry. Meant to be called from the filter thread after each cycle;
+   * it never blocks on readers.
+   *
+   * \param particles Particle container to mirror, e.g. `Amcl::particles()`.
+   * \throws std::invalid_argument If the container exceeds the mirror capacity.
+   */
+  template <class Container>
+  void write(const Container& particles) {
+    if (particles.size() > capacity_) {
+      throw std::invalid_argument{"Particle container exceeds the mirror capacity"};
+    }
+    auto* const header = reinterpret_cast<detail::ParticleMirrorHeader*>(data_);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    header->sequence.fetch_add(1, std::memory_order_seq_cst);
+    header->particle_count = particles.size();
+    write_columns(particles, std::make_index_sequence<kColumnCount>());
+    header->sequence.fetch_add(1, std::memory_order_seq_cst);
+  }
+
+ private:
+  /// Returns the element size of each particle column, in tuple order.
+  [[nodiscard]] static constexpr auto column_element_sizes() {
+    return column_element_sizes_impl(std::make_index_sequence<kColumnCount>());
+  }
+
+  /// \copydoc column_element_sizes()
+  template <std::size_t... Is>
+  [[nodiscard]] static constexpr auto column_element_sizes_impl(std::index_sequence<Is...>) {
+    static_assert((std::is_trivially_copyable_v<std::tuple_element_t<Is, ParticleType>> && ...));
+    return std::array<std::uint64_t, sizeof...(Is)>{sizeof(std::tuple_element_t<Is, ParticleType>)...};
+  }
+
+  /// Returns the byte offset of a column within the segment for a given capacity.
+  [[nodiscard]] static constexpr std::size_t column_offset(std::size_t column, std::size_t capacity) {
+    std::size_t offset = sizeof(detail::ParticleMirrorHeader);
+    const auto sizes = column_element_sizes();
+    for (std::size_t index = 0; index < column; ++index) {
+      offset += capacity * static_cast<std::size_t>(sizes[index]);
+    }
+    return offset;
+  }
+
+  /// Returns the total segment size for a given capacity.
+  [[nodiscard]] static constexpr std::size_t segment_size(std::size_t capacity) {
+    return column_offset(kColumnCount, capacity);
+  }
+
+  /// Copies the particle columns into the segment, one bulk copy per column.
+  template <class Container, std::size_t... Is>
+  void write_columns(const Container& particles, std::index_sequence<Is...>) {
+    (std::memcpy(
+         data_ + column_offset(Is, capacity_), particles.template data<Is>(),
+         particles.size() * sizeof(std::tuple_element_t<Is, ParticleType>)),
+     ...);
+  }
+
+  template <class>
+  friend class ParticleMirrorReader;
+
+  std::string name_;
+  std::size_t capacity_;
+  std::uint8_t* data_ = nullptr;
+};
+
+/// Read side of a shared-memory particle mirror.
+/**
+ * Opens a segment created by a `ParticleMirror` of the same particle type,
+ * possibly in another process, and copies consistent particle snapshots out of
+ * it. Readers never block the writer: a read that races a write simply retries.
+ *
+ * \tparam ParticleType Full particle type the mirrored containers hold.
+ */
+template <class ParticleType>
+class ParticleMirrorReader {
+ public:
+  /// Constructor.
+  /**
+   * \param name Segment name the mirror was created with.
+   * \throws std::runtime_error If the segment cannot be opened or mapped.
+   * \throws std::invalid_argument If the segment layout does not match `ParticleType`.
+   */
+  explicit ParticleMirrorReader(const std::string& name) {
+    const int descriptor = shm_open(name.c_str(), O_RDONLY, 0);
+    if (descriptor < 0) {
+      throw std::runtime_error{"Couldn't open shared memory segment " + name + ": " + std::strerror(errno)};
+    }
+    detail::ParticleMirrorHeader header{};
+    const auto bytes_read = ::read(descriptor, &header, sizeof(header));
+    const bool valid = bytes_read == static_cast<ssize_t>(sizeof(header)) &&
+                       std::equal(std::begin(header.magic), std::end(header.magic), detail::kParticleMirrorMagic) &&
+                       header.version == detail::kParticleMirrorVersion &&
+                       header.column_count == mirror_type::kColumnCount &&
+                       std::equal(
+                           std::begin(header.column_sizes), std::begin(header.column_sizes) + mirror_type::kColumnCount,
+                           mirror_type::column_element_sizes().begin());
+    if (!valid) {
+      close(descriptor);
+      throw std::invalid_argument{"Incompatible shared memory particle mirror layout in " + name};
+    }
+    capacity_ = static_cast<std::size_t>(header.capacity);
+    const std::size_t size = mirror_type::segment_size(capacity_);
+    void* const mapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, descriptor, 0);
+    close(descriptor);
+    if (mapping == MAP_FAILED) {  // NOLINT(cppcoreguidelines-pro-type-cstyle-cast,performance-no-int-to-ptr)
+      throw std::runtime_error{"Couldn't map shared memory segment " + name + ": " + std::strerror(errno)};
+    }
+    data_ = static_cast<const std::uint8_t*>(mapping);
+  }
+
+  /// Not copyable, the reader owns the mapping.
+  ParticleMirrorReader(const ParticleMirrorReader&) = delete;
+  /// \copydoc ParticleMirrorReader(const ParticleMirrorReader&)
+  ParticleMirrorReader& operator=(const ParticleMirrorReader&) = delete;
+
+  /// Destructor, unmaps the segment without unlinking it.
+  ~ParticleMirrorReader() { munmap(const_cast<std::uint8_t*>(data_), mirror_type::segment_size(capacity_)); }  // NOLINT(cppcoreguidelines-pro-type-const-cast)
+
+  /// Get the maximum number of particles the mirror can hold.
+  [[nodiscard]] std::size_t capacity() const { return capacity_; }
+
+  /// Copies a consistent particle snapshot out of the segment.
+  /**
+   * \param[out] particles Destination container, resized to the mirrored count.
+   * \param max_attempts Number of seqlock retries before giving up.
+   * \return true on success, false if every attempt raced a concurrent write.
+   */
+  template <class Container>
+  [[nodiscard]] bool read(Container& particles, std::size_t max_attempts = 8) const {
+    const auto* const header = reinterpret_cast<const detail::ParticleMirrorHeader*>(data_);  // NOLINT(cppcoreguidelines-pro-type-reinterpret-cast)
+    for (std::size_t attempt = 0; attempt < max_attempts; ++attempt) {
+      const std::uint64_t sequence = header->sequence.load(std::memory_order_seq_cst);
+      if (sequence % 2 != 0) {
+        continue;  // A write is in progress.
+      }
+      particles.resize(static_cast<std::size_t>(header->particle_count));
+      read_columns(particles, std::make_index_sequence<mirror_type::kColumnCount>());
+      if (header->sequence.load(std::memory_order_seq_cst) == sequence) {
+        return true;
+      }
+    }
+    return false;
+  }
+
+ private:
+  using mirror_type = ParticleMirror<ParticleType>;
+
+  /// Copies the particle columns out of the segment, one bulk copy per column.
+  template <class Container, std::size_t... Is>
+  void read_columns(Container& particles, std::index_sequence<Is...>) const {
+    (std::memcpy(
+         particles.template data<Is>(), data_ + mirror_type::column_offset(Is, capacity_),
+         particles.size() * sizeof(std::tuple_element_t<Is, ParticleType>)),
+     ...);
+  }
+
+  std::size_t capacity_ = 0;
+  const std::uint8_t* data_ = nullptr;
+};
+
+}  // namespace beluga_ros
+
+#endif  // BELUGA_ROS_PARTICLE_MIRROR_HPP
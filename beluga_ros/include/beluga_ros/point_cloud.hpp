@@ -0,0 +1,118 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef BELUGA_ROS_POINT_CLOUD_HPP
+#define BELUGA_ROS_POINT_CLOUD_HPP
+
+#include <cassert>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include <range/v3/view/iota.hpp>
+#include <range/v3/view/transform.hpp>
+
+#include <Eigen/Core>
+
+#include <beluga_ros/messages.hpp>
+
+#include <sophus/se3.hpp>
+
+/**
+ * \file
+ * \brief Implementation of `sensor_msgs/PointCloud2` wrapper type.
+ */
+
+namespace beluga_ros {
+
+/// Thin wrapper type for 3D `sensor_msgs/PointCloud2` messages.
+/**
+ * Points are read in place as strided `Eigen::Map` views into the raw message
+ * buffer, keeping the native `float32` representation of the `x`, `y` and `z`
+ * fields. Iterating the cloud thus copies nothing: scalar widening, if the
+ * consumer needs it, happens one point at a time as points are visited (see
+ * e.g. `beluga::detail::to_cells()`), not up front for the whole cloud.
+ *
+ * The message must hold `x`, `y` and `z` as consecutive `float32` fields, in
+ * that order, which is how common drivers and `pcl_conversions` lay them out.
+ */
+class PointCloud3 {
+ public:
+  /// Point coordinate type, as encoded in the message.
+  using Scalar = float;
+
+  /// Constructor.
+  ///
+  /// \param cloud Point cloud message.
+  /// \param origin Point cloud frame origin in the filter frame.
+  /// \throws std::invalid_argument If the message does not hold `x`, `y`
+  /// and `z` as consecutive `float32` fields, in that order.
+  explicit PointCloud3(beluga_ros::msg::PointCloud2ConstSharedPtr cloud, Sophus::SE3d origin = Sophus::SE3d())
+      : cloud_(std::move(cloud)), origin_(std::move(origin)) {
+    assert(cloud_ != nullptr);
+    offset_ = resolve_xyz_offset(*cloud_);
+  }
+
+  /// Get the point cloud frame origin in the filter frame.
+  [[nodiscard]] const auto& origin() const { return origin_; }
+
+  /// Get the number of points in the cloud.
+  [[nodiscard]] std::size_t size() const { return static_cast<std::size_t>(cloud_->width) * cloud_->height; }
+
+  /// Get a single point as a map into the message buffer.
+  [[nodiscard]] auto operator[](std::size_t index) const {
+    assert(index < size());
+    const auto* data = cloud_->data.data() + static_cast<std::size_t>(cloud_->point_step) * index + offset_;
+    return Eigen::Map<const Eigen::Vector3f>{reinterpret_cast<const float*>(data)};
+  }
+
+  /// Get the cloud points as a range of maps into the message buffer.
+  [[nodiscard]] auto points() const {
+    return ranges::views::iota(std::size_t{0}, size()) |
+           ranges::views::transform([this](std::size_t index) { return (*this)[index]; });
+  }
+
+ private:
+  /// Find the byte offset of the `x` field, validating the expected layout.
+  static std::size_t resolve_xyz_offset(const beluga_ros::msg::PointCloud2& cloud) {
+    const auto offset_of = [&cloud](const char* name) {
+      for (const auto& field : cloud.fields) {
+        if (field.name == name) {
+          if (field.datatype != beluga_ros::msg::PointField::FLOAT32) {
+            throw std::invalid_argument("Point cloud field '" + field.name + "' is not of float32 type");
+          }
+          return static_cast<std::size_t>(field.offset);
+        }
+      }
+      throw std::invalid_argument(std::string("Point cloud is missing field '") + name + "'");
+    };
+    const std::size_t x_offset = offset_of("x");
+    if (offset_of("y") != x_offset + sizeof(float) || offset_of("z") != x_offset + 2 * sizeof(float)) {
+      throw std::invalid_argument("Point cloud x, y, z fields are not consecutive");
+    }
+    if (x_offset + 3 * sizeof(float) > cloud.point_step) {
+      throw std::invalid_argument("Point cloud x, y, z fields overrun the point step");
+    }
+    return x_offset;
+  }
+
+  beluga_ros::msg::PointCloud2ConstSharedPtr cloud_;
+  Sophus::SE3d origin_;
+  std::size_t offset_;
+};
+
+}  // namespace beluga_ros
+
+#endif  // BELUGA_ROS_POINT_CLOUD_HPP
@@ -15,9 +15,15 @@
 #ifndef BELUGA_ROS_TF2_SOPHUS_HPP
 #define BELUGA_ROS_TF2_SOPHUS_HPP
 
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
 #include <tf2/convert.h>
 #include <tf2/utils.h>
 
+#include <range/v3/range/traits.hpp>
+
 #if BELUGA_ROS_VERSION == 2
 #include <tf2_eigen/tf2_eigen.hpp>
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
@@ -128,6 +134,44 @@ inline beluga_ros::msg::Transform toMsg(const Sophus::SE3<Scalar>& in) {
   return msg;
 }
 
+/// Appends a range of Sophus SE2 or SE3 elements to a vector of Pose messages.
+/**
+ * Batch counterpart of the Pose toMsg() overloads for particle-set export,
+ * converting the whole range in one streaming pass. For SE2 elements the
+ * quaternion is computed from the stored unit complex number through the
+ * half-angle identities, so each pose costs a square root and a division
+ * instead of the atan2/sin/cos round trip of the element-wise conversion,
+ * and only the z and w quaternion components are touched. The output vector
+ * is appended to, preserving whatever capacity the caller reserved.
+ *
+ * \param in Range of Sophus SE2 or SE3 elements to convert.
+ * \param out Vector of Pose messages to append to.
+ * \return A reference to `out`.
+ */
+template <class Range, class State = ranges::range_value_t<Range>>
+inline std::vector<beluga_ros::msg::Pose>& toMsgs(Range&& in, std::vector<beluga_ros::msg::Pose>& out) {
+  for (const auto& pose : in) {
+    auto& msg = out.emplace_back();
+    if constexpr (std::is_same_v<State, Sophus::SE2<typename State::Scalar>>) {
+      // With theta in (-pi, pi], theta / 2 lies in (-pi/2, pi/2], so
+      // cos(theta / 2) is never negative and sin(theta / 2) takes the sign
+      // of sin(theta); copysign also maps the theta == pi edge to +1.
+      const double cos_theta = pose.so2().unit_complex().x();
+      const double sin_theta = pose.so2().unit_complex().y();
+      msg.position.x = pose.translation().x();
+      msg.position.y = pose.translation().y();
+      msg.position.z = 0;
+      msg.orientation.w = std::sqrt((1. + cos_theta) / 2.);
+      msg.orientation.x = 0;
+      msg.orientation.y = 0;
+      msg.orientation.z = std::copysign(std::sqrt((1. - cos_theta) / 2.), sin_theta);
+    } else {
+      toMsg(pose, msg);
+    }
+  }
+  return out;
+}
+
 /// Converts a Transform message type to a Sophus SE2 type.
 /**
  * This function is a specialization of the fromMsg template defined in tf2/convert.h.
@@ -0,0 +1,152 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+#if BELUGA_ROS_VERSION == 1
+#include <boost/smart_ptr.hpp>
+#endif
+
+#include <sophus/se2.hpp>
+#include <sophus/so2.hpp>
+
+#include "beluga/primitives.hpp"
+#include "beluga_ros/laser_scan.hpp"
+#include "beluga_ros/messages.hpp"
+#include "beluga_ros/particle_cloud.hpp"
+#include "beluga_ros/tf2_sophus.hpp"
+
+namespace {
+
+auto make_scan_message(std::size_t beams) {
+#if BELUGA_ROS_VERSION == 2
+  auto message = std::make_shared<beluga_ros::msg::LaserScan>();
+#elif BELUGA_ROS_VERSION == 1
+  auto message = boost::make_shared<beluga_ros::msg::LaserScan>();
+#endif
+  message->angle_min = -2.0F;
+  message->angle_increment = 4.0F / static_cast<float>(beams);
+  message->angle_max = 2.0F;
+  message->range_min = 0.1F;
+  message->range_max = 30.0F;
+  message->ranges.resize(beams);
+  for (std::size_t index = 0; index < beams; ++index) {
+    message->ranges[index] = 1.0F + 0.01F * static_cast<float>(index % 100);
+  }
+  return message;
+}
+
+auto make_particles(std::size_t count) {
+  auto particles = std::vector<std::tuple<Sophus::SE2d, beluga::Weight>>{};
+  particles.reserve(count);
+  for (std::size_t index = 0; index < count; ++index) {
+    particles.emplace_back(
+        Sophus::SE2d{Sophus::SO2d{0.001 * static_cast<double>(index % 100)},
+                     Eigen::Vector2d{0.01 * static_cast<double>(index), 0.0}},
+        beluga::Weight(1.0));
+  }
+  return particles;
+}
+
+/// Scan-to-measurement conversion through the packed single-pass path, with
+/// the output buffer reused across scans as the nodes do.
+void BM_LaserScanFillMeasurement(benchmark::State& state) {
+  const auto beams = static_cast<std::size_t>(state.range(0));
+  const auto message = make_scan_message(beams);
+  const auto scan = beluga_ros::LaserScan(message);
+  auto measurement = std::vector<std::pair<double, double>>{};
+  for (auto _ : state) {
+    scan.fill_measurement(measurement);
+    benchmark::DoNotOptimize(measurement.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(beams));
+}
+
+/// Same conversion through the lazy view stack, for comparison against the
+/// packed path above.
+void BM_LaserScanLazyPoints(benchmark::State& state) {
+  const auto beams = static_cast<std::size_t>(state.range(0));
+  const auto message = make_scan_message(beams);
+  const auto scan = beluga_ros::LaserScan(message);
+  auto points = std::vector<std::pair<double, double>>{};
+  for (auto _ : state) {
+    points.clear();
+    for (const auto& point : scan.points_in_cartesian_coordinates()) {
+      points.emplace_back(point.x(), point.y());
+    }
+    benchmark::DoNotOptimize(points.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(beams));
+}
+
+/// Particle cloud publication with resampling to the requested sample size.
+void BM_AssignParticleCloud(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto particles = make_particles(count);
+  auto message = beluga_ros::msg::PoseArray{};
+  for (auto _ : state) {
+    beluga_ros::assign_particle_cloud(particles, count, message);
+    benchmark::DoNotOptimize(message.poses.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+}
+
+/// Particle cloud publication mirroring the distribution one to one, which
+/// isolates message assembly from the resampling above.
+void BM_AssignParticleCloudMatching(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto particles = make_particles(count);
+  auto message = beluga_ros::msg::PoseArray{};
+  for (auto _ : state) {
+    beluga_ros::assign_particle_cloud(particles, message);
+    benchmark::DoNotOptimize(message.poses.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+}
+
+/// Batch SE(2) pose conversion, with the output vector capacity reused.
+void BM_BatchPoseConversion(benchmark::State& state) {
+  const auto count = static_cast<std::size_t>(state.range(0));
+  const auto particles = make_particles(count);
+  auto poses = std::vector<Sophus::SE2d>{};
+  poses.reserve(count);
+  for (const auto& [pose, weight] : particles) {
+    poses.push_back(pose);
+  }
+  auto messages = std::vector<beluga_ros::msg::Pose>{};
+  for (auto _ : state) {
+    messages.clear();
+    tf2::toMsgs(poses, messages);
+    benchmark::DoNotOptimize(messages.data());
+  }
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(count));
+}
+
+// Beam counts covering low-cost lidars through high-resolution ones.
+BENCHMARK(BM_LaserScanFillMeasurement)->Arg(360)->Arg(1'080)->Arg(3'600);
+BENCHMARK(BM_LaserScanLazyPoints)->Arg(360)->Arg(1'080)->Arg(3'600);
+BENCHMARK(BM_AssignParticleCloud)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+BENCHMARK(BM_AssignParticleCloudMatching)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+BENCHMARK(BM_BatchPoseConversion)->RangeMultiplier(10)->Range(1'000, 1'000'000);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -37,3 +37,17 @@ target_link_libraries(test_laser_scan beluga_ros)
 ament_add_gmock(test_particle_cloud test_particle_cloud.cpp)
 target_compile_options(test_particle_cloud PRIVATE -Wno-deprecated-copy)
 target_link_libraries(test_particle_cloud beluga_ros)
+
+ament_add_gmock(test_particle_mirror test_particle_mirror.cpp)
+target_compile_options(test_particle_mirror PRIVATE -Wno-deprecated-copy)
+target_link_libraries(test_particle_mirror beluga_ros)
+
+ament_add_gmock(test_point_cloud test_point_cloud.cpp)
+target_compile_options(test_point_cloud PRIVATE -Wno-deprecated-copy)
+target_link_libraries(test_point_cloud beluga_ros)
+
+find_package(benchmark REQUIRED)
+
+add_executable(benchmark_beluga_ros benchmark_beluga_ros.cpp)
+target_compile_options(benchmark_beluga_ros PRIVATE -Wno-deprecated-copy)
+target_link_libraries(benchmark_beluga_ros beluga_ros benchmark::benchmark)
@@ -55,3 +55,26 @@ target_link_libraries(
   ${PROJECT_NAME}
   ${catkin_LIBRARIES}
   gmock_main)
+
+catkin_add_gmock(test_particle_mirror test_particle_mirror.cpp)
+target_link_libraries(
+  test_particle_mirror
+  ${PROJECT_NAME}
+  ${catkin_LIBRARIES}
+  gmock_main)
+
+catkin_add_gmock(test_point_cloud test_point_cloud.cpp)
+target_link_libraries(
+  test_point_cloud
+  ${PROJECT_NAME}
+  ${catkin_LIBRARIES}
+  gmock_main)
+
+find_package(benchmark REQUIRED)
+
+add_executable(benchmark_beluga_ros benchmark_beluga_ros.cpp)
+target_link_libraries(
+  benchmark_beluga_ros
+  ${PROJECT_NAME}
+  ${catkin_LIBRARIES}
+  benchmark::benchmark)
@@ -17,9 +17,15 @@
 #include <cstddef>
 #include <cstdint>
 #include <execution>
+#include <future>
 #include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
+#include <range/v3/view/span.hpp>
+
 #include <Eigen/Core>
 
 #if BELUGA_ROS_VERSION == 1
@@ -113,6 +119,105 @@ TEST(TestAmcl, UpdateWithParticles) {
   ASSERT_EQ(amcl.particles().size(), 50UL);
   auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
   ASSERT_TRUE(estimate.has_value());
+  // The handle materializes the covariance on demand and must agree with the mean.
+  const auto [pose, covariance] = std::pair<Sophus::SE2d, Sophus::Matrix3d>{estimate.value()};
+  ASSERT_TRUE(pose.matrix().isApprox(estimate->pose().matrix()));
+  ASSERT_TRUE(covariance.allFinite());
+}
+
+TEST(TestAmcl, SetParticleBounds) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  amcl.set_particle_bounds(10UL, 20UL);
+  // The particle state is untouched; the new bounds apply on the next resample.
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+  ASSERT_LE(amcl.particles().size(), 20UL);
+}
+
+TEST(TestAmcl, PartialMapUpdate) {
+  auto amcl = make_amcl();
+  ASSERT_EQ(amcl.particles().size(), 0);
+  amcl.initialize_from_map();
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  amcl.update_map(make_dummy_occupancy_grid(), beluga_ros::Amcl::map_region_type{0UL, 0UL, 9UL, 9UL});
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+}
+
+TEST(TestAmcl, UpdateWithPreconvertedMeasurement) {
+  auto amcl = make_amcl();
+  ASSERT_EQ(amcl.particles().size(), 0);
+  amcl.initialize_from_map();
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  auto measurement = std::vector<std::pair<double, double>>{};
+  make_dummy_laser_scan().fill_measurement(measurement);
+  auto estimate = amcl.update(
+      Sophus::SE2d{}, ranges::make_span(measurement.data(), static_cast<std::ptrdiff_t>(measurement.size())));
+  ASSERT_TRUE(estimate.has_value());
+}
+
+TEST(TestAmcl, MapBankSwitch) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  ASSERT_EQ(amcl.active_map_index(), 0UL);
+  auto map = make_dummy_occupancy_grid();
+  const auto index = amcl.add_map(map, beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, map});
+  ASSERT_EQ(index, 1UL);
+  amcl.switch_map(index);
+  ASSERT_EQ(amcl.active_map_index(), 1UL);
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+  amcl.switch_map(0UL);
+  ASSERT_EQ(amcl.active_map_index(), 0UL);
+}
+
+TEST(TestAmcl, MapBankSwitchKeepsParticles) {
+  auto amcl = make_amcl();
+  amcl.initialize(Sophus::SE2d{}, Eigen::Vector3d::Ones().asDiagonal());
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  auto map = make_dummy_occupancy_grid();
+  const auto index = amcl.add_map(map, beluga::LikelihoodFieldModel{beluga::LikelihoodFieldModelParam{}, map});
+  amcl.switch_map(index, false);
+  ASSERT_EQ(amcl.active_map_index(), index);
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  auto estimate = amcl.update(Sophus::SE2d{}, make_dummy_laser_scan());
+  ASSERT_TRUE(estimate.has_value());
+}
+
+TEST(TestAmcl, MapBankInvalidIndex) {
+  auto amcl = make_amcl();
+  ASSERT_THROW(amcl.switch_map(7UL), std::out_of_range);
+}
+
+TEST(TestAmcl, TryUpdateWithParticles) {
+  auto amcl = make_amcl();
+  ASSERT_EQ(amcl.particles().size(), 0);
+  amcl.initialize_from_map();
+  ASSERT_EQ(amcl.particles().size(), 50UL);
+  auto promise = std::promise<std::optional<std::pair<Sophus::SE2d, Sophus::Matrix3d>>>{};
+  auto future = promise.get_future();
+  ASSERT_TRUE(amcl.try_update(
+      Sophus::SE2d{}, make_dummy_laser_scan(), [&promise](auto estimate) { promise.set_value(std::move(estimate)); }));
+  ASSERT_TRUE(future.get().has_value());
+}
+
+TEST(TestAmcl, TryUpdateWhileBusy) {
+  auto amcl = make_amcl();
+  amcl.initialize_from_map();
+  auto release = std::promise<void>{};
+  auto release_future = release.get_future();
+  auto started = std::promise<void>{};
+  ASSERT_TRUE(amcl.try_update(Sophus::SE2d{}, make_dummy_laser_scan(), [&started, &release_future](auto) {
+    started.set_value();
+    release_future.wait();
+  }));
+  started.get_future().wait();
+  ASSERT_FALSE(amcl.try_update(Sophus::SE2d{}, make_dummy_laser_scan(), nullptr));
+  release.set_value();
 }
 
 TEST(TestAmcl, UpdateWithParticlesNoMotion) {
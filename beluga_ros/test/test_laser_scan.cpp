@@ -14,10 +14,14 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <limits>
 #include <memory>
+#include <utility>
 #include <vector>
 
 #include <range/v3/range/conversion.hpp>
+#include <range/v3/view/transform.hpp>
 
 #if BELUGA_ROS_VERSION == 1
 #include <boost/smart_ptr.hpp>
@@ -86,4 +90,80 @@ TEST(TestLaserScan, AngleIncrements) {
   ASSERT_NEAR(angles[2], 0.2, 0.001);
 }
 
+TEST(TestLaserScan, IntensitiesFromMessage) {
+  auto message = make_message();
+  message->ranges = std::vector<float>{1., 2., 3.};
+  message->intensities = std::vector<float>{10., 20., 30.};
+  auto scan = beluga_ros::LaserScan(message);
+  auto intensities = scan.intensities() | ranges::to<std::vector>;
+  ASSERT_EQ(intensities.size(), 3UL);
+  ASSERT_EQ(intensities[0], 10.);
+  ASSERT_EQ(intensities[1], 20.);
+  ASSERT_EQ(intensities[2], 30.);
+}
+
+TEST(TestLaserScan, PrunesBeamsBelowMinIntensity) {
+  auto message = make_message();
+  message->ranges = std::vector<float>{1.F, 2.F, 3.F, 4.F};
+  message->intensities = std::vector<float>{100.F, 5.F, 100.F, 5.F};
+  message->range_min = 0.5F;
+  message->range_max = 100.F;
+  const auto origin = Sophus::SE3d{};
+  constexpr auto kMaxBeams = 100UL;
+  constexpr auto kMinRange = 0.5;
+  constexpr auto kMaxRange = 100.;
+  constexpr auto kMinIntensity = 50.;
+  auto scan = beluga_ros::LaserScan(message, origin, kMaxBeams, kMinRange, kMaxRange, kMinIntensity);
+
+  // Low-intensity beams read as NaN and are dropped by the regular validity filtering.
+  const auto points = scan.points_in_cartesian_coordinates() | ranges::to<std::vector>;
+  ASSERT_EQ(points.size(), 2UL);
+
+  auto measurement = std::vector<std::pair<double, double>>{};
+  scan.fill_measurement(measurement);
+  ASSERT_EQ(measurement.size(), 2UL);
+}
+
+TEST(TestLaserScan, KeepsAllBeamsWithoutIntensities) {
+  auto message = make_message();
+  message->ranges = std::vector<float>{1.F, 2.F, 3.F};
+  message->range_min = 0.5F;
+  message->range_max = 100.F;
+  const auto origin = Sophus::SE3d{};
+  constexpr auto kMaxBeams = 100UL;
+  constexpr auto kMinRange = 0.5;
+  constexpr auto kMaxRange = 100.;
+  constexpr auto kMinIntensity = 50.;
+  auto scan = beluga_ros::LaserScan(message, origin, kMaxBeams, kMinRange, kMaxRange, kMinIntensity);
+  const auto points = scan.points_in_cartesian_coordinates() | ranges::to<std::vector>;
+  ASSERT_EQ(points.size(), 3UL);
+}
+
+TEST(TestLaserScan, FusedMeasurementMatchesLazyConversion) {
+  auto message = make_message();
+  message->ranges = std::vector<float>{1.F, 2.F, std::numeric_limits<float>::quiet_NaN(), 3.F, 150.F, 4.F};
+  message->range_min = 0.5F;
+  message->range_max = 100.F;
+  message->angle_min = -1.0F;
+  message->angle_increment = 0.25F;
+  const auto origin = Sophus::SE3d{Sophus::SO3d::rotZ(0.5), Eigen::Vector3d{1., 2., 3.}};
+  constexpr auto kMaxBeams = 5UL;
+  auto scan = beluga_ros::LaserScan(message, origin, kMaxBeams);
+
+  auto expected = scan.points_in_cartesian_coordinates() |  //
+                  ranges::views::transform([&scan](const auto& p) {
+                    const auto result = scan.origin() * Sophus::Vector3d{p.x(), p.y(), 0};
+                    return std::make_pair(result.x(), result.y());
+                  }) |
+                  ranges::to<std::vector>;
+
+  auto measurement = std::vector<std::pair<double, double>>{};
+  scan.fill_measurement(measurement);
+  ASSERT_EQ(measurement.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); ++i) {
+    EXPECT_NEAR(measurement[i].first, expected[i].first, 1e-6);
+    EXPECT_NEAR(measurement[i].second, expected[i].second, 1e-6);
+  }
+}
+
 }  // namespace
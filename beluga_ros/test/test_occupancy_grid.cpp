@@ -54,6 +54,42 @@ TEST(TestOccupancyGrid, Instantiation) {
   ASSERT_EQ(grid.height(), kHeight);
 }
 
+TEST(TestOccupancyGrid, PrecomputedClassification) {
+  constexpr std::size_t kWidth = 4;
+  constexpr std::size_t kHeight = 2;
+
+#if BELUGA_ROS_VERSION == 2
+  auto message = std::make_shared<beluga_ros::msg::OccupancyGrid>();
+#elif BELUGA_ROS_VERSION == 1
+  auto message = boost::make_shared<beluga_ros::msg::OccupancyGrid>();
+#else
+#error BELUGA_ROS_VERSION is not defined or invalid
+#endif
+  message->info.resolution = 1.0F;
+  message->info.width = kWidth;
+  message->info.height = kHeight;
+  message->data = std::vector<std::int8_t>{0, 100, -1, 0, 100, 0, -1, 100};
+
+  const auto grid = beluga_ros::OccupancyGrid{message};
+  const auto expected_free = std::vector<bool>{true, false, false, true, false, true, false, false};
+  const auto expected_occupied = std::vector<bool>{false, true, false, false, true, false, false, true};
+  for (std::size_t index = 0; index < grid.size(); ++index) {
+    ASSERT_EQ(grid.free_at(index), expected_free[index]) << "at index " << index;
+  }
+  ASSERT_FALSE(grid.free_at(grid.size()));  // out of range cells are non-free
+  std::size_t index = 0;
+  for (const bool occupied : grid.obstacle_data()) {
+    ASSERT_EQ(occupied, expected_occupied[index]) << "at index " << index;
+    ++index;
+  }
+  ASSERT_EQ(index, grid.size());
+  const auto bitmap = grid.packed_obstacle_data();
+  ASSERT_EQ(bitmap.size(), grid.size());
+  for (index = 0; index < grid.size(); ++index) {
+    ASSERT_EQ(bitmap.is_set(index), expected_occupied[index]) << "at index " << index;
+  }
+}
+
 TEST(TestOccupancyGrid, ValueTraitsIsFree) {
   ASSERT_TRUE(beluga_ros::OccupancyGrid::ValueTraits::is_free(0));
   ASSERT_FALSE(beluga_ros::OccupancyGrid::ValueTraits::is_free(50));
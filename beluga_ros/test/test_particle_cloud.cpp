@@ -85,6 +85,37 @@ TEST(TestParticleCloud, AssignMatchingEmpty) {
   EXPECT_EQ(message.poses.size(), 0U);
 }
 
+TEST(TestParticleCloud, AssignCompactPointCloud) {
+  const auto particles = std::vector{
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{0.5}, Eigen::Vector2d{1.0, 2.0}}, beluga::Weight(0.25)),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{-0.5}, Eigen::Vector2d{-3.0, 4.0}}, beluga::Weight(0.75)),
+  };
+  auto message = beluga_ros::msg::PointCloud2{};
+  beluga_ros::assign_particle_cloud(particles, message);
+  ASSERT_EQ(message.fields.size(), 4U);
+  EXPECT_EQ(message.fields[2].name, "theta");
+  EXPECT_EQ(message.width, 2U);
+  EXPECT_EQ(message.point_step, 16U);
+  ASSERT_EQ(message.data.size(), 32U);
+  const auto* values = reinterpret_cast<const float*>(message.data.data());
+  EXPECT_FLOAT_EQ(values[0], 1.0F);
+  EXPECT_FLOAT_EQ(values[1], 2.0F);
+  EXPECT_FLOAT_EQ(values[2], 0.5F);
+  EXPECT_FLOAT_EQ(values[3], 0.25F);
+  EXPECT_FLOAT_EQ(values[4], -3.0F);
+  EXPECT_FLOAT_EQ(values[5], 4.0F);
+  EXPECT_FLOAT_EQ(values[6], -0.5F);
+  EXPECT_FLOAT_EQ(values[7], 0.75F);
+}
+
+TEST(TestParticleCloud, AssignCompactPointCloudEmpty) {
+  const auto particles = std::vector<std::tuple<Sophus::SE2d, beluga::Weight>>{};
+  auto message = beluga_ros::msg::PointCloud2{};
+  beluga_ros::assign_particle_cloud(particles, message);
+  EXPECT_EQ(message.width, 0U);
+  EXPECT_EQ(message.data.size(), 0U);
+}
+
 TEST(TestParticleCloud, AssignMarkers) {
   using Constants = Sophus::Constants<double>;
   const auto particles = std::vector{
@@ -99,6 +130,36 @@ TEST(TestParticleCloud, AssignMarkers) {
   EXPECT_EQ(message.markers[1].points.size(), 3 * 2);  // 2 arrows, 3 vertices each
 }
 
+TEST(TestParticleCloud, AssignMarkersWithSampleBudget) {
+  auto particles = std::vector<std::tuple<Sophus::SE2d, beluga::Weight>>{};
+  for (int i = 0; i < 100; ++i) {
+    particles.emplace_back(
+        Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{static_cast<double>(i), 0.0}}, beluga::Weight(1.0));
+  }
+  constexpr std::size_t kMaxSamples = 10U;
+  auto message = beluga_ros::msg::MarkerArray{};
+  beluga_ros::assign_particle_cloud(particles, kMaxSamples, message);
+  ASSERT_EQ(message.markers.size(), 2U);
+  EXPECT_GT(message.markers[0].points.size(), 0U);
+  EXPECT_LE(message.markers[0].points.size(), kMaxSamples * 2);  // 2 vertices per arrow body
+  EXPECT_LE(message.markers[1].points.size(), kMaxSamples * 3);  // 3 vertices per arrow head
+}
+
+TEST(TestParticleCloud, AssignMarkersReusesBuffers) {
+  const auto particles = std::vector{
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{1.0, 0.0}}, beluga::Weight(0.5)),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{0.0, -1.0}}, beluga::Weight(0.5)),
+  };
+  auto message = beluga_ros::msg::MarkerArray{};
+  beluga_ros::assign_particle_cloud(particles, message);
+  ASSERT_EQ(message.markers.size(), 2U);
+  const auto* body_points = message.markers[0].points.data();
+  const auto* head_points = message.markers[1].points.data();
+  beluga_ros::assign_particle_cloud(particles, message);
+  EXPECT_EQ(message.markers[0].points.data(), body_points);
+  EXPECT_EQ(message.markers[1].points.data(), head_points);
+}
+
 TEST(TestParticleCloud, AssignNoMarkers) {
   const auto particles = std::vector<std::tuple<Sophus::SE2d, beluga::Weight>>{};
   auto message = beluga_ros::msg::MarkerArray{};
@@ -0,0 +1,89 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <stdexcept>
+#include <tuple>
+
+#include <sophus/se2.hpp>
+
+#include <beluga/containers/tuple_vector.hpp>
+#include <beluga/primitives.hpp>
+
+#include "beluga_ros/particle_mirror.hpp"
+
+namespace {
+
+using Particle = std::tuple<Sophus::SE2d, beluga::Weight>;
+
+constexpr const char* kSegmentName = "/beluga_ros_test_particle_mirror";
+constexpr std::size_t kCapacity = 100UL;
+
+TEST(TestParticleMirror, RoundTrip) {
+  auto mirror = beluga_ros::ParticleMirror<Particle>{kSegmentName, kCapacity};
+  auto input = beluga::TupleVector<Particle>{
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{0.5}, Eigen::Vector2d{1., 2.}}, beluga::Weight{0.25}),
+      std::make_tuple(Sophus::SE2d{Sophus::SO2d{-0.5}, Eigen::Vector2d{3., 4.}}, beluga::Weight{0.75}),
+  };
+  mirror.write(input);
+
+  auto reader = beluga_ros::ParticleMirrorReader<Particle>{kSegmentName};
+  ASSERT_EQ(reader.capacity(), kCapacity);
+  auto output = beluga::TupleVector<Particle>{};
+  ASSERT_TRUE(reader.read(output));
+  ASSERT_EQ(output.size(), input.size());
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    EXPECT_EQ(std::get<0>(output[i]).matrix(), std::get<0>(input[i]).matrix());
+    EXPECT_EQ(static_cast<double>(std::get<1>(output[i])), static_cast<double>(std::get<1>(input[i])));
+  }
+}
+
+TEST(TestParticleMirror, TracksLatestWrite) {
+  auto mirror = beluga_ros::ParticleMirror<Particle>{kSegmentName, kCapacity};
+  auto reader = beluga_ros::ParticleMirrorReader<Particle>{kSegmentName};
+  auto output = beluga::TupleVector<Particle>{};
+
+  auto input = beluga::TupleVector<Particle>{};
+  input.resize(3);
+  mirror.write(input);
+  ASSERT_TRUE(reader.read(output));
+  ASSERT_EQ(output.size(), 3UL);
+
+  input.resize(5);
+  mirror.write(input);
+  ASSERT_TRUE(reader.read(output));
+  ASSERT_EQ(output.size(), 5UL);
+}
+
+TEST(TestParticleMirror, RejectsOverCapacityWrites) {
+  auto mirror = beluga_ros::ParticleMirror<Particle>{kSegmentName, kCapacity};
+  auto input = beluga::TupleVector<Particle>{};
+  input.resize(kCapacity + 1UL);
+  ASSERT_THROW(mirror.write(input), std::invalid_argument);
+}
+
+TEST(TestParticleMirror, RejectsMismatchedLayout) {
+  auto mirror = beluga_ros::ParticleMirror<Particle>{kSegmentName, kCapacity};
+  using OtherParticle = std::tuple<Sophus::SE2d, beluga::Weight, beluga::Cluster>;
+  ASSERT_THROW(beluga_ros::ParticleMirrorReader<OtherParticle>{kSegmentName}, std::invalid_argument);
+}
+
+TEST(TestParticleMirror, UnlinksSegmentOnDestruction) {
+  { auto mirror = beluga_ros::ParticleMirror<Particle>{kSegmentName, kCapacity}; }
+  ASSERT_THROW(beluga_ros::ParticleMirrorReader<Particle>{kSegmentName}, std::runtime_error);
+}
+
+}  // namespace
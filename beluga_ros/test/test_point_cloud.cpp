@@ -0,0 +1,134 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <Eigen/Core>
+
+#if BELUGA_ROS_VERSION == 1
+#include <boost/smart_ptr.hpp>
+#endif
+
+#include <beluga/sensor/ndt_sensor_model.hpp>
+
+#include "beluga_ros/messages.hpp"
+#include "beluga_ros/point_cloud.hpp"
+
+namespace {
+
+auto make_message() {
+#if BELUGA_ROS_VERSION == 2
+  auto message = std::make_shared<beluga_ros::msg::PointCloud2>();
+#elif BELUGA_ROS_VERSION == 1
+  auto message = boost::make_shared<beluga_ros::msg::PointCloud2>();
+#else
+#error BELUGA_ROS_VERSION is not defined or invalid
+#endif
+  return message;
+}
+
+auto make_dummy_point_cloud(const std::vector<Eigen::Vector3f>& points) {
+  auto message = make_message();
+  constexpr std::uint32_t kPointStep = 4U * sizeof(float);  // x, y, z and padding
+
+  message->fields.resize(3);
+  const auto setup_field = [&message](std::size_t index, const char* name) {
+    auto& field = message->fields[index];
+    field.name = name;
+    field.offset = static_cast<std::uint32_t>(index * sizeof(float));
+    field.datatype = beluga_ros::msg::PointField::FLOAT32;
+    field.count = 1;
+  };
+  setup_field(0, "x");
+  setup_field(1, "y");
+  setup_field(2, "z");
+
+  message->height = 1;
+  message->width = static_cast<std::uint32_t>(points.size());
+  message->is_bigendian = false;
+  message->point_step = kPointStep;
+  message->row_step = message->width * kPointStep;
+  message->is_dense = true;
+
+  message->data.resize(points.size() * kPointStep);
+  auto* cursor = reinterpret_cast<float*>(message->data.data());
+  for (const auto& point : points) {
+    *cursor++ = point.x();
+    *cursor++ = point.y();
+    *cursor++ = point.z();
+    *cursor++ = 0.0F;  // padding
+  }
+  return message;
+}
+
+TEST(TestPointCloud, ReadsPointsInPlace) {
+  const auto points = std::vector<Eigen::Vector3f>{{1.0F, 2.0F, 3.0F}, {4.0F, 5.0F, 6.0F}, {7.0F, 8.0F, 9.0F}};
+  auto message = make_dummy_point_cloud(points);
+  auto cloud = beluga_ros::PointCloud3{message};
+  ASSERT_EQ(cloud.size(), points.size());
+  for (std::size_t index = 0; index < points.size(); ++index) {
+    ASSERT_EQ(cloud[index], points[index]);
+  }
+  // Maps alias the message buffer, no copy is made.
+  ASSERT_EQ(cloud[0].data(), reinterpret_cast<const float*>(message->data.data()));
+}
+
+TEST(TestPointCloud, PointsRange) {
+  const auto points = std::vector<Eigen::Vector3f>{{1.0F, 2.0F, 3.0F}, {4.0F, 5.0F, 6.0F}};
+  auto cloud = beluga_ros::PointCloud3{make_dummy_point_cloud(points)};
+  std::size_t index = 0;
+  for (const auto& point : cloud.points()) {
+    ASSERT_EQ(point, points[index++]);
+  }
+  ASSERT_EQ(index, points.size());
+}
+
+TEST(TestPointCloud, FeedsNdtCellConstruction) {
+  // Enough points in a single cell for the clustering to keep it.
+  auto points = std::vector<Eigen::Vector3f>{};
+  for (int i = 0; i < 10; ++i) {
+    points.emplace_back(0.5F + 0.01F * static_cast<float>(i), 0.5F, 0.5F);
+  }
+  auto cloud = beluga_ros::PointCloud3{make_dummy_point_cloud(points)};
+  const auto cells = beluga::detail::to_cells<3>(cloud, 1.0);
+  ASSERT_EQ(cells.size(), 1UL);
+  ASSERT_NEAR(cells.front().mean.x(), 0.545, 1e-6);
+  ASSERT_NEAR(cells.front().mean.y(), 0.5, 1e-6);
+  ASSERT_NEAR(cells.front().mean.z(), 0.5, 1e-6);
+}
+
+TEST(TestPointCloud, RejectsMissingField) {
+  auto message = make_dummy_point_cloud({{1.0F, 2.0F, 3.0F}});
+  message->fields.pop_back();  // drop z
+  ASSERT_THROW(beluga_ros::PointCloud3{message}, std::invalid_argument);
+}
+
+TEST(TestPointCloud, RejectsNonFloatField) {
+  auto message = make_dummy_point_cloud({{1.0F, 2.0F, 3.0F}});
+  message->fields[2].datatype = beluga_ros::msg::PointField::FLOAT64;
+  ASSERT_THROW(beluga_ros::PointCloud3{message}, std::invalid_argument);
+}
+
+TEST(TestPointCloud, RejectsNonConsecutiveFields) {
+  auto message = make_dummy_point_cloud({{1.0F, 2.0F, 3.0F}});
+  message->fields[2].offset = 3U * sizeof(float);
+  ASSERT_THROW(beluga_ros::PointCloud3{message}, std::invalid_argument);
+}
+
+}  // namespace
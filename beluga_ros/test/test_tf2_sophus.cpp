@@ -14,6 +14,9 @@
 
 #include <gtest/gtest.h>
 
+#include <cstddef>
+#include <vector>
+
 #include <sophus/se2.hpp>
 #include <sophus/se3.hpp>
 
@@ -71,4 +74,39 @@ TYPED_TEST(PoseConvertTest, ThereAndBackAgain) {
   ASSERT_EQ(message1, message2);
 }
 
+TEST(BatchPoseConvertTest, MatchesElementWiseConversion) {
+  auto poses = std::vector<Sophus::SE2d>{
+      Sophus::SE2d{},
+      Sophus::SE2d{Sophus::SO2d{1.0}, Eigen::Vector2d{1.0, 2.0}},
+      Sophus::SE2d{Sophus::SO2d{-2.5}, Eigen::Vector2d{-3.0, 0.5}},
+      Sophus::SE2d{Sophus::SO2d{Sophus::Constants<double>::pi()}, Eigen::Vector2d{0.0, 0.0}},
+  };
+  auto messages = std::vector<beluga_ros::msg::Pose>{};
+  tf2::toMsgs(poses, messages);
+  ASSERT_EQ(messages.size(), poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    auto expected = beluga_ros::msg::Pose{};
+    tf2::toMsg(poses[i], expected);
+    EXPECT_NEAR(messages[i].position.x, expected.position.x, 1e-12);
+    EXPECT_NEAR(messages[i].position.y, expected.position.y, 1e-12);
+    EXPECT_NEAR(messages[i].orientation.z, expected.orientation.z, 1e-12);
+    EXPECT_NEAR(messages[i].orientation.w, expected.orientation.w, 1e-12);
+  }
+}
+
+TEST(BatchPoseConvertTest, ConvertsSE3Elements) {
+  auto poses = std::vector<Sophus::SE3d>{
+      Sophus::SE3d{},
+      Sophus::SE3d{Sophus::SO3d::rotZ(1.0), Eigen::Vector3d{1.0, 2.0, 3.0}},
+  };
+  auto messages = std::vector<beluga_ros::msg::Pose>{};
+  tf2::toMsgs(poses, messages);
+  ASSERT_EQ(messages.size(), poses.size());
+  for (std::size_t i = 0; i < poses.size(); ++i) {
+    auto expected = beluga_ros::msg::Pose{};
+    tf2::toMsg(poses[i], expected);
+    EXPECT_EQ(messages[i], expected);
+  }
+}
+
 }  // namespace
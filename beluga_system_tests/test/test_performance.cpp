@@ -0,0 +1,305 @@
+// Copyright 2026 Ekumen, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * \file
+ * \brief Latency-focused counterpart of test_system.cpp.
+ *
+ * Replays the recorded bag through the full beluga_ros::Amcl path as fast as
+ * the filter can take it and asserts on p50/p99 scan-to-pose latency and peak
+ * resident set size per configuration. The thresholds are deliberately loose:
+ * the point is to catch integration-level regressions (an accidental copy per
+ * scan, a resampling loop gone quadratic, unbounded memory growth), not to
+ * benchmark the hardware; per-kernel performance is tracked by the benchmarks
+ * in the beluga package.
+ */
+
+#include <sys/resource.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <execution>
+#include <filesystem>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string_view>
+#include <tuple>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <tf2/convert.h>
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+#include <sophus/se2.hpp>
+#include <sophus/se3.hpp>
+
+#include <range/v3/view/generate_n.hpp>
+#include <range/v3/view/transform.hpp>
+#include <range/v3/view/zip.hpp>
+
+#include <beluga/motion/differential_drive_model.hpp>
+#include <beluga/random/multivariate_normal_distribution.hpp>
+#include <beluga/sensor/beam_model.hpp>
+#include <beluga/sensor/likelihood_field_model.hpp>
+
+#include <beluga_ros/amcl.hpp>
+#include <beluga_ros/laser_scan.hpp>
+#include <beluga_ros/occupancy_grid.hpp>
+#include <beluga_ros/tf2_sophus.hpp>
+
+#include <rosbag2_storage/storage_filter.hpp>
+
+#include <nav_msgs/msg/occupancy_grid.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+#include <rosbag2_cpp/reader.hpp>
+#include <sensor_msgs/msg/laser_scan.hpp>
+
+namespace {
+
+// ****************************************************************************
+// Test utilities.
+// ****************************************************************************
+
+/// Read messages from a specific topic in a ROS bag.
+template <typename Message>
+auto read_messages(const std::filesystem::path& bagfile, std::string_view topic) {
+  auto reader = std::make_shared<rosbag2_cpp::Reader>();  // wrapped in a shared pointer to make it copyable :)
+  reader->open(bagfile.native());
+
+  auto filter = rosbag2_storage::StorageFilter{};
+  filter.topics.emplace_back(topic);
+  reader->set_filter(filter);
+
+  std::size_t size = 0UL;
+  for (const auto& [topic_metadata, message_count] : reader->get_metadata().topics_with_message_count) {
+    if (topic_metadata.name == topic) {
+      size = message_count;
+      break;
+    }
+  }
+
+  return ranges::views::generate_n([reader]() mutable { return reader->read_next<Message>(); }, size);
+}
+
+/// Transform a range of odometry messages into a range of SE2 elements.
+auto odometry_to_sophus() {
+  return ranges::views::transform([](const nav_msgs::msg::Odometry& message) {
+    Sophus::SE2d out;
+    tf2::convert(message.pose.pose, out);
+    return out;
+  });
+}
+
+/// Returns the given percentile of the recorded latencies.
+auto percentile(std::vector<std::chrono::nanoseconds> latencies, double fraction) {
+  const auto rank = static_cast<std::ptrdiff_t>(fraction * static_cast<double>(latencies.size() - 1));
+  std::nth_element(latencies.begin(), latencies.begin() + rank, latencies.end());
+  return latencies[static_cast<std::size_t>(rank)];
+}
+
+/// Returns the peak resident set size of this process, in bytes.
+auto peak_resident_set_size() {
+  auto usage = rusage{};
+  getrusage(RUSAGE_SELF, &usage);
+  return static_cast<std::size_t>(usage.ru_maxrss) * 1024UL;  // ru_maxrss is in kilobytes on Linux
+}
+
+// ****************************************************************************
+// Latency test implementation.
+// ****************************************************************************
+
+/// Replays every datapoint through the filter and asserts on latency and memory.
+template <class Map, class MotionModel, class SensorModel, class Distribution, class Range>
+void particle_filter_latency_test(
+    const beluga_ros::AmclParams& params,
+    Map&& map,
+    MotionModel&& motion_model,
+    SensorModel&& sensor_model,
+    Distribution&& initial_distribution,
+    Range&& datapoints) {
+  auto filter = beluga_ros::Amcl{map, motion_model, sensor_model, params, std::execution::par};
+  filter.initialize(std::forward<Distribution>(initial_distribution));
+
+  // Thresholds were set with an order of magnitude of headroom over the times
+  // observed on a developer workstation, so they only trip on gross
+  // regressions and not on scheduler jitter or slower CI machines.
+  constexpr auto kExpectedP50 = std::chrono::milliseconds{250};
+  constexpr auto kExpectedP99 = std::chrono::milliseconds{1000};
+  constexpr std::size_t kExpectedPeakRss = 1024UL * 1024UL * 1024UL;  // 1 GiB
+
+  auto latencies = std::vector<std::chrono::nanoseconds>{};
+
+  for (auto [measurement, odom] : datapoints) {
+    // The scan wrapper is constructed before the clock starts, matching what a
+    // node pays per scan: conversion to a packed measurement plus the filter
+    // cycle, but not deserialization from the bag.
+    const auto start = std::chrono::steady_clock::now();
+    const auto estimate = filter.update(std::move(odom), std::move(measurement));
+    const auto stop = std::chrono::steady_clock::now();
+
+    if (!estimate.has_value()) {
+      continue;  // Skipped by the update policy; no filter cycle ran.
+    }
+    latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(stop - start));
+  }
+
+  ASSERT_GE(latencies.size(), 2UL) << "There were less than 2 updates to the filter";
+
+  const auto p50 = percentile(latencies, 0.50);
+  const auto p99 = percentile(latencies, 0.99);
+  const auto peak_rss = peak_resident_set_size();
+
+  std::cout << "updates: " << latencies.size()                                              //
+            << " p50: " << std::chrono::duration<double, std::milli>(p50).count() << " ms"  //
+            << " p99: " << std::chrono::duration<double, std::milli>(p99).count() << " ms"  //
+            << " peak RSS: " << static_cast<double>(peak_rss) / (1024.0 * 1024.0) << " MiB" << std::endl;
+
+  ASSERT_LE(p50, kExpectedP50);
+  ASSERT_LE(p99, kExpectedP99);
+  ASSERT_LE(peak_rss, kExpectedPeakRss);
+}
+
+// ****************************************************************************
+// Configuration variants, mirroring test_system.cpp.
+// ****************************************************************************
+
+using ParticleFilterParams = std::variant<beluga_ros::AmclParams>;
+
+auto get_particle_filter_params() {
+  return std::vector<ParticleFilterParams>{
+      beluga_ros::AmclParams{},  // Default configuration.
+      []() {
+        auto params = beluga_ros::AmclParams{};
+        params.selective_resampling = true;  // Enable selective resampling.
+        return params;
+      }(),
+  };
+}
+
+using MotionModel = std::variant<beluga::DifferentialDriveModel>;
+
+auto get_motion_models() {
+  return std::vector<MotionModel>{
+      [] {
+        auto motion_params = beluga::DifferentialDriveModelParam{};
+        motion_params.rotation_noise_from_rotation = 0.2;
+        motion_params.rotation_noise_from_translation = 0.2;
+        motion_params.translation_noise_from_translation = 0.2;
+        motion_params.translation_noise_from_rotation = 0.2;
+        return beluga::DifferentialDriveModel{motion_params};
+      }(),
+  };
+}
+
+using SensorModel = std::variant<
+    beluga::LikelihoodFieldModel<beluga_ros::OccupancyGrid>,
+    beluga::BeamSensorModel<beluga_ros::OccupancyGrid>>;
+
+using SensorModelBuilder = std::function<SensorModel(const beluga_ros::OccupancyGrid&)>;
+
+auto get_sensor_model_builders() {
+  return std::vector<SensorModelBuilder>{
+      [](const auto& map) -> SensorModel {
+        auto sensor_params = beluga::LikelihoodFieldModelParam{};
+        sensor_params.max_obstacle_distance = 2.0;
+        sensor_params.max_laser_distance = 100.0;
+        sensor_params.z_hit = 0.5;
+        sensor_params.z_random = 0.5;
+        sensor_params.sigma_hit = 0.2;
+        return beluga::LikelihoodFieldModel{sensor_params, map};
+      },
+      [](const auto& map) -> SensorModel {
+        auto sensor_params = beluga::BeamModelParam{};
+        sensor_params.beam_max_range = 100.0;
+        return beluga::BeamSensorModel{sensor_params, map};
+      }};
+}
+
+// ****************************************************************************
+// Test cases.
+// ****************************************************************************
+
+class ParticleFilterLatencyTest
+    : public testing::TestWithParam<std::tuple<ParticleFilterParams, MotionModel, SensorModelBuilder>> {};
+
+/// Get ROS bag perfect odometry data to be used in the tests.
+auto get_perfect_odometry_data() {
+  constexpr std::string_view bagfile = "./bags/perfect_odometry";
+  constexpr std::string_view map_topic = "/map";
+  constexpr std::string_view scan_topic = "/scan";
+  constexpr std::string_view odom_topic = "/odometry/ground_truth";
+
+  auto maps = read_messages<nav_msgs::msg::OccupancyGrid>(bagfile, map_topic);
+  EXPECT_EQ(maps.size(), 1) << "Expected map topic [" << map_topic << "] to have 1 message, got: " << maps.size();
+  auto map = std::make_shared<nav_msgs::msg::OccupancyGrid>(*maps.begin());
+
+  auto scan_to_measurement = ranges::views::transform([](sensor_msgs::msg::LaserScan msg) {
+    const auto laser_transform = Sophus::SE3d{Eigen::Quaterniond{1., 0., 0., 0.}, Eigen::Vector3d{0.28, 0., 0.}};
+    return beluga_ros::LaserScan{
+        std::make_shared<sensor_msgs::msg::LaserScan>(msg),
+        laser_transform,
+        60,    // max beam count
+        0.,    // range min
+        100.,  // range max
+    };
+  });
+
+  auto odometry = read_messages<nav_msgs::msg::Odometry>(bagfile, odom_topic) | odometry_to_sophus();
+  auto measurements = read_messages<sensor_msgs::msg::LaserScan>(bagfile, scan_topic) | scan_to_measurement;
+
+  EXPECT_EQ(measurements.size(), odometry.size());
+
+  auto datapoints = ranges::views::zip(measurements, odometry);
+
+  auto initial_distribution = beluga::MultivariateNormalDistribution{
+      Sophus::SE2d{Sophus::SO2d{}, Eigen::Vector2d{0.0, 2.0}},                 // initial pose mean
+      Eigen::Matrix3d{{0.125, 0.0, 0.0}, {0.0, 0.125, 0.0}, {0.0, 0.0, 0.04}}  // initial pose covariance
+  };
+
+  return std::make_tuple(beluga_ros::OccupancyGrid{std::move(map)}, datapoints, initial_distribution);
+}
+
+TEST_P(ParticleFilterLatencyTest, PerfectOdometryScanToPoseLatency) {
+  auto [map, datapoints, distribution] = get_perfect_odometry_data();
+  auto [particle_filter_params, motion_model, sensor_model_builder] = GetParam();
+  auto sensor_model = sensor_model_builder(map);
+  std::visit(
+      [map = std::move(map), distribution = std::move(distribution), datapoints = std::move(datapoints)]  //
+      (auto particle_filter_params, auto motion_model, auto sensor_model) mutable {
+        particle_filter_latency_test(
+            particle_filter_params,   //
+            std::move(map),           //
+            std::move(motion_model),  //
+            std::move(sensor_model),  //
+            std::move(distribution),  //
+            std::move(datapoints));
+      },
+      particle_filter_params, std::move(motion_model), std::move(sensor_model));
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    BagFileLatencyTest,
+    ParticleFilterLatencyTest,
+    testing::Combine(
+        testing::ValuesIn(get_particle_filter_params()),  //
+        testing::ValuesIn(get_motion_models()),           //
+        testing::ValuesIn(get_sensor_model_builders())));
+
+}  // namespace